@@ -0,0 +1 @@
+COPY person FROM "dataset/nullable-comparison-tests/vPerson.csv"
\ No newline at end of file
@@ -0,0 +1 @@
+create node table person (ID INT64, x INT64, y INT64, PRIMARY KEY (ID));
\ No newline at end of file
@@ -40,7 +40,8 @@ kU_DDL
     : kU_CreateNode
         | kU_CreateRel
         | kU_DropTable
-        | kU_AlterTable;
+        | kU_AlterTable
+        | kU_CreateIndex;
 
 kU_CreateNode
     : CREATE SP NODE SP TABLE SP oC_SchemaName SP? '(' SP? kU_PropertyDefinitions SP? ( ',' SP? kU_CreateNodeConstraint ) SP? ')' ;
@@ -86,6 +87,13 @@ RENAME: ( 'R' | 'r' ) ( 'E' | 'e' ) ( 'N' | 'n' ) ( 'A' | 'a' ) ( 'M' | 'm' ) (
 
 ADD: ( 'A' | 'a' ) ( 'D' | 'd' ) ( 'D' | 'd' ) ;
 
+kU_CreateIndex
+    : CREATE SP INDEX SP ON SP oC_SchemaName SP? '(' SP? oC_PropertyKeyName SP? ')' ;
+
+INDEX : ( 'I' | 'i' ) ( 'N' | 'n' ) ( 'D' | 'd' ) ( 'E' | 'e' ) ( 'X' | 'x' ) ;
+
+ON : ( 'O' | 'o' ) ( 'N' | 'n' ) ;
+
 kU_PropertyDefinitions : kU_PropertyDefinition ( SP? ',' SP? kU_PropertyDefinition )* ;
 
 kU_PropertyDefinition : oC_PropertyKeyName SP kU_DataType ;
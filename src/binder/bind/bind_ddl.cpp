@@ -1,5 +1,6 @@
 #include "binder/binder.h"
 #include "binder/ddl/bound_add_property.h"
+#include "binder/ddl/bound_create_index.h"
 #include "binder/ddl/bound_create_node_clause.h"
 #include "binder/ddl/bound_create_rel_clause.h"
 #include "binder/ddl/bound_drop_property.h"
@@ -7,6 +8,7 @@
 #include "binder/ddl/bound_rename_property.h"
 #include "binder/ddl/bound_rename_table.h"
 #include "parser/ddl/add_property.h"
+#include "parser/ddl/create_index.h"
 #include "parser/ddl/create_node_clause.h"
 #include "parser/ddl/create_rel_clause.h"
 #include "parser/ddl/drop_property.h"
@@ -122,6 +124,35 @@ std::unique_ptr<BoundStatement> Binder::bindRenameProperty(const Statement& stat
         tableID, tableName, propertyID, renameProperty.getNewName());
 }
 
+std::unique_ptr<BoundStatement> Binder::bindCreateIndex(const Statement& statement) {
+    auto& createIndex = (CreateIndex&)statement;
+    auto tableName = createIndex.getTableName();
+    auto tableID = bindNodeTableID(tableName);
+    auto nodeTableSchema = catalog.getReadOnlyVersion()->getNodeTableSchema(tableID);
+    auto propertyID = bindPropertyName(nodeTableSchema, createIndex.getPropertyName());
+    auto dataType = nodeTableSchema->getProperty(propertyID).dataType;
+    // Property indexes only support types with an order-preserving 8-byte key.
+    switch (dataType.typeID) {
+    case INT64:
+    case INT32:
+    case INT16:
+    case DOUBLE:
+    case DATE:
+    case TIMESTAMP:
+    case STRING:
+        break;
+    default:
+        throw BinderException("Cannot create an index on property " +
+                              createIndex.getPropertyName() + " of type " +
+                              Types::dataTypeToString(dataType) + ".");
+    }
+    if (nodeTableSchema->isPropertyIndexed(propertyID)) {
+        throw BinderException("Property " + createIndex.getPropertyName() +
+                              " of table: " + tableName + " is already indexed.");
+    }
+    return make_unique<BoundCreateIndex>(tableID, propertyID, tableName);
+}
+
 std::vector<PropertyNameDataType> Binder::bindPropertyNameDataTypes(
     std::vector<std::pair<std::string, std::string>> propertyNameDataTypes) {
     std::vector<PropertyNameDataType> boundPropertyNameDataTypes;
@@ -35,6 +35,9 @@ std::unique_ptr<BoundStatement> Binder::bind(const Statement& statement) {
     case StatementType::RENAME_PROPERTY: {
         return bindRenameProperty(statement);
     }
+    case StatementType::CREATE_INDEX: {
+        return bindCreateIndex(statement);
+    }
     case StatementType::QUERY: {
         return bindQuery((const RegularQuery&)statement);
     }
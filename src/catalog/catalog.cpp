@@ -149,7 +149,9 @@ uint64_t SerDeser::serializeValue<NodeTableSchema>(
     offset = SerDeser::serializeValue<TableSchema>((const TableSchema&)value, fileInfo, offset);
     offset = SerDeser::serializeValue<property_id_t>(value.primaryKeyPropertyID, fileInfo, offset);
     offset = SerDeser::serializeUnorderedSet<table_id_t>(value.fwdRelTableIDSet, fileInfo, offset);
-    return SerDeser::serializeUnorderedSet<table_id_t>(value.bwdRelTableIDSet, fileInfo, offset);
+    offset = SerDeser::serializeUnorderedSet<table_id_t>(value.bwdRelTableIDSet, fileInfo, offset);
+    return SerDeser::serializeUnorderedSet<property_id_t>(
+        value.indexedPropertyIDSet, fileInfo, offset);
 }
 
 template<>
@@ -160,7 +162,10 @@ uint64_t SerDeser::deserializeValue<NodeTableSchema>(
         SerDeser::deserializeValue<property_id_t>(value.primaryKeyPropertyID, fileInfo, offset);
     offset =
         SerDeser::deserializeUnorderedSet<table_id_t>(value.fwdRelTableIDSet, fileInfo, offset);
-    return SerDeser::deserializeUnorderedSet<table_id_t>(value.bwdRelTableIDSet, fileInfo, offset);
+    offset =
+        SerDeser::deserializeUnorderedSet<table_id_t>(value.bwdRelTableIDSet, fileInfo, offset);
+    return SerDeser::deserializeUnorderedSet<property_id_t>(
+        value.indexedPropertyIDSet, fileInfo, offset);
 }
 
 template<>
@@ -412,9 +417,19 @@ void Catalog::addProperty(table_id_t tableID, std::string propertyName, DataType
 void Catalog::dropProperty(table_id_t tableID, property_id_t propertyID) {
     initCatalogContentForWriteTrxIfNecessary();
     catalogContentForWriteTrx->getTableSchema(tableID)->dropProperty(propertyID);
+    if (catalogContentForWriteTrx->containNodeTable(tableID)) {
+        catalogContentForWriteTrx->getNodeTableSchema(tableID)->indexedPropertyIDSet.erase(
+            propertyID);
+    }
     wal->logDropPropertyRecord(tableID, propertyID);
 }
 
+void Catalog::addPropertyIndex(table_id_t tableID, property_id_t propertyID) {
+    initCatalogContentForWriteTrxIfNecessary();
+    catalogContentForWriteTrx->getNodeTableSchema(tableID)->addIndexedPropertyID(propertyID);
+    wal->logCreateIndexRecord(tableID, propertyID);
+}
+
 void Catalog::renameProperty(table_id_t tableID, property_id_t propertyID, std::string newName) {
     initCatalogContentForWriteTrxIfNecessary();
     catalogContentForWriteTrx->getTableSchema(tableID)->renameProperty(propertyID, newName);
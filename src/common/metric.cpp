@@ -4,9 +4,9 @@ namespace kuzu {
 namespace common {
 
 TimeMetric::TimeMetric(bool enable) : Metric(enable) {
-    accumulatedTime = 0;
+    accumulatedTicks = 0;
+    startTicks = 0;
     isStarted = false;
-    timer = Timer();
 }
 
 void TimeMetric::start() {
@@ -14,7 +14,7 @@ void TimeMetric::start() {
         return;
     }
     isStarted = true;
-    timer.start();
+    startTicks = TickCounter::now();
 }
 
 void TimeMetric::stop() {
@@ -24,13 +24,19 @@ void TimeMetric::stop() {
     if (!isStarted) {
         throw Exception("Timer metric has not started.");
     }
-    timer.stop();
-    accumulatedTime += timer.getDuration();
+    accumulatedTicks += TickCounter::now() - startTicks;
     isStarted = false;
 }
 
+void TimeMetric::increase(uint64_t ticks) {
+    if (!enabled) {
+        return;
+    }
+    accumulatedTicks += ticks;
+}
+
 double TimeMetric::getElapsedTimeMS() const {
-    return accumulatedTime / 1000;
+    return (double)accumulatedTicks / TickCounter::getTicksPerMicrosecond() / 1000;
 }
 
 NumericMetric::NumericMetric(bool enable) : Metric(enable) {
@@ -51,5 +57,31 @@ void NumericMetric::incrementByOne() {
     accumulatedValue++;
 }
 
+void ResourceCounters::add(const ResourceCounters& other) {
+    numPagePins += other.numPagePins;
+    numPageCacheMisses += other.numPageCacheMisses;
+    numMappedPageAccesses += other.numMappedPageAccesses;
+    numBytesReadFromDisk += other.numBytesReadFromDisk;
+    numMemoryBlocksAllocated += other.numMemoryBlocksAllocated;
+    numHashChainEntriesVisited += other.numHashChainEntriesVisited;
+}
+
+void ResourceCounters::subtract(const ResourceCounters& other) {
+    numPagePins -= other.numPagePins;
+    numPageCacheMisses -= other.numPageCacheMisses;
+    numMappedPageAccesses -= other.numMappedPageAccesses;
+    numBytesReadFromDisk -= other.numBytesReadFromDisk;
+    numMemoryBlocksAllocated -= other.numMemoryBlocksAllocated;
+    numHashChainEntriesVisited -= other.numHashChainEntriesVisited;
+}
+
+void ResourceMetric::stop() {
+    if (!enabled) {
+        return;
+    }
+    accumulatedCounters.add(ResourceCounters::getThreadLocalCounters());
+    accumulatedCounters.subtract(countersAtStart);
+}
+
 } // namespace common
 } // namespace kuzu
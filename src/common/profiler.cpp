@@ -19,6 +19,13 @@ NumericMetric* Profiler::registerNumericMetric(const std::string& key) {
     return metricPtr;
 }
 
+ResourceMetric* Profiler::registerResourceMetric(const std::string& key) {
+    auto resourceMetric = std::make_unique<ResourceMetric>(enabled);
+    auto metricPtr = resourceMetric.get();
+    addMetric(key, std::move(resourceMetric));
+    return metricPtr;
+}
+
 double Profiler::sumAllTimeMetricsWithKey(const std::string& key) {
     auto sum = 0.0;
     if (!metrics.contains(key)) {
@@ -30,6 +37,17 @@ double Profiler::sumAllTimeMetricsWithKey(const std::string& key) {
     return sum;
 }
 
+std::vector<double> Profiler::getAllTimeMetricsWithKey(const std::string& key) {
+    std::vector<double> result;
+    if (!metrics.contains(key)) {
+        return result;
+    }
+    for (auto& metric : metrics.at(key)) {
+        result.push_back(((TimeMetric*)metric.get())->getElapsedTimeMS());
+    }
+    return result;
+}
+
 uint64_t Profiler::sumAllNumericMetricsWithKey(const std::string& key) {
     auto sum = 0ul;
     if (!metrics.contains(key)) {
@@ -41,6 +59,17 @@ uint64_t Profiler::sumAllNumericMetricsWithKey(const std::string& key) {
     return sum;
 }
 
+ResourceCounters Profiler::sumAllResourceMetricsWithKey(const std::string& key) {
+    ResourceCounters sum;
+    if (!metrics.contains(key)) {
+        return sum;
+    }
+    for (auto& metric : metrics.at(key)) {
+        sum.add(((ResourceMetric*)metric.get())->accumulatedCounters);
+    }
+    return sum;
+}
+
 void Profiler::addMetric(const std::string& key, std::unique_ptr<Metric> metric) {
     std::lock_guard<std::mutex> lck(mtx);
     if (!metrics.contains(key)) {
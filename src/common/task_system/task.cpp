@@ -8,6 +8,10 @@ Task::Task(uint64_t maxNumThreads) : maxNumThreads{maxNumThreads} {}
 bool Task::registerThread() {
     lock_t lck{mtx};
     if (!hasExceptionNoLock() && canRegisterInternalNoLock()) {
+        // Workers that yielded may have left the task before, see TaskScheduler.
+        if (startTicks == 0) {
+            startTicks = TickCounter::now();
+        }
         numThreadsRegistered++;
         return true;
     }
@@ -18,6 +22,16 @@ void Task::deRegisterThreadAndFinalizeTaskIfNecessary() {
     lock_t lck{mtx};
     ++numThreadsFinished;
     if (!hasExceptionNoLock() && isCompletedNoLock()) {
+        completedTicks = TickCounter::now();
+        finalizeIfNecessary();
+    }
+}
+
+void Task::deRegisterYieldingThreadAndFinalizeTaskIfNecessary() {
+    lock_t lck{mtx};
+    --numThreadsRegistered;
+    if (!hasExceptionNoLock() && isCompletedNoLock()) {
+        completedTicks = TickCounter::now();
         finalizeIfNecessary();
     }
 }
@@ -8,9 +8,12 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace common {
 
-TaskScheduler::TaskScheduler(uint64_t numThreads)
-    : logger{LoggerUtils::getLogger(LoggerConstants::LoggerEnum::PROCESSOR)}, nextScheduledTaskID{
-                                                                                  0} {
+thread_local TaskScheduler::WorkerState TaskScheduler::workerState;
+
+TaskScheduler::TaskScheduler(
+    uint64_t numThreads, uint64_t timeSliceInMicros, std::function<uint64_t()> clock)
+    : logger{LoggerUtils::getLogger(LoggerConstants::LoggerEnum::PROCESSOR)},
+      nextScheduledTaskID{0}, timeSliceInMicros{timeSliceInMicros}, clock{std::move(clock)} {
     for (auto n = 0u; n < numThreads; ++n) {
         threads.emplace_back([&] { runWorkerThread(); });
     }
@@ -26,6 +29,7 @@ TaskScheduler::~TaskScheduler() {
 std::shared_ptr<ScheduledTask> TaskScheduler::scheduleTask(const std::shared_ptr<Task>& task) {
     lock_t lck{mtx};
     auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
+    task->setScheduled();
     taskQueue.push_back(scheduledTask);
     return scheduledTask;
 }
@@ -87,13 +91,11 @@ void TaskScheduler::waitUntilEnoughTasksFinish(int64_t minimumNumTasksToSchedule
 
 std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
     lock_t lck{mtx};
-    if (taskQueue.empty()) {
-        return nullptr;
-    }
+    std::shared_ptr<ScheduledTask> taskToRegister = nullptr;
     auto it = taskQueue.begin();
     while (it != taskQueue.end()) {
         auto task = (*it)->task;
-        if (!task->registerThread()) {
+        if (!task->canRegisterThread()) {
             // If we cannot register for a thread it is because of three possibilities:
             // (i) maximum number of threads have registered for task and the task is completed
             // without an exception; or (ii) same as (i) but the task has not yet successfully
@@ -105,11 +107,73 @@ std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
             } else { // option (ii) or (iii): keep the task in the queue.
                 ++it;
             }
-        } else {
-            return *it;
+            continue;
+        }
+        if (taskToRegister == nullptr || hasPriorityOver(**it, *taskToRegister)) {
+            taskToRegister = *it;
+        }
+        ++it;
+    }
+    // Workers register to tasks only under the scheduler lock, but a worker of the task can set an
+    // exception concurrently.
+    if (taskToRegister == nullptr || !taskToRegister->task->registerThread()) {
+        return nullptr;
+    }
+    taskToRegister->numActiveWorkers++;
+    return taskToRegister;
+}
+
+void TaskScheduler::runTask(ScheduledTask& scheduledTask) {
+    workerState.task = &scheduledTask;
+    workerState.sliceStartTime = clock();
+    workerState.hasYielded = false;
+    try {
+        scheduledTask.task->run();
+    } catch (std::exception& e) {
+        scheduledTask.task->setException(std::current_exception());
+        workerState.hasYielded = false;
+    }
+    lock_t lck{mtx};
+    scheduledTask.numActiveWorkers--;
+    scheduledTask.workerTime += clock() - workerState.sliceStartTime;
+    lck.unlock();
+    workerState.task = nullptr;
+    if (workerState.hasYielded) {
+        scheduledTask.task->deRegisterYieldingThreadAndFinalizeTaskIfNecessary();
+    } else {
+        scheduledTask.task->deRegisterThreadAndFinalizeTaskIfNecessary();
+    }
+}
+
+bool TaskScheduler::shouldYieldCurrentTask() {
+    auto currentTask = workerState.task;
+    if (currentTask == nullptr) {
+        return false;
+    }
+    auto now = clock();
+    if (now - workerState.sliceStartTime < timeSliceInMicros) {
+        return false;
+    }
+    lock_t lck{mtx};
+    // Account the time slice so that the lock is taken at most once per time slice.
+    currentTask->workerTime += now - workerState.sliceStartTime;
+    workerState.sliceStartTime = now;
+    for (auto& scheduledTask : taskQueue) {
+        if (scheduledTask.get() != currentTask &&
+            scheduledTask->numActiveWorkers < currentTask->numActiveWorkers &&
+            scheduledTask->workerTime < currentTask->workerTime &&
+            scheduledTask->task->canRegisterThread()) {
+            workerState.hasYielded = true;
+            return true;
         }
     }
-    return nullptr;
+    return false;
+}
+
+uint64_t TaskScheduler::getSteadyClockTimeInMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch())
+        .count();
 }
 
 void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
@@ -123,6 +187,7 @@ void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
 }
 
 void TaskScheduler::runWorkerThread() {
+    workerState.scheduler = this;
     while (true) {
         if (stopThreads.load()) {
             break;
@@ -133,14 +198,7 @@ void TaskScheduler::runWorkerThread() {
                 std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
             continue;
         }
-        try {
-            scheduledTask->task->run();
-            scheduledTask->task->deRegisterThreadAndFinalizeTaskIfNecessary();
-        } catch (std::exception& e) {
-            scheduledTask->task->setException(std::current_exception());
-            scheduledTask->task->deRegisterThreadAndFinalizeTaskIfNecessary();
-            continue;
-        }
+        runTask(*scheduledTask);
     }
 }
 
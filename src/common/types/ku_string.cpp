@@ -42,18 +42,6 @@ std::string ku_string_t::getAsString() const {
     }
 }
 
-bool ku_string_t::operator==(const ku_string_t& rhs) const {
-    // First compare the length and prefix of the strings.
-    auto numBytesOfLenAndPrefix =
-        sizeof(uint32_t) +
-        std::min((uint64_t)len, static_cast<uint64_t>(ku_string_t::PREFIX_LENGTH));
-    if (!memcmp(this, &rhs, numBytesOfLenAndPrefix)) {
-        // If length and prefix of a and b are equal, we compare the overflow buffer.
-        return !memcmp(getData(), rhs.getData(), len);
-    }
-    return false;
-}
-
 bool ku_string_t::operator>(const ku_string_t& rhs) const {
     // Compare ku_string_t up to the shared length.
     // If there is a tie, we just need to compare the std::string lengths.
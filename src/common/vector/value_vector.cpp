@@ -1,20 +1,33 @@
 #include "common/vector/value_vector.h"
 
+#include <cstring>
+
 #include "common/in_mem_overflow_buffer_utils.h"
 
 namespace kuzu {
 namespace common {
 
-ValueVector::ValueVector(DataType dataType, storage::MemoryManager* memoryManager)
+ValueVector::ValueVector(
+    DataType dataType, storage::MemoryManager* memoryManager, VectorArena* arena)
     : dataType{std::move(dataType)} {
-    valueBuffer = std::make_unique<uint8_t[]>(
-        Types::getDataTypeSize(this->dataType) * DEFAULT_VECTOR_CAPACITY);
+    numBytesPerValue = Types::getDataTypeSize(this->dataType);
+    auto valueBufferSize = numBytesPerValue * DEFAULT_VECTOR_CAPACITY;
+    if (arena != nullptr) {
+        // Arena memory is recycled, so it is zeroed to match a freshly allocated buffer.
+        valueBuffer = arena->allocate(valueBufferSize);
+        memset(valueBuffer, 0, valueBufferSize);
+        nullMask = std::make_unique<NullMask>(
+            (uint64_t*)arena->allocate(NullMask::DEFAULT_NUM_NULL_ENTRIES * sizeof(uint64_t)),
+            NullMask::DEFAULT_NUM_NULL_ENTRIES);
+    } else {
+        ownedValueBuffer = std::make_unique<uint8_t[]>(valueBufferSize);
+        valueBuffer = ownedValueBuffer.get();
+        nullMask = std::make_unique<NullMask>();
+    }
     if (needOverflowBuffer()) {
         assert(memoryManager != nullptr);
         inMemOverflowBuffer = std::make_unique<InMemOverflowBuffer>(memoryManager);
     }
-    nullMask = std::make_unique<NullMask>();
-    numBytesPerValue = Types::getDataTypeSize(this->dataType);
 }
 
 void ValueVector::addString(uint32_t pos, char* value, uint64_t len) const {
@@ -48,7 +61,7 @@ bool NodeIDVector::discardNull(ValueVector& vector) {
 
 template<typename T>
 void ValueVector::setValue(uint32_t pos, T val) {
-    ((T*)valueBuffer.get())[pos] = val;
+    ((T*)valueBuffer)[pos] = val;
 }
 
 template<>
@@ -0,0 +1,38 @@
+#include "common/vector/vector_arena.h"
+
+namespace kuzu {
+namespace common {
+
+static thread_local std::vector<std::unique_ptr<uint8_t[]>> cachedChunks;
+
+VectorArena::~VectorArena() {
+    for (auto& chunk : chunks) {
+        if (cachedChunks.size() >= MAX_NUM_CACHED_CHUNKS_PER_THREAD) {
+            break;
+        }
+        cachedChunks.push_back(std::move(chunk));
+    }
+}
+
+uint8_t* VectorArena::allocate(uint64_t numBytes) {
+    numBytes = (numBytes + 7) & ~(uint64_t)7;
+    if (numBytes > CHUNK_SIZE) {
+        largeBuffers.push_back(std::make_unique_for_overwrite<uint8_t[]>(numBytes));
+        return largeBuffers.back().get();
+    }
+    if (currentChunkOffset + numBytes > CHUNK_SIZE) {
+        if (cachedChunks.empty()) {
+            chunks.push_back(std::make_unique_for_overwrite<uint8_t[]>(CHUNK_SIZE));
+        } else {
+            chunks.push_back(std::move(cachedChunks.back()));
+            cachedChunks.pop_back();
+        }
+        currentChunkOffset = 0;
+    }
+    auto buffer = chunks.back().get() + currentChunkOffset;
+    currentChunkOffset += numBytes;
+    return buffer;
+}
+
+} // namespace common
+} // namespace kuzu
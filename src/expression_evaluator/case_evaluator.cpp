@@ -69,7 +69,8 @@ std::unique_ptr<BaseExpressionEvaluator> CaseExpressionEvaluator::clone() {
 
 void CaseExpressionEvaluator::resolveResultVector(
     const ResultSet& resultSet, MemoryManager* memoryManager) {
-    resultVector = std::make_shared<ValueVector>(expression->dataType, memoryManager);
+    resultVector = std::make_shared<ValueVector>(
+        expression->dataType, memoryManager, resultSet.vectorArena);
     std::vector<BaseExpressionEvaluator*> inputEvaluators;
     for (auto& alternative : alternativeEvaluators) {
         inputEvaluators.push_back(alternative->whenEvaluator.get());
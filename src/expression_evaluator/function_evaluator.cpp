@@ -44,7 +44,8 @@ std::unique_ptr<BaseExpressionEvaluator> FunctionExpressionEvaluator::clone() {
 
 void FunctionExpressionEvaluator::resolveResultVector(
     const ResultSet& resultSet, MemoryManager* memoryManager) {
-    resultVector = std::make_shared<ValueVector>(expression->dataType, memoryManager);
+    resultVector = std::make_shared<ValueVector>(
+        expression->dataType, memoryManager, resultSet.vectorArena);
     std::vector<BaseExpressionEvaluator*> inputEvaluators;
     for (auto& child : children) {
         inputEvaluators.push_back(child.get());
@@ -0,0 +1,297 @@
+#include "expression_evaluator/fused_evaluator.h"
+
+#include <bit>
+#include <cstring>
+
+#include "function/arithmetic/arithmetic_operations.h"
+#include "function/comparison/comparison_operations.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function::operation;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+
+namespace kuzu {
+namespace evaluator {
+
+template<typename T, typename FUNC>
+static void executeArithmetic(const uint8_t* left, const uint8_t* right, uint8_t* result,
+    uint64_t tileSize) {
+    auto leftValues = (const T*)left;
+    auto rightValues = (const T*)right;
+    auto resultValues = (T*)result;
+    for (auto i = 0u; i < tileSize; ++i) {
+        FUNC::operation(leftValues[i], rightValues[i], resultValues[i]);
+    }
+}
+
+template<typename T, typename FUNC>
+static void executeComparison(const uint8_t* left, const uint8_t* right, uint8_t* result,
+    uint64_t tileSize) {
+    auto leftValues = (const T*)left;
+    auto rightValues = (const T*)right;
+    for (auto i = 0u; i < tileSize; ++i) {
+        FUNC::operation(leftValues[i], rightValues[i], result[i]);
+    }
+}
+
+template<typename FUNC>
+static void executeComparisonOnType(DataTypeID typeID, const uint8_t* left, const uint8_t* right,
+    uint8_t* result, uint64_t tileSize) {
+    if (typeID == INT64) {
+        executeComparison<int64_t, FUNC>(left, right, result, tileSize);
+    } else {
+        assert(typeID == DOUBLE);
+        executeComparison<double, FUNC>(left, right, result, tileSize);
+    }
+}
+
+template<typename FUNC>
+static void executeArithmeticOnType(DataTypeID typeID, const uint8_t* left, const uint8_t* right,
+    uint8_t* result, uint64_t tileSize) {
+    if (typeID == INT64) {
+        // Null positions of the tile are evaluated too, on whatever values their slots hold, so
+        // INT64 is computed in unsigned arithmetic, which wraps around instead of overflowing. For
+        // +, - and *, the bits of the result are the same as the ones of the signed result.
+        executeArithmetic<uint64_t, FUNC>(left, right, result, tileSize);
+    } else {
+        assert(typeID == DOUBLE);
+        executeArithmetic<double, FUNC>(left, right, result, tileSize);
+    }
+}
+
+// Bit i is set if the i-th boolean of the tile is true.
+static inline uint64_t getTrueBits(const uint8_t* values, uint64_t tileSize) {
+    uint64_t bits = 0;
+    for (auto i = 0u; i < tileSize; ++i) {
+        bits |= (uint64_t)(values[i] != 0) << i;
+    }
+    return bits;
+}
+
+static inline void setBooleans(uint64_t trueBits, uint8_t* values, uint64_t tileSize) {
+    for (auto i = 0u; i < tileSize; ++i) {
+        values[i] = (trueBits >> i) & 1;
+    }
+}
+
+void FusedExpressionEvaluator::evaluate() {
+    auto unflatState = loadFlatLeaves();
+    auto& result = registers.back();
+    auto numBytesPerValue = resultVector->getNumBytesPerValue();
+    if (unflatState == nullptr) {
+        evaluateTile(nullptr, 0 /* tileStart */, 1 /* tileSize */);
+        auto pos = resultVector->state->selVector->selectedPositions[0];
+        resultVector->setNull(pos, result.nulls & 1);
+        memcpy(resultVector->getData() + pos * numBytesPerValue, result.values, numBytesPerValue);
+        return;
+    }
+    auto& selVector = *unflatState->selVector;
+    auto resultNullEntries = resultVector->getNullMaskData();
+    auto hasNull = false;
+    for (auto tileStart = 0u; tileStart < selVector.selectedSize; tileStart += TILE_SIZE) {
+        auto tileSize = std::min<uint64_t>(TILE_SIZE, selVector.selectedSize - tileStart);
+        evaluateTile(unflatState, tileStart, tileSize);
+        auto nulls = result.nulls & NULL_LOWER_MASKS[tileSize];
+        hasNull |= nulls != NullMask::NO_NULL_ENTRY;
+        if (selVector.isUnfiltered()) {
+            memcpy(resultVector->getData() + tileStart * numBytesPerValue, result.values,
+                tileSize * numBytesPerValue);
+            resultNullEntries[tileStart >> NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2] = nulls;
+        } else {
+            for (auto i = 0u; i < tileSize; ++i) {
+                auto pos = selVector.selectedPositions[tileStart + i];
+                memcpy(resultVector->getData() + pos * numBytesPerValue,
+                    result.values + i * numBytesPerValue, numBytesPerValue);
+                resultVector->setNull(pos, (nulls >> i) & 1);
+            }
+        }
+    }
+    if (hasNull) {
+        resultVector->setMayContainNulls();
+    }
+}
+
+bool FusedExpressionEvaluator::select(SelectionVector& selVector) {
+    assert(program->resultType.typeID == BOOL);
+    auto unflatState = loadFlatLeaves();
+    auto& result = registers.back();
+    if (unflatState == nullptr) {
+        evaluateTile(nullptr, 0 /* tileStart */, 1 /* tileSize */);
+        return result.values[0] && !(result.nulls & 1);
+    }
+    auto& inputSelVector = *unflatState->selVector;
+    auto numValues = inputSelVector.selectedSize;
+    auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
+    uint64_t numSelectedValues = 0;
+    for (auto tileStart = 0u; tileStart < numValues; tileStart += TILE_SIZE) {
+        auto tileSize = std::min<uint64_t>(TILE_SIZE, numValues - tileStart);
+        evaluateTile(unflatState, tileStart, tileSize);
+        auto selectedBits = getTrueBits(result.values, tileSize) & ~result.nulls;
+        // Positions are written behind the ones read, so selecting in place is safe.
+        while (selectedBits != 0) {
+            auto i = tileStart + std::countr_zero(selectedBits);
+            selectedPositionsBuffer[numSelectedValues++] =
+                inputSelVector.isUnfiltered() ? i : inputSelVector.selectedPositions[i];
+            selectedBits &= selectedBits - 1;
+        }
+    }
+    selVector.selectedSize = numSelectedValues;
+    return numSelectedValues > 0;
+}
+
+std::unique_ptr<BaseExpressionEvaluator> FusedExpressionEvaluator::clone() {
+    std::vector<std::unique_ptr<BaseExpressionEvaluator>> clonedLeaves;
+    for (auto& leaf : children) {
+        clonedLeaves.push_back(leaf->clone());
+    }
+    return make_unique<FusedExpressionEvaluator>(program, std::move(clonedLeaves));
+}
+
+void FusedExpressionEvaluator::resolveResultVector(
+    const ResultSet& resultSet, MemoryManager* memoryManager) {
+    resultVector =
+        std::make_shared<ValueVector>(program->resultType, memoryManager, resultSet.vectorArena);
+    std::vector<BaseExpressionEvaluator*> inputEvaluators;
+    for (auto& leaf : children) {
+        inputEvaluators.push_back(leaf.get());
+    }
+    resolveResultStateFromChildren(inputEvaluators);
+    registers.resize(program->instructions.size());
+}
+
+DataChunkState* FusedExpressionEvaluator::loadFlatLeaves() {
+    DataChunkState* unflatState = nullptr;
+    for (auto i = 0u; i < program->instructions.size(); ++i) {
+        auto& instruction = program->instructions[i];
+        if (instruction.opType != FusedOpType::LEAF) {
+            continue;
+        }
+        auto& vector = *children[instruction.leftIdx]->resultVector;
+        if (!vector.state->isFlat()) {
+            unflatState = vector.state.get();
+            continue;
+        }
+        auto& reg = registers[i];
+        auto pos = vector.state->selVector->selectedPositions[0];
+        auto numBytesPerValue = vector.getNumBytesPerValue();
+        for (auto j = 0u; j < TILE_SIZE; ++j) {
+            memcpy(reg.buffer + j * numBytesPerValue, vector.getData() + pos * numBytesPerValue,
+                numBytesPerValue);
+        }
+        reg.values = reg.buffer;
+        reg.nulls = vector.isNull(pos) ? NullMask::ALL_NULL_ENTRY : NullMask::NO_NULL_ENTRY;
+    }
+    return unflatState;
+}
+
+void FusedExpressionEvaluator::loadUnflatLeaf(const ValueVector& vector, Register& reg,
+    const SelectionVector& selVector, uint64_t tileStart, uint64_t tileSize) {
+    auto numBytesPerValue = vector.getNumBytesPerValue();
+    if (selVector.isUnfiltered()) {
+        reg.values = vector.getData() + tileStart * numBytesPerValue;
+        reg.nulls = vector.hasNoNullsGuarantee() ?
+                        NullMask::NO_NULL_ENTRY :
+                        ((ValueVector&)vector)
+                            .getNullMaskData()[tileStart >> NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2];
+        return;
+    }
+    reg.nulls = NullMask::NO_NULL_ENTRY;
+    for (auto i = 0u; i < tileSize; ++i) {
+        auto pos = selVector.selectedPositions[tileStart + i];
+        memcpy(reg.buffer + i * numBytesPerValue, vector.getData() + pos * numBytesPerValue,
+            numBytesPerValue);
+    }
+    if (!vector.hasNoNullsGuarantee()) {
+        for (auto i = 0u; i < tileSize; ++i) {
+            reg.nulls |= (uint64_t)vector.isNull(selVector.selectedPositions[tileStart + i]) << i;
+        }
+    }
+    reg.values = reg.buffer;
+}
+
+void FusedExpressionEvaluator::evaluateTile(
+    DataChunkState* unflatState, uint64_t tileStart, uint64_t tileSize) {
+    for (auto i = 0u; i < program->instructions.size(); ++i) {
+        auto& instruction = program->instructions[i];
+        auto& reg = registers[i];
+        if (instruction.opType == FusedOpType::LEAF) {
+            auto& vector = *children[instruction.leftIdx]->resultVector;
+            if (!vector.state->isFlat()) {
+                loadUnflatLeaf(vector, reg, *unflatState->selVector, tileStart, tileSize);
+            }
+            continue;
+        }
+        auto& left = registers[instruction.leftIdx];
+        auto typeID = instruction.operandTypeID;
+        reg.values = reg.buffer;
+        switch (instruction.opType) {
+        case FusedOpType::ADD: {
+            executeArithmeticOnType<Add>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::SUBTRACT: {
+            executeArithmeticOnType<Subtract>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::MULTIPLY: {
+            executeArithmeticOnType<Multiply>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::EQUALS: {
+            executeComparisonOnType<Equals>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::NOT_EQUALS: {
+            executeComparisonOnType<NotEquals>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::GREATER_THAN: {
+            executeComparisonOnType<GreaterThan>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::GREATER_THAN_EQUALS: {
+            executeComparisonOnType<GreaterThanEquals>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::LESS_THAN: {
+            executeComparisonOnType<LessThan>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::LESS_THAN_EQUALS: {
+            executeComparisonOnType<LessThanEquals>(typeID, left.values,
+                registers[instruction.rightIdx].values, reg.buffer, tileSize);
+        } break;
+        case FusedOpType::AND: {
+            // False if either side is a non-null false, otherwise null if either side is null.
+            auto& right = registers[instruction.rightIdx];
+            auto falseBits = (~getTrueBits(left.values, tileSize) & ~left.nulls) |
+                             (~getTrueBits(right.values, tileSize) & ~right.nulls);
+            reg.nulls = (left.nulls | right.nulls) & ~falseBits;
+            setBooleans(~falseBits, reg.buffer, tileSize);
+            continue;
+        }
+        case FusedOpType::OR: {
+            // True if either side is a non-null true, otherwise null if either side is null.
+            auto& right = registers[instruction.rightIdx];
+            auto trueBits = (getTrueBits(left.values, tileSize) & ~left.nulls) |
+                            (getTrueBits(right.values, tileSize) & ~right.nulls);
+            reg.nulls = (left.nulls | right.nulls) & ~trueBits;
+            setBooleans(trueBits, reg.buffer, tileSize);
+            continue;
+        }
+        case FusedOpType::NOT: {
+            reg.nulls = left.nulls;
+            setBooleans(~getTrueBits(left.values, tileSize), reg.buffer, tileSize);
+            continue;
+        }
+        default:
+            assert(false);
+        }
+        // Arithmetic and comparisons are null if either operand is null.
+        reg.nulls = left.nulls | registers[instruction.rightIdx].nulls;
+    }
+}
+
+} // namespace evaluator
+} // namespace kuzu
@@ -17,7 +17,8 @@ bool LiteralExpressionEvaluator::select(SelectionVector& selVector) {
 
 void LiteralExpressionEvaluator::resolveResultVector(
     const processor::ResultSet& resultSet, MemoryManager* memoryManager) {
-    resultVector = std::make_shared<ValueVector>(value->getDataType(), memoryManager);
+    resultVector = std::make_shared<ValueVector>(
+        value->getDataType(), memoryManager, resultSet.vectorArena);
     resultVector->addValue(0, *value);
     resultVector->state = DataChunkState::getSingleValueDataChunkState();
 }
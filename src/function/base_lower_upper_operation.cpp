@@ -6,6 +6,14 @@ namespace kuzu {
 namespace function {
 namespace operation {
 
+bool BaseLowerUpperOperation::isASCII(const char* input, uint32_t len) {
+    uint8_t orOfAllBytes = 0;
+    for (auto i = 0u; i < len; i++) {
+        orOfAllBytes |= (uint8_t)input[i];
+    }
+    return !(orOfAllBytes & 0x80);
+}
+
 uint32_t BaseLowerUpperOperation::getResultLen(char* inputStr, uint32_t inputLen, bool isUpper) {
     uint32_t outputLength = 0;
     for (uint32_t i = 0; i < inputLen;) {
@@ -47,6 +55,20 @@ void BaseLowerUpperOperation::convertCase(char* result, uint32_t len, char* inpu
     }
 }
 
+void BaseLowerUpperOperation::convertCaseASCII(
+    char* result, uint32_t len, const char* input, bool toUpper) {
+    // Branch-free per character so that the loops can be vectorized.
+    if (toUpper) {
+        for (auto i = 0u; i < len; i++) {
+            result[i] = input[i] - ((input[i] >= 'a' && input[i] <= 'z') << 5);
+        }
+    } else {
+        for (auto i = 0u; i < len; i++) {
+            result[i] = input[i] + ((input[i] >= 'A' && input[i] <= 'Z') << 5);
+        }
+    }
+}
+
 } // namespace operation
 } // namespace function
 } // namespace kuzu
@@ -0,0 +1,43 @@
+#include "function/string/operations/reg_expr_operation.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace function {
+namespace operation {
+
+RE2& RE2PatternCache::getOrCompile(const ku_string_t& pattern) {
+    auto patternStr = std::string_view(reinterpret_cast<const char*>(pattern.getData()), pattern.len);
+    if (lastCompiledPattern != nullptr && lastPattern == patternStr) {
+        return *lastCompiledPattern;
+    }
+    auto iter = compiledPatterns.find(patternStr);
+    if (iter == compiledPatterns.end()) {
+        if (compiledPatterns.size() >= MAX_NUM_CACHED_PATTERNS) {
+            compiledPatterns.clear();
+        }
+        iter = compiledPatterns
+                   .emplace(std::string(patternStr),
+                       std::make_unique<RE2>(unescapePattern(patternStr), RE2::Quiet))
+                   .first;
+    }
+    lastPattern = iter->first;
+    lastCompiledPattern = iter->second.get();
+    return *lastCompiledPattern;
+}
+
+std::string RE2PatternCache::unescapePattern(std::string_view pattern) {
+    std::string result;
+    result.reserve(pattern.size());
+    for (auto i = 0u; i < pattern.size(); ++i) {
+        result += pattern[i];
+        if (pattern[i] == '\\' && i + 1 < pattern.size() && pattern[i + 1] == '\\') {
+            i++;
+        }
+    }
+    return result;
+}
+
+} // namespace operation
+} // namespace function
+} // namespace kuzu
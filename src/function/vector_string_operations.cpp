@@ -7,7 +7,6 @@
 #include "function/string/operations/left_operation.h"
 #include "function/string/operations/length_operation.h"
 #include "function/string/operations/lpad_operation.h"
-#include "function/string/operations/reg_expr_operation.h"
 #include "function/string/operations/repeat_operation.h"
 #include "function/string/operations/right_operation.h"
 #include "function/string/operations/rpad_operation.h"
@@ -61,13 +60,131 @@ std::vector<std::unique_ptr<VectorOperationDefinition>> EndsWithVectorOperation:
 std::vector<std::unique_ptr<VectorOperationDefinition>> REMatchVectorOperation::getDefinitions() {
     std::vector<std::unique_ptr<VectorOperationDefinition>> definitions;
     definitions.emplace_back(make_unique<VectorOperationDefinition>(RE_MATCH_FUNC_NAME,
-        std::vector<DataTypeID>{STRING, STRING}, BOOL,
-        BinaryExecFunction<ku_string_t, ku_string_t, uint8_t, operation::REMatch>,
-        BinarySelectFunction<ku_string_t, ku_string_t, operation::REMatch>,
+        std::vector<DataTypeID>{STRING, STRING}, BOOL, ExecFunction{}, SelectFunction{},
         false /* isVarLength */));
     return definitions;
 }
 
+void REMatchVectorOperation::ExecFunction::operator()(
+    const std::vector<std::shared_ptr<ValueVector>>& params, ValueVector& result) {
+    assert(params.size() == 2);
+    auto& left = *params[0];
+    auto& right = *params[1];
+    auto leftValues = (ku_string_t*)left.getData();
+    auto rightValues = (ku_string_t*)right.getData();
+    auto resultValues = result.getData();
+    if (right.state->isFlat()) {
+        auto rPos = right.state->selVector->selectedPositions[0];
+        if (right.isNull(rPos)) {
+            result.setAllNull();
+            return;
+        }
+        auto& pattern = patternCache.getOrCompile(rightValues[rPos]);
+        // If left is flat, result shares its state with left.
+        auto& selVector = *left.state->selVector;
+        for (auto i = 0u; i < selVector.selectedSize; ++i) {
+            auto pos = selVector.selectedPositions[i];
+            result.setNull(pos, left.isNull(pos));
+            if (!result.isNull(pos)) {
+                operation::REMatch::operation(leftValues[pos], pattern, resultValues[pos]);
+            }
+        }
+    } else if (left.state->isFlat()) {
+        auto lPos = left.state->selVector->selectedPositions[0];
+        if (left.isNull(lPos)) {
+            result.setAllNull();
+            return;
+        }
+        auto& selVector = *right.state->selVector;
+        for (auto i = 0u; i < selVector.selectedSize; ++i) {
+            auto pos = selVector.selectedPositions[i];
+            result.setNull(pos, right.isNull(pos));
+            if (!result.isNull(pos)) {
+                operation::REMatch::operation(leftValues[lPos],
+                    patternCache.getOrCompile(rightValues[pos]), resultValues[pos]);
+            }
+        }
+    } else {
+        assert(left.state == right.state);
+        auto& selVector = *left.state->selVector;
+        for (auto i = 0u; i < selVector.selectedSize; ++i) {
+            auto pos = selVector.selectedPositions[i];
+            result.setNull(pos, left.isNull(pos) || right.isNull(pos));
+            if (!result.isNull(pos)) {
+                operation::REMatch::operation(leftValues[pos],
+                    patternCache.getOrCompile(rightValues[pos]), resultValues[pos]);
+            }
+        }
+    }
+}
+
+bool REMatchVectorOperation::SelectFunction::operator()(
+    const std::vector<std::shared_ptr<ValueVector>>& params, SelectionVector& selVector) {
+    assert(params.size() == 2);
+    auto& left = *params[0];
+    auto& right = *params[1];
+    auto leftValues = (ku_string_t*)left.getData();
+    auto rightValues = (ku_string_t*)right.getData();
+    uint8_t resultValue = 0;
+    if (left.state->isFlat() && right.state->isFlat()) {
+        auto lPos = left.state->selVector->selectedPositions[0];
+        auto rPos = right.state->selVector->selectedPositions[0];
+        if (!left.isNull(lPos) && !right.isNull(rPos)) {
+            operation::REMatch::operation(
+                leftValues[lPos], patternCache.getOrCompile(rightValues[rPos]), resultValue);
+        }
+        return resultValue == true;
+    }
+    uint64_t numSelectedValues = 0;
+    auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
+    if (right.state->isFlat()) {
+        auto rPos = right.state->selVector->selectedPositions[0];
+        if (right.isNull(rPos)) {
+            selVector.selectedSize = 0;
+            return false;
+        }
+        auto& pattern = patternCache.getOrCompile(rightValues[rPos]);
+        auto& inputSelVector = *left.state->selVector;
+        for (auto i = 0u; i < inputSelVector.selectedSize; ++i) {
+            auto pos = inputSelVector.selectedPositions[i];
+            if (!left.isNull(pos)) {
+                operation::REMatch::operation(leftValues[pos], pattern, resultValue);
+                selectedPositionsBuffer[numSelectedValues] = pos;
+                numSelectedValues += (resultValue == true);
+            }
+        }
+    } else if (left.state->isFlat()) {
+        auto lPos = left.state->selVector->selectedPositions[0];
+        if (left.isNull(lPos)) {
+            selVector.selectedSize = 0;
+            return false;
+        }
+        auto& inputSelVector = *right.state->selVector;
+        for (auto i = 0u; i < inputSelVector.selectedSize; ++i) {
+            auto pos = inputSelVector.selectedPositions[i];
+            if (!right.isNull(pos)) {
+                operation::REMatch::operation(
+                    leftValues[lPos], patternCache.getOrCompile(rightValues[pos]), resultValue);
+                selectedPositionsBuffer[numSelectedValues] = pos;
+                numSelectedValues += (resultValue == true);
+            }
+        }
+    } else {
+        auto& inputSelVector = *left.state->selVector;
+        for (auto i = 0u; i < inputSelVector.selectedSize; ++i) {
+            auto pos = inputSelVector.selectedPositions[i];
+            if (!left.isNull(pos) && !right.isNull(pos)) {
+                operation::REMatch::operation(
+                    leftValues[pos], patternCache.getOrCompile(rightValues[pos]), resultValue);
+                selectedPositionsBuffer[numSelectedValues] = pos;
+                numSelectedValues += (resultValue == true);
+            }
+        }
+    }
+    selVector.selectedSize = numSelectedValues;
+    return numSelectedValues > 0;
+}
+
 std::vector<std::unique_ptr<VectorOperationDefinition>> LeftVectorOperation::getDefinitions() {
     std::vector<std::unique_ptr<VectorOperationDefinition>> definitions;
     definitions.emplace_back(make_unique<VectorOperationDefinition>(LEFT_FUNC_NAME,
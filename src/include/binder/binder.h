@@ -46,6 +46,7 @@ private:
     std::unique_ptr<BoundStatement> bindAddProperty(const parser::Statement& statement);
     std::unique_ptr<BoundStatement> bindDropProperty(const parser::Statement& statement);
     std::unique_ptr<BoundStatement> bindRenameProperty(const parser::Statement& statement);
+    std::unique_ptr<BoundStatement> bindCreateIndex(const parser::Statement& statement);
 
     std::vector<catalog::PropertyNameDataType> bindPropertyNameDataTypes(
         std::vector<std::pair<std::string, std::string>> propertyNameDataTypes);
@@ -29,6 +29,9 @@ protected:
 
     std::string toString() const override = 0;
 
+public:
+    inline std::string getFunctionName() const { return functionName; }
+
 protected:
     std::string functionName;
 };
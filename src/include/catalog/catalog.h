@@ -201,6 +201,8 @@ public:
 
     void dropProperty(common::table_id_t tableID, common::property_id_t propertyID);
 
+    void addPropertyIndex(common::table_id_t tableID, common::property_id_t propertyID);
+
     void renameProperty(
         common::table_id_t tableID, common::property_id_t propertyID, std::string newName);
 
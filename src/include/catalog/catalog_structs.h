@@ -119,6 +119,12 @@ struct NodeTableSchema : TableSchema {
 
     inline void addFwdRelTableID(common::table_id_t tableID) { fwdRelTableIDSet.insert(tableID); }
     inline void addBwdRelTableID(common::table_id_t tableID) { bwdRelTableIDSet.insert(tableID); }
+    inline void addIndexedPropertyID(common::property_id_t propertyID) {
+        indexedPropertyIDSet.insert(propertyID);
+    }
+    inline bool isPropertyIndexed(common::property_id_t propertyID) const {
+        return indexedPropertyIDSet.contains(propertyID);
+    }
 
     inline Property getPrimaryKey() const { return properties[primaryKeyPropertyID]; }
 
@@ -131,6 +137,8 @@ struct NodeTableSchema : TableSchema {
     common::property_id_t primaryKeyPropertyID;
     std::unordered_set<common::table_id_t> fwdRelTableIDSet; // srcNode->rel
     std::unordered_set<common::table_id_t> bwdRelTableIDSet; // dstNode->rel
+    // Properties with a property index, see CREATE INDEX.
+    std::unordered_set<common::property_id_t> indexedPropertyIDSet;
 };
 
 struct RelTableSchema : TableSchema {
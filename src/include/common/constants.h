@@ -16,6 +16,9 @@ constexpr uint32_t VAR_LENGTH_EXTEND_MAX_DEPTH = 30;
 // This is the default thread sleep time we use when a thread,
 // e.g., a worker thread is in TaskScheduler, needs to block.
 constexpr uint64_t THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS = 500;
+// A worker that has worked on a task for this long switches, at the next morsel, to a waiting
+// task that received less worker time (see TaskScheduler).
+constexpr uint64_t THREAD_TIME_SLICE_IN_MICROS = 1000;
 
 constexpr uint64_t DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS = 5000000;
 
@@ -51,6 +54,8 @@ struct StorageConstants {
     static constexpr char LISTS_FILE_SUFFIX[] = ".lists";
     static constexpr char WAL_FILE_SUFFIX[] = ".wal";
     static constexpr char INDEX_FILE_SUFFIX[] = ".hindex";
+    static constexpr char PROPERTY_INDEX_FILE_SUFFIX[] = ".pindex";
+    static constexpr char SPILL_FILE_SUFFIX[] = ".spill";
     static constexpr char NODES_STATISTICS_AND_DELETED_IDS_FILE_NAME[] =
         "nodes.statistics_and_deleted.ids";
     static constexpr char NODES_STATISTICS_FILE_NAME_FOR_WAL[] =
@@ -79,7 +84,7 @@ struct ListsMetadataConstants {
 
 // Hash Index Configurations
 struct HashIndexConstants {
-    static constexpr uint8_t SLOT_CAPACITY_LOG_2 = 2;
+    static constexpr uint8_t SLOT_CAPACITY_LOG_2 = 3;
     static constexpr uint8_t SLOT_CAPACITY = (uint64_t)1 << SLOT_CAPACITY_LOG_2;
 };
 
@@ -93,6 +98,10 @@ struct CopyConstants {
     // Lower bound for number of incomplete tasks in copier to trigger scheduling a new batch.
     static constexpr uint64_t MINIMUM_NUM_COPIER_TASKS_TO_SCHEDULE_MORE = 50;
 
+    // Fraction of the buffer pool size that the rels buffered by a rel copier can keep in memory
+    // until lists are populated. Rels beyond it are spilled to a temporary file.
+    static constexpr double RELS_BLOCKS_BUFFER_POOL_RATIO = 0.5;
+
     // Default configuration for csv file parsing
     static constexpr const char* STRING_CSV_PARSING_OPTIONS[5] = {
         "ESCAPE", "DELIM", "QUOTE", "LIST_BEGIN", "LIST_END"};
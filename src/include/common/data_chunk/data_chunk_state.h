@@ -12,8 +12,9 @@ class DataChunkState {
 
 public:
     DataChunkState() : DataChunkState(DEFAULT_VECTOR_CAPACITY) {}
-    explicit DataChunkState(uint64_t capacity) : currIdx{-1}, originalSize{0} {
-        selVector = std::make_shared<SelectionVector>(capacity);
+    explicit DataChunkState(uint64_t capacity, VectorArena* arena = nullptr)
+        : currIdx{-1}, originalSize{0} {
+        selVector = std::make_shared<SelectionVector>(capacity, arena);
     }
 
     // returns a dataChunkState for vectors holding a single value.
@@ -4,14 +4,22 @@
 
 #include "common/constants.h"
 #include "common/types/types.h"
+#include "common/vector/vector_arena.h"
 
 namespace kuzu {
 namespace common {
 
 class SelectionVector {
 public:
-    explicit SelectionVector(sel_t capacity) : selectedSize{0} {
-        selectedPositionsBuffer = std::make_unique<sel_t[]>(capacity);
+    // If an arena is given, the selected positions buffer is allocated from it, and the arena must
+    // outlive the selection vector.
+    explicit SelectionVector(sel_t capacity, VectorArena* arena = nullptr) : selectedSize{0} {
+        if (arena != nullptr) {
+            selectedPositionsBuffer = (sel_t*)arena->allocate(capacity * sizeof(sel_t));
+        } else {
+            ownedSelectedPositionsBuffer = std::make_unique<sel_t[]>(capacity);
+            selectedPositionsBuffer = ownedSelectedPositionsBuffer.get();
+        }
         resetSelectorToUnselected();
     }
 
@@ -26,13 +34,13 @@ public:
         selectedSize = size;
     }
     inline void resetSelectorToValuePosBuffer() {
-        selectedPositions = selectedPositionsBuffer.get();
+        selectedPositions = selectedPositionsBuffer;
     }
     inline void resetSelectorToValuePosBufferWithSize(sel_t size) {
-        selectedPositions = selectedPositionsBuffer.get();
+        selectedPositions = selectedPositionsBuffer;
         selectedSize = size;
     }
-    inline sel_t* getSelectedPositionsBuffer() { return selectedPositionsBuffer.get(); }
+    inline sel_t* getSelectedPositionsBuffer() { return selectedPositionsBuffer; }
 
     static const sel_t INCREMENTAL_SELECTED_POS[DEFAULT_VECTOR_CAPACITY];
 
@@ -41,7 +49,9 @@ public:
     sel_t selectedSize;
 
 private:
-    std::unique_ptr<sel_t[]> selectedPositionsBuffer;
+    sel_t* selectedPositionsBuffer;
+    // Null if the selected positions buffer is allocated from an arena.
+    std::unique_ptr<sel_t[]> ownedSelectedPositionsBuffer;
 };
 
 } // namespace common
@@ -86,6 +86,11 @@ public:
     explicit ConnectionException(const std::string& msg) : Exception(msg){};
 };
 
+class InterruptException : public Exception {
+public:
+    explicit InterruptException(const std::string& msg) : Exception("Interrupted: " + msg){};
+};
+
 class TransactionManagerException : public Exception {
 public:
     explicit TransactionManagerException(const std::string& msg) : Exception(msg){};
@@ -21,6 +21,8 @@ public:
     bool enabled;
 };
 
+// Measures time in ticks of TickCounter, so that timing short calls (e.g. getNextTuple on a single
+// flat tuple) is cheap and is not truncated to the clock resolution per call.
 class TimeMetric : public Metric {
 
 public:
@@ -28,13 +30,15 @@ public:
 
     void start();
     void stop();
+    // Adds time measured outside of start() and stop().
+    void increase(uint64_t ticks);
 
     double getElapsedTimeMS() const;
 
 public:
-    double accumulatedTime;
+    uint64_t accumulatedTicks;
+    uint64_t startTicks;
     bool isStarted;
-    Timer timer;
 };
 
 class NumericMetric : public Metric {
@@ -50,5 +54,49 @@ public:
     uint64_t accumulatedValue;
 };
 
+// Counters of storage and memory activity of a single thread. They are incremented unconditionally
+// (a thread-local add is cheap) by the components doing the work, and attributed to operators by
+// ResourceMetric.
+struct ResourceCounters {
+    // Pins of pages of database files through the buffer pool. Blocks of the MemoryManager are
+    // counted in numMemoryBlocksAllocated instead.
+    uint64_t numPagePins = 0;
+    uint64_t numPageCacheMisses = 0;
+    // Pages of read-only mapped files, which are accessed without pinning or buffer pool I/O.
+    uint64_t numMappedPageAccesses = 0;
+    uint64_t numBytesReadFromDisk = 0;
+    uint64_t numMemoryBlocksAllocated = 0;
+    uint64_t numHashChainEntriesVisited = 0;
+
+    void add(const ResourceCounters& other);
+    void subtract(const ResourceCounters& other);
+
+    static inline ResourceCounters& getThreadLocalCounters() {
+        thread_local ResourceCounters counters;
+        return counters;
+    }
+};
+
+// Accumulates increments of the thread-local ResourceCounters between start() and stop().
+class ResourceMetric : public Metric {
+
+public:
+    explicit ResourceMetric(bool enable) : Metric(enable) {}
+
+    inline void start() {
+        if (!enabled) {
+            return;
+        }
+        countersAtStart = ResourceCounters::getThreadLocalCounters();
+    }
+    void stop();
+
+public:
+    ResourceCounters accumulatedCounters;
+
+private:
+    ResourceCounters countersAtStart;
+};
+
 } // namespace common
 } // namespace kuzu
@@ -84,6 +84,12 @@ public:
         std::fill(data, data + numNullEntries, NO_NULL_ENTRY);
     }
 
+    // Null mask over an externally owned buffer, e.g., one allocated from a VectorArena.
+    NullMask(uint64_t* data, uint64_t numNullEntries)
+        : data{data}, mayContainNulls{false}, numNullEntries{numNullEntries} {
+        std::fill(data, data + numNullEntries, NO_NULL_ENTRY);
+    }
+
     inline void setAllNonNull() {
         std::fill(data, data + numNullEntries, NO_NULL_ENTRY);
         mayContainNulls = false;
@@ -15,10 +15,16 @@ public:
 
     NumericMetric* registerNumericMetric(const std::string& key);
 
+    ResourceMetric* registerResourceMetric(const std::string& key);
+
     double sumAllTimeMetricsWithKey(const std::string& key);
 
+    std::vector<double> getAllTimeMetricsWithKey(const std::string& key);
+
     uint64_t sumAllNumericMetricsWithKey(const std::string& key);
 
+    ResourceCounters sumAllResourceMetricsWithKey(const std::string& key);
+
 private:
     void addMetric(const std::string& key, std::unique_ptr<Metric> metric);
 
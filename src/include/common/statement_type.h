@@ -15,6 +15,7 @@ enum class StatementType : uint8_t {
     ADD_PROPERTY = 6,
     DROP_PROPERTY = 7,
     RENAME_PROPERTY = 8,
+    CREATE_INDEX = 9,
 };
 
 class StatementTypeUtils {
@@ -23,7 +24,8 @@ public:
         return statementType == StatementType::CREATE_NODE_CLAUSE ||
                statementType == StatementType::CREATE_REL_CLAUSE ||
                statementType == StatementType::DROP_TABLE ||
-               statementType == StatementType::DROP_PROPERTY;
+               statementType == StatementType::DROP_PROPERTY ||
+               statementType == StatementType::CREATE_INDEX;
     }
 
     static bool isCopyCSV(StatementType statementType) {
@@ -4,6 +4,8 @@
 #include <mutex>
 #include <vector>
 
+#include "common/timer.h"
+
 namespace kuzu {
 namespace common {
 
@@ -60,10 +62,19 @@ public:
 
     inline void setSingleThreadedTask() { maxNumThreads = 1; }
 
+    inline bool canRegisterThread() {
+        lock_t lck{mtx};
+        return !hasExceptionNoLock() && canRegisterInternalNoLock();
+    }
+
     bool registerThread();
 
     void deRegisterThreadAndFinalizeTaskIfNecessary();
 
+    // Deregisters a worker that left the task before running out of work, so that another worker
+    // can take its place. If the other workers have already finished, the task is completed.
+    void deRegisterYieldingThreadAndFinalizeTaskIfNecessary();
+
     inline void setException(std::exception_ptr exceptionPtr) {
         lock_t lck{mtx};
         if (this->exceptionsPtr == nullptr) {
@@ -81,6 +92,12 @@ public:
         return exceptionsPtr;
     }
 
+    inline void setScheduled() { scheduledTicks = TickCounter::now(); }
+    // Time between being scheduled and being picked up by the first worker thread.
+    inline uint64_t getWaitTicks() const { return startTicks - scheduledTicks; }
+    // Time between being picked up by the first worker thread and the last worker finishing.
+    inline uint64_t getWallTicks() const { return completedTicks - startTicks; }
+
 private:
     bool canRegisterInternalNoLock() const {
         return 0 == numThreadsFinished && maxNumThreads > numThreadsRegistered;
@@ -98,6 +115,8 @@ protected:
     uint64_t maxNumThreads, numThreadsFinished{0}, numThreadsRegistered{0};
     std::exception_ptr exceptionsPtr = nullptr;
     uint64_t ID;
+    // In ticks of TickCounter.
+    uint64_t scheduledTicks = 0, startTicks = 0, completedTicks = 0;
 };
 
 } // namespace common
@@ -2,8 +2,10 @@
 
 #include <atomic>
 #include <deque>
+#include <functional>
 #include <thread>
 
+#include "common/constants.h"
 #include "common/task_system/task.h"
 #include "common/utils.h"
 
@@ -14,6 +16,10 @@ struct ScheduledTask {
     ScheduledTask(std::shared_ptr<Task> task, uint64_t ID) : task{std::move(task)}, ID{ID} {};
     std::shared_ptr<Task> task;
     uint64_t ID;
+    // Guarded by the lock of the scheduler.
+    uint64_t numActiveWorkers = 0;
+    // Total time workers have spent on the task, in the time unit of the scheduler clock.
+    uint64_t workerTime = 0;
 };
 
 /**
@@ -40,14 +46,23 @@ struct ScheduledTask {
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * Tasks from concurrent queries share the workers fairly. A free worker registers itself to the
+ * task with the fewest active workers, and among those to the one that received the least worker
+ * time, in FIFO order on ties. A worker also switches tasks at morsel boundaries: once it has worked
+ * on its task for a time slice, the task asks the worker at its next morsel whether to yield (see
+ * shouldYield). The worker yields if a task with fewer active workers received less worker time;
+ * the task then returns from run() without finishing, and the worker registers again as a free
+ * worker. A yielded task stays in the queue and accepts workers again. This keeps short queries,
+ * e.g., point lookups, from waiting behind a large scan, without ever running a task inside another.
+ * The completion order of tasks is not guaranteed: a long running task that is not accepting more
+ * registration can stay in the queue for an unlimited time until completion.
  */
 class TaskScheduler {
 public:
-    explicit TaskScheduler(uint64_t numThreads);
+    // The clock returns the current time in microseconds, and can be replaced by tests.
+    explicit TaskScheduler(uint64_t numThreads,
+        uint64_t timeSliceInMicros = THREAD_TIME_SLICE_IN_MICROS,
+        std::function<uint64_t()> clock = getSteadyClockTimeInMicros);
     ~TaskScheduler();
 
     // Functions for the users of the task scheduler, e.g., processor to use.
@@ -85,6 +100,13 @@ public:
     bool isTaskQueueEmpty() { return taskQueue.empty(); }
     uint64_t getNumTasks() { return taskQueue.size(); }
 
+    // Called by tasks between morsels. Returns true if the calling worker should leave its task, in
+    // which case the task must return from run() before starting another morsel. A task left this
+    // way is not finished: its remaining morsels are processed by workers that register later.
+    static inline bool shouldYield() {
+        return workerState.scheduler != nullptr && workerState.scheduler->shouldYieldCurrentTask();
+    }
+
 private:
     void removeErroringTask(uint64_t scheduledTaskID);
 
@@ -93,6 +115,16 @@ private:
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
     void runWorkerThread();
     std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    void runTask(ScheduledTask& scheduledTask);
+    bool shouldYieldCurrentTask();
+
+    static inline bool hasPriorityOver(const ScheduledTask& task, const ScheduledTask& other) {
+        return task.numActiveWorkers != other.numActiveWorkers ?
+                   task.numActiveWorkers < other.numActiveWorkers :
+                   task.workerTime < other.workerTime;
+    }
+
+    static uint64_t getSteadyClockTimeInMicros();
 
 private:
     std::shared_ptr<spdlog::logger> logger;
@@ -101,6 +133,18 @@ private:
     std::atomic<bool> stopThreads{false};
     std::vector<std::thread> threads;
     uint64_t nextScheduledTaskID;
+    uint64_t timeSliceInMicros;
+    std::function<uint64_t()> clock;
+
+    struct WorkerState {
+        // Scheduler of the worker thread, nullptr if the thread is not a worker.
+        TaskScheduler* scheduler = nullptr;
+        ScheduledTask* task = nullptr;
+        // Start of the time slice on the current task.
+        uint64_t sliceStartTime = 0;
+        bool hasYielded = false;
+    };
+    static thread_local WorkerState workerState;
 };
 
 } // namespace common
@@ -7,6 +7,10 @@
 
 #include "exception.h"
 
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
 namespace kuzu {
 namespace common {
 
@@ -37,5 +41,46 @@ private:
     bool finished = false;
 };
 
+// Monotonic tick counter for fine-grained profiling. On x86-64 it reads the time stamp counter,
+// which costs a few cycles instead of the tens of nanoseconds of a clock call. Ticks are converted
+// to time with a rate that is calibrated against steady_clock once per process.
+class TickCounter {
+
+public:
+    static inline uint64_t now() {
+#if defined(__x86_64__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    static inline double getTicksPerMicrosecond() {
+        static const double ticksPerMicrosecond = calibrate();
+        return ticksPerMicrosecond;
+    }
+
+private:
+    static double calibrate() {
+#if defined(__x86_64__)
+        auto startTime = std::chrono::steady_clock::now();
+        auto startTicks = now();
+        auto endTime = startTime;
+        while (endTime - startTime < std::chrono::milliseconds(1)) {
+            endTime = std::chrono::steady_clock::now();
+        }
+        auto endTicks = now();
+        return (double)(endTicks - startTicks) /
+               (double)std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime)
+                   .count() *
+               1000;
+#else
+        return 1000;
+#endif
+    }
+};
+
 } // namespace common
 } // namespace kuzu
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <string>
 
 namespace kuzu {
@@ -34,8 +35,28 @@ struct ku_string_t {
 
     std::string getAsShortString() const;
     std::string getAsString() const;
+    // Unlike getAsString(), this does not copy. The view is valid as long as the string is.
+    inline std::string_view getAsStringView() const {
+        return std::string_view(reinterpret_cast<const char*>(getData()), len);
+    }
 
-    bool operator==(const ku_string_t& rhs) const;
+    // Length and prefix tell most unequal strings apart without touching the overflow buffer.
+    inline bool operator==(const ku_string_t& rhs) const {
+        if (len != rhs.len) {
+            return false;
+        }
+        if (len < PREFIX_LENGTH) {
+            return memcmp(prefix, rhs.prefix, len) == 0;
+        }
+        uint32_t lPrefix, rPrefix;
+        memcpy(&lPrefix, prefix, PREFIX_LENGTH);
+        memcpy(&rPrefix, rhs.prefix, PREFIX_LENGTH);
+        if (lPrefix != rPrefix) {
+            return false;
+        }
+        return memcmp(getData() + PREFIX_LENGTH, rhs.getData() + PREFIX_LENGTH,
+                   len - PREFIX_LENGTH) == 0;
+    }
 
     inline bool operator!=(const ku_string_t& rhs) const { return !(*this == rhs); }
 
@@ -6,6 +6,7 @@
 #include "common/in_mem_overflow_buffer.h"
 #include "common/null_mask.h"
 #include "common/types/value.h"
+#include "common/vector/vector_arena.h"
 
 namespace kuzu {
 namespace common {
@@ -15,7 +16,10 @@ namespace common {
 class ValueVector {
 
 public:
-    explicit ValueVector(DataType dataType, storage::MemoryManager* memoryManager = nullptr);
+    // If an arena is given, the value buffer and the null mask are allocated from it, and the arena
+    // must outlive the vector.
+    explicit ValueVector(DataType dataType, storage::MemoryManager* memoryManager = nullptr,
+        VectorArena* arena = nullptr);
     explicit ValueVector(DataTypeID dataTypeID, storage::MemoryManager* memoryManager = nullptr)
         : ValueVector(DataType(dataTypeID), memoryManager) {
         assert(dataTypeID != VAR_LIST);
@@ -44,14 +48,14 @@ public:
 
     template<typename T>
     inline T getValue(uint32_t pos) const {
-        return ((T*)valueBuffer.get())[pos];
+        return ((T*)valueBuffer)[pos];
     }
     template<typename T>
     void setValue(uint32_t pos, T val);
 
     void addValue(uint32_t pos, const Value& value);
 
-    inline uint8_t* getData() const { return valueBuffer.get(); }
+    inline uint8_t* getData() const { return valueBuffer; }
 
     inline offset_t readNodeOffset(uint32_t pos) const {
         assert(dataType.typeID == INTERNAL_ID);
@@ -84,7 +88,9 @@ public:
 private:
     bool _isSequential = false;
     std::unique_ptr<InMemOverflowBuffer> inMemOverflowBuffer;
-    std::unique_ptr<uint8_t[]> valueBuffer;
+    uint8_t* valueBuffer;
+    // Null if the value buffer is allocated from an arena.
+    std::unique_ptr<uint8_t[]> ownedValueBuffer;
     std::unique_ptr<NullMask> nullMask;
     uint32_t numBytesPerValue;
 };
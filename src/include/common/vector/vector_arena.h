@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace kuzu {
+namespace common {
+
+// Bump allocator for the value buffers, null masks and selection vectors of the vectors of one
+// pipeline clone. These buffers live exactly as long as the clone, so they are never freed one by
+// one: the whole arena is released when the clone finishes. Released chunks are cached by the
+// releasing thread and reused by the next pipeline it runs, so short queries do not go through the
+// heap to set up their vectors.
+class VectorArena {
+public:
+    VectorArena() : currentChunkOffset{CHUNK_SIZE} {}
+    ~VectorArena();
+
+    VectorArena(const VectorArena&) = delete;
+    VectorArena& operator=(const VectorArena&) = delete;
+
+    // Returns 8-byte aligned memory, which is not zeroed.
+    uint8_t* allocate(uint64_t numBytes);
+
+private:
+    static constexpr uint64_t CHUNK_SIZE = 1 << 18;
+    static constexpr uint64_t MAX_NUM_CACHED_CHUNKS_PER_THREAD = 16;
+
+    std::vector<std::unique_ptr<uint8_t[]>> chunks;
+    // Allocations larger than a chunk get a buffer of their own, which is not cached.
+    std::vector<std::unique_ptr<uint8_t[]>> largeBuffers;
+    uint64_t currentChunkOffset;
+};
+
+} // namespace common
+} // namespace kuzu
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "base_evaluator.h"
+
+namespace kuzu {
+namespace evaluator {
+
+enum class FusedOpType : uint8_t {
+    LEAF,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    EQUALS,
+    NOT_EQUALS,
+    GREATER_THAN,
+    GREATER_THAN_EQUALS,
+    LESS_THAN,
+    LESS_THAN_EQUALS,
+    AND,
+    OR,
+    NOT,
+};
+
+// An instruction writes the values and nulls of one expression node for a tile of positions into
+// the register with the same index as the instruction. Operands refer to registers of earlier
+// instructions. A LEAF instruction loads the tile of its leaf evaluator.
+struct FusedInstruction {
+    FusedOpType opType;
+    // INT64, DOUBLE or BOOL. For comparisons, this is the type of the operands.
+    common::DataTypeID operandTypeID;
+    uint32_t leftIdx;
+    uint32_t rightIdx;
+};
+
+// Post-order instructions of a fused expression tree. The last instruction computes the root.
+struct FusedProgram {
+    std::vector<FusedInstruction> instructions;
+    common::DataType resultType;
+};
+
+/**
+ * Evaluates a tree of arithmetic (+, -, *), comparison and boolean (AND, OR, NOT) expressions over
+ * INT64, DOUBLE and BOOL in one pass over its inputs. Instead of materializing a full vector for
+ * every node, as FunctionExpressionEvaluator does, all nodes are evaluated on a tile of 64
+ * positions, one null entry, before moving to the next tile, so intermediate values stay in L1.
+ * Leaves reading an unfiltered vector are not even copied. Nulls are handled per tile with bit
+ * operations. The leaves (reference or literal evaluators) are the children of this evaluator, and
+ * all unflat leaves must share a data chunk. See ExpressionMapper for when expressions are fused.
+ */
+class FusedExpressionEvaluator : public BaseExpressionEvaluator {
+    static constexpr uint64_t TILE_SIZE = common::NullMask::NUM_BITS_PER_NULL_ENTRY;
+
+    struct Register {
+        // Points into the vector of a leaf, or to buffer.
+        const uint8_t* values;
+        uint64_t nulls;
+        alignas(64) uint8_t buffer[TILE_SIZE * sizeof(int64_t)];
+    };
+
+public:
+    FusedExpressionEvaluator(std::shared_ptr<FusedProgram> program,
+        std::vector<std::unique_ptr<BaseExpressionEvaluator>> leaves)
+        : BaseExpressionEvaluator{std::move(leaves)}, program{std::move(program)} {}
+
+    void evaluate() override;
+
+    bool select(common::SelectionVector& selVector) override;
+
+    std::unique_ptr<BaseExpressionEvaluator> clone() override;
+
+protected:
+    void resolveResultVector(
+        const processor::ResultSet& resultSet, storage::MemoryManager* memoryManager) override;
+
+private:
+    // Loads the leaves that are the same for every tile, i.e., flat vectors and literals. Returns
+    // the state of the unflat leaves, or nullptr if every leaf is flat.
+    common::DataChunkState* loadFlatLeaves();
+    void evaluateTile(common::DataChunkState* unflatState, uint64_t tileStart, uint64_t tileSize);
+    static void loadUnflatLeaf(const common::ValueVector& vector, Register& reg,
+        const common::SelectionVector& selVector, uint64_t tileStart, uint64_t tileSize);
+
+private:
+    std::shared_ptr<FusedProgram> program;
+    std::vector<Register> registers;
+};
+
+} // namespace evaluator
+} // namespace kuzu
@@ -50,13 +50,16 @@ struct AvgFunction {
     static void updateSingleValue(
         AvgState* state, common::ValueVector* input, uint32_t pos, uint64_t multiplicity) {
         T val = input->getValue<T>(pos);
-        for (auto i = 0u; i < multiplicity; ++i) {
-            if (state->isNull) {
-                state->sum = val;
-                state->isNull = false;
-            } else {
-                operation::Add::operation(state->sum, val, state->sum);
-            }
+        // See SumFunction::updateSingleValue.
+        if (multiplicity != 1) {
+            auto multiplier = (T)multiplicity;
+            operation::Multiply::operation(val, multiplier, val);
+        }
+        if (state->isNull) {
+            state->sum = val;
+            state->isNull = false;
+        } else {
+            operation::Add::operation(state->sum, val, state->sum);
         }
         state->count += multiplicity;
     }
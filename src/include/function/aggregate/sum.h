@@ -49,13 +49,17 @@ struct SumFunction {
     static void updateSingleValue(
         SumState* state, common::ValueVector* input, uint32_t pos, uint64_t multiplicity) {
         T val = input->getValue<T>(pos);
-        for (auto j = 0u; j < multiplicity; ++j) {
-            if (state->isNull) {
-                state->sum = val;
-                state->isNull = false;
-            } else {
-                operation::Add::operation(state->sum, val, state->sum);
-            }
+        // Multiplicity is the product of factorized group sizes and can be large, so we multiply
+        // instead of adding val multiplicity times.
+        if (multiplicity != 1) {
+            auto multiplier = (T)multiplicity;
+            operation::Multiply::operation(val, multiplier, val);
+        }
+        if (state->isNull) {
+            state->sum = val;
+            state->isNull = false;
+        } else {
+            operation::Add::operation(state->sum, val, state->sum);
         }
     }
 
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <bit>
+
+#include "function/binary_operation_executor.h"
+
+namespace kuzu {
+namespace function {
+
+// DATE and TIMESTAMP are compared on their underlying integers so that comparisons inline and
+// vectorize instead of calling the out-of-line operators of date_t and timestamp_t.
+template<typename T>
+struct ComparisonPhysicalType {
+    using type = T;
+};
+template<>
+struct ComparisonPhysicalType<common::date_t> {
+    using type = int32_t;
+};
+template<>
+struct ComparisonPhysicalType<common::timestamp_t> {
+    using type = int64_t;
+};
+
+/**
+ * Comparison executor for fixed-size types (INT64, INT32, INT16, DOUBLE, FLOAT, DATE, TIMESTAMP).
+ * If unflat inputs are unfiltered, values are compared one null entry (64 positions) at a time in
+ * branch-free loops the compiler vectorizes, and nulls are handled on whole null entries instead of
+ * per position. Comparing fixed-size values cannot fail, so null positions are compared blindly and
+ * masked out afterwards. All other cases fall back to BinaryOperationExecutor.
+ */
+struct ComparisonOperationExecutor {
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename FUNC>
+    static void execute(
+        common::ValueVector& left, common::ValueVector& right, common::ValueVector& result) {
+        if (!canProcessInBlocks(left, right)) {
+            BinaryOperationExecutor::execute<LEFT_TYPE, RIGHT_TYPE, uint8_t, FUNC>(
+                left, right, result);
+            return;
+        }
+        using L = typename ComparisonPhysicalType<LEFT_TYPE>::type;
+        using R = typename ComparisonPhysicalType<RIGHT_TYPE>::type;
+        auto leftValues = (L*)left.getData();
+        auto rightValues = (R*)right.getData();
+        auto resultValues = result.getData();
+        auto numValues = result.state->selVector->selectedSize;
+        if (left.state->isFlat()) {
+            auto leftValue = leftValues[left.state->selVector->selectedPositions[0]];
+            for (auto i = 0u; i < numValues; ++i) {
+                FUNC::operation(leftValue, rightValues[i], resultValues[i]);
+            }
+        } else if (right.state->isFlat()) {
+            auto rightValue = rightValues[right.state->selVector->selectedPositions[0]];
+            for (auto i = 0u; i < numValues; ++i) {
+                FUNC::operation(leftValues[i], rightValue, resultValues[i]);
+            }
+        } else {
+            for (auto i = 0u; i < numValues; ++i) {
+                FUNC::operation(leftValues[i], rightValues[i], resultValues[i]);
+            }
+        }
+        auto leftNullEntries = getUnflatNullEntries(left);
+        auto rightNullEntries = getUnflatNullEntries(right);
+        if (leftNullEntries == nullptr && rightNullEntries == nullptr) {
+            return;
+        }
+        auto resultNullEntries = result.getNullMaskData();
+        auto hasNull = false;
+        auto numNullEntries = (numValues + common::NullMask::NUM_BITS_PER_NULL_ENTRY - 1) >>
+                              common::NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2;
+        for (auto i = 0u; i < numNullEntries; ++i) {
+            resultNullEntries[i] = (leftNullEntries ? leftNullEntries[i] : 0) |
+                                   (rightNullEntries ? rightNullEntries[i] : 0);
+            hasNull |= resultNullEntries[i] != common::NullMask::NO_NULL_ENTRY;
+        }
+        if (hasNull) {
+            result.setMayContainNulls();
+        }
+    }
+
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename FUNC>
+    static bool select(
+        common::ValueVector& left, common::ValueVector& right, common::SelectionVector& selVector) {
+        if (!canProcessInBlocks(left, right)) {
+            return BinaryOperationExecutor::select<LEFT_TYPE, RIGHT_TYPE, FUNC>(
+                left, right, selVector);
+        }
+        using L = typename ComparisonPhysicalType<LEFT_TYPE>::type;
+        using R = typename ComparisonPhysicalType<RIGHT_TYPE>::type;
+        auto leftValues = (L*)left.getData();
+        auto rightValues = (R*)right.getData();
+        auto numValues = left.state->isFlat() ? right.state->selVector->selectedSize :
+                                                left.state->selVector->selectedSize;
+        auto leftNullEntries = getUnflatNullEntries(left);
+        auto rightNullEntries = getUnflatNullEntries(right);
+        auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
+        uint64_t numSelectedValues = 0;
+        uint8_t blockResults[common::NullMask::NUM_BITS_PER_NULL_ENTRY];
+        for (auto blockStart = 0u; blockStart < numValues;
+             blockStart += common::NullMask::NUM_BITS_PER_NULL_ENTRY) {
+            auto blockSize = std::min<uint64_t>(
+                common::NullMask::NUM_BITS_PER_NULL_ENTRY, numValues - blockStart);
+            auto entryPos = blockStart >> common::NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2;
+            auto nonNullBits = common::NULL_LOWER_MASKS[blockSize];
+            if (leftNullEntries != nullptr) {
+                nonNullBits &= ~leftNullEntries[entryPos];
+            }
+            if (rightNullEntries != nullptr) {
+                nonNullBits &= ~rightNullEntries[entryPos];
+            }
+            if (nonNullBits == 0) {
+                continue;
+            }
+            if (left.state->isFlat()) {
+                auto leftValue = leftValues[left.state->selVector->selectedPositions[0]];
+                for (auto i = 0u; i < blockSize; ++i) {
+                    FUNC::operation(leftValue, rightValues[blockStart + i], blockResults[i]);
+                }
+            } else if (right.state->isFlat()) {
+                auto rightValue = rightValues[right.state->selVector->selectedPositions[0]];
+                for (auto i = 0u; i < blockSize; ++i) {
+                    FUNC::operation(leftValues[blockStart + i], rightValue, blockResults[i]);
+                }
+            } else {
+                for (auto i = 0u; i < blockSize; ++i) {
+                    FUNC::operation(
+                        leftValues[blockStart + i], rightValues[blockStart + i], blockResults[i]);
+                }
+            }
+            uint64_t selectedBits = 0;
+            for (auto i = 0u; i < blockSize; ++i) {
+                selectedBits |= (uint64_t)blockResults[i] << i;
+            }
+            selectedBits &= nonNullBits;
+            while (selectedBits != 0) {
+                selectedPositionsBuffer[numSelectedValues++] =
+                    blockStart + std::countr_zero(selectedBits);
+                selectedBits &= selectedBits - 1;
+            }
+        }
+        selVector.selectedSize = numSelectedValues;
+        return numSelectedValues > 0;
+    }
+
+private:
+    // Blocks can be processed if at least one input is unflat, every unflat input is unfiltered,
+    // and a flat input is not null.
+    static inline bool canProcessInBlocks(common::ValueVector& left, common::ValueVector& right) {
+        if (left.state->isFlat() && right.state->isFlat()) {
+            return false;
+        }
+        for (auto vector : {&left, &right}) {
+            if (vector->state->isFlat()) {
+                if (vector->isNull(vector->state->selVector->selectedPositions[0])) {
+                    return false;
+                }
+            } else if (!vector->state->selVector->isUnfiltered()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static inline const uint64_t* getUnflatNullEntries(common::ValueVector& vector) {
+        return vector.state->isFlat() || vector.hasNoNullsGuarantee() ? nullptr :
+                                                                       vector.getNullMaskData();
+    }
+};
+
+} // namespace function
+} // namespace kuzu
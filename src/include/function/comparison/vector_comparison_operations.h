@@ -1,6 +1,7 @@
 #pragma once
 
 #include "binder/expression/expression.h"
+#include "comparison_operation_executor.h"
 #include "comparison_operations.h"
 #include "function/vector_operations.h"
 
@@ -27,6 +28,24 @@ protected:
     }
 
 private:
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename FUNC>
+    static void ComparisonExecFunction(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::ValueVector& result) {
+        assert(params.size() == 2);
+        ComparisonOperationExecutor::execute<LEFT_TYPE, RIGHT_TYPE, FUNC>(
+            *params[0], *params[1], result);
+    }
+
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename FUNC>
+    static bool ComparisonSelectFunction(
+        const std::vector<std::shared_ptr<common::ValueVector>>& params,
+        common::SelectionVector& selVector) {
+        assert(params.size() == 2);
+        return ComparisonOperationExecutor::select<LEFT_TYPE, RIGHT_TYPE, FUNC>(
+            *params[0], *params[1], selVector);
+    }
+
     template<typename FUNC>
     static inline std::unique_ptr<VectorOperationDefinition> getDefinition(
         const std::string& name, common::DataTypeID leftTypeID, common::DataTypeID rightTypeID) {
@@ -42,19 +61,19 @@ private:
         common::DataTypeID leftTypeID, common::DataTypeID rightTypeID) {
         switch (leftTypeID) {
         case common::INT64: {
-            return BinaryExecFunction<int64_t, int64_t, uint8_t, FUNC>;
+            return ComparisonExecFunction<int64_t, int64_t, FUNC>;
         }
         case common::INT32: {
-            return BinaryExecFunction<int32_t, int32_t, uint8_t, FUNC>;
+            return ComparisonExecFunction<int32_t, int32_t, FUNC>;
         }
         case common::INT16: {
-            return BinaryExecFunction<int16_t, int16_t, uint8_t, FUNC>;
+            return ComparisonExecFunction<int16_t, int16_t, FUNC>;
         }
         case common::DOUBLE: {
-            return BinaryExecFunction<double, double, uint8_t, FUNC>;
+            return ComparisonExecFunction<double, double, FUNC>;
         }
         case common::FLOAT: {
-            return BinaryExecFunction<float, float, uint8_t, FUNC>;
+            return ComparisonExecFunction<float, float, FUNC>;
         }
         case common::BOOL: {
             assert(rightTypeID == common::BOOL);
@@ -71,7 +90,7 @@ private:
         case common::DATE: {
             switch (rightTypeID) {
             case common::DATE: {
-                return BinaryExecFunction<common::date_t, common::date_t, uint8_t, FUNC>;
+                return ComparisonExecFunction<common::date_t, common::date_t, FUNC>;
             }
             case common::TIMESTAMP: {
                 return BinaryExecFunction<common::date_t, common::timestamp_t, uint8_t, FUNC>;
@@ -88,7 +107,7 @@ private:
                 return BinaryExecFunction<common::timestamp_t, common::date_t, uint8_t, FUNC>;
             }
             case common::TIMESTAMP: {
-                return BinaryExecFunction<common::timestamp_t, common::timestamp_t, uint8_t, FUNC>;
+                return ComparisonExecFunction<common::timestamp_t, common::timestamp_t, FUNC>;
             }
             default:
                 throw common::RuntimeException(
@@ -112,19 +131,19 @@ private:
         common::DataTypeID leftTypeID, common::DataTypeID rightTypeID) {
         switch (leftTypeID) {
         case common::INT64: {
-            return BinarySelectFunction<int64_t, int64_t, FUNC>;
+            return ComparisonSelectFunction<int64_t, int64_t, FUNC>;
         }
         case common::INT32: {
-            return BinarySelectFunction<int32_t, int32_t, FUNC>;
+            return ComparisonSelectFunction<int32_t, int32_t, FUNC>;
         }
         case common::INT16: {
-            return BinarySelectFunction<int16_t, int16_t, FUNC>;
+            return ComparisonSelectFunction<int16_t, int16_t, FUNC>;
         }
         case common::DOUBLE: {
-            return BinarySelectFunction<double_t, double_t, FUNC>;
+            return ComparisonSelectFunction<double_t, double_t, FUNC>;
         }
         case common::FLOAT: {
-            return BinarySelectFunction<float_t, float_t, FUNC>;
+            return ComparisonSelectFunction<float_t, float_t, FUNC>;
         }
         case common::BOOL: {
             assert(rightTypeID == common::BOOL);
@@ -141,7 +160,7 @@ private:
         case common::DATE: {
             switch (rightTypeID) {
             case common::DATE: {
-                return BinarySelectFunction<common::date_t, common::date_t, FUNC>;
+                return ComparisonSelectFunction<common::date_t, common::date_t, FUNC>;
             }
             case common::TIMESTAMP: {
                 return BinarySelectFunction<common::date_t, common::timestamp_t, FUNC>;
@@ -158,7 +177,7 @@ private:
                 return BinarySelectFunction<common::timestamp_t, common::date_t, FUNC>;
             }
             case common::TIMESTAMP: {
-                return BinarySelectFunction<common::timestamp_t, common::timestamp_t, FUNC>;
+                return ComparisonSelectFunction<common::timestamp_t, common::timestamp_t, FUNC>;
             }
             default:
                 throw common::RuntimeException(
@@ -96,7 +96,7 @@ inline void Hash::operation(const std::string& key, common::hash_t& result) {
 
 template<>
 inline void Hash::operation(const common::ku_string_t& key, common::hash_t& result) {
-    result = std::hash<std::string>()(key.getAsString());
+    result = std::hash<std::string_view>()(key.getAsStringView());
 }
 
 template<>
@@ -15,22 +15,36 @@ struct BaseLowerUpperOperation {
 
     static inline void operation(common::ku_string_t& input, common::ku_string_t& result,
         common::ValueVector& resultValueVector, bool isUpper) {
-        uint32_t resultLen = getResultLen((char*)input.getData(), input.len, isUpper);
+        auto inputStr = (char*)input.getData();
+        // Changing case never changes the length of an ASCII string, so ASCII inputs skip the
+        // utf8proc lookups.
+        auto isInputASCII = isASCII(inputStr, input.len);
+        uint32_t resultLen =
+            isInputASCII ? input.len : getResultLen(inputStr, input.len, isUpper);
         result.len = resultLen;
+        char* buffer;
         if (resultLen <= common::ku_string_t::SHORT_STR_LENGTH) {
-            convertCase((char*)result.prefix, input.len, (char*)input.getData(), isUpper);
+            buffer = (char*)result.prefix;
         } else {
             result.overflowPtr = reinterpret_cast<uint64_t>(
                 resultValueVector.getOverflowBuffer().allocateSpace(result.len));
-            auto buffer = reinterpret_cast<char*>(result.overflowPtr);
-            convertCase(buffer, input.len, (char*)input.getData(), isUpper);
+            buffer = reinterpret_cast<char*>(result.overflowPtr);
+        }
+        if (isInputASCII) {
+            convertCaseASCII(buffer, input.len, inputStr, isUpper);
+        } else {
+            convertCase(buffer, input.len, inputStr, isUpper);
+        }
+        if (resultLen > common::ku_string_t::SHORT_STR_LENGTH) {
             memcpy(result.prefix, buffer, common::ku_string_t::PREFIX_LENGTH);
         }
     }
 
 private:
+    static bool isASCII(const char* input, uint32_t len);
     static uint32_t getResultLen(char* inputStr, uint32_t inputLen, bool isUpper);
     static void convertCase(char* result, uint32_t len, char* input, bool toUpper);
+    static void convertCaseASCII(char* result, uint32_t len, const char* input, bool toUpper);
 };
 
 } // namespace operation
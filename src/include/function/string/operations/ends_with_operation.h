@@ -1,7 +1,8 @@
 #pragma once
 
+#include <cstring>
+
 #include "common/types/ku_string.h"
-#include "function/string/operations/find_operation.h"
 
 namespace kuzu {
 namespace function {
@@ -10,9 +11,11 @@ namespace operation {
 struct EndsWith {
     static inline void operation(
         common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
-        int64_t pos = 0;
-        Find::operation(left, right, pos);
-        result = (pos == left.len - right.len + 1);
+        if (right.len > left.len) {
+            result = false;
+            return;
+        }
+        result = memcmp(left.getData() + left.len - right.len, right.getData(), right.len) == 0;
     }
 };
 
@@ -1,23 +1,45 @@
 #pragma once
 
-#include <regex>
+#include <map>
+#include <memory>
 
 #include "common/types/ku_string.h"
-#include "function/string/operations/find_operation.h"
 #include "re2.h"
 
 namespace kuzu {
 namespace function {
 namespace operation {
 
+// Compiles each distinct pattern only once instead of once per tuple. A cache is owned by a single
+// evaluator and is never shared across threads, so copies start empty.
+class RE2PatternCache {
+public:
+    RE2PatternCache() = default;
+    RE2PatternCache(const RE2PatternCache& /* other */) {}
+    RE2PatternCache& operator=(const RE2PatternCache& /* other */) { return *this; }
+
+    RE2& getOrCompile(const common::ku_string_t& pattern);
+
+private:
+    // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
+    // Since Regular Expression requires only 1 backslash '\.' we need to replace double slash
+    // with single
+    static std::string unescapePattern(std::string_view pattern);
+
+private:
+    // Bounds the memory of a cache fed with a different pattern for every tuple.
+    static constexpr uint64_t MAX_NUM_CACHED_PATTERNS = 1024;
+
+    std::map<std::string, std::unique_ptr<RE2>, std::less<>> compiledPatterns;
+    std::string_view lastPattern;
+    RE2* lastCompiledPattern = nullptr;
+};
+
 struct REMatch {
     static inline void operation(
-        common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
-        // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
-        // Since Regular Expression requires only 1 backslash '\.' we need to replace double slash
-        // with single
-        std::string pattern = std::regex_replace(right.getAsString(), std::regex(R"(\\\\)"), "\\");
-        result = RE2::FullMatch(left.getAsString(), pattern);
+        const common::ku_string_t& left, const RE2& pattern, uint8_t& result) {
+        result = RE2::FullMatch(
+            regex::StringPiece(reinterpret_cast<const char*>(left.getData()), left.len), pattern);
     }
 };
 
@@ -15,20 +15,20 @@ public:
         common::ku_string_t& result, common::ValueVector& resultValueVector) {
         result.len = left.len * right;
         if (result.len <= common::ku_string_t::SHORT_STR_LENGTH) {
-            repeatStr((char*)result.prefix, left.getAsString(), right);
+            repeatStr((char*)result.prefix, left.getAsStringView(), right);
         } else {
             result.overflowPtr = reinterpret_cast<uint64_t>(
                 resultValueVector.getOverflowBuffer().allocateSpace(result.len));
             auto buffer = reinterpret_cast<char*>(result.overflowPtr);
-            repeatStr(buffer, left.getAsString(), right);
+            repeatStr(buffer, left.getAsStringView(), right);
             memcpy(result.prefix, buffer, common::ku_string_t::PREFIX_LENGTH);
         }
     }
 
 private:
-    static void repeatStr(char* data, std::string pattern, uint64_t count) {
+    static void repeatStr(char* data, std::string_view pattern, uint64_t count) {
         for (auto i = 0u; i < count; i++) {
-            memcpy(data + i * pattern.length(), pattern.c_str(), pattern.length());
+            memcpy(data + i * pattern.length(), pattern.data(), pattern.length());
         }
     }
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include "common/types/ku_string.h"
 
 namespace kuzu {
@@ -9,9 +11,19 @@ namespace operation {
 struct StartsWith {
     static inline void operation(
         common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
-        auto lStr = left.getAsString();
-        auto rStr = right.getAsString();
-        result = lStr.starts_with(rStr);
+        if (right.len > left.len) {
+            result = false;
+            return;
+        }
+        // The inlined prefix rejects most strings without touching the overflow buffer.
+        auto numPrefixBytes =
+            std::min<uint32_t>(right.len, common::ku_string_t::PREFIX_LENGTH);
+        if (memcmp(left.prefix, right.prefix, numPrefixBytes) != 0) {
+            result = false;
+            return;
+        }
+        result = memcmp(left.getData() + numPrefixBytes, right.getData() + numPrefixBytes,
+                     right.len - numPrefixBytes) == 0;
     }
 };
 
@@ -14,7 +14,7 @@ struct SubStr {
 public:
     static inline void operation(common::ku_string_t& src, int64_t start, int64_t len,
         common::ku_string_t& result, common::ValueVector& resultValueVector) {
-        std::string srcStr = src.getAsString();
+        auto srcStr = src.getAsStringView();
         bool isAscii = true;
         auto startPos = start - 1;
         auto endPos = std::min(srcStr.size(), (size_t)(startPos + len));
@@ -31,7 +31,7 @@ public:
         } else {
             int64_t characterCount = 0, startBytePos = 0, endBytePos = 0;
             kuzu::utf8proc::utf8proc_grapheme_callback(
-                srcStr.c_str(), srcStr.size(), [&](int64_t gstart, int64_t gend) {
+                srcStr.data(), srcStr.size(), [&](int64_t gstart, int64_t gend) {
                     if (characterCount == startPos) {
                         startBytePos = gstart;
                     } else if (characterCount == endPos) {
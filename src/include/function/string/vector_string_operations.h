@@ -2,6 +2,7 @@
 
 #include "function/string/operations/lower_operation.h"
 #include "function/string/operations/ltrim_operation.h"
+#include "function/string/operations/reg_expr_operation.h"
 #include "function/string/operations/reverse_operation.h"
 #include "function/string/operations/rtrim_operation.h"
 #include "function/string/operations/trim_operation.h"
@@ -69,6 +70,23 @@ struct EndsWithVectorOperation : public VectorStringOperations {
 
 struct REMatchVectorOperation : public VectorStringOperations {
     static std::vector<std::unique_ptr<VectorOperationDefinition>> getDefinitions();
+
+    // Exec and select functions are copied into every FunctionExpressionEvaluator, so each
+    // evaluator compiles its patterns once. A flat (literal or parameter) pattern is looked up once
+    // per batch; an unflat pattern is looked up per tuple.
+    struct ExecFunction {
+        void operator()(const std::vector<std::shared_ptr<common::ValueVector>>& params,
+            common::ValueVector& result);
+
+        operation::RE2PatternCache patternCache;
+    };
+
+    struct SelectFunction {
+        bool operator()(const std::vector<std::shared_ptr<common::ValueVector>>& params,
+            common::SelectionVector& selVector);
+
+        operation::RE2PatternCache patternCache;
+    };
 };
 
 struct LeftVectorOperation : public VectorStringOperations {
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 
 #include "common/api.h"
+#include "common/exception.h"
+#include "common/timer.h"
 
 namespace kuzu {
 namespace main {
@@ -24,8 +27,31 @@ public:
      */
     KUZU_API ~ClientContext() = default;
 
+    // Starts the timeout of the query about to be executed.
+    void startQuery();
+
+    // Operators call this cooperatively between batches of tuples. Throws if the query was
+    // interrupted or has run past its timeout.
+    inline void checkInterrupted() const {
+        if (interrupted.load(std::memory_order_relaxed)) {
+            throw common::InterruptException("Query is interrupted.");
+        }
+        if (deadlineTicks != UINT64_MAX && common::TickCounter::now() > deadlineTicks) {
+            throw common::InterruptException(
+                "Query exceeded the timeout of " + std::to_string(timeoutInMS) + " ms.");
+        }
+    }
+
+    inline uint64_t getMemoryLimit() const { return memoryLimitInBytes; }
+
 private:
     uint64_t numThreadsForExecution;
+    // 0 means no timeout.
+    uint64_t timeoutInMS;
+    // 0 means no memory limit.
+    uint64_t memoryLimitInBytes;
+    std::atomic<bool> interrupted;
+    uint64_t deadlineTicks;
 };
 
 } // namespace main
@@ -73,6 +73,23 @@ public:
      * @return the maximum number of threads to use for execution in the current connection.
      */
     KUZU_API uint64_t getMaxNumThreadForExec();
+    /**
+     * @brief Sets the timeout of queries executed in the current connection. A query running
+     * longer than the timeout is interrupted and returns an error.
+     * @param timeoutInMS The timeout in milliseconds. 0 means no timeout.
+     */
+    KUZU_API void setQueryTimeOut(uint64_t timeoutInMS);
+    /**
+     * @brief Sets the maximum amount of intermediate memory a query executed in the current
+     * connection can hold. A query exceeding the limit is aborted and returns an error.
+     * @param memoryLimitInBytes The memory limit in bytes. 0 means no limit.
+     */
+    KUZU_API void setQueryMemoryLimit(uint64_t memoryLimitInBytes);
+    /**
+     * @brief Interrupts the query running in the current connection. Can be called from another
+     * thread. The query stops at the next batch of tuples and returns an error.
+     */
+    KUZU_API void interrupt();
 
     /**
      * @brief Executes the given query and returns the result.
@@ -11,7 +11,7 @@ namespace kuzu {
 namespace main {
 
 /**
- * @brief Stores buffer pool size and max number of threads configurations.
+ * @brief Stores buffer pool size, max number of threads and access mode configurations.
  */
 KUZU_API struct SystemConfig {
     /**
@@ -30,6 +30,12 @@ KUZU_API struct SystemConfig {
     uint64_t defaultPageBufferPoolSize;
     uint64_t largePageBufferPoolSize;
     uint64_t maxNumThreads;
+    /**
+     * @brief Whether to open an existing database in read-only mode. In read-only mode, the data
+     * and index files are memory-mapped and read directly instead of through the buffer pool, and
+     * write transactions are rejected. This suits databases that fit in memory.
+     */
+    bool readOnly = false;
 };
 
 /**
@@ -23,6 +23,7 @@ struct PreparedSummary {
 class QuerySummary {
     friend class Connection;
     friend class benchmark::Benchmark;
+    friend class testing::TestHelper;
 
 public:
     /**
@@ -40,6 +41,11 @@ public:
      * @return physical plan for query in string format.
      */
     KUZU_API std::string getPlan();
+    /**
+     * @return wall time in milliseconds of each phase of a COPY, in the order they ran. Empty for
+     * other queries and for copies that do not report phases.
+     */
+    KUZU_API const std::vector<std::pair<std::string, double>>& getPhaseTimes() const;
     void setPreparedSummary(PreparedSummary preparedSummary_);
 
 private:
@@ -47,6 +53,7 @@ private:
 
 private:
     double executionTime = 0;
+    std::vector<std::pair<std::string, double>> phaseTimes;
     PreparedSummary preparedSummary;
     std::unique_ptr<nlohmann::json> planInJson;
     std::ostringstream planInOstream;
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/logical_plan/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer marks an extend whose nbr nodes and rels are not consumed by the aggregate it
+// feeds, e.g.
+//      Aggregate(COUNT(*), a.name)
+//      Projection(a.name)
+//      ScanNodeProperty(a.name)
+//      Extend(a->b)
+//      S(a)
+// as count only. Such an extend only needs the number of nbrs of each bound node, which is read
+// from the list header (and the listsUpdatesStore in write transactions), so no list page is read.
+// The aggregate multiplies the unflat group sizes, so COUNT(*) over unflat extends is computed
+// without touching adjacency data at all. This also covers degree queries, i.e. counting the rels
+// of each node.
+class CountOnlyExtendOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void visitAggregate(planner::LogicalOperator* op) override;
+
+    // Searches operators between the aggregate and the extend that only read their inputs.
+    // Expressions consumed by these operators are collected into expressionsInUse.
+    planner::LogicalOperator* searchExtend(
+        planner::LogicalOperator* op, binder::expression_vector& expressionsInUse);
+
+    static bool isNbrOrRelInUse(
+        const binder::Expression& expression, const std::unordered_set<std::string>& names);
+};
+
+} // namespace optimizer
+} // namespace kuzu
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/logical_plan/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer pushes a filter over the build side join keys of an inner hash join into the scan
+// that sources its probe side pipeline, e.g.
+//      HashJoin(a)                                  HashJoin(a)
+//   Extend(a->b)    Filter(a.age > 50)     into  Extend(a->b)    Filter(a.age > 50)
+//   S(a)            S(a)                         S(a) + filter   S(a)
+// so that nodes without a match are discarded before they are extended and probed. Unlike ASP, the
+// probe side is not accumulated. The filter is a bloom filter populated when the build side
+// finishes, and the scan falls back to scanning all nodes if the filter is not selective.
+class JoinKeyFilterOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void visitHashJoin(planner::LogicalOperator* op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
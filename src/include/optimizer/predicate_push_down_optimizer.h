@@ -0,0 +1,35 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node_property.h"
+#include "planner/logical_plan/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer pushes simple predicates into the property scan of a node table scan, e.g.
+//   Filter(a.age > 50)
+//   ScanNodeProperty(a.age)          into   ScanNodeProperty(a.age WHERE a.age > 50)
+//   ScanNode(a)                             ScanNode(a)
+// A predicate is pushed if it compares a fixed-size property with a non-null literal of the same
+// type. The scan then evaluates it directly on the column pages and only reads properties for the
+// nodes that satisfy it. Predicates are only pushed into scans that directly follow the node table
+// scan, possibly through other property scans of the same node, where node IDs are sequential.
+class PredicatePushDownOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    std::shared_ptr<planner::LogicalOperator> visitOperator(
+        std::shared_ptr<planner::LogicalOperator> op);
+
+    std::shared_ptr<planner::LogicalOperator> visitFilterReplace(
+        std::shared_ptr<planner::LogicalOperator> op) override;
+
+    static bool isOnNodeTableScan(const planner::LogicalScanNodeProperty& scanNodeProperty);
+    static bool canPushDown(const binder::Expression& predicate,
+        const planner::LogicalScanNodeProperty& scanNodeProperty);
+};
+
+} // namespace optimizer
+} // namespace kuzu
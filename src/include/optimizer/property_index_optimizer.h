@@ -0,0 +1,30 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/logical_plan/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// This optimizer links predicates of the form "property <op> literal" (or a parameter) on a node to
+// the scan of the node, e.g.
+//      Filter(a.email = $e)                   Filter(a.email = $e)
+//      ScanNodeProperty(a.email)     into     ScanNodeProperty(a.email)
+//      S(a)                                   S(a) restricted by index lookup
+// and similarly for predicates pushed into a ScanNodeProperty. Whether the property is indexed is
+// only known to storage, so the mapper adds a lookup into the property index to the scan if there
+// is one, and the scan only outputs the nodes returned by the lookup. Predicates are still
+// evaluated, since lookups return a superset of the qualifying nodes.
+class PropertyIndexOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void visitFilter(planner::LogicalOperator* op) override;
+    void visitScanNodeProperty(planner::LogicalOperator* op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
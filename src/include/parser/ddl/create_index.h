@@ -0,0 +1,21 @@
+#pragma once
+
+#include "parser/ddl/ddl.h"
+
+namespace kuzu {
+namespace parser {
+
+class CreateIndex : public DDL {
+public:
+    explicit CreateIndex(std::string tableName, std::string propertyName)
+        : DDL{common::StatementType::CREATE_INDEX, std::move(tableName)}, propertyName{std::move(
+                                                                              propertyName)} {}
+
+    inline std::string getPropertyName() const { return propertyName; };
+
+private:
+    std::string propertyName;
+};
+
+} // namespace parser
+} // namespace kuzu
@@ -219,6 +219,8 @@ private:
 
     std::unique_ptr<Statement> transformDropTable(CypherParser::KU_DropTableContext& ctx);
 
+    std::unique_ptr<Statement> transformCreateIndex(CypherParser::KU_CreateIndexContext& ctx);
+
     std::unique_ptr<Statement> transformRenameTable(CypherParser::KU_AlterTableContext& ctx);
 
     std::unique_ptr<Statement> transformAddProperty(CypherParser::KU_AlterTableContext& ctx);
@@ -34,8 +34,11 @@ public:
 
     std::unique_ptr<JoinOrderEnumeratorContext> enterSubquery(LogicalPlan* outerPlan,
         binder::expression_vector expressionsToScan,
-        binder::expression_vector nodeIDsToScanFromInnerAndOuter);
+        binder::expression_vector nodeIDsToScanFromInnerAndOuter,
+        std::shared_ptr<Expression> nodeIDToExtendFromOuter = nullptr);
     void exitSubquery(std::unique_ptr<JoinOrderEnumeratorContext> prevContext);
+    // Whether the plan starts from the outer plan of the current subquery. See planNodeScan.
+    bool containsOuterPlan(const LogicalPlan& plan) const;
 
     static inline void planMarkJoin(const binder::expression_vector& joinNodeIDs,
         std::shared_ptr<Expression> mark, LogicalPlan& probePlan, LogicalPlan& buildPlan) {
@@ -95,6 +98,7 @@ private:
 
     void planInnerJoin(uint32_t leftLevel, uint32_t rightLevel);
 
+    bool canExtendFromNode(LogicalPlan& plan, NodeExpression* node) const;
     bool canApplyINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
         const std::vector<std::shared_ptr<NodeExpression>>& joinNodes);
     void planInnerINLJoin(const SubqueryGraph& subgraph, const SubqueryGraph& otherSubgraph,
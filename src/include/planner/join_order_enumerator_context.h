@@ -43,6 +43,10 @@ public:
         }
         return false;
     }
+    inline bool isNodeToExtendFromOuter(const NodeExpression& node) const {
+        return nodeIDToExtendFromOuter != nullptr &&
+               nodeIDToExtendFromOuter->getUniqueName() == node.getInternalIDPropertyName();
+    }
 
     void resetState();
 
@@ -58,6 +62,9 @@ private:
     LogicalPlan* outerPlan;
     expression_vector expressionsToScanFromOuter;
     expression_vector nodeIDsToScanFromInnerAndOuter;
+    // If set, plans of the subquery may start from the outer plan at this node instead of joining
+    // with the outer plan once the subquery is planned.
+    std::shared_ptr<Expression> nodeIDToExtendFromOuter;
 };
 
 } // namespace planner
@@ -14,6 +14,7 @@ enum class LogicalOperatorType : uint8_t {
     CREATE_REL,
     CREATE_NODE_TABLE,
     CREATE_REL_TABLE,
+    CREATE_INDEX,
     CROSS_PRODUCT,
     DELETE_NODE,
     DELETE_REL,
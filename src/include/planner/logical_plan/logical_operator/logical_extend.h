@@ -32,10 +32,14 @@ public:
     inline std::shared_ptr<binder::RelExpression> getRel() const { return rel; }
     inline common::RelDirection getDirection() const { return direction; }
     inline binder::expression_vector getProperties() const { return properties; }
+    inline void setCountOnly() { countOnly = true; }
+    inline bool isCountOnly() const { return countOnly; }
 
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalExtend>(
+        auto extend = make_unique<LogicalExtend>(
             boundNode, nbrNode, rel, direction, properties, extendToNewGroup, children[0]->copy());
+        extend->countOnly = countOnly;
+        return extend;
     }
 
 protected:
@@ -46,6 +50,9 @@ protected:
     binder::expression_vector properties;
     // When extend might increase cardinality (i.e. n * m), we extend to a new factorization group.
     bool extendToNewGroup;
+    // Nothing but the number of nbrs is consumed, so nbr node IDs do not need to be read. See
+    // CountOnlyExtendOptimizer.
+    bool countOnly = false;
 };
 
 } // namespace planner
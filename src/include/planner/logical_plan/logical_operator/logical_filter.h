@@ -24,12 +24,20 @@ public:
 
     f_group_pos getGroupPosToSelect() const;
 
+    // Unique name of the node whose property is compared by the predicate, if the scan of the node
+    // might be restricted by a property index lookup. See PropertyIndexOptimizer.
+    inline void setNodeToRestrict(std::string nodeName) { nodeToRestrict = std::move(nodeName); }
+    inline std::string getNodeToRestrict() const { return nodeToRestrict; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalFilter>(expression, children[0]->copy());
+        auto filter = make_unique<LogicalFilter>(expression, children[0]->copy());
+        filter->nodeToRestrict = nodeToRestrict;
+        return filter;
     }
 
 private:
     std::shared_ptr<binder::Expression> expression;
+    std::string nodeToRestrict;
 };
 
 } // namespace planner
@@ -32,7 +32,7 @@ public:
         : LogicalOperator{LogicalOperatorType::HASH_JOIN, std::move(probeSideChild),
               std::move(buildSideChild)},
           joinNodeIDs(std::move(joinNodeIDs)), joinType{joinType}, mark{std::move(mark)},
-          sip{SidewaysInfoPassing::NONE} {}
+          sip{SidewaysInfoPassing::NONE}, filterProbeSideScan{false} {}
 
     f_group_pos_set getGroupsPosToFlattenOnProbeSide();
     f_group_pos_set getGroupsPosToFlattenOnBuildSide();
@@ -53,10 +53,14 @@ public:
     }
     inline void setSIP(SidewaysInfoPassing sip_) { sip = sip_; }
     inline SidewaysInfoPassing getSIP() const { return sip; }
+    inline void setFilterProbeSideScan(bool value) { filterProbeSideScan = value; }
+    inline bool getFilterProbeSideScan() const { return filterProbeSideScan; }
 
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalHashJoin>(
+        auto hashJoin = make_unique<LogicalHashJoin>(
             joinNodeIDs, joinType, mark, children[0]->copy(), children[1]->copy());
+        hashJoin->filterProbeSideScan = filterProbeSideScan;
+        return hashJoin;
     }
 
 private:
@@ -76,6 +80,9 @@ private:
     common::JoinType joinType;
     std::shared_ptr<binder::Expression> mark; // when joinType is Mark
     SidewaysInfoPassing sip;
+    // Whether the scan of the join node that sources the probe side pipeline drops nodes not in
+    // the build side. See JoinKeyFilterOptimizer.
+    bool filterProbeSideScan;
 };
 
 } // namespace planner
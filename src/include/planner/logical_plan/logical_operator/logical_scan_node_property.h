@@ -16,20 +16,36 @@ public:
     void computeFactorizedSchema() override;
     void computeFlatSchema() override;
 
-    inline std::string getExpressionsForPrinting() const override {
-        return binder::ExpressionUtil::toString(properties);
-    }
+    std::string getExpressionsForPrinting() const override;
 
     inline std::shared_ptr<binder::NodeExpression> getNode() const { return node; }
     inline binder::expression_vector getProperties() const { return properties; }
 
+    // Predicates of the form "property <op> literal" (or "literal <op> property") on properties
+    // of this scan. Nodes that do not satisfy all of them are filtered out before properties are
+    // read. See PredicatePushDownOptimizer.
+    inline void addPredicate(std::shared_ptr<binder::Expression> predicate) {
+        predicates.push_back(std::move(predicate));
+    }
+    inline binder::expression_vector getPredicates() const { return predicates; }
+    // Whether the scan of the node might be restricted by property index lookups for the
+    // predicates. See PropertyIndexOptimizer.
+    inline void setRestrictScanNode(bool value) { restrictScanNode = value; }
+    inline bool getRestrictScanNode() const { return restrictScanNode; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalScanNodeProperty>(node, properties, children[0]->copy());
+        auto scanNodeProperty =
+            make_unique<LogicalScanNodeProperty>(node, properties, children[0]->copy());
+        scanNodeProperty->predicates = predicates;
+        scanNodeProperty->restrictScanNode = restrictScanNode;
+        return scanNodeProperty;
     }
 
 private:
     std::shared_ptr<binder::NodeExpression> node;
     binder::expression_vector properties;
+    binder::expression_vector predicates;
+    bool restrictScanNode = false;
 };
 
 } // namespace planner
@@ -15,6 +15,18 @@ public:
         return encodeJoin(logicalPlan.getLastOperator().get());
     }
 
+    // Return the scan of the single labeled node with the given unique name that op reads from,
+    // searching through operators which neither produce nor drop tuples based on other nodes.
+    // Return nullptr if there is none.
+    static LogicalOperator* searchScanNodeThroughFilters(
+        LogicalOperator* op, const std::string& nodeName);
+
+    // Return the scan of the given node ID that sources the pipeline of op, searching through
+    // operators which neither produce nor drop tuples based on the tuples they have already seen.
+    // Return nullptr if there is none.
+    static LogicalOperator* searchScanNodeOnPipeline(
+        LogicalOperator* op, const binder::Expression& nodeID);
+
 private:
     static LogicalOperator* getCurrentPipelineSourceOperator(LogicalPlan& plan);
 
@@ -30,6 +30,8 @@ private:
 
     static std::unique_ptr<LogicalPlan> planRenameProperty(const BoundStatement& statement);
 
+    static std::unique_ptr<LogicalPlan> planCreateIndex(const BoundStatement& statement);
+
     static std::unique_ptr<LogicalPlan> planCopy(const BoundStatement& statement);
 };
 
@@ -18,6 +18,9 @@ public:
 
 private:
     void planProjectionBody(const binder::BoundProjectionBody& projectionBody, LogicalPlan& plan);
+    // Sorts and limits before scanning the deferred properties not needed by ORDER BY.
+    void planProjectionBodyWithSkipOrLimitFirst(
+        const binder::BoundProjectionBody& projectionBody, LogicalPlan& plan);
     void planAggregate(const binder::expression_vector& expressionsToAggregate,
         const binder::expression_vector& expressionsToGroupBy, LogicalPlan& plan);
 
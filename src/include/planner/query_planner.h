@@ -33,6 +33,7 @@ private:
 
     std::vector<std::unique_ptr<LogicalPlan>> planSingleQuery(
         const NormalizedSingleQuery& singleQuery);
+    void populateDeferredProperties(const NormalizedSingleQuery& singleQuery);
     std::vector<std::unique_ptr<LogicalPlan>> planQueryPart(
         const NormalizedQueryPart& queryPart, std::vector<std::unique_ptr<LogicalPlan>> prevPlans);
 
@@ -49,6 +50,7 @@ private:
         expression_vector& predicates, LogicalPlan& outerPlan);
     void planRegularMatch(const QueryGraphCollection& queryGraphCollection,
         expression_vector& predicates, LogicalPlan& prevPlan);
+    bool canExtendFromPrevPlan(const expression_vector& joinNodeIDs) const;
     void planExistsSubquery(std::shared_ptr<Expression>& subquery, LogicalPlan& outerPlan);
     void planSubqueryIfNecessary(const std::shared_ptr<Expression>& expression, LogicalPlan& plan);
 
@@ -67,6 +69,13 @@ private:
 
     void appendScanNodePropIfNecessary(const expression_vector& propertyExpressions,
         std::shared_ptr<NodeExpression> node, LogicalPlan& plan);
+    // Scans the deferred properties among the given ones whose node ID is in scope.
+    void appendScanDeferredPropIfNecessary(
+        const expression_vector& propertyExpressions, LogicalPlan& plan);
+
+    inline bool isPropertyDeferred(const Expression& property) const {
+        return deferredProperties.contains(property.getUniqueName());
+    }
 
     std::unique_ptr<LogicalPlan> createUnionPlan(
         std::vector<std::unique_ptr<LogicalPlan>>& childrenPlans, bool isUnionAll);
@@ -82,6 +91,14 @@ private:
 private:
     const catalog::Catalog& catalog;
     expression_vector propertiesToScan;
+    // Properties only read by projection bodies (RETURN and WITH). They are not scanned with
+    // their node but right before the projection body that needs them, i.e. after all joins and
+    // filters, and for ORDER BY ... LIMIT after the limit, so that they are only read for nodes in
+    // the result.
+    std::unordered_set<std::string> deferredProperties;
+    std::vector<std::shared_ptr<NodeExpression>> nodesWithDeferredProperties;
+    // IDs of nodes first matched by an OPTIONAL MATCH or with multiple labels.
+    std::unordered_set<std::string> nullableOrMixedNodeIDs;
     JoinOrderEnumerator joinOrderEnumerator;
     ProjectionPlanner projectionPlanner;
     UpdatePlanner updatePlanner;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/profiler.h"
+#include "main/client_context.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/buffer_manager/memory_manager.h"
 #include "transaction/transaction.h"
@@ -11,14 +12,24 @@ namespace processor {
 struct ExecutionContext {
 
     ExecutionContext(uint64_t numThreads, common::Profiler* profiler,
-        storage::MemoryManager* memoryManager, storage::BufferManager* bufferManager)
+        storage::MemoryManager* memoryManager, storage::BufferManager* bufferManager,
+        main::ClientContext* clientContext = nullptr)
         : numThreads{numThreads}, profiler{profiler}, memoryManager{memoryManager},
-          bufferManager{bufferManager}, transaction{nullptr} {}
+          bufferManager{bufferManager}, clientContext{clientContext}, transaction{nullptr} {
+        if (clientContext != nullptr && clientContext->getMemoryLimit() != 0) {
+            memoryTracker =
+                std::make_shared<storage::QueryMemoryTracker>(clientContext->getMemoryLimit());
+        }
+    }
 
     uint64_t numThreads;
     common::Profiler* profiler;
     storage::MemoryManager* memoryManager;
     storage::BufferManager* bufferManager;
+    // Null if the query is not issued through a connection, e.g. in tests.
+    main::ClientContext* clientContext;
+    // Null if the query has no memory limit.
+    std::shared_ptr<storage::QueryMemoryTracker> memoryTracker;
 
     transaction::Transaction* transaction;
 };
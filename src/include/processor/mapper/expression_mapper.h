@@ -2,6 +2,7 @@
 
 #include "binder/expression/expression.h"
 #include "expression_evaluator/base_evaluator.h"
+#include "expression_evaluator/fused_evaluator.h"
 #include "processor/execution_context.h"
 #include "processor/result/result_set.h"
 #include "processor/result/result_set_descriptor.h"
@@ -32,6 +33,22 @@ private:
 
     std::unique_ptr<evaluator::BaseExpressionEvaluator> mapFunctionExpression(
         const std::shared_ptr<binder::Expression>& expression, const planner::Schema& schema);
+
+    std::unique_ptr<evaluator::BaseExpressionEvaluator> mapFusedExpression(
+        const std::shared_ptr<binder::Expression>& expression, const planner::Schema& schema);
+
+    // An expression is fused if it has at least two operators, all of which can be fused, and all
+    // its unflat inputs are in the same data chunk.
+    static bool canFuse(const binder::Expression& expression, const planner::Schema& schema);
+    // Returns the number of operators in the expression, or -1 if the expression cannot be fused.
+    // unflatGroupPos is set to the position of the unflat group the expression reads, if any.
+    static int64_t getNumFusibleOperators(const binder::Expression& expression,
+        const planner::Schema& schema, int64_t& unflatGroupPos);
+    static evaluator::FusedOpType getFusedOpType(const binder::Expression& expression);
+
+    uint32_t addFusedInstructions(const std::shared_ptr<binder::Expression>& expression,
+        const planner::Schema& schema, evaluator::FusedProgram& program,
+        std::vector<std::unique_ptr<evaluator::BaseExpressionEvaluator>>& leaves);
 };
 
 } // namespace processor
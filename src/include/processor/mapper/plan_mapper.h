@@ -67,6 +67,8 @@ private:
         planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapLogicalUnionAllToPhysical(
         planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapLogicalUnionAllToStreamingPhysical(
+        planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapLogicalAccumulateToPhysical(
         planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapLogicalExpressionsScanToPhysical(
@@ -101,6 +103,8 @@ private:
         planner::LogicalOperator* logicalOperator);
     std::unique_ptr<PhysicalOperator> mapLogicalRenamePropertyToPhysical(
         planner::LogicalOperator* logicalOperator);
+    std::unique_ptr<PhysicalOperator> mapLogicalCreateIndexToPhysical(
+        planner::LogicalOperator* logicalOperator);
 
     std::unique_ptr<ResultCollector> appendResultCollector(
         const binder::expression_vector& expressionsToCollect, const planner::Schema& schema,
@@ -128,6 +132,12 @@ private:
 
     void mapASP(PhysicalOperator* probe);
 
+    // Adds lookups into the property indexes for the given predicates to the scan of the node that
+    // the mapped logical child reads from. Predicates are comparisons between a property of the
+    // node and a literal or parameter.
+    void addPropertyIndexLookups(const binder::expression_vector& predicates,
+        planner::LogicalOperator* logicalChild, const std::string& nodeName);
+
 public:
     storage::StorageManager& storageManager;
     storage::MemoryManager* memoryManager;
@@ -29,15 +29,29 @@ struct HashSlot {
  * Linear probing. When collision happens, we find the next hash slot whose entry is a
  * nullptr.
  *
+ * 4. Direct aggregation
+ * If there is a single hash key of type INTERNAL_ID, BOOL, INT64, INT32 or INT16, hash slots are
+ * first used as a directly indexed array: slot 0 holds the null key and the key k (the node offset
+ * for INTERNAL_ID) is at slot 1 + k - directSlotsBaseKey, so there is no hashing or key comparison.
+ * The array grows as keys outside its range are observed, as long as the range stays small (see
+ * reserveDirectSlots). Otherwise, e.g. for keys of several node tables or sparse keys, the table
+ * computes the hash values of its entries, which are not maintained in direct mode, and switches
+ * to hashing for good.
+ *
  */
 class AggregateHashTable;
 using compare_function_t = std::function<bool(const uint8_t*, const uint8_t*)>;
+using get_direct_key_function_t = int64_t (*)(const uint8_t*);
 using update_agg_function_t =
     std::function<void(AggregateHashTable*, const std::vector<common::ValueVector*>&,
         const std::vector<common::ValueVector*>&, std::unique_ptr<function::AggregateFunction>&,
         common::ValueVector*, uint64_t, uint32_t, uint32_t)>;
 
 class AggregateHashTable : public BaseHashTable {
+    // A directly indexed table may have at most this many slots per (possible) entry.
+    static constexpr uint64_t DIRECT_AGGREGATION_MAX_NUM_SLOTS_PER_ENTRY = 8;
+    static constexpr uint64_t NULL_KEY_DIRECT_SLOT_IDX = 0;
+
 public:
     // Used by distinct aggregate hash table only.
     inline AggregateHashTable(storage::MemoryManager& memoryManager,
@@ -45,7 +59,10 @@ public:
         const std::vector<std::unique_ptr<function::AggregateFunction>>& aggregateFunctions,
         uint64_t numEntriesToAllocate)
         : AggregateHashTable(memoryManager, groupByHashKeysDataTypes,
-              std::vector<common::DataType>(), aggregateFunctions, numEntriesToAllocate) {}
+              std::vector<common::DataType>(), aggregateFunctions, numEntriesToAllocate) {
+        // Distinct hash tables only look up and create entries through hashing.
+        isDirectAggregation = false;
+    }
 
     AggregateHashTable(storage::MemoryManager& memoryManager,
         std::vector<common::DataType> groupByHashKeysDataTypes,
@@ -63,14 +80,16 @@ public:
         const std::vector<common::ValueVector*>& groupByUnFlatHashKeyVectors,
         const std::vector<common::ValueVector*>& aggregateVectors, uint64_t multiplicity) {
         append(groupByFlatKeyVectors, groupByUnFlatHashKeyVectors,
-            std::vector<common::ValueVector*>(), aggregateVectors, multiplicity);
+            std::vector<common::ValueVector*>(), aggregateVectors,
+            std::vector<uint64_t>(aggregateVectors.size(), multiplicity));
     }
 
-    //! update aggregate states for an input
+    //! update aggregate states for an input, multiplicities are per aggregate
     void append(const std::vector<common::ValueVector*>& groupByFlatKeyVectors,
         const std::vector<common::ValueVector*>& groupByUnFlatHashKeyVectors,
         const std::vector<common::ValueVector*>& groupByNonHashKeyVectors,
-        const std::vector<common::ValueVector*>& aggregateVectors, uint64_t multiplicity);
+        const std::vector<common::ValueVector*>& aggregateVectors,
+        const std::vector<uint64_t>& multiplicities);
 
     bool isAggregateValueDistinctForGroupByKeys(
         const std::vector<common::ValueVector*>& groupByKeyVectors,
@@ -91,6 +110,32 @@ private:
 
     void initializeTmpVectors();
 
+    // Finds the directly indexed slots of the keys and creates missing entries. Returns false
+    // without changing anything if a key cannot be directly indexed.
+    bool findDirectSlots(const std::vector<common::ValueVector*>& groupByFlatHashKeyVectors,
+        const std::vector<common::ValueVector*>& groupByUnflatHashKeyVectors,
+        const std::vector<common::ValueVector*>& groupByNonHashKeyVectors);
+    // Grows the direct slots to cover [minKey, maxKey] if the range is small enough for the
+    // number of entries. numNewKeys bounds the number of entries about to be added.
+    bool reserveDirectSlots(int64_t minKey, int64_t maxKey, uint64_t numNewKeys);
+    void rebuildDirectSlots(uint64_t numSlots);
+    inline bool isCoveredByDirectSlots(int64_t key) const {
+        return hasDirectKeys && key >= directSlotsBaseKey &&
+               (uint64_t)key - (uint64_t)directSlotsBaseKey < maxNumHashSlots - 1;
+    }
+    inline uint64_t getDirectSlotIdx(int64_t key) const {
+        return (uint64_t)key - (uint64_t)directSlotsBaseKey + 1;
+    }
+    uint64_t getDirectSlotIdx(const uint8_t* entry) const;
+    void switchToHashAggregation(uint64_t numEntriesToReserve);
+    template<typename T>
+    void computeEntryHashes();
+    void computeEntryHashes();
+
+    template<typename T>
+    static int64_t getDirectKey(const uint8_t* key);
+    static get_direct_key_function_t getDirectKeyFunc(common::DataTypeID typeID);
+
     // ! This function will only be used by distinct aggregate, which assumes that all groupByKeys
     // are flat.
     uint8_t* findEntryInDistinctHT(
@@ -139,7 +184,8 @@ private:
 
     void updateAggStates(const std::vector<common::ValueVector*>& groupByFlatHashKeyVectors,
         const std::vector<common::ValueVector*>& groupByUnFlatHashKeyVectors,
-        const std::vector<common::ValueVector*>& aggregateVectors, uint64_t multiplicity);
+        const std::vector<common::ValueVector*>& aggregateVectors,
+        const std::vector<uint64_t>& multiplicities);
 
     // ! This function will only be used by distinct aggregate, which assumes that all keyVectors
     // are flat.
@@ -239,6 +285,15 @@ private:
     std::unique_ptr<uint64_t[]> mayMatchIdxes;
     std::unique_ptr<uint64_t[]> noMatchIdxes;
     std::unique_ptr<uint64_t[]> tmpSlotIdxes;
+    // Direct aggregation. The hash column of entries is only valid if isDirectAggregation is false.
+    bool isDirectAggregation;
+    get_direct_key_function_t directKeyFunc;
+    // Whether some non-null key has been directly indexed, and the range of such keys.
+    bool hasDirectKeys = false;
+    int64_t minDirectKey = 0;
+    int64_t maxDirectKey = 0;
+    int64_t directSlotsBaseKey = 0;
+    common::table_id_t directKeysTableID = common::INVALID_TABLE_ID;
 };
 
 class AggregateHashTableUtils {
@@ -32,15 +32,29 @@ public:
 protected:
     BaseAggregate(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         std::vector<DataPos> aggregateVectorsPos,
+        std::vector<std::vector<uint32_t>> dataChunksPosToMultiply,
         std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
         : Sink{std::move(resultSetDescriptor), PhysicalOperatorType::AGGREGATE, std::move(child),
               id, paramsString},
-          aggregateVectorsPos{std::move(aggregateVectorsPos)}, aggregateFunctions{
-                                                                   std::move(aggregateFunctions)} {}
+          aggregateVectorsPos{std::move(aggregateVectorsPos)},
+          dataChunksPosToMultiply{std::move(dataChunksPosToMultiply)},
+          aggregateFunctions{std::move(aggregateFunctions)} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
+    // The number of times each input tuple of the aggregate at aggregateIdx occurs in the
+    // factorized result set.
+    inline uint64_t getMultiplicity(uint32_t aggregateIdx) const {
+        auto multiplicity = resultSet->multiplicity;
+        for (auto state : statesToMultiply[aggregateIdx]) {
+            if (!state->isFlat()) {
+                multiplicity *= state->selVector->selectedSize;
+            }
+        }
+        return multiplicity;
+    }
+
     void finalize(ExecutionContext* context) override = 0;
 
     std::unique_ptr<PhysicalOperator> clone() override = 0;
@@ -48,6 +62,11 @@ protected:
 protected:
     std::vector<DataPos> aggregateVectorsPos;
     std::vector<common::ValueVector*> aggregateVectors;
+    // For each aggregate, the data chunks in scope that are neither its input nor a group by key.
+    // The aggregate is computed over the factorized input without flattening them: every tuple of
+    // these chunks repeats the aggregate input, so their sizes multiply its multiplicity.
+    std::vector<std::vector<uint32_t>> dataChunksPosToMultiply;
+    std::vector<std::vector<common::DataChunkState*>> statesToMultiply;
     std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions;
 };
 
@@ -24,6 +24,7 @@ public:
                                                        std::move(aggregateDataTypes)} {}
 
     bool isSource() const override { return true; }
+    bool isMorselDrivenSource() const override { return true; }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
@@ -37,10 +37,12 @@ public:
         std::vector<DataPos> inputGroupByHashKeyVectorsPos,
         std::vector<DataPos> inputGroupByNonHashKeyVectorsPos,
         std::vector<bool> isInputGroupByHashKeyVectorFlat, std::vector<DataPos> aggregateVectorsPos,
+        std::vector<std::vector<uint32_t>> dataChunksPosToMultiply,
         std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
         : BaseAggregate{std::move(resultSetDescriptor), std::move(aggregateVectorsPos),
-              std::move(aggregateFunctions), std::move(child), id, paramsString},
+              std::move(dataChunksPosToMultiply), std::move(aggregateFunctions), std::move(child),
+              id, paramsString},
           groupByHashKeyVectorsPos{std::move(inputGroupByHashKeyVectorsPos)},
           groupByNonHashKeyVectorsPos{std::move(inputGroupByNonHashKeyVectorsPos)},
           isGroupByHashKeyVectorFlat{std::move(isInputGroupByHashKeyVectorFlat)},
@@ -62,6 +64,8 @@ private:
     std::vector<common::ValueVector*> groupByUnflatHashKeyVectors;
     std::vector<common::ValueVector*> groupByNonHashKeyVectors;
 
+    std::vector<uint64_t> multiplicities;
+
     std::shared_ptr<HashAggregateSharedState> sharedState;
     std::unique_ptr<AggregateHashTable> localAggregateHashTable;
 };
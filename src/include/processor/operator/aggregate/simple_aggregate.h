@@ -33,10 +33,12 @@ public:
     SimpleAggregate(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         std::shared_ptr<SimpleAggregateSharedState> sharedState,
         std::vector<DataPos> aggregateVectorsPos,
+        std::vector<std::vector<uint32_t>> dataChunksPosToMultiply,
         std::vector<std::unique_ptr<function::AggregateFunction>> aggregateFunctions,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
         : BaseAggregate{std::move(resultSetDescriptor), std::move(aggregateVectorsPos),
-              std::move(aggregateFunctions), std::move(child), id, paramsString},
+              std::move(dataChunksPosToMultiply), std::move(aggregateFunctions), std::move(child),
+              id, paramsString},
           sharedState{std::move(sharedState)} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
@@ -20,6 +20,12 @@ public:
 
     std::string execute(common::TaskScheduler* taskScheduler, ExecutionContext* executionContext);
 
+    // Wall time in milliseconds of each phase of the copy, in the order they ran. Empty if the
+    // copier does not report phases.
+    inline const std::vector<std::pair<std::string, double>>& getPhaseTimesMS() const {
+        return phaseTimesMS;
+    }
+
     bool getNextTuplesInternal() override {
         throw common::InternalException(
             "getNextTupleInternal() should not be called on CopyCSV operator.");
@@ -38,6 +44,7 @@ protected:
     common::CopyDescription copyDescription;
     common::table_id_t tableID;
     storage::WAL* wal;
+    std::vector<std::pair<std::string, double>> phaseTimesMS;
 };
 
 } // namespace processor
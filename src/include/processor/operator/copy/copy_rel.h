@@ -21,6 +21,10 @@ public:
             relsStatistics, id, paramsString);
     }
 
+    // Besides the time of the whole copy, reports the time and throughput of each of its phases.
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
 protected:
     uint64_t executeInternal(
         common::TaskScheduler* taskScheduler, ExecutionContext* executionContext) override;
@@ -33,6 +37,7 @@ private:
 private:
     storage::NodesStatisticsAndDeletedIDs* nodesStatistics;
     storage::RelsStatistics* relsStatistics;
+    uint64_t numRelsCopied = 0;
 };
 
 } // namespace processor
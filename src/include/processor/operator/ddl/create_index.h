@@ -0,0 +1,39 @@
+#pragma once
+
+#include "ddl.h"
+#include "storage/storage_manager.h"
+
+namespace kuzu {
+namespace processor {
+
+class CreateIndex : public DDL {
+public:
+    CreateIndex(catalog::Catalog* catalog, common::table_id_t tableID,
+        common::property_id_t propertyID, storage::StorageManager& storageManager,
+        const DataPos& outputPos, uint32_t id, const std::string& paramsString)
+        : DDL{PhysicalOperatorType::CREATE_INDEX, catalog, outputPos, id, paramsString},
+          tableID{tableID}, propertyID{propertyID}, storageManager{storageManager} {}
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override {
+        DDL::initLocalStateInternal(resultSet, context);
+        memoryManager = context->memoryManager;
+    }
+
+    void executeDDLInternal() override;
+
+    std::string getOutputMsg() override { return {"Index created."}; }
+
+    std::unique_ptr<PhysicalOperator> clone() override {
+        return make_unique<CreateIndex>(
+            catalog, tableID, propertyID, storageManager, outputPos, id, paramsString);
+    }
+
+protected:
+    common::table_id_t tableID;
+    common::property_id_t propertyID;
+    storage::StorageManager& storageManager;
+    storage::MemoryManager* memoryManager;
+};
+
+} // namespace processor
+} // namespace kuzu
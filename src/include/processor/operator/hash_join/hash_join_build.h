@@ -2,6 +2,7 @@
 
 #include "function/hash/hash_operations.h"
 #include "join_hash_table.h"
+#include "join_key_filter.h"
 #include "processor/operator/physical_operator.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
@@ -29,9 +30,16 @@ public:
 
     inline JoinHashTable* getHashTable() { return hashTable.get(); }
 
+    inline void setJoinKeyFilter(std::shared_ptr<JoinKeyFilter> filter) {
+        joinKeyFilter = std::move(filter);
+    }
+    inline JoinKeyFilter* getJoinKeyFilter() const { return joinKeyFilter.get(); }
+
 protected:
     std::mutex mtx;
     std::unique_ptr<JoinHashTable> hashTable;
+    // Set if the join key filter is pushed down into the probe side scan.
+    std::shared_ptr<JoinKeyFilter> joinKeyFilter;
 };
 
 struct BuildDataInfo {
@@ -8,6 +8,24 @@
 namespace kuzu {
 namespace processor {
 
+struct JoinHashSlot {
+    // With a single key column, the offset of the key. If all keys have the same table ID, the key
+    // is thus stored inline and probes do not read tuples. Otherwise, the hash of the keys. Its
+    // upper bits are not used to pick the slot, so they tell apart keys in the same run of slots.
+    uint64_t tag;
+    uint8_t* tuple; // Head of the prev pointer chain, or nullptr if the slot is empty.
+};
+
+/**
+ * JoinHashTable Design
+ *
+ * Tuples are stored in the factorizedTable, with the keys as the first columns and a prev pointer
+ * as the last column. The directory is an open addressing (linear probing) table of JoinHashSlots
+ * with a load factor of at most 0.5. Every occupied slot holds a distinct key, and the tuples with
+ * that key are chained through their prev pointers. Thus, a probe compares tags in the directory
+ * instead of hopping through tuples with unrelated keys, and every tuple of the chain it returns
+ * matches the probed key.
+ */
 class JoinHashTable : public BaseHashTable {
 public:
     JoinHashTable(storage::MemoryManager& memoryManager, uint64_t numKeyColumns,
@@ -30,10 +48,12 @@ public:
     inline uint8_t** getPrevTuple(const uint8_t* tuple) const {
         return (uint8_t**)(tuple + colOffsetOfPrevPtrInTuple);
     }
-    inline uint8_t* getTupleForHash(common::hash_t hash) {
-        auto slotIdx = getSlotIdxForHash(hash);
-        return ((uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]
-                                ->getData()))[slotIdx & slotIdxInBlockMask];
+    // Returns the head of the chain of tuples whose single key column equals key, or nullptr.
+    inline uint8_t* getTupleForKey(const common::nodeID_t& key) {
+        assert(numKeyColumns == 1);
+        common::hash_t hash;
+        function::operation::Hash::operation(key, false /* isNull */, hash);
+        return findTuple(hash, &key);
     }
     inline FactorizedTable* getFactorizedTable() { return factorizedTable.get(); }
     inline const FactorizedTableSchema* getTableSchema() {
@@ -41,9 +61,25 @@ public:
     }
 
 protected:
-    uint8_t** findHashSlot(common::nodeID_t* nodeIDs) const;
+    inline JoinHashSlot* getHashSlot(uint64_t slotIdx) const {
+        return (JoinHashSlot*)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData()) +
+               (slotIdx & slotIdxInBlockMask);
+    }
+    inline uint64_t getTag(common::hash_t hash, const common::nodeID_t& firstKey) const {
+        return numKeyColumns == 1 ? firstKey.offset : hash;
+    }
+    // keys holds one key per key column, in the same order as the tuples.
+    uint8_t* findTuple(common::hash_t hash, const common::nodeID_t* keys) const;
+    inline bool isKeysEqual(const uint8_t* tuple, const common::nodeID_t* keys) const {
+        for (auto i = 0u; i < numKeyColumns; i++) {
+            if (((common::nodeID_t*)tuple)[i] != keys[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
     // This function returns the pointer that previously stored in the same slot.
-    uint8_t* insertEntry(uint8_t* tuple) const;
+    uint8_t* insertEntry(uint8_t* tuple);
 
     // This function returns a boolean flag indicating if there is non-null keys after discarding.
     static bool discardNullFromKeys(
@@ -52,6 +88,9 @@ protected:
 private:
     uint64_t numKeyColumns;
     uint64_t colOffsetOfPrevPtrInTuple;
+    // The table ID of the first inserted key.
+    common::table_id_t keyTableID;
+    bool hasInlineKeys;
 };
 
 } // namespace processor
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <memory>
+
+#include "function/hash/hash_operations.h"
+
+namespace kuzu {
+namespace processor {
+
+class JoinHashTable;
+
+// Register-blocked bloom filter: all bits of a key fall into a single 64-bit word, so a lookup
+// costs one memory access and a couple of bit operations.
+class BlockedBloomFilter {
+public:
+    explicit BlockedBloomFilter(uint64_t numKeys);
+
+    inline void insert(common::hash_t hash) {
+        hash = remix(hash);
+        words[hash & wordIdxMask] |= getKeyBits(hash);
+    }
+    inline bool mayContain(common::hash_t hash) const {
+        hash = remix(hash);
+        auto keyBits = getKeyBits(hash);
+        return (words[hash & wordIdxMask] & keyBits) == keyBits;
+    }
+
+private:
+    // Our murmurhash64 is a single multiplication whose low bits are poorly mixed, so we apply the
+    // splitmix64 finalizer before using the hash to address bits.
+    static inline common::hash_t remix(common::hash_t hash) {
+        hash ^= hash >> 31;
+        hash *= UINT64_C(0x94d049bb133111eb);
+        return hash ^ (hash >> 29);
+    }
+    // Sets 4 bits in the word, each addressed by 6 of the upper 24 bits of the hash.
+    static inline uint64_t getKeyBits(common::hash_t hash) {
+        return ((uint64_t)1 << ((hash >> 40) & 63)) | ((uint64_t)1 << ((hash >> 46) & 63)) |
+               ((uint64_t)1 << ((hash >> 52) & 63)) | ((uint64_t)1 << ((hash >> 58) & 63));
+    }
+
+private:
+    static constexpr uint64_t NUM_BITS_PER_KEY = 16;
+
+    std::unique_ptr<uint64_t[]> words;
+    uint64_t wordIdxMask;
+};
+
+// Filter over the join keys of a hash join build side. It is shared with the ScanNodeID that
+// sources the probe side pipeline, so that the scan can drop nodes that cannot find a match before
+// they are extended, flattened and probed. The build side pipeline is a child of the probe side
+// pipeline, so the filter is populated before the scan starts.
+class JoinKeyFilter {
+public:
+    void build(JoinHashTable& hashTable);
+
+    // Checking the filter costs a hash and a random access per node, which only pays off if the
+    // build side covers a small fraction of the nodes to scan.
+    inline bool isSelective(uint64_t numNodesToScan) const {
+        return bloomFilter != nullptr && numKeys * MIN_SELECTIVITY_RATIO < numNodesToScan;
+    }
+    inline bool mayContain(const common::nodeID_t& nodeID) const {
+        common::hash_t hash;
+        function::operation::Hash::operation(nodeID, hash);
+        return bloomFilter->mayContain(hash);
+    }
+
+private:
+    static constexpr uint64_t MIN_SELECTIVITY_RATIO = 4;
+
+    uint64_t numKeys = 0;
+    std::unique_ptr<BlockedBloomFilter> bloomFilter;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -36,12 +36,25 @@ public:
             std::move(clonedChildren), id, paramsString);
     }
 
-private:
-    // For each build side, probe its HT and return a vector of matched flat tuples.
-    void probeHTs();
+    // Galloping search is used if the right list is larger than the left one by this factor, below
+    // which a linear merge touches fewer cache lines than the binary searches.
+    static constexpr uint64_t GALLOPING_SIZE_RATIO = 32;
+
     // Left is always the one with less num of values.
     static void twoWayIntersect(common::nodeID_t* leftNodeIDs, common::SelectionVector& lSelVector,
         common::nodeID_t* rightNodeIDs, common::SelectionVector& rSelVector);
+    // Both return the number of intersected values. They are public so that unit tests can check
+    // the galloping kernel against the merge one on lists of any size ratio.
+    static uint64_t mergeIntersect(common::nodeID_t* leftNodeIDs,
+        common::SelectionVector& lSelVector, common::nodeID_t* rightNodeIDs,
+        common::SelectionVector& rSelVector);
+    static uint64_t gallopingIntersect(common::nodeID_t* leftNodeIDs,
+        common::SelectionVector& lSelVector, common::nodeID_t* rightNodeIDs,
+        common::SelectionVector& rSelVector);
+
+private:
+    // For each build side, probe its HT and return a vector of matched flat tuples.
+    void probeHTs();
     void intersectLists(const std::vector<common::overflow_value_t>& listsToIntersect);
     void populatePayloads(
         const std::vector<uint8_t*>& tuples, const std::vector<uint32_t>& listIdxes);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "processor/data_pos.h"
+#include "common/task_system/task_scheduler.h"
 #include "processor/execution_context.h"
 #include "processor/result/result_set.h"
 #include "storage/buffer_manager/buffer_manager.h"
@@ -14,6 +15,7 @@ enum class PhysicalOperatorType : uint8_t {
     AGGREGATE_SCAN,
     COPY_NODE,
     COPY_REL,
+    CREATE_INDEX,
     CREATE_NODE,
     CREATE_NODE_TABLE,
     CREATE_REL,
@@ -50,6 +52,7 @@ enum class PhysicalOperatorType : uint8_t {
     ORDER_BY,
     ORDER_BY_MERGE,
     ORDER_BY_SCAN,
+    UNION_ALL,
     UNION_ALL_SCAN,
     UNWIND,
     VAR_LENGTH_ADJ_LIST_EXTEND,
@@ -64,27 +67,40 @@ public:
 struct OperatorMetrics {
 
 public:
-    OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple)
-        : executionTime{executionTime}, numOutputTuple{numOutputTuple} {}
+    OperatorMetrics(common::TimeMetric& executionTime, common::NumericMetric& numOutputTuple,
+        common::ResourceMetric& resourceUsage)
+        : executionTime{executionTime}, numOutputTuple{numOutputTuple}, resourceUsage{
+                                                                            resourceUsage} {}
+
+    inline void start() {
+        executionTime.start();
+        resourceUsage.start();
+    }
+    inline void stop() {
+        resourceUsage.stop();
+        executionTime.stop();
+    }
 
 public:
     common::TimeMetric& executionTime;
     common::NumericMetric& numOutputTuple;
+    common::ResourceMetric& resourceUsage;
 };
 
 class PhysicalOperator {
 public:
     // Leaf operator
     PhysicalOperator(PhysicalOperatorType operatorType, uint32_t id, std::string paramsString)
-        : operatorType{operatorType}, id{id}, transaction{nullptr}, paramsString{
-                                                                        std::move(paramsString)} {}
+        : operatorType{operatorType}, id{id}, transaction{nullptr}, clientContext{nullptr},
+          paramsString{std::move(paramsString)} {}
     // Unary operator
     PhysicalOperator(PhysicalOperatorType operatorType, std::unique_ptr<PhysicalOperator> child,
         uint32_t id, const std::string& paramsString);
     // Binary operator
     PhysicalOperator(PhysicalOperatorType operatorType, std::unique_ptr<PhysicalOperator> left,
         std::unique_ptr<PhysicalOperator> right, uint32_t id, const std::string& paramsString);
-    // This constructor is used by UnionAllScan only since it may have multiple children.
+    // This constructor is used by UnionAll and UnionAllScan only since they may have multiple
+    // children.
     PhysicalOperator(PhysicalOperatorType operatorType,
         std::vector<std::unique_ptr<PhysicalOperator>> children, uint32_t id,
         const std::string& paramsString);
@@ -97,6 +113,14 @@ public:
 
     inline virtual bool isSource() const { return false; }
     inline virtual bool isSink() const { return false; }
+    // Whether the operator is a source that takes a new morsel from its shared state on every call
+    // and keeps no tuples between calls, so a worker can leave the pipeline before any call.
+    inline virtual bool isMorselDrivenSource() const { return false; }
+
+    // Called on the source of a pipeline, where the worker can switch to another task
+    // between morsels (see TaskScheduler). Sources nested in a pipeline, e.g., branches of
+    // UnionAll, never yield as their parent has tuples in flight.
+    inline void enableYieldingBeforeMorsels() { canYieldBeforeMorsel = isMorselDrivenSource(); }
 
     inline void addChild(std::unique_ptr<PhysicalOperator> op) {
         children.push_back(std::move(op));
@@ -113,13 +137,19 @@ public:
     void initLocalState(ResultSet* resultSet, ExecutionContext* context);
 
     inline bool getNextTuple() {
-        metrics->executionTime.start();
+        if (clientContext != nullptr) {
+            clientContext->checkInterrupted();
+        }
+        if (canYieldBeforeMorsel && common::TaskScheduler::shouldYield()) {
+            return false;
+        }
+        metrics->start();
         auto result = getNextTuplesInternal();
-        metrics->executionTime.stop();
+        metrics->stop();
         return result;
     }
 
-    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+    virtual std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
         common::Profiler& profiler) const;
     std::vector<std::string> getProfilerAttributes(common::Profiler& profiler) const;
 
@@ -133,11 +163,13 @@ protected:
 
     inline std::string getTimeMetricKey() const { return "time-" + std::to_string(id); }
     inline std::string getNumTupleMetricKey() const { return "numTuple-" + std::to_string(id); }
+    inline std::string getResourceMetricKey() const { return "resource-" + std::to_string(id); }
 
     void registerProfilingMetrics(common::Profiler* profiler);
 
     double getExecutionTime(common::Profiler& profiler) const;
     uint64_t getNumOutputTuples(common::Profiler& profiler) const;
+    common::ResourceCounters getResourceUsage(common::Profiler& profiler) const;
 
 protected:
     uint32_t id;
@@ -146,7 +178,9 @@ protected:
 
     std::vector<std::unique_ptr<PhysicalOperator>> children;
     transaction::Transaction* transaction;
+    main::ClientContext* clientContext;
     ResultSet* resultSet;
+    bool canYieldBeforeMorsel = false;
 
     std::string paramsString;
 };
@@ -1,31 +1,42 @@
 #pragma once
 
+#include "processor/operator/filtering_operator.h"
 #include "processor/operator/scan/scan_columns.h"
 #include "storage/store/node_table.h"
 
 namespace kuzu {
 namespace processor {
 
-class ScanSingleNodeTable : public ScanColumns {
+// Column ID and predicate evaluated on that column.
+using column_predicates_t = std::vector<std::pair<uint32_t, storage::ColumnPredicate>>;
+
+// If predicates are pushed down, input nodes are first narrowed to those satisfying all of them,
+// comparing values on the column pages, and properties are then only read for the selected nodes.
+class ScanSingleNodeTable : public ScanColumns, public SelVectorOverWriter {
 public:
     ScanSingleNodeTable(const DataPos& inVectorPos, std::vector<DataPos> outVectorsPos,
         storage::NodeTable* table, std::vector<uint32_t> propertyColumnIds,
-        std::unique_ptr<PhysicalOperator> prevOperator, uint32_t id,
-        const std::string& paramsString)
+        column_predicates_t columnPredicates, std::unique_ptr<PhysicalOperator> prevOperator,
+        uint32_t id, const std::string& paramsString)
         : ScanColumns{inVectorPos, std::move(outVectorsPos), std::move(prevOperator), id,
               paramsString},
-          table{table}, propertyColumnIds{std::move(propertyColumnIds)} {}
+          table{table}, propertyColumnIds{std::move(propertyColumnIds)},
+          columnPredicates{std::move(columnPredicates)} {}
 
     bool getNextTuplesInternal() override;
 
     inline std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<ScanSingleNodeTable>(inputNodeIDVectorPos, outPropertyVectorsPos, table,
-            propertyColumnIds, children[0]->clone(), id, paramsString);
+            propertyColumnIds, columnPredicates, children[0]->clone(), id, paramsString);
     }
 
+private:
+    bool selectNodes();
+
 private:
     storage::NodeTable* table;
     std::vector<uint32_t> propertyColumnIds;
+    column_predicates_t columnPredicates;
 };
 
 class ScanMultiNodeTables : public ScanColumns {
@@ -1,61 +1,85 @@
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
+#include "processor/operator/hash_join/join_key_filter.h"
 #include "processor/operator/physical_operator.h"
 #include "storage/store/node_table.h"
 
 namespace kuzu {
 namespace processor {
 
-// Note: This class is not thread-safe.
-struct Mask {
+// Bitset over node offsets (or morsel indices) that can be set concurrently by multiple threads.
+class ConcurrentBitset {
 public:
-    explicit Mask(uint64_t size) {
-        data = std::make_unique<uint8_t[]>(size);
-        std::fill(data.get(), data.get() + size, 0);
+    explicit ConcurrentBitset(uint64_t size)
+        : words{std::make_unique<std::atomic<uint64_t>[]>(
+              (size + NUM_BITS_PER_WORD - 1) >> NUM_BITS_PER_WORD_LOG2)} {}
+
+    inline bool isSet(uint64_t pos) const {
+        return words[pos >> NUM_BITS_PER_WORD_LOG2].load(std::memory_order_relaxed) &
+               getBit(pos);
+    }
+    // Reading first avoids writing (and bouncing the cache line between threads) if the bit is
+    // already set, which is common when many tuples carry the same node.
+    inline void set(uint64_t pos) {
+        auto& word = words[pos >> NUM_BITS_PER_WORD_LOG2];
+        if (!(word.load(std::memory_order_relaxed) & getBit(pos))) {
+            word.fetch_or(getBit(pos), std::memory_order_relaxed);
+        }
     }
 
-    inline void setMask(uint64_t pos, uint8_t maskValue) { data[pos] = maskValue; }
-    inline bool isMasked(uint64_t pos, uint8_t trueMaskVal) { return data[pos] == trueMaskVal; }
+    // Writes positions of set bits within [startPos, endPos), relative to startPos, and returns the
+    // number of written positions.
+    uint64_t getSetPositions(uint64_t startPos, uint64_t endPos, common::sel_t* positions) const;
+
+private:
+    static inline uint64_t getBit(uint64_t pos) {
+        return (uint64_t)1 << (pos & (NUM_BITS_PER_WORD - 1));
+    }
 
 private:
-    std::unique_ptr<uint8_t[]> data;
+    static constexpr uint64_t NUM_BITS_PER_WORD = 64;
+    static constexpr uint64_t NUM_BITS_PER_WORD_LOG2 = 6;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> words;
 };
 
-// Note: This class is not thread-safe.
-struct NodeTableSemiMask {
+// Semi masks applied to the scan of a node table. Each masker owns a node mask and a morsel mask.
+// Multiple maskers might be applied to the same scan. They are executed in sequence and masker i
+// only sets nodes that are set by masker i - 1, so the masks of the last masker are the
+// intersection of all maskers and are the only ones the scan needs to check.
+// Note: Adding maskers is not thread-safe, but maskers can set masks concurrently.
+class NodeTableSemiMask {
 public:
-    NodeTableSemiMask() : numMaskers{0} {}
+    // Returns the index of the new masker.
+    uint8_t addMasker(common::offset_t maxNodeOffset, uint64_t maxMorselIdx);
 
-    inline void initializeMaskData(common::offset_t maxNodeOffset, common::offset_t maxMorselIdx) {
-        if (nodeMask != nullptr) {
-            // Multiple semi mask might be applied to the same sacn and thus initialize repeatedly.
-            return;
-        }
-        assert(morselMask == nullptr && maxNodeOffset != common::INVALID_NODE_OFFSET);
-        nodeMask = std::make_unique<Mask>(maxNodeOffset + 1);
-        morselMask = std::make_unique<Mask>(maxMorselIdx + 1);
+    inline bool isMorselMasked(uint64_t morselIdx) const {
+        return morselMasks.back()->isSet(morselIdx);
     }
-
-    inline bool isMorselMasked(uint64_t morselIdx) {
-        return morselMask->isMasked(morselIdx, numMaskers);
+    inline bool isNodeMasked(uint64_t nodeOffset) const {
+        return nodeMasks.back()->isSet(nodeOffset);
     }
-    inline bool isNodeMasked(uint64_t nodeOffset) {
-        return nodeMask->isMasked(nodeOffset, numMaskers);
+    inline uint64_t getMaskedNodes(
+        common::offset_t startOffset, common::offset_t endOffset, common::sel_t* positions) const {
+        return nodeMasks.back()->getSetPositions(startOffset, endOffset, positions);
     }
 
-    // Increment mask value for the given nodeOffset if its current mask value is equal to
-    // the specified `currentMaskValue`.
-    void incrementMaskValue(uint64_t nodeOffset, uint8_t currentMaskValue);
+    inline void setMask(uint64_t nodeOffset, uint8_t maskerIdx) {
+        if (maskerIdx > 0 && !nodeMasks[maskerIdx - 1]->isSet(nodeOffset)) {
+            return;
+        }
+        nodeMasks[maskerIdx]->set(nodeOffset);
+        morselMasks[maskerIdx]->set(nodeOffset >> common::DEFAULT_VECTOR_CAPACITY_LOG_2);
+    }
 
-    inline uint8_t getNumMaskers() const { return numMaskers; }
-    inline void incrementNumMaskers() { numMaskers++; }
+    inline uint8_t getNumMaskers() const { return nodeMasks.size(); }
 
 private:
-    std::unique_ptr<Mask> nodeMask;
-    std::unique_ptr<Mask> morselMask;
-    uint8_t numMaskers;
+    std::vector<std::unique_ptr<ConcurrentBitset>> nodeMasks;
+    std::vector<std::unique_ptr<ConcurrentBitset>> morselMasks;
 };
 
 // Note: This class is not thread-safe. It relies on its caller to correctly synchronize its state.
@@ -68,6 +92,9 @@ public:
     }
 
     inline storage::NodeTable* getTable() { return table; }
+    inline uint64_t getNumNodes() const {
+        return maxNodeOffset == common::INVALID_NODE_OFFSET ? 0 : maxNodeOffset + 1;
+    }
 
     inline void initializeMaxOffset(transaction::Transaction* transaction) {
         if (maxNodeOffset != common::INVALID_NODE_OFFSET) {
@@ -79,14 +106,23 @@ public:
         maxMorselIdx = maxNodeOffset >> common::DEFAULT_VECTOR_CAPACITY_LOG_2;
     }
 
-    inline void initSemiMask(transaction::Transaction* transaction) {
+    // Returns the index of the new masker.
+    inline uint8_t addSemiMasker(transaction::Transaction* transaction) {
         initializeMaxOffset(transaction);
-        semiMask->initializeMaskData(maxNodeOffset, maxMorselIdx);
+        return semiMask->addMasker(maxNodeOffset, maxMorselIdx);
     }
     inline bool isSemiMaskEnabled() { return semiMask->getNumMaskers() > 0; }
     inline NodeTableSemiMask* getSemiMask() { return semiMask.get(); }
-    inline uint8_t getNumMaskers() const { return semiMask->getNumMaskers(); }
-    inline void incrementNumMaskers() { semiMask->incrementNumMaskers(); }
+
+    // Restricts the scan to the given sorted node offsets, which come from property index lookups.
+    inline void setCandidateNodes(std::vector<common::offset_t> nodeOffsets) {
+        candidateNodes = std::move(nodeOffsets);
+        hasCandidateNodes_ = true;
+    }
+    inline bool hasCandidateNodes() const { return hasCandidateNodes_; }
+    inline const std::vector<common::offset_t>& getCandidateNodes() const {
+        return candidateNodes;
+    }
 
     std::pair<common::offset_t, common::offset_t> getNextRangeToRead();
 
@@ -96,6 +132,19 @@ private:
     uint64_t maxMorselIdx;
     uint64_t currentNodeOffset;
     std::unique_ptr<NodeTableSemiMask> semiMask;
+    bool hasCandidateNodes_ = false;
+    std::vector<common::offset_t> candidateNodes;
+    // Index of the first candidate node that is not before currentNodeOffset.
+    uint64_t nextCandidateIdx = 0;
+};
+
+// A lookup of the nodes that might satisfy "property <op> value" in an index of the scanned table.
+// It is added by the operator evaluating the predicate on the same pipeline as the scan, so that
+// nodes not returned by the lookup can be dropped by the scan. See PropertyIndexOptimizer.
+struct PropertyIndexLookup {
+    storage::PropertyIndex* index;
+    common::ExpressionType comparisonType;
+    common::Value value;
 };
 
 class ScanNodeIDSharedState {
@@ -108,18 +157,44 @@ public:
     inline uint32_t getNumTableStates() const { return tableStates.size(); }
     inline NodeTableState* getTableState(uint32_t idx) const { return tableStates[idx].get(); }
 
+    inline void addJoinKeyFilter(std::shared_ptr<JoinKeyFilter> filter) {
+        joinKeyFilters.push_back(std::move(filter));
+    }
+    inline const std::vector<std::shared_ptr<JoinKeyFilter>>& getJoinKeyFilters() const {
+        return joinKeyFilters;
+    }
+
+    // Lookups are only added to scans of a single table.
+    inline void addPropertyIndexLookup(PropertyIndexLookup lookup) {
+        assert(tableStates.size() == 1);
+        propertyIndexLookups.push_back(std::move(lookup));
+    }
+
     inline void initialize(transaction::Transaction* transaction) {
         for (auto& tableState : tableStates) {
             tableState->initializeMaxOffset(transaction);
         }
+        if (!propertyIndexLookups.empty()) {
+            lookupPropertyIndexes(transaction);
+        }
     }
 
     std::tuple<NodeTableState*, common::offset_t, common::offset_t> getNextRangeToRead();
 
 private:
+    void lookupPropertyIndexes(transaction::Transaction* transaction);
+
+private:
+    // Restricting the scan to the nodes returned by index lookups only pays off if they are a
+    // small fraction of the table.
+    static constexpr uint64_t MIN_INDEX_SELECTIVITY_RATIO = 4;
+
     std::mutex mtx;
     std::vector<std::unique_ptr<NodeTableState>> tableStates;
     uint32_t currentStateIdx;
+    // Filters pushed down from the build side of inner hash joins consuming this scan.
+    std::vector<std::shared_ptr<JoinKeyFilter>> joinKeyFilters;
+    std::vector<PropertyIndexLookup> propertyIndexLookups;
 };
 
 class ScanNodeID : public PhysicalOperator {
@@ -130,6 +205,7 @@ public:
           outDataPos{outDataPos}, sharedState{std::move(sharedState)} {}
 
     bool isSource() const override { return true; }
+    bool isMorselDrivenSource() const override { return true; }
 
     inline ScanNodeIDSharedState* getSharedState() const { return sharedState.get(); }
 
@@ -148,6 +224,9 @@ private:
 
     void setSelVector(
         NodeTableState* tableState, common::offset_t startOffset, common::offset_t endOffset);
+    void applyJoinKeyFilters(NodeTableState* tableState);
+    void applyCandidateNodes(
+        NodeTableState* tableState, common::offset_t startOffset, common::offset_t endOffset);
 
 private:
     DataPos outDataPos;
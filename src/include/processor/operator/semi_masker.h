@@ -40,9 +40,8 @@ public:
 
 private:
     // Multiple maskers can point to the same SemiMask, thus we associate each masker with an idx
-    // to indicate the execution sequence of its pipeline. Also, the maskerIdx is used as a flag to
-    // indicate if a value in the mask is masked or not, as each masker will increment the selected
-    // value in the mask by 1. More details are described in NodeTableSemiMask.
+    // to indicate the execution sequence of its pipeline. Each masker only sets nodes that are set
+    // by its predecessor. More details are described in NodeTableSemiMask.
     std::pair<uint8_t, NodeTableSemiMask*> maskerIdxAndMask;
 };
 
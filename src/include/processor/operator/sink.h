@@ -24,18 +24,34 @@ public:
 
     inline void execute(ResultSet* resultSet, ExecutionContext* context) {
         initLocalState(resultSet, context);
-        metrics->executionTime.start();
+        metrics->start();
         executeInternal(context);
-        metrics->executionTime.stop();
+        metrics->stop();
     }
 
     virtual void finalize(ExecutionContext* context){};
 
+    // Records the wall time of the pipeline this sink terminates and the time its task waited in
+    // the task scheduler before a thread picked it up.
+    void recordPipelineTimes(common::Profiler* profiler, uint64_t waitTicks, uint64_t wallTicks);
+
+    // A sink additionally reports the times of its pipeline: wall time, time waiting in the task
+    // scheduler and time spent by each thread.
+    std::unordered_map<std::string, std::string> getProfilerKeyValAttributes(
+        common::Profiler& profiler) const override;
+
     std::unique_ptr<PhysicalOperator> clone() override = 0;
 
 protected:
     virtual void executeInternal(ExecutionContext* context) = 0;
 
+    inline std::string getPipelineWaitTimeMetricKey() const {
+        return "pipelineWaitTime-" + std::to_string(id);
+    }
+    inline std::string getPipelineWallTimeMetricKey() const {
+        return "pipelineWallTime-" + std::to_string(id);
+    }
+
     bool getNextTuplesInternal() final {
         throw common::InternalException(
             "getNextTupleInternal() should not be called on sink operator.");
@@ -32,6 +32,7 @@ protected:
                                                            std::move(colIndicesToScan)} {}
 
     inline bool isSource() const override { return true; }
+    inline bool isMorselDrivenSource() const override { return true; }
 
     virtual void setMaxMorselSize() = 0;
     virtual std::unique_ptr<FTableScanMorsel> getMorsel() = 0;
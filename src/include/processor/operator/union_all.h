@@ -0,0 +1,103 @@
+#pragma once
+
+#include "processor/operator/physical_operator.h"
+#include "processor/result/result_set_descriptor.h"
+
+namespace kuzu {
+namespace processor {
+
+struct UnionAllBranchInfo {
+    // Layout of the result set the branch pipeline writes to.
+    std::unique_ptr<ResultSetDescriptor> resultSetDescriptor;
+    // Positions of the vectors to union in that result set, in the order of the output vectors.
+    std::vector<DataPos> inVecPositions;
+
+    UnionAllBranchInfo(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
+        std::vector<DataPos> inVecPositions)
+        : resultSetDescriptor{std::move(resultSetDescriptor)}, inVecPositions{
+                                                                   std::move(inVecPositions)} {}
+    UnionAllBranchInfo(const UnionAllBranchInfo& other)
+        : resultSetDescriptor{other.resultSetDescriptor->copy()}, inVecPositions{
+                                                                      other.inVecPositions} {}
+};
+
+class UnionAllSharedState {
+public:
+    UnionAllSharedState() : nextBranchToStart{0} {}
+
+    // Threads start from different branches so that all branches produce tuples from the start.
+    inline uint64_t getBranchToStart(uint64_t numBranches) {
+        return nextBranchToStart.fetch_add(1) % numBranches;
+    }
+
+private:
+    std::atomic<uint64_t> nextBranchToStart;
+};
+
+/**
+ * Streams the tuples of its branches to the rest of the pipeline, so that no branch is
+ * materialized before the union starts. Each branch is a pipeline with its own result set, and
+ * every thread pulls a branch until it is exhausted before moving to the next one. Tuples are
+ * copied into the output vectors.
+ *
+ * The output schema of a union follows its first branch. This operator requires every branch to
+ * agree with it on which expressions share an unflat data chunk (see PlanMapper), so that a tuple
+ * of a branch maps to a tuple of the output. Otherwise, the union is executed by UnionAllScan over
+ * the materialized branches. If all expressions are flat, consecutive tuples of a branch are
+ * batched into one output vector.
+ */
+class UnionAll : public PhysicalOperator {
+public:
+    UnionAll(std::vector<DataPos> outVecPositions,
+        std::vector<std::unique_ptr<UnionAllBranchInfo>> branchInfos,
+        bool batchFlatTuples, std::shared_ptr<UnionAllSharedState> sharedState,
+        std::vector<std::unique_ptr<PhysicalOperator>> children, uint32_t id,
+        const std::string& paramsString)
+        : PhysicalOperator{PhysicalOperatorType::UNION_ALL, std::move(children), id, paramsString},
+          outVecPositions{std::move(outVecPositions)}, branchInfos{std::move(branchInfos)},
+          batchFlatTuples{batchFlatTuples}, sharedState{std::move(sharedState)} {}
+
+    // Branches are pulled by the union and initialized with their own result sets.
+    inline bool isSource() const override { return true; }
+
+    void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
+
+    bool getNextTuplesInternal() override;
+
+    std::unique_ptr<PhysicalOperator> clone() override;
+
+private:
+    // Returns the number of output tuples, or 0 if the branch is exhausted.
+    uint64_t pullTuple(uint64_t branchIdx);
+    // Pulls up to a vector of flat tuples from the branch.
+    uint64_t pullFlatTuples(uint64_t branchIdx);
+    void markBranchExhausted(uint64_t branchIdx);
+
+    // Copies the current tuple of the branch to the output. Flat values are written at outPos.
+    void copyTuple(uint64_t branchIdx, common::sel_t outPos);
+    static void copyFlatValue(const common::ValueVector& inVector, common::ValueVector& outVector,
+        common::sel_t outPos);
+    static void copyUnflatValues(
+        const common::ValueVector& inVector, common::ValueVector& outVector);
+
+private:
+    std::vector<DataPos> outVecPositions;
+    std::vector<std::unique_ptr<UnionAllBranchInfo>> branchInfos;
+    // Whether all expressions are flat, in which case the output is a single unflat data chunk.
+    bool batchFlatTuples;
+    std::shared_ptr<UnionAllSharedState> sharedState;
+
+    std::vector<common::ValueVector*> outVectors;
+    std::vector<common::DataChunkState*> unflatOutStates;
+    std::vector<std::unique_ptr<ResultSet>> branchResultSets;
+    std::vector<std::vector<common::ValueVector*>> branchVectors;
+    uint64_t currentBranchIdx;
+    std::vector<bool> isBranchExhausted;
+    uint64_t numExhaustedBranches;
+    // In batching mode, whether the current tuple of the current branch was pulled but did not fit
+    // into the previous batch.
+    bool hasPendingTuple;
+};
+
+} // namespace processor
+} // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "expression_evaluator/base_evaluator.h"
 #include "processor/operator/physical_operator.h"
+#include "storage/index/property_index.h"
 #include "storage/storage_structure/column.h"
 #include "storage/store/rel_table.h"
 
@@ -10,15 +11,17 @@ namespace processor {
 
 struct SetNodePropertyInfo {
     storage::Column* column;
+    // Index over the column, or nullptr if the property is not indexed.
+    storage::PropertyIndex* index;
     DataPos nodeIDPos;
     std::unique_ptr<evaluator::BaseExpressionEvaluator> evaluator;
 
-    SetNodePropertyInfo(storage::Column* column, const DataPos& nodeIDPos,
-        std::unique_ptr<evaluator::BaseExpressionEvaluator> evaluator)
-        : column{column}, nodeIDPos{nodeIDPos}, evaluator{std::move(evaluator)} {}
+    SetNodePropertyInfo(storage::Column* column, storage::PropertyIndex* index,
+        const DataPos& nodeIDPos, std::unique_ptr<evaluator::BaseExpressionEvaluator> evaluator)
+        : column{column}, index{index}, nodeIDPos{nodeIDPos}, evaluator{std::move(evaluator)} {}
 
     inline std::unique_ptr<SetNodePropertyInfo> clone() const {
-        return make_unique<SetNodePropertyInfo>(column, nodeIDPos, evaluator->clone());
+        return make_unique<SetNodePropertyInfo>(column, index, nodeIDPos, evaluator->clone());
     }
 };
 
@@ -14,9 +14,9 @@ public:
     void run() override;
     void finalizeIfNecessary() override;
 
-private:
     static std::unique_ptr<ResultSet> populateResultSet(
-        Sink* op, storage::MemoryManager* memoryManager);
+        const ResultSetDescriptor* resultSetDescriptor, storage::MemoryManager* memoryManager,
+        common::VectorArena* vectorArena);
 
 private:
     Sink* sink;
@@ -11,7 +11,8 @@ namespace processor {
 class ResultSet {
 
 public:
-    explicit ResultSet(uint32_t numDataChunks) : multiplicity{1}, dataChunks(numDataChunks) {}
+    explicit ResultSet(uint32_t numDataChunks, common::VectorArena* vectorArena = nullptr)
+        : multiplicity{1}, dataChunks(numDataChunks), vectorArena{vectorArena} {}
 
     inline void insert(uint32_t pos, std::shared_ptr<common::DataChunk> dataChunk) {
         assert(dataChunks.size() > pos);
@@ -34,6 +35,9 @@ public:
 public:
     uint64_t multiplicity;
     std::vector<std::shared_ptr<common::DataChunk>> dataChunks;
+    // Arena of the pipeline clone owning the result set. Operators and expression evaluators
+    // allocate their vectors from it. Null if vectors should be allocated from the heap.
+    common::VectorArena* vectorArena;
 };
 
 } // namespace processor
@@ -20,6 +20,16 @@ public:
 
     BufferManagedFileHandle(
         const std::string& path, uint8_t flags, FileVersionedType fileVersionedType);
+    ~BufferManagedFileHandle();
+
+    // Maps the whole file into memory read-only and prefaults it. Pinning a page of a mapped file
+    // returns a pointer into the mapping instead of going through the buffer pool, so the file must
+    // not be modified while it is mapped.
+    void mapReadOnly();
+    inline bool isMapped() const { return mappedFile != nullptr; }
+    inline uint8_t* getMappedPage(common::page_idx_t pageIdx) const {
+        return mappedFile + pageIdx * getPageSize();
+    }
 
     bool acquirePageLock(common::page_idx_t pageIdx, bool block);
     inline void releasePageLock(common::page_idx_t pageIdx) { pageLocks[pageIdx]->clear(); }
@@ -68,6 +78,8 @@ private:
     std::vector<std::unique_ptr<std::atomic<common::page_idx_t>>> pageIdxToFrameMap;
     std::vector<std::vector<common::page_idx_t>> pageVersions;
     std::vector<std::unique_ptr<std::atomic_flag>> pageGroupLocks;
+    uint8_t* mappedFile = nullptr;
+    uint64_t mappedSize = 0;
 };
 } // namespace storage
 } // namespace kuzu
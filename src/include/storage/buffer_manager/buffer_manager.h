@@ -51,14 +51,27 @@ namespace storage {
  * call the common::page_idx_t newPageIdx = fh::addNewPage() function on the FileHandle fh they
  * have, and then call bm::pinWithoutReadingFromFile(fh, newPageIdx), and the BM will not try to
  * read this page from the file (because the page has not yet been written).
+ *
+ * If the database is opened read-only, the BM maps the versioned (i.e., data and index) files it
+ * creates FileHandles for into memory, and pinning a page of such a file returns a pointer into the
+ * mapping directly, without taking page or frame locks or occupying a frame. Unpinning it is a
+ * no-op, and the page can never be written. All files of the database, including the WAL, are then
+ * opened without write access.
  */
 class BufferManager {
 
 public:
-    BufferManager(uint64_t maxSizeForDefaultPagePool, uint64_t maxSizeForLargePagePool);
+    BufferManager(uint64_t maxSizeForDefaultPagePool, uint64_t maxSizeForLargePagePool,
+        bool mapFilesReadOnly = false);
     ~BufferManager();
 
-    uint8_t* pin(BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx);
+    inline uint8_t* pin(BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx) {
+        if (fileHandle.isMapped()) {
+            return pinMappedPage(fileHandle, pageIdx);
+        }
+        return fileHandle.isLargePaged() ? bufferPoolLargePages->pin(fileHandle, pageIdx) :
+                                           bufferPoolDefaultPages->pin(fileHandle, pageIdx);
+    }
 
     // The caller should ensure that the given pageIdx is indeed a new page, so should not be read
     // from disk
@@ -67,6 +80,10 @@ public:
 
     inline uint8_t* pinWithoutAcquiringPageLock(
         BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx, bool doNotReadFromFile) {
+        if (fileHandle.isMapped()) {
+            assert(!doNotReadFromFile);
+            return pinMappedPage(fileHandle, pageIdx);
+        }
         return fileHandle.isLargePaged() ? bufferPoolLargePages->pinWithoutAcquiringPageLock(
                                                fileHandle, pageIdx, doNotReadFromFile) :
                                            bufferPoolDefaultPages->pinWithoutAcquiringPageLock(
@@ -76,9 +93,18 @@ public:
     void setPinnedPageDirty(BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx);
 
     // The function assumes that the requested page is already pinned.
-    void unpin(BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx);
+    inline void unpin(BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx) {
+        if (fileHandle.isMapped()) {
+            return;
+        }
+        return fileHandle.isLargePaged() ? bufferPoolLargePages->unpin(fileHandle, pageIdx) :
+                                           bufferPoolDefaultPages->unpin(fileHandle, pageIdx);
+    }
     inline void unpinWithoutAcquiringPageLock(
         BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx) {
+        if (fileHandle.isMapped()) {
+            return;
+        }
         return fileHandle.isLargePaged() ?
                    bufferPoolLargePages->unpinWithoutAcquiringPageLock(fileHandle, pageIdx) :
                    bufferPoolDefaultPages->unpinWithoutAcquiringPageLock(fileHandle, pageIdx);
@@ -86,6 +112,10 @@ public:
 
     void resize(uint64_t newSizeForDefaultPagePool, uint64_t newSizeForLargePagePool);
 
+    inline uint64_t getMaxSize() const {
+        return bufferPoolDefaultPages->getMaxSize() + bufferPoolLargePages->getMaxSize();
+    }
+
     void removeFilePagesFromFrames(BufferManagedFileHandle& fileHandle);
 
     void flushAllDirtyPagesInFrames(BufferManagedFileHandle& fileHandle);
@@ -97,16 +127,21 @@ public:
 
     // Note: This function is not thread-safe.
     // For files that are managed by BM, their FileHandles should be created through this function.
-    inline std::unique_ptr<BufferManagedFileHandle> getBufferManagedFileHandle(
-        const std::string& filePath, uint8_t flags,
-        BufferManagedFileHandle::FileVersionedType fileVersionedType) {
-        return std::make_unique<BufferManagedFileHandle>(filePath, flags, fileVersionedType);
+    std::unique_ptr<BufferManagedFileHandle> getBufferManagedFileHandle(const std::string& filePath,
+        uint8_t flags, BufferManagedFileHandle::FileVersionedType fileVersionedType);
+
+private:
+    static inline uint8_t* pinMappedPage(
+        BufferManagedFileHandle& fileHandle, common::page_idx_t pageIdx) {
+        common::ResourceCounters::getThreadLocalCounters().numMappedPageAccesses++;
+        return fileHandle.getMappedPage(pageIdx);
     }
 
 private:
     std::shared_ptr<spdlog::logger> logger;
     std::unique_ptr<BufferPool> bufferPoolDefaultPages;
     std::unique_ptr<BufferPool> bufferPoolLargePages;
+    bool mapFilesReadOnly;
 };
 
 } // namespace storage
@@ -91,6 +91,8 @@ public:
 
     void resize(uint64_t newSize);
 
+    inline uint64_t getMaxSize() const { return numFrames * pageSize; }
+
     // Note: These two functions that remove pages from frames is not designed for concurrency and
     // therefore not tested under concurrency. If this is called while other threads are accessing
     // the BM, it should work safely but this is not tested.
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -11,16 +12,47 @@
 namespace kuzu {
 namespace storage {
 
+// Tracks the intermediate memory held by a query and enforces the memory limit of the query. It is
+// shared by the memory blocks of the query, so blocks outliving the query (e.g. its result) can
+// still release their memory.
+class QueryMemoryTracker {
+public:
+    explicit QueryMemoryTracker(uint64_t memoryLimitInBytes)
+        : memoryLimitInBytes{memoryLimitInBytes}, numBytesHeld{0} {}
+
+    void allocate(uint64_t numBytes);
+    inline void free(uint64_t numBytes) { numBytesHeld.fetch_sub(numBytes); }
+
+private:
+    uint64_t memoryLimitInBytes;
+    std::atomic<uint64_t> numBytesHeld;
+};
+
+// Charges the memory blocks allocated by the current thread to the given tracker while in scope.
+class ThreadMemoryTrackerGuard {
+public:
+    explicit ThreadMemoryTrackerGuard(std::shared_ptr<QueryMemoryTracker> memoryTracker);
+    ~ThreadMemoryTrackerGuard();
+};
+
 struct MemoryBlock {
 
 public:
-    explicit MemoryBlock(common::page_idx_t pageIdx, uint8_t* data)
-        : size(common::BufferPoolConstants::LARGE_PAGE_SIZE), pageIdx(pageIdx), data(data) {}
+    explicit MemoryBlock(common::page_idx_t pageIdx, uint8_t* data,
+        std::shared_ptr<QueryMemoryTracker> memoryTracker = nullptr)
+        : size(common::BufferPoolConstants::LARGE_PAGE_SIZE), pageIdx(pageIdx), data(data),
+          memoryTracker{std::move(memoryTracker)} {}
+    ~MemoryBlock() {
+        if (memoryTracker != nullptr) {
+            memoryTracker->free(size);
+        }
+    }
 
 public:
     uint64_t size;
     common::page_idx_t pageIdx;
     uint8_t* data;
+    std::shared_ptr<QueryMemoryTracker> memoryTracker;
 };
 
 // Memory manager for allocating/reclaiming large intermediate memory blocks. It can allocate a
@@ -36,12 +68,14 @@ public:
             BufferManagedFileHandle::FileVersionedType::NON_VERSIONED_FILE);
     }
 
+    // Blocks are charged to the memory tracker of the calling thread, if set.
     std::unique_ptr<MemoryBlock> allocateBlock(bool initializeToZero = false);
 
     void freeBlock(common::page_idx_t pageIdx);
 
     inline BufferManager* getBufferManager() const { return bm; }
 
+
 private:
     std::unique_ptr<BufferManagedFileHandle> fh;
     BufferManager* bm;
@@ -46,6 +46,9 @@ private:
         const std::vector<std::shared_ptr<T>>& arrow_columns, uint64_t nodeOffset,
         uint64_t bufferOffset, common::CopyDescription& copyDescription);
 
+    // Writes the index file of an indexed property from the populated column.
+    static void buildPropertyIndex(CopyNodeArrow* copier, const catalog::Property& property);
+
     template<typename T>
     static void populatePKIndex(InMemColumn* column, HashIndexBuilder<T>* pkIndex,
         common::offset_t startOffset, uint64_t numValues);
@@ -8,9 +8,66 @@ namespace kuzu {
 namespace storage {
 
 class CopyRelArrow : public CopyStructuresArrow {
-    enum class PopulateTaskType : uint8_t {
-        populateAdjColumnsAndCountRelsInAdjListsTask = 0,
-        populateListsTask = 1
+    // Rels of one block of the input, with their bound node offsets resolved and their properties
+    // parsed into the element format of lists. Blocks are filled by the single pass over the input,
+    // which populates columns and counts list sizes, so that lists can be populated afterwards
+    // without reading, parsing and looking up the input again. Blocks stay in memory as long as
+    // they fit in the memory budget of the copier. A block that does not fit is spilled to a
+    // temporary file once filled and only loaded back while its rels are put into lists.
+    //
+    // The block is a single buffer holding the bound node offsets of each direction, then a null
+    // bitmap per property, then the values of each property. The internal rel id is not stored, as
+    // it is startRelID + pos.
+    class RelsBlock {
+    public:
+        RelsBlock(uint64_t numRels, common::offset_t startRelID,
+            const std::vector<catalog::Property>& properties, bool resident, uint64_t fileOffset);
+
+        static uint64_t getNumBytes(
+            uint64_t numRels, const std::vector<catalog::Property>& properties);
+
+        inline common::offset_t* getBoundNodeOffsets(common::RelDirection relDirection) {
+            return (common::offset_t*)buffer.get() + relDirection * numRels;
+        }
+        inline uint8_t* getPropertyValues(uint32_t propertyIdx) {
+            return buffer.get() + valuesOffsetPerProperty[propertyIdx];
+        }
+        inline bool isNull(uint32_t propertyIdx, uint64_t pos) {
+            return getNullEntries(propertyIdx)[pos >> 6] & ((uint64_t)1 << (pos & 63));
+        }
+        inline void setNonNull(uint32_t propertyIdx, uint64_t pos) {
+            getNullEntries(propertyIdx)[pos >> 6] &= ~((uint64_t)1 << (pos & 63));
+        }
+
+        // Allocates the buffer of the block when it starts being filled.
+        void allocate();
+        // Writes the block to its position in the spill file and releases its buffer.
+        void spill(common::FileInfo* spillFile);
+        // Allocates the buffer again and reads the block back from the spill file.
+        void load(common::FileInfo* spillFile);
+        inline void release() { buffer.reset(); }
+        inline bool isResident() const { return resident; }
+
+    private:
+        inline uint64_t* getNullEntries(uint32_t propertyIdx) {
+            return (uint64_t*)(buffer.get() + nullsOffsetPerProperty[propertyIdx]);
+        }
+
+    public:
+        uint64_t numRels;
+        common::offset_t startRelID;
+
+    private:
+        // Whether the block stays in memory until its rels are put into lists, or is spilled.
+        bool resident;
+        uint64_t fileOffset;
+        uint64_t numBytes;
+        uint64_t nullsStartOffset;
+        uint64_t nullsEndOffset;
+        // Indexed by property id. Offsets in the buffer.
+        std::vector<uint64_t> nullsOffsetPerProperty;
+        std::vector<uint64_t> valuesOffsetPerProperty;
+        std::unique_ptr<uint8_t[]> buffer;
     };
 
 public:
@@ -19,13 +76,21 @@ public:
         std::map<common::table_id_t, common::offset_t> maxNodeOffsetsPerNodeTable,
         BufferManager* bufferManager, common::table_id_t tableID, RelsStatistics* relsStatistics);
 
-private:
-    static std::string getTaskTypeName(PopulateTaskType populateTaskType);
+    ~CopyRelArrow() override;
+
+    // Wall time in milliseconds of each phase of the copy, in the order they ran.
+    inline const std::vector<std::pair<std::string, double>>& getPhaseTimesMS() const {
+        return phaseTimesMS;
+    }
 
+private:
     inline void updateTableStatistics() override {
         relsStatistics->setNumRelsForTable(tableSchema->tableID, numRows);
     }
 
+    // Rels are counted while they are populated, so the input is not read upfront to count lines.
+    void populateInMemoryStructures() override;
+
     void initializeColumnsAndLists() override;
 
     void populateColumnsAndLists() override;
@@ -42,18 +107,28 @@ private:
 
     void initializePkIndexes(common::table_id_t nodeTableID, BufferManager& bufferManager);
 
-    arrow::Status executePopulateTask(PopulateTaskType populateTaskType);
+    arrow::Status executePopulateTask();
+
+    arrow::Status populateFromCSV();
+
+    arrow::Status populateFromArrow();
 
-    arrow::Status populateFromCSV(PopulateTaskType populateTaskType);
+    arrow::Status populateFromParquet();
 
-    arrow::Status populateFromArrow(PopulateTaskType populateTaskType);
+    // Returns the block to buffer the rels starting at startRelID into, or nullptr if there are no
+    // lists to populate. Blocks are added in the order of the input, which is also the order of the
+    // spilled ones in the spill file.
+    RelsBlock* addRelsBlock(uint64_t numRels, common::offset_t startRelID);
 
-    arrow::Status populateFromParquet(PopulateTaskType populateTaskType);
+    void removeSpillFile();
 
     void populateAdjColumnsAndCountRelsInAdjLists();
 
     void populateLists();
 
+    template<typename F>
+    void runPhase(const std::string& phaseName, F&& phase);
+
     // We store rel properties with overflows, e.g., strings or lists, in
     // InMemColumn/ListsWithOverflowFile (e.g., InMemStringLists). When loading these properties
     // from csv, we first save the overflow pointers of the ku_list_t or ku_string_t in temporary
@@ -70,24 +145,26 @@ private:
     // disk.
     void sortAndCopyOverflowValues();
 
+    // Looks up the keys of the bound nodes of all rels in a block, one key column at a time, and
+    // writes their offsets to nodeOffsetsPerDirection.
     template<typename T>
-    static void inferTableIDsAndOffsets(const std::vector<std::shared_ptr<T>>& batchColumns,
-        std::vector<common::nodeID_t>& nodeIDs, std::vector<common::DataType>& nodeIDTypes,
+    static void lookupNodeOffsets(const std::vector<std::shared_ptr<T>>& batchColumns,
+        uint64_t numRels, const std::vector<common::DataType>& nodePKTypes,
+        const std::vector<common::table_id_t>& nodeTableIDs,
         const std::map<common::table_id_t, std::unique_ptr<PrimaryKeyIndex>>& pkIndexes,
-        transaction::Transaction* transaction, int64_t blockOffset, int64_t& colIndex);
+        transaction::Transaction* transaction, common::offset_t** nodeOffsetsPerDirection);
 
+    // Parses the properties of a rel, puts them into property columns and, if relsBlock is not
+    // nullptr, buffers them into relsBlock for lists.
     template<typename T>
-    static void putPropsOfLineIntoColumns(CopyRelArrow* copier,
+    static void putPropsOfLine(CopyRelArrow* copier,
         std::vector<PageByteCursor>& inMemOverflowFileCursors,
         const std::vector<std::shared_ptr<T>>& batchColumns,
-        const std::vector<common::nodeID_t>& nodeIDs, int64_t blockOffset, int64_t& colIndex);
+        const std::vector<common::nodeID_t>& nodeIDs, int64_t blockOffset, RelsBlock* relsBlock);
 
-    template<typename T>
-    static void putPropsOfLineIntoLists(CopyRelArrow* copier,
-        std::vector<PageByteCursor>& inMemOverflowFileCursors,
-        const std::vector<std::shared_ptr<T>>& batchColumns,
-        const std::vector<common::nodeID_t>& nodeIDs, const std::vector<uint64_t>& reversePos,
-        int64_t blockOffset, int64_t& colIndex, common::CopyDescription& copyDescription);
+    static void putPropertyValue(CopyRelArrow* copier, uint64_t propertyIdx,
+        const std::vector<common::nodeID_t>& nodeIDs, int64_t blockOffset, RelsBlock* relsBlock,
+        uint8_t* val);
 
     static void copyStringOverflowFromUnorderedToOrderedPages(common::ku_string_t* kuStr,
         PageByteCursor& unorderedOverflowCursor, PageByteCursor& orderedOverflowCursor,
@@ -100,13 +177,11 @@ private:
 
     // Concurrent tasks.
     template<typename T>
-    static void populateAdjColumnsAndCountRelsInAdjListsTask(uint64_t blockIdx,
-        uint64_t blockStartRelID, CopyRelArrow* copier,
-        const std::vector<std::shared_ptr<T>>& batchColumns, const std::string& filePath);
+    static void populateAdjColumnsAndCountRelsInAdjListsTask(uint64_t blockStartRelID,
+        uint64_t numRelsInBlock, CopyRelArrow* copier,
+        const std::vector<std::shared_ptr<T>>& batchColumns, RelsBlock* relsBlock);
 
-    template<typename T>
-    static void populateListsTask(uint64_t blockId, uint64_t blockStartRelID, CopyRelArrow* copier,
-        const std::vector<std::shared_ptr<T>>& batchColumns, const std::string& filePath);
+    static void populateListsTask(CopyRelArrow* copier, RelsBlock* relsBlock);
 
     static void sortOverflowValuesOfPropertyColumnTask(const common::DataType& dataType,
         common::offset_t offsetStart, common::offset_t offsetEnd, InMemColumn* propertyColumn,
@@ -150,7 +225,6 @@ private:
     RelsStatistics* relsStatistics;
     std::unique_ptr<transaction::Transaction> dummyReadOnlyTrx;
     std::map<common::table_id_t, std::unique_ptr<PrimaryKeyIndex>> pkIndexes;
-    std::atomic<uint64_t> numRels = 0;
     std::vector<std::unique_ptr<atomic_uint64_vec_t>> listSizesPerDirection{2};
     std::vector<std::unique_ptr<InMemAdjColumn>> adjColumnsPerDirection{2};
     std::vector<std::unordered_map<common::property_id_t, std::unique_ptr<InMemColumn>>>
@@ -160,6 +234,13 @@ private:
         propertyListsPerDirection{2};
     std::unordered_map<common::property_id_t, std::unique_ptr<InMemOverflowFile>>
         overflowFilePerPropertyID;
+    std::vector<std::unique_ptr<RelsBlock>> relsBlocks;
+    uint64_t relsBlocksMemoryBudget;
+    // Bytes of the blocks that are kept in memory, which is at most relsBlocksMemoryBudget.
+    uint64_t numBytesOfResidentRelsBlocks = 0;
+    std::unique_ptr<common::FileInfo> spillFile;
+    uint64_t spillFileSize = 0;
+    std::vector<std::pair<std::string, double>> phaseTimesMS;
 };
 
 } // namespace storage
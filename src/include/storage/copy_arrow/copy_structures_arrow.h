@@ -51,7 +51,7 @@ protected:
 
     virtual void saveToFile() = 0;
 
-    void populateInMemoryStructures();
+    virtual void populateInMemoryStructures();
 
     void countNumLines(const std::vector<std::string>& filePath);
 
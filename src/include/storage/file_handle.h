@@ -23,6 +23,8 @@ public:
     constexpr static uint8_t isNewInMemoryTmpFileMask{0b0000'0010}; // represents 2nd LSB
     // createIfNotExistsMask only applies to existing db files; tmp i-memory files are not created
     constexpr static uint8_t createIfNotExistsMask{0b0000'0100}; // represents 3rd LSB
+    // readOnlyMask only applies to existing db files, which are then opened without write access
+    constexpr static uint8_t readOnlyMask{0b0000'1000}; // represents 4th LSB
 
     constexpr static uint8_t O_PERSISTENT_FILE_NO_CREATE{0b0000'0000};
     constexpr static uint8_t O_PERSISTENT_FILE_CREATE_NOT_EXISTS{0b0000'0100};
@@ -44,6 +46,7 @@ public:
     inline bool isLargePaged() const { return flags & isLargePagedMask; }
     inline bool isNewTmpFile() const { return flags & isNewInMemoryTmpFileMask; }
     inline bool createFileIfNotExists() const { return flags & createIfNotExistsMask; }
+    inline bool isReadOnly() const { return flags & readOnlyMask; }
 
     inline common::page_idx_t getNumPages() const { return numPages; }
     inline common::FileInfo* getFileInfo() const { return fileInfo.get(); }
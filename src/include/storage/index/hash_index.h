@@ -98,7 +98,7 @@ public:
 private:
     template<ChainedSlotsAction action>
     bool performActionInChainedSlots(transaction::TransactionType trxType, HashIndexHeader& header,
-        SlotInfo& slotInfo, const uint8_t* key, common::offset_t& result);
+        SlotInfo& slotInfo, const uint8_t* key, uint8_t fingerprint, common::offset_t& result);
     bool lookupInPersistentIndex(
         transaction::TransactionType trxType, const uint8_t* key, common::offset_t& result);
     // The following two functions are only used in prepareCommit, and are not thread-safe.
@@ -106,18 +106,18 @@ private:
     void deleteFromPersistentIndex(const uint8_t* key);
 
     void copyAndUpdateSlotHeader(bool isCopyEntry, Slot<T>& slot, entry_pos_t entryPos,
-        const uint8_t* key, common::offset_t value);
+        const uint8_t* key, uint8_t fingerprint, common::offset_t value);
     void copyKVOrEntryToSlot(bool isCopyEntry, const SlotInfo& slotInfo, Slot<T>& slot,
-        const uint8_t* key, common::offset_t value);
+        const uint8_t* key, uint8_t fingerprint, common::offset_t value);
     void splitSlot(HashIndexHeader& header);
     void rehashSlots(HashIndexHeader& header);
     std::vector<std::pair<SlotInfo, Slot<T>>> getChainedSlots(slot_id_t pSlotId);
-    void copyEntryToSlot(slot_id_t slotId, uint8_t* entry);
+    void copyEntryToSlot(slot_id_t slotId, uint8_t* entry, uint8_t fingerprint);
 
     void prepareCommit();
 
-    entry_pos_t findMatchedEntryInSlot(
-        transaction::TransactionType trxType, const Slot<T>& slot, const uint8_t* key) const;
+    entry_pos_t findMatchedEntryInSlot(transaction::TransactionType trxType, const Slot<T>& slot,
+        const uint8_t* key, uint8_t fingerprint) const;
 
     void loopChainedSlotsToFindOneWithFreeSpace(SlotInfo& slotInfo, Slot<T>& slot);
 
@@ -31,9 +31,13 @@ static constexpr uint64_t INDEX_HEADER_IDX_IN_ARRAY = 0;
  * slot is given by HashIndexConstants::SLOT_CAPACITY. The size of the slot is given by
  * (sizeof(SlotHeader) + (SLOT_CAPACITY * sizeof(Entry)).
  *
- * SlotHeader: [numEntries, validityMask, nextOvfSlotId]
+ * SlotHeader: [numEntries, validityMask, fingerprints, nextOvfSlotId]
  * Entry: [key (fixed sized part), node_offset]
  *
+ * The fingerprint of an entry is the highest byte of the hash of its key, which is never used to
+ * pick a slot. Lookups first match fingerprints (see SlotHeader::getMatchingEntriesMask), so keys,
+ * and for strings their overflow pages, are only read for entries that most likely match.
+ *
  * 3. oSlots are used to store entries that comes to the designated primary slot that has already
  * been filled to the capacity. Several overflow slots can be chained after the single primary slot
  * as a singly linked link-list. Each slot's SlotHeader has information about the next overflow slot
@@ -57,7 +61,17 @@ public:
     virtual ~BaseHashIndex() = default;
 
 protected:
-    slot_id_t getPrimarySlotIdForKey(const HashIndexHeader& indexHeader, const uint8_t* key);
+    static inline slot_id_t getPrimarySlotIdForHash(
+        const HashIndexHeader& indexHeader, common::hash_t hash) {
+        auto slotId = hash & indexHeader.levelHashMask;
+        if (slotId < indexHeader.nextSplitSlotId) {
+            slotId = hash & indexHeader.higherLevelHashMask;
+        }
+        return slotId;
+    }
+    static inline uint8_t getFingerprintForHash(common::hash_t hash) {
+        return hash >> ((sizeof(common::hash_t) - sizeof(uint8_t)) * 8);
+    }
 
     static inline uint64_t getNumRequiredEntries(
         uint64_t numExistingEntries, uint64_t numNewEntries) {
@@ -100,9 +114,10 @@ private:
     bool lookupInternalWithoutLock(const uint8_t* key, common::offset_t& result);
 
     template<bool IS_LOOKUP>
-    bool lookupOrExistsInSlotWithoutLock(
-        Slot<T>* slot, const uint8_t* key, common::offset_t* result = nullptr);
-    void insertToSlotWithoutLock(Slot<T>* slot, const uint8_t* key, common::offset_t value);
+    bool lookupOrExistsInSlotWithoutLock(Slot<T>* slot, const uint8_t* key, uint8_t fingerprint,
+        common::offset_t* result = nullptr);
+    void insertToSlotWithoutLock(
+        Slot<T>* slot, const uint8_t* key, uint8_t fingerprint, common::offset_t value);
     Slot<T>* getSlot(const SlotInfo& slotInfo);
     uint32_t allocatePSlots(uint32_t numSlotsToAllocate);
     uint32_t allocateAOSlot();
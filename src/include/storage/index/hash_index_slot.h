@@ -12,15 +12,26 @@ namespace storage {
 using entry_pos_t = uint8_t;
 using slot_id_t = uint64_t;
 
+// Besides the validity of entries, the header keeps a 1-byte fingerprint of the hash of every
+// entry's key, packed in one word. Probes compare the fingerprint of the key to look up with all
+// fingerprints of the slot at once, and only call the (possibly overflow-file reading) key equality
+// function on entries whose fingerprint matches.
 class SlotHeader {
+    static_assert(common::HashIndexConstants::SLOT_CAPACITY == sizeof(uint64_t));
+    static constexpr uint64_t LOW_BITS_OF_BYTES = 0x0101010101010101;
+    static constexpr uint64_t LOW_7_BITS_OF_BYTES = 0x7F7F7F7F7F7F7F7F;
+    // Gathers the high bit of byte i to bit 56 + i.
+    static constexpr uint64_t HIGH_BITS_GATHER_MULTIPLIER = 0x0102040810204080;
+
 public:
     static const entry_pos_t INVALID_ENTRY_POS = UINT8_MAX;
 
-    SlotHeader() : numEntries{0}, validityMask{0}, nextOvfSlotId{0} {}
+    SlotHeader() : numEntries{0}, validityMask{0}, fingerprints{0}, nextOvfSlotId{0} {}
 
     void reset() {
         numEntries = 0;
         validityMask = 0;
+        fingerprints = 0;
         nextOvfSlotId = 0;
     }
 
@@ -32,9 +43,25 @@ public:
         validityMask &= ~((uint32_t)1 << entryPos);
     }
 
+    inline void setFingerprint(entry_pos_t entryPos, uint8_t fingerprint) {
+        fingerprints &= ~((uint64_t)UINT8_MAX << (entryPos * 8));
+        fingerprints |= (uint64_t)fingerprint << (entryPos * 8);
+    }
+    // Returns a mask with bit i set if entry i is valid and has the given fingerprint.
+    inline uint32_t getMatchingEntriesMask(uint8_t fingerprint) const {
+        auto diff = fingerprints ^ (fingerprint * LOW_BITS_OF_BYTES);
+        // The high bit of a byte is set iff the byte of diff is zero. Unlike the usual "has zero
+        // byte" trick, no carry crosses byte boundaries, so there are no false positives.
+        auto zeroBytes =
+            ~(((diff & LOW_7_BITS_OF_BYTES) + LOW_7_BITS_OF_BYTES) | diff | LOW_7_BITS_OF_BYTES);
+        auto mask = (uint32_t)(((zeroBytes >> 7) * HIGH_BITS_GATHER_MULTIPLIER) >> 56);
+        return mask & validityMask;
+    }
+
 public:
     entry_pos_t numEntries;
     uint32_t validityMask;
+    uint64_t fingerprints;
     slot_id_t nextOvfSlotId;
 };
 
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <mutex>
+#include <set>
+
+#include "common/expression_type.h"
+#include "storage/storage_structure/column.h"
+#include "storage/storage_structure/disk_array.h"
+
+namespace kuzu {
+namespace storage {
+
+static constexpr common::page_idx_t PROPERTY_INDEX_HEADER_ARRAY_HEADER_PAGE_IDX = 0;
+static constexpr common::page_idx_t MAIN_ENTRIES_HEADER_PAGE_IDX = 1;
+static constexpr common::page_idx_t DELTA_ENTRIES_HEADER_PAGE_IDX = 2;
+static constexpr uint64_t PROPERTY_INDEX_HEADER_IDX_IN_ARRAY = 0;
+
+// Keys are order-preserving 8-byte encodings of property values, see PropertyIndex::encodeKey().
+struct PropertyIndexEntry {
+    uint64_t key;
+    common::offset_t nodeOffset;
+
+    inline bool operator<(const PropertyIndexEntry& rhs) const {
+        return key < rhs.key || (key == rhs.key && nodeOffset < rhs.nodeOffset);
+    }
+};
+
+// Disk arrays cannot shrink, so the header keeps the number of entries in use in each array.
+struct PropertyIndexHeader {
+    uint64_t numMainEntries = 0;
+    uint64_t numDeltaEntries = 0;
+};
+
+// Writes a new property index file whose main entries are the appended entries.
+class PropertyIndexBuilder {
+public:
+    explicit PropertyIndexBuilder(const std::string& fName);
+
+    inline void append(uint64_t key, common::offset_t nodeOffset) {
+        entries.push_back(PropertyIndexEntry{key, nodeOffset});
+    }
+
+    void flush();
+
+private:
+    std::unique_ptr<FileHandle> fileHandle;
+    std::unique_ptr<InMemDiskArrayBuilder<PropertyIndexHeader>> headerArray;
+    std::unique_ptr<InMemDiskArrayBuilder<PropertyIndexEntry>> mainEntries;
+    std::unique_ptr<InMemDiskArrayBuilder<PropertyIndexEntry>> deltaEntries;
+    std::vector<PropertyIndexEntry> entries;
+};
+
+// An ordered secondary index over a node property column, which answers "property <op> value"
+// lookups for EQUALS and range comparisons without reading the whole column. Null values are not
+// indexed. Values are indexed by an order-preserving 8-byte key, which is exact for numerical and
+// temporal types and is the 8-byte prefix of strings.
+//
+// The index file is built by PropertyIndexBuilder (on CREATE INDEX and COPY) and holds two disk
+// arrays of (key, node offset) entries: the main entries, sorted by key, and the delta entries,
+// appended by later updates. Updates work like the ones of HashIndex. Before a write transaction
+// changes the value of a node, it records the node in the local storage through recordUpdate(),
+// and lookups of the write transaction return recorded nodes as candidates. At prepareCommit, the
+// new values of recorded nodes are appended to the delta entries through the WAL. Once the delta
+// entries outgrow a fraction of the main entries, the main entries are rebuilt from the column
+// instead. Entries of old values are not removed until then, and deleted nodes keep their entries
+// as scans filter them out anyway. Lookups therefore return a superset of the qualifying nodes,
+// and callers still evaluate the predicate.
+class PropertyIndex {
+public:
+    PropertyIndex(const StorageStructureIDAndFName& storageStructureIDAndFName,
+        common::DataType dataType, Column* column, common::table_id_t tableID,
+        BufferManager& bufferManager, WAL* wal);
+
+    static bool isSupportedComparison(common::ExpressionType comparisonType);
+
+    // Values must be non-null and of a supported type.
+    static uint64_t encodeKey(common::DataTypeID typeID, const uint8_t* value);
+    static uint64_t encodeStringKey(const char* data, uint64_t length);
+    static uint64_t encodeKey(const common::Value& value);
+    static uint64_t encodeKey(const common::ValueVector& vector, uint32_t pos);
+
+    // Appends the entries of the nodes in [0, maxNodeOffset] in the given transaction.
+    static void appendEntries(transaction::Transaction* transaction, Column* column,
+        const common::DataType& dataType, common::table_id_t tableID,
+        common::offset_t maxNodeOffset, MemoryManager* memoryManager,
+        std::vector<PropertyIndexEntry>& entries);
+
+    // Returns the sorted offsets of the nodes whose value might satisfy "property <comparisonType>
+    // value" in the given transaction. The value must be non-null and of the property's type.
+    std::vector<common::offset_t> lookup(transaction::Transaction* transaction,
+        common::ExpressionType comparisonType, const common::Value& value);
+
+    void recordUpdate(common::offset_t nodeOffset);
+    inline void recordUpdates(common::ValueVector* nodeIDVector) {
+        for (auto i = 0u; i < nodeIDVector->state->getNumSelectedValues(); ++i) {
+            auto pos = nodeIDVector->state->selVector->selectedPositions[i];
+            if (!nodeIDVector->isNull(pos)) {
+                recordUpdate(nodeIDVector->readNodeOffset(pos));
+            }
+        }
+    }
+
+    // maxNodeOffset is the one of the write transaction.
+    void prepareCommitOrRollbackIfNecessary(bool isCommit, common::offset_t maxNodeOffset);
+    void checkpointInMemoryIfNecessary();
+    void rollbackInMemoryIfNecessary();
+
+    inline BufferManagedFileHandle* getFileHandle() const { return fileHandle.get(); }
+
+private:
+    void prepareCommit(common::offset_t maxNodeOffset);
+    void lookupInEntries(BaseDiskArray<PropertyIndexEntry>& entries, uint64_t numEntries,
+        bool isSorted, uint64_t lowKey, uint64_t highKey, std::vector<common::offset_t>& result);
+    void appendEntriesOfUpdatedNodes(
+        transaction::Transaction* transaction, std::vector<PropertyIndexEntry>& entries);
+    static void writeEntries(BaseDiskArray<PropertyIndexEntry>& diskArray, uint64_t startIdx,
+        const std::vector<PropertyIndexEntry>& entries);
+
+    // The main entries are rebuilt instead of growing the delta entries beyond this.
+    static inline uint64_t getMaxNumDeltaEntries(uint64_t numMainEntries) {
+        return numMainEntries / 8 + common::DEFAULT_VECTOR_CAPACITY;
+    }
+
+private:
+    common::DataType dataType;
+    Column* column;
+    common::table_id_t tableID;
+    BufferManager& bufferManager;
+    WAL* wal;
+    std::unique_ptr<BufferManagedFileHandle> fileHandle;
+    std::unique_ptr<BaseDiskArray<PropertyIndexHeader>> headerArray;
+    std::unique_ptr<BaseDiskArray<PropertyIndexEntry>> mainEntries;
+    std::unique_ptr<BaseDiskArray<PropertyIndexEntry>> deltaEntries;
+    // Local storage: nodes updated by the active write transaction.
+    std::mutex localStorageMtx;
+    std::set<common::offset_t> updatedNodes;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -2,6 +2,7 @@
 
 #include "catalog/catalog.h"
 #include "common/types/value.h"
+#include "storage/storage_structure/column_predicate.h"
 #include "storage/storage_structure/disk_overflow_file.h"
 #include "storage/storage_structure/storage_structure.h"
 
@@ -26,6 +27,12 @@ public:
 
     void writeValues(common::ValueVector* nodeIDVector, common::ValueVector* vectorToWriteFrom);
 
+    // Narrows the selected positions of nodeIDVector to the nodes whose value satisfies the
+    // predicate. Values are compared on the pinned pages and never copied. If nodeIDVector is
+    // flat, its selection is left as is. Returns whether any node is selected.
+    bool select(transaction::Transaction* transaction, common::ValueVector* nodeIDVector,
+        const ColumnPredicate& predicate);
+
     // Currently, used only in CopyCSV tests.
     virtual common::Value readValue(common::offset_t offset);
     bool isNull(common::offset_t nodeOffset, transaction::Transaction* transaction);
@@ -50,6 +57,12 @@ protected:
     WALPageIdxPosInPageAndFrame beginUpdatingPage(common::offset_t nodeOffset,
         common::ValueVector* vectorToWriteFrom, uint32_t posInVectorToWriteFrom);
 
+    inline bool isValueSelected(const uint8_t* frame, uint16_t elemPosInPage,
+        const ColumnPredicate& predicate) const {
+        return !common::NullMask::isNull((uint64_t*)getNullBufferInPage(frame), elemPosInPage) &&
+               predicate.evaluate(frame + mapElementPosToByteOffset(elemPosInPage));
+    }
+
 private:
     // The reason why we make this function virtual is: we can't simply do memcpy on nodeIDs if
     // the adjColumn has tableIDCompression, in this case we only store the nodeOffset in
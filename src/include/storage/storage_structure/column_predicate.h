@@ -0,0 +1,55 @@
+#pragma once
+
+#include "common/expression_type.h"
+#include "common/types/value.h"
+
+namespace kuzu {
+namespace storage {
+
+/**
+ * A comparison of a fixed-size column (INT64, INT32, INT16, DOUBLE, DATE, TIMESTAMP) with a
+ * non-null constant, i.e. "column <op> constant". It is evaluated by Column::select directly on the
+ * bytes of pinned pages, so values of nodes that do not qualify are never copied into a vector.
+ * Null values never qualify.
+ */
+class ColumnPredicate {
+public:
+    ColumnPredicate(common::ExpressionType comparisonType, const common::Value& constant);
+
+    // Writes vectorStartPos + i to selectedPositions for every i in [0, numValues) such that the
+    // i-th value is not null and satisfies the predicate. values and nullEntries are those of a
+    // page, and values[0] is the element at posInPage. Returns the number of selected positions.
+    uint64_t selectValues(const uint8_t* values, const uint64_t* nullEntries, uint64_t posInPage,
+        uint64_t numValues, common::sel_t vectorStartPos,
+        common::sel_t* selectedPositions) const;
+
+    bool evaluate(const uint8_t* value) const;
+
+    static bool isSupportedType(common::DataTypeID typeID);
+
+private:
+    template<typename T>
+    uint64_t selectTypedValues(const T* values, T constantValue, const uint64_t* nullEntries,
+        uint64_t posInPage, uint64_t numValues, common::sel_t vectorStartPos,
+        common::sel_t* selectedPositions) const;
+    template<typename T, typename FUNC>
+    static uint64_t selectTypedValuesWithOp(const T* values, T constantValue,
+        const uint64_t* nullEntries, uint64_t posInPage, uint64_t numValues,
+        common::sel_t vectorStartPos, common::sel_t* selectedPositions);
+    template<typename T>
+    bool evaluateTypedValue(T value, T constantValue) const;
+
+private:
+    common::ExpressionType comparisonType;
+    common::DataTypeID typeID;
+    // DATE and TIMESTAMP constants are stored as their underlying integers.
+    union {
+        int64_t int64Val;
+        int32_t int32Val;
+        int16_t int16Val;
+        double doubleVal;
+    } constant;
+};
+
+} // namespace storage
+} // namespace kuzu
@@ -194,6 +194,10 @@ public:
 
     void readValues(transaction::Transaction* transaction, common::ValueVector* valueVector,
         ListHandle& listHandle) override;
+    // Advances listHandle to the next range of the list exactly as readValues does and sets the size
+    // of valueVector's state to the size of that range, but does not read any nbr node. The sizes
+    // come from the list header and the number of rels inserted in the listsUpdatesStore.
+    void countValues(common::ValueVector* valueVector, ListHandle& listHandle);
 
     // Currently, used only in copyCSV tests.
     std::unique_ptr<std::vector<common::nodeID_t>> readAdjacencyListOfNode(
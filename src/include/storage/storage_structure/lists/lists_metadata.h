@@ -21,14 +21,24 @@ public:
         logger = common::LoggerUtils::getLogger(common::LoggerConstants::LoggerEnum::STORAGE);
     }
 
-    inline static std::function<uint32_t(uint32_t)> getIdxInPageListToListPageIdxMapper(
-        BaseInMemDiskArray<common::page_idx_t>* pageLists, uint32_t pageListsHead) {
-        return std::bind(getPageIdxFromAPageList, pageLists, pageListsHead, std::placeholders::_1);
+    // The returned mapper remembers the page list group of its last lookup, so lookups in
+    // increasing order, as done when a list is scanned page by page, resume walking the chain of
+    // groups from there instead of from the head of the page list. Scanning a large list thus costs
+    // O(1) amortized per page instead of O(idxInPageList).
+    static std::function<uint32_t(uint32_t)> getIdxInPageListToListPageIdxMapper(
+        BaseInMemDiskArray<common::page_idx_t>* pageLists, uint32_t pageListHead);
+
+    // Page lists that have not been updated since they were built have all their groups laid out
+    // contiguously, so the group of idxInPageList can be computed without walking the chain.
+    static inline common::page_idx_t getPageIdxFromAContiguousPageList(
+        BaseInMemDiskArray<common::page_idx_t>* pageLists, uint32_t pageListHead,
+        uint32_t idxInPageList) {
+        return (*pageLists)[pageListHead +
+                            (idxInPageList / common::ListsMetadataConstants::PAGE_LIST_GROUP_SIZE) *
+                                common::ListsMetadataConstants::PAGE_LIST_GROUP_WITH_NEXT_PTR_SIZE +
+                            idxInPageList % common::ListsMetadataConstants::PAGE_LIST_GROUP_SIZE];
     }
 
-    static uint64_t getPageIdxFromAPageList(BaseInMemDiskArray<common::page_idx_t>* pageLists,
-        uint32_t pageListHead, uint32_t idxInPageList);
-
 protected:
     std::shared_ptr<spdlog::logger> logger;
 };
@@ -109,17 +119,16 @@ public:
         return (*largeListIdxToPageListHeadIdxMapBuilder)[(2 * largeListIdx) + 1];
     };
 
-    // Returns a function that can map the logical pageIdx of a chunk ito its corresponding physical
-    // pageIdx in a disk file.
-    inline std::function<uint32_t(uint32_t)> getPageMapperForChunkIdx(uint32_t chunkIdx) {
-        return getIdxInPageListToListPageIdxMapper(
-            pageListsBuilder.get(), (*chunkToPageListHeadIdxMapBuilder)[chunkIdx]);
+    // Maps the logical pageIdx of a chunk to its corresponding physical pageIdx in a disk file.
+    // While building, every page list is contiguous (see populatePageIdsInAPageList).
+    inline common::page_idx_t getPageIdxInChunk(uint32_t chunkIdx, uint32_t idxInPageList) {
+        return getPageIdxFromAContiguousPageList(pageListsBuilder.get(),
+            (*chunkToPageListHeadIdxMapBuilder)[chunkIdx], idxInPageList);
     }
-    // Returns a function that can map the logical pageIdx of a largeList to its corresponding
-    // physical pageIdx in a disk file.
-    inline std::function<uint32_t(uint32_t)> getPageMapperForLargeListIdx(uint32_t largeListIdx) {
-        return getIdxInPageListToListPageIdxMapper(
-            pageListsBuilder.get(), (*largeListIdxToPageListHeadIdxMapBuilder)[2 * largeListIdx]);
+    // Maps the logical pageIdx of a largeList to its corresponding physical pageIdx in a disk file.
+    inline common::page_idx_t getPageIdxInLargeList(uint32_t largeListIdx, uint32_t idxInPageList) {
+        return getPageIdxFromAContiguousPageList(pageListsBuilder.get(),
+            (*largeListIdxToPageListHeadIdxMapBuilder)[2 * largeListIdx], idxInPageList);
     }
     void initChunkPageLists(uint32_t numChunks);
     void initLargeListPageLists(uint32_t numLargeLists);
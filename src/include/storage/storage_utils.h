@@ -97,6 +97,31 @@ public:
         return {StorageStructureID::newNodeIndexID(tableID), fName};
     }
 
+    // Temporary file holding the rels buffered by COPY until they are put into lists.
+    static inline std::string getRelsSpillFName(
+        const std::string& directory, const common::table_id_t& relTableID) {
+        auto fName = common::StringUtils::string_format("r-{}", relTableID);
+        return common::FileUtils::joinPath(
+            directory, fName + common::StorageConstants::SPILL_FILE_SUFFIX);
+    }
+
+    static inline std::string getPropertyIndexFName(const std::string& directory,
+        const common::table_id_t& tableID, uint32_t propertyID, common::DBFileType dbFileType) {
+        auto fName = common::StringUtils::string_format("n-{}-{}", tableID, propertyID);
+        return appendWALFileSuffixIfNecessary(
+            common::FileUtils::joinPath(
+                directory, fName + common::StorageConstants::PROPERTY_INDEX_FILE_SUFFIX),
+            dbFileType);
+    }
+
+    static inline StorageStructureIDAndFName getPropertyIndexIDAndFName(
+        const std::string& directory, const catalog::Property& property) {
+        auto fName = getPropertyIndexFName(
+            directory, property.tableID, property.propertyID, common::DBFileType::ORIGINAL);
+        return {StorageStructureID::newPropertyIndexID(property.tableID, property.propertyID),
+            fName};
+    }
+
     // Returns the StorageStructureIDAndFName for the "base" lists structure/file. Callers need to
     // modify it to obtain versions for METADATA and HEADERS structures/files.
     static inline StorageStructureIDAndFName getAdjListsStructureIDAndFName(
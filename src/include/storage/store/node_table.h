@@ -2,6 +2,7 @@
 
 #include "catalog/catalog.h"
 #include "storage/index/hash_index.h"
+#include "storage/index/property_index.h"
 #include "storage/storage_structure/lists/lists.h"
 #include "storage/store/nodes_statistics_and_deleted_ids.h"
 #include "storage/wal/wal.h"
@@ -28,19 +29,31 @@ public:
 
     void scan(transaction::Transaction* transaction, common::ValueVector* inputIDVector,
         const std::vector<uint32_t>& columnIdxes, std::vector<common::ValueVector*> outputVectors);
+    inline bool select(transaction::Transaction* transaction, common::ValueVector* inputIDVector,
+        uint32_t columnIdx, const ColumnPredicate& predicate) {
+        return propertyColumns.at(columnIdx)->select(transaction, inputIDVector, predicate);
+    }
 
     inline Column* getPropertyColumn(common::property_id_t propertyIdx) {
         assert(propertyColumns.contains(propertyIdx));
         return propertyColumns.at(propertyIdx).get();
     }
     inline PrimaryKeyIndex* getPKIndex() const { return pkIndex.get(); }
+    // Returns nullptr if the property is not indexed.
+    inline PropertyIndex* getPropertyIndex(common::property_id_t propertyID) const {
+        return propertyIndexes.contains(propertyID) ? propertyIndexes.at(propertyID).get() :
+                                                      nullptr;
+    }
+    // Opens the index of the property, whose file is written by CREATE INDEX.
+    void addPropertyIndex(const catalog::Property& property);
     inline NodesStatisticsAndDeletedIDs* getNodeStatisticsAndDeletedIDs() const {
         return nodesStatisticsAndDeletedIDs;
     }
     inline common::table_id_t getTableID() const { return tableID; }
-    inline void checkpointInMemoryIfNecessary() { pkIndex->checkpointInMemoryIfNecessary(); }
-    inline void rollbackInMemoryIfNecessary() { pkIndex->rollbackInMemoryIfNecessary(); }
+    void checkpointInMemoryIfNecessary();
+    void rollbackInMemoryIfNecessary();
     inline void removeProperty(common::property_id_t propertyID) {
+        propertyIndexes.erase(propertyID);
         propertyColumns.erase(propertyID);
     }
     inline void addProperty(catalog::Property property) {
@@ -63,6 +76,7 @@ private:
     NodesStatisticsAndDeletedIDs* nodesStatisticsAndDeletedIDs;
     std::unordered_map<common::property_id_t, std::unique_ptr<Column>> propertyColumns;
     std::unique_ptr<PrimaryKeyIndex> pkIndex;
+    std::unordered_map<common::property_id_t, std::unique_ptr<PropertyIndex>> propertyIndexes;
     common::table_id_t tableID;
     BufferManager& bufferManager;
     WAL* wal;
@@ -60,6 +60,9 @@ public:
 
     RelTableDataType relTableDataType;
     std::vector<common::property_id_t> propertyIds;
+    // If set, only the sizes of adj lists are scanned and the nbr node vector is not populated.
+    // Only valid without properties.
+    bool countOnly = false;
     // sync state between adj and property lists
     std::unique_ptr<ListSyncState> syncState;
     std::vector<std::unique_ptr<ListHandle>> listHandles;
@@ -119,6 +119,8 @@ public:
 
     void logAddPropertyRecord(common::table_id_t tableID, common::property_id_t propertyID);
 
+    void logCreateIndexRecord(common::table_id_t tableID, common::property_id_t propertyID);
+
     // Removes the contents of WAL file.
     void clearWAL();
 
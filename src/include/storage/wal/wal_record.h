@@ -188,10 +188,25 @@ struct NodeIndexID {
     inline bool operator==(const NodeIndexID& rhs) const { return tableID == rhs.tableID; }
 };
 
+struct PropertyIndexID {
+    common::table_id_t tableID;
+    common::property_id_t propertyID;
+
+    PropertyIndexID() = default;
+
+    PropertyIndexID(common::table_id_t tableID, common::property_id_t propertyID)
+        : tableID{tableID}, propertyID{propertyID} {}
+
+    inline bool operator==(const PropertyIndexID& rhs) const {
+        return tableID == rhs.tableID && propertyID == rhs.propertyID;
+    }
+};
+
 enum class StorageStructureType : uint8_t {
     COLUMN = 0,
     LISTS = 1,
     NODE_INDEX = 2,
+    PROPERTY_INDEX = 3,
 };
 
 std::string storageStructureTypeToString(StorageStructureType storageStructureType);
@@ -206,6 +221,7 @@ struct StorageStructureID {
         ColumnFileID columnFileID;
         ListFileID listFileID;
         NodeIndexID nodeIndexID;
+        PropertyIndexID propertyIndexID;
     };
 
     inline bool operator==(const StorageStructureID& rhs) const {
@@ -222,6 +238,9 @@ struct StorageStructureID {
         case StorageStructureType::NODE_INDEX: {
             return nodeIndexID == rhs.nodeIndexID;
         }
+        case StorageStructureType::PROPERTY_INDEX: {
+            return propertyIndexID == rhs.propertyIndexID;
+        }
         default: {
             assert(false);
         }
@@ -239,6 +258,9 @@ struct StorageStructureID {
 
     static StorageStructureID newNodeIndexID(common::table_id_t tableID);
 
+    static StorageStructureID newPropertyIndexID(
+        common::table_id_t tableID, common::property_id_t propertyID);
+
     static StorageStructureID newAdjListsID(
         common::table_id_t relTableID, common::RelDirection dir, ListFileType listFileType);
 
@@ -261,6 +283,7 @@ enum class WALRecordType : uint8_t {
     DROP_TABLE_RECORD = 9,
     DROP_PROPERTY_RECORD = 10,
     ADD_PROPERTY_RECORD = 11,
+    CREATE_INDEX_RECORD = 12,
 };
 
 std::string walRecordTypeToString(WALRecordType walRecordType);
@@ -404,6 +427,20 @@ struct AddPropertyRecord {
     }
 };
 
+struct CreateIndexRecord {
+    common::table_id_t tableID;
+    common::property_id_t propertyID;
+
+    CreateIndexRecord() = default;
+
+    CreateIndexRecord(common::table_id_t tableID, common::property_id_t propertyID)
+        : tableID{tableID}, propertyID{propertyID} {}
+
+    inline bool operator==(const CreateIndexRecord& rhs) const {
+        return tableID == rhs.tableID && propertyID == rhs.propertyID;
+    }
+};
+
 struct WALRecord {
     WALRecordType recordType;
     union {
@@ -418,6 +455,7 @@ struct WALRecord {
         DropTableRecord dropTableRecord;
         DropPropertyRecord dropPropertyRecord;
         AddPropertyRecord addPropertyRecord;
+        CreateIndexRecord createIndexRecord;
     };
 
     bool operator==(const WALRecord& rhs) const {
@@ -462,6 +500,9 @@ struct WALRecord {
         case WALRecordType::ADD_PROPERTY_RECORD: {
             return addPropertyRecord == rhs.addPropertyRecord;
         }
+        case WALRecordType::CREATE_INDEX_RECORD: {
+            return createIndexRecord == rhs.createIndexRecord;
+        }
         default: {
             throw common::RuntimeException("Unrecognized WAL record type inside ==. recordType: " +
                                            walRecordTypeToString(recordType));
@@ -487,6 +528,8 @@ struct WALRecord {
         common::table_id_t tableID, common::property_id_t propertyID);
     static WALRecord newAddPropertyRecord(
         common::table_id_t tableID, common::property_id_t propertyID);
+    static WALRecord newCreateIndexRecord(
+        common::table_id_t tableID, common::property_id_t propertyID);
     static void constructWALRecordFromBytes(WALRecord& retVal, uint8_t* bytes, uint64_t& offset);
     // This functions assumes that the caller ensures there is enough space in the bytes pointer
     // to write the record. This should be checked by calling numBytesToWrite.
@@ -42,6 +42,8 @@ public:
         common::table_id_t tableID, common::property_id_t propertyID) {
         removeColumnFilesIfExists(StorageUtils::getNodePropertyColumnFName(
             directory, tableID, propertyID, common::DBFileType::ORIGINAL));
+        removeColumnFilesIfExists(StorageUtils::getPropertyIndexFName(
+            directory, tableID, propertyID, common::DBFileType::ORIGINAL));
     }
 
     static inline void renameDBFilesForNodeProperty(const std::string& directory,
@@ -50,6 +52,12 @@ public:
             directory, tableID, propertyID, common::DBFileType::ORIGINAL));
     }
 
+    static inline void renameDBFilesForPropertyIndex(const std::string& directory,
+        common::table_id_t tableID, common::property_id_t propertyID) {
+        replaceOriginalColumnFilesWithWALVersionIfExists(StorageUtils::getPropertyIndexFName(
+            directory, tableID, propertyID, common::DBFileType::ORIGINAL));
+    }
+
     static void removeDBFilesForRelProperty(const std::string& directory,
         catalog::RelTableSchema* relTableSchema, common::property_id_t propertyID);
 
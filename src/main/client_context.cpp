@@ -5,7 +5,25 @@
 namespace kuzu {
 namespace main {
 
-ClientContext::ClientContext() : numThreadsForExecution{std::thread::hardware_concurrency()} {}
+ClientContext::ClientContext()
+    : numThreadsForExecution{std::thread::hardware_concurrency()}, timeoutInMS{0},
+      memoryLimitInBytes{0}, interrupted{false}, deadlineTicks{UINT64_MAX} {}
+
+void ClientContext::startQuery() {
+    if (timeoutInMS == 0) {
+        deadlineTicks = UINT64_MAX;
+        return;
+    }
+    // Very large timeouts are clamped to no deadline instead of overflowing.
+    auto now = common::TickCounter::now();
+    auto timeoutInTicks =
+        (double)timeoutInMS * 1000 * common::TickCounter::getTicksPerMicrosecond();
+    if (timeoutInTicks >= (double)UINT64_MAX || (uint64_t)timeoutInTicks > UINT64_MAX - now) {
+        deadlineTicks = UINT64_MAX;
+    } else {
+        deadlineTicks = now + (uint64_t)timeoutInTicks;
+    }
+}
 
 } // namespace main
 } // namespace kuzu
@@ -9,6 +9,7 @@
 #include "planner/logical_plan/logical_plan_util.h"
 #include "planner/planner.h"
 #include "processor/mapper/plan_mapper.h"
+#include "processor/operator/copy/copy.h"
 #include "processor/processor.h"
 #include "transaction/transaction.h"
 #include "transaction/transaction_manager.h"
@@ -67,6 +68,21 @@ uint64_t Connection::getMaxNumThreadForExec() {
     return clientContext->numThreadsForExecution;
 }
 
+void Connection::setQueryTimeOut(uint64_t timeoutInMS) {
+    std::unique_lock<std::mutex> lck{mtx};
+    clientContext->timeoutInMS = timeoutInMS;
+}
+
+void Connection::setQueryMemoryLimit(uint64_t memoryLimitInBytes) {
+    std::unique_lock<std::mutex> lck{mtx};
+    clientContext->memoryLimitInBytes = memoryLimitInBytes;
+}
+
+void Connection::interrupt() {
+    // Not taking the connection lock, which is held by the running query.
+    clientContext->interrupted.store(true);
+}
+
 std::unique_ptr<PreparedStatement> Connection::prepare(const std::string& query) {
     std::unique_lock<std::mutex> lck{mtx};
     return prepareNoLock(query);
@@ -74,6 +90,8 @@ std::unique_ptr<PreparedStatement> Connection::prepare(const std::string& query)
 
 std::unique_ptr<QueryResult> Connection::query(const std::string& query) {
     lock_t lck{mtx};
+    // An interrupt from now on, including while the query is compiled, stops the query.
+    clientContext->interrupted.store(false);
     auto preparedStatement = prepareNoLock(query);
     return executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get());
 }
@@ -81,6 +99,7 @@ std::unique_ptr<QueryResult> Connection::query(const std::string& query) {
 std::unique_ptr<QueryResult> Connection::query(
     const std::string& query, const std::string& encodedJoin) {
     lock_t lck{mtx};
+    clientContext->interrupted.store(false);
     auto preparedStatement = prepareNoLock(query, true /* enumerate all plans */, encodedJoin);
     return executeAndAutoCommitIfNecessaryNoLock(preparedStatement.get());
 }
@@ -274,6 +293,7 @@ std::unique_ptr<QueryResult> Connection::kuzu_query(const char* queryString) {
 std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::shared_ptr<Value>>& inputParams) {
     lock_t lck{mtx};
+    clientContext->interrupted.store(false);
     if (!preparedStatement->isSuccess()) {
         return queryResultWithError(preparedStatement->errMsg);
     }
@@ -326,12 +346,13 @@ std::unique_ptr<QueryResult> Connection::executeAndAutoCommitIfNecessaryNoLock(
     auto profiler = std::make_unique<Profiler>();
     auto executionContext =
         std::make_unique<ExecutionContext>(clientContext->numThreadsForExecution, profiler.get(),
-            database->memoryManager.get(), database->bufferManager.get());
+            database->memoryManager.get(), database->bufferManager.get(), clientContext.get());
     // Execute query if EXPLAIN is not enabled.
     if (!preparedStatement->preparedSummary.isExplain) {
         profiler->enabled = preparedStatement->preparedSummary.isProfile;
         auto executingTimer = TimeMetric(true /* enable */);
         executingTimer.start();
+        clientContext->startQuery();
         std::shared_ptr<FactorizedTable> resultFT;
         try {
             beginTransactionIfAutoCommit(preparedStatement);
@@ -348,6 +369,10 @@ std::unique_ptr<QueryResult> Connection::executeAndAutoCommitIfNecessaryNoLock(
         }
         executingTimer.stop();
         queryResult->querySummary->executionTime = executingTimer.getElapsedTimeMS();
+        if (physicalPlan->isCopy()) {
+            queryResult->querySummary->phaseTimes =
+                ((Copy*)physicalPlan->lastOperator.get())->getPhaseTimesMS();
+        }
         queryResult->initResultTableAndIterator(std::move(resultFT),
             preparedStatement->statementResult->getColumns(),
             preparedStatement->statementResult->getExpressionsToCollectPerColumn());
@@ -367,6 +392,10 @@ void Connection::beginTransactionNoLock(TransactionType type) {
             "transactions, please open other connections. Current active transaction is "
             "not affected by this exception and can still be used.");
     }
+    if (type == transaction::TransactionType::WRITE && database->systemConfig.readOnly) {
+        throw ConnectionException(
+            "Cannot begin a write transaction on a database opened in read-only mode.");
+    }
     activeTransaction = type == transaction::TransactionType::READ_ONLY ?
                             database->transactionManager->beginReadOnlyTransaction() :
                             database->transactionManager->beginWriteTransaction();
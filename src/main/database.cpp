@@ -38,10 +38,17 @@ Database::Database(std::string databasePath) : Database{std::move(databasePath),
 Database::Database(std::string databasePath, SystemConfig systemConfig)
     : databasePath{std::move(databasePath)}, systemConfig{systemConfig} {
     initLoggers();
-    initDBDirAndCoreFilesIfNecessary();
+    if (this->systemConfig.readOnly) {
+        if (!FileUtils::fileOrPathExists(this->databasePath)) {
+            throw Exception("Cannot open database " + this->databasePath +
+                            " in read-only mode because it does not exist.");
+        }
+    } else {
+        initDBDirAndCoreFilesIfNecessary();
+    }
     logger = LoggerUtils::getLogger(LoggerConstants::LoggerEnum::DATABASE);
-    bufferManager = std::make_unique<BufferManager>(
-        this->systemConfig.defaultPageBufferPoolSize, this->systemConfig.largePageBufferPoolSize);
+    bufferManager = std::make_unique<BufferManager>(this->systemConfig.defaultPageBufferPoolSize,
+        this->systemConfig.largePageBufferPoolSize, this->systemConfig.readOnly);
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get());
     wal = std::make_unique<WAL>(this->databasePath, *bufferManager);
     recoverIfNecessary();
@@ -195,6 +202,11 @@ void Database::rollbackAndClearWAL() {
 
 void Database::recoverIfNecessary() {
     if (!wal->isEmptyWAL()) {
+        if (systemConfig.readOnly) {
+            throw Exception("Cannot open database " + databasePath +
+                            " in read-only mode because its WAL is not empty. Open it in "
+                            "read-write mode once to recover.");
+        }
         if (wal->isLastLoggedRecordCommit()) {
             logger->info("Starting up StorageManager and found a non-empty WAL with a committed "
                          "transaction. Replaying to checkpoint.");
@@ -33,6 +33,10 @@ std::string QuerySummary::getPlan() {
     return planInOstream.str();
 }
 
+const std::vector<std::pair<std::string, double>>& QuerySummary::getPhaseTimes() const {
+    return phaseTimes;
+}
+
 void QuerySummary::setPreparedSummary(PreparedSummary preparedSummary_) {
     preparedSummary = preparedSummary_;
 }
@@ -0,0 +1,100 @@
+#include "optimizer/count_only_extend_optimizer.h"
+
+#include "binder/expression/property_expression.h"
+#include "planner/logical_plan/logical_operator/logical_aggregate.h"
+#include "planner/logical_plan/logical_operator/logical_extend.h"
+#include "planner/logical_plan/logical_operator/logical_filter.h"
+#include "planner/logical_plan/logical_operator/logical_projection.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node_property.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void CountOnlyExtendOptimizer::rewrite(planner::LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void CountOnlyExtendOptimizer::visitOperator(planner::LogicalOperator* op) {
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        visitOperator(op->getChild(i).get());
+    }
+    visitOperatorSwitch(op);
+}
+
+void CountOnlyExtendOptimizer::visitAggregate(planner::LogicalOperator* op) {
+    auto aggregate = (LogicalAggregate*)op;
+    expression_vector expressionsInUse = aggregate->getExpressionsToGroupBy();
+    for (auto& expression : aggregate->getExpressionsToAggregate()) {
+        expressionsInUse.push_back(expression);
+    }
+    auto extend = (LogicalExtend*)searchExtend(op->getChild(0).get(), expressionsInUse);
+    // Variable length extends and extends scanning rel properties need to read list pages.
+    if (extend == nullptr || extend->getRel()->isVariableLength() ||
+        !extend->getProperties().empty()) {
+        return;
+    }
+    std::unordered_set<std::string> names{
+        extend->getNbrNode()->getUniqueName(), extend->getRel()->getUniqueName()};
+    for (auto& expression : expressionsInUse) {
+        if (isNbrOrRelInUse(*expression, names)) {
+            return;
+        }
+    }
+    extend->setCountOnly();
+}
+
+LogicalOperator* CountOnlyExtendOptimizer::searchExtend(
+    planner::LogicalOperator* op, expression_vector& expressionsInUse) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::FLATTEN: {
+        return searchExtend(op->getChild(0).get(), expressionsInUse);
+    }
+    case LogicalOperatorType::PROJECTION: {
+        // The planner projects the inputs of every aggregate right below it.
+        for (auto& expression : ((LogicalProjection*)op)->getExpressionsToProject()) {
+            expressionsInUse.push_back(expression);
+        }
+        return searchExtend(op->getChild(0).get(), expressionsInUse);
+    }
+    case LogicalOperatorType::FILTER: {
+        expressionsInUse.push_back(((LogicalFilter*)op)->getPredicate());
+        return searchExtend(op->getChild(0).get(), expressionsInUse);
+    }
+    case LogicalOperatorType::SCAN_NODE_PROPERTY: {
+        auto scanNodeProperty = (LogicalScanNodeProperty*)op;
+        expressionsInUse.push_back(scanNodeProperty->getNode()->getInternalIDProperty());
+        for (auto& predicate : scanNodeProperty->getPredicates()) {
+            expressionsInUse.push_back(predicate);
+        }
+        return searchExtend(op->getChild(0).get(), expressionsInUse);
+    }
+    case LogicalOperatorType::EXTEND: {
+        return op;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+bool CountOnlyExtendOptimizer::isNbrOrRelInUse(
+    const Expression& expression, const std::unordered_set<std::string>& names) {
+    if (names.contains(expression.getUniqueName())) {
+        return true;
+    }
+    if (expression.expressionType == common::PROPERTY &&
+        names.contains(((PropertyExpression&)expression).getVariableName())) {
+        return true;
+    }
+    for (auto& child : expression.getChildren()) {
+        if (isNbrOrRelInUse(*child, names)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace optimizer
+} // namespace kuzu
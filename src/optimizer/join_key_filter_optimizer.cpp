@@ -0,0 +1,36 @@
+#include "optimizer/join_key_filter_optimizer.h"
+
+#include "planner/logical_plan/logical_operator/logical_hash_join.h"
+#include "planner/logical_plan/logical_plan_util.h"
+
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void JoinKeyFilterOptimizer::rewrite(planner::LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void JoinKeyFilterOptimizer::visitOperator(planner::LogicalOperator* op) {
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        visitOperator(op->getChild(i).get());
+    }
+    visitOperatorSwitch(op);
+}
+
+void JoinKeyFilterOptimizer::visitHashJoin(planner::LogicalOperator* op) {
+    auto hashJoin = (LogicalHashJoin*)op;
+    // Left and mark joins output every probe side tuple, so only inner joins can drop them. The
+    // filter is built on a single key so that it can be checked against a single scanned node.
+    if (hashJoin->getJoinType() != common::JoinType::INNER ||
+        hashJoin->getJoinNodeIDs().size() != 1) {
+        return;
+    }
+    auto scanNode = LogicalPlanUtil::searchScanNodeOnPipeline(
+        op->getChild(0).get(), *hashJoin->getJoinNodeIDs()[0]);
+    hashJoin->setFilterProbeSideScan(scanNode != nullptr);
+}
+
+} // namespace optimizer
+} // namespace kuzu
@@ -13,6 +13,9 @@ void LogicalOperatorVisitor::visitOperatorSwitch(planner::LogicalOperator* op) {
     case LogicalOperatorType::SCAN_NODE: {
         visitScanNode(op);
     } break;
+    case LogicalOperatorType::SCAN_NODE_PROPERTY: {
+        visitScanNodeProperty(op);
+    } break;
     case LogicalOperatorType::EXTEND: {
         visitExtend(op);
     } break;
@@ -84,6 +87,9 @@ std::shared_ptr<planner::LogicalOperator> LogicalOperatorVisitor::visitOperatorR
     case LogicalOperatorType::SCAN_NODE: {
         return visitScanNodeReplace(op);
     }
+    case LogicalOperatorType::SCAN_NODE_PROPERTY: {
+        return visitScanNodePropertyReplace(op);
+    }
     case LogicalOperatorType::EXTEND: {
         return visitExtendReplace(op);
     }
@@ -1,9 +1,13 @@
 #include "optimizer/optimizer.h"
 
 #include "optimizer/asp_optimizer.h"
+#include "optimizer/count_only_extend_optimizer.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/index_nested_loop_join_optimizer.h"
+#include "optimizer/join_key_filter_optimizer.h"
+#include "optimizer/predicate_push_down_optimizer.h"
 #include "optimizer/projection_push_down_optimizer.h"
+#include "optimizer/property_index_optimizer.h"
 #include "optimizer/remove_factorization_rewriter.h"
 #include "optimizer/remove_unnecessary_join_optimizer.h"
 
@@ -25,9 +29,25 @@ void Optimizer::optimize(planner::LogicalPlan* plan) {
     auto aspOptimizer = ASPOptimizer();
     aspOptimizer.rewrite(plan);
 
+    // Probe sides rewritten by ASP are accumulated and thus not considered for join key filters.
+    auto joinKeyFilterOptimizer = JoinKeyFilterOptimizer();
+    joinKeyFilterOptimizer.rewrite(plan);
+
+    // Predicates should be pushed into scans after optimizers that look for filters.
+    auto predicatePushDownOptimizer = PredicatePushDownOptimizer();
+    predicatePushDownOptimizer.rewrite(plan);
+
+    // Both filters and predicates pushed into scans can restrict scans through property indexes.
+    auto propertyIndexOptimizer = PropertyIndexOptimizer();
+    propertyIndexOptimizer.rewrite(plan);
+
     auto projectionPushDownOptimizer = ProjectionPushDownOptimizer();
     projectionPushDownOptimizer.rewrite(plan);
 
+    // Filters and property scans between an aggregate and an extend are final after push downs.
+    auto countOnlyExtendOptimizer = CountOnlyExtendOptimizer();
+    countOnlyExtendOptimizer.rewrite(plan);
+
     auto factorizationRewriter = FactorizationRewriter();
     factorizationRewriter.rewrite(plan);
 }
@@ -0,0 +1,91 @@
+#include "optimizer/predicate_push_down_optimizer.h"
+
+#include "binder/expression/literal_expression.h"
+#include "planner/logical_plan/logical_operator/logical_filter.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node.h"
+#include "storage/storage_structure/column_predicate.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void PredicatePushDownOptimizer::rewrite(planner::LogicalPlan* plan) {
+    plan->setLastOperator(visitOperator(plan->getLastOperator()));
+}
+
+std::shared_ptr<planner::LogicalOperator> PredicatePushDownOptimizer::visitOperator(
+    std::shared_ptr<planner::LogicalOperator> op) {
+    // bottom-up traversal
+    for (auto i = 0; i < op->getNumChildren(); ++i) {
+        op->setChild(i, visitOperator(op->getChild(i)));
+    }
+    auto result = visitOperatorReplaceSwitch(op);
+    result->computeFlatSchema();
+    return result;
+}
+
+std::shared_ptr<planner::LogicalOperator> PredicatePushDownOptimizer::visitFilterReplace(
+    std::shared_ptr<planner::LogicalOperator> op) {
+    auto filter = (LogicalFilter*)op.get();
+    auto child = op->getChild(0);
+    if (child->getOperatorType() != LogicalOperatorType::SCAN_NODE_PROPERTY) {
+        return op;
+    }
+    auto scanNodeProperty = (LogicalScanNodeProperty*)child.get();
+    if (!isOnNodeTableScan(*scanNodeProperty) ||
+        !canPushDown(*filter->getPredicate(), *scanNodeProperty)) {
+        return op;
+    }
+    scanNodeProperty->addPredicate(filter->getPredicate());
+    return child;
+}
+
+bool PredicatePushDownOptimizer::isOnNodeTableScan(
+    const LogicalScanNodeProperty& scanNodeProperty) {
+    auto node = scanNodeProperty.getNode();
+    if (node->isMultiLabeled()) {
+        return false;
+    }
+    auto op = scanNodeProperty.getChild(0).get();
+    while (op->getOperatorType() == LogicalOperatorType::SCAN_NODE_PROPERTY) {
+        if (((LogicalScanNodeProperty*)op)->getNode()->getUniqueName() != node->getUniqueName()) {
+            return false;
+        }
+        op = op->getChild(0).get();
+    }
+    return op->getOperatorType() == LogicalOperatorType::SCAN_NODE &&
+           ((LogicalScanNode*)op)->getNode()->getUniqueName() == node->getUniqueName();
+}
+
+bool PredicatePushDownOptimizer::canPushDown(
+    const Expression& predicate, const LogicalScanNodeProperty& scanNodeProperty) {
+    if (!isExpressionComparison(predicate.expressionType)) {
+        return false;
+    }
+    auto left = predicate.getChild(0);
+    auto right = predicate.getChild(1);
+    auto isPropertyOnLeft = left->expressionType == PROPERTY;
+    auto property = isPropertyOnLeft ? left : right;
+    auto literal = isPropertyOnLeft ? right : left;
+    if (property->expressionType != PROPERTY || literal->expressionType != LITERAL ||
+        ((LiteralExpression&)*literal).isNull()) {
+        return false;
+    }
+    // Operands are never implicitly converted when compared on pages.
+    if (property->dataType.typeID != literal->dataType.typeID ||
+        !storage::ColumnPredicate::isSupportedType(property->dataType.typeID)) {
+        return false;
+    }
+    for (auto& scannedProperty : scanNodeProperty.getProperties()) {
+        if (scannedProperty->getUniqueName() == property->getUniqueName()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace optimizer
+} // namespace kuzu
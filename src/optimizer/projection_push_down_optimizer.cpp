@@ -8,6 +8,7 @@
 #include "planner/logical_plan/logical_operator/logical_intersect.h"
 #include "planner/logical_plan/logical_operator/logical_order_by.h"
 #include "planner/logical_plan/logical_operator/logical_projection.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node_property.h"
 #include "planner/logical_plan/logical_operator/logical_set.h"
 #include "planner/logical_plan/logical_operator/logical_unwind.h"
 
@@ -50,6 +51,12 @@ void ProjectionPushDownOptimizer::visitFilter(planner::LogicalOperator* op) {
     collectPropertiesInUse(filter->getPredicate());
 }
 
+void ProjectionPushDownOptimizer::visitScanNodeProperty(planner::LogicalOperator* op) {
+    // Deferred properties are scanned after joins and ORDER BY, which must keep the node ID.
+    auto scanNodeProperty = (LogicalScanNodeProperty*)op;
+    collectPropertiesInUse(scanNodeProperty->getNode()->getInternalIDProperty());
+}
+
 void ProjectionPushDownOptimizer::visitHashJoin(planner::LogicalOperator* op) {
     auto hashJoin = (LogicalHashJoin*)op;
     for (auto& joinNodeID : hashJoin->getJoinNodeIDs()) {
@@ -0,0 +1,58 @@
+#include "optimizer/property_index_optimizer.h"
+
+#include "binder/expression/property_expression.h"
+#include "planner/logical_plan/logical_operator/logical_filter.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node_property.h"
+#include "planner/logical_plan/logical_plan_util.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void PropertyIndexOptimizer::rewrite(planner::LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void PropertyIndexOptimizer::visitOperator(planner::LogicalOperator* op) {
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        visitOperator(op->getChild(i).get());
+    }
+    visitOperatorSwitch(op);
+}
+
+void PropertyIndexOptimizer::visitFilter(planner::LogicalOperator* op) {
+    auto filter = (LogicalFilter*)op;
+    auto predicate = filter->getPredicate();
+    if (!isExpressionComparison(predicate->expressionType)) {
+        return;
+    }
+    auto isPropertyOnLeft = predicate->getChild(0)->expressionType == PROPERTY;
+    auto property = predicate->getChild(isPropertyOnLeft ? 0 : 1);
+    auto constant = predicate->getChild(isPropertyOnLeft ? 1 : 0);
+    if (property->expressionType != PROPERTY ||
+        (constant->expressionType != LITERAL && constant->expressionType != PARAMETER)) {
+        return;
+    }
+    auto nodeName = ((PropertyExpression&)*property).getVariableName();
+    if (LogicalPlanUtil::searchScanNodeThroughFilters(op->getChild(0).get(), nodeName) ==
+        nullptr) {
+        return;
+    }
+    filter->setNodeToRestrict(nodeName);
+}
+
+void PropertyIndexOptimizer::visitScanNodeProperty(planner::LogicalOperator* op) {
+    auto scanNodeProperty = (LogicalScanNodeProperty*)op;
+    if (scanNodeProperty->getPredicates().empty()) {
+        return;
+    }
+    auto scanNode = LogicalPlanUtil::searchScanNodeThroughFilters(
+        op->getChild(0).get(), scanNodeProperty->getNode()->getUniqueName());
+    scanNodeProperty->setRestrictScanNode(scanNode != nullptr);
+}
+
+} // namespace optimizer
+} // namespace kuzu
@@ -4,6 +4,7 @@
 #include "common/utils.h"
 #include "parser/copy_csv/copy_csv.h"
 #include "parser/ddl/add_property.h"
+#include "parser/ddl/create_index.h"
 #include "parser/ddl/create_node_clause.h"
 #include "parser/ddl/create_rel_clause.h"
 #include "parser/ddl/drop_property.h"
@@ -895,6 +896,8 @@ std::unique_ptr<Statement> Transformer::transformDDL(CypherParser::KU_DDLContext
         return transformCreateRelClause(*root.kU_DDL()->kU_CreateRel());
     } else if (root.kU_DDL()->kU_DropTable()) {
         return transformDropTable(*root.kU_DDL()->kU_DropTable());
+    } else if (root.kU_DDL()->kU_CreateIndex()) {
+        return transformCreateIndex(*root.kU_DDL()->kU_CreateIndex());
     } else {
         return transformAlterTable(*root.kU_DDL()->kU_AlterTable());
     }
@@ -940,6 +943,12 @@ std::unique_ptr<Statement> Transformer::transformDropTable(CypherParser::KU_Drop
     return std::make_unique<DropTable>(transformSchemaName(*ctx.oC_SchemaName()));
 }
 
+std::unique_ptr<Statement> Transformer::transformCreateIndex(
+    CypherParser::KU_CreateIndexContext& ctx) {
+    return std::make_unique<CreateIndex>(transformSchemaName(*ctx.oC_SchemaName()),
+        transformPropertyKeyName(*ctx.oC_PropertyKeyName()));
+}
+
 std::unique_ptr<Statement> Transformer::transformRenameTable(
     CypherParser::KU_AlterTableContext& ctx) {
     return std::make_unique<RenameTable>(transformSchemaName(*ctx.oC_SchemaName()),
@@ -84,12 +84,14 @@ std::vector<std::unique_ptr<LogicalPlan>> JoinOrderEnumerator::enumerate(
 
 std::unique_ptr<JoinOrderEnumeratorContext> JoinOrderEnumerator::enterSubquery(
     LogicalPlan* outerPlan, expression_vector expressionsToScan,
-    expression_vector nodeIDsToScanFromInnerAndOuter) {
+    expression_vector nodeIDsToScanFromInnerAndOuter,
+    std::shared_ptr<Expression> nodeIDToExtendFromOuter) {
     auto prevContext = std::move(context);
     context = std::make_unique<JoinOrderEnumeratorContext>();
     context->outerPlan = outerPlan;
     context->expressionsToScanFromOuter = std::move(expressionsToScan);
     context->nodeIDsToScanFromInnerAndOuter = std::move(nodeIDsToScanFromInnerAndOuter);
+    context->nodeIDToExtendFromOuter = std::move(nodeIDToExtendFromOuter);
     return prevContext;
 }
 
@@ -97,6 +99,26 @@ void JoinOrderEnumerator::exitSubquery(std::unique_ptr<JoinOrderEnumeratorContex
     context = std::move(prevContext);
 }
 
+static bool containsOperator(const LogicalOperator* root, const LogicalOperator* op) {
+    if (root == op) {
+        return true;
+    }
+    for (auto i = 0u; i < root->getNumChildren(); ++i) {
+        if (containsOperator(root->getChild(i).get(), op)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool JoinOrderEnumerator::containsOuterPlan(const LogicalPlan& plan) const {
+    if (context->nodeIDToExtendFromOuter == nullptr) {
+        return false;
+    }
+    return containsOperator(
+        plan.getLastOperator().get(), context->outerPlan->getLastOperator().get());
+}
+
 void JoinOrderEnumerator::planLevel(uint32_t level) {
     assert(level > 1);
     if (level > MAX_LEVEL_TO_PLAN_EXACTLY) {
@@ -204,6 +226,15 @@ void JoinOrderEnumerator::planNodeScan(uint32_t nodePos) {
         appendScanNode(node, *plan);
     }
     context->addPlan(newSubgraph, std::move(plan));
+    // E.g. MATCH (a) WITH a MATCH (a)-[e1]->(b). Instead of scanning a again and joining the inner
+    // query with the outer one, the inner query can extend from the outer plan directly so that
+    // the outer result streams through without being materialized in a hash table. Such plans
+    // compete on cost with the ones joining the outer plan (see QueryPlanner::planRegularMatch).
+    if (context->isNodeToExtendFromOuter(*node)) {
+        auto outerPlan = context->outerPlan->shallowCopy();
+        planFiltersForNode(predicates, node, *outerPlan);
+        context->addPlan(newSubgraph, std::move(outerPlan));
+    }
 }
 
 void JoinOrderEnumerator::planFiltersForNode(
@@ -217,7 +248,12 @@ void JoinOrderEnumerator::planFiltersForNode(
 
 void JoinOrderEnumerator::planPropertyScansForNode(
     std::shared_ptr<NodeExpression> node, LogicalPlan& plan) {
-    auto properties = queryPlanner->getPropertiesForNode(*node);
+    expression_vector properties;
+    for (auto& property : queryPlanner->getPropertiesForNode(*node)) {
+        if (!queryPlanner->isPropertyDeferred(*property)) {
+            properties.push_back(property);
+        }
+    }
     queryPlanner->appendScanNodePropIfNecessary(properties, node, plan);
 }
 
@@ -405,10 +441,19 @@ static bool isNodeSequential(LogicalPlan& plan, NodeExpression* node) {
     return sequentialNode != nullptr && sequentialNode->getUniqueName() == node->getUniqueName();
 }
 
+// Plans starting from the outer plan can always extend from the node they start at, since this
+// avoids materializing the outer plan.
+bool JoinOrderEnumerator::canExtendFromNode(LogicalPlan& plan, NodeExpression* node) const {
+    if (context->isNodeToExtendFromOuter(*node) && containsOuterPlan(plan)) {
+        return true;
+    }
+    return isNodeSequential(plan, node);
+}
+
 // We apply index nested loop join if the following to conditions are satisfied
 // - otherSubgraph is an edge; and
-// - join node is sequential on at least one plan corresponding to subgraph. (Otherwise INLJ will
-// trigger non-sequential read).
+// - join node is sequential on at least one plan corresponding to subgraph (otherwise INLJ will
+// trigger non-sequential read), or is the node that plan starts from the outer plan at.
 bool JoinOrderEnumerator::canApplyINLJoin(const SubqueryGraph& subgraph,
     const SubqueryGraph& otherSubgraph,
     const std::vector<std::shared_ptr<NodeExpression>>& joinNodes) {
@@ -416,7 +461,7 @@ bool JoinOrderEnumerator::canApplyINLJoin(const SubqueryGraph& subgraph,
         return false;
     }
     for (auto& plan : context->getPlans(subgraph)) {
-        if (isNodeSequential(*plan, joinNodes[0].get())) {
+        if (canExtendFromNode(*plan, joinNodes[0].get())) {
             return true;
         }
     }
@@ -445,7 +490,7 @@ void JoinOrderEnumerator::planInnerINLJoin(const SubqueryGraph& subgraph,
     auto predicates =
         getNewlyMatchedExpressions(subgraph, newSubgraph, context->getWhereExpressions());
     for (auto& prevPlan : context->getPlans(subgraph)) {
-        if (isNodeSequential(*prevPlan, boundNode)) {
+        if (canExtendFromNode(*prevPlan, boundNode)) {
             auto plan = prevPlan->shallowCopy();
             auto direction = boundNode->getUniqueName() == rel->getSrcNodeName() ? FWD : BWD;
             planExtendAndFilters(rel, direction, predicates, *plan);
@@ -464,6 +509,10 @@ void JoinOrderEnumerator::planInnerHashJoin(const SubqueryGraph& subgraph,
             context->getWhereExpressions());
     for (auto& leftPlan : context->getPlans(subgraph)) {
         for (auto& rightPlan : context->getPlans(otherSubgraph)) {
+            // The outer plan must appear only once in a plan.
+            if (containsOuterPlan(*leftPlan) && containsOuterPlan(*rightPlan)) {
+                continue;
+            }
             auto leftPlanProbeCopy = leftPlan->shallowCopy();
             auto rightPlanBuildCopy = rightPlan->shallowCopy();
             auto leftPlanBuildCopy = leftPlan->shallowCopy();
@@ -31,6 +31,9 @@ std::string LogicalOperatorUtils::logicalOperatorTypeToString(LogicalOperatorTyp
     case LogicalOperatorType::CREATE_REL_TABLE: {
         return "CREATE_REL_TABLE";
     }
+    case LogicalOperatorType::CREATE_INDEX: {
+        return "CREATE_INDEX";
+    }
     case LogicalOperatorType::CROSS_PRODUCT: {
         return "CROSS_PRODUCT";
     }
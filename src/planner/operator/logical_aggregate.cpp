@@ -45,8 +45,11 @@ f_group_pos_set LogicalAggregate::getGroupsPosToFlattenForGroupBy() {
     }
 }
 
+// Non-distinct aggregates are computed over factorized input: each aggregate multiplies its
+// multiplicity by the sizes of the unflat groups it does not iterate (see BaseAggregate), so
+// multiple aggregates over different unflat groups do not require flattening.
 f_group_pos_set LogicalAggregate::getGroupsPosToFlattenForAggregate() {
-    if (hasDistinctAggregate() || expressionsToAggregate.size() > 1) {
+    if (hasDistinctAggregate()) {
         f_group_pos_set dependentGroupsPos;
         for (auto& expression : expressionsToAggregate) {
             for (auto groupPos : children[0]->getSchema()->getDependentGroupsPos(expression)) {
@@ -20,6 +20,47 @@ std::shared_ptr<NodeExpression> LogicalPlanUtil::getSequentialNode(LogicalPlan&
     return ((LogicalScanNode*)pipelineSource)->getNode();
 }
 
+LogicalOperator* LogicalPlanUtil::searchScanNodeThroughFilters(
+    LogicalOperator* op, const std::string& nodeName) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::SCAN_NODE_PROPERTY: {
+        return searchScanNodeThroughFilters(op->getChild(0).get(), nodeName);
+    }
+    case LogicalOperatorType::SCAN_NODE: {
+        auto node = ((LogicalScanNode*)op)->getNode();
+        return node->getUniqueName() == nodeName && !node->isMultiLabeled() ? op : nullptr;
+    }
+    default:
+        return nullptr;
+    }
+}
+
+LogicalOperator* LogicalPlanUtil::searchScanNodeOnPipeline(
+    LogicalOperator* op, const Expression& nodeID) {
+    switch (op->getOperatorType()) {
+    case LogicalOperatorType::FILTER:
+    case LogicalOperatorType::FLATTEN:
+    case LogicalOperatorType::SCAN_NODE_PROPERTY:
+    case LogicalOperatorType::EXTEND:
+    case LogicalOperatorType::PROJECTION:
+    case LogicalOperatorType::HASH_JOIN:
+    case LogicalOperatorType::INTERSECT: { // operators we directly search through
+        return searchScanNodeOnPipeline(op->getChild(0).get(), nodeID);
+    }
+    case LogicalOperatorType::SCAN_NODE: {
+        auto scanNode = (LogicalScanNode*)op;
+        return scanNode->getNode()->getInternalIDProperty()->getUniqueName() ==
+                       nodeID.getUniqueName() ?
+                   op :
+                   nullptr;
+    }
+    default: // search failed for unhandled operator
+        return nullptr;
+    }
+}
+
 LogicalOperator* LogicalPlanUtil::getCurrentPipelineSourceOperator(LogicalPlan& plan) {
     auto op = plan.getLastOperator().get();
     // Operator with more than one child will be broken into different pipelines.
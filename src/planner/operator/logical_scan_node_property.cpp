@@ -3,6 +3,14 @@
 namespace kuzu {
 namespace planner {
 
+std::string LogicalScanNodeProperty::getExpressionsForPrinting() const {
+    auto result = binder::ExpressionUtil::toString(properties);
+    if (!predicates.empty()) {
+        result += " WHERE " + binder::ExpressionUtil::toString(predicates);
+    }
+    return result;
+}
+
 void LogicalScanNodeProperty::computeFactorizedSchema() {
     copyChildSchema(0);
     auto groupPos = schema->getGroupPos(node->getInternalIDPropertyName());
@@ -2,6 +2,7 @@
 
 #include "binder/copy/bound_copy.h"
 #include "binder/ddl/bound_add_property.h"
+#include "binder/ddl/bound_create_index.h"
 #include "binder/ddl/bound_create_node_clause.h"
 #include "binder/ddl/bound_create_rel_clause.h"
 #include "binder/ddl/bound_drop_property.h"
@@ -10,6 +11,7 @@
 #include "binder/ddl/bound_rename_table.h"
 #include "planner/logical_plan/logical_operator/logical_add_property.h"
 #include "planner/logical_plan/logical_operator/logical_copy.h"
+#include "planner/logical_plan/logical_operator/logical_create_index.h"
 #include "planner/logical_plan/logical_operator/logical_create_node_table.h"
 #include "planner/logical_plan/logical_operator/logical_create_rel_table.h"
 #include "planner/logical_plan/logical_operator/logical_drop_property.h"
@@ -56,6 +58,9 @@ std::unique_ptr<LogicalPlan> Planner::getBestPlan(const Catalog& catalog,
     case StatementType::RENAME_PROPERTY: {
         plan = planRenameProperty(statement);
     } break;
+    case StatementType::CREATE_INDEX: {
+        plan = planCreateIndex(statement);
+    } break;
     default:
         throw common::NotImplementedException("getBestPlan()");
     }
@@ -140,6 +145,16 @@ std::unique_ptr<LogicalPlan> Planner::planDropProperty(const BoundStatement& sta
     return plan;
 }
 
+std::unique_ptr<LogicalPlan> Planner::planCreateIndex(const BoundStatement& statement) {
+    auto& createIndexClause = (BoundCreateIndex&)statement;
+    auto plan = std::make_unique<LogicalPlan>();
+    auto createIndex = make_shared<LogicalCreateIndex>(createIndexClause.getTableID(),
+        createIndexClause.getPropertyID(), createIndexClause.getTableName(),
+        statement.getStatementResult()->getSingleExpressionToCollect());
+    plan->setLastOperator(std::move(createIndex));
+    return plan;
+}
+
 std::unique_ptr<LogicalPlan> Planner::planRenameProperty(const BoundStatement& statement) {
     auto& renamePropertyClause = (BoundRenameProperty&)statement;
     auto plan = std::make_unique<LogicalPlan>();
@@ -38,6 +38,14 @@ void ProjectionPlanner::planProjectionBody(
         }
         QueryPlanner::appendExpressionsScan(expressionsToScan, plan);
     }
+    // Without aggregation or DISTINCT, projecting is one-to-one, so SKIP and LIMIT can be applied
+    // before projecting.
+    if (projectionBody.hasSkipOrLimit() && !projectionBody.getIsDistinct() &&
+        !projectionBody.hasAggregationExpressions()) {
+        planProjectionBodyWithSkipOrLimitFirst(projectionBody, plan);
+        return;
+    }
+    queryPlanner->appendScanDeferredPropIfNecessary(queryPlanner->propertiesToScan, plan);
     // NOTE: As a temporary solution, we rewrite variables in WITH clause as all properties in scope
     // during planning stage. The purpose is to avoid reading unnecessary properties for WITH.
     // E.g. MATCH (a) WITH a RETURN a.age -> MATCH (a) WITH a.age RETURN a.age
@@ -69,6 +77,33 @@ void ProjectionPlanner::planProjectionBody(
     }
 }
 
+void ProjectionPlanner::planProjectionBodyWithSkipOrLimitFirst(
+    const BoundProjectionBody& projectionBody, LogicalPlan& plan) {
+    if (projectionBody.hasOrderByExpressions()) {
+        expression_vector propertiesToOrderBy;
+        for (auto& expression : projectionBody.getOrderByExpressions()) {
+            for (auto& property : expression->getSubPropertyExpressions()) {
+                propertiesToOrderBy.push_back(property);
+            }
+        }
+        queryPlanner->appendScanDeferredPropIfNecessary(propertiesToOrderBy, plan);
+        appendOrderBy(
+            projectionBody.getOrderByExpressions(), projectionBody.getSortingOrders(), plan);
+    }
+    appendMultiplicityReducer(plan);
+    if (projectionBody.hasSkip()) {
+        appendSkip(projectionBody.getSkipNumber(), plan);
+    }
+    if (projectionBody.hasLimit()) {
+        appendLimit(projectionBody.getLimitNumber(), plan);
+    }
+    queryPlanner->appendScanDeferredPropIfNecessary(queryPlanner->propertiesToScan, plan);
+    // See planProjectionBody for why variables are rewritten.
+    appendProjection(
+        rewriteExpressionsToProject(projectionBody.getProjectionExpressions(), *plan.getSchema()),
+        plan);
+}
+
 void ProjectionPlanner::planAggregate(const expression_vector& expressionsToAggregate,
     const expression_vector& expressionsToGroupBy, LogicalPlan& plan) {
     assert(!expressionsToAggregate.empty());
@@ -63,6 +63,7 @@ std::vector<std::unique_ptr<LogicalPlan>> QueryPlanner::planSingleQuery(
             populatedProperties.insert(expression->getUniqueName());
         }
     }
+    populateDeferredProperties(singleQuery);
     joinOrderEnumerator.resetState();
     auto plans = getInitialEmptyPlans();
     for (auto i = 0u; i < singleQuery.getNumQueryParts(); ++i) {
@@ -71,6 +72,65 @@ std::vector<std::unique_ptr<LogicalPlan>> QueryPlanner::planSingleQuery(
     return plans;
 }
 
+void QueryPlanner::populateDeferredProperties(const NormalizedSingleQuery& singleQuery) {
+    deferredProperties.clear();
+    nodesWithDeferredProperties.clear();
+    nullableOrMixedNodeIDs.clear();
+    // Properties read by predicates, unwinds and updates must be scanned with their node.
+    std::unordered_set<std::string> propertiesToScanEarly;
+    // Nodes first matched by an OPTIONAL MATCH may have null IDs, and the IDs of a multi-labeled
+    // node mix tables once joined or sorted, so their properties are always scanned with the node.
+    std::vector<std::shared_ptr<NodeExpression>> nodesToDefer;
+    std::unordered_set<std::string> matchedNodes;
+    for (auto i = 0u; i < singleQuery.getNumQueryParts(); ++i) {
+        auto queryPart = singleQuery.getQueryPart(i);
+        for (auto j = 0u; j < queryPart->getNumReadingClause(); ++j) {
+            auto readingClause = queryPart->getReadingClause(j);
+            for (auto& property : readingClause->getSubPropertyExpressions()) {
+                propertiesToScanEarly.insert(property->getUniqueName());
+            }
+            if (readingClause->getClauseType() != ClauseType::MATCH) {
+                continue;
+            }
+            auto matchClause = (BoundMatchClause*)readingClause;
+            for (auto& node : matchClause->getQueryGraphCollection()->getQueryNodes()) {
+                if (matchedNodes.contains(node->getUniqueName())) {
+                    continue;
+                }
+                matchedNodes.insert(node->getUniqueName());
+                if (!matchClause->getIsOptional() && !node->isMultiLabeled()) {
+                    nodesToDefer.push_back(node);
+                } else {
+                    nullableOrMixedNodeIDs.insert(node->getInternalIDPropertyName());
+                }
+            }
+        }
+        for (auto j = 0u; j < queryPart->getNumUpdatingClause(); ++j) {
+            for (auto& property : queryPart->getUpdatingClause(j)->getPropertiesToRead()) {
+                propertiesToScanEarly.insert(property->getUniqueName());
+            }
+        }
+        if (queryPart->hasProjectionBodyPredicate()) {
+            for (auto& property :
+                queryPart->getProjectionBodyPredicate()->getSubPropertyExpressions()) {
+                propertiesToScanEarly.insert(property->getUniqueName());
+            }
+        }
+    }
+    for (auto& node : nodesToDefer) {
+        auto hasDeferredProperties = false;
+        for (auto& property : getPropertiesForNode(*node)) {
+            if (!propertiesToScanEarly.contains(property->getUniqueName())) {
+                deferredProperties.insert(property->getUniqueName());
+                hasDeferredProperties = true;
+            }
+        }
+        if (hasDeferredProperties) {
+            nodesWithDeferredProperties.push_back(node);
+        }
+    }
+}
+
 std::vector<std::unique_ptr<LogicalPlan>> QueryPlanner::planQueryPart(
     const NormalizedQueryPart& queryPart, std::vector<std::unique_ptr<LogicalPlan>> prevPlans) {
     std::vector<std::unique_ptr<LogicalPlan>> plans = std::move(prevPlans);
@@ -211,22 +271,43 @@ void QueryPlanner::planRegularMatch(const QueryGraphCollection& queryGraphCollec
     }
     // Multi-part query is actually CTE and CTE can be considered as a subquery but does not scan
     // from outer (i.e. can always be un-nest). So we plan multi-part query in the same way as
-    // planning an un-nest subquery.
-    auto prevContext = joinOrderEnumerator.enterSubquery(
-        &prevPlan, expression_vector{} /* nothing to scan from outer */, joinNodeIDs);
+    // planning an un-nest subquery. If the parts share a single node, the subquery may also extend
+    // from the previous plan directly, which keeps both parts in one pipeline.
+    auto nodeIDToExtend = canExtendFromPrevPlan(joinNodeIDs) ? joinNodeIDs[0] : nullptr;
+    auto prevContext = joinOrderEnumerator.enterSubquery(&prevPlan,
+        expression_vector{} /* nothing to scan from outer */, joinNodeIDs, nodeIDToExtend);
     auto plans = joinOrderEnumerator.enumerate(queryGraphCollection, predicatesToPushDown);
-    joinOrderEnumerator.exitSubquery(std::move(prevContext));
-    auto bestPlan = getBestPlan(std::move(plans));
-    if (joinNodeIDs.empty()) {
-        JoinOrderEnumerator::planCrossProduct(prevPlan, *bestPlan);
-    } else {
-        JoinOrderEnumerator::planInnerHashJoin(joinNodeIDs, prevPlan, *bestPlan);
+    for (auto& plan : plans) {
+        if (joinOrderEnumerator.containsOuterPlan(*plan)) {
+            continue;
+        }
+        auto prevPlanCopy = prevPlan.shallowCopy();
+        if (joinNodeIDs.empty()) {
+            JoinOrderEnumerator::planCrossProduct(*prevPlanCopy, *plan);
+        } else {
+            JoinOrderEnumerator::planInnerHashJoin(joinNodeIDs, *prevPlanCopy, *plan);
+        }
+        // The build side is not part of the join cost, but must be accounted for when comparing
+        // with plans extending from prevPlan.
+        prevPlanCopy->increaseCost(plan->getCost());
+        plan = std::move(prevPlanCopy);
     }
+    joinOrderEnumerator.exitSubquery(std::move(prevContext));
+    prevPlan = *getBestPlan(std::move(plans));
     for (auto& predicate : predicatesToPullUp) {
         appendFilter(predicate, prevPlan);
     }
 }
 
+// See populateDeferredProperties for why nodes first matched by an OPTIONAL MATCH and multi-labeled
+// nodes are excluded. Null IDs are dropped by a hash join but not by an extend.
+bool QueryPlanner::canExtendFromPrevPlan(const expression_vector& joinNodeIDs) const {
+    if (joinNodeIDs.size() != 1) {
+        return false;
+    }
+    return !nullableOrMixedNodeIDs.contains(joinNodeIDs[0]->getUniqueName());
+}
+
 void QueryPlanner::planExistsSubquery(
     std::shared_ptr<Expression>& expression, LogicalPlan& outerPlan) {
     assert(expression->expressionType == EXISTENTIAL_SUBQUERY);
@@ -338,6 +419,24 @@ void QueryPlanner::appendScanNodePropIfNecessary(const expression_vector& proper
     plan.setLastOperator(std::move(scanNodeProperty));
 }
 
+void QueryPlanner::appendScanDeferredPropIfNecessary(
+    const expression_vector& propertyExpressions, LogicalPlan& plan) {
+    for (auto& node : nodesWithDeferredProperties) {
+        if (!plan.getSchema()->isExpressionInScope(*node->getInternalIDProperty())) {
+            continue;
+        }
+        expression_vector propertyExpressionsOfNode;
+        for (auto& propertyExpression : propertyExpressions) {
+            auto property = (PropertyExpression*)propertyExpression.get();
+            if (isPropertyDeferred(*property) &&
+                property->getVariableName() == node->getUniqueName()) {
+                propertyExpressionsOfNode.push_back(propertyExpression);
+            }
+        }
+        appendScanNodePropIfNecessary(propertyExpressionsOfNode, node, plan);
+    }
+}
+
 std::unique_ptr<LogicalPlan> QueryPlanner::createUnionPlan(
     std::vector<std::unique_ptr<LogicalPlan>>& childrenPlans, bool isUnionAll) {
     assert(!childrenPlans.empty());
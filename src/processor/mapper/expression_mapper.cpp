@@ -1,6 +1,7 @@
 #include "processor/mapper/expression_mapper.h"
 
 #include "binder/expression/case_expression.h"
+#include "binder/expression/function_expression.h"
 #include "binder/expression/literal_expression.h"
 #include "binder/expression/parameter_expression.h"
 #include "expression_evaluator/case_evaluator.h"
@@ -27,6 +28,8 @@ std::unique_ptr<evaluator::BaseExpressionEvaluator> ExpressionMapper::mapExpress
         return mapParameterExpression(expression);
     } else if (CASE_ELSE == expressionType) {
         return mapCaseExpression(expression, schema);
+    } else if (canFuse(*expression, schema)) {
+        return mapFusedExpression(expression, schema);
     } else {
         return mapFunctionExpression(expression, schema);
     }
@@ -78,5 +81,130 @@ std::unique_ptr<evaluator::BaseExpressionEvaluator> ExpressionMapper::mapFunctio
     return std::make_unique<FunctionExpressionEvaluator>(expression, std::move(children));
 }
 
+std::unique_ptr<evaluator::BaseExpressionEvaluator> ExpressionMapper::mapFusedExpression(
+    const std::shared_ptr<binder::Expression>& expression, const Schema& schema) {
+    auto program = std::make_shared<FusedProgram>();
+    program->resultType = expression->dataType;
+    std::vector<std::unique_ptr<evaluator::BaseExpressionEvaluator>> leaves;
+    addFusedInstructions(expression, schema, *program, leaves);
+    return std::make_unique<FusedExpressionEvaluator>(std::move(program), std::move(leaves));
+}
+
+bool ExpressionMapper::canFuse(const Expression& expression, const Schema& schema) {
+    int64_t unflatGroupPos = -1;
+    return getNumFusibleOperators(expression, schema, unflatGroupPos) >= 2;
+}
+
+static bool isFusibleType(DataTypeID typeID) {
+    return typeID == INT64 || typeID == DOUBLE || typeID == BOOL;
+}
+
+int64_t ExpressionMapper::getNumFusibleOperators(
+    const Expression& expression, const Schema& schema, int64_t& unflatGroupPos) {
+    if (!isFusibleType(expression.dataType.typeID)) {
+        return -1;
+    }
+    if (schema.isExpressionInScope(expression)) {
+        auto groupPos = schema.getGroupPos(expression);
+        if (schema.getGroup(groupPos)->isFlat()) {
+            return 0;
+        }
+        if (unflatGroupPos != -1 && unflatGroupPos != groupPos) {
+            return -1;
+        }
+        unflatGroupPos = groupPos;
+        return 0;
+    }
+    if (LITERAL == expression.expressionType) {
+        return ((LiteralExpression&)expression).getValue()->isNull() ? -1 : 0;
+    }
+    if (getFusedOpType(expression) == FusedOpType::LEAF) {
+        return -1;
+    }
+    int64_t numOperators = 1;
+    for (auto i = 0u; i < expression.getNumChildren(); ++i) {
+        auto child = expression.getChild(i);
+        // Operands are never implicitly converted inside the fused evaluator.
+        if (child->dataType.typeID != expression.getChild(0)->dataType.typeID) {
+            return -1;
+        }
+        auto numChildOperators = getNumFusibleOperators(*child, schema, unflatGroupPos);
+        if (numChildOperators < 0) {
+            return -1;
+        }
+        numOperators += numChildOperators;
+    }
+    return numOperators;
+}
+
+FusedOpType ExpressionMapper::getFusedOpType(const Expression& expression) {
+    if (expression.getNumChildren() == 0) {
+        return FusedOpType::LEAF;
+    }
+    auto operandTypeID = expression.getChild(0)->dataType.typeID;
+    switch (expression.expressionType) {
+    case AND:
+        return FusedOpType::AND;
+    case OR:
+        return FusedOpType::OR;
+    case NOT:
+        return FusedOpType::NOT;
+    case EQUALS:
+        return operandTypeID == BOOL ? FusedOpType::LEAF : FusedOpType::EQUALS;
+    case NOT_EQUALS:
+        return operandTypeID == BOOL ? FusedOpType::LEAF : FusedOpType::NOT_EQUALS;
+    case GREATER_THAN:
+        return operandTypeID == BOOL ? FusedOpType::LEAF : FusedOpType::GREATER_THAN;
+    case GREATER_THAN_EQUALS:
+        return operandTypeID == BOOL ? FusedOpType::LEAF : FusedOpType::GREATER_THAN_EQUALS;
+    case LESS_THAN:
+        return operandTypeID == BOOL ? FusedOpType::LEAF : FusedOpType::LESS_THAN;
+    case LESS_THAN_EQUALS:
+        return operandTypeID == BOOL ? FusedOpType::LEAF : FusedOpType::LESS_THAN_EQUALS;
+    case FUNCTION: {
+        // Arithmetic operators must keep the type of their operands.
+        if (expression.getNumChildren() != 2 || operandTypeID == BOOL ||
+            operandTypeID != expression.dataType.typeID) {
+            return FusedOpType::LEAF;
+        }
+        auto functionName = ((FunctionExpression&)expression).getFunctionName();
+        if (functionName == ADD_FUNC_NAME) {
+            return FusedOpType::ADD;
+        } else if (functionName == SUBTRACT_FUNC_NAME) {
+            return FusedOpType::SUBTRACT;
+        } else if (functionName == MULTIPLY_FUNC_NAME) {
+            return FusedOpType::MULTIPLY;
+        }
+        return FusedOpType::LEAF;
+    }
+    default:
+        // LEAF means the expression is not a fusible operator.
+        return FusedOpType::LEAF;
+    }
+}
+
+uint32_t ExpressionMapper::addFusedInstructions(const std::shared_ptr<binder::Expression>& expression,
+    const Schema& schema, FusedProgram& program,
+    std::vector<std::unique_ptr<evaluator::BaseExpressionEvaluator>>& leaves) {
+    FusedInstruction instruction{};
+    if (schema.isExpressionInScope(*expression) || LITERAL == expression->expressionType) {
+        instruction.opType = FusedOpType::LEAF;
+        instruction.operandTypeID = expression->dataType.typeID;
+        instruction.leftIdx = leaves.size();
+        leaves.push_back(mapExpression(expression, schema));
+    } else {
+        instruction.opType = getFusedOpType(*expression);
+        instruction.operandTypeID = expression->getChild(0)->dataType.typeID;
+        instruction.leftIdx =
+            addFusedInstructions(expression->getChild(0), schema, program, leaves);
+        if (expression->getNumChildren() > 1) {
+            instruction.rightIdx =
+                addFusedInstructions(expression->getChild(1), schema, program, leaves);
+        }
+    }
+    program.instructions.push_back(instruction);
+    return program.instructions.size() - 1;
+}
+
 } // namespace processor
 } // namespace kuzu
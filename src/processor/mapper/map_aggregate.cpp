@@ -14,6 +14,29 @@ using namespace kuzu::planner;
 namespace kuzu {
 namespace processor {
 
+// For each aggregate, the unflat groups in scope that are neither its input nor a group by key.
+static std::vector<std::vector<uint32_t>> getDataChunksPosToMultiply(
+    const std::vector<DataPos>& inputAggVectorsPos, const expression_vector& groupByExpressions,
+    const Schema& inSchema) {
+    std::unordered_set<uint32_t> groupByKeyGroupsPos;
+    for (auto& expression : groupByExpressions) {
+        groupByKeyGroupsPos.insert(inSchema.getGroupPos(*expression));
+    }
+    std::vector<std::vector<uint32_t>> dataChunksPosToMultiply;
+    for (auto& inputAggVectorPos : inputAggVectorsPos) {
+        std::vector<uint32_t> dataChunksPos;
+        for (auto groupPos : inSchema.getGroupsPosInScope()) {
+            if (groupPos == inputAggVectorPos.dataChunkPos ||
+                groupByKeyGroupsPos.contains(groupPos) || inSchema.getGroup(groupPos)->isFlat()) {
+                continue;
+            }
+            dataChunksPos.push_back(groupPos);
+        }
+        dataChunksPosToMultiply.push_back(std::move(dataChunksPos));
+    }
+    return dataChunksPosToMultiply;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalAggregateToPhysical(
     LogicalOperator* logicalOperator) {
     auto& logicalAggregate = (const LogicalAggregate&)*logicalOperator;
@@ -44,9 +67,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalAggregateToPhysical(
             *outSchema, paramsString);
     } else {
         auto sharedState = make_shared<SimpleAggregateSharedState>(aggregateFunctions);
+        auto dataChunksPosToMultiply =
+            getDataChunksPosToMultiply(inputAggVectorsPos, expression_vector{}, *inSchema);
         auto aggregate = make_unique<SimpleAggregate>(
             std::make_unique<ResultSetDescriptor>(*inSchema), sharedState, inputAggVectorsPos,
-            std::move(aggregateFunctions), std::move(prevOperator), getOperatorID(), paramsString);
+            std::move(dataChunksPosToMultiply), std::move(aggregateFunctions),
+            std::move(prevOperator), getOperatorID(), paramsString);
         auto aggregateScan = make_unique<SimpleAggregateScan>(sharedState, outputAggVectorsPos,
             outputAggVectorsDataTypes, std::move(aggregate), getOperatorID(), paramsString);
         return aggregateScan;
@@ -88,11 +114,14 @@ std::unique_ptr<PhysicalOperator> PlanMapper::createHashAggregate(
     appendGroupByExpressions(groupByNonHashExpressions, inputGroupByNonHashKeyVectorsPos,
         outputGroupByKeyVectorsPos, outputGroupByKeyVectorsDataTypeId, inSchema, outSchema,
         isInputGroupByHashKeyVectorFlat);
+    auto dataChunksPosToMultiply =
+        getDataChunksPosToMultiply(inputAggVectorsPos, groupByExpressions, inSchema);
     auto sharedState = make_shared<HashAggregateSharedState>(aggregateFunctions);
     auto aggregate = make_unique<HashAggregate>(std::make_unique<ResultSetDescriptor>(inSchema),
         sharedState, inputGroupByHashKeyVectorsPos, inputGroupByNonHashKeyVectorsPos,
         isInputGroupByHashKeyVectorFlat, std::move(inputAggVectorsPos),
-        std::move(aggregateFunctions), std::move(prevOperator), getOperatorID(), paramsString);
+        std::move(dataChunksPosToMultiply), std::move(aggregateFunctions), std::move(prevOperator),
+        getOperatorID(), paramsString);
     auto aggregateScan = std::make_unique<HashAggregateScan>(sharedState,
         outputGroupByKeyVectorsPos, outputGroupByKeyVectorsDataTypeId,
         std::move(outputAggVectorsPos), std::move(outputAggVectorsDataType), std::move(aggregate),
@@ -1,5 +1,6 @@
 #include "planner/logical_plan/logical_operator/logical_add_property.h"
 #include "planner/logical_plan/logical_operator/logical_copy.h"
+#include "planner/logical_plan/logical_operator/logical_create_index.h"
 #include "planner/logical_plan/logical_operator/logical_create_node_table.h"
 #include "planner/logical_plan/logical_operator/logical_create_rel_table.h"
 #include "planner/logical_plan/logical_operator/logical_drop_property.h"
@@ -11,6 +12,7 @@
 #include "processor/operator/copy/copy_rel.h"
 #include "processor/operator/ddl/add_node_property.h"
 #include "processor/operator/ddl/add_rel_property.h"
+#include "processor/operator/ddl/create_index.h"
 #include "processor/operator/ddl/create_node_table.h"
 #include "processor/operator/ddl/create_rel_table.h"
 #include "processor/operator/ddl/drop_property.h"
@@ -115,5 +117,13 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalRenamePropertyToPhysical
         getOperatorID(), renameProperty->getExpressionsForPrinting());
 }
 
+std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalCreateIndexToPhysical(
+    LogicalOperator* logicalOperator) {
+    auto createIndex = (LogicalCreateIndex*)logicalOperator;
+    return std::make_unique<CreateIndex>(catalog, createIndex->getTableID(),
+        createIndex->getPropertyID(), storageManager, getOutputPos(createIndex), getOperatorID(),
+        createIndex->getExpressionsForPrinting());
+}
+
 } // namespace processor
 } // namespace kuzu
@@ -97,7 +97,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalExtendToPhysical(
                 return make_unique<ScanRelTableLists>(
                     relsStore.getRelTable(relTableID)->getDirectedTableData(direction),
                     std::move(propertyIds), inNodeIDVectorPos, std::move(outputVectorsPos),
-                    std::move(prevOperator), getOperatorID(), extend->getExpressionsForPrinting());
+                    extend->isCountOnly(), std::move(prevOperator), getOperatorID(),
+                    extend->getExpressionsForPrinting());
             }
         }
     } else { // map to generic extend
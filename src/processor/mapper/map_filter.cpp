@@ -2,6 +2,7 @@
 #include "processor/mapper/plan_mapper.h"
 #include "processor/operator/filter.h"
 
+using namespace kuzu::binder;
 using namespace kuzu::planner;
 
 namespace kuzu {
@@ -12,6 +13,10 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalFilterToPhysical(
     auto& logicalFilter = (const LogicalFilter&)*logicalOperator;
     auto inSchema = logicalFilter.getChild(0)->getSchema();
     auto prevOperator = mapLogicalOperatorToPhysical(logicalOperator->getChild(0));
+    if (!logicalFilter.getNodeToRestrict().empty()) {
+        addPropertyIndexLookups(expression_vector{logicalFilter.getPredicate()},
+            logicalOperator->getChild(0).get(), logicalFilter.getNodeToRestrict());
+    }
     auto physicalRootExpr = expressionMapper.mapExpression(logicalFilter.getPredicate(), *inSchema);
     return make_unique<Filter>(std::move(physicalRootExpr), logicalFilter.getGroupPosToSelect(),
         std::move(prevOperator), getOperatorID(), logicalFilter.getExpressionsForPrinting());
@@ -1,7 +1,9 @@
 #include "planner/logical_plan/logical_operator/logical_hash_join.h"
+#include "planner/logical_plan/logical_plan_util.h"
 #include "processor/mapper/plan_mapper.h"
 #include "processor/operator/hash_join/hash_join_build.h"
 #include "processor/operator/hash_join/hash_join_probe.h"
+#include "processor/operator/scan_node_id.h"
 
 using namespace kuzu::binder;
 using namespace kuzu::planner;
@@ -57,6 +59,16 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalHashJoinToPhysical(
         probePayloadsOutPos.emplace_back(outSchema->getExpressionPos(*expression));
     }
     auto sharedState = std::make_shared<HashJoinSharedState>();
+    if (hashJoin->getFilterProbeSideScan()) {
+        // Both sides have been mapped, so the physical scan can be looked up from the logical one.
+        auto logicalScanNode = LogicalPlanUtil::searchScanNodeOnPipeline(
+            hashJoin->getChild(0).get(), *hashJoin->getJoinNodeIDs()[0]);
+        assert(logicalScanNode != nullptr);
+        auto physicalScanNode = (ScanNodeID*)logicalOpToPhysicalOpMap.at(logicalScanNode);
+        auto joinKeyFilter = std::make_shared<JoinKeyFilter>();
+        physicalScanNode->getSharedState()->addJoinKeyFilter(joinKeyFilter);
+        sharedState->setJoinKeyFilter(std::move(joinKeyFilter));
+    }
     // create hashJoin build
     auto hashJoinBuild =
         make_unique<HashJoinBuild>(std::make_unique<ResultSetDescriptor>(*buildSchema), sharedState,
@@ -1,13 +1,76 @@
+#include "binder/expression/literal_expression.h"
+#include "binder/expression/parameter_expression.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node.h"
 #include "planner/logical_plan/logical_operator/logical_scan_node_property.h"
+#include "planner/logical_plan/logical_plan_util.h"
 #include "processor/mapper/plan_mapper.h"
 #include "processor/operator/scan/scan_node_table.h"
+#include "processor/operator/scan_node_id.h"
 
 using namespace kuzu::binder;
+using namespace kuzu::common;
 using namespace kuzu::planner;
 
 namespace kuzu {
 namespace processor {
 
+// "literal <op> property" is evaluated as "property <flipped op> literal".
+static ExpressionType flipComparison(ExpressionType comparisonType) {
+    switch (comparisonType) {
+    case GREATER_THAN:
+        return LESS_THAN;
+    case GREATER_THAN_EQUALS:
+        return LESS_THAN_EQUALS;
+    case LESS_THAN:
+        return GREATER_THAN;
+    case LESS_THAN_EQUALS:
+        return GREATER_THAN_EQUALS;
+    default:
+        return comparisonType;
+    }
+}
+
+static std::pair<uint32_t, storage::ColumnPredicate> getColumnPredicate(
+    const Expression& predicate, table_id_t tableID) {
+    auto isPropertyOnLeft = predicate.getChild(0)->expressionType == PROPERTY;
+    auto& property = (PropertyExpression&)*predicate.getChild(isPropertyOnLeft ? 0 : 1);
+    auto& literal = (LiteralExpression&)*predicate.getChild(isPropertyOnLeft ? 1 : 0);
+    auto comparisonType =
+        isPropertyOnLeft ? predicate.expressionType : flipComparison(predicate.expressionType);
+    return std::make_pair(property.getPropertyID(tableID),
+        storage::ColumnPredicate(comparisonType, *literal.getValue()));
+}
+
+void PlanMapper::addPropertyIndexLookups(const expression_vector& predicates,
+    LogicalOperator* logicalChild, const std::string& nodeName) {
+    // The child has been mapped, so the physical scan can be looked up from the logical one.
+    auto logicalScanNode = LogicalPlanUtil::searchScanNodeThroughFilters(logicalChild, nodeName);
+    if (logicalScanNode == nullptr) {
+        return;
+    }
+    auto tableID = ((LogicalScanNode*)logicalScanNode)->getNode()->getSingleTableID();
+    auto nodeTable = storageManager.getNodesStore().getNodeTable(tableID);
+    auto physicalScanNode = (ScanNodeID*)logicalOpToPhysicalOpMap.at(logicalScanNode);
+    for (auto& predicate : predicates) {
+        auto isPropertyOnLeft = predicate->getChild(0)->expressionType == PROPERTY;
+        auto& property = (PropertyExpression&)*predicate->getChild(isPropertyOnLeft ? 0 : 1);
+        auto& constant = *predicate->getChild(isPropertyOnLeft ? 1 : 0);
+        auto comparisonType = isPropertyOnLeft ? predicate->expressionType :
+                                                 flipComparison(predicate->expressionType);
+        // Parameters are bound before the plan is mapped.
+        auto value = constant.expressionType == LITERAL ?
+                         ((LiteralExpression&)constant).getValue() :
+                         ((ParameterExpression&)constant).getLiteral().get();
+        auto index = nodeTable->getPropertyIndex(property.getPropertyID(tableID));
+        if (index == nullptr || !storage::PropertyIndex::isSupportedComparison(comparisonType) ||
+            value->isNull() || value->getDataType() != property.dataType) {
+            continue;
+        }
+        physicalScanNode->getSharedState()->addPropertyIndexLookup(
+            PropertyIndexLookup{index, comparisonType, *value});
+    }
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalScanNodePropertyToPhysical(
     LogicalOperator* logicalOperator) {
     auto& scanProperty = (const LogicalScanNodeProperty&)*logicalOperator;
@@ -47,9 +110,17 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalScanNodePropertyToPhysic
             auto property = static_pointer_cast<PropertyExpression>(expression);
             columnIds.push_back(property->getPropertyID(tableID));
         }
+        column_predicates_t columnPredicates;
+        for (auto& predicate : scanProperty.getPredicates()) {
+            columnPredicates.push_back(getColumnPredicate(*predicate, tableID));
+        }
+        if (scanProperty.getRestrictScanNode()) {
+            addPropertyIndexLookups(scanProperty.getPredicates(),
+                logicalOperator->getChild(0).get(), node->getUniqueName());
+        }
         return std::make_unique<ScanSingleNodeTable>(inputNodeIDVectorPos, std::move(outVectorsPos),
-            nodeStore.getNodeTable(tableID), std::move(columnIds), std::move(prevOperator),
-            getOperatorID(), scanProperty.getExpressionsForPrinting());
+            nodeStore.getNodeTable(tableID), std::move(columnIds), std::move(columnPredicates),
+            std::move(prevOperator), getOperatorID(), scanProperty.getExpressionsForPrinting());
     }
 }
 
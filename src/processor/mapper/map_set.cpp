@@ -22,10 +22,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalSetNodePropertyToPhysica
         auto nodeIDPos = DataPos(inSchema->getExpressionPos(*node->getInternalIDProperty()));
         auto propertyExpression = static_pointer_cast<PropertyExpression>(lhs);
         auto nodeTableID = node->getSingleTableID();
-        auto column = nodeStore.getNodePropertyColumn(
-            nodeTableID, propertyExpression->getPropertyID(nodeTableID));
+        auto propertyID = propertyExpression->getPropertyID(nodeTableID);
+        auto column = nodeStore.getNodePropertyColumn(nodeTableID, propertyID);
+        auto index = nodeStore.getNodeTable(nodeTableID)->getPropertyIndex(propertyID);
         auto evaluator = expressionMapper.mapExpression(rhs, *inSchema);
-        infos.push_back(make_unique<SetNodePropertyInfo>(column, nodeIDPos, std::move(evaluator)));
+        infos.push_back(
+            make_unique<SetNodePropertyInfo>(column, index, nodeIDPos, std::move(evaluator)));
     }
     return std::make_unique<SetNodeProperty>(std::move(infos), std::move(prevOperator),
         getOperatorID(), logicalSetNodeProperty.getExpressionsForPrinting());
@@ -1,16 +1,51 @@
 #include "planner/logical_plan/logical_operator/logical_union.h"
 #include "processor/mapper/plan_mapper.h"
 #include "processor/operator/table_scan/union_all_scan.h"
+#include "processor/operator/union_all.h"
 
 using namespace kuzu::planner;
 
 namespace kuzu {
 namespace processor {
 
+// The output schema of a union is computed from its first child. The branches can be streamed if
+// every child has the same expressions flat and groups the unflat ones into data chunks like the
+// first child, so that each tuple of a child is a tuple of the output.
+static bool canStreamBranches(LogicalUnion& logicalUnion) {
+    auto firstSchema = logicalUnion.getSchemaBeforeUnion(0);
+    auto firstExpressions = firstSchema->getExpressionsInScope();
+    for (auto i = 1u; i < logicalUnion.getNumChildren(); ++i) {
+        auto schema = logicalUnion.getSchemaBeforeUnion(i);
+        auto expressions = schema->getExpressionsInScope();
+        for (auto j = 0u; j < expressions.size(); ++j) {
+            auto isFlat = schema->getGroup(expressions[j])->isFlat();
+            if (isFlat != firstSchema->getGroup(firstExpressions[j])->isFlat()) {
+                return false;
+            }
+            if (isFlat) {
+                continue;
+            }
+            for (auto k = 0u; k < j; ++k) {
+                auto isSameGroup =
+                    schema->getGroupPos(*expressions[j]) == schema->getGroupPos(*expressions[k]);
+                auto isSameGroupInFirst = firstSchema->getGroupPos(*firstExpressions[j]) ==
+                                          firstSchema->getGroupPos(*firstExpressions[k]);
+                if (isSameGroup != isSameGroupInFirst) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalUnionAllToPhysical(
     LogicalOperator* logicalOperator) {
     auto& logicalUnionAll = (LogicalUnion&)*logicalOperator;
     auto outSchema = logicalUnionAll.getSchema();
+    if (canStreamBranches(logicalUnionAll)) {
+        return mapLogicalUnionAllToStreamingPhysical(logicalOperator);
+    }
     // append result collectors to each child
     std::vector<std::unique_ptr<PhysicalOperator>> prevOperators;
     std::vector<std::shared_ptr<FTableSharedState>> resultCollectorSharedStates;
@@ -39,5 +74,32 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalUnionAllToPhysical(
         logicalUnionAll.getExpressionsForPrinting());
 }
 
+std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalUnionAllToStreamingPhysical(
+    LogicalOperator* logicalOperator) {
+    auto& logicalUnionAll = (LogicalUnion&)*logicalOperator;
+    auto outSchema = logicalUnionAll.getSchema();
+    std::vector<std::unique_ptr<PhysicalOperator>> prevOperators;
+    std::vector<std::unique_ptr<UnionAllBranchInfo>> branchInfos;
+    for (auto i = 0u; i < logicalOperator->getNumChildren(); ++i) {
+        auto childSchema = logicalUnionAll.getSchemaBeforeUnion(i);
+        std::vector<DataPos> inDataPoses;
+        for (auto& expression : childSchema->getExpressionsInScope()) {
+            inDataPoses.emplace_back(childSchema->getExpressionPos(*expression));
+        }
+        branchInfos.push_back(std::make_unique<UnionAllBranchInfo>(
+            std::make_unique<ResultSetDescriptor>(*childSchema), std::move(inDataPoses)));
+        prevOperators.push_back(mapLogicalOperatorToPhysical(logicalOperator->getChild(i)));
+    }
+    std::vector<DataPos> outDataPoses;
+    auto batchFlatTuples = true;
+    for (auto& expression : logicalUnionAll.getExpressionsToUnion()) {
+        outDataPoses.emplace_back(outSchema->getExpressionPos(*expression));
+        batchFlatTuples &= logicalUnionAll.getSchemaBeforeUnion(0)->getGroup(expression)->isFlat();
+    }
+    return make_unique<UnionAll>(std::move(outDataPoses), std::move(branchInfos),
+        batchFlatTuples, std::make_shared<UnionAllSharedState>(), std::move(prevOperators),
+        getOperatorID(), logicalUnionAll.getExpressionsForPrinting());
+}
+
 } // namespace processor
 } // namespace kuzu
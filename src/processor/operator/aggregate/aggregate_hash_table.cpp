@@ -22,6 +22,11 @@ AggregateHashTable::AggregateHashTable(MemoryManager& memoryManager,
       groupByNonHashKeysDataTypes{std::move(groupByNonHashKeysDataTypes)} {
     initializeFT(aggregateFunctions);
     initializeHashTable(numEntriesToAllocate);
+    isDirectAggregation = this->groupByHashKeysDataTypes.size() == 1 &&
+                          getDirectKeyFunc(this->groupByHashKeysDataTypes[0].typeID) != nullptr;
+    directKeyFunc = isDirectAggregation ?
+                        getDirectKeyFunc(this->groupByHashKeysDataTypes[0].typeID) :
+                        nullptr;
     distinctHashTables = AggregateHashTableUtils::createDistinctHashTables(
         memoryManager, this->groupByHashKeysDataTypes, this->aggregateFunctions);
     initializeTmpVectors();
@@ -30,14 +35,24 @@ AggregateHashTable::AggregateHashTable(MemoryManager& memoryManager,
 void AggregateHashTable::append(const std::vector<ValueVector*>& groupByFlatHashKeyVectors,
     const std::vector<ValueVector*>& groupByUnFlatHashKeyVectors,
     const std::vector<ValueVector*>& groupByNonHashKeyVectors,
-    const std::vector<ValueVector*>& aggregateVectors, uint64_t multiplicity) {
+    const std::vector<ValueVector*>& aggregateVectors,
+    const std::vector<uint64_t>& multiplicities) {
+    if (isDirectAggregation) {
+        if (findDirectSlots(
+                groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors, groupByNonHashKeyVectors)) {
+            updateAggStates(groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors,
+                aggregateVectors, multiplicities);
+            return;
+        }
+        switchToHashAggregation(getNumEntries());
+    }
     resizeHashTableIfNecessary(groupByUnFlatHashKeyVectors.empty() ?
                                    1 :
                                    groupByUnFlatHashKeyVectors[0]->state->selVector->selectedSize);
     computeVectorHashes(groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors);
     findHashSlots(groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors, groupByNonHashKeyVectors);
     updateAggStates(
-        groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors, aggregateVectors, multiplicity);
+        groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors, aggregateVectors, multiplicities);
 }
 
 bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
@@ -69,6 +84,9 @@ bool AggregateHashTable::isAggregateValueDistinctForGroupByKeys(
 }
 
 void AggregateHashTable::merge(AggregateHashTable& other) {
+    if (other.isDirectAggregation && !isDirectAggregation) {
+        other.computeEntryHashes();
+    }
     std::shared_ptr<DataChunkState> vectorsToScanState = std::make_shared<DataChunkState>();
     std::vector<ValueVector*> vectorsToScan(
         groupByHashKeysDataTypes.size() + groupByNonHashKeysDataTypes.size());
@@ -105,7 +123,19 @@ void AggregateHashTable::merge(AggregateHashTable& other) {
         auto numTuplesToScan = std::min(
             other.factorizedTable->getNumTuples() - startTupleIdx, DEFAULT_VECTOR_CAPACITY);
         other.factorizedTable->scan(vectorsToScan, startTupleIdx, numTuplesToScan, colIdxesToScan);
-        findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors);
+        if (isDirectAggregation) {
+            if (!findDirectSlots(
+                    std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors)) {
+                switchToHashAggregation(getNumEntries() + other.getNumEntries());
+                if (other.isDirectAggregation) {
+                    other.computeEntryHashes();
+                }
+                // Scan the tuples again, with their hash values.
+                continue;
+            }
+        } else {
+            findHashSlots(std::vector<ValueVector*>(), groupByHashVectors, groupByNonHashVectors);
+        }
         auto aggregateStateOffset = aggStateColOffsetInFT;
         for (auto& aggregateFunction : aggregateFunctions) {
             for (auto i = 0u; i < numTuplesToScan; i++) {
@@ -219,6 +249,10 @@ uint8_t* AggregateHashTable::findEntryInDistinctHT(
 }
 
 void AggregateHashTable::resize(uint64_t newSize) {
+    if (isDirectAggregation) {
+        rebuildDirectSlots(std::max(newSize, maxNumHashSlots));
+        return;
+    }
     maxNumHashSlots = newSize;
     bitmask = maxNumHashSlots - 1;
     addDataBlocksIfNecessary(maxNumHashSlots);
@@ -316,6 +350,191 @@ uint8_t* AggregateHashTable::createEntryInDistinctHT(
     return entry;
 }
 
+bool AggregateHashTable::findDirectSlots(
+    const std::vector<ValueVector*>& groupByFlatHashKeyVectors,
+    const std::vector<ValueVector*>& groupByUnflatHashKeyVectors,
+    const std::vector<ValueVector*>& groupByNonHashKeyVectors) {
+    auto keyVector = groupByFlatHashKeyVectors.empty() ? groupByUnflatHashKeyVectors[0] :
+                                                         groupByFlatHashKeyVectors[0];
+    // Slots are indexed by the key positions, which the update functions read through the state of
+    // the hash vector.
+    hashVector->state = keyVector->state;
+    auto selVector = keyVector->state->selVector.get();
+    auto numKeys = keyVector->state->isFlat() ? 1 : selVector->selectedSize;
+    auto numBytesPerKey = keyVector->getNumBytesPerValue();
+    auto isNodeIDKey = keyVector->dataType.typeID == INTERNAL_ID;
+    auto minKey = INT64_MAX;
+    auto maxKey = INT64_MIN;
+    for (auto i = 0u; i < numKeys; i++) {
+        auto pos = selVector->selectedPositions[i];
+        if (keyVector->isNull(pos)) {
+            continue;
+        }
+        auto key = keyVector->getData() + pos * numBytesPerKey;
+        if (isNodeIDKey && ((nodeID_t*)key)->tableID != directKeysTableID) {
+            if (directKeysTableID != INVALID_TABLE_ID) {
+                return false;
+            }
+            directKeysTableID = ((nodeID_t*)key)->tableID;
+        }
+        auto directKey = directKeyFunc(key);
+        minKey = std::min(minKey, directKey);
+        maxKey = std::max(maxKey, directKey);
+    }
+    if (minKey <= maxKey && !reserveDirectSlots(minKey, maxKey, numKeys)) {
+        return false;
+    }
+    uint64_t numFTEntriesToInitialize = 0;
+    for (auto i = 0u; i < numKeys; i++) {
+        auto pos = selVector->selectedPositions[i];
+        auto slotIdx =
+            keyVector->isNull(pos) ?
+                NULL_KEY_DIRECT_SLOT_IDX :
+                getDirectSlotIdx(directKeyFunc(keyVector->getData() + pos * numBytesPerKey));
+        auto slot = getHashSlot(slotIdx);
+        if (slot->entry == nullptr) {
+            entryIdxesToInitialize[numFTEntriesToInitialize++] = pos;
+            slot->entry = factorizedTable->appendEmptyTuple();
+        }
+        hashSlotsToUpdateAggState[pos] = slot;
+    }
+    initializeFTEntries(groupByFlatHashKeyVectors, groupByUnflatHashKeyVectors,
+        groupByNonHashKeyVectors, numFTEntriesToInitialize);
+    return true;
+}
+
+// The slots must cover the whole key range, and are allowed to be sparse by at most a constant
+// factor. Slots grow at least by a factor of two, with the extra slots on the side the range grows
+// towards, so that monotonically increasing (or decreasing) keys, e.g. node offsets in scan order,
+// cause a logarithmic number of rebuilds.
+bool AggregateHashTable::reserveDirectSlots(int64_t minKey, int64_t maxKey, uint64_t numNewKeys) {
+    auto newMinKey = hasDirectKeys ? std::min(minKey, minDirectKey) : minKey;
+    auto newMaxKey = hasDirectKeys ? std::max(maxKey, maxDirectKey) : maxKey;
+    if (isCoveredByDirectSlots(minKey) && isCoveredByDirectSlots(maxKey)) {
+        minDirectKey = newMinKey;
+        maxDirectKey = newMaxKey;
+        return true;
+    }
+    auto rangeSize = (uint64_t)newMaxKey - (uint64_t)newMinKey;
+    auto maxNumSlots = std::max(BufferPoolConstants::LARGE_PAGE_SIZE / sizeof(HashSlot),
+        (getNumEntries() + numNewKeys) * DIRECT_AGGREGATION_MAX_NUM_SLOTS_PER_ENTRY);
+    // One slot for each key in the range and one for the null key.
+    if (rangeSize > maxNumSlots - 2) {
+        return false;
+    }
+    auto numSlots = std::max(rangeSize + 2, hasDirectKeys ? 2 * maxNumHashSlots : maxNumHashSlots);
+    numSlots = std::min(numSlots, maxNumSlots);
+    auto numExtraSlots = numSlots - (rangeSize + 2);
+    if (hasDirectKeys && newMinKey < minDirectKey) {
+        directSlotsBaseKey =
+            newMinKey - (int64_t)std::min(numExtraSlots, (uint64_t)newMinKey - (uint64_t)INT64_MIN);
+    } else {
+        directSlotsBaseKey = newMinKey;
+    }
+    hasDirectKeys = true;
+    minDirectKey = newMinKey;
+    maxDirectKey = newMaxKey;
+    rebuildDirectSlots(numSlots);
+    return true;
+}
+
+void AggregateHashTable::rebuildDirectSlots(uint64_t numSlots) {
+    maxNumHashSlots = numSlots;
+    addDataBlocksIfNecessary(maxNumHashSlots);
+    for (auto& block : hashSlotsBlocks) {
+        block->resetToZero();
+    }
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            getHashSlot(getDirectSlotIdx(tuple))->entry = tuple;
+            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
+        }
+    }
+}
+
+// The key is always the first column of the entry.
+uint64_t AggregateHashTable::getDirectSlotIdx(const uint8_t* entry) const {
+    return factorizedTable->isNonOverflowColNull(
+               entry + factorizedTable->getTableSchema()->getNullMapOffset(), 0 /* colIdx */) ?
+               NULL_KEY_DIRECT_SLOT_IDX :
+               getDirectSlotIdx(directKeyFunc(entry));
+}
+
+void AggregateHashTable::switchToHashAggregation(uint64_t numEntriesToReserve) {
+    assert(isDirectAggregation);
+    isDirectAggregation = false;
+    computeEntryHashes();
+    resize(nextPowerOfTwo(std::max(maxNumHashSlots, 2 * numEntriesToReserve)));
+}
+
+template<typename T>
+void AggregateHashTable::computeEntryHashes() {
+    auto nullMapOffset = factorizedTable->getTableSchema()->getNullMapOffset();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        uint8_t* tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            auto isNull = factorizedTable->isNonOverflowColNull(tuple + nullMapOffset, 0);
+            Hash::operation(*(T*)tuple, isNull, *(hash_t*)(tuple + hashColOffsetInFT));
+            tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
+        }
+    }
+}
+
+void AggregateHashTable::computeEntryHashes() {
+    switch (groupByHashKeysDataTypes[0].typeID) {
+    case INTERNAL_ID: {
+        computeEntryHashes<nodeID_t>();
+    } break;
+    case BOOL: {
+        computeEntryHashes<bool>();
+    } break;
+    case INT64: {
+        computeEntryHashes<int64_t>();
+    } break;
+    case INT32: {
+        computeEntryHashes<int32_t>();
+    } break;
+    case INT16: {
+        computeEntryHashes<int16_t>();
+    } break;
+    default:
+        assert(false);
+    }
+}
+
+template<typename T>
+int64_t AggregateHashTable::getDirectKey(const uint8_t* key) {
+    if constexpr (std::is_same_v<T, nodeID_t>) {
+        return (int64_t)((nodeID_t*)key)->offset;
+    } else {
+        return *(T*)key;
+    }
+}
+
+get_direct_key_function_t AggregateHashTable::getDirectKeyFunc(DataTypeID typeID) {
+    switch (typeID) {
+    case INTERNAL_ID: {
+        return getDirectKey<nodeID_t>;
+    }
+    case BOOL: {
+        return getDirectKey<bool>;
+    }
+    case INT64: {
+        return getDirectKey<int64_t>;
+    }
+    case INT32: {
+        return getDirectKey<int32_t>;
+    }
+    case INT16: {
+        return getDirectKey<int16_t>;
+    }
+    default: {
+        return nullptr;
+    }
+    }
+}
+
 void AggregateHashTable::increaseSlotIdx(uint64_t& slotIdx) const {
     slotIdx++;
     if (slotIdx >= maxNumHashSlots) {
@@ -474,11 +693,12 @@ void AggregateHashTable::updateAggState(const std::vector<ValueVector*>& groupBy
 
 void AggregateHashTable::updateAggStates(const std::vector<ValueVector*>& groupByFlatHashKeyVectors,
     const std::vector<ValueVector*>& groupByUnFlatHashKeyVectors,
-    const std::vector<ValueVector*>& aggregateVectors, uint64_t multiplicity) {
+    const std::vector<ValueVector*>& aggregateVectors,
+    const std::vector<uint64_t>& multiplicities) {
     auto aggregateStateOffset = aggStateColOffsetInFT;
     for (auto i = 0u; i < aggregateFunctions.size(); i++) {
         updateAggFuncs[i](this, groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors,
-            aggregateFunctions[i], aggregateVectors[i], multiplicity, i, aggregateStateOffset);
+            aggregateFunctions[i], aggregateVectors[i], multiplicities[i], i, aggregateStateOffset);
         aggregateStateOffset += aggregateFunctions[i]->getAggregateStateSize();
     }
 }
@@ -32,6 +32,13 @@ void BaseAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
             aggregateVectors.push_back(vector.get());
         }
     }
+    for (auto& dataChunksPos : dataChunksPosToMultiply) {
+        std::vector<common::DataChunkState*> states;
+        for (auto dataChunkPos : dataChunksPos) {
+            states.push_back(resultSet->dataChunks[dataChunkPos]->state.get());
+        }
+        statesToMultiply.push_back(std::move(states));
+    }
 }
 
 } // namespace processor
@@ -70,9 +70,13 @@ void HashAggregate::initLocalStateInternal(ResultSet* resultSet, ExecutionContex
 }
 
 void HashAggregate::executeInternal(ExecutionContext* context) {
+    multiplicities.resize(aggregateFunctions.size());
     while (children[0]->getNextTuple()) {
+        for (auto i = 0u; i < aggregateFunctions.size(); i++) {
+            multiplicities[i] = getMultiplicity(i);
+        }
         localAggregateHashTable->append(groupByFlatHashKeyVectors, groupByUnflatHashKeyVectors,
-            groupByNonHashKeyVectors, aggregateVectors, resultSet->multiplicity);
+            groupByNonHashKeyVectors, aggregateVectors, multiplicities);
     }
     sharedState->appendAggregateHashTable(std::move(localAggregateHashTable));
 }
@@ -89,8 +93,8 @@ std::unique_ptr<PhysicalOperator> HashAggregate::clone() {
     }
     return make_unique<HashAggregate>(resultSetDescriptor->copy(), sharedState,
         groupByHashKeyVectorsPos, groupByNonHashKeyVectorsPos, isGroupByHashKeyVectorFlat,
-        aggregateVectorsPos, std::move(clonedAggregateFunctions), children[0]->clone(), id,
-        paramsString);
+        aggregateVectorsPos, dataChunksPosToMultiply, std::move(clonedAggregateFunctions),
+        children[0]->clone(), id, paramsString);
 }
 
 } // namespace processor
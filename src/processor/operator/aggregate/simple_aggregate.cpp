@@ -71,16 +71,17 @@ void SimpleAggregate::executeInternal(ExecutionContext* context) {
                     }
                 }
             } else {
+                auto multiplicity = getMultiplicity(i);
                 if (aggVector && aggVector->state->isFlat()) {
                     if (!aggVector->isNull(aggVector->state->selVector->selectedPositions[0])) {
                         aggregateFunction->updatePosState((uint8_t*)localAggregateStates[i].get(),
-                            aggVector, resultSet->multiplicity,
+                            aggVector, multiplicity,
                             aggVector->state->selVector->selectedPositions[0],
                             context->memoryManager);
                     }
                 } else {
                     aggregateFunction->updateAllState((uint8_t*)localAggregateStates[i].get(),
-                        aggVector, resultSet->multiplicity, context->memoryManager);
+                        aggVector, multiplicity, context->memoryManager);
                 }
             }
         }
@@ -94,8 +95,8 @@ std::unique_ptr<PhysicalOperator> SimpleAggregate::clone() {
         clonedAggregateFunctions.push_back(aggregateFunction->clone());
     }
     return make_unique<SimpleAggregate>(resultSetDescriptor->copy(), sharedState,
-        aggregateVectorsPos, std::move(clonedAggregateFunctions), children[0]->clone(), id,
-        paramsString);
+        aggregateVectorsPos, dataChunksPosToMultiply, std::move(clonedAggregateFunctions),
+        children[0]->clone(), id, paramsString);
 }
 
 } // namespace processor
@@ -12,10 +12,22 @@ uint64_t CopyRel::executeInternal(
     auto relCSVCopier = make_unique<CopyRelArrow>(copyDescription, wal->getDirectory(),
         *taskScheduler, *catalog, nodesStatistics->getMaxNodeOffsetPerTable(),
         executionContext->bufferManager, tableID, relsStatistics);
-    auto numRelsCopied = relCSVCopier->copy();
+    numRelsCopied = relCSVCopier->copy();
+    phaseTimesMS = relCSVCopier->getPhaseTimesMS();
     wal->logCopyRelRecord(tableID);
     return numRelsCopied;
 }
 
+std::unordered_map<std::string, std::string> CopyRel::getProfilerKeyValAttributes(
+    common::Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    for (auto& [phaseName, timeMS] : phaseTimesMS) {
+        result.insert({phaseName + "Time", std::to_string(timeMS)});
+        auto relsPerSecond = timeMS == 0 ? 0 : (uint64_t)(numRelsCopied * 1000 / timeMS);
+        result.insert({phaseName + "RelsPerSecond", std::to_string(relsPerSecond)});
+    }
+    return result;
+}
+
 } // namespace processor
 } // namespace kuzu
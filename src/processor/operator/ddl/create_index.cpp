@@ -0,0 +1,31 @@
+#include "processor/operator/ddl/create_index.h"
+
+using namespace kuzu::common;
+using namespace kuzu::storage;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace processor {
+
+// The index file is written from the committed values of the property and replaces the original
+// version at checkpoint, like the files of COPY.
+void CreateIndex::executeDDLInternal() {
+    auto property = catalog->getReadOnlyVersion()->getTableSchema(tableID)->getProperty(propertyID);
+    auto nodeTable = storageManager.getNodesStore().getNodeTable(tableID);
+    auto readOnlyTrx = Transaction::getDummyReadOnlyTrx();
+    std::vector<PropertyIndexEntry> entries;
+    PropertyIndex::appendEntries(readOnlyTrx.get(), nodeTable->getPropertyColumn(propertyID),
+        property.dataType, tableID, nodeTable->getMaxNodeOffset(readOnlyTrx.get()), memoryManager,
+        entries);
+    auto propertyIndexBuilder =
+        std::make_unique<PropertyIndexBuilder>(StorageUtils::getPropertyIndexFName(
+            storageManager.getDirectory(), tableID, propertyID, DBFileType::WAL_VERSION));
+    for (auto& entry : entries) {
+        propertyIndexBuilder->append(entry.key, entry.nodeOffset);
+    }
+    propertyIndexBuilder->flush();
+    catalog->addPropertyIndex(tableID, propertyID);
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -72,6 +72,9 @@ void HashJoinBuild::finalize(ExecutionContext* context) {
     auto numTuples = sharedState->getHashTable()->getNumTuples();
     sharedState->getHashTable()->allocateHashSlots(numTuples);
     sharedState->getHashTable()->buildHashSlots();
+    if (sharedState->getJoinKeyFilter() != nullptr) {
+        sharedState->getJoinKeyFilter()->build(*sharedState->getHashTable());
+    }
 }
 
 void HashJoinBuild::executeInternal(ExecutionContext* context) {
@@ -48,24 +48,17 @@ bool HashJoinProbe::getNextBatchOfMatchedTuples() {
         sharedState->getHashTable()->probe(keyVectors, probeState->probedTuples.get());
     }
     auto numMatchedTuples = 0;
+    auto numVisitedEntries = 0u;
     auto keyState = keyVectors[0]->state.get();
     if (keyState->isFlat()) {
-        // probe side is flat.
+        // probe side is flat. All tuples of a chain have the probed keys.
         while (probeState->probedTuples[0]) {
             if (numMatchedTuples == DEFAULT_VECTOR_CAPACITY) {
                 break;
             }
             auto currentTuple = probeState->probedTuples[0];
-            probeState->matchedTuples[numMatchedTuples] = currentTuple;
-            bool isKeysEqual = true;
-            for (auto i = 0u; i < keyVectors.size(); i++) {
-                auto pos = keyVectors[i]->state->selVector->selectedPositions[0];
-                if (((nodeID_t*)currentTuple)[i] != keyVectors[i]->getValue<nodeID_t>(pos)) {
-                    isKeysEqual = false;
-                    break;
-                }
-            }
-            numMatchedTuples += isKeysEqual;
+            probeState->matchedTuples[numMatchedTuples++] = currentTuple;
+            numVisitedEntries++;
             probeState->probedTuples[0] = *sharedState->getHashTable()->getPrevTuple(currentTuple);
         }
     } else {
@@ -76,14 +69,14 @@ bool HashJoinProbe::getNextBatchOfMatchedTuples() {
                 assert(numMatchedTuples <= DEFAULT_VECTOR_CAPACITY);
                 auto currentTuple = probeState->probedTuples[i];
                 probeState->matchedTuples[numMatchedTuples] = currentTuple;
-                probeState->matchedSelVector->selectedPositions[numMatchedTuples] = pos;
-                numMatchedTuples +=
-                    *(nodeID_t*)currentTuple == keyVectors[0]->getValue<nodeID_t>(pos);
+                probeState->matchedSelVector->selectedPositions[numMatchedTuples++] = pos;
+                numVisitedEntries++;
                 probeState->probedTuples[i] =
                     *sharedState->getHashTable()->getPrevTuple(currentTuple);
             }
         }
     }
+    ResourceCounters::getThreadLocalCounters().numHashChainEntriesVisited += numVisitedEntries;
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
     return true;
@@ -11,8 +11,9 @@ namespace processor {
 
 JoinHashTable::JoinHashTable(MemoryManager& memoryManager, uint64_t numKeyColumns,
     std::unique_ptr<FactorizedTableSchema> tableSchema)
-    : BaseHashTable{memoryManager}, numKeyColumns{numKeyColumns} {
-    auto numSlotsPerBlock = BufferPoolConstants::LARGE_PAGE_SIZE / sizeof(uint8_t*);
+    : BaseHashTable{memoryManager}, numKeyColumns{numKeyColumns},
+      keyTableID{INVALID_TABLE_ID}, hasInlineKeys{false} {
+    auto numSlotsPerBlock = BufferPoolConstants::LARGE_PAGE_SIZE / sizeof(JoinHashSlot);
     assert(numSlotsPerBlock == nextPowerOfTwo(numSlotsPerBlock));
     numSlotsPerBlockLog2 = std::log2(numSlotsPerBlock);
     slotIdxInBlockMask = BitmaskUtils::all1sMaskForLeastSignificantBits(numSlotsPerBlockLog2);
@@ -59,7 +60,8 @@ void JoinHashTable::append(const std::vector<ValueVector*>& vectorsToAppend) {
 }
 
 void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
-    maxNumHashSlots = nextPowerOfTwo(numTuples * 2);
+    // Keeps at least one empty slot, which terminates every probe.
+    maxNumHashSlots = nextPowerOfTwo(std::max<uint64_t>(numTuples * 2, 1));
     bitmask = maxNumHashSlots - 1;
     auto numSlotsPerBlock = (uint64_t)1 << numSlotsPerBlockLog2;
     auto numBlocksNeeded = (maxNumHashSlots + numSlotsPerBlock - 1) / numSlotsPerBlock;
@@ -69,15 +71,19 @@ void JoinHashTable::allocateHashSlots(uint64_t numTuples) {
 }
 
 void JoinHashTable::buildHashSlots() {
+    hasInlineKeys = false;
+    auto isSingleKeyTableID = numKeyColumns == 1;
     for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
         uint8_t* tuple = tupleBlock->getData();
         for (auto i = 0u; i < tupleBlock->numTuples; i++) {
             auto lastSlotEntryInHT = insertEntry(tuple);
             auto prevPtr = getPrevTuple(tuple);
             memcpy(prevPtr, &lastSlotEntryInHT, sizeof(uint8_t*));
+            isSingleKeyTableID &= ((nodeID_t*)tuple)->tableID == keyTableID;
             tuple += factorizedTable->getTableSchema()->getNumBytesPerTuple();
         }
     }
+    hasInlineKeys = isSingleKeyTableID;
 }
 
 void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, uint8_t** probedTuples) {
@@ -97,29 +103,69 @@ void JoinHashTable::probe(const std::vector<ValueVector*>& keyVectors, uint8_t**
         function::VectorHashOperations::combineHash(
             hashVector.get(), tmpHashVector.get(), hashVector.get());
     }
-    for (auto i = 0u; i < hashVector->state->selVector->selectedSize; i++) {
-        auto pos = hashVector->state->selVector->selectedPositions[i];
-        probedTuples[i] = getTupleForHash(hashVector->getValue<hash_t>(pos));
+    auto selVector = hashVector->state->selVector.get();
+    auto hashes = (hash_t*)hashVector->getData();
+    // Slots of different keys are in different cache lines, so we issue the loads of all slots of
+    // the batch before waiting for any of them.
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        __builtin_prefetch(getHashSlot(getSlotIdxForHash(hashes[pos])));
+    }
+    std::vector<nodeID_t> keys(numKeyColumns);
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        for (auto j = 0u; j < numKeyColumns; j++) {
+            auto keyState = keyVectors[j]->state.get();
+            keys[j] = keyVectors[j]->getValue<nodeID_t>(
+                keyState->isFlat() ? keyState->selVector->selectedPositions[0] : pos);
+        }
+        probedTuples[i] = findTuple(hashes[pos], keys.data());
+        if (probedTuples[i] != nullptr) {
+            __builtin_prefetch(probedTuples[i]);
+        }
     }
 }
 
-uint8_t** JoinHashTable::findHashSlot(nodeID_t* nodeIDs) const {
+// With inline keys, i.e. a single key column whose build side keys all have keyTableID, the tag
+// holds the key and the probe never reads tuples of the directory.
+uint8_t* JoinHashTable::findTuple(hash_t hash, const nodeID_t* keys) const {
+    if (hasInlineKeys && keys[0].tableID != keyTableID) {
+        return nullptr;
+    }
+    auto tag = getTag(hash, keys[0]);
+    for (auto slotIdx = getSlotIdxForHash(hash);; slotIdx = (slotIdx + 1) & bitmask) {
+        auto slot = getHashSlot(slotIdx);
+        if (slot->tuple == nullptr) {
+            return nullptr;
+        }
+        if (slot->tag == tag && (hasInlineKeys || isKeysEqual(slot->tuple, keys))) {
+            return slot->tuple;
+        }
+    }
+}
+
+uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) {
+    auto keys = (nodeID_t*)tuple;
     hash_t hash;
-    Hash::operation<nodeID_t>(nodeIDs[0], false /* isNull */, hash);
+    Hash::operation<nodeID_t>(keys[0], false /* isNull */, hash);
     for (auto i = 1u; i < numKeyColumns; i++) {
         hash_t newHash;
-        Hash::operation<nodeID_t>(nodeIDs[i], false /* isNull */, newHash);
+        Hash::operation<nodeID_t>(keys[i], false /* isNull */, newHash);
         CombineHash::operation(hash, newHash, hash);
     }
+    if (keyTableID == INVALID_TABLE_ID) {
+        keyTableID = keys[0].tableID;
+    }
+    auto tag = getTag(hash, keys[0]);
     auto slotIdx = getSlotIdxForHash(hash);
-    return (uint8_t**)(hashSlotsBlocks[slotIdx >> numSlotsPerBlockLog2]->getData() +
-                       (slotIdx & slotIdxInBlockMask) * sizeof(uint8_t*));
-}
-
-uint8_t* JoinHashTable::insertEntry(uint8_t* tuple) const {
-    auto slot = findHashSlot((nodeID_t*)tuple);
-    auto prevPtr = *slot;
-    *slot = tuple;
+    auto slot = getHashSlot(slotIdx);
+    while (slot->tuple != nullptr && (slot->tag != tag || !isKeysEqual(slot->tuple, keys))) {
+        slotIdx = (slotIdx + 1) & bitmask;
+        slot = getHashSlot(slotIdx);
+    }
+    auto prevPtr = slot->tuple;
+    slot->tag = tag;
+    slot->tuple = tuple;
     return prevPtr;
 }
 
@@ -0,0 +1,37 @@
+#include "processor/operator/hash_join/join_key_filter.h"
+
+#include "processor/operator/hash_join/join_hash_table.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function::operation;
+
+namespace kuzu {
+namespace processor {
+
+BlockedBloomFilter::BlockedBloomFilter(uint64_t numKeys) {
+    auto numWords = nextPowerOfTwo(std::max<uint64_t>(numKeys * NUM_BITS_PER_KEY / 64, 1));
+    words = std::make_unique<uint64_t[]>(numWords);
+    std::fill(words.get(), words.get() + numWords, 0);
+    wordIdxMask = numWords - 1;
+}
+
+void JoinKeyFilter::build(JoinHashTable& hashTable) {
+    assert(bloomFilter == nullptr);
+    numKeys = hashTable.getNumTuples();
+    bloomFilter = std::make_unique<BlockedBloomFilter>(numKeys);
+    auto factorizedTable = hashTable.getFactorizedTable();
+    auto numBytesPerTuple = factorizedTable->getTableSchema()->getNumBytesPerTuple();
+    for (auto& tupleBlock : factorizedTable->getTupleDataBlocks()) {
+        auto tuple = tupleBlock->getData();
+        for (auto i = 0u; i < tupleBlock->numTuples; i++) {
+            // The join key is always the first column of the hash table.
+            hash_t hash;
+            Hash::operation(*(nodeID_t*)tuple, hash);
+            bloomFilter->insert(hash);
+            tuple += numBytesPerTuple;
+        }
+    }
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -1,6 +1,7 @@
 #include "processor/operator/intersect/intersect.h"
 
 #include <algorithm>
+#include <numeric>
 
 using namespace kuzu::common;
 using namespace kuzu::function::operation;
@@ -35,18 +36,15 @@ void Intersect::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* c
 
 void Intersect::probeHTs() {
     std::vector<std::vector<overflow_value_t>> flatTuples(probeKeyVectors.size());
-    hash_t hashVal;
     for (auto i = 0u; i < probeKeyVectors.size(); i++) {
         assert(probeKeyVectors[i]->state->isFlat());
         probedFlatTuples[i].clear();
         auto key = probeKeyVectors[i]->getValue<nodeID_t>(
             probeKeyVectors[i]->state->selVector->selectedPositions[0]);
-        Hash::operation<nodeID_t>(key, false, hashVal);
-        auto flatTuple = sharedHTs[i]->getHashTable()->getTupleForHash(hashVal);
+        auto flatTuple = sharedHTs[i]->getHashTable()->getTupleForKey(key);
         while (flatTuple) {
-            if (*(nodeID_t*)flatTuple == key) {
-                probedFlatTuples[i].push_back(flatTuple);
-            }
+            probedFlatTuples[i].push_back(flatTuple);
+            ResourceCounters::getThreadLocalCounters().numHashChainEntriesVisited++;
             flatTuple = *sharedHTs[i]->getHashTable()->getPrevTuple(flatTuple);
         }
     }
@@ -55,26 +53,63 @@ void Intersect::probeHTs() {
 void Intersect::twoWayIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
     nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     assert(lSelVector.selectedSize <= rSelVector.selectedSize);
+    auto numOutputValues =
+        (uint64_t)lSelVector.selectedSize * GALLOPING_SIZE_RATIO < rSelVector.selectedSize ?
+            gallopingIntersect(leftNodeIDs, lSelVector, rightNodeIDs, rSelVector) :
+            mergeIntersect(leftNodeIDs, lSelVector, rightNodeIDs, rSelVector);
+    lSelVector.resetSelectorToValuePosBufferWithSize(numOutputValues);
+    rSelVector.resetSelectorToValuePosBufferWithSize(numOutputValues);
+}
+
+uint64_t Intersect::mergeIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
+    nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
     sel_t leftPosition = 0, rightPosition = 0;
     uint64_t outputValuePosition = 0;
     while (leftPosition < lSelVector.selectedSize && rightPosition < rSelVector.selectedSize) {
         auto leftNodeID = leftNodeIDs[leftPosition];
-        auto rightNodeID = rightNodeIDs[rightPosition];
-        if (leftNodeID.offset < rightNodeID.offset) {
-            leftPosition++;
-        } else if (leftNodeID.offset > rightNodeID.offset) {
-            rightPosition++;
-        } else {
+        auto leftOffset = leftNodeID.offset;
+        auto rightOffset = rightNodeIDs[rightPosition].offset;
+        if (leftOffset == rightOffset) {
             lSelVector.getSelectedPositionsBuffer()[outputValuePosition] = leftPosition;
             rSelVector.getSelectedPositionsBuffer()[outputValuePosition] = rightPosition;
             leftNodeIDs[outputValuePosition] = leftNodeID;
-            leftPosition++;
-            rightPosition++;
             outputValuePosition++;
         }
+        // Advance without branching on which side is smaller, as the outcome is unpredictable.
+        leftPosition += leftOffset <= rightOffset;
+        rightPosition += rightOffset <= leftOffset;
     }
-    lSelVector.resetSelectorToValuePosBufferWithSize(outputValuePosition);
-    rSelVector.resetSelectorToValuePosBufferWithSize(outputValuePosition);
+    return outputValuePosition;
+}
+
+uint64_t Intersect::gallopingIntersect(nodeID_t* leftNodeIDs, SelectionVector& lSelVector,
+    nodeID_t* rightNodeIDs, SelectionVector& rSelVector) {
+    auto rightEnd = rightNodeIDs + rSelVector.selectedSize;
+    auto rightIt = rightNodeIDs;
+    uint64_t outputValuePosition = 0;
+    for (sel_t leftPosition = 0; leftPosition < lSelVector.selectedSize; leftPosition++) {
+        auto leftNodeID = leftNodeIDs[leftPosition];
+        // Exponential search for a range of the right list that holds the left offset, followed
+        // by a binary search within that range.
+        uint64_t step = 1;
+        while (step < (uint64_t)(rightEnd - rightIt) && rightIt[step].offset < leftNodeID.offset) {
+            step <<= 1;
+        }
+        auto rangeEnd = rightIt + std::min<uint64_t>(step + 1, rightEnd - rightIt);
+        rightIt = std::lower_bound(rightIt + (step >> 1), rangeEnd, leftNodeID,
+            [](const nodeID_t& a, const nodeID_t& b) { return a.offset < b.offset; });
+        if (rightIt == rightEnd) {
+            break;
+        }
+        if (rightIt->offset == leftNodeID.offset) {
+            lSelVector.getSelectedPositionsBuffer()[outputValuePosition] = leftPosition;
+            rSelVector.getSelectedPositionsBuffer()[outputValuePosition] = rightIt - rightNodeIDs;
+            leftNodeIDs[outputValuePosition] = leftNodeID;
+            outputValuePosition++;
+            rightIt++;
+        }
+    }
+    return outputValuePosition;
 }
 
 static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
@@ -88,20 +123,20 @@ static std::vector<overflow_value_t> fetchListsToIntersectFromTuples(
     return listsToIntersect;
 }
 
-static std::vector<uint32_t> swapSmallestListToFront(std::vector<overflow_value_t>& lists) {
+// Lists are intersected from the smallest to the largest, so that each intersection is driven by
+// the smallest intermediate result and large lists are searched rather than scanned.
+static std::vector<uint32_t> sortListsBySize(std::vector<overflow_value_t>& lists) {
     assert(lists.size() >= 2);
     std::vector<uint32_t> listIdxes(lists.size());
     iota(listIdxes.begin(), listIdxes.end(), 0);
-    uint32_t smallestListIdx = 0;
-    for (auto i = 1u; i < lists.size(); i++) {
-        if (lists[i].numElements < lists[smallestListIdx].numElements) {
-            smallestListIdx = i;
-        }
-    }
-    if (smallestListIdx != 0) {
-        std::swap(lists[smallestListIdx], lists[0]);
-        std::swap(listIdxes[smallestListIdx], listIdxes[0]);
+    std::stable_sort(listIdxes.begin(), listIdxes.end(), [&lists](uint32_t a, uint32_t b) {
+        return lists[a].numElements < lists[b].numElements;
+    });
+    std::vector<overflow_value_t> sortedLists(lists.size());
+    for (auto i = 0u; i < listIdxes.size(); i++) {
+        sortedLists[i] = lists[listIdxes[i]];
     }
+    lists = std::move(sortedLists);
     return listIdxes;
 }
 
@@ -147,7 +182,7 @@ void Intersect::populatePayloads(
     const std::vector<uint8_t*>& tuples, const std::vector<uint32_t>& listIdxes) {
     for (auto i = 0u; i < listIdxes.size(); i++) {
         auto listIdx = listIdxes[i];
-        sharedHTs[i]->getHashTable()->getFactorizedTable()->lookup(
+        sharedHTs[listIdx]->getHashTable()->getFactorizedTable()->lookup(
             payloadVectorsToScanInto[listIdx], intersectSelVectors[i].get(),
             payloadColumnIdxesToScanFrom[listIdx], tuples[listIdx]);
     }
@@ -199,7 +234,7 @@ bool Intersect::getNextTuplesInternal() {
         }
         auto listsToIntersect =
             fetchListsToIntersectFromTuples(flatTuplesToIntersect, isIntersectListAFlatValue);
-        auto listIdxes = swapSmallestListToFront(listsToIntersect);
+        auto listIdxes = sortListsBySize(listsToIntersect);
         intersectLists(listsToIntersect);
         if (outKeyVector->state->selVector->selectedSize != 0) {
             populatePayloads(flatTuplesToIntersect, listIdxes);
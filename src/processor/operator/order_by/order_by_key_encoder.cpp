@@ -310,7 +310,7 @@ void OrderByKeyEncoder::encodeData(interval_t data, uint8_t* resultPtr, bool swa
 template<>
 void OrderByKeyEncoder::encodeData(ku_string_t data, uint8_t* resultPtr, bool swapBytes) {
     // Only encode the prefix of ku_string.
-    memcpy(resultPtr, (void*)data.getAsString().c_str(),
+    memcpy(resultPtr, (void*)data.getData(),
         std::min((uint32_t)ku_string_t::SHORT_STR_LENGTH, data.len));
     if (ku_string_t::isShortString(data.len)) {
         memset(resultPtr + data.len, '\0', ku_string_t::SHORT_STR_LENGTH + 1 - data.len);
@@ -26,6 +26,9 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
     case PhysicalOperatorType::COPY_REL: {
         return "COPY_REL";
     }
+    case PhysicalOperatorType::CREATE_INDEX: {
+        return "CREATE_INDEX";
+    }
     case PhysicalOperatorType::CREATE_NODE: {
         return "CREATE_NODE";
     }
@@ -134,6 +137,9 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
     case PhysicalOperatorType::ORDER_BY_SCAN: {
         return "ORDER_BY_SCAN";
     }
+    case PhysicalOperatorType::UNION_ALL: {
+        return "UNION_ALL";
+    }
     case PhysicalOperatorType::UNION_ALL_SCAN: {
         return "UNION_ALL_SCAN";
     }
@@ -192,11 +198,13 @@ void PhysicalOperator::initGlobalState(ExecutionContext* context) {
 }
 
 void PhysicalOperator::initLocalState(ResultSet* resultSet_, ExecutionContext* context) {
-    if (!children.empty()) {
+    // A source with children, i.e. UnionAll, initializes them with their own result sets.
+    if (!children.empty() && !isSource()) {
         assert(children.size() == 1);
         children[0]->initLocalState(resultSet_, context);
     }
     transaction = context->transaction;
+    clientContext = context->clientContext;
     resultSet = resultSet_;
     registerProfilingMetrics(context->profiler);
     initLocalStateInternal(resultSet_, context);
@@ -205,13 +213,19 @@ void PhysicalOperator::initLocalState(ResultSet* resultSet_, ExecutionContext* c
 void PhysicalOperator::registerProfilingMetrics(Profiler* profiler) {
     auto executionTime = profiler->registerTimeMetric(getTimeMetricKey());
     auto numOutputTuple = profiler->registerNumericMetric(getNumTupleMetricKey());
-    metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple);
+    auto resourceUsage = profiler->registerResourceMetric(getResourceMetricKey());
+    metrics = std::make_unique<OperatorMetrics>(*executionTime, *numOutputTuple, *resourceUsage);
 }
 
 double PhysicalOperator::getExecutionTime(Profiler& profiler) const {
     auto executionTime = profiler.sumAllTimeMetricsWithKey(getTimeMetricKey());
     if (!isSource()) {
         executionTime -= profiler.sumAllTimeMetricsWithKey(children[0]->getTimeMetricKey());
+    } else if (operatorType == PhysicalOperatorType::UNION_ALL) {
+        // Branches of UnionAll are pulled in the same pipeline.
+        for (auto& child : children) {
+            executionTime -= profiler.sumAllTimeMetricsWithKey(child->getTimeMetricKey());
+        }
     }
     return executionTime;
 }
@@ -220,11 +234,37 @@ uint64_t PhysicalOperator::getNumOutputTuples(Profiler& profiler) const {
     return profiler.sumAllNumericMetricsWithKey(getNumTupleMetricKey());
 }
 
+// Same as execution time, resource usage is measured including the child in the same pipeline, so
+// we subtract the usage of the child.
+ResourceCounters PhysicalOperator::getResourceUsage(Profiler& profiler) const {
+    auto resourceUsage = profiler.sumAllResourceMetricsWithKey(getResourceMetricKey());
+    if (!isSource()) {
+        resourceUsage.subtract(
+            profiler.sumAllResourceMetricsWithKey(children[0]->getResourceMetricKey()));
+    } else if (operatorType == PhysicalOperatorType::UNION_ALL) {
+        for (auto& child : children) {
+            resourceUsage.subtract(
+                profiler.sumAllResourceMetricsWithKey(child->getResourceMetricKey()));
+        }
+    }
+    return resourceUsage;
+}
+
 std::unordered_map<std::string, std::string> PhysicalOperator::getProfilerKeyValAttributes(
     Profiler& profiler) const {
     std::unordered_map<std::string, std::string> result;
     result.insert({"ExecutionTime", std::to_string(getExecutionTime(profiler))});
     result.insert({"NumOutputTuples", std::to_string(getNumOutputTuples(profiler))});
+    auto resourceUsage = getResourceUsage(profiler);
+    result.insert({"NumPagePins", std::to_string(resourceUsage.numPagePins)});
+    result.insert({"NumPageCacheMisses", std::to_string(resourceUsage.numPageCacheMisses)});
+    result.insert(
+        {"NumMappedPageAccesses", std::to_string(resourceUsage.numMappedPageAccesses)});
+    result.insert({"NumBytesReadFromDisk", std::to_string(resourceUsage.numBytesReadFromDisk)});
+    result.insert(
+        {"NumMemoryBlocksAllocated", std::to_string(resourceUsage.numMemoryBlocksAllocated)});
+    result.insert(
+        {"NumHashChainEntriesVisited", std::to_string(resourceUsage.numHashChainEntriesVisited)});
     return result;
 }
 
@@ -6,13 +6,32 @@ namespace kuzu {
 namespace processor {
 
 bool ScanSingleNodeTable::getNextTuplesInternal() {
-    if (!children[0]->getNextTuple()) {
-        return false;
+    if (columnPredicates.empty()) {
+        if (!children[0]->getNextTuple()) {
+            return false;
+        }
+    } else {
+        do {
+            restoreSelVector(inputNodeIDVector->state->selVector);
+            if (!children[0]->getNextTuple()) {
+                return false;
+            }
+            saveSelVector(inputNodeIDVector->state->selVector);
+        } while (!selectNodes());
     }
     table->scan(transaction, inputNodeIDVector, propertyColumnIds, outPropertyVectors);
     return true;
 }
 
+bool ScanSingleNodeTable::selectNodes() {
+    for (auto& [columnID, predicate] : columnPredicates) {
+        if (!table->select(transaction, inputNodeIDVector, columnID, predicate)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool ScanMultiNodeTables::getNextTuplesInternal() {
     if (!children[0]->getNextTuple()) {
         return false;
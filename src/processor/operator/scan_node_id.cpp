@@ -1,20 +1,37 @@
 #include "processor/operator/scan_node_id.h"
 
+#include <bit>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace processor {
 
-// Note: blindly update mask does not parallelize well, so we minimize write by first checking
-// if the mask is set to true (mask value is equal to the expected currentMaskValue) or not.
-void NodeTableSemiMask::incrementMaskValue(uint64_t nodeOffset, uint8_t currentMaskValue) {
-    if (nodeMask->isMasked(nodeOffset, currentMaskValue)) {
-        nodeMask->setMask(nodeOffset, currentMaskValue + 1);
-    }
-    auto morselIdx = nodeOffset >> DEFAULT_VECTOR_CAPACITY_LOG_2;
-    if (morselMask->isMasked(morselIdx, currentMaskValue)) {
-        morselMask->setMask(morselIdx, currentMaskValue + 1);
+uint64_t ConcurrentBitset::getSetPositions(
+    uint64_t startPos, uint64_t endPos, sel_t* positions) const {
+    uint64_t numPositions = 0;
+    for (auto wordStartPos = startPos & ~(NUM_BITS_PER_WORD - 1); wordStartPos < endPos;
+         wordStartPos += NUM_BITS_PER_WORD) {
+        auto word = words[wordStartPos >> NUM_BITS_PER_WORD_LOG2].load(std::memory_order_relaxed);
+        if (wordStartPos < startPos) {
+            word &= ~BitmaskUtils::all1sMaskForLeastSignificantBits(startPos - wordStartPos);
+        }
+        if (wordStartPos + NUM_BITS_PER_WORD > endPos) {
+            word &= BitmaskUtils::all1sMaskForLeastSignificantBits(endPos - wordStartPos);
+        }
+        while (word != 0) {
+            positions[numPositions++] = wordStartPos + std::countr_zero(word) - startPos;
+            word &= word - 1;
+        }
     }
+    return numPositions;
+}
+
+uint8_t NodeTableSemiMask::addMasker(offset_t maxNodeOffset, uint64_t maxMorselIdx) {
+    assert(maxNodeOffset != INVALID_NODE_OFFSET && nodeMasks.size() < UINT8_MAX);
+    nodeMasks.push_back(std::make_unique<ConcurrentBitset>(maxNodeOffset + 1));
+    morselMasks.push_back(std::make_unique<ConcurrentBitset>(maxMorselIdx + 1));
+    return nodeMasks.size() - 1;
 }
 
 std::pair<offset_t, offset_t> NodeTableState::getNextRangeToRead() {
@@ -30,6 +47,24 @@ std::pair<offset_t, offset_t> NodeTableState::getNextRangeToRead() {
         }
         currentNodeOffset = std::min(currentMorselIdx * DEFAULT_VECTOR_CAPACITY, maxNodeOffset);
     }
+    if (hasCandidateNodes_) {
+        while (nextCandidateIdx < candidateNodes.size() &&
+               candidateNodes[nextCandidateIdx] < currentNodeOffset) {
+            nextCandidateIdx++;
+        }
+        if (nextCandidateIdx == candidateNodes.size()) {
+            currentNodeOffset = maxNodeOffset + 1;
+            return std::make_pair(currentNodeOffset, currentNodeOffset);
+        }
+        // Skip to the morsel of the next candidate node.
+        auto nextCandidateMorselIdx =
+            candidateNodes[nextCandidateIdx] >> DEFAULT_VECTOR_CAPACITY_LOG_2;
+        currentNodeOffset =
+            std::max(currentNodeOffset, nextCandidateMorselIdx * DEFAULT_VECTOR_CAPACITY);
+        if (currentNodeOffset > maxNodeOffset) {
+            return std::make_pair(currentNodeOffset, currentNodeOffset);
+        }
+    }
     auto startOffset = currentNodeOffset;
     auto range = std::min(DEFAULT_VECTOR_CAPACITY, maxNodeOffset + 1 - currentNodeOffset);
     currentNodeOffset += range;
@@ -55,6 +90,26 @@ std::tuple<NodeTableState*, offset_t, offset_t> ScanNodeIDSharedState::getNextRa
     return std::make_tuple(tableStates[currentStateIdx].get(), startOffset, endOffset);
 }
 
+void ScanNodeIDSharedState::lookupPropertyIndexes(transaction::Transaction* transaction) {
+    auto tableState = tableStates[0].get();
+    std::vector<offset_t> candidateNodes;
+    for (auto i = 0u; i < propertyIndexLookups.size(); ++i) {
+        auto& lookup = propertyIndexLookups[i];
+        auto nodeOffsets = lookup.index->lookup(transaction, lookup.comparisonType, lookup.value);
+        if (i == 0) {
+            candidateNodes = std::move(nodeOffsets);
+            continue;
+        }
+        std::vector<offset_t> intersection;
+        std::set_intersection(candidateNodes.begin(), candidateNodes.end(), nodeOffsets.begin(),
+            nodeOffsets.end(), std::back_inserter(intersection));
+        candidateNodes = std::move(intersection);
+    }
+    if (candidateNodes.size() * MIN_INDEX_SELECTIVITY_RATIO < tableState->getNumNodes()) {
+        tableState->setCandidateNodes(std::move(candidateNodes));
+    }
+}
+
 void ScanNodeID::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     outValueVector = resultSet->getValueVector(outDataPos);
     outValueVector->setSequential();
@@ -82,22 +137,77 @@ bool ScanNodeID::getNextTuplesInternal() {
 void ScanNodeID::setSelVector(
     NodeTableState* tableState, offset_t startOffset, offset_t endOffset) {
     if (tableState->isSemiMaskEnabled()) {
-        outValueVector->state->selVector->resetSelectorToValuePosBuffer();
-        // Fill selected positions based on node mask for nodes between the given startOffset and
-        // endOffset. If the node is masked (i.e., valid for read), then it is set to the selected
-        // positions. Finally, we update the selectedSize for selVector.
-        sel_t numSelectedValues = 0;
-        for (auto i = 0u; i < (endOffset - startOffset); i++) {
-            outValueVector->state->selVector->selectedPositions[numSelectedValues] = i;
-            numSelectedValues += tableState->getSemiMask()->isNodeMasked(i + startOffset);
-        }
-        outValueVector->state->selVector->selectedSize = numSelectedValues;
+        // Fill selected positions with masked (i.e., valid for read) nodes between the given
+        // startOffset and endOffset, a mask word (64 nodes) at a time.
+        auto selVector = outValueVector->state->selVector.get();
+        selVector->resetSelectorToValuePosBufferWithSize(tableState->getSemiMask()->getMaskedNodes(
+            startOffset, endOffset, selVector->getSelectedPositionsBuffer()));
     } else {
         // By default, the selected positions is set to the const incremental pos array.
         outValueVector->state->selVector->resetSelectorToUnselected();
     }
     // Apply changes to the selVector from nodes metadata.
     tableState->getTable()->setSelVectorForDeletedOffsets(transaction, outValueVector);
+    applyJoinKeyFilters(tableState);
+    applyCandidateNodes(tableState, startOffset, endOffset);
+}
+
+void ScanNodeID::applyJoinKeyFilters(NodeTableState* tableState) {
+    auto selVector = outValueVector->state->selVector.get();
+    auto nodeIDValues = (nodeID_t*)(outValueVector->getData());
+    for (auto& filter : sharedState->getJoinKeyFilters()) {
+        if (!filter->isSelective(tableState->getNumNodes())) {
+            continue;
+        }
+        sel_t numSelectedValues = 0;
+        if (selVector->isUnfiltered()) {
+            auto selectedPositionsBuffer = selVector->getSelectedPositionsBuffer();
+            for (auto i = 0u; i < selVector->selectedSize; i++) {
+                selectedPositionsBuffer[numSelectedValues] = i;
+                numSelectedValues += filter->mayContain(nodeIDValues[i]);
+            }
+            selVector->resetSelectorToValuePosBuffer();
+        } else {
+            for (auto i = 0u; i < selVector->selectedSize; i++) {
+                auto pos = selVector->selectedPositions[i];
+                selVector->selectedPositions[numSelectedValues] = pos;
+                numSelectedValues += filter->mayContain(nodeIDValues[pos]);
+            }
+        }
+        selVector->selectedSize = numSelectedValues;
+    }
+}
+
+void ScanNodeID::applyCandidateNodes(
+    NodeTableState* tableState, offset_t startOffset, offset_t endOffset) {
+    if (!tableState->hasCandidateNodes()) {
+        return;
+    }
+    auto& candidateNodes = tableState->getCandidateNodes();
+    auto candidate = std::lower_bound(candidateNodes.begin(), candidateNodes.end(), startOffset);
+    auto selVector = outValueVector->state->selVector.get();
+    sel_t numSelectedValues = 0;
+    if (selVector->isUnfiltered()) {
+        auto selectedPositionsBuffer = selVector->getSelectedPositionsBuffer();
+        for (; candidate != candidateNodes.end() && *candidate < endOffset; ++candidate) {
+            selectedPositionsBuffer[numSelectedValues++] = *candidate - startOffset;
+        }
+        selVector->resetSelectorToValuePosBuffer();
+    } else {
+        // Both selected positions and candidate nodes are sorted.
+        for (auto i = 0u; i < selVector->selectedSize; i++) {
+            auto pos = selVector->selectedPositions[i];
+            while (candidate != candidateNodes.end() && *candidate < startOffset + pos) {
+                ++candidate;
+            }
+            if (candidate == candidateNodes.end()) {
+                break;
+            }
+            selVector->selectedPositions[numSelectedValues] = pos;
+            numSelectedValues += *candidate == startOffset + pos;
+        }
+    }
+    selVector->selectedSize = numSelectedValues;
 }
 
 } // namespace processor
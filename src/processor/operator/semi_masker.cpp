@@ -12,10 +12,7 @@ void BaseSemiMasker::initLocalStateInternal(ResultSet* resultSet, ExecutionConte
 
 static std::pair<uint8_t, NodeTableSemiMask*> initSemiMaskForTableState(
     NodeTableState* tableState, transaction::Transaction* trx) {
-    tableState->initSemiMask(trx);
-    auto maskerIdx = tableState->getNumMaskers();
-    assert(maskerIdx < UINT8_MAX);
-    tableState->incrementNumMaskers();
+    auto maskerIdx = tableState->addSemiMasker(trx);
     return std::make_pair(maskerIdx, tableState->getSemiMask());
 }
 
@@ -35,7 +32,7 @@ bool SingleTableSemiMasker::getNextTuplesInternal() {
     for (auto i = 0u; i < numValues; i++) {
         auto pos = keyValueVector->state->selVector->selectedPositions[i];
         auto nodeID = keyValueVector->getValue<nodeID_t>(pos);
-        mask->incrementMaskValue(nodeID.offset, maskerIdx);
+        mask->setMask(nodeID.offset, maskerIdx);
     }
     metrics->numOutputTuple.increase(numValues);
     return true;
@@ -61,7 +58,7 @@ bool MultiTableSemiMasker::getNextTuplesInternal() {
         auto pos = keyValueVector->state->selVector->selectedPositions[i];
         auto nodeID = keyValueVector->getValue<nodeID_t>(pos);
         auto [maskerIdx, mask] = maskerIdxAndMasks.at(nodeID.tableID);
-        mask->incrementMaskValue(nodeID.offset, maskerIdx);
+        mask->setMask(nodeID.offset, maskerIdx);
     }
     metrics->numOutputTuple.increase(numValues);
     return true;
@@ -0,0 +1,31 @@
+#include "processor/operator/sink.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void Sink::recordPipelineTimes(Profiler* profiler, uint64_t waitTicks, uint64_t wallTicks) {
+    profiler->registerTimeMetric(getPipelineWaitTimeMetricKey())->increase(waitTicks);
+    profiler->registerTimeMetric(getPipelineWallTimeMetricKey())->increase(wallTicks);
+}
+
+std::unordered_map<std::string, std::string> Sink::getProfilerKeyValAttributes(
+    Profiler& profiler) const {
+    auto result = PhysicalOperator::getProfilerKeyValAttributes(profiler);
+    result.insert({"PipelineWallTime",
+        std::to_string(profiler.sumAllTimeMetricsWithKey(getPipelineWallTimeMetricKey()))});
+    result.insert({"PipelineSchedulerWaitTime",
+        std::to_string(profiler.sumAllTimeMetricsWithKey(getPipelineWaitTimeMetricKey()))});
+    // The time metric of a sink is registered by each thread executing its pipeline and covers the
+    // whole pipeline.
+    std::string threadTimes;
+    for (auto time : profiler.getAllTimeMetricsWithKey(getTimeMetricKey())) {
+        threadTimes += (threadTimes.empty() ? "" : ", ") + std::to_string(time);
+    }
+    result.insert({"PipelineThreadTimes", "[" + threadTimes + "]"});
+    return result;
+}
+
+} // namespace processor
+} // namespace kuzu
@@ -0,0 +1,157 @@
+#include "processor/operator/union_all.h"
+
+#include <algorithm>
+
+#include "common/vector/value_vector_utils.h"
+#include "processor/processor_task.h"
+
+using namespace kuzu::common;
+
+namespace kuzu {
+namespace processor {
+
+void UnionAll::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
+    for (auto& pos : outVecPositions) {
+        auto vector = resultSet->getValueVector(pos).get();
+        outVectors.push_back(vector);
+        auto state = vector->state.get();
+        if (!state->isFlat() &&
+            std::find(unflatOutStates.begin(), unflatOutStates.end(), state) ==
+                unflatOutStates.end()) {
+            unflatOutStates.push_back(state);
+        }
+    }
+    for (auto i = 0u; i < children.size(); ++i) {
+        auto branchResultSet = ProcessorTask::populateResultSet(
+            branchInfos[i]->resultSetDescriptor.get(), context->memoryManager,
+            resultSet->vectorArena);
+        children[i]->initLocalState(branchResultSet.get(), context);
+        std::vector<ValueVector*> vectors;
+        for (auto& pos : branchInfos[i]->inVecPositions) {
+            vectors.push_back(branchResultSet->getValueVector(pos).get());
+        }
+        branchVectors.push_back(std::move(vectors));
+        branchResultSets.push_back(std::move(branchResultSet));
+    }
+    currentBranchIdx = sharedState->getBranchToStart(children.size());
+    isBranchExhausted.resize(children.size(), false);
+    numExhaustedBranches = 0;
+    hasPendingTuple = false;
+}
+
+bool UnionAll::getNextTuplesInternal() {
+    while (numExhaustedBranches < children.size()) {
+        if (!isBranchExhausted[currentBranchIdx]) {
+            auto numTuples = batchFlatTuples ? pullFlatTuples(currentBranchIdx) :
+                                               pullTuple(currentBranchIdx);
+            if (numTuples > 0) {
+                metrics->numOutputTuple.increase(numTuples);
+                return true;
+            }
+        }
+        currentBranchIdx = (currentBranchIdx + 1) % children.size();
+    }
+    return false;
+}
+
+std::unique_ptr<PhysicalOperator> UnionAll::clone() {
+    std::vector<std::unique_ptr<UnionAllBranchInfo>> clonedBranchInfos;
+    std::vector<std::unique_ptr<PhysicalOperator>> clonedChildren;
+    for (auto i = 0u; i < children.size(); ++i) {
+        clonedBranchInfos.push_back(std::make_unique<UnionAllBranchInfo>(*branchInfos[i]));
+        clonedChildren.push_back(children[i]->clone());
+    }
+    return std::make_unique<UnionAll>(outVecPositions, std::move(clonedBranchInfos),
+        batchFlatTuples, sharedState, std::move(clonedChildren), id, paramsString);
+}
+
+uint64_t UnionAll::pullTuple(uint64_t branchIdx) {
+    if (!children[branchIdx]->getNextTuple()) {
+        markBranchExhausted(branchIdx);
+        return 0;
+    }
+    for (auto& vector : outVectors) {
+        vector->resetOverflowBuffer();
+    }
+    copyTuple(branchIdx, 0 /* outPos */);
+    resultSet->multiplicity = branchResultSets[branchIdx]->multiplicity;
+    uint64_t numTuples = 1;
+    for (auto& state : unflatOutStates) {
+        numTuples *= state->getNumSelectedValues();
+    }
+    return numTuples;
+}
+
+uint64_t UnionAll::pullFlatTuples(uint64_t branchIdx) {
+    assert(unflatOutStates.size() == 1);
+    for (auto& vector : outVectors) {
+        vector->resetOverflowBuffer();
+    }
+    auto branchResultSet = branchResultSets[branchIdx].get();
+    uint64_t numTuples = 0;
+    if (hasPendingTuple) {
+        copyTuple(branchIdx, numTuples++);
+        hasPendingTuple = false;
+    }
+    auto multiplicity = branchResultSet->multiplicity;
+    while (numTuples < DEFAULT_VECTOR_CAPACITY) {
+        if (!children[branchIdx]->getNextTuple()) {
+            markBranchExhausted(branchIdx);
+            break;
+        }
+        // The multiplicity applies to all tuples of the output.
+        if (numTuples > 0 && branchResultSet->multiplicity != multiplicity) {
+            hasPendingTuple = true;
+            break;
+        }
+        multiplicity = branchResultSet->multiplicity;
+        copyTuple(branchIdx, numTuples++);
+    }
+    auto outState = unflatOutStates[0];
+    outState->initOriginalAndSelectedSize(numTuples);
+    outState->selVector->resetSelectorToUnselected();
+    resultSet->multiplicity = multiplicity;
+    return numTuples;
+}
+
+void UnionAll::markBranchExhausted(uint64_t branchIdx) {
+    isBranchExhausted[branchIdx] = true;
+    numExhaustedBranches++;
+}
+
+void UnionAll::copyTuple(uint64_t branchIdx, sel_t outPos) {
+    auto& inVectors = branchVectors[branchIdx];
+    for (auto i = 0u; i < outVectors.size(); ++i) {
+        if (inVectors[i]->state->isFlat()) {
+            copyFlatValue(*inVectors[i], *outVectors[i], outPos);
+        } else {
+            copyUnflatValues(*inVectors[i], *outVectors[i]);
+        }
+    }
+}
+
+void UnionAll::copyFlatValue(const ValueVector& inVector, ValueVector& outVector, sel_t outPos) {
+    auto inPos = inVector.state->selVector->selectedPositions[0];
+    outVector.setNull(outPos, inVector.isNull(inPos));
+    if (!outVector.isNull(outPos)) {
+        ValueVectorUtils::copyNonNullDataWithSameTypeIntoPos(
+            outVector, outPos, inVector.getData() + inPos * inVector.getNumBytesPerValue());
+    }
+}
+
+void UnionAll::copyUnflatValues(const ValueVector& inVector, ValueVector& outVector) {
+    auto& inSelVector = inVector.state->selVector;
+    for (auto i = 0u; i < inSelVector->selectedSize; ++i) {
+        auto inPos = inSelVector->selectedPositions[i];
+        outVector.setNull(i, inVector.isNull(inPos));
+        if (!outVector.isNull(i)) {
+            ValueVectorUtils::copyNonNullDataWithSameTypeIntoPos(
+                outVector, i, inVector.getData() + inPos * inVector.getNumBytesPerValue());
+        }
+    }
+    outVector.state->initOriginalAndSelectedSize(inSelVector->selectedSize);
+    outVector.state->selVector->resetSelectorToUnselected();
+}
+
+} // namespace processor
+} // namespace kuzu
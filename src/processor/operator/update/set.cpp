@@ -18,6 +18,9 @@ bool SetNodeProperty::getNextTuplesInternal() {
     for (auto i = 0u; i < infos.size(); ++i) {
         auto info = infos[i].get();
         info->evaluator->evaluate();
+        if (info->index != nullptr) {
+            info->index->recordUpdates(nodeIDVectors[i]);
+        }
         info->column->writeValues(nodeIDVectors[i], info->evaluator->resultVector.get());
     }
     return true;
@@ -23,6 +23,7 @@ std::shared_ptr<FactorizedTable> QueryProcessor::execute(
         auto outputMsg = copy->execute(taskScheduler.get(), context);
         return getFactorizedTableForOutputMsg(outputMsg, context->memoryManager);
     } else {
+        storage::ThreadMemoryTrackerGuard memoryTrackerGuard{context->memoryTracker};
         auto lastOperator = physicalPlan->lastOperator.get();
         // Init global state before decompose into pipelines. Otherwise, each pipeline will try to
         // init global state. Result in global state being initialized multiple times.
@@ -69,6 +70,7 @@ void QueryProcessor::decomposePlanIntoTasks(
     case PhysicalOperatorType::ADD_PROPERTY:
     case PhysicalOperatorType::RENAME_PROPERTY:
     case PhysicalOperatorType::RENAME_TABLE:
+    case PhysicalOperatorType::CREATE_INDEX:
         // As a temporary solution, update is executed in single thread mode.
     case PhysicalOperatorType::SET_NODE_PROPERTY:
     case PhysicalOperatorType::SET_REL_PROPERTY:
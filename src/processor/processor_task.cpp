@@ -7,37 +7,49 @@ void ProcessorTask::run() {
     // We need the lock when cloning because multiple threads can be accessing to clone,
     // which is not thread safe
     common::lock_t lck{mtx};
+    storage::ThreadMemoryTrackerGuard memoryTrackerGuard{executionContext->memoryTracker};
+    // Declared before the cloned pipeline so that it outlives every vector of the clone.
+    common::VectorArena vectorArena;
     auto clonedPipelineRoot = sink->clone();
     lck.unlock();
     auto currentSink = (Sink*)clonedPipelineRoot.get();
-    auto resultSet = populateResultSet(currentSink, executionContext->memoryManager);
+    PhysicalOperator* source = currentSink;
+    while (!source->isSource() && source->getNumChildren() > 0) {
+        source = source->getChild(0);
+    }
+    source->enableYieldingBeforeMorsels();
+    auto resultSet = populateResultSet(
+        currentSink->getResultSetDescriptor(), executionContext->memoryManager, &vectorArena);
     currentSink->execute(resultSet.get(), executionContext);
 }
 
 void ProcessorTask::finalizeIfNecessary() {
+    storage::ThreadMemoryTrackerGuard memoryTrackerGuard{executionContext->memoryTracker};
+    sink->recordPipelineTimes(executionContext->profiler, getWaitTicks(), getWallTicks());
     sink->finalize(executionContext);
 }
 
 std::unique_ptr<ResultSet> ProcessorTask::populateResultSet(
-    Sink* op, storage::MemoryManager* memoryManager) {
-    auto resultSetDescriptor = op->getResultSetDescriptor();
+    const ResultSetDescriptor* resultSetDescriptor, storage::MemoryManager* memoryManager,
+    common::VectorArena* vectorArena) {
     if (resultSetDescriptor == nullptr) {
         // Some pipeline does not need a resultSet, e.g. OrderByMerge
         return nullptr;
     }
     auto numDataChunks = resultSetDescriptor->getNumDataChunks();
-    auto resultSet = std::make_unique<ResultSet>(numDataChunks);
+    auto resultSet = std::make_unique<ResultSet>(numDataChunks, vectorArena);
     for (auto i = 0u; i < numDataChunks; ++i) {
         auto dataChunkDescriptor = resultSetDescriptor->getDataChunkDescriptor(i);
         auto numValueVectors = dataChunkDescriptor->getNumValueVectors();
-        auto dataChunk = std::make_unique<common::DataChunk>(numValueVectors);
-        if (dataChunkDescriptor->isSingleState()) {
-            dataChunk->state = common::DataChunkState::getSingleValueDataChunkState();
-        }
+        auto dataChunk = std::make_unique<common::DataChunk>(numValueVectors,
+            dataChunkDescriptor->isSingleState() ?
+                common::DataChunkState::getSingleValueDataChunkState() :
+                std::make_shared<common::DataChunkState>(
+                    common::DEFAULT_VECTOR_CAPACITY, vectorArena));
         for (auto j = 0u; j < dataChunkDescriptor->getNumValueVectors(); ++j) {
             auto expression = dataChunkDescriptor->getExpression(j);
-            auto vector =
-                std::make_shared<common::ValueVector>(expression->dataType, memoryManager);
+            auto vector = std::make_shared<common::ValueVector>(
+                expression->dataType, memoryManager, vectorArena);
             dataChunk->insert(j, std::move(vector));
         }
         resultSet->insert(i, std::move(dataChunk));
@@ -1,5 +1,9 @@
 #include "storage/buffer_manager/buffer_managed_file_handle.h"
 
+#include <sys/mman.h>
+
+#include <cstring>
+
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -14,6 +18,37 @@ BufferManagedFileHandle::BufferManagedFileHandle(
     }
 }
 
+BufferManagedFileHandle::~BufferManagedFileHandle() {
+    if (mappedFile != nullptr) {
+        munmap(mappedFile, mappedSize);
+    }
+}
+
+void BufferManagedFileHandle::mapReadOnly() {
+    assert(mappedFile == nullptr && !isNewTmpFile());
+    if (numPages == 0) {
+        return;
+    }
+    // The last page may be partially written to the file. We reserve anonymous (zeroed) memory for
+    // all pages and map the file over its prefix, so that reading the tail of the last page does
+    // not fault beyond the end of the file.
+    auto fileSize = FileUtils::getFileSize(fileInfo->fd);
+    mappedSize = (uint64_t)numPages * getPageSize();
+    auto region =
+        mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (region == MAP_FAILED ||
+        mmap(region, fileSize, PROT_READ, MAP_SHARED | MAP_FIXED | MAP_POPULATE, fileInfo->fd, 0) ==
+            MAP_FAILED) {
+        if (region != MAP_FAILED) {
+            munmap(region, mappedSize);
+        }
+        throw BufferManagerException("Mapping file " + fileInfo->path +
+                                     " failed: " + std::string(std::strerror(errno)));
+    }
+    madvise(region, fileSize, MADV_WILLNEED);
+    mappedFile = (uint8_t*)region;
+}
+
 void BufferManagedFileHandle::initPageIdxToFrameMapAndLocks() {
     pageIdxToFrameMap.resize(pageCapacity);
     pageLocks.resize(pageCapacity);
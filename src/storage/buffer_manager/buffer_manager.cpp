@@ -8,12 +8,14 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-BufferManager::BufferManager(uint64_t maxSizeForDefaultPagePool, uint64_t maxSizeForLargePagePool)
+BufferManager::BufferManager(uint64_t maxSizeForDefaultPagePool, uint64_t maxSizeForLargePagePool,
+    bool mapFilesReadOnly)
     : logger{LoggerUtils::getLogger(common::LoggerConstants::LoggerEnum::BUFFER_MANAGER)},
       bufferPoolDefaultPages(std::make_unique<BufferPool>(
           BufferPoolConstants::DEFAULT_PAGE_SIZE, maxSizeForDefaultPagePool)),
       bufferPoolLargePages(std::make_unique<BufferPool>(
-          BufferPoolConstants::LARGE_PAGE_SIZE, maxSizeForLargePagePool)) {
+          BufferPoolConstants::LARGE_PAGE_SIZE, maxSizeForLargePagePool)),
+      mapFilesReadOnly{mapFilesReadOnly} {
     logger->info("Done Initializing Buffer Manager.");
 }
 
@@ -33,11 +35,6 @@ void BufferManager::resize(uint64_t newSizeForDefaultPagePool, uint64_t newSizeF
 // should be flushed to disk if it is evicted.
 // (3) If multiple threads are writing to the page, they should coordinate separately because they
 // both get access to the same piece of memory.
-uint8_t* BufferManager::pin(BufferManagedFileHandle& fileHandle, page_idx_t pageIdx) {
-    return fileHandle.isLargePaged() ? bufferPoolLargePages->pin(fileHandle, pageIdx) :
-                                       bufferPoolDefaultPages->pin(fileHandle, pageIdx);
-}
-
 // Important Note: This function will pin a page but if the page was not yet in a frame, it will
 // not read it from the file. So this can be used if the page is a new page of a file, or a page
 // of a temporary file that is being re-used and its contents is not important.
@@ -48,6 +45,10 @@ uint8_t* BufferManager::pin(BufferManagedFileHandle& fileHandle, page_idx_t page
 // details.
 uint8_t* BufferManager::pinWithoutReadingFromFile(
     BufferManagedFileHandle& fileHandle, page_idx_t pageIdx) {
+    if (fileHandle.isMapped()) {
+        throw BufferManagerException(
+            "Cannot add pages to file " + fileHandle.getFileInfo()->path + " mapped read-only.");
+    }
     return fileHandle.isLargePaged() ?
                bufferPoolLargePages->pinWithoutReadingFromFile(fileHandle, pageIdx) :
                bufferPoolDefaultPages->pinWithoutReadingFromFile(fileHandle, pageIdx);
@@ -55,21 +56,26 @@ uint8_t* BufferManager::pinWithoutReadingFromFile(
 
 // Important Note: The caller should make sure that they have pinned the page before calling this.
 void BufferManager::setPinnedPageDirty(BufferManagedFileHandle& fileHandle, page_idx_t pageIdx) {
+    if (fileHandle.isMapped()) {
+        throw BufferManagerException(
+            "Cannot modify file " + fileHandle.getFileInfo()->path + " mapped read-only.");
+    }
     fileHandle.isLargePaged() ? bufferPoolLargePages->setPinnedPageDirty(fileHandle, pageIdx) :
                                 bufferPoolDefaultPages->setPinnedPageDirty(fileHandle, pageIdx);
 }
 
-void BufferManager::unpin(BufferManagedFileHandle& fileHandle, page_idx_t pageIdx) {
-    return fileHandle.isLargePaged() ? bufferPoolLargePages->unpin(fileHandle, pageIdx) :
-                                       bufferPoolDefaultPages->unpin(fileHandle, pageIdx);
-}
-
 void BufferManager::removeFilePagesFromFrames(BufferManagedFileHandle& fileHandle) {
+    if (fileHandle.isMapped()) {
+        return;
+    }
     fileHandle.isLargePaged() ? bufferPoolLargePages->removeFilePagesFromFrames(fileHandle) :
                                 bufferPoolDefaultPages->removeFilePagesFromFrames(fileHandle);
 }
 
 void BufferManager::flushAllDirtyPagesInFrames(BufferManagedFileHandle& fileHandle) {
+    if (fileHandle.isMapped()) {
+        return;
+    }
     fileHandle.isLargePaged() ? bufferPoolLargePages->flushAllDirtyPagesInFrames(fileHandle) :
                                 bufferPoolDefaultPages->flushAllDirtyPagesInFrames(fileHandle);
 }
@@ -90,5 +96,25 @@ void BufferManager::removePageFromFrameIfNecessary(
         bufferPoolDefaultPages->removePageFromFrameWithoutFlushingIfNecessary(fileHandle, pageIdx);
 }
 
+std::unique_ptr<BufferManagedFileHandle> BufferManager::getBufferManagedFileHandle(
+    const std::string& filePath, uint8_t flags,
+    BufferManagedFileHandle::FileVersionedType fileVersionedType) {
+    // In read-only mode, no file of the database, including the WAL, is written or created, so
+    // they are opened without write access. This allows opening a database on a read-only file
+    // system. Temporary files of the memory manager are in memory and still written.
+    if (mapFilesReadOnly && !(flags & FileHandle::isNewInMemoryTmpFileMask)) {
+        flags = (flags & ~FileHandle::createIfNotExistsMask) | FileHandle::readOnlyMask;
+    }
+    auto fileHandle = std::make_unique<BufferManagedFileHandle>(filePath, flags, fileVersionedType);
+    // Only versioned files, which store the database, are mapped. The WAL is read through the
+    // buffer pool to check that it is empty.
+    if (mapFilesReadOnly &&
+        fileVersionedType == BufferManagedFileHandle::FileVersionedType::VERSIONED_FILE &&
+        !fileHandle->isNewTmpFile()) {
+        fileHandle->mapReadOnly();
+    }
+    return fileHandle;
+}
+
 } // namespace storage
 } // namespace kuzu
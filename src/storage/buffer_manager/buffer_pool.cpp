@@ -160,9 +160,14 @@ uint8_t* BufferPool::pinWithoutAcquiringPageLock(
         fileHandle.swizzle(pageIdx, frameIdx);
         if (!doNotReadFromFile) {
             bmMetrics.numCacheMiss += 1;
+            ResourceCounters::getThreadLocalCounters().numPageCacheMisses++;
         }
     }
     bmMetrics.numPins += 1;
+    // Blocks of the MemoryManager live in a temporary in-memory file and are not page pins.
+    if (!fileHandle.isNewTmpFile()) {
+        ResourceCounters::getThreadLocalCounters().numPagePins++;
+    }
     return bufferCache[fileHandle.getFrameIdx(pageIdx)]->buffer;
 }
 
@@ -275,6 +280,7 @@ void BufferPool::readNewPageIntoFrame(
     frame.fileHandlePtr.store(reinterpret_cast<uint64_t>(&fileHandle));
     if (!doNotReadFromFile) {
         fileHandle.readPage(frame.buffer, pageIdx);
+        ResourceCounters::getThreadLocalCounters().numBytesReadFromDisk += frame.pageSize;
     }
 }
 
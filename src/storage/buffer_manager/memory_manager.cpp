@@ -2,12 +2,36 @@
 
 #include <cstring>
 
+#include "common/exception.h"
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
 
+static thread_local std::shared_ptr<QueryMemoryTracker> threadMemoryTracker;
+
+void QueryMemoryTracker::allocate(uint64_t numBytes) {
+    if (numBytesHeld.fetch_add(numBytes) + numBytes > memoryLimitInBytes) {
+        numBytesHeld.fetch_sub(numBytes);
+        throw BufferManagerException(
+            "Query exceeded its memory limit of " + std::to_string(memoryLimitInBytes) + " bytes.");
+    }
+}
+
+ThreadMemoryTrackerGuard::ThreadMemoryTrackerGuard(
+    std::shared_ptr<QueryMemoryTracker> memoryTracker) {
+    threadMemoryTracker = std::move(memoryTracker);
+}
+
+ThreadMemoryTrackerGuard::~ThreadMemoryTrackerGuard() {
+    threadMemoryTracker = nullptr;
+}
+
 std::unique_ptr<MemoryBlock> MemoryManager::allocateBlock(bool initializeToZero) {
+    if (threadMemoryTracker != nullptr) {
+        threadMemoryTracker->allocate(BufferPoolConstants::LARGE_PAGE_SIZE);
+    }
     std::lock_guard<std::mutex> lock(memMgrLock);
     page_idx_t pageIdx;
     uint8_t* data;
@@ -18,8 +42,9 @@ std::unique_ptr<MemoryBlock> MemoryManager::allocateBlock(bool initializeToZero)
         freePages.pop();
     }
     data = bm->pinWithoutReadingFromFile(*fh, pageIdx);
+    ResourceCounters::getThreadLocalCounters().numMemoryBlocksAllocated++;
 
-    auto blockHandle = std::make_unique<MemoryBlock>(pageIdx, data);
+    auto blockHandle = std::make_unique<MemoryBlock>(pageIdx, data, threadMemoryTracker);
     if (initializeToZero) {
         memset(blockHandle->data, 0, BufferPoolConstants::LARGE_PAGE_SIZE);
     }
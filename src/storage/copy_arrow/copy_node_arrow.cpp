@@ -1,6 +1,7 @@
 #include "storage/copy_arrow/copy_node_arrow.h"
 
 #include "storage/copy_arrow/copy_task.h"
+#include "storage/index/property_index.h"
 #include "storage/storage_structure/in_mem_file.h"
 
 using namespace kuzu::catalog;
@@ -46,10 +47,37 @@ void CopyNodeArrow::saveToFile() {
         taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(
             [&](InMemColumn* x) { x->saveToFile(); }, column.get()));
     }
+    for (auto propertyID : reinterpret_cast<NodeTableSchema*>(tableSchema)->indexedPropertyIDSet) {
+        taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(
+            buildPropertyIndex, this, tableSchema->getProperty(propertyID)));
+    }
     taskScheduler.waitAllTasksToCompleteOrError();
     logger->debug("Done writing node columns to disk.");
 }
 
+void CopyNodeArrow::buildPropertyIndex(CopyNodeArrow* copier, const Property& property) {
+    auto column = copier->columns[property.propertyID].get();
+    auto propertyIndexBuilder = std::make_unique<PropertyIndexBuilder>(
+        StorageUtils::getPropertyIndexFName(copier->outputDirectory, property.tableID,
+            property.propertyID, DBFileType::WAL_VERSION));
+    for (auto offset = 0u; offset < copier->numRows; offset++) {
+        if (column->isNullAtNodeOffset(offset)) {
+            continue;
+        }
+        if (property.dataType.typeID == STRING) {
+            auto value = column->getInMemOverflowFile()->readString(
+                (ku_string_t*)column->getElement(offset));
+            propertyIndexBuilder->append(
+                PropertyIndex::encodeStringKey(value.data(), value.length()), offset);
+        } else {
+            propertyIndexBuilder->append(
+                PropertyIndex::encodeKey(property.dataType.typeID, column->getElement(offset)),
+                offset);
+        }
+    }
+    propertyIndexBuilder->flush();
+}
+
 template<typename T>
 arrow::Status CopyNodeArrow::populateColumns() {
     logger->info("Populating properties");
@@ -1,5 +1,6 @@
 #include "storage/copy_arrow/copy_rel_arrow.h"
 
+#include "common/timer.h"
 #include "spdlog/spdlog.h"
 #include "storage/copy_arrow/copy_task.h"
 
@@ -16,23 +17,70 @@ CopyRelArrow::CopyRelArrow(CopyDescription& copyDescription, std::string outputD
     table_id_t tableID, RelsStatistics* relsStatistics)
     : CopyStructuresArrow{copyDescription, std::move(outputDirectory), taskScheduler, catalog,
           tableID},
-      maxNodeOffsetsPerTable{std::move(maxNodeOffsetsPerNodeTable)}, relsStatistics{
-                                                                         relsStatistics} {
+      maxNodeOffsetsPerTable{std::move(maxNodeOffsetsPerNodeTable)},
+      relsStatistics{relsStatistics},
+      relsBlocksMemoryBudget{(uint64_t)(bufferManager->getMaxSize() *
+                                        CopyConstants::RELS_BLOCKS_BUFFER_POOL_RATIO)} {
     dummyReadOnlyTrx = Transaction::getDummyReadOnlyTrx();
     auto relTableSchema = reinterpret_cast<RelTableSchema*>(tableSchema);
     initializePkIndexes(relTableSchema->srcTableID, *bufferManager);
     initializePkIndexes(relTableSchema->dstTableID, *bufferManager);
 }
 
-std::string CopyRelArrow::getTaskTypeName(PopulateTaskType populateTaskType) {
-    switch (populateTaskType) {
-    case PopulateTaskType::populateAdjColumnsAndCountRelsInAdjListsTask: {
-        return "populateAdjColumnsAndCountRelsInAdjListsTask";
+CopyRelArrow::~CopyRelArrow() {
+    // Copies that failed before lists are populated leave the spill file behind.
+    removeSpillFile();
+}
+
+CopyRelArrow::RelsBlock::RelsBlock(uint64_t numRels, offset_t startRelID,
+    const std::vector<Property>& properties, bool resident, uint64_t fileOffset)
+    : numRels{numRels}, startRelID{startRelID}, resident{resident}, fileOffset{fileOffset} {
+    // Null bitmaps come before values so that they are 8-byte aligned.
+    auto numBytesPerNullBitmap = ((numRels + 63) >> 6) * sizeof(uint64_t);
+    nullsStartOffset = REL_DIRECTIONS.size() * numRels * sizeof(offset_t);
+    auto offset = nullsStartOffset;
+    nullsOffsetPerProperty.resize(properties.size());
+    valuesOffsetPerProperty.resize(properties.size());
+    for (auto propertyIdx = RelTableSchema::INTERNAL_REL_ID_PROPERTY_IDX + 1;
+         propertyIdx < properties.size(); propertyIdx++) {
+        nullsOffsetPerProperty[propertyIdx] = offset;
+        offset += numBytesPerNullBitmap;
     }
-    case PopulateTaskType::populateListsTask: {
-        return "populateListsTask";
+    nullsEndOffset = offset;
+    for (auto propertyIdx = RelTableSchema::INTERNAL_REL_ID_PROPERTY_IDX + 1;
+         propertyIdx < properties.size(); propertyIdx++) {
+        valuesOffsetPerProperty[propertyIdx] = offset;
+        offset += numRels * Types::getDataTypeSize(properties[propertyIdx].dataType);
     }
+    numBytes = offset;
+    assert(numBytes == getNumBytes(numRels, properties));
+}
+
+uint64_t CopyRelArrow::RelsBlock::getNumBytes(
+    uint64_t numRels, const std::vector<Property>& properties) {
+    auto numBytes = REL_DIRECTIONS.size() * numRels * sizeof(offset_t);
+    for (auto propertyIdx = RelTableSchema::INTERNAL_REL_ID_PROPERTY_IDX + 1;
+         propertyIdx < properties.size(); propertyIdx++) {
+        numBytes += ((numRels + 63) >> 6) * sizeof(uint64_t) +
+                    numRels * Types::getDataTypeSize(properties[propertyIdx].dataType);
     }
+    return numBytes;
+}
+
+void CopyRelArrow::RelsBlock::allocate() {
+    buffer = std::make_unique<uint8_t[]>(numBytes);
+    // Properties are null until a value is put.
+    std::fill(buffer.get() + nullsStartOffset, buffer.get() + nullsEndOffset, UINT8_MAX);
+}
+
+void CopyRelArrow::RelsBlock::spill(FileInfo* spillFile) {
+    FileUtils::writeToFile(spillFile, buffer.get(), numBytes, fileOffset);
+    release();
+}
+
+void CopyRelArrow::RelsBlock::load(FileInfo* spillFile) {
+    buffer = std::make_unique<uint8_t[]>(numBytes);
+    FileUtils::readFromFile(spillFile, buffer.get(), numBytes, fileOffset);
 }
 
 void CopyRelArrow::initializeColumnsAndLists() {
@@ -55,17 +103,35 @@ void CopyRelArrow::initializeColumnsAndLists() {
     }
 }
 
+template<typename F>
+void CopyRelArrow::runPhase(const std::string& phaseName, F&& phase) {
+    Timer timer;
+    timer.start();
+    phase();
+    timer.stop();
+    phaseTimesMS.emplace_back(phaseName, timer.getDuration() / 1000);
+}
+
+void CopyRelArrow::populateInMemoryStructures() {
+    initializeColumnsAndLists();
+    populateColumnsAndLists();
+}
+
 void CopyRelArrow::populateColumnsAndLists() {
-    populateAdjColumnsAndCountRelsInAdjLists();
+    runPhase("ReadAndPopulateColumns", [&]() { populateAdjColumnsAndCountRelsInAdjLists(); });
     if (adjListsPerDirection[FWD] != nullptr || adjListsPerDirection[BWD] != nullptr) {
-        initAdjListsHeaders();
-        initListsMetadata();
-        populateLists();
+        runPhase("InitListsMetadata", [&]() {
+            initAdjListsHeaders();
+            initListsMetadata();
+        });
+        runPhase("PopulateLists", [&]() { populateLists(); });
     }
-    sortAndCopyOverflowValues();
+    runPhase("SortOverflowValues", [&]() { sortAndCopyOverflowValues(); });
 }
 
 void CopyRelArrow::saveToFile() {
+    Timer timer;
+    timer.start();
     logger->debug("Writing columns and Lists to disk for rel {}.", tableSchema->tableName);
     for (auto relDirection : REL_DIRECTIONS) {
         if (reinterpret_cast<RelTableSchema*>(tableSchema)
@@ -82,6 +148,8 @@ void CopyRelArrow::saveToFile() {
         }
     }
     logger->debug("Done writing columns and lists to disk for rel {}.", tableSchema->tableName);
+    timer.stop();
+    phaseTimesMS.emplace_back("SaveToFile", timer.getDuration() / 1000);
 }
 
 void CopyRelArrow::initializeColumns(RelDirection relDirection) {
@@ -179,35 +247,34 @@ void CopyRelArrow::initializePkIndexes(table_id_t nodeTableID, BufferManager& bu
             bufferManager, nullptr /* wal */));
 }
 
-arrow::Status CopyRelArrow::executePopulateTask(PopulateTaskType populateTaskType) {
+arrow::Status CopyRelArrow::executePopulateTask() {
     arrow::Status status;
     switch (copyDescription.fileType) {
     case CopyDescription::FileType::CSV: {
-        status = populateFromCSV(populateTaskType);
+        status = populateFromCSV();
     } break;
     case CopyDescription::FileType::ARROW: {
-        status = populateFromArrow(populateTaskType);
+        status = populateFromArrow();
     } break;
     case CopyDescription::FileType::PARQUET: {
-        status = populateFromParquet(populateTaskType);
+        status = populateFromParquet();
     } break;
+    default: {
+        throw CopyException{StringUtils::string_format("Unrecognized file type: {}.",
+            CopyDescription::getFileTypeName(copyDescription.fileType))};
+    }
     }
     return status;
 }
 
-arrow::Status CopyRelArrow::populateFromCSV(PopulateTaskType populateTaskType) {
+arrow::Status CopyRelArrow::populateFromCSV() {
     auto populateTask = populateAdjColumnsAndCountRelsInAdjListsTask<arrow::Array>;
-    if (populateTaskType == PopulateTaskType::populateListsTask) {
-        populateTask = populateListsTask<arrow::Array>;
-    }
-    logger->debug("Assigning task {0}", getTaskTypeName(populateTaskType));
-
+    offset_t startOffset = 0;
     for (auto& filePath : copyDescription.filePaths) {
-        offset_t startOffset = fileBlockInfos.at(filePath).startOffset;
         std::shared_ptr<arrow::csv::StreamingReader> csv_streaming_reader;
         auto status = initCSVReaderAndCheckStatus(csv_streaming_reader, filePath);
+        throwCopyExceptionIfNotOK(status);
         std::shared_ptr<arrow::RecordBatch> currBatch;
-        int blockIdx = 0;
         auto it = csv_streaming_reader->begin();
         auto endIt = csv_streaming_reader->end();
         while (it != endIt) {
@@ -216,10 +283,11 @@ arrow::Status CopyRelArrow::populateFromCSV(PopulateTaskType populateTaskType) {
                     break;
                 }
                 ARROW_ASSIGN_OR_RAISE(currBatch, *it);
-                taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(
-                    populateTask, blockIdx, startOffset, this, currBatch->columns(), filePath));
-                startOffset += currBatch->num_rows();
-                ++blockIdx;
+                auto numRelsInBlock = currBatch->num_rows();
+                taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(populateTask,
+                    startOffset, numRelsInBlock, this, currBatch->columns(),
+                    addRelsBlock(numRelsInBlock, startOffset)));
+                startOffset += numRelsInBlock;
                 ++it;
             }
             taskScheduler.waitUntilEnoughTasksFinish(
@@ -227,78 +295,105 @@ arrow::Status CopyRelArrow::populateFromCSV(PopulateTaskType populateTaskType) {
         }
         taskScheduler.waitAllTasksToCompleteOrError();
     }
+    numRows = startOffset;
     return arrow::Status::OK();
 }
 
-arrow::Status CopyRelArrow::populateFromArrow(PopulateTaskType populateTaskType) {
+arrow::Status CopyRelArrow::populateFromArrow() {
     auto populateTask = populateAdjColumnsAndCountRelsInAdjListsTask<arrow::Array>;
-    if (populateTaskType == PopulateTaskType::populateListsTask) {
-        populateTask = populateListsTask<arrow::Array>;
-    }
-    logger->debug("Assigning task {0}", getTaskTypeName(populateTaskType));
-
     std::shared_ptr<arrow::ipc::RecordBatchFileReader> ipc_reader;
     auto status = initArrowReaderAndCheckStatus(ipc_reader, copyDescription.filePaths[0]);
+    throwCopyExceptionIfNotOK(status);
     std::shared_ptr<arrow::RecordBatch> currBatch;
     int blockIdx = 0;
     offset_t startOffset = 0;
-    auto numBlocksInFile = fileBlockInfos.at(copyDescription.filePaths[0]).numBlocks;
+    auto numBlocksInFile = ipc_reader->num_record_batches();
     while (blockIdx < numBlocksInFile) {
         for (int i = 0; i < CopyConstants::NUM_COPIER_TASKS_TO_SCHEDULE_PER_BATCH; ++i) {
             if (blockIdx == numBlocksInFile) {
                 break;
             }
             ARROW_ASSIGN_OR_RAISE(currBatch, ipc_reader->ReadRecordBatch(blockIdx));
-            taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(populateTask, blockIdx,
-                startOffset, this, currBatch->columns(), copyDescription.filePaths[0]));
-            startOffset += currBatch->num_rows();
+            auto numRelsInBlock = currBatch->num_rows();
+            taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(populateTask, startOffset,
+                numRelsInBlock, this, currBatch->columns(),
+                addRelsBlock(numRelsInBlock, startOffset)));
+            startOffset += numRelsInBlock;
             ++blockIdx;
         }
         taskScheduler.waitUntilEnoughTasksFinish(
             CopyConstants::MINIMUM_NUM_COPIER_TASKS_TO_SCHEDULE_MORE);
     }
-
     taskScheduler.waitAllTasksToCompleteOrError();
+    numRows = startOffset;
     return arrow::Status::OK();
 }
 
-arrow::Status CopyRelArrow::populateFromParquet(PopulateTaskType populateTaskType) {
+arrow::Status CopyRelArrow::populateFromParquet() {
     auto populateTask = populateAdjColumnsAndCountRelsInAdjListsTask<arrow::ChunkedArray>;
-    if (populateTaskType == PopulateTaskType::populateListsTask) {
-        populateTask = populateListsTask<arrow::ChunkedArray>;
-    }
-    logger->debug("Assigning task {0}", getTaskTypeName(populateTaskType));
-
     std::unique_ptr<parquet::arrow::FileReader> reader;
     auto status = initParquetReaderAndCheckStatus(reader, copyDescription.filePaths[0]);
+    throwCopyExceptionIfNotOK(status);
     std::shared_ptr<arrow::Table> currTable;
     int blockIdx = 0;
     offset_t startOffset = 0;
-    auto numBlocks = fileBlockInfos.at(copyDescription.filePaths[0]).numBlocks;
+    auto numBlocks = reader->num_row_groups();
     while (blockIdx < numBlocks) {
         for (int i = 0; i < CopyConstants::NUM_COPIER_TASKS_TO_SCHEDULE_PER_BATCH; ++i) {
             if (blockIdx == numBlocks) {
                 break;
             }
             ARROW_RETURN_NOT_OK(reader->RowGroup(blockIdx)->ReadTable(&currTable));
-            taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(populateTask, blockIdx,
-                startOffset, this, currTable->columns(), copyDescription.filePaths[0]));
-            startOffset += currTable->num_rows();
+            auto numRelsInBlock = currTable->num_rows();
+            taskScheduler.scheduleTask(CopyTaskFactory::createCopyTask(populateTask, startOffset,
+                numRelsInBlock, this, currTable->columns(),
+                addRelsBlock(numRelsInBlock, startOffset)));
+            startOffset += numRelsInBlock;
             ++blockIdx;
         }
         taskScheduler.waitUntilEnoughTasksFinish(
             CopyConstants::MINIMUM_NUM_COPIER_TASKS_TO_SCHEDULE_MORE);
     }
-
     taskScheduler.waitAllTasksToCompleteOrError();
+    numRows = startOffset;
     return arrow::Status::OK();
 }
 
+CopyRelArrow::RelsBlock* CopyRelArrow::addRelsBlock(uint64_t numRels, offset_t startRelID) {
+    if (adjListsPerDirection[FWD] == nullptr && adjListsPerDirection[BWD] == nullptr) {
+        return nullptr;
+    }
+    auto numBytes = RelsBlock::getNumBytes(numRels, tableSchema->properties);
+    if (numBytesOfResidentRelsBlocks + numBytes <= relsBlocksMemoryBudget) {
+        numBytesOfResidentRelsBlocks += numBytes;
+        relsBlocks.push_back(std::make_unique<RelsBlock>(
+            numRels, startRelID, tableSchema->properties, true /* resident */, 0 /* fileOffset */));
+        return relsBlocks.back().get();
+    }
+    if (spillFile == nullptr) {
+        spillFile = FileUtils::openFile(
+            StorageUtils::getRelsSpillFName(outputDirectory, tableSchema->tableID),
+            O_RDWR | O_CREAT | O_TRUNC);
+    }
+    relsBlocks.push_back(std::make_unique<RelsBlock>(
+        numRels, startRelID, tableSchema->properties, false /* resident */, spillFileSize));
+    spillFileSize += numBytes;
+    return relsBlocks.back().get();
+}
+
+void CopyRelArrow::removeSpillFile() {
+    if (spillFile == nullptr) {
+        return;
+    }
+    auto spillFilePath = spillFile->path;
+    spillFile.reset();
+    FileUtils::removeFileIfExists(spillFilePath);
+}
+
 void CopyRelArrow::populateAdjColumnsAndCountRelsInAdjLists() {
     logger->info(
         "Populating adj columns and rel property columns for rel {}.", tableSchema->tableName);
-    auto status =
-        executePopulateTask(PopulateTaskType::populateAdjColumnsAndCountRelsInAdjListsTask);
+    auto status = executePopulateTask();
     throwCopyExceptionIfNotOK(status);
     logger->info(
         "Done populating adj columns and rel property columns for rel {}.", tableSchema->tableName);
@@ -306,8 +401,15 @@ void CopyRelArrow::populateAdjColumnsAndCountRelsInAdjLists() {
 
 void CopyRelArrow::populateLists() {
     logger->debug("Populating adjLists and rel property lists for rel {}.", tableSchema->tableName);
-    auto status = executePopulateTask(PopulateTaskType::populateListsTask);
-    throwCopyExceptionIfNotOK(status);
+    // Blocks no longer depend on the input, so they are all scheduled at once. Only the spilled
+    // blocks of running tasks are loaded back in memory.
+    for (auto& relsBlock : relsBlocks) {
+        taskScheduler.scheduleTask(
+            CopyTaskFactory::createCopyTask(populateListsTask, this, relsBlock.get()));
+    }
+    taskScheduler.waitAllTasksToCompleteOrError();
+    relsBlocks.clear();
+    removeSpillFile();
     logger->debug(
         "Done populating adjLists and rel property lists for rel {}.", tableSchema->tableName);
 }
@@ -374,47 +476,54 @@ void CopyRelArrow::sortAndCopyOverflowValues() {
 }
 
 template<typename T>
-void CopyRelArrow::inferTableIDsAndOffsets(const std::vector<std::shared_ptr<T>>& batchColumns,
-    std::vector<nodeID_t>& nodeIDs, std::vector<DataType>& nodeIDTypes,
+void CopyRelArrow::lookupNodeOffsets(const std::vector<std::shared_ptr<T>>& batchColumns,
+    uint64_t numRels, const std::vector<DataType>& nodePKTypes,
+    const std::vector<table_id_t>& nodeTableIDs,
     const std::map<table_id_t, std::unique_ptr<PrimaryKeyIndex>>& pkIndexes,
-    Transaction* transaction, int64_t blockOffset, int64_t& colIndex) {
+    Transaction* transaction, offset_t** nodeOffsetsPerDirection) {
+    if (batchColumns.size() < REL_DIRECTIONS.size()) {
+        throw CopyException("Number of columns mismatch.");
+    }
     for (auto& relDirection : REL_DIRECTIONS) {
-        if (colIndex >= batchColumns.size()) {
-            throw CopyException("Number of columns mismatch.");
-        }
-        auto keyToken = batchColumns[colIndex]->GetScalar(blockOffset)->get()->ToString();
-        auto keyStr = keyToken.c_str();
-        ++colIndex;
-        switch (nodeIDTypes[relDirection].typeID) {
+        auto& keyColumn = batchColumns[relDirection];
+        auto pkIndex = pkIndexes.at(nodeTableIDs[relDirection]).get();
+        auto nodeOffsets = nodeOffsetsPerDirection[relDirection];
+        switch (nodePKTypes[relDirection].typeID) {
         case INT64: {
-            auto key = TypeUtils::convertStringToNumber<int64_t>(keyStr);
-            if (!pkIndexes.at(nodeIDs[relDirection].tableID)
-                     ->lookup(transaction, key, nodeIDs[relDirection].offset)) {
-                throw CopyException("Cannot find key: " + std::to_string(key) + " in the pkIndex.");
+            for (auto blockOffset = 0u; blockOffset < numRels; ++blockOffset) {
+                auto keyToken = keyColumn->GetScalar(blockOffset)->get()->ToString();
+                auto key = TypeUtils::convertStringToNumber<int64_t>(keyToken.c_str());
+                if (!pkIndex->lookup(transaction, key, nodeOffsets[blockOffset])) {
+                    throw CopyException(
+                        "Cannot find key: " + std::to_string(key) + " in the pkIndex.");
+                }
             }
         } break;
         case STRING: {
-            if (!pkIndexes.at(nodeIDs[relDirection].tableID)
-                     ->lookup(transaction, keyStr, nodeIDs[relDirection].offset)) {
-                throw CopyException("Cannot find key: " + std::string(keyStr) + " in the pkIndex.");
+            for (auto blockOffset = 0u; blockOffset < numRels; ++blockOffset) {
+                auto keyToken = keyColumn->GetScalar(blockOffset)->get()->ToString();
+                if (!pkIndex->lookup(transaction, keyToken.c_str(), nodeOffsets[blockOffset])) {
+                    throw CopyException("Cannot find key: " + keyToken + " in the pkIndex.");
+                }
             }
         } break;
         default:
             throw CopyException("Unsupported data type " +
-                                Types::dataTypeToString(nodeIDTypes[relDirection]) +
+                                Types::dataTypeToString(nodePKTypes[relDirection]) +
                                 " for index lookup.");
         }
     }
 }
 
 template<typename T>
-void CopyRelArrow::putPropsOfLineIntoColumns(CopyRelArrow* copier,
+void CopyRelArrow::putPropsOfLine(CopyRelArrow* copier,
     std::vector<PageByteCursor>& inMemOverflowFileCursors,
     const std::vector<std::shared_ptr<T>>& batchColumns, const std::vector<nodeID_t>& nodeIDs,
-    int64_t blockOffset, int64_t& colIndex) {
+    int64_t blockOffset, RelsBlock* relsBlock) {
     auto& properties = copier->tableSchema->properties;
-    auto& directionTablePropertyColumns = copier->propertyColumnsPerDirection;
     auto& inMemOverflowFilePerPropertyID = copier->overflowFilePerPropertyID;
+    // The first two columns are the keys of the source and destination nodes.
+    int64_t colIndex = REL_DIRECTIONS.size();
     for (auto propertyIdx = RelTableSchema::INTERNAL_REL_ID_PROPERTY_IDX + 1;
          propertyIdx < properties.size(); propertyIdx++) {
         if (colIndex >= batchColumns.size()) {
@@ -431,48 +540,48 @@ void CopyRelArrow::putPropsOfLineIntoColumns(CopyRelArrow* copier,
         switch (properties[propertyIdx].dataType.typeID) {
         case INT64: {
             auto val = TypeUtils::convertStringToNumber<int64_t>(data);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case INT32: {
             auto val = TypeUtils::convertStringToNumber<int32_t>(data);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case INT16: {
             auto val = TypeUtils::convertStringToNumber<int16_t>(data);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case DOUBLE: {
             auto val = TypeUtils::convertStringToNumber<double_t>(data);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case BOOL: {
             auto val = TypeUtils::convertToBoolean(data);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case DATE: {
             auto val = Date::FromCString(data, stringToken.length());
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case TIMESTAMP: {
             auto val = Timestamp::FromCString(data, stringToken.length());
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case INTERVAL: {
             auto val = Interval::FromCString(data, stringToken.length());
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         case STRING: {
             auto kuStr = inMemOverflowFilePerPropertyID[propertyIdx]->copyString(
                 data, inMemOverflowFileCursors[propertyIdx]);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&kuStr));
         } break;
         case VAR_LIST: {
@@ -480,18 +589,18 @@ void CopyRelArrow::putPropsOfLineIntoColumns(CopyRelArrow* copier,
                 properties[propertyIdx].dataType, copier->copyDescription);
             auto kuList = inMemOverflowFilePerPropertyID[propertyIdx]->copyList(
                 *varListVal, inMemOverflowFileCursors[propertyIdx]);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&kuList));
         } break;
         case FIXED_LIST: {
             auto fixedListVal = getArrowFixedList(stringToken, 1, stringToken.length() - 2,
                 properties[propertyIdx].dataType, copier->copyDescription);
-            putValueIntoColumns(
-                propertyIdx, directionTablePropertyColumns, nodeIDs, fixedListVal.get());
+            putPropertyValue(
+                copier, propertyIdx, nodeIDs, blockOffset, relsBlock, fixedListVal.get());
         } break;
         case FLOAT: {
             auto val = TypeUtils::convertStringToNumber<float_t>(data);
-            putValueIntoColumns(propertyIdx, directionTablePropertyColumns, nodeIDs,
+            putPropertyValue(copier, propertyIdx, nodeIDs, blockOffset, relsBlock,
                 reinterpret_cast<uint8_t*>(&val));
         } break;
         default:
@@ -501,99 +610,16 @@ void CopyRelArrow::putPropsOfLineIntoColumns(CopyRelArrow* copier,
     }
 }
 
-template<typename T>
-void CopyRelArrow::putPropsOfLineIntoLists(CopyRelArrow* copier,
-    std::vector<PageByteCursor>& inMemOverflowFileCursors,
-    const std::vector<std::shared_ptr<T>>& batchColumns, const std::vector<nodeID_t>& nodeIDs,
-    const std::vector<uint64_t>& reversePos, int64_t blockOffset, int64_t& colIndex,
-    CopyDescription& copyDescription) {
-    auto& properties = copier->tableSchema->properties;
-    auto& directionTablePropertyLists = copier->propertyListsPerDirection;
-    auto& directionTableAdjLists = copier->adjListsPerDirection;
-    auto& inMemOverflowFilesPerProperty = copier->overflowFilePerPropertyID;
-    for (auto propertyIdx = RelTableSchema::INTERNAL_REL_ID_PROPERTY_IDX + 1;
-         propertyIdx < properties.size(); propertyIdx++) {
-        if (colIndex >= batchColumns.size()) {
-            throw CopyException("Number of columns mismatch.");
-        }
-        auto currentToken = batchColumns[colIndex]->GetScalar(blockOffset);
-        if (!(*currentToken)->is_valid) {
-            ++colIndex;
-            continue;
-        }
-        auto stringToken =
-            currentToken->get()->ToString().substr(0, BufferPoolConstants::DEFAULT_PAGE_SIZE);
-        const char* data = stringToken.c_str();
-        switch (properties[propertyIdx].dataType.typeID) {
-        case INT64: {
-            auto val = TypeUtils::convertStringToNumber<int64_t>(data);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case INT32: {
-            auto val = TypeUtils::convertStringToNumber<int64_t>(data);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case INT16: {
-            auto val = TypeUtils::convertStringToNumber<int64_t>(data);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case DOUBLE: {
-            auto val = TypeUtils::convertStringToNumber<double_t>(data);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case BOOL: {
-            auto val = TypeUtils::convertToBoolean(data);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case DATE: {
-            auto val = Date::FromCString(data, stringToken.length());
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case TIMESTAMP: {
-            auto val = Timestamp::FromCString(data, stringToken.length());
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case INTERVAL: {
-            auto val = Interval::FromCString(data, stringToken.length());
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        case STRING: {
-            auto kuStr = inMemOverflowFilesPerProperty[propertyIdx]->copyString(
-                data, inMemOverflowFileCursors[propertyIdx]);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&kuStr));
-        } break;
-        case VAR_LIST: {
-            auto varListVal = getArrowVarList(stringToken, 1, stringToken.length() - 2,
-                properties[propertyIdx].dataType, copyDescription);
-            auto kuList = inMemOverflowFilesPerProperty[propertyIdx]->copyList(
-                *varListVal, inMemOverflowFileCursors[propertyIdx]);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&kuList));
-        } break;
-        case FIXED_LIST: {
-            auto fixedListVal = getArrowFixedList(stringToken, 1, stringToken.length() - 2,
-                properties[propertyIdx].dataType, copyDescription);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, fixedListVal.get());
-        } break;
-        case FLOAT: {
-            auto val = TypeUtils::convertStringToNumber<float_t>(data);
-            putValueIntoLists(propertyIdx, directionTablePropertyLists, directionTableAdjLists,
-                nodeIDs, reversePos, reinterpret_cast<uint8_t*>(&val));
-        } break;
-        default:
-            break;
-        }
-        ++colIndex;
+void CopyRelArrow::putPropertyValue(CopyRelArrow* copier, uint64_t propertyIdx,
+    const std::vector<nodeID_t>& nodeIDs, int64_t blockOffset, RelsBlock* relsBlock,
+    uint8_t* val) {
+    putValueIntoColumns(propertyIdx, copier->propertyColumnsPerDirection, nodeIDs, val);
+    if (relsBlock != nullptr) {
+        auto elementSize =
+            Types::getDataTypeSize(copier->tableSchema->properties[propertyIdx].dataType);
+        memcpy(relsBlock->getPropertyValues(propertyIdx) + blockOffset * elementSize, val,
+            elementSize);
+        relsBlock->setNonNull(propertyIdx, blockOffset);
     }
 }
 
@@ -621,30 +647,46 @@ void CopyRelArrow::copyListOverflowFromUnorderedToOrderedPages(ku_list_t* kuList
 }
 
 template<typename T>
-void CopyRelArrow::populateAdjColumnsAndCountRelsInAdjListsTask(uint64_t blockIdx,
-    uint64_t blockStartRelID, CopyRelArrow* copier,
-    const std::vector<std::shared_ptr<T>>& batchColumns, const std::string& filePath) {
-    copier->logger->debug(
-        "Start: path=`{0}` blkIdx={1}", copier->copyDescription.filePaths[0], blockIdx);
-    std::vector<bool> requireToReadTableLabels{true, true};
+void CopyRelArrow::populateAdjColumnsAndCountRelsInAdjListsTask(uint64_t blockStartRelID,
+    uint64_t numRelsInBlock, CopyRelArrow* copier,
+    const std::vector<std::shared_ptr<T>>& batchColumns, RelsBlock* relsBlock) {
+    copier->logger->debug("Start: blockStartRelID={0}", blockStartRelID);
     std::vector<nodeID_t> nodeIDs{2};
     std::vector<DataType> nodePKTypes{2};
+    std::vector<table_id_t> nodeTableIDs{2};
     auto relTableSchema = reinterpret_cast<RelTableSchema*>(copier->tableSchema);
     for (auto& relDirection : REL_DIRECTIONS) {
         auto boundTableID = relTableSchema->getBoundTableID(relDirection);
         nodeIDs[relDirection].tableID = boundTableID;
+        nodeTableIDs[relDirection] = boundTableID;
         nodePKTypes[relDirection] = copier->catalog.getReadOnlyVersion()
                                         ->getNodeTableSchema(boundTableID)
                                         ->getPrimaryKey()
                                         .dataType;
     }
+    // Bound node offsets are kept in the rels block if lists are populated from it later.
+    if (relsBlock != nullptr) {
+        relsBlock->allocate();
+    }
+    std::vector<offset_t> localNodeOffsetsPerDirection[2];
+    offset_t* nodeOffsetsPerDirection[2];
+    for (auto relDirection : REL_DIRECTIONS) {
+        if (relsBlock != nullptr) {
+            nodeOffsetsPerDirection[relDirection] = relsBlock->getBoundNodeOffsets(relDirection);
+        } else {
+            localNodeOffsetsPerDirection[relDirection].resize(numRelsInBlock);
+            nodeOffsetsPerDirection[relDirection] =
+                localNodeOffsetsPerDirection[relDirection].data();
+        }
+    }
+    lookupNodeOffsets(batchColumns, numRelsInBlock, nodePKTypes, nodeTableIDs, copier->pkIndexes,
+        copier->dummyReadOnlyTrx.get(), nodeOffsetsPerDirection);
     std::vector<PageByteCursor> inMemOverflowFileCursors{relTableSchema->getNumProperties()};
     uint64_t relID = blockStartRelID;
-    auto numLinesInCurBlock = copier->fileBlockInfos.at(filePath).numLinesPerBlock[blockIdx];
-    for (auto blockOffset = 0u; blockOffset < numLinesInCurBlock; ++blockOffset) {
-        int64_t colIndex = 0;
-        inferTableIDsAndOffsets(batchColumns, nodeIDs, nodePKTypes, copier->pkIndexes,
-            copier->dummyReadOnlyTrx.get(), blockOffset, colIndex);
+    for (auto blockOffset = 0u; blockOffset < numRelsInBlock; ++blockOffset) {
+        for (auto relDirection : REL_DIRECTIONS) {
+            nodeIDs[relDirection].offset = nodeOffsetsPerDirection[relDirection][blockOffset];
+        }
         for (auto relDirection : REL_DIRECTIONS) {
             auto tableID = nodeIDs[relDirection].tableID;
             auto nodeOffset = nodeIDs[relDirection].offset;
@@ -664,67 +706,66 @@ void CopyRelArrow::populateAdjColumnsAndCountRelsInAdjListsTask(uint64_t blockId
                 InMemListsUtils::incrementListSize(
                     *copier->listSizesPerDirection[relDirection], nodeOffset, 1);
             }
-            copier->numRels++;
         }
         if (relTableSchema->getNumUserDefinedProperties() != 0) {
-            putPropsOfLineIntoColumns<T>(
-                copier, inMemOverflowFileCursors, batchColumns, nodeIDs, blockOffset, colIndex);
+            putPropsOfLine<T>(
+                copier, inMemOverflowFileCursors, batchColumns, nodeIDs, blockOffset, relsBlock);
         }
         putValueIntoColumns(relTableSchema->getRelIDDefinition().propertyID,
             copier->propertyColumnsPerDirection, nodeIDs, (uint8_t*)&relID);
         relID++;
     }
-    copier->logger->debug(
-        "End: path=`{0}` blkIdx={1}", copier->copyDescription.filePaths[0], blockIdx);
+    if (relsBlock != nullptr && !relsBlock->isResident()) {
+        relsBlock->spill(copier->spillFile.get());
+    }
+    copier->logger->debug("End: blockStartRelID={0}", blockStartRelID);
 }
 
-template<typename T>
-void CopyRelArrow::populateListsTask(uint64_t blockId, uint64_t blockStartRelID,
-    CopyRelArrow* copier, const std::vector<std::shared_ptr<T>>& batchColumns,
-    const std::string& filePath) {
-    copier->logger->trace(
-        "Start: path=`{0}` blkIdx={1}", copier->copyDescription.filePaths[0], blockId);
+void CopyRelArrow::populateListsTask(CopyRelArrow* copier, RelsBlock* relsBlock) {
+    copier->logger->trace("Start: blockStartRelID={0}", relsBlock->startRelID);
+    if (!relsBlock->isResident()) {
+        relsBlock->load(copier->spillFile.get());
+    }
     std::vector<nodeID_t> nodeIDs(2);
-    std::vector<DataType> nodePKTypes(2);
     std::vector<uint64_t> reversePos(2);
     auto relTableSchema = reinterpret_cast<RelTableSchema*>(copier->tableSchema);
     for (auto relDirection : REL_DIRECTIONS) {
-        auto boundTableID = relTableSchema->getBoundTableID(relDirection);
-        nodeIDs[relDirection].tableID = boundTableID;
-        nodePKTypes[relDirection] = copier->catalog.getReadOnlyVersion()
-                                        ->getNodeTableSchema(nodeIDs[relDirection].tableID)
-                                        ->getPrimaryKey()
-                                        .dataType;
+        nodeIDs[relDirection].tableID = relTableSchema->getBoundTableID(relDirection);
     }
-    std::vector<PageByteCursor> inMemOverflowFileCursors(relTableSchema->getNumProperties());
-    uint64_t relID = blockStartRelID;
-    auto numLinesInCurBlock = copier->fileBlockInfos.at(filePath).numLinesPerBlock[blockId];
-    for (auto blockOffset = 0u; blockOffset < numLinesInCurBlock; ++blockOffset) {
-        int64_t colIndex = 0;
-        inferTableIDsAndOffsets(batchColumns, nodeIDs, nodePKTypes, copier->pkIndexes,
-            copier->dummyReadOnlyTrx.get(), blockOffset, colIndex);
+    auto& properties = relTableSchema->properties;
+    uint64_t relID = relsBlock->startRelID;
+    for (auto blockOffset = 0u; blockOffset < relsBlock->numRels; ++blockOffset) {
+        for (auto relDirection : REL_DIRECTIONS) {
+            nodeIDs[relDirection].offset =
+                relsBlock->getBoundNodeOffsets(relDirection)[blockOffset];
+        }
         for (auto relDirection : REL_DIRECTIONS) {
-            if (!copier->catalog.getReadOnlyVersion()->isSingleMultiplicityInDirection(
-                    copier->tableSchema->tableID, relDirection)) {
+            if (!relTableSchema->isSingleMultiplicityInDirection(relDirection)) {
                 auto nodeOffset = nodeIDs[relDirection].offset;
                 auto adjLists = copier->adjListsPerDirection[relDirection].get();
                 reversePos[relDirection] = InMemListsUtils::decrementListSize(
-                    *copier->listSizesPerDirection[relDirection], nodeIDs[relDirection].offset, 1);
+                    *copier->listSizesPerDirection[relDirection], nodeOffset, 1);
                 adjLists->setElement(adjLists->getListHeadersBuilder()->getHeader(nodeOffset),
                     nodeOffset, reversePos[relDirection], (uint8_t*)(&nodeIDs[!relDirection]));
             }
         }
-        if (relTableSchema->getNumUserDefinedProperties() != 0) {
-            putPropsOfLineIntoLists<T>(copier, inMemOverflowFileCursors, batchColumns, nodeIDs,
-                reversePos, blockOffset, colIndex, copier->copyDescription);
+        for (auto propertyIdx = RelTableSchema::INTERNAL_REL_ID_PROPERTY_IDX + 1;
+             propertyIdx < properties.size(); propertyIdx++) {
+            if (relsBlock->isNull(propertyIdx, blockOffset)) {
+                continue;
+            }
+            auto elementSize = Types::getDataTypeSize(properties[propertyIdx].dataType);
+            putValueIntoLists(propertyIdx, copier->propertyListsPerDirection,
+                copier->adjListsPerDirection, nodeIDs, reversePos,
+                relsBlock->getPropertyValues(propertyIdx) + blockOffset * elementSize);
         }
         putValueIntoLists(relTableSchema->getRelIDDefinition().propertyID,
             copier->propertyListsPerDirection, copier->adjListsPerDirection, nodeIDs, reversePos,
             (uint8_t*)&relID);
         relID++;
     }
-    copier->logger->trace(
-        "End: path=`{0}` blkIdx={1}", copier->copyDescription.filePaths[0], blockId);
+    relsBlock->release();
+    copier->logger->trace("End: blockStartRelID={0}", relsBlock->startRelID);
 }
 
 void CopyRelArrow::sortOverflowValuesOfPropertyColumnTask(const DataType& dataType,
@@ -16,7 +16,8 @@ FileHandle::FileHandle(const std::string& path, uint8_t flags) : flags{flags} {
 }
 
 void FileHandle::constructExistingFileHandle(const std::string& path) {
-    int openFlags = O_RDWR | ((createFileIfNotExists()) ? O_CREAT : 0x00000000);
+    int openFlags =
+        isReadOnly() ? O_RDONLY : O_RDWR | ((createFileIfNotExists()) ? O_CREAT : 0x00000000);
     fileInfo = FileUtils::openFile(path, openFlags);
     auto fileLength = FileUtils::getFileSize(fileInfo->fd);
     numPages = ceil((double)fileLength / (double)getPageSize());
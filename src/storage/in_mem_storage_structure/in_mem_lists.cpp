@@ -16,14 +16,14 @@ PageElementCursor InMemListsUtils::calcPageElementCursor(uint32_t header, uint64
         auto lAdjListIdx = ListHeaders::getLargeListIdx(header);
         auto pos = metadataBuilder.getNumElementsInLargeLists(lAdjListIdx) - reversePos;
         cursor = PageUtils::getPageElementCursorForPos(pos, numElementsInAPage);
-        cursor.pageIdx = metadataBuilder.getPageMapperForLargeListIdx(lAdjListIdx)(cursor.pageIdx);
+        cursor.pageIdx = metadataBuilder.getPageIdxInLargeList(lAdjListIdx, cursor.pageIdx);
     } else {
         auto chunkId = StorageUtils::getListChunkIdx(nodeOffset);
         auto [listLen, csrOffset] = ListHeaders::getSmallListLenAndCSROffset(header);
         auto pos = listLen - reversePos;
         cursor = PageUtils::getPageElementCursorForPos(csrOffset + pos, numElementsInAPage);
-        cursor.pageIdx = metadataBuilder.getPageMapperForChunkIdx(chunkId)(
-            (csrOffset + pos) / numElementsInAPage);
+        cursor.pageIdx =
+            metadataBuilder.getPageIdxInChunk(chunkId, (csrOffset + pos) / numElementsInAPage);
     }
     return cursor;
 }
@@ -1,5 +1,7 @@
 #include "storage/index/hash_index.h"
 
+#include <bit>
+
 #include "common/exception.h"
 #include "storage/index/hash_index_utils.h"
 
@@ -205,7 +207,7 @@ bool HashIndex<T>::insertInternal(const uint8_t* key, offset_t value) {
 template<typename T>
 template<ChainedSlotsAction action>
 bool HashIndex<T>::performActionInChainedSlots(TransactionType trxType, HashIndexHeader& header,
-    SlotInfo& slotInfo, const uint8_t* key, offset_t& result) {
+    SlotInfo& slotInfo, const uint8_t* key, uint8_t fingerprint, offset_t& result) {
     while (slotInfo.slotType == SlotType::PRIMARY || slotInfo.slotId != 0) {
         auto slot = getSlot(trxType, slotInfo);
         if constexpr (action == ChainedSlotsAction::FIND_FREE_SLOT) {
@@ -215,7 +217,7 @@ bool HashIndex<T>::performActionInChainedSlots(TransactionType trxType, HashInde
                 break;
             }
         } else {
-            auto entryPos = findMatchedEntryInSlot(trxType, slot, key);
+            auto entryPos = findMatchedEntryInSlot(trxType, slot, key, fingerprint);
             if (entryPos != SlotHeader::INVALID_ENTRY_POS) {
                 if constexpr (action == ChainedSlotsAction::LOOKUP_IN_SLOTS) {
                     result =
@@ -241,9 +243,10 @@ bool HashIndex<T>::lookupInPersistentIndex(
     auto header = trxType == TransactionType::READ_ONLY ?
                       *indexHeader :
                       headerArray->get(INDEX_HEADER_IDX_IN_ARRAY, TransactionType::WRITE);
-    SlotInfo slotInfo{getPrimarySlotIdForKey(header, key), SlotType::PRIMARY};
+    auto hash = keyHashFunc(key);
+    SlotInfo slotInfo{getPrimarySlotIdForHash(header, hash), SlotType::PRIMARY};
     return performActionInChainedSlots<ChainedSlotsAction::LOOKUP_IN_SLOTS>(
-        trxType, header, slotInfo, key, result);
+        trxType, header, slotInfo, key, getFingerprintForHash(hash), result);
 }
 
 template<typename T>
@@ -254,13 +257,14 @@ void HashIndex<T>::insertIntoPersistentIndex(const uint8_t* key, offset_t value)
            pSlots->getNumElements(TransactionType::WRITE) * HashIndexConstants::SLOT_CAPACITY) {
         splitSlot(header);
     }
-    auto pSlotId = getPrimarySlotIdForKey(header, key);
-    SlotInfo slotInfo{pSlotId, SlotType::PRIMARY};
+    auto hash = keyHashFunc(key);
+    auto fingerprint = getFingerprintForHash(hash);
+    SlotInfo slotInfo{getPrimarySlotIdForHash(header, hash), SlotType::PRIMARY};
     offset_t result;
     performActionInChainedSlots<ChainedSlotsAction::FIND_FREE_SLOT>(
-        TransactionType::WRITE, header, slotInfo, key, result);
+        TransactionType::WRITE, header, slotInfo, key, fingerprint, result);
     Slot slot = getSlot(TransactionType::WRITE, slotInfo);
-    copyKVOrEntryToSlot(false /* insert kv */, slotInfo, slot, key, value);
+    copyKVOrEntryToSlot(false /* insert kv */, slotInfo, slot, key, fingerprint, value);
     header.numEntries++;
     headerArray->update(INDEX_HEADER_IDX_IN_ARRAY, header);
 }
@@ -268,10 +272,11 @@ void HashIndex<T>::insertIntoPersistentIndex(const uint8_t* key, offset_t value)
 template<typename T>
 void HashIndex<T>::deleteFromPersistentIndex(const uint8_t* key) {
     auto header = headerArray->get(INDEX_HEADER_IDX_IN_ARRAY, TransactionType::WRITE);
-    SlotInfo slotInfo{getPrimarySlotIdForKey(header, key), SlotType::PRIMARY};
+    auto hash = keyHashFunc(key);
+    SlotInfo slotInfo{getPrimarySlotIdForHash(header, hash), SlotType::PRIMARY};
     offset_t result;
     performActionInChainedSlots<ChainedSlotsAction::DELETE_IN_SLOTS>(
-        TransactionType::WRITE, header, slotInfo, key, result);
+        TransactionType::WRITE, header, slotInfo, key, getFingerprintForHash(hash), result);
     headerArray->update(INDEX_HEADER_IDX_IN_ARRAY, header);
 }
 
@@ -316,17 +321,17 @@ void HashIndex<T>::rehashSlots(HashIndexHeader& header) {
                 hash = keyHashFunc(key);
             }
             auto newSlotId = hash & header.higherLevelHashMask;
-            copyEntryToSlot(newSlotId, key);
+            copyEntryToSlot(newSlotId, key, getFingerprintForHash(hash));
         }
     }
 }
 
 template<typename T>
-void HashIndex<T>::copyEntryToSlot(slot_id_t slotId, uint8_t* entry) {
+void HashIndex<T>::copyEntryToSlot(slot_id_t slotId, uint8_t* entry, uint8_t fingerprint) {
     SlotInfo slotInfo{slotId, SlotType::PRIMARY};
     Slot<T> slot;
     loopChainedSlotsToFindOneWithFreeSpace(slotInfo, slot);
-    copyKVOrEntryToSlot(true /* copy entry */, slotInfo, slot, entry, UINT32_MAX);
+    copyKVOrEntryToSlot(true /* copy entry */, slotInfo, slot, entry, fingerprint, UINT32_MAX);
     updateSlot(slotInfo, slot);
 }
 
@@ -344,31 +349,32 @@ std::vector<std::pair<SlotInfo, Slot<T>>> HashIndex<T>::getChainedSlots(slot_id_
 }
 
 template<typename T>
-void HashIndex<T>::copyAndUpdateSlotHeader(
-    bool isCopyEntry, Slot<T>& slot, entry_pos_t entryPos, const uint8_t* key, offset_t value) {
+void HashIndex<T>::copyAndUpdateSlotHeader(bool isCopyEntry, Slot<T>& slot, entry_pos_t entryPos,
+    const uint8_t* key, uint8_t fingerprint, offset_t value) {
     if (isCopyEntry) {
         memcpy(slot.entries[entryPos].data, key, indexHeader->numBytesPerEntry);
     } else {
         keyInsertFunc(key, value, slot.entries[entryPos].data, diskOverflowFile.get());
     }
     slot.header.setEntryValid(entryPos);
+    slot.header.setFingerprint(entryPos, fingerprint);
     slot.header.numEntries++;
 }
 
 template<typename T>
-void HashIndex<T>::copyKVOrEntryToSlot(
-    bool isCopyEntry, const SlotInfo& slotInfo, Slot<T>& slot, const uint8_t* key, offset_t value) {
+void HashIndex<T>::copyKVOrEntryToSlot(bool isCopyEntry, const SlotInfo& slotInfo, Slot<T>& slot,
+    const uint8_t* key, uint8_t fingerprint, offset_t value) {
     if (slot.header.numEntries == HashIndexConstants::SLOT_CAPACITY) {
         // Allocate a new oSlot, insert the entry to the new oSlot, and update slot's
         // nextOvfSlotId.
         Slot<T> newSlot;
         auto entryPos = 0u; // Always insert to the first entry when there is a new slot.
-        copyAndUpdateSlotHeader(isCopyEntry, newSlot, entryPos, key, value);
+        copyAndUpdateSlotHeader(isCopyEntry, newSlot, entryPos, key, fingerprint, value);
         slot.header.nextOvfSlotId = oSlots->pushBack(newSlot);
     } else {
         for (auto entryPos = 0u; entryPos < HashIndexConstants::SLOT_CAPACITY; entryPos++) {
             if (!slot.header.isEntryValid(entryPos)) {
-                copyAndUpdateSlotHeader(isCopyEntry, slot, entryPos, key, value);
+                copyAndUpdateSlotHeader(isCopyEntry, slot, entryPos, key, fingerprint, value);
                 break;
             }
         }
@@ -377,12 +383,11 @@ void HashIndex<T>::copyKVOrEntryToSlot(
 }
 
 template<typename T>
-entry_pos_t HashIndex<T>::findMatchedEntryInSlot(
-    TransactionType trxType, const Slot<T>& slot, const uint8_t* key) const {
-    for (auto entryPos = 0u; entryPos < HashIndexConstants::SLOT_CAPACITY; entryPos++) {
-        if (!slot.header.isEntryValid(entryPos)) {
-            continue;
-        }
+entry_pos_t HashIndex<T>::findMatchedEntryInSlot(TransactionType trxType, const Slot<T>& slot,
+    const uint8_t* key, uint8_t fingerprint) const {
+    auto matchingEntries = slot.header.getMatchingEntriesMask(fingerprint);
+    for (; matchingEntries; matchingEntries &= matchingEntries - 1) {
+        auto entryPos = std::countr_zero(matchingEntries);
         if (keyEqualsFunc(trxType, key, slot.entries[entryPos].data, diskOverflowFile.get())) {
             return entryPos;
         }
@@ -1,20 +1,12 @@
 #include "storage/index/hash_index_builder.h"
 
+#include <bit>
+
 using namespace kuzu::common;
 
 namespace kuzu {
 namespace storage {
 
-slot_id_t BaseHashIndex::getPrimarySlotIdForKey(
-    const HashIndexHeader& indexHeader_, const uint8_t* key) {
-    auto hash = keyHashFunc(key);
-    auto slotId = hash & indexHeader_.levelHashMask;
-    if (slotId < indexHeader_.nextSplitSlotId) {
-        slotId = hash & indexHeader_.higherLevelHashMask;
-    }
-    return slotId;
-}
-
 template<typename T>
 HashIndexBuilder<T>::HashIndexBuilder(const std::string& fName, const DataType& keyDataType)
     : BaseHashIndex{keyDataType}, numEntries{0} {
@@ -59,13 +51,15 @@ void HashIndexBuilder<T>::bulkReserve(uint32_t numEntries_) {
 
 template<typename T>
 bool HashIndexBuilder<T>::appendInternal(const uint8_t* key, offset_t value) {
-    SlotInfo pSlotInfo{getPrimarySlotIdForKey(*indexHeader, key), SlotType::PRIMARY};
+    auto hash = keyHashFunc(key);
+    auto fingerprint = getFingerprintForHash(hash);
+    SlotInfo pSlotInfo{getPrimarySlotIdForHash(*indexHeader, hash), SlotType::PRIMARY};
     auto currentSlotInfo = pSlotInfo;
     Slot<T>* currentSlot = nullptr;
     lockSlot(pSlotInfo);
     while (currentSlotInfo.slotType == SlotType::PRIMARY || currentSlotInfo.slotId != 0) {
         currentSlot = getSlot(currentSlotInfo);
-        if (lookupOrExistsInSlotWithoutLock<false /* exists */>(currentSlot, key)) {
+        if (lookupOrExistsInSlotWithoutLock<false /* exists */>(currentSlot, key, fingerprint)) {
             // Key already exists. No append is allowed.
             unlockSlot(pSlotInfo);
             return false;
@@ -77,7 +71,7 @@ bool HashIndexBuilder<T>::appendInternal(const uint8_t* key, offset_t value) {
         currentSlotInfo.slotType = SlotType::OVF;
     }
     assert(currentSlot);
-    insertToSlotWithoutLock(currentSlot, key, value);
+    insertToSlotWithoutLock(currentSlot, key, fingerprint, value);
     unlockSlot(pSlotInfo);
     numEntries.fetch_add(1);
     return true;
@@ -85,12 +79,15 @@ bool HashIndexBuilder<T>::appendInternal(const uint8_t* key, offset_t value) {
 
 template<typename T>
 bool HashIndexBuilder<T>::lookupInternalWithoutLock(const uint8_t* key, offset_t& result) {
-    SlotInfo pSlotInfo{getPrimarySlotIdForKey(*indexHeader, key), SlotType::PRIMARY};
+    auto hash = keyHashFunc(key);
+    auto fingerprint = getFingerprintForHash(hash);
+    SlotInfo pSlotInfo{getPrimarySlotIdForHash(*indexHeader, hash), SlotType::PRIMARY};
     SlotInfo currentSlotInfo = pSlotInfo;
     Slot<T>* currentSlot;
     while (currentSlotInfo.slotType == SlotType::PRIMARY || currentSlotInfo.slotId != 0) {
         currentSlot = getSlot(currentSlotInfo);
-        if (lookupOrExistsInSlotWithoutLock<true /* lookup */>(currentSlot, key, &result)) {
+        if (lookupOrExistsInSlotWithoutLock<true /* lookup */>(
+                currentSlot, key, fingerprint, &result)) {
             return true;
         }
         currentSlotInfo.slotId = currentSlot->header.nextOvfSlotId;
@@ -135,11 +132,10 @@ Slot<T>* HashIndexBuilder<T>::getSlot(const SlotInfo& slotInfo) {
 template<typename T>
 template<bool IS_LOOKUP>
 bool HashIndexBuilder<T>::lookupOrExistsInSlotWithoutLock(
-    Slot<T>* slot, const uint8_t* key, offset_t* result) {
-    for (auto entryPos = 0u; entryPos < HashIndexConstants::SLOT_CAPACITY; entryPos++) {
-        if (!slot->header.isEntryValid(entryPos)) {
-            continue;
-        }
+    Slot<T>* slot, const uint8_t* key, uint8_t fingerprint, offset_t* result) {
+    auto matchingEntries = slot->header.getMatchingEntriesMask(fingerprint);
+    for (; matchingEntries; matchingEntries &= matchingEntries - 1) {
+        auto entryPos = std::countr_zero(matchingEntries);
         auto& entry = slot->entries[entryPos];
         if (keyEqualsFunc(key, entry.data, inMemOverflowFile.get())) {
             if constexpr (IS_LOOKUP) {
@@ -153,7 +149,7 @@ bool HashIndexBuilder<T>::lookupOrExistsInSlotWithoutLock(
 
 template<typename T>
 void HashIndexBuilder<T>::insertToSlotWithoutLock(
-    Slot<T>* slot, const uint8_t* key, offset_t value) {
+    Slot<T>* slot, const uint8_t* key, uint8_t fingerprint, offset_t value) {
     if (slot->header.numEntries == HashIndexConstants::SLOT_CAPACITY) {
         // Allocate a new oSlot and change the nextOvfSlotId.
         auto ovfSlotId = allocateAOSlot();
@@ -164,6 +160,7 @@ void HashIndexBuilder<T>::insertToSlotWithoutLock(
         if (!slot->header.isEntryValid(entryPos)) {
             keyInsertFunc(key, value, slot->entries[entryPos].data, inMemOverflowFile.get());
             slot->header.setEntryValid(entryPos);
+            slot->header.setFingerprint(entryPos, fingerprint);
             slot->header.numEntries++;
             break;
         }
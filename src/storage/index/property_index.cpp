@@ -0,0 +1,364 @@
+#include "storage/index/property_index.h"
+
+using namespace kuzu::common;
+using namespace kuzu::transaction;
+
+namespace kuzu {
+namespace storage {
+
+PropertyIndexBuilder::PropertyIndexBuilder(const std::string& fName) {
+    fileHandle =
+        std::make_unique<FileHandle>(fName, FileHandle::O_PERSISTENT_FILE_CREATE_NOT_EXISTS);
+    fileHandle->addNewPage(); // PROPERTY_INDEX_HEADER_ARRAY_HEADER_PAGE
+    fileHandle->addNewPage(); // MAIN_ENTRIES_HEADER_PAGE
+    fileHandle->addNewPage(); // DELTA_ENTRIES_HEADER_PAGE
+    headerArray = std::make_unique<InMemDiskArrayBuilder<PropertyIndexHeader>>(
+        *fileHandle, PROPERTY_INDEX_HEADER_ARRAY_HEADER_PAGE_IDX, 0 /* numElements */);
+    mainEntries = std::make_unique<InMemDiskArrayBuilder<PropertyIndexEntry>>(
+        *fileHandle, MAIN_ENTRIES_HEADER_PAGE_IDX, 0 /* numElements */);
+    deltaEntries = std::make_unique<InMemDiskArrayBuilder<PropertyIndexEntry>>(
+        *fileHandle, DELTA_ENTRIES_HEADER_PAGE_IDX, 0 /* numElements */);
+}
+
+void PropertyIndexBuilder::flush() {
+    std::sort(entries.begin(), entries.end());
+    mainEntries->resize(entries.size(), false /* setToZero */);
+    for (auto i = 0u; i < entries.size(); ++i) {
+        mainEntries->operator[](i) = entries[i];
+    }
+    headerArray->resize(1, true /* setToZero */);
+    headerArray->operator[](PROPERTY_INDEX_HEADER_IDX_IN_ARRAY).numMainEntries = entries.size();
+    headerArray->saveToDisk();
+    mainEntries->saveToDisk();
+    deltaEntries->saveToDisk();
+}
+
+PropertyIndex::PropertyIndex(const StorageStructureIDAndFName& storageStructureIDAndFName,
+    DataType dataType, Column* column, table_id_t tableID, BufferManager& bufferManager, WAL* wal)
+    : dataType{std::move(dataType)}, column{column}, tableID{tableID},
+      bufferManager{bufferManager}, wal{wal} {
+    fileHandle = bufferManager.getBufferManagedFileHandle(storageStructureIDAndFName.fName,
+        FileHandle::O_PERSISTENT_FILE_NO_CREATE,
+        BufferManagedFileHandle::FileVersionedType::VERSIONED_FILE);
+    headerArray = std::make_unique<BaseDiskArray<PropertyIndexHeader>>(*fileHandle,
+        storageStructureIDAndFName.storageStructureID, PROPERTY_INDEX_HEADER_ARRAY_HEADER_PAGE_IDX,
+        &bufferManager, wal);
+    mainEntries = std::make_unique<BaseDiskArray<PropertyIndexEntry>>(*fileHandle,
+        storageStructureIDAndFName.storageStructureID, MAIN_ENTRIES_HEADER_PAGE_IDX,
+        &bufferManager, wal);
+    deltaEntries = std::make_unique<BaseDiskArray<PropertyIndexEntry>>(*fileHandle,
+        storageStructureIDAndFName.storageStructureID, DELTA_ENTRIES_HEADER_PAGE_IDX,
+        &bufferManager, wal);
+}
+
+bool PropertyIndex::isSupportedComparison(ExpressionType comparisonType) {
+    switch (comparisonType) {
+    case EQUALS:
+    case GREATER_THAN:
+    case GREATER_THAN_EQUALS:
+    case LESS_THAN:
+    case LESS_THAN_EQUALS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Signed integers are flipped on their sign bit and doubles on all bits if negative, so that keys
+// compare as unsigned integers in the order of the values.
+uint64_t PropertyIndex::encodeKey(DataTypeID typeID, const uint8_t* value) {
+    static constexpr uint64_t SIGN_BIT = (uint64_t)1 << 63;
+    switch (typeID) {
+    case INT64:
+    case TIMESTAMP:
+        return (uint64_t)*(int64_t*)value ^ SIGN_BIT;
+    case INT32:
+    case DATE:
+        return (uint64_t)(int64_t)(*(int32_t*)value) ^ SIGN_BIT;
+    case INT16:
+        return (uint64_t)(int64_t)(*(int16_t*)value) ^ SIGN_BIT;
+    case DOUBLE: {
+        // -0.0 and 0.0 are equal, so they must have the same key.
+        auto doubleValue = *(double*)value == 0 ? 0.0 : *(double*)value;
+        uint64_t bits;
+        memcpy(&bits, &doubleValue, sizeof(bits));
+        return (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    }
+    case STRING: {
+        auto& str = *(ku_string_t*)value;
+        return encodeStringKey((const char*)str.getData(), str.len);
+    }
+    default:
+        throw StorageException("Cannot index a value of type " + Types::dataTypeToString(typeID) +
+                               ".");
+    }
+}
+
+// The first 8 bytes of the string, zero padded and read as a big-endian integer.
+uint64_t PropertyIndex::encodeStringKey(const char* data, uint64_t length) {
+    uint64_t key = 0;
+    for (auto i = 0u; i < sizeof(uint64_t); ++i) {
+        key = (key << 8) | (i < length ? (uint8_t)data[i] : 0);
+    }
+    return key;
+}
+
+uint64_t PropertyIndex::encodeKey(const Value& value) {
+    switch (value.getDataType().typeID) {
+    case INT64: {
+        auto val = value.getValue<int64_t>();
+        return encodeKey(INT64, (uint8_t*)&val);
+    }
+    case TIMESTAMP: {
+        auto val = value.getValue<timestamp_t>().value;
+        return encodeKey(INT64, (uint8_t*)&val);
+    }
+    case INT32: {
+        auto val = value.getValue<int32_t>();
+        return encodeKey(INT32, (uint8_t*)&val);
+    }
+    case DATE: {
+        auto val = value.getValue<date_t>().days;
+        return encodeKey(INT32, (uint8_t*)&val);
+    }
+    case INT16: {
+        auto val = value.getValue<int16_t>();
+        return encodeKey(INT16, (uint8_t*)&val);
+    }
+    case DOUBLE: {
+        auto val = value.getValue<double>();
+        return encodeKey(DOUBLE, (uint8_t*)&val);
+    }
+    case STRING: {
+        auto val = value.getValue<std::string>();
+        return encodeStringKey(val.data(), val.length());
+    }
+    default:
+        throw StorageException("Cannot index a value of type " +
+                               Types::dataTypeToString(value.getDataType()) + ".");
+    }
+}
+
+uint64_t PropertyIndex::encodeKey(const ValueVector& vector, uint32_t pos) {
+    return encodeKey(vector.dataType.typeID, vector.getData() + pos * vector.getNumBytesPerValue());
+}
+
+void PropertyIndex::appendEntries(Transaction* transaction, Column* column,
+    const DataType& dataType, table_id_t tableID, offset_t maxNodeOffset,
+    MemoryManager* memoryManager, std::vector<PropertyIndexEntry>& entries) {
+    if (maxNodeOffset == INVALID_NODE_OFFSET) {
+        return;
+    }
+    auto state = std::make_shared<DataChunkState>();
+    auto nodeIDVector = std::make_unique<ValueVector>(INTERNAL_ID);
+    nodeIDVector->state = state;
+    nodeIDVector->setSequential();
+    auto valueVector = std::make_unique<ValueVector>(dataType, memoryManager);
+    valueVector->state = state;
+    for (auto startOffset = 0ul; startOffset <= maxNodeOffset;
+         startOffset += DEFAULT_VECTOR_CAPACITY) {
+        auto numNodes = std::min(DEFAULT_VECTOR_CAPACITY, maxNodeOffset + 1 - startOffset);
+        for (auto i = 0u; i < numNodes; ++i) {
+            nodeIDVector->setValue<nodeID_t>(i, nodeID_t{startOffset + i, tableID});
+        }
+        state->initOriginalAndSelectedSize(numNodes);
+        valueVector->resetOverflowBuffer();
+        column->read(transaction, nodeIDVector.get(), valueVector.get());
+        for (auto i = 0u; i < numNodes; ++i) {
+            if (!valueVector->isNull(i)) {
+                entries.push_back(PropertyIndexEntry{encodeKey(*valueVector, i), startOffset + i});
+            }
+        }
+    }
+}
+
+std::vector<offset_t> PropertyIndex::lookup(
+    Transaction* transaction, ExpressionType comparisonType, const Value& value) {
+    assert(isSupportedComparison(comparisonType) && !value.isNull());
+    // Keys are exact except for strings, whose strict comparisons have to include the keys equal
+    // to the one of the value.
+    auto isExactKey = dataType.typeID != STRING;
+    auto key = encodeKey(value);
+    auto lowKey = (uint64_t)0;
+    auto highKey = UINT64_MAX;
+    std::vector<offset_t> result;
+    switch (comparisonType) {
+    case EQUALS: {
+        lowKey = key;
+        highKey = key;
+    } break;
+    case GREATER_THAN: {
+        if (isExactKey && key == UINT64_MAX) {
+            lowKey = UINT64_MAX;
+            highKey = 0;
+        } else {
+            lowKey = isExactKey ? key + 1 : key;
+        }
+    } break;
+    case GREATER_THAN_EQUALS: {
+        lowKey = key;
+    } break;
+    case LESS_THAN: {
+        if (isExactKey && key == 0) {
+            lowKey = UINT64_MAX;
+            highKey = 0;
+        } else {
+            highKey = isExactKey ? key - 1 : key;
+        }
+    } break;
+    case LESS_THAN_EQUALS: {
+        highKey = key;
+    } break;
+    default:
+        assert(false);
+    }
+    if (lowKey <= highKey) {
+        auto header =
+            headerArray->get(PROPERTY_INDEX_HEADER_IDX_IN_ARRAY, TransactionType::READ_ONLY);
+        lookupInEntries(
+            *mainEntries, header.numMainEntries, true /* isSorted */, lowKey, highKey, result);
+        lookupInEntries(
+            *deltaEntries, header.numDeltaEntries, false /* isSorted */, lowKey, highKey, result);
+    }
+    if (transaction->isWriteTransaction()) {
+        std::unique_lock lck{localStorageMtx};
+        result.insert(result.end(), updatedNodes.begin(), updatedNodes.end());
+    }
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+}
+
+void PropertyIndex::recordUpdate(offset_t nodeOffset) {
+    std::unique_lock lck{localStorageMtx};
+    updatedNodes.insert(nodeOffset);
+}
+
+void PropertyIndex::prepareCommitOrRollbackIfNecessary(bool isCommit, offset_t maxNodeOffset) {
+    std::unique_lock lck{localStorageMtx};
+    if (updatedNodes.empty()) {
+        return;
+    }
+    wal->addToUpdatedNodeTables(tableID);
+    if (isCommit) {
+        prepareCommit(maxNodeOffset);
+    }
+}
+
+void PropertyIndex::checkpointInMemoryIfNecessary() {
+    std::unique_lock lck{localStorageMtx};
+    if (updatedNodes.empty()) {
+        return;
+    }
+    headerArray->checkpointInMemoryIfNecessary();
+    mainEntries->checkpointInMemoryIfNecessary();
+    deltaEntries->checkpointInMemoryIfNecessary();
+    updatedNodes.clear();
+}
+
+void PropertyIndex::rollbackInMemoryIfNecessary() {
+    std::unique_lock lck{localStorageMtx};
+    if (updatedNodes.empty()) {
+        return;
+    }
+    headerArray->rollbackInMemoryIfNecessary();
+    mainEntries->rollbackInMemoryIfNecessary();
+    deltaEntries->rollbackInMemoryIfNecessary();
+    updatedNodes.clear();
+}
+
+// Values written by the transaction are read through a write transaction from the WAL versions of
+// the column pages.
+void PropertyIndex::prepareCommit(offset_t maxNodeOffset) {
+    auto writeTrx = Transaction::getDummyWriteTrx();
+    auto header = headerArray->get(PROPERTY_INDEX_HEADER_IDX_IN_ARRAY, TransactionType::WRITE);
+    std::vector<PropertyIndexEntry> entries;
+    if (header.numDeltaEntries + updatedNodes.size() >
+        getMaxNumDeltaEntries(header.numMainEntries)) {
+        auto memoryManager = std::make_unique<MemoryManager>(&bufferManager);
+        appendEntries(
+            writeTrx.get(), column, dataType, tableID, maxNodeOffset, memoryManager.get(), entries);
+        std::sort(entries.begin(), entries.end());
+        writeEntries(*mainEntries, 0 /* startIdx */, entries);
+        header.numMainEntries = entries.size();
+        header.numDeltaEntries = 0;
+    } else {
+        appendEntriesOfUpdatedNodes(writeTrx.get(), entries);
+        writeEntries(*deltaEntries, header.numDeltaEntries, entries);
+        header.numDeltaEntries += entries.size();
+    }
+    headerArray->update(PROPERTY_INDEX_HEADER_IDX_IN_ARRAY, header);
+}
+
+void PropertyIndex::lookupInEntries(BaseDiskArray<PropertyIndexEntry>& entries,
+    uint64_t numEntries, bool isSorted, uint64_t lowKey, uint64_t highKey,
+    std::vector<offset_t>& result) {
+    auto startIdx = (uint64_t)0;
+    if (isSorted) {
+        // Binary search for the first entry whose key is not less than lowKey.
+        auto endIdx = numEntries;
+        while (startIdx < endIdx) {
+            auto midIdx = startIdx + (endIdx - startIdx) / 2;
+            if (entries.get(midIdx, TransactionType::READ_ONLY).key < lowKey) {
+                startIdx = midIdx + 1;
+            } else {
+                endIdx = midIdx;
+            }
+        }
+    }
+    for (auto idx = startIdx; idx < numEntries; ++idx) {
+        auto entry = entries.get(idx, TransactionType::READ_ONLY);
+        if (entry.key > highKey) {
+            if (isSorted) {
+                break;
+            }
+            continue;
+        }
+        if (entry.key >= lowKey) {
+            result.push_back(entry.nodeOffset);
+        }
+    }
+}
+
+void PropertyIndex::appendEntriesOfUpdatedNodes(
+    Transaction* transaction, std::vector<PropertyIndexEntry>& entries) {
+    auto memoryManager = std::make_unique<MemoryManager>(&bufferManager);
+    auto state = std::make_shared<DataChunkState>();
+    auto nodeIDVector = std::make_unique<ValueVector>(INTERNAL_ID);
+    nodeIDVector->state = state;
+    auto valueVector = std::make_unique<ValueVector>(dataType, memoryManager.get());
+    valueVector->state = state;
+    auto it = updatedNodes.begin();
+    while (it != updatedNodes.end()) {
+        auto numNodes = 0u;
+        for (; it != updatedNodes.end() && numNodes < DEFAULT_VECTOR_CAPACITY; ++it) {
+            nodeIDVector->setValue<nodeID_t>(numNodes++, nodeID_t{*it, tableID});
+        }
+        state->initOriginalAndSelectedSize(numNodes);
+        valueVector->resetOverflowBuffer();
+        column->read(transaction, nodeIDVector.get(), valueVector.get());
+        for (auto i = 0u; i < numNodes; ++i) {
+            if (!valueVector->isNull(i)) {
+                entries.push_back(PropertyIndexEntry{
+                    encodeKey(*valueVector, i), nodeIDVector->readNodeOffset(i)});
+            }
+        }
+    }
+}
+
+// Entries beyond the ones in use are overwritten before the disk array is extended.
+void PropertyIndex::writeEntries(BaseDiskArray<PropertyIndexEntry>& diskArray, uint64_t startIdx,
+    const std::vector<PropertyIndexEntry>& entries) {
+    auto numElements = diskArray.getNumElements(TransactionType::WRITE);
+    for (auto i = 0u; i < entries.size(); ++i) {
+        auto idx = startIdx + i;
+        if (idx < numElements) {
+            diskArray.update(idx, entries[i]);
+        } else {
+            diskArray.pushBack(entries[i]);
+        }
+    }
+}
+
+} // namespace storage
+} // namespace kuzu
@@ -31,6 +31,84 @@ void Column::read(Transaction* transaction, common::ValueVector* nodeIDVector,
     }
 }
 
+bool Column::select(
+    Transaction* transaction, ValueVector* nodeIDVector, const ColumnPredicate& predicate) {
+    auto& selVector = nodeIDVector->state->selVector;
+    auto isUnfiltered = selVector->isUnfiltered();
+    auto selectedPositionsBuffer = selVector->getSelectedPositionsBuffer();
+    uint64_t numSelectedValues = 0;
+    if (nodeIDVector->state->isFlat() || !nodeIDVector->isSequential()) {
+        for (auto i = 0u; i < selVector->selectedSize; i++) {
+            auto pos = selVector->selectedPositions[i];
+            if (nodeIDVector->isNull(pos)) {
+                continue;
+            }
+            auto cursor = PageUtils::getPageElementCursorForPos(
+                nodeIDVector->readNodeOffset(pos), numElementsPerPage);
+            auto [fileHandleToPin, pageIdxToPin] =
+                StorageStructureUtils::getFileHandleAndPhysicalPageIdxToPin(
+                    *fileHandle, cursor.pageIdx, *wal, transaction->getType());
+            auto frame = bufferManager.pin(*fileHandleToPin, pageIdxToPin);
+            if (isValueSelected(frame, cursor.elemPosInPage, predicate)) {
+                // Positions are compacted in place, which is safe as writes never overtake reads.
+                selectedPositionsBuffer[numSelectedValues++] = pos;
+            }
+            bufferManager.unpin(*fileHandleToPin, pageIdxToPin);
+        }
+        if (nodeIDVector->state->isFlat()) {
+            return numSelectedValues > 0;
+        }
+    } else {
+        // In sequential read, the vector position of a node is its offset minus the start offset.
+        auto cursor = PageUtils::getPageElementCursorForPos(
+            nodeIDVector->readNodeOffset(0), numElementsPerPage);
+        auto numValuesToRead = nodeIDVector->state->originalSize;
+        uint64_t selectedStatePos = 0;
+        uint64_t vectorPos = 0;
+        while (vectorPos < numValuesToRead && selectedStatePos < selVector->selectedSize) {
+            uint64_t numValuesInPage = numElementsPerPage - cursor.elemPosInPage;
+            uint64_t numValuesToReadInPage =
+                std::min(numValuesInPage, numValuesToRead - vectorPos);
+            auto vectorEndPos = vectorPos + numValuesToReadInPage;
+            // Positions before vectorPos have been skipped, so this checks if the page is needed.
+            if (selVector->selectedPositions[selectedStatePos] < vectorEndPos) {
+                auto [fileHandleToPin, pageIdxToPin] =
+                    StorageStructureUtils::getFileHandleAndPhysicalPageIdxToPin(
+                        *fileHandle, cursor.pageIdx, *wal, transaction->getType());
+                auto frame = bufferManager.pin(*fileHandleToPin, pageIdxToPin);
+                if (isUnfiltered) {
+                    numSelectedValues += predicate.selectValues(
+                        frame + mapElementPosToByteOffset(cursor.elemPosInPage),
+                        (uint64_t*)getNullBufferInPage(frame), cursor.elemPosInPage,
+                        numValuesToReadInPage, vectorPos,
+                        selectedPositionsBuffer + numSelectedValues);
+                } else {
+                    while (selectedStatePos < selVector->selectedSize &&
+                           selVector->selectedPositions[selectedStatePos] < vectorEndPos) {
+                        auto pos = selVector->selectedPositions[selectedStatePos++];
+                        if (isValueSelected(
+                                frame, cursor.elemPosInPage + pos - vectorPos, predicate)) {
+                            selectedPositionsBuffer[numSelectedValues++] = pos;
+                        }
+                    }
+                }
+                bufferManager.unpin(*fileHandleToPin, pageIdxToPin);
+            }
+            vectorPos = vectorEndPos;
+            while (selectedStatePos < selVector->selectedSize &&
+                   selVector->selectedPositions[selectedStatePos] < vectorPos) {
+                selectedStatePos++;
+            }
+            cursor.nextPage();
+        }
+    }
+    selVector->selectedSize = numSelectedValues;
+    if (isUnfiltered) {
+        selVector->resetSelectorToValuePosBuffer();
+    }
+    return numSelectedValues > 0;
+}
+
 void Column::writeValues(
     common::ValueVector* nodeIDVector, common::ValueVector* vectorToWriteFrom) {
     if (nodeIDVector->state->isFlat() && vectorToWriteFrom->state->isFlat()) {
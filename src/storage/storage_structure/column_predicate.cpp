@@ -0,0 +1,173 @@
+#include "storage/storage_structure/column_predicate.h"
+
+#include "common/null_mask.h"
+#include "function/comparison/comparison_operations.h"
+
+using namespace kuzu::common;
+using namespace kuzu::function::operation;
+
+namespace kuzu {
+namespace storage {
+
+ColumnPredicate::ColumnPredicate(ExpressionType comparisonType, const Value& value)
+    : comparisonType{comparisonType}, typeID{value.getDataType().typeID} {
+    assert(isExpressionComparison(comparisonType) && isSupportedType(typeID) && !value.isNull());
+    switch (typeID) {
+    case INT64: {
+        constant.int64Val = value.getValue<int64_t>();
+    } break;
+    case INT32: {
+        constant.int32Val = value.getValue<int32_t>();
+    } break;
+    case INT16: {
+        constant.int16Val = value.getValue<int16_t>();
+    } break;
+    case DOUBLE: {
+        constant.doubleVal = value.getValue<double>();
+    } break;
+    case DATE: {
+        constant.int32Val = value.getValue<date_t>().days;
+    } break;
+    case TIMESTAMP: {
+        constant.int64Val = value.getValue<timestamp_t>().value;
+    } break;
+    default:
+        assert(false);
+    }
+}
+
+uint64_t ColumnPredicate::selectValues(const uint8_t* values, const uint64_t* nullEntries,
+    uint64_t posInPage, uint64_t numValues, sel_t vectorStartPos, sel_t* selectedPositions) const {
+    switch (typeID) {
+    case INT64:
+    case TIMESTAMP:
+        return selectTypedValues((const int64_t*)values, constant.int64Val, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    case INT32:
+    case DATE:
+        return selectTypedValues((const int32_t*)values, constant.int32Val, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    case INT16:
+        return selectTypedValues((const int16_t*)values, constant.int16Val, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    case DOUBLE:
+        return selectTypedValues((const double*)values, constant.doubleVal, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+bool ColumnPredicate::evaluate(const uint8_t* value) const {
+    switch (typeID) {
+    case INT64:
+    case TIMESTAMP:
+        return evaluateTypedValue(*(const int64_t*)value, constant.int64Val);
+    case INT32:
+    case DATE:
+        return evaluateTypedValue(*(const int32_t*)value, constant.int32Val);
+    case INT16:
+        return evaluateTypedValue(*(const int16_t*)value, constant.int16Val);
+    case DOUBLE:
+        return evaluateTypedValue(*(const double*)value, constant.doubleVal);
+    default:
+        assert(false);
+        return false;
+    }
+}
+
+bool ColumnPredicate::isSupportedType(DataTypeID typeID) {
+    switch (typeID) {
+    case INT64:
+    case INT32:
+    case INT16:
+    case DOUBLE:
+    case DATE:
+    case TIMESTAMP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+template<typename T>
+uint64_t ColumnPredicate::selectTypedValues(const T* values, T constantValue,
+    const uint64_t* nullEntries, uint64_t posInPage, uint64_t numValues, sel_t vectorStartPos,
+    sel_t* selectedPositions) const {
+    switch (comparisonType) {
+    case EQUALS:
+        return selectTypedValuesWithOp<T, Equals>(values, constantValue, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    case NOT_EQUALS:
+        return selectTypedValuesWithOp<T, NotEquals>(values, constantValue, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    case GREATER_THAN:
+        return selectTypedValuesWithOp<T, GreaterThan>(values, constantValue, nullEntries,
+            posInPage, numValues, vectorStartPos, selectedPositions);
+    case GREATER_THAN_EQUALS:
+        return selectTypedValuesWithOp<T, GreaterThanEquals>(values, constantValue, nullEntries,
+            posInPage, numValues, vectorStartPos, selectedPositions);
+    case LESS_THAN:
+        return selectTypedValuesWithOp<T, LessThan>(values, constantValue, nullEntries, posInPage,
+            numValues, vectorStartPos, selectedPositions);
+    case LESS_THAN_EQUALS:
+        return selectTypedValuesWithOp<T, LessThanEquals>(values, constantValue, nullEntries,
+            posInPage, numValues, vectorStartPos, selectedPositions);
+    default:
+        assert(false);
+        return 0;
+    }
+}
+
+// Branch-free: every position is written and the output cursor only advances if it qualifies.
+// Comparing fixed-size values cannot fail, so null positions are compared blindly and masked out.
+template<typename T, typename FUNC>
+uint64_t ColumnPredicate::selectTypedValuesWithOp(const T* values, T constantValue,
+    const uint64_t* nullEntries, uint64_t posInPage, uint64_t numValues, sel_t vectorStartPos,
+    sel_t* selectedPositions) {
+    uint64_t numSelectedValues = 0;
+    for (auto i = 0u; i < numValues; ++i) {
+        uint8_t result;
+        FUNC::operation(values[i], constantValue, result);
+        auto elementPos = posInPage + i;
+        auto isNull = (nullEntries[elementPos >> NullMask::NUM_BITS_PER_NULL_ENTRY_LOG2] >>
+                          (elementPos & (NullMask::NUM_BITS_PER_NULL_ENTRY - 1))) &
+                      1;
+        selectedPositions[numSelectedValues] = vectorStartPos + i;
+        numSelectedValues += result & !isNull;
+    }
+    return numSelectedValues;
+}
+
+template<typename T>
+bool ColumnPredicate::evaluateTypedValue(T value, T constantValue) const {
+    uint8_t result;
+    switch (comparisonType) {
+    case EQUALS: {
+        Equals::operation(value, constantValue, result);
+    } break;
+    case NOT_EQUALS: {
+        NotEquals::operation(value, constantValue, result);
+    } break;
+    case GREATER_THAN: {
+        GreaterThan::operation(value, constantValue, result);
+    } break;
+    case GREATER_THAN_EQUALS: {
+        GreaterThanEquals::operation(value, constantValue, result);
+    } break;
+    case LESS_THAN: {
+        LessThan::operation(value, constantValue, result);
+    } break;
+    case LESS_THAN_EQUALS: {
+        LessThanEquals::operation(value, constantValue, result);
+    } break;
+    default:
+        assert(false);
+        return false;
+    }
+    return result;
+}
+
+} // namespace storage
+} // namespace kuzu
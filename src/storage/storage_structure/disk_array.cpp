@@ -3,6 +3,7 @@
 #include "common/utils.h"
 #include "storage/index/hash_index_header.h"
 #include "storage/index/hash_index_slot.h"
+#include "storage/index/property_index.h"
 
 using namespace kuzu::common;
 using namespace kuzu::transaction;
@@ -501,18 +502,26 @@ template class BaseDiskArray<uint32_t>;
 template class BaseDiskArray<Slot<int64_t>>;
 template class BaseDiskArray<Slot<ku_string_t>>;
 template class BaseDiskArray<HashIndexHeader>;
+template class BaseDiskArray<PropertyIndexHeader>;
+template class BaseDiskArray<PropertyIndexEntry>;
 template class BaseInMemDiskArray<uint32_t>;
 template class BaseInMemDiskArray<Slot<int64_t>>;
 template class BaseInMemDiskArray<Slot<ku_string_t>>;
 template class BaseInMemDiskArray<HashIndexHeader>;
+template class BaseInMemDiskArray<PropertyIndexHeader>;
+template class BaseInMemDiskArray<PropertyIndexEntry>;
 template class InMemDiskArrayBuilder<uint32_t>;
 template class InMemDiskArrayBuilder<Slot<int64_t>>;
 template class InMemDiskArrayBuilder<Slot<ku_string_t>>;
 template class InMemDiskArrayBuilder<HashIndexHeader>;
+template class InMemDiskArrayBuilder<PropertyIndexHeader>;
+template class InMemDiskArrayBuilder<PropertyIndexEntry>;
 template class InMemDiskArray<uint32_t>;
 template class InMemDiskArray<Slot<int64_t>>;
 template class InMemDiskArray<Slot<ku_string_t>>;
 template class InMemDiskArray<HashIndexHeader>;
+template class InMemDiskArray<PropertyIndexHeader>;
+template class InMemDiskArray<PropertyIndexEntry>;
 
 } // namespace storage
 } // namespace kuzu
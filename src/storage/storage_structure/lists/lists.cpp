@@ -246,6 +246,16 @@ void AdjLists::readValues(
     }
 }
 
+void AdjLists::countValues(ValueVector* valueVector, ListHandle& listHandle) {
+    valueVector->state->selVector->resetSelectorToUnselected();
+    uint32_t startElemOffset =
+        listHandle.hasValidRangeToRead() ? listHandle.getEndElemOffset() : 0;
+    auto numValuesToRead = std::min(listHandle.getNumValuesInList() - startElemOffset,
+        (uint32_t)DEFAULT_VECTOR_CAPACITY);
+    listHandle.setRangeToRead(startElemOffset, numValuesToRead);
+    valueVector->state->initOriginalAndSelectedSize(numValuesToRead);
+}
+
 std::unique_ptr<std::vector<nodeID_t>> AdjLists::readAdjacencyListOfNode(
     // We read the adjacency list of a node in 2 steps: i) we read all the bytes from the pages
     // that hold the list into a buffer; and (ii) we interpret the bytes in the buffer based on the
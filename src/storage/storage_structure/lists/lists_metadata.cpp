@@ -31,15 +31,22 @@ ListsMetadata::ListsMetadata(
         bufferManager, wal);
 }
 
-uint64_t BaseListsMetadata::getPageIdxFromAPageList(
-    BaseInMemDiskArray<page_idx_t>* pageLists, uint32_t pageListHead, uint32_t idxInPageList) {
-    auto pageListGroupHeadIdx = pageListHead;
-    while (ListsMetadataConstants::PAGE_LIST_GROUP_SIZE <= idxInPageList) {
-        pageListGroupHeadIdx =
-            (*pageLists)[pageListGroupHeadIdx + ListsMetadataConstants::PAGE_LIST_GROUP_SIZE];
-        idxInPageList -= ListsMetadataConstants::PAGE_LIST_GROUP_SIZE;
-    }
-    return (*pageLists)[pageListGroupHeadIdx + idxInPageList];
+std::function<uint32_t(uint32_t)> BaseListsMetadata::getIdxInPageListToListPageIdxMapper(
+    BaseInMemDiskArray<page_idx_t>* pageLists, uint32_t pageListHead) {
+    return [pageLists, pageListHead, pageListGroupIdx = (uint32_t)0,
+               pageListGroupHeadIdx = pageListHead](uint32_t idxInPageList) mutable {
+        auto targetPageListGroupIdx = idxInPageList / ListsMetadataConstants::PAGE_LIST_GROUP_SIZE;
+        if (targetPageListGroupIdx < pageListGroupIdx) {
+            pageListGroupIdx = 0;
+            pageListGroupHeadIdx = pageListHead;
+        }
+        for (; pageListGroupIdx < targetPageListGroupIdx; pageListGroupIdx++) {
+            pageListGroupHeadIdx =
+                (*pageLists)[pageListGroupHeadIdx + ListsMetadataConstants::PAGE_LIST_GROUP_SIZE];
+        }
+        return (*pageLists)[pageListGroupHeadIdx +
+                            idxInPageList % ListsMetadataConstants::PAGE_LIST_GROUP_SIZE];
+    };
 }
 
 ListsMetadataBuilder::ListsMetadataBuilder(const std::string& listBaseFName) : BaseListsMetadata() {
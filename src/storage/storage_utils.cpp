@@ -27,6 +27,10 @@ std::unique_ptr<FileInfo> StorageUtils::getFileInfoForReadWrite(
             fName = getOverflowFileName(fName);
         }
     } break;
+    case StorageStructureType::PROPERTY_INDEX: {
+        fName = getPropertyIndexFName(directory, storageStructureID.propertyIndexID.tableID,
+            storageStructureID.propertyIndexID.propertyID, DBFileType::ORIGINAL);
+    } break;
     default: {
         throw RuntimeException("Unsupported StorageStructureID in "
                                "StorageUtils::getFileInfoFromStorageStructureID.");
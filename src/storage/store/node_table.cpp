@@ -2,6 +2,7 @@
 
 using namespace kuzu::catalog;
 using namespace kuzu::common;
+using namespace kuzu::transaction;
 
 namespace kuzu {
 namespace storage {
@@ -22,6 +23,15 @@ void NodeTable::initializeData(NodeTableSchema* nodeTableSchema) {
     pkIndex = std::make_unique<PrimaryKeyIndex>(
         StorageUtils::getNodeIndexIDAndFName(wal->getDirectory(), tableID),
         nodeTableSchema->getPrimaryKey().dataType, bufferManager, wal);
+    for (auto propertyID : nodeTableSchema->indexedPropertyIDSet) {
+        addPropertyIndex(nodeTableSchema->getProperty(propertyID));
+    }
+}
+
+void NodeTable::addPropertyIndex(const Property& property) {
+    propertyIndexes[property.propertyID] = std::make_unique<PropertyIndex>(
+        StorageUtils::getPropertyIndexIDAndFName(wal->getDirectory(), property), property.dataType,
+        propertyColumns.at(property.propertyID).get(), tableID, bufferManager, wal);
 }
 
 void NodeTable::scan(transaction::Transaction* transaction, ValueVector* inputIDVector,
@@ -38,6 +48,9 @@ void NodeTable::scan(transaction::Transaction* transaction, ValueVector* inputID
 
 offset_t NodeTable::addNodeAndResetProperties(ValueVector* primaryKeyVector) {
     auto nodeOffset = nodesStatisticsAndDeletedIDs->addNode(tableID);
+    for (auto& [_, index] : propertyIndexes) {
+        index->recordUpdate(nodeOffset);
+    }
     assert(primaryKeyVector->state->selVector->selectedSize == 1);
     auto pkValPos = primaryKeyVector->state->selVector->selectedPositions[0];
     if (primaryKeyVector->isNull(pkValPos)) {
@@ -71,6 +84,24 @@ void NodeTable::deleteNodes(ValueVector* nodeIDVector, ValueVector* primaryKeyVe
 
 void NodeTable::prepareCommitOrRollbackIfNecessary(bool isCommit) {
     pkIndex->prepareCommitOrRollbackIfNecessary(isCommit);
+    for (auto& [_, index] : propertyIndexes) {
+        index->prepareCommitOrRollbackIfNecessary(
+            isCommit, getMaxNodeOffset(Transaction::getDummyWriteTrx().get()));
+    }
+}
+
+void NodeTable::checkpointInMemoryIfNecessary() {
+    pkIndex->checkpointInMemoryIfNecessary();
+    for (auto& [_, index] : propertyIndexes) {
+        index->checkpointInMemoryIfNecessary();
+    }
+}
+
+void NodeTable::rollbackInMemoryIfNecessary() {
+    pkIndex->rollbackInMemoryIfNecessary();
+    for (auto& [_, index] : propertyIndexes) {
+        index->rollbackInMemoryIfNecessary();
+    }
 }
 
 void NodeTable::deleteNode(offset_t nodeOffset, ValueVector* primaryKeyVector, uint32_t pos) const {
@@ -109,6 +109,11 @@ void DirectedRelTableData::scanLists(transaction::Transaction* transaction,
         adjLists->initListReadingState(
             currentNodeOffset, *scanState.listHandles[0], transaction->getType());
     }
+    if (scanState.countOnly) {
+        assert(scanState.propertyIds.empty());
+        adjLists->countValues(outputVectors[0], *scanState.listHandles[0]);
+        return;
+    }
     adjLists->readValues(transaction, outputVectors[0], *scanState.listHandles[0]);
     for (auto i = 0u; i < scanState.propertyIds.size(); i++) {
         auto propertyId = scanState.propertyIds[i];
@@ -16,6 +16,9 @@ std::string storageStructureTypeToString(StorageStructureType storageStructureTy
     case StorageStructureType::NODE_INDEX: {
         return "NODE_INDEX";
     } break;
+    case StorageStructureType::PROPERTY_INDEX: {
+        return "PROPERTY_INDEX";
+    } break;
     default: {
         assert(false);
     }
@@ -40,6 +43,15 @@ StorageStructureID StorageStructureID::newNodeIndexID(table_id_t tableID) {
     return retVal;
 }
 
+StorageStructureID StorageStructureID::newPropertyIndexID(
+    table_id_t tableID, property_id_t propertyID) {
+    StorageStructureID retVal;
+    retVal.isOverflow = false;
+    retVal.storageStructureType = StorageStructureType::PROPERTY_INDEX;
+    retVal.propertyIndexID = PropertyIndexID(tableID, propertyID);
+    return retVal;
+}
+
 StorageStructureID StorageStructureID::newAdjListsID(
     table_id_t relTableID, RelDirection dir, ListFileType listFileType) {
     StorageStructureID retVal;
@@ -112,6 +124,12 @@ std::string walRecordTypeToString(WALRecordType walRecordType) {
     case WALRecordType::DROP_PROPERTY_RECORD: {
         return "DROP_PROPERTY_RECORD";
     }
+    case WALRecordType::ADD_PROPERTY_RECORD: {
+        return "ADD_PROPERTY_RECORD";
+    }
+    case WALRecordType::CREATE_INDEX_RECORD: {
+        return "CREATE_INDEX_RECORD";
+    }
     default: {
         assert(false);
     }
@@ -217,6 +235,13 @@ WALRecord WALRecord::newAddPropertyRecord(table_id_t tableID, property_id_t prop
     return retVal;
 }
 
+WALRecord WALRecord::newCreateIndexRecord(table_id_t tableID, property_id_t propertyID) {
+    WALRecord retVal;
+    retVal.recordType = WALRecordType::CREATE_INDEX_RECORD;
+    retVal.createIndexRecord = CreateIndexRecord(tableID, propertyID);
+    return retVal;
+}
+
 void WALRecord::constructWALRecordFromBytes(WALRecord& retVal, uint8_t* bytes, uint64_t& offset) {
     ((WALRecord*)&retVal)[0] = ((WALRecord*)(bytes + offset))[0];
     offset += sizeof(WALRecord);
@@ -412,6 +412,22 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) {
             // See comments for COPY_NODE_RECORD.
         }
     } break;
+    case WALRecordType::CREATE_INDEX_RECORD: {
+        if (isCheckpoint) {
+            auto tableID = walRecord.createIndexRecord.tableID;
+            auto propertyID = walRecord.createIndexRecord.propertyID;
+            WALReplayerUtils::renameDBFilesForPropertyIndex(
+                wal->getDirectory(), tableID, propertyID);
+            if (!isRecovering) {
+                // See comments for ADD_PROPERTY_RECORD.
+                auto property =
+                    catalog->getWriteVersion()->getTableSchema(tableID)->getProperty(propertyID);
+                storageManager->getNodesStore().getNodeTable(tableID)->addPropertyIndex(property);
+            }
+        } else {
+            // See comments for COPY_NODE_RECORD.
+        }
+    } break;
     default:
         throw RuntimeException(
             "Unrecognized WAL record type inside WALReplayer::replay. recordType: " +
@@ -535,6 +551,12 @@ BufferManagedFileHandle* WALReplayer::getVersionedFileHandleIfWALVersionAndBMSho
         return storageStructureID.isOverflow ? index->getDiskOverflowFile()->getFileHandle() :
                                                index->getFileHandle();
     }
+    case StorageStructureType::PROPERTY_INDEX: {
+        auto index = storageManager->getNodesStore()
+                         .getNodeTable(storageStructureID.propertyIndexID.tableID)
+                         ->getPropertyIndex(storageStructureID.propertyIndexID.propertyID);
+        return index->getFileHandle();
+    }
     default:
         assert(false);
     }
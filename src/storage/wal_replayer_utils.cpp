@@ -191,6 +191,10 @@ void WALReplayerUtils::fileOperationOnNodeFiles(NodeTableSchema* nodeTableSchema
         columnFileOperation(StorageUtils::getNodePropertyColumnFName(
             directory, nodeTableSchema->tableID, property.propertyID, DBFileType::ORIGINAL));
     }
+    for (auto propertyID : nodeTableSchema->indexedPropertyIDSet) {
+        columnFileOperation(StorageUtils::getPropertyIndexFName(
+            directory, nodeTableSchema->tableID, propertyID, DBFileType::ORIGINAL));
+    }
     columnFileOperation(
         StorageUtils::getNodeIndexFName(directory, nodeTableSchema->tableID, DBFileType::ORIGINAL));
 }
@@ -0,0 +1,86 @@
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/task_system/task_scheduler.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::common;
+
+// Processes a fixed number of morsels, each advancing the clock of the scheduler by one unit, and
+// leaves the task between morsels when the scheduler asks it to, as pipelines do. No morsel is
+// processed before isStarted is set, so that tests can schedule all tasks first.
+class MorselTask : public Task {
+public:
+    MorselTask(std::string name, uint64_t numMorsels, std::atomic<bool>& isStarted,
+        std::atomic<uint64_t>& time, std::mutex& logMtx, std::vector<std::string>& log)
+        : Task{1 /* maxNumThreads */}, name{std::move(name)}, numMorsels{numMorsels},
+          nextMorselIdx{0}, isStarted{isStarted}, time{time}, logMtx{logMtx}, log{log} {}
+
+    void run() override {
+        while (!isStarted.load()) {
+            std::this_thread::yield();
+        }
+        while (!TaskScheduler::shouldYield()) {
+            auto morselIdx = nextMorselIdx++;
+            if (morselIdx >= numMorsels) {
+                return;
+            }
+            lock_t lck{logMtx};
+            log.push_back(name + std::to_string(morselIdx));
+            lck.unlock();
+            time++;
+        }
+    }
+
+private:
+    std::string name;
+    uint64_t numMorsels;
+    std::atomic<uint64_t> nextMorselIdx;
+    std::atomic<bool>& isStarted;
+    std::atomic<uint64_t>& time;
+    std::mutex& logMtx;
+    std::vector<std::string>& log;
+};
+
+class TaskSchedulerTest : public testing::Test {
+public:
+    void SetUp() override { LoggerUtils::createLogger(LoggerConstants::LoggerEnum::PROCESSOR); }
+
+    void TearDown() override { LoggerUtils::dropLogger(LoggerConstants::LoggerEnum::PROCESSOR); }
+
+    std::vector<std::string> runLongAndShortTask(uint64_t timeSlice) {
+        std::atomic<bool> isStarted{false};
+        std::atomic<uint64_t> time{0};
+        std::mutex logMtx;
+        std::vector<std::string> log;
+        TaskScheduler scheduler{
+            1 /* numThreads */, timeSlice, [&time]() -> uint64_t { return time.load(); }};
+        // Whether or not the worker picks up the long task before the short one is scheduled, it
+        // starts with the long task, which is scheduled first. Both tasks are in the queue before
+        // the first morsel and thus before the first time the worker asks whether to yield.
+        scheduler.scheduleTask(
+            std::make_shared<MorselTask>("long", 4, isStarted, time, logMtx, log));
+        scheduler.scheduleTask(
+            std::make_shared<MorselTask>("short", 1, isStarted, time, logMtx, log));
+        isStarted.store(true);
+        scheduler.waitAllTasksToCompleteOrError();
+        return log;
+    }
+};
+
+TEST_F(TaskSchedulerTest, SwitchToWaitingTaskAtMorselBoundary) {
+    // After its first morsel, the worker has used up its time slice on the long task and switches
+    // to the short task, which has received no worker time yet.
+    auto log = runLongAndShortTask(1 /* timeSlice */);
+    std::vector<std::string> expectedLog{"long0", "short0", "long1", "long2", "long3"};
+    ASSERT_EQ(log, expectedLog);
+}
+
+TEST_F(TaskSchedulerTest, NoSwitchWithinTimeSlice) {
+    auto log = runLongAndShortTask(100 /* timeSlice */);
+    std::vector<std::string> expectedLog{"long0", "long1", "long2", "long3", "short0"};
+    ASSERT_EQ(log, expectedLog);
+}
@@ -1,3 +1,4 @@
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -53,6 +54,30 @@ public:
     }
 };
 
+// Generates rels that span multiple blocks of the CSV reader, so that lists are populated from
+// several buffered blocks.
+class CopyMultiBlockRelTest : public EmptyDBTest {
+public:
+    void SetUp() override {
+        EmptyDBTest::SetUp();
+        createDBAndConn();
+        std::ofstream personFile(databasePath + "/vPerson.csv");
+        for (auto i = 0u; i < NUM_NODES; ++i) {
+            personFile << i << "\n";
+        }
+        std::ofstream knowsFile(databasePath + "/eKnows.csv");
+        for (auto i = 0u; i < NUM_RELS; ++i) {
+            knowsFile << i % NUM_NODES << "," << (i * 7 + 3) % NUM_NODES << "," << i << "\n";
+        }
+    }
+
+    static constexpr uint64_t NUM_NODES = 1000;
+    // About 15 bytes per line, i.e. two blocks of CopyConstants::CSV_READING_BLOCK_SIZE.
+    static constexpr uint64_t NUM_RELS = 1000000;
+
+    void copyAndValidateRels();
+};
+
 class CopyMultipleFilesTest : public DBTest {
 
 public:
@@ -343,3 +368,45 @@ TEST_F(CopyMultipleFilesTest, CopyFilesWithWildcardPattern) {
             ->isSuccess());
     validateKnowsTableAfterCopying();
 }
+
+void CopyMultiBlockRelTest::copyAndValidateRels() {
+    conn->query("create node table person (ID INT64, PRIMARY KEY (ID))");
+    conn->query("create rel table knows (FROM person TO person, weight INT64)");
+    ASSERT_TRUE(conn->query("COPY person FROM \"" + databasePath + "/vPerson.csv\"")->isSuccess());
+    auto result = conn->query("COPY knows FROM \"" + databasePath + "/eKnows.csv\"");
+    ASSERT_TRUE(result->isSuccess());
+    std::vector<std::string> phaseNames;
+    for (auto& [phaseName, _] : result->getQuerySummary()->getPhaseTimes()) {
+        phaseNames.push_back(phaseName);
+    }
+    ASSERT_EQ(phaseNames, (std::vector<std::string>{"ReadAndPopulateColumns", "InitListsMetadata",
+                              "PopulateLists", "SortOverflowValues", "SaveToFile"}));
+    ASSERT_TRUE(FileUtils::globFilePath(databasePath + "/*.spill").empty());
+    result = conn->query("MATCH (:person)-[e:knows]->(:person) RETURN COUNT(*)");
+    ASSERT_EQ(TestHelper::convertResultToString(*result),
+        std::vector<std::string>{std::to_string(NUM_RELS)});
+    // Rels of node 0 are the ones whose weight is a multiple of 1000, which are in every block.
+    result = conn->query(
+        "MATCH (a:person)-[e:knows]->(:person) WHERE a.ID = 0 RETURN COUNT(*), SUM(e.weight)");
+    ASSERT_EQ(
+        TestHelper::convertResultToString(*result), std::vector<std::string>{"1000|499500000"});
+    result = conn->query(
+        "MATCH (a:person)<-[e:knows]-(:person) WHERE a.ID = 3 RETURN COUNT(*), SUM(e.weight)");
+    ASSERT_EQ(
+        TestHelper::convertResultToString(*result), std::vector<std::string>{"1000|499500000"});
+    result = conn->query(
+        "MATCH (a:person)-[e:knows]->(b:person) WHERE e.weight = 999999 RETURN a.ID, b.ID");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"999|996"});
+}
+
+TEST_F(CopyMultiBlockRelTest, CopyRelsFromMultipleResidentBlocks) {
+    copyAndValidateRels();
+}
+
+TEST_F(CopyMultiBlockRelTest, CopyRelsFromMultipleSpilledBlocks) {
+    // The rels of each block take more than the memory budget of the copier under this buffer pool
+    // size, so every block is spilled.
+    systemConfig = std::make_unique<kuzu::main::SystemConfig>(1ull << 24 /* bufferPoolSize */);
+    createDBAndConn();
+    copyAndValidateRels();
+}
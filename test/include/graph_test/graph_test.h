@@ -104,6 +104,17 @@ protected:
         return connection.hasActiveTransaction();
     }
     static inline void commitNoLock(main::Connection& connection) { connection.commitNoLock(); }
+    // If joinOrder is given, only plans with this encoded join order are prepared.
+    static inline std::unique_ptr<main::PreparedStatement> prepareNoLock(
+        main::Connection& connection, const std::string& query,
+        const std::string& joinOrder = std::string{}) {
+        auto enumerateAllPlans = !joinOrder.empty();
+        return connection.prepareNoLock(query, enumerateAllPlans, joinOrder);
+    }
+    static inline std::unique_ptr<main::QueryResult> executeAndAutoCommitIfNecessaryNoLock(
+        main::Connection& connection, main::PreparedStatement* preparedStatement) {
+        return connection.executeAndAutoCommitIfNecessaryNoLock(preparedStatement);
+    }
     static inline void rollbackIfNecessaryNoLock(main::Connection& connection) {
         connection.rollbackIfNecessaryNoLock();
     }
@@ -3,6 +3,7 @@
 #include <cstring>
 
 #include "common/file_utils.h"
+#include "json.hpp"
 #include "main/kuzu.h"
 #include "parser/parser.h"
 #include "planner/logical_plan/logical_plan_util.h"
@@ -13,6 +14,12 @@ using namespace kuzu::main;
 namespace kuzu {
 namespace testing {
 
+struct OperatorMetricCheck {
+    std::string operatorName;
+    std::string metricName;
+    uint64_t expectedValue;
+};
+
 struct TestQueryConfig {
     std::string name;
     std::string query;
@@ -22,6 +29,9 @@ struct TestQueryConfig {
     std::vector<std::string> expectedTuples;
     bool enumerate = false;
     bool checkOutputOrder = false;
+    // If not empty, the query is profiled and, for each check, the metric summed over the
+    // operators with the given name must equal the expected value.
+    std::vector<OperatorMetricCheck> operatorMetricChecks;
 };
 
 class TestHelper {
@@ -46,9 +56,21 @@ public:
         return KUZU_ROOT_DIRECTORY + std::string("/") + path;
     }
 
+    static inline const nlohmann::json& getPlanInJson(QueryResult& queryResult) {
+        return queryResult.getQuerySummary()->printPlanToJson();
+    }
+
+    // Sums an integer metric, e.g. NumOutputTuples, over the operators with the given name in the
+    // plan of a profiled query. Returns false and logs an error if a plan node has no name or a
+    // matching operator does not report the metric.
+    static bool sumOperatorMetric(QueryResult& queryResult, const std::string& operatorName,
+        const std::string& metricName, uint64_t& sum);
+
 private:
     static void initializeConnection(TestQueryConfig* config, Connection& conn);
     static bool testQuery(TestQueryConfig* config, Connection& conn);
+    static bool sumOperatorMetric(const nlohmann::json& planInJson,
+        const std::string& operatorName, const std::string& metricName, uint64_t& sum);
 };
 
 } // namespace testing
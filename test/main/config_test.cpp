@@ -1,3 +1,5 @@
+#include <filesystem>
+
 #include "main_test_helper/main_test_helper.h"
 
 using namespace kuzu::common;
@@ -28,3 +30,40 @@ TEST_F(ApiTest, DatabasePathIncorrect) {
         ASSERT_TRUE(std::string(e.what()).find("Failed to create directory") != std::string::npos);
     }
 }
+
+TEST_F(ApiTest, ReadOnlyDatabase) {
+    systemConfig->readOnly = true;
+    createDBAndConn();
+    assertMatchPersonCountStar(conn.get());
+    auto result = conn->query("MATCH (a:person)-[:knows]->(b:person) WHERE a.fName = 'Alice' "
+                              "RETURN COUNT(*)");
+    ASSERT_TRUE(result->isSuccess());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 3);
+    result = conn->query("CREATE (:person {ID: 100})");
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(),
+        "Cannot begin a write transaction on a database opened in read-only mode.");
+    ASSERT_THROW(conn->beginWriteTransaction(), ConnectionException);
+}
+
+// Write permission is not enforced for root, so this only fails for other users if a file of the
+// database is opened for writing.
+TEST_F(ApiTest, ReadOnlyDatabaseWithoutWritePermission) {
+    conn.reset();
+    database.reset();
+    auto setWritePermission = [&](std::filesystem::perm_options permOptions) {
+        for (auto& entry : std::filesystem::directory_iterator(databasePath)) {
+            std::filesystem::permissions(entry.path(), std::filesystem::perms::owner_write |
+                                                           std::filesystem::perms::group_write |
+                                                           std::filesystem::perms::others_write,
+                permOptions);
+        }
+    };
+    setWritePermission(std::filesystem::perm_options::remove);
+    systemConfig->readOnly = true;
+    ASSERT_NO_THROW(createDBAndConn());
+    assertMatchPersonCountStar(conn.get());
+    conn.reset();
+    database.reset();
+    setWritePermission(std::filesystem::perm_options::add);
+}
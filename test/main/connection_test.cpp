@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <sstream>
 #include <thread>
 
 #include "main_test_helper/main_test_helper.h"
@@ -137,3 +139,151 @@ TEST_F(ApiTest, Profile) {
                     "b.fName='Farooq' } RETURN a.ID, min(a.age)");
     ASSERT_TRUE(result->isSuccess());
 }
+
+// The cross product of 8 persons flattens all scans but the last one, so the query pulls more than
+// 8^7 (about 2 million) tuples one at a time through its operators, which cannot finish within
+// 1 ms.
+TEST_F(ApiTest, ProfileResourceCounters) {
+    // Reopen the database so that the buffer pool is cold.
+    createDBAndConn();
+    auto preparedStatement = prepareNoLock(*conn,
+        "PROFILE MATCH (a:person)-[e1:knows]->(b:person) WHERE a.age > 35 RETURN b.fName",
+        "HJ(b._id){E(b)S(a)}{S(b)}");
+    ASSERT_TRUE(preparedStatement->isSuccess());
+    auto result = executeAndAutoCommitIfNecessaryNoLock(*conn, preparedStatement.get());
+    ASSERT_TRUE(result->isSuccess());
+    uint64_t value;
+    // Adj lists are read from disk.
+    ASSERT_TRUE(
+        TestHelper::sumOperatorMetric(*result, "SCAN_REL_TABLE_LISTS", "NumPagePins", value));
+    ASSERT_GT(value, 0);
+    ASSERT_TRUE(TestHelper::sumOperatorMetric(
+        *result, "SCAN_REL_TABLE_LISTS", "NumPageCacheMisses", value));
+    ASSERT_GT(value, 0);
+    ASSERT_TRUE(TestHelper::sumOperatorMetric(
+        *result, "SCAN_REL_TABLE_LISTS", "NumBytesReadFromDisk", value));
+    ASSERT_GT(value, 0);
+    // The hash table is built in memory blocks, which are not page pins.
+    ASSERT_TRUE(TestHelper::sumOperatorMetric(
+        *result, "HASH_JOIN_BUILD", "NumMemoryBlocksAllocated", value));
+    ASSERT_GT(value, 0);
+    ASSERT_TRUE(TestHelper::sumOperatorMetric(*result, "HASH_JOIN_BUILD", "NumPagePins", value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(TestHelper::sumOperatorMetric(
+        *result, "HASH_JOIN_PROBE", "NumHashChainEntriesVisited", value));
+    ASSERT_GT(value, 0);
+}
+
+// Sums the execution times of all operators and the thread times of all pipelines in a profiled
+// plan, checking that sinks report their pipeline times.
+static void sumProfiledTimes(const nlohmann::json& planInJson, double& sumOfExecutionTimes,
+    double& sumOfPipelineThreadTimes) {
+    ASSERT_TRUE(planInJson.contains("ExecutionTime"));
+    auto executionTime = std::stod(planInJson.at("ExecutionTime").get<std::string>());
+    ASSERT_GE(executionTime, 0);
+    sumOfExecutionTimes += executionTime;
+    if (planInJson.contains("PipelineThreadTimes")) {
+        ASSERT_GE(std::stod(planInJson.at("PipelineWallTime").get<std::string>()), 0);
+        ASSERT_GE(std::stod(planInJson.at("PipelineSchedulerWaitTime").get<std::string>()), 0);
+        // Formatted as "[t1, t2, ...]" with one time per thread that ran the pipeline.
+        auto threadTimes = planInJson.at("PipelineThreadTimes").get<std::string>();
+        ASSERT_TRUE(threadTimes.starts_with("[") && threadTimes.ends_with("]"));
+        threadTimes = threadTimes.substr(1, threadTimes.length() - 2);
+        ASSERT_FALSE(threadTimes.empty());
+        std::stringstream threadTimesStream(threadTimes);
+        std::string threadTime;
+        while (std::getline(threadTimesStream, threadTime, ',')) {
+            ASSERT_GE(std::stod(threadTime), 0);
+            sumOfPipelineThreadTimes += std::stod(threadTime);
+        }
+    }
+    for (auto& [key, val] : planInJson.items()) {
+        if (key.starts_with("Child")) {
+            sumProfiledTimes(val, sumOfExecutionTimes, sumOfPipelineThreadTimes);
+        }
+    }
+}
+
+TEST_F(ApiTest, ProfileOperatorAndPipelineTimes) {
+    auto result = conn->query("PROFILE MATCH (a:person), (b:person), (c:person), (d:person), "
+                              "(e:person), (f:person) RETURN MIN(a.age + b.age + c.age + d.age + "
+                              "e.age + f.age)");
+    ASSERT_TRUE(result->isSuccess());
+    auto& planInJson = TestHelper::getPlanInJson(*result);
+    ASSERT_TRUE(planInJson.contains("PipelineWallTime"));
+    double sumOfExecutionTimes = 0, sumOfPipelineThreadTimes = 0;
+    sumProfiledTimes(planInJson, sumOfExecutionTimes, sumOfPipelineThreadTimes);
+    ASSERT_GT(sumOfPipelineThreadTimes, 0);
+    // The time of a sink covers its whole pipeline. Operator times are exclusive of the children
+    // in the same pipeline, so they add up to the pipeline times. Were they inclusive, children
+    // would be counted once more for every parent.
+    ASSERT_NEAR(sumOfExecutionTimes, sumOfPipelineThreadTimes, 1e-3);
+}
+
+static const char* LONG_RUNNING_QUERY =
+    "MATCH (a:person), (b:person), (c:person), (d:person), (e:person), (f:person), (g:person), "
+    "(h:person) RETURN MIN(a.age + b.age + c.age + d.age + e.age + f.age + g.age + h.age)";
+
+TEST_F(ApiTest, QueryTimeOut) {
+    conn->setQueryTimeOut(1);
+    auto result = conn->query(LONG_RUNNING_QUERY);
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Interrupted: Query exceeded the timeout of 1 ms.");
+    conn->setQueryTimeOut(0);
+    result = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_TRUE(result->isSuccess());
+}
+
+TEST_F(ApiTest, Interrupt) {
+    // Interrupt after the query is compiled and before it is executed.
+    auto preparedStatement = prepareNoLock(*conn, LONG_RUNNING_QUERY);
+    conn->interrupt();
+    auto result = executeAndAutoCommitIfNecessaryNoLock(*conn, preparedStatement.get());
+    ASSERT_FALSE(result->isSuccess());
+    ASSERT_EQ(result->getErrorMessage(), "Interrupted: Query is interrupted.");
+    // The interruption does not carry over to the next query.
+    result = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_TRUE(result->isSuccess());
+}
+
+TEST_F(ApiTest, QueryMemoryLimit) {
+    conn->setQueryMemoryLimit(1);
+    auto result = conn->query("MATCH (a:person) RETURN a.fName ORDER BY a.fName");
+    ASSERT_FALSE(result->isSuccess());
+    conn->setQueryMemoryLimit(0);
+    result = conn->query("MATCH (a:person) RETURN a.fName ORDER BY a.fName");
+    ASSERT_TRUE(result->isSuccess());
+}
+
+// Point queries from one connection should not wait behind an analytical query from another
+// connection that occupies every worker thread. The bound is coarse so that it holds on slow and
+// loaded machines: the p99 latency of point queries must stay below the time of the whole
+// analytical query, which every point query would wait for without fair scheduling.
+TEST_F(ApiTest, PointQueryLatencyUnderAnalyticalLoad) {
+    std::atomic<bool> isAnalyticalQueryDone{false};
+    uint64_t analyticalQueryTimeInMicros = 0;
+    std::thread analyticalThread([&]() {
+        auto analyticalConn = std::make_unique<Connection>(database.get());
+        auto start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(analyticalConn->query(LONG_RUNNING_QUERY)->isSuccess());
+        analyticalQueryTimeInMicros = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                          .count();
+        isAnalyticalQueryDone.store(true);
+    });
+    // Let the analytical query occupy the workers first.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::vector<uint64_t> latenciesInMicros;
+    do {
+        auto start = std::chrono::steady_clock::now();
+        auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.fName");
+        latenciesInMicros.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+                                        .count());
+        ASSERT_TRUE(result->isSuccess());
+    } while (!isAnalyticalQueryDone.load());
+    analyticalThread.join();
+    std::sort(latenciesInMicros.begin(), latenciesInMicros.end());
+    auto p99LatencyInMicros = latenciesInMicros[latenciesInMicros.size() * 99 / 100];
+    ASSERT_LT(p99LatencyInMicros, analyticalQueryTimeInMicros);
+}
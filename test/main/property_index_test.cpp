@@ -0,0 +1,89 @@
+#include "main_test_helper/main_test_helper.h"
+
+using namespace kuzu::common;
+using namespace kuzu::testing;
+
+TEST_F(ApiTest, PropertyIndexEqualityAndRange) {
+    ASSERT_TRUE(conn->query("CREATE INDEX ON person(age)")->isSuccess());
+    ASSERT_TRUE(conn->query("CREATE INDEX ON person(eyeSight)")->isSuccess());
+    auto result = conn->query("MATCH (a:person) WHERE a.age = 35 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Alice"});
+    result = conn->query("MATCH (a:person) WHERE a.age > 50 RETURN a.ID");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"10"});
+    result = conn->query("MATCH (a:person) WHERE 45 <= a.age RETURN a.ID");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), (std::vector<std::string>{"10", "3"}));
+    result = conn->query("MATCH (a:person) WHERE a.age >= 20 AND a.age < 25 RETURN a.ID");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), (std::vector<std::string>{"5", "7"}));
+    result = conn->query("MATCH (a:person) WHERE a.eyeSight = 4.5 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Farooq"});
+    result = conn->query("MATCH (a:person)-[:knows]->(b:person) WHERE a.age = 35 RETURN b.ID");
+    ASSERT_EQ(
+        TestHelper::convertResultToString(*result), (std::vector<std::string>{"2", "3", "5"}));
+}
+
+TEST_F(ApiTest, PropertyIndexStringParameter) {
+    ASSERT_TRUE(conn->query("CREATE INDEX ON person(fName)")->isSuccess());
+    auto preparedStatement = conn->prepare("MATCH (a:person) WHERE a.fName = $n RETURN a.ID");
+    auto result =
+        conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "Farooq"));
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"8"});
+    result = conn->execute(preparedStatement.get(), std::make_pair(std::string("n"), "Zed"));
+    ASSERT_FALSE(result->hasNext());
+}
+
+TEST_F(ApiTest, PropertyIndexMaintenance) {
+    ASSERT_TRUE(conn->query("CREATE INDEX ON person(age)")->isSuccess());
+    conn->beginWriteTransaction();
+    conn->query("MATCH (a:person) WHERE a.ID = 0 SET a.age = 99");
+    auto result = conn->query("MATCH (a:person) WHERE a.age = 99 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Alice"});
+    conn->rollback();
+    result = conn->query("MATCH (a:person) WHERE a.age = 99 RETURN a.fName");
+    ASSERT_FALSE(result->hasNext());
+    result = conn->query("MATCH (a:person) WHERE a.age = 35 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Alice"});
+
+    conn->query("MATCH (a:person) WHERE a.ID = 0 SET a.age = 99");
+    result = conn->query("MATCH (a:person) WHERE a.age = 99 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Alice"});
+    result = conn->query("MATCH (a:person) WHERE a.age = 35 RETURN a.fName");
+    ASSERT_FALSE(result->hasNext());
+
+    conn->query("CREATE (:person {ID: 100, fName: 'Zed', age: 77})");
+    result = conn->query("MATCH (a:person) WHERE a.age = 77 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Zed"});
+    conn->query("MATCH (a:person) WHERE a.ID = 100 DELETE a");
+    result = conn->query("MATCH (a:person) WHERE a.age = 77 RETURN a.fName");
+    ASSERT_FALSE(result->hasNext());
+}
+
+TEST_F(ApiTest, PropertyIndexPersistence) {
+    ASSERT_TRUE(conn->query("CREATE INDEX ON person(age)")->isSuccess());
+    conn->query("MATCH (a:person) WHERE a.ID = 0 SET a.age = 99");
+    createDBAndConn();
+    auto result = conn->query("MATCH (a:person) WHERE a.age = 99 RETURN a.fName");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), std::vector<std::string>{"Alice"});
+    result = conn->query("MATCH (a:person) WHERE a.age = 35 RETURN a.fName");
+    ASSERT_FALSE(result->hasNext());
+    result = conn->query("MATCH (a:person) WHERE a.age > 50 RETURN a.ID");
+    ASSERT_EQ(TestHelper::convertResultToString(*result), (std::vector<std::string>{"0", "10"}));
+    ASSERT_FALSE(conn->query("CREATE INDEX ON person(age)")->isSuccess());
+}
+
+TEST_F(ApiTest, PropertyIndexErrors) {
+    auto result = conn->query("CREATE INDEX ON nonexist(age)");
+    ASSERT_EQ(result->getErrorMessage(), "Binder exception: Node table nonexist does not exist.");
+    result = conn->query("CREATE INDEX ON person(nonexist)");
+    ASSERT_EQ(result->getErrorMessage(),
+        "Binder exception: person table doesn't have property: nonexist.");
+    result = conn->query("CREATE INDEX ON person(usedNames)");
+    ASSERT_EQ(result->getErrorMessage(),
+        "Binder exception: Cannot create an index on property usedNames of type STRING[].");
+    ASSERT_TRUE(conn->query("CREATE INDEX ON person(age)")->isSuccess());
+    result = conn->query("CREATE INDEX ON person(age)");
+    ASSERT_EQ(result->getErrorMessage(),
+        "Binder exception: Property age of table: person is already indexed.");
+    conn->beginReadOnlyTransaction();
+    ASSERT_FALSE(conn->query("CREATE INDEX ON person(gender)")->isSuccess());
+    conn->commit();
+}
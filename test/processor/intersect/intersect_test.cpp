@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "processor/operator/intersect/intersect.h"
+
+using ::testing::Test;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+
+class IntersectTest : public Test {
+
+public:
+    struct IntersectResult {
+        uint64_t numOutputValues;
+        std::vector<sel_t> leftPositions;
+        std::vector<sel_t> rightPositions;
+        std::vector<offset_t> outputOffsets;
+    };
+
+    // Sorted node ids with duplicates, as adjacency lists may hold multiple rels to the same node.
+    static std::vector<nodeID_t> generateSortedNodeIDs(
+        uint64_t numValues, offset_t maxOffset, std::mt19937& generator) {
+        std::uniform_int_distribution<offset_t> distribution(0, maxOffset);
+        std::vector<nodeID_t> nodeIDs(numValues);
+        for (auto& nodeID : nodeIDs) {
+            nodeID = nodeID_t{distribution(generator), 0 /* tableID */};
+        }
+        std::sort(nodeIDs.begin(), nodeIDs.end(),
+            [](const nodeID_t& a, const nodeID_t& b) { return a.offset < b.offset; });
+        return nodeIDs;
+    }
+
+    template<typename F>
+    static IntersectResult intersect(
+        std::vector<nodeID_t> leftNodeIDs, std::vector<nodeID_t> rightNodeIDs, F kernel) {
+        SelectionVector lSelVector(DEFAULT_VECTOR_CAPACITY);
+        SelectionVector rSelVector(DEFAULT_VECTOR_CAPACITY);
+        lSelVector.resetSelectorToUnselectedWithSize(leftNodeIDs.size());
+        rSelVector.resetSelectorToUnselectedWithSize(rightNodeIDs.size());
+        IntersectResult result;
+        result.numOutputValues =
+            kernel(leftNodeIDs.data(), lSelVector, rightNodeIDs.data(), rSelVector);
+        for (auto i = 0u; i < result.numOutputValues; i++) {
+            result.leftPositions.push_back(lSelVector.getSelectedPositionsBuffer()[i]);
+            result.rightPositions.push_back(rSelVector.getSelectedPositionsBuffer()[i]);
+            result.outputOffsets.push_back(leftNodeIDs[i].offset);
+        }
+        return result;
+    }
+
+    // Checks both kernels against each other and against std::set_intersection.
+    static void checkIntersect(
+        const std::vector<nodeID_t>& leftNodeIDs, const std::vector<nodeID_t>& rightNodeIDs) {
+        auto mergeResult = intersect(leftNodeIDs, rightNodeIDs, Intersect::mergeIntersect);
+        auto gallopingResult = intersect(leftNodeIDs, rightNodeIDs, Intersect::gallopingIntersect);
+        std::vector<offset_t> leftOffsets, rightOffsets, expectedOffsets;
+        for (auto& nodeID : leftNodeIDs) {
+            leftOffsets.push_back(nodeID.offset);
+        }
+        for (auto& nodeID : rightNodeIDs) {
+            rightOffsets.push_back(nodeID.offset);
+        }
+        std::set_intersection(leftOffsets.begin(), leftOffsets.end(), rightOffsets.begin(),
+            rightOffsets.end(), std::back_inserter(expectedOffsets));
+        ASSERT_EQ(mergeResult.outputOffsets, expectedOffsets);
+        ASSERT_EQ(gallopingResult.numOutputValues, mergeResult.numOutputValues);
+        ASSERT_EQ(gallopingResult.leftPositions, mergeResult.leftPositions);
+        ASSERT_EQ(gallopingResult.rightPositions, mergeResult.rightPositions);
+        ASSERT_EQ(gallopingResult.outputOffsets, mergeResult.outputOffsets);
+        for (auto i = 0u; i < mergeResult.numOutputValues; i++) {
+            ASSERT_EQ(leftOffsets[mergeResult.leftPositions[i]], mergeResult.outputOffsets[i]);
+            ASSERT_EQ(rightOffsets[mergeResult.rightPositions[i]], mergeResult.outputOffsets[i]);
+        }
+        // twoWayIntersect picks one of the kernels depending on the size ratio of the lists.
+        auto twoWayResult = intersect(leftNodeIDs, rightNodeIDs,
+            [](nodeID_t* leftNodeIDs, SelectionVector& lSelVector, nodeID_t* rightNodeIDs,
+                SelectionVector& rSelVector) -> uint64_t {
+                Intersect::twoWayIntersect(leftNodeIDs, lSelVector, rightNodeIDs, rSelVector);
+                EXPECT_EQ(lSelVector.selectedSize, rSelVector.selectedSize);
+                return lSelVector.selectedSize;
+            });
+        ASSERT_EQ(twoWayResult.leftPositions, mergeResult.leftPositions);
+        ASSERT_EQ(twoWayResult.rightPositions, mergeResult.rightPositions);
+    }
+
+    static std::vector<nodeID_t> toNodeIDs(const std::vector<offset_t>& offsets) {
+        std::vector<nodeID_t> nodeIDs;
+        for (auto offset : offsets) {
+            nodeIDs.emplace_back(offset, 0 /* tableID */);
+        }
+        return nodeIDs;
+    }
+};
+
+TEST_F(IntersectTest, GallopingMatchesMergeOnEdgeCases) {
+    checkIntersect(toNodeIDs({}), toNodeIDs({1, 2, 3}));
+    checkIntersect(toNodeIDs({0}), toNodeIDs({1, 2, 3}));
+    checkIntersect(toNodeIDs({4}), toNodeIDs({1, 2, 3}));
+    checkIntersect(toNodeIDs({1, 3}), toNodeIDs({1, 2, 3}));
+    checkIntersect(toNodeIDs({3, 3}), toNodeIDs({1, 3}));
+    checkIntersect(toNodeIDs({2, 2, 5}), toNodeIDs({2, 2, 2, 5, 5}));
+    checkIntersect(toNodeIDs({0, 7}), toNodeIDs({0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST_F(IntersectTest, GallopingMatchesMergeOnRandomLists) {
+    std::mt19937 generator(0);
+    auto maxRightSize = (uint64_t)DEFAULT_VECTOR_CAPACITY;
+    // Left sizes below and above maxRightSize / GALLOPING_SIZE_RATIO, so that twoWayIntersect
+    // runs both kernels.
+    std::vector<uint64_t> leftSizes{
+        1, 7, maxRightSize / Intersect::GALLOPING_SIZE_RATIO - 1, 100, 1000, maxRightSize};
+    for (auto maxOffset : std::vector<offset_t>{maxRightSize / 2, maxRightSize * 4, 1000000}) {
+        for (auto leftSize : leftSizes) {
+            for (auto i = 0u; i < 5; i++) {
+                auto leftNodeIDs = generateSortedNodeIDs(leftSize, maxOffset, generator);
+                auto rightNodeIDs = generateSortedNodeIDs(maxRightSize, maxOffset, generator);
+                checkIntersect(leftNodeIDs, rightNodeIDs);
+            }
+        }
+    }
+}
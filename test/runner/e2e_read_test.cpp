@@ -9,6 +9,14 @@ class LongStringPKTest : public DBTest {
     }
 };
 
+// Node properties x and y are null in every 3rd and 5th row respectively, over more rows than a
+// vector holds.
+class NullableComparisonTest : public DBTest {
+    std::string getInputDir() override {
+        return TestHelper::appendKuzuRootPath("dataset/nullable-comparison-tests/");
+    }
+};
+
 class TinySnbReadTest : public DBTest {
 public:
     std::string getInputDir() override {
@@ -20,6 +28,11 @@ TEST_F(LongStringPKTest, LongStringPKTest) {
     runTest(TestHelper::appendKuzuRootPath("test/test_files/long_string_pk/long_string_pk.test"));
 }
 
+TEST_F(NullableComparisonTest, NullableComparisonTest) {
+    runTest(TestHelper::appendKuzuRootPath(
+        "test/test_files/nullable_comparison/nullable_comparison.test"));
+}
+
 TEST_F(TinySnbReadTest, Match) {
     runTest(TestHelper::appendKuzuRootPath("test/test_files/tinysnb/match/node.test"));
     runTest(TestHelper::appendKuzuRootPath("test/test_files/tinysnb/match/one_hop.test"));
@@ -2,7 +2,6 @@
 
 #include <fstream>
 
-#include "json.hpp"
 #include "spdlog/spdlog.h"
 
 using namespace kuzu::common;
@@ -40,6 +39,21 @@ std::vector<std::unique_ptr<TestQueryConfig>> TestHelper::parseTestFile(
             currentConfig->encodedJoin = line.substr(14, line.length());
         } else if (line.starts_with("-ENUMERATE")) {
             currentConfig->enumerate = true;
+        } else if (line.starts_with("-CHECK_NUM_OUTPUT_TUPLES")) {
+            auto operatorAndNumTuples = line.substr(25, line.length());
+            auto spacePos = operatorAndNumTuples.find(' ');
+            currentConfig->operatorMetricChecks.push_back(
+                OperatorMetricCheck{operatorAndNumTuples.substr(0, spacePos), "NumOutputTuples",
+                    stoull(operatorAndNumTuples.substr(spacePos + 1))});
+        } else if (line.starts_with("-CHECK_OPERATOR_METRIC")) {
+            auto operatorMetricAndValue = line.substr(23, line.length());
+            auto firstSpacePos = operatorMetricAndValue.find(' ');
+            auto secondSpacePos = operatorMetricAndValue.find(' ', firstSpacePos + 1);
+            currentConfig->operatorMetricChecks.push_back(
+                OperatorMetricCheck{operatorMetricAndValue.substr(0, firstSpacePos),
+                    operatorMetricAndValue.substr(
+                        firstSpacePos + 1, secondSpacePos - firstSpacePos - 1),
+                    stoull(operatorMetricAndValue.substr(secondSpacePos + 1))});
         } else if (line.starts_with("----")) {
             uint64_t numTuples = stoi(line.substr(5, line.length()));
             currentConfig->expectedNumTuples = numTuples;
@@ -110,6 +124,9 @@ bool TestHelper::testQuery(TestQueryConfig* config, Connection& conn) {
         spdlog::error(preparedStatement->getErrorMessage());
         return false;
     }
+    if (!config->operatorMetricChecks.empty()) {
+        preparedStatement->preparedSummary.isProfile = true;
+    }
     auto numPlans = preparedStatement->logicalPlans.size();
     if (numPlans == 0) {
         spdlog::error("Query {} has no plans" + config->name);
@@ -122,8 +139,19 @@ bool TestHelper::testQuery(TestQueryConfig* config, Connection& conn) {
         assert(result->isSuccess());
         std::vector<std::string> resultTuples =
             convertResultToString(*result, config->checkOutputOrder);
+        auto isProfileMatched = true;
+        for (auto& check : config->operatorMetricChecks) {
+            uint64_t value = 0;
+            if (!sumOperatorMetric(*result, check.operatorName, check.metricName, value)) {
+                isProfileMatched = false;
+            } else if (value != check.expectedValue) {
+                spdlog::error("{} {} IS {}, EXPECTED {}.", check.operatorName, check.metricName,
+                    value, check.expectedValue);
+                isProfileMatched = false;
+            }
+        }
         if (resultTuples.size() == result->getNumTuples() &&
-            resultTuples == config->expectedTuples) {
+            resultTuples == config->expectedTuples && isProfileMatched) {
             spdlog::info(
                 "PLAN{} PASSED in {}ms.", i, result->getQuerySummary()->getExecutionTime());
             numPassedPlans++;
@@ -140,5 +168,33 @@ bool TestHelper::testQuery(TestQueryConfig* config, Connection& conn) {
     return numPassedPlans == numPlans;
 }
 
+bool TestHelper::sumOperatorMetric(QueryResult& queryResult, const std::string& operatorName,
+    const std::string& metricName, uint64_t& sum) {
+    sum = 0;
+    return sumOperatorMetric(getPlanInJson(queryResult), operatorName, metricName, sum);
+}
+
+bool TestHelper::sumOperatorMetric(const nlohmann::json& planInJson,
+    const std::string& operatorName, const std::string& metricName, uint64_t& sum) {
+    if (!planInJson.is_object() || !planInJson.contains("Name")) {
+        spdlog::error("PLAN NODE WITHOUT NAME: {}", planInJson.dump());
+        return false;
+    }
+    for (auto& [key, val] : planInJson.items()) {
+        if (key.starts_with("Child") &&
+            !sumOperatorMetric(val, operatorName, metricName, sum)) {
+            return false;
+        }
+    }
+    if (planInJson.at("Name") == operatorName) {
+        if (!planInJson.contains(metricName) || !planInJson.at(metricName).is_string()) {
+            spdlog::error("{} DOES NOT REPORT {}.", operatorName, metricName);
+            return false;
+        }
+        sum += stoull(planInJson.at(metricName).get<std::string>());
+    }
+    return true;
+}
+
 } // namespace testing
 } // namespace kuzu
@@ -78,7 +78,7 @@ std::vector<std::string> CypherLexer::_ruleNames = {
   "IdentifierPart", "EscapedSymbolicName", "SP", "WHITESPACE", "Comment", 
   "FF", "EscapedSymbolicName_0", "RS", "ID_Continue", "Comment_1", "StringLiteral_1", 
   "Comment_3", "Comment_2", "GS", "FS", "CR", "Sc", "SPACE", "Pc", "TAB", 
-  "StringLiteral_0", "LF", "VT", "US", "ID_Start", "Unknown"
+  "StringLiteral_0", "LF", "VT", "US", "ID_Start", "Unknown", "INDEX", "ON"
 };
 
 std::vector<std::string> CypherLexer::_channelNames = {
@@ -116,7 +116,7 @@ std::vector<std::string> CypherLexer::_symbolicNames = {
   "DecimalInteger", "HexLetter", "HexDigit", "Digit", "NonZeroDigit", "NonZeroOctDigit", 
   "ZeroDigit", "RegularDecimalReal", "UnescapedSymbolicName", "IdentifierStart", 
   "IdentifierPart", "EscapedSymbolicName", "SP", "WHITESPACE", "Comment", 
-  "Unknown"
+  "Unknown", "INDEX", "ON"
 };
 
 dfa::Vocabulary CypherLexer::_vocabulary(_literalNames, _symbolicNames);
@@ -140,190 +140,191 @@ CypherLexer::Initializer::Initializer() {
 
   _serializedATN = {
     0x3, 0x608b, 0xa72a, 0x8133, 0xb9ed, 0x417c, 0x3be7, 0x7786, 0x5964, 
-    0x2, 0x7c, 0x386, 0x8, 0x1, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 
-    0x4, 0x4, 0x9, 0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 
-    0x9, 0x7, 0x4, 0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 
-    0x4, 0xb, 0x9, 0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 
-    0x9, 0xe, 0x4, 0xf, 0x9, 0xf, 0x4, 0x10, 0x9, 0x10, 0x4, 0x11, 0x9, 
-    0x11, 0x4, 0x12, 0x9, 0x12, 0x4, 0x13, 0x9, 0x13, 0x4, 0x14, 0x9, 0x14, 
-    0x4, 0x15, 0x9, 0x15, 0x4, 0x16, 0x9, 0x16, 0x4, 0x17, 0x9, 0x17, 0x4, 
-    0x18, 0x9, 0x18, 0x4, 0x19, 0x9, 0x19, 0x4, 0x1a, 0x9, 0x1a, 0x4, 0x1b, 
-    0x9, 0x1b, 0x4, 0x1c, 0x9, 0x1c, 0x4, 0x1d, 0x9, 0x1d, 0x4, 0x1e, 0x9, 
-    0x1e, 0x4, 0x1f, 0x9, 0x1f, 0x4, 0x20, 0x9, 0x20, 0x4, 0x21, 0x9, 0x21, 
-    0x4, 0x22, 0x9, 0x22, 0x4, 0x23, 0x9, 0x23, 0x4, 0x24, 0x9, 0x24, 0x4, 
-    0x25, 0x9, 0x25, 0x4, 0x26, 0x9, 0x26, 0x4, 0x27, 0x9, 0x27, 0x4, 0x28, 
-    0x9, 0x28, 0x4, 0x29, 0x9, 0x29, 0x4, 0x2a, 0x9, 0x2a, 0x4, 0x2b, 0x9, 
-    0x2b, 0x4, 0x2c, 0x9, 0x2c, 0x4, 0x2d, 0x9, 0x2d, 0x4, 0x2e, 0x9, 0x2e, 
-    0x4, 0x2f, 0x9, 0x2f, 0x4, 0x30, 0x9, 0x30, 0x4, 0x31, 0x9, 0x31, 0x4, 
-    0x32, 0x9, 0x32, 0x4, 0x33, 0x9, 0x33, 0x4, 0x34, 0x9, 0x34, 0x4, 0x35, 
-    0x9, 0x35, 0x4, 0x36, 0x9, 0x36, 0x4, 0x37, 0x9, 0x37, 0x4, 0x38, 0x9, 
-    0x38, 0x4, 0x39, 0x9, 0x39, 0x4, 0x3a, 0x9, 0x3a, 0x4, 0x3b, 0x9, 0x3b, 
-    0x4, 0x3c, 0x9, 0x3c, 0x4, 0x3d, 0x9, 0x3d, 0x4, 0x3e, 0x9, 0x3e, 0x4, 
-    0x3f, 0x9, 0x3f, 0x4, 0x40, 0x9, 0x40, 0x4, 0x41, 0x9, 0x41, 0x4, 0x42, 
-    0x9, 0x42, 0x4, 0x43, 0x9, 0x43, 0x4, 0x44, 0x9, 0x44, 0x4, 0x45, 0x9, 
-    0x45, 0x4, 0x46, 0x9, 0x46, 0x4, 0x47, 0x9, 0x47, 0x4, 0x48, 0x9, 0x48, 
-    0x4, 0x49, 0x9, 0x49, 0x4, 0x4a, 0x9, 0x4a, 0x4, 0x4b, 0x9, 0x4b, 0x4, 
-    0x4c, 0x9, 0x4c, 0x4, 0x4d, 0x9, 0x4d, 0x4, 0x4e, 0x9, 0x4e, 0x4, 0x4f, 
-    0x9, 0x4f, 0x4, 0x50, 0x9, 0x50, 0x4, 0x51, 0x9, 0x51, 0x4, 0x52, 0x9, 
-    0x52, 0x4, 0x53, 0x9, 0x53, 0x4, 0x54, 0x9, 0x54, 0x4, 0x55, 0x9, 0x55, 
-    0x4, 0x56, 0x9, 0x56, 0x4, 0x57, 0x9, 0x57, 0x4, 0x58, 0x9, 0x58, 0x4, 
-    0x59, 0x9, 0x59, 0x4, 0x5a, 0x9, 0x5a, 0x4, 0x5b, 0x9, 0x5b, 0x4, 0x5c, 
-    0x9, 0x5c, 0x4, 0x5d, 0x9, 0x5d, 0x4, 0x5e, 0x9, 0x5e, 0x4, 0x5f, 0x9, 
-    0x5f, 0x4, 0x60, 0x9, 0x60, 0x4, 0x61, 0x9, 0x61, 0x4, 0x62, 0x9, 0x62, 
-    0x4, 0x63, 0x9, 0x63, 0x4, 0x64, 0x9, 0x64, 0x4, 0x65, 0x9, 0x65, 0x4, 
-    0x66, 0x9, 0x66, 0x4, 0x67, 0x9, 0x67, 0x4, 0x68, 0x9, 0x68, 0x4, 0x69, 
-    0x9, 0x69, 0x4, 0x6a, 0x9, 0x6a, 0x4, 0x6b, 0x9, 0x6b, 0x4, 0x6c, 0x9, 
-    0x6c, 0x4, 0x6d, 0x9, 0x6d, 0x4, 0x6e, 0x9, 0x6e, 0x4, 0x6f, 0x9, 0x6f, 
-    0x4, 0x70, 0x9, 0x70, 0x4, 0x71, 0x9, 0x71, 0x4, 0x72, 0x9, 0x72, 0x4, 
-    0x73, 0x9, 0x73, 0x4, 0x74, 0x9, 0x74, 0x4, 0x75, 0x9, 0x75, 0x4, 0x76, 
-    0x9, 0x76, 0x4, 0x77, 0x9, 0x77, 0x4, 0x78, 0x9, 0x78, 0x4, 0x79, 0x9, 
-    0x79, 0x4, 0x7a, 0x9, 0x7a, 0x4, 0x7b, 0x9, 0x7b, 0x4, 0x7c, 0x9, 0x7c, 
-    0x4, 0x7d, 0x9, 0x7d, 0x4, 0x7e, 0x9, 0x7e, 0x4, 0x7f, 0x9, 0x7f, 0x4, 
-    0x80, 0x9, 0x80, 0x4, 0x81, 0x9, 0x81, 0x4, 0x82, 0x9, 0x82, 0x4, 0x83, 
-    0x9, 0x83, 0x4, 0x84, 0x9, 0x84, 0x4, 0x85, 0x9, 0x85, 0x4, 0x86, 0x9, 
-    0x86, 0x4, 0x87, 0x9, 0x87, 0x4, 0x88, 0x9, 0x88, 0x4, 0x89, 0x9, 0x89, 
-    0x4, 0x8a, 0x9, 0x8a, 0x4, 0x8b, 0x9, 0x8b, 0x4, 0x8c, 0x9, 0x8c, 0x4, 
-    0x8d, 0x9, 0x8d, 0x4, 0x8e, 0x9, 0x8e, 0x4, 0x8f, 0x9, 0x8f, 0x3, 0x2, 
-    0x3, 0x2, 0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x4, 0x3, 0x5, 0x3, 0x5, 
-    0x3, 0x6, 0x3, 0x6, 0x3, 0x7, 0x3, 0x7, 0x3, 0x8, 0x3, 0x8, 0x3, 0x9, 
-    0x3, 0x9, 0x3, 0xa, 0x3, 0xa, 0x3, 0xb, 0x3, 0xb, 0x3, 0xc, 0x3, 0xc, 
-    0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xe, 0x3, 0xe, 0x3, 0xe, 0x3, 0xf, 
-    0x3, 0xf, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x11, 0x3, 0x11, 0x3, 
-    0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 0x13, 0x3, 0x13, 0x3, 0x14, 0x3, 0x14, 
-    0x3, 0x14, 0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x16, 0x3, 0x16, 0x3, 
-    0x17, 0x3, 0x17, 0x3, 0x18, 0x3, 0x18, 0x3, 0x19, 0x3, 0x19, 0x3, 0x1a, 
-    0x3, 0x1a, 0x3, 0x1a, 0x3, 0x1b, 0x3, 0x1b, 0x3, 0x1c, 0x3, 0x1c, 0x3, 
-    0x1d, 0x3, 0x1d, 0x3, 0x1e, 0x3, 0x1e, 0x3, 0x1f, 0x3, 0x1f, 0x3, 0x20, 
-    0x3, 0x20, 0x3, 0x21, 0x3, 0x21, 0x3, 0x22, 0x3, 0x22, 0x3, 0x23, 0x3, 
-    0x23, 0x3, 0x24, 0x3, 0x24, 0x3, 0x25, 0x3, 0x25, 0x3, 0x26, 0x3, 0x26, 
-    0x3, 0x27, 0x3, 0x27, 0x3, 0x28, 0x3, 0x28, 0x3, 0x29, 0x3, 0x29, 0x3, 
-    0x2a, 0x3, 0x2a, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2d, 
-    0x3, 0x2d, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x30, 0x3, 
-    0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 
-    0x3, 0x31, 0x3, 0x31, 0x3, 0x32, 0x3, 0x32, 0x3, 0x32, 0x3, 0x32, 0x3, 
-    0x32, 0x3, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x34, 
-    0x3, 0x34, 0x3, 0x34, 0x3, 0x34, 0x3, 0x34, 0x3, 0x34, 0x3, 0x35, 0x3, 
-    0x35, 0x3, 0x35, 0x3, 0x35, 0x3, 0x35, 0x3, 0x36, 0x3, 0x36, 0x3, 0x36, 
-    0x3, 0x36, 0x3, 0x36, 0x3, 0x36, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 
-    0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x38, 0x3, 0x38, 
-    0x3, 0x38, 0x3, 0x38, 0x3, 0x38, 0x3, 0x38, 0x3, 0x38, 0x3, 0x39, 0x3, 
-    0x39, 0x3, 0x39, 0x3, 0x39, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 
-    0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3b, 0x3, 0x3b, 0x3, 
-    0x3b, 0x3, 0x3b, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3d, 
-    0x3, 0x3d, 0x3, 0x3d, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 
-    0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 
-    0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x40, 0x3, 
-    0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x41, 0x3, 0x41, 
-    0x3, 0x41, 0x3, 0x41, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 
-    0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x43, 0x3, 0x43, 
-    0x3, 0x43, 0x3, 0x43, 0x3, 0x43, 0x3, 0x43, 0x3, 0x44, 0x3, 0x44, 0x3, 
-    0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 0x45, 0x3, 0x45, 
-    0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x46, 0x3, 
-    0x46, 0x3, 0x46, 0x3, 0x46, 0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 
-    0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 0x3, 0x48, 0x3, 0x48, 0x3, 0x48, 0x3, 
-    0x48, 0x3, 0x48, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 
-    0x3, 0x49, 0x3, 0x49, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 
-    0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4b, 0x3, 0x4b, 
-    0x3, 0x4c, 0x3, 0x4c, 0x3, 0x4c, 0x3, 0x4d, 0x3, 0x4d, 0x3, 0x4d, 0x3, 
-    0x4d, 0x3, 0x4d, 0x3, 0x4d, 0x3, 0x4e, 0x3, 0x4e, 0x3, 0x4e, 0x3, 0x4f, 
-    0x3, 0x4f, 0x3, 0x4f, 0x3, 0x4f, 0x3, 0x4f, 0x3, 0x50, 0x3, 0x50, 0x3, 
-    0x50, 0x3, 0x50, 0x3, 0x50, 0x3, 0x50, 0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 
+    0x2, 0x7e, 0x393, 0x8, 0x1, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 
+    0x4, 0x9, 0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 0x9, 
+    0x7, 0x4, 0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 0x4, 
+    0xb, 0x9, 0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 0x9, 
+    0xe, 0x4, 0xf, 0x9, 0xf, 0x4, 0x10, 0x9, 0x10, 0x4, 0x11, 0x9, 0x11, 0x4, 
+    0x12, 0x9, 0x12, 0x4, 0x13, 0x9, 0x13, 0x4, 0x14, 0x9, 0x14, 0x4, 0x15, 
+    0x9, 0x15, 0x4, 0x16, 0x9, 0x16, 0x4, 0x17, 0x9, 0x17, 0x4, 0x18, 0x9, 
+    0x18, 0x4, 0x19, 0x9, 0x19, 0x4, 0x1a, 0x9, 0x1a, 0x4, 0x1b, 0x9, 0x1b, 
+    0x4, 0x1c, 0x9, 0x1c, 0x4, 0x1d, 0x9, 0x1d, 0x4, 0x1e, 0x9, 0x1e, 0x4, 
+    0x1f, 0x9, 0x1f, 0x4, 0x20, 0x9, 0x20, 0x4, 0x21, 0x9, 0x21, 0x4, 0x22, 
+    0x9, 0x22, 0x4, 0x23, 0x9, 0x23, 0x4, 0x24, 0x9, 0x24, 0x4, 0x25, 0x9, 
+    0x25, 0x4, 0x26, 0x9, 0x26, 0x4, 0x27, 0x9, 0x27, 0x4, 0x28, 0x9, 0x28, 
+    0x4, 0x29, 0x9, 0x29, 0x4, 0x2a, 0x9, 0x2a, 0x4, 0x2b, 0x9, 0x2b, 0x4, 
+    0x2c, 0x9, 0x2c, 0x4, 0x2d, 0x9, 0x2d, 0x4, 0x2e, 0x9, 0x2e, 0x4, 0x2f, 
+    0x9, 0x2f, 0x4, 0x30, 0x9, 0x30, 0x4, 0x31, 0x9, 0x31, 0x4, 0x32, 0x9, 
+    0x32, 0x4, 0x33, 0x9, 0x33, 0x4, 0x34, 0x9, 0x34, 0x4, 0x35, 0x9, 0x35, 
+    0x4, 0x36, 0x9, 0x36, 0x4, 0x37, 0x9, 0x37, 0x4, 0x38, 0x9, 0x38, 0x4, 
+    0x39, 0x9, 0x39, 0x4, 0x3a, 0x9, 0x3a, 0x4, 0x3b, 0x9, 0x3b, 0x4, 0x3c, 
+    0x9, 0x3c, 0x4, 0x3d, 0x9, 0x3d, 0x4, 0x3e, 0x9, 0x3e, 0x4, 0x3f, 0x9, 
+    0x3f, 0x4, 0x40, 0x9, 0x40, 0x4, 0x41, 0x9, 0x41, 0x4, 0x42, 0x9, 0x42, 
+    0x4, 0x43, 0x9, 0x43, 0x4, 0x44, 0x9, 0x44, 0x4, 0x45, 0x9, 0x45, 0x4, 
+    0x46, 0x9, 0x46, 0x4, 0x47, 0x9, 0x47, 0x4, 0x48, 0x9, 0x48, 0x4, 0x49, 
+    0x9, 0x49, 0x4, 0x4a, 0x9, 0x4a, 0x4, 0x4b, 0x9, 0x4b, 0x4, 0x4c, 0x9, 
+    0x4c, 0x4, 0x4d, 0x9, 0x4d, 0x4, 0x4e, 0x9, 0x4e, 0x4, 0x4f, 0x9, 0x4f, 
+    0x4, 0x50, 0x9, 0x50, 0x4, 0x51, 0x9, 0x51, 0x4, 0x52, 0x9, 0x52, 0x4, 
+    0x53, 0x9, 0x53, 0x4, 0x54, 0x9, 0x54, 0x4, 0x55, 0x9, 0x55, 0x4, 0x56, 
+    0x9, 0x56, 0x4, 0x57, 0x9, 0x57, 0x4, 0x58, 0x9, 0x58, 0x4, 0x59, 0x9, 
+    0x59, 0x4, 0x5a, 0x9, 0x5a, 0x4, 0x5b, 0x9, 0x5b, 0x4, 0x5c, 0x9, 0x5c, 
+    0x4, 0x5d, 0x9, 0x5d, 0x4, 0x5e, 0x9, 0x5e, 0x4, 0x5f, 0x9, 0x5f, 0x4, 
+    0x60, 0x9, 0x60, 0x4, 0x61, 0x9, 0x61, 0x4, 0x62, 0x9, 0x62, 0x4, 0x63, 
+    0x9, 0x63, 0x4, 0x64, 0x9, 0x64, 0x4, 0x65, 0x9, 0x65, 0x4, 0x66, 0x9, 
+    0x66, 0x4, 0x67, 0x9, 0x67, 0x4, 0x68, 0x9, 0x68, 0x4, 0x69, 0x9, 0x69, 
+    0x4, 0x6a, 0x9, 0x6a, 0x4, 0x6b, 0x9, 0x6b, 0x4, 0x6c, 0x9, 0x6c, 0x4, 
+    0x6d, 0x9, 0x6d, 0x4, 0x6e, 0x9, 0x6e, 0x4, 0x6f, 0x9, 0x6f, 0x4, 0x70, 
+    0x9, 0x70, 0x4, 0x71, 0x9, 0x71, 0x4, 0x72, 0x9, 0x72, 0x4, 0x73, 0x9, 
+    0x73, 0x4, 0x74, 0x9, 0x74, 0x4, 0x75, 0x9, 0x75, 0x4, 0x76, 0x9, 0x76, 
+    0x4, 0x77, 0x9, 0x77, 0x4, 0x78, 0x9, 0x78, 0x4, 0x79, 0x9, 0x79, 0x4, 
+    0x7a, 0x9, 0x7a, 0x4, 0x7b, 0x9, 0x7b, 0x4, 0x7c, 0x9, 0x7c, 0x4, 0x7d, 
+    0x9, 0x7d, 0x4, 0x7e, 0x9, 0x7e, 0x4, 0x7f, 0x9, 0x7f, 0x4, 0x80, 0x9, 
+    0x80, 0x4, 0x81, 0x9, 0x81, 0x4, 0x82, 0x9, 0x82, 0x4, 0x83, 0x9, 0x83, 
+    0x4, 0x84, 0x9, 0x84, 0x4, 0x85, 0x9, 0x85, 0x4, 0x86, 0x9, 0x86, 0x4, 
+    0x87, 0x9, 0x87, 0x4, 0x88, 0x9, 0x88, 0x4, 0x89, 0x9, 0x89, 0x4, 0x8a, 
+    0x9, 0x8a, 0x4, 0x8b, 0x9, 0x8b, 0x4, 0x8c, 0x9, 0x8c, 0x4, 0x8d, 0x9, 
+    0x8d, 0x4, 0x8e, 0x9, 0x8e, 0x4, 0x8f, 0x9, 0x8f, 0x3, 0x2, 0x3, 0x2, 
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x4, 0x3, 0x4, 0x3, 0x5, 0x3, 0x5, 0x3, 0x6, 
+    0x3, 0x6, 0x3, 0x7, 0x3, 0x7, 0x3, 0x8, 0x3, 0x8, 0x3, 0x9, 0x3, 0x9, 
+    0x3, 0xa, 0x3, 0xa, 0x3, 0xb, 0x3, 0xb, 0x3, 0xc, 0x3, 0xc, 0x3, 0xd, 
+    0x3, 0xd, 0x3, 0xd, 0x3, 0xe, 0x3, 0xe, 0x3, 0xe, 0x3, 0xf, 0x3, 0xf, 
+    0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x11, 0x3, 0x11, 0x3, 0x12, 0x3, 
+    0x12, 0x3, 0x12, 0x3, 0x13, 0x3, 0x13, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 
+    0x3, 0x15, 0x3, 0x15, 0x3, 0x15, 0x3, 0x16, 0x3, 0x16, 0x3, 0x17, 0x3, 
+    0x17, 0x3, 0x18, 0x3, 0x18, 0x3, 0x19, 0x3, 0x19, 0x3, 0x1a, 0x3, 0x1a, 
+    0x3, 0x1a, 0x3, 0x1b, 0x3, 0x1b, 0x3, 0x1c, 0x3, 0x1c, 0x3, 0x1d, 0x3, 
+    0x1d, 0x3, 0x1e, 0x3, 0x1e, 0x3, 0x1f, 0x3, 0x1f, 0x3, 0x20, 0x3, 0x20, 
+    0x3, 0x21, 0x3, 0x21, 0x3, 0x22, 0x3, 0x22, 0x3, 0x23, 0x3, 0x23, 0x3, 
+    0x24, 0x3, 0x24, 0x3, 0x25, 0x3, 0x25, 0x3, 0x26, 0x3, 0x26, 0x3, 0x27, 
+    0x3, 0x27, 0x3, 0x28, 0x3, 0x28, 0x3, 0x29, 0x3, 0x29, 0x3, 0x2a, 0x3, 
+    0x2a, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2d, 0x3, 0x2d, 
+    0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x30, 0x3, 0x30, 0x3, 
+    0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 
+    0x3, 0x31, 0x3, 0x32, 0x3, 0x32, 0x3, 0x32, 0x3, 0x32, 0x3, 0x32, 0x3, 
+    0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x34, 0x3, 0x34, 
+    0x3, 0x34, 0x3, 0x34, 0x3, 0x34, 0x3, 0x34, 0x3, 0x35, 0x3, 0x35, 0x3, 
+    0x35, 0x3, 0x35, 0x3, 0x35, 0x3, 0x36, 0x3, 0x36, 0x3, 0x36, 0x3, 0x36, 
+    0x3, 0x36, 0x3, 0x36, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 
+    0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x38, 0x3, 0x38, 0x3, 0x38, 
+    0x3, 0x38, 0x3, 0x38, 0x3, 0x38, 0x3, 0x38, 0x3, 0x39, 0x3, 0x39, 0x3, 
+    0x39, 0x3, 0x39, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 
+    0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x3, 
+    0x3b, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3d, 0x3, 0x3d, 
+    0x3, 0x3d, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 
+    0x3e, 0x3, 0x3e, 0x3, 0x3e, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 
+    0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 0x3, 0x40, 0x3, 0x40, 0x3, 
+    0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x41, 0x3, 0x41, 0x3, 0x41, 
+    0x3, 0x41, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 
+    0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x42, 0x3, 0x43, 0x3, 0x43, 0x3, 0x43, 
+    0x3, 0x43, 0x3, 0x43, 0x3, 0x43, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 
+    0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 
+    0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x46, 0x3, 0x46, 0x3, 
+    0x46, 0x3, 0x46, 0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 0x3, 0x47, 
+    0x3, 0x47, 0x3, 0x47, 0x3, 0x48, 0x3, 0x48, 0x3, 0x48, 0x3, 0x48, 0x3, 
+    0x48, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 0x3, 0x49, 
+    0x3, 0x49, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 
+    0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4a, 0x3, 0x4b, 0x3, 0x4b, 0x3, 0x4c, 
+    0x3, 0x4c, 0x3, 0x4c, 0x3, 0x4d, 0x3, 0x4d, 0x3, 0x4d, 0x3, 0x4d, 0x3, 
+    0x4d, 0x3, 0x4d, 0x3, 0x4e, 0x3, 0x4e, 0x3, 0x4e, 0x3, 0x4f, 0x3, 0x4f, 
+    0x3, 0x4f, 0x3, 0x4f, 0x3, 0x4f, 0x3, 0x50, 0x3, 0x50, 0x3, 0x50, 0x3, 
+    0x50, 0x3, 0x50, 0x3, 0x50, 0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 
     0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 0x3, 0x51, 0x3, 
-    0x51, 0x3, 0x52, 0x3, 0x52, 0x3, 0x52, 0x3, 0x52, 0x3, 0x53, 0x3, 0x53, 
+    0x52, 0x3, 0x52, 0x3, 0x52, 0x3, 0x52, 0x3, 0x53, 0x3, 0x53, 0x3, 0x53, 
     0x3, 0x53, 0x3, 0x53, 0x3, 0x53, 0x3, 0x53, 0x3, 0x53, 0x3, 0x53, 0x3, 
-    0x53, 0x3, 0x53, 0x3, 0x53, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 
-    0x3, 0x54, 0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 
-    0x55, 0x3, 0x56, 0x3, 0x56, 0x3, 0x56, 0x3, 0x57, 0x3, 0x57, 0x3, 0x57, 
-    0x3, 0x57, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x59, 0x3, 
-    0x59, 0x3, 0x59, 0x3, 0x59, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5b, 
-    0x3, 0x5b, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x3, 
-    0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5e, 0x3, 0x5e, 0x3, 0x5e, 
-    0x3, 0x5e, 0x3, 0x5e, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 
-    0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x60, 0x3, 0x60, 
-    0x3, 0x60, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 
-    0x62, 0x3, 0x62, 0x3, 0x62, 0x3, 0x62, 0x3, 0x62, 0x3, 0x63, 0x3, 0x63, 
-    0x3, 0x63, 0x3, 0x63, 0x3, 0x63, 0x3, 0x63, 0x3, 0x64, 0x3, 0x64, 0x3, 
-    0x64, 0x3, 0x64, 0x3, 0x64, 0x3, 0x64, 0x3, 0x64, 0x3, 0x65, 0x3, 0x65, 
-    0x3, 0x65, 0x3, 0x65, 0x3, 0x65, 0x3, 0x66, 0x3, 0x66, 0x3, 0x66, 0x3, 
-    0x66, 0x3, 0x66, 0x3, 0x67, 0x3, 0x67, 0x3, 0x67, 0x3, 0x67, 0x3, 0x68, 
-    0x3, 0x68, 0x3, 0x68, 0x3, 0x68, 0x3, 0x68, 0x3, 0x69, 0x3, 0x69, 0x3, 
-    0x69, 0x3, 0x69, 0x3, 0x69, 0x3, 0x6a, 0x3, 0x6a, 0x3, 0x6a, 0x7, 0x6a, 
-    0x2c2, 0xa, 0x6a, 0xc, 0x6a, 0xe, 0x6a, 0x2c5, 0xb, 0x6a, 0x3, 0x6a, 
-    0x3, 0x6a, 0x3, 0x6a, 0x3, 0x6a, 0x7, 0x6a, 0x2cb, 0xa, 0x6a, 0xc, 0x6a, 
-    0xe, 0x6a, 0x2ce, 0xb, 0x6a, 0x3, 0x6a, 0x5, 0x6a, 0x2d1, 0xa, 0x6a, 
-    0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 
+    0x53, 0x3, 0x53, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 
+    0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 0x55, 0x3, 
+    0x56, 0x3, 0x56, 0x3, 0x56, 0x3, 0x57, 0x3, 0x57, 0x3, 0x57, 0x3, 0x57, 
+    0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x59, 0x3, 0x59, 0x3, 
+    0x59, 0x3, 0x59, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5b, 0x3, 0x5b, 
+    0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x3, 
+    0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5e, 0x3, 0x5e, 0x3, 0x5e, 0x3, 0x5e, 
+    0x3, 0x5e, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 
+    0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x60, 0x3, 0x60, 0x3, 0x60, 
+    0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x62, 0x3, 
+    0x62, 0x3, 0x62, 0x3, 0x62, 0x3, 0x62, 0x3, 0x63, 0x3, 0x63, 0x3, 0x63, 
+    0x3, 0x63, 0x3, 0x63, 0x3, 0x63, 0x3, 0x64, 0x3, 0x64, 0x3, 0x64, 0x3, 
+    0x64, 0x3, 0x64, 0x3, 0x64, 0x3, 0x64, 0x3, 0x65, 0x3, 0x65, 0x3, 0x65, 
+    0x3, 0x65, 0x3, 0x65, 0x3, 0x66, 0x3, 0x66, 0x3, 0x66, 0x3, 0x66, 0x3, 
+    0x66, 0x3, 0x67, 0x3, 0x67, 0x3, 0x67, 0x3, 0x67, 0x3, 0x68, 0x3, 0x68, 
+    0x3, 0x68, 0x3, 0x68, 0x3, 0x68, 0x3, 0x69, 0x3, 0x69, 0x3, 0x69, 0x3, 
+    0x69, 0x3, 0x69, 0x3, 0x6a, 0x3, 0x6a, 0x3, 0x6a, 0x7, 0x6a, 0x2c2, 0xa, 
+    0x6a, 0xc, 0x6a, 0xe, 0x6a, 0x2c5, 0xb, 0x6a, 0x3, 0x6a, 0x3, 0x6a, 0x3, 
+    0x6a, 0x3, 0x6a, 0x7, 0x6a, 0x2cb, 0xa, 0x6a, 0xc, 0x6a, 0xe, 0x6a, 
+    0x2ce, 0xb, 0x6a, 0x3, 0x6a, 0x5, 0x6a, 0x2d1, 0xa, 0x6a, 0x3, 0x6b, 0x3, 
     0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 
-    0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x5, 0x6b, 0x2e5, 
-    0xa, 0x6b, 0x3, 0x6c, 0x3, 0x6c, 0x3, 0x6c, 0x7, 0x6c, 0x2ea, 0xa, 0x6c, 
-    0xc, 0x6c, 0xe, 0x6c, 0x2ed, 0xb, 0x6c, 0x5, 0x6c, 0x2ef, 0xa, 0x6c, 
-    0x3, 0x6d, 0x5, 0x6d, 0x2f2, 0xa, 0x6d, 0x3, 0x6e, 0x3, 0x6e, 0x5, 0x6e, 
-    0x2f6, 0xa, 0x6e, 0x3, 0x6f, 0x3, 0x6f, 0x5, 0x6f, 0x2fa, 0xa, 0x6f, 
-    0x3, 0x70, 0x3, 0x70, 0x5, 0x70, 0x2fe, 0xa, 0x70, 0x3, 0x71, 0x3, 0x71, 
-    0x3, 0x72, 0x3, 0x72, 0x3, 0x73, 0x7, 0x73, 0x305, 0xa, 0x73, 0xc, 0x73, 
-    0xe, 0x73, 0x308, 0xb, 0x73, 0x3, 0x73, 0x3, 0x73, 0x6, 0x73, 0x30c, 
-    0xa, 0x73, 0xd, 0x73, 0xe, 0x73, 0x30d, 0x3, 0x74, 0x3, 0x74, 0x7, 0x74, 
-    0x312, 0xa, 0x74, 0xc, 0x74, 0xe, 0x74, 0x315, 0xb, 0x74, 0x3, 0x75, 
-    0x3, 0x75, 0x5, 0x75, 0x319, 0xa, 0x75, 0x3, 0x76, 0x3, 0x76, 0x5, 0x76, 
-    0x31d, 0xa, 0x76, 0x3, 0x77, 0x3, 0x77, 0x7, 0x77, 0x321, 0xa, 0x77, 
-    0xc, 0x77, 0xe, 0x77, 0x324, 0xb, 0x77, 0x3, 0x77, 0x6, 0x77, 0x327, 
-    0xa, 0x77, 0xd, 0x77, 0xe, 0x77, 0x328, 0x3, 0x78, 0x6, 0x78, 0x32c, 
-    0xa, 0x78, 0xd, 0x78, 0xe, 0x78, 0x32d, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 
-    0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 
-    0x79, 0x3, 0x79, 0x3, 0x79, 0x5, 0x79, 0x33c, 0xa, 0x79, 0x3, 0x7a, 
-    0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x7, 0x7a, 0x344, 
-    0xa, 0x7a, 0xc, 0x7a, 0xe, 0x7a, 0x347, 0xb, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 
-    0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x7, 0x7a, 0x34f, 0xa, 0x7a, 
-    0xc, 0x7a, 0xe, 0x7a, 0x352, 0xb, 0x7a, 0x3, 0x7a, 0x5, 0x7a, 0x355, 
-    0xa, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x5, 0x7a, 0x359, 0xa, 0x7a, 0x5, 0x7a, 
-    0x35b, 0xa, 0x7a, 0x3, 0x7b, 0x3, 0x7b, 0x3, 0x7c, 0x3, 0x7c, 0x3, 0x7d, 
-    0x3, 0x7d, 0x3, 0x7e, 0x3, 0x7e, 0x3, 0x7f, 0x3, 0x7f, 0x3, 0x80, 0x3, 
-    0x80, 0x3, 0x81, 0x3, 0x81, 0x3, 0x82, 0x3, 0x82, 0x3, 0x83, 0x3, 0x83, 
-    0x3, 0x84, 0x3, 0x84, 0x3, 0x85, 0x3, 0x85, 0x3, 0x86, 0x3, 0x86, 0x3, 
-    0x87, 0x3, 0x87, 0x3, 0x88, 0x3, 0x88, 0x3, 0x89, 0x3, 0x89, 0x3, 0x8a, 
-    0x3, 0x8a, 0x3, 0x8b, 0x3, 0x8b, 0x3, 0x8c, 0x3, 0x8c, 0x3, 0x8d, 0x3, 
-    0x8d, 0x3, 0x8e, 0x3, 0x8e, 0x3, 0x8f, 0x3, 0x8f, 0x2, 0x2, 0x90, 0x3, 
-    0x3, 0x5, 0x4, 0x7, 0x5, 0x9, 0x6, 0xb, 0x7, 0xd, 0x8, 0xf, 0x9, 0x11, 
-    0xa, 0x13, 0xb, 0x15, 0xc, 0x17, 0xd, 0x19, 0xe, 0x1b, 0xf, 0x1d, 0x10, 
-    0x1f, 0x11, 0x21, 0x12, 0x23, 0x13, 0x25, 0x14, 0x27, 0x15, 0x29, 0x16, 
-    0x2b, 0x17, 0x2d, 0x18, 0x2f, 0x19, 0x31, 0x1a, 0x33, 0x1b, 0x35, 0x1c, 
-    0x37, 0x1d, 0x39, 0x1e, 0x3b, 0x1f, 0x3d, 0x20, 0x3f, 0x21, 0x41, 0x22, 
-    0x43, 0x23, 0x45, 0x24, 0x47, 0x25, 0x49, 0x26, 0x4b, 0x27, 0x4d, 0x28, 
-    0x4f, 0x29, 0x51, 0x2a, 0x53, 0x2b, 0x55, 0x2c, 0x57, 0x2d, 0x59, 0x2e, 
-    0x5b, 0x2f, 0x5d, 0x30, 0x5f, 0x31, 0x61, 0x32, 0x63, 0x33, 0x65, 0x34, 
-    0x67, 0x35, 0x69, 0x36, 0x6b, 0x37, 0x6d, 0x38, 0x6f, 0x39, 0x71, 0x3a, 
-    0x73, 0x3b, 0x75, 0x3c, 0x77, 0x3d, 0x79, 0x3e, 0x7b, 0x3f, 0x7d, 0x40, 
-    0x7f, 0x41, 0x81, 0x42, 0x83, 0x43, 0x85, 0x44, 0x87, 0x45, 0x89, 0x46, 
-    0x8b, 0x47, 0x8d, 0x48, 0x8f, 0x49, 0x91, 0x4a, 0x93, 0x4b, 0x95, 0x4c, 
-    0x97, 0x4d, 0x99, 0x4e, 0x9b, 0x4f, 0x9d, 0x50, 0x9f, 0x51, 0xa1, 0x52, 
-    0xa3, 0x53, 0xa5, 0x54, 0xa7, 0x55, 0xa9, 0x56, 0xab, 0x57, 0xad, 0x58, 
-    0xaf, 0x59, 0xb1, 0x5a, 0xb3, 0x5b, 0xb5, 0x5c, 0xb7, 0x5d, 0xb9, 0x5e, 
-    0xbb, 0x5f, 0xbd, 0x60, 0xbf, 0x61, 0xc1, 0x62, 0xc3, 0x63, 0xc5, 0x64, 
-    0xc7, 0x65, 0xc9, 0x66, 0xcb, 0x67, 0xcd, 0x68, 0xcf, 0x69, 0xd1, 0x6a, 
-    0xd3, 0x6b, 0xd5, 0x6c, 0xd7, 0x6d, 0xd9, 0x6e, 0xdb, 0x6f, 0xdd, 0x70, 
-    0xdf, 0x71, 0xe1, 0x72, 0xe3, 0x73, 0xe5, 0x74, 0xe7, 0x75, 0xe9, 0x76, 
-    0xeb, 0x77, 0xed, 0x78, 0xef, 0x79, 0xf1, 0x7a, 0xf3, 0x7b, 0xf5, 0x2, 
-    0xf7, 0x2, 0xf9, 0x2, 0xfb, 0x2, 0xfd, 0x2, 0xff, 0x2, 0x101, 0x2, 0x103, 
-    0x2, 0x105, 0x2, 0x107, 0x2, 0x109, 0x2, 0x10b, 0x2, 0x10d, 0x2, 0x10f, 
-    0x2, 0x111, 0x2, 0x113, 0x2, 0x115, 0x2, 0x117, 0x2, 0x119, 0x2, 0x11b, 
-    0x2, 0x11d, 0x7c, 0x3, 0x2, 0x2d, 0x4, 0x2, 0x49, 0x49, 0x69, 0x69, 
-    0x4, 0x2, 0x4e, 0x4e, 0x6e, 0x6e, 0x4, 0x2, 0x51, 0x51, 0x71, 0x71, 
-    0x4, 0x2, 0x44, 0x44, 0x64, 0x64, 0x4, 0x2, 0x45, 0x45, 0x65, 0x65, 
-    0x4, 0x2, 0x52, 0x52, 0x72, 0x72, 0x4, 0x2, 0x5b, 0x5b, 0x7b, 0x7b, 
-    0x4, 0x2, 0x48, 0x48, 0x68, 0x68, 0x4, 0x2, 0x54, 0x54, 0x74, 0x74, 
-    0x4, 0x2, 0x4f, 0x4f, 0x6f, 0x6f, 0x4, 0x2, 0x50, 0x50, 0x70, 0x70, 
-    0x4, 0x2, 0x46, 0x46, 0x66, 0x66, 0x4, 0x2, 0x47, 0x47, 0x67, 0x67, 
-    0x4, 0x2, 0x56, 0x56, 0x76, 0x76, 0x4, 0x2, 0x43, 0x43, 0x63, 0x63, 
-    0x4, 0x2, 0x57, 0x57, 0x77, 0x77, 0x4, 0x2, 0x4b, 0x4b, 0x6b, 0x6b, 
-    0x4, 0x2, 0x4d, 0x4d, 0x6d, 0x6d, 0x4, 0x2, 0x5a, 0x5a, 0x7a, 0x7a, 
-    0x4, 0x2, 0x4a, 0x4a, 0x6a, 0x6a, 0x4, 0x2, 0x59, 0x59, 0x79, 0x79, 
-    0x4, 0x2, 0x55, 0x55, 0x75, 0x75, 0xf, 0x2, 0x24, 0x24, 0x29, 0x29, 
-    0x44, 0x44, 0x48, 0x48, 0x50, 0x50, 0x54, 0x54, 0x56, 0x56, 0x5e, 0x5e, 
-    0x64, 0x64, 0x68, 0x68, 0x70, 0x70, 0x74, 0x74, 0x76, 0x76, 0x4, 0x2, 
-    0x43, 0x48, 0x63, 0x68, 0xa, 0x2, 0xa2, 0xa2, 0x1682, 0x1682, 0x1810, 
-    0x1810, 0x2002, 0x200c, 0x202a, 0x202b, 0x2031, 0x2031, 0x2061, 0x2061, 
-    0x3002, 0x3002, 0x3, 0x2, 0xe, 0xe, 0x3, 0x2, 0x62, 0x62, 0x3, 0x2, 
-    0x20, 0x20, 0x3, 0x2, 0x2c, 0x2c, 0x4, 0x2, 0x29, 0x29, 0x5e, 0x5e, 
-    0x4, 0x2, 0xc, 0xc, 0xf, 0xf, 0x3, 0x2, 0x31, 0x31, 0x3, 0x2, 0x1f, 
+    0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 
+    0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6b, 0x5, 0x6b, 0x2e5, 0xa, 0x6b, 0x3, 
+    0x6c, 0x3, 0x6c, 0x3, 0x6c, 0x7, 0x6c, 0x2ea, 0xa, 0x6c, 0xc, 0x6c, 0xe, 
+    0x6c, 0x2ed, 0xb, 0x6c, 0x5, 0x6c, 0x2ef, 0xa, 0x6c, 0x3, 0x6d, 0x5, 
+    0x6d, 0x2f2, 0xa, 0x6d, 0x3, 0x6e, 0x3, 0x6e, 0x5, 0x6e, 0x2f6, 0xa, 
+    0x6e, 0x3, 0x6f, 0x3, 0x6f, 0x5, 0x6f, 0x2fa, 0xa, 0x6f, 0x3, 0x70, 0x3, 
+    0x70, 0x5, 0x70, 0x2fe, 0xa, 0x70, 0x3, 0x71, 0x3, 0x71, 0x3, 0x72, 0x3, 
+    0x72, 0x3, 0x73, 0x7, 0x73, 0x305, 0xa, 0x73, 0xc, 0x73, 0xe, 0x73, 
+    0x308, 0xb, 0x73, 0x3, 0x73, 0x3, 0x73, 0x6, 0x73, 0x30c, 0xa, 0x73, 0xd, 
+    0x73, 0xe, 0x73, 0x30d, 0x3, 0x74, 0x3, 0x74, 0x7, 0x74, 0x312, 0xa, 
+    0x74, 0xc, 0x74, 0xe, 0x74, 0x315, 0xb, 0x74, 0x3, 0x75, 0x3, 0x75, 0x5, 
+    0x75, 0x319, 0xa, 0x75, 0x3, 0x76, 0x3, 0x76, 0x5, 0x76, 0x31d, 0xa, 
+    0x76, 0x3, 0x77, 0x3, 0x77, 0x7, 0x77, 0x321, 0xa, 0x77, 0xc, 0x77, 0xe, 
+    0x77, 0x324, 0xb, 0x77, 0x3, 0x77, 0x6, 0x77, 0x327, 0xa, 0x77, 0xd, 
+    0x77, 0xe, 0x77, 0x328, 0x3, 0x78, 0x6, 0x78, 0x32c, 0xa, 0x78, 0xd, 
+    0x78, 0xe, 0x78, 0x32d, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 
+    0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 0x3, 0x79, 
+    0x3, 0x79, 0x5, 0x79, 0x33c, 0xa, 0x79, 0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 
+    0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x7, 0x7a, 0x344, 0xa, 0x7a, 0xc, 0x7a, 
+    0xe, 0x7a, 0x347, 0xb, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 0x3, 0x7a, 
+    0x3, 0x7a, 0x3, 0x7a, 0x7, 0x7a, 0x34f, 0xa, 0x7a, 0xc, 0x7a, 0xe, 0x7a, 
+    0x352, 0xb, 0x7a, 0x3, 0x7a, 0x5, 0x7a, 0x355, 0xa, 0x7a, 0x3, 0x7a, 0x3, 
+    0x7a, 0x5, 0x7a, 0x359, 0xa, 0x7a, 0x5, 0x7a, 0x35b, 0xa, 0x7a, 0x3, 
+    0x7b, 0x3, 0x7b, 0x3, 0x7c, 0x3, 0x7c, 0x3, 0x7d, 0x3, 0x7d, 0x3, 0x7e, 
+    0x3, 0x7e, 0x3, 0x7f, 0x3, 0x7f, 0x3, 0x80, 0x3, 0x80, 0x3, 0x81, 0x3, 
+    0x81, 0x3, 0x82, 0x3, 0x82, 0x3, 0x83, 0x3, 0x83, 0x3, 0x84, 0x3, 0x84, 
+    0x3, 0x85, 0x3, 0x85, 0x3, 0x86, 0x3, 0x86, 0x3, 0x87, 0x3, 0x87, 0x3, 
+    0x88, 0x3, 0x88, 0x3, 0x89, 0x3, 0x89, 0x3, 0x8a, 0x3, 0x8a, 0x3, 0x8b, 
+    0x3, 0x8b, 0x3, 0x8c, 0x3, 0x8c, 0x3, 0x8d, 0x3, 0x8d, 0x3, 0x8e, 0x3, 
+    0x8e, 0x3, 0x8f, 0x3, 0x8f, 0x4, 0x90, 0x9, 0x90, 0x3, 0x90, 0x3, 0x90, 
+    0x3, 0x90, 0x3, 0x90, 0x3, 0x90, 0x3, 0x90, 0x4, 0x91, 0x9, 0x91, 0x3, 
+    0x91, 0x3, 0x91, 0x3, 0x91, 0x2, 0x2, 0x92, 0x3, 0x3, 0x5, 0x4, 0x7, 0x5, 
+    0x9, 0x6, 0xb, 0x7, 0xd, 0x8, 0xf, 0x9, 0x11, 0xa, 0x13, 0xb, 0x15, 0xc, 
+    0x17, 0xd, 0x19, 0xe, 0x1b, 0xf, 0x1d, 0x10, 0x1f, 0x11, 0x21, 0x12, 
+    0x23, 0x13, 0x25, 0x14, 0x27, 0x15, 0x29, 0x16, 0x2b, 0x17, 0x2d, 0x18, 
+    0x2f, 0x19, 0x31, 0x1a, 0x33, 0x1b, 0x35, 0x1c, 0x37, 0x1d, 0x39, 0x1e, 
+    0x3b, 0x1f, 0x3d, 0x20, 0x3f, 0x21, 0x41, 0x22, 0x43, 0x23, 0x45, 0x24, 
+    0x47, 0x25, 0x49, 0x26, 0x4b, 0x27, 0x4d, 0x28, 0x4f, 0x29, 0x51, 0x2a, 
+    0x53, 0x2b, 0x55, 0x2c, 0x57, 0x2d, 0x59, 0x2e, 0x5b, 0x2f, 0x5d, 0x30, 
+    0x5f, 0x31, 0x61, 0x32, 0x63, 0x33, 0x65, 0x34, 0x67, 0x35, 0x69, 0x36, 
+    0x6b, 0x37, 0x6d, 0x38, 0x6f, 0x39, 0x71, 0x3a, 0x73, 0x3b, 0x75, 0x3c, 
+    0x77, 0x3d, 0x79, 0x3e, 0x7b, 0x3f, 0x7d, 0x40, 0x7f, 0x41, 0x81, 0x42, 
+    0x83, 0x43, 0x85, 0x44, 0x87, 0x45, 0x89, 0x46, 0x8b, 0x47, 0x8d, 0x48, 
+    0x8f, 0x49, 0x91, 0x4a, 0x93, 0x4b, 0x95, 0x4c, 0x97, 0x4d, 0x99, 0x4e, 
+    0x9b, 0x4f, 0x9d, 0x50, 0x9f, 0x51, 0xa1, 0x52, 0xa3, 0x53, 0xa5, 0x54, 
+    0xa7, 0x55, 0xa9, 0x56, 0xab, 0x57, 0xad, 0x58, 0xaf, 0x59, 0xb1, 0x5a, 
+    0xb3, 0x5b, 0xb5, 0x5c, 0xb7, 0x5d, 0xb9, 0x5e, 0xbb, 0x5f, 0xbd, 0x60, 
+    0xbf, 0x61, 0xc1, 0x62, 0xc3, 0x63, 0xc5, 0x64, 0xc7, 0x65, 0xc9, 0x66, 
+    0xcb, 0x67, 0xcd, 0x68, 0xcf, 0x69, 0xd1, 0x6a, 0xd3, 0x6b, 0xd5, 0x6c, 
+    0xd7, 0x6d, 0xd9, 0x6e, 0xdb, 0x6f, 0xdd, 0x70, 0xdf, 0x71, 0xe1, 0x72, 
+    0xe3, 0x73, 0xe5, 0x74, 0xe7, 0x75, 0xe9, 0x76, 0xeb, 0x77, 0xed, 0x78, 
+    0xef, 0x79, 0xf1, 0x7a, 0xf3, 0x7b, 0xf5, 0x2, 0xf7, 0x2, 0xf9, 0x2, 
+    0xfb, 0x2, 0xfd, 0x2, 0xff, 0x2, 0x101, 0x2, 0x103, 0x2, 0x105, 0x2, 
+    0x107, 0x2, 0x109, 0x2, 0x10b, 0x2, 0x10d, 0x2, 0x10f, 0x2, 0x111, 0x2, 
+    0x113, 0x2, 0x115, 0x2, 0x117, 0x2, 0x119, 0x2, 0x11b, 0x2, 0x11d, 0x7c, 
+    0x386, 0x7d, 0x38e, 0x7e, 0x3, 0x2, 0x2d, 0x4, 0x2, 0x49, 0x49, 0x69, 
+    0x69, 0x4, 0x2, 0x4e, 0x4e, 0x6e, 0x6e, 0x4, 0x2, 0x51, 0x51, 0x71, 0x71, 
+    0x4, 0x2, 0x44, 0x44, 0x64, 0x64, 0x4, 0x2, 0x45, 0x45, 0x65, 0x65, 0x4, 
+    0x2, 0x52, 0x52, 0x72, 0x72, 0x4, 0x2, 0x5b, 0x5b, 0x7b, 0x7b, 0x4, 0x2, 
+    0x48, 0x48, 0x68, 0x68, 0x4, 0x2, 0x54, 0x54, 0x74, 0x74, 0x4, 0x2, 0x4f, 
+    0x4f, 0x6f, 0x6f, 0x4, 0x2, 0x50, 0x50, 0x70, 0x70, 0x4, 0x2, 0x46, 0x46, 
+    0x66, 0x66, 0x4, 0x2, 0x47, 0x47, 0x67, 0x67, 0x4, 0x2, 0x56, 0x56, 0x76, 
+    0x76, 0x4, 0x2, 0x43, 0x43, 0x63, 0x63, 0x4, 0x2, 0x57, 0x57, 0x77, 0x77, 
+    0x4, 0x2, 0x4b, 0x4b, 0x6b, 0x6b, 0x4, 0x2, 0x4d, 0x4d, 0x6d, 0x6d, 0x4, 
+    0x2, 0x5a, 0x5a, 0x7a, 0x7a, 0x4, 0x2, 0x4a, 0x4a, 0x6a, 0x6a, 0x4, 0x2, 
+    0x59, 0x59, 0x79, 0x79, 0x4, 0x2, 0x55, 0x55, 0x75, 0x75, 0xf, 0x2, 0x24, 
+    0x24, 0x29, 0x29, 0x44, 0x44, 0x48, 0x48, 0x50, 0x50, 0x54, 0x54, 0x56, 
+    0x56, 0x5e, 0x5e, 0x64, 0x64, 0x68, 0x68, 0x70, 0x70, 0x74, 0x74, 0x76, 
+    0x76, 0x4, 0x2, 0x43, 0x48, 0x63, 0x68, 0xa, 0x2, 0xa2, 0xa2, 0x1682, 
+    0x1682, 0x1810, 0x1810, 0x2002, 0x200c, 0x202a, 0x202b, 0x2031, 0x2031, 
+    0x2061, 0x2061, 0x3002, 0x3002, 0x3, 0x2, 0xe, 0xe, 0x3, 0x2, 0x62, 0x62, 
+    0x3, 0x2, 0x20, 0x20, 0x3, 0x2, 0x2c, 0x2c, 0x4, 0x2, 0x29, 0x29, 0x5e, 
+    0x5e, 0x4, 0x2, 0xc, 0xc, 0xf, 0xf, 0x3, 0x2, 0x31, 0x31, 0x3, 0x2, 0x1f, 
     0x1f, 0x3, 0x2, 0x1e, 0x1e, 0x3, 0x2, 0xf, 0xf, 0x13, 0x2, 0x26, 0x26, 
     0xa4, 0xa7, 0x591, 0x591, 0x60d, 0x60d, 0x9f4, 0x9f5, 0x9fd, 0x9fd, 
     0xaf3, 0xaf3, 0xbfb, 0xbfb, 0xe41, 0xe41, 0x17dd, 0x17dd, 0x20a2, 0x20c1, 
@@ -709,77 +710,77 @@ CypherLexer::Initializer::Initializer() {
     0x2, 0xffc4, 0x2, 0xffc9, 0x2, 0xffcc, 0x2, 0xffd1, 0x2, 0xffd4, 0x2, 
     0xffd9, 0x2, 0xffdc, 0x2, 0xffde, 0x2, 0x2, 0x3, 0xd, 0x3, 0xf, 0x3, 
     0x28, 0x3, 0x2a, 0x3, 0x3c, 0x3, 0x3e, 0x3, 0x3f, 0x3, 0x41, 0x3, 0x4f, 
-    0x3, 0x52, 0x3, 0x5f, 0x3, 0x82, 0x3, 0xfc, 0x3, 0x142, 0x3, 0x176, 
-    0x3, 0x282, 0x3, 0x29e, 0x3, 0x2a2, 0x3, 0x2d2, 0x3, 0x302, 0x3, 0x321, 
-    0x3, 0x32f, 0x3, 0x34c, 0x3, 0x352, 0x3, 0x377, 0x3, 0x382, 0x3, 0x39f, 
-    0x3, 0x3a2, 0x3, 0x3c5, 0x3, 0x3ca, 0x3, 0x3d1, 0x3, 0x3d3, 0x3, 0x3d7, 
-    0x3, 0x402, 0x3, 0x49f, 0x3, 0x4b2, 0x3, 0x4d5, 0x3, 0x4da, 0x3, 0x4fd, 
-    0x3, 0x502, 0x3, 0x529, 0x3, 0x532, 0x3, 0x565, 0x3, 0x602, 0x3, 0x738, 
-    0x3, 0x742, 0x3, 0x757, 0x3, 0x762, 0x3, 0x769, 0x3, 0x802, 0x3, 0x807, 
-    0x3, 0x80a, 0x3, 0x80a, 0x3, 0x80c, 0x3, 0x837, 0x3, 0x839, 0x3, 0x83a, 
-    0x3, 0x83e, 0x3, 0x83e, 0x3, 0x841, 0x3, 0x857, 0x3, 0x862, 0x3, 0x878, 
-    0x3, 0x882, 0x3, 0x8a0, 0x3, 0x8e2, 0x3, 0x8f4, 0x3, 0x8f6, 0x3, 0x8f7, 
-    0x3, 0x902, 0x3, 0x917, 0x3, 0x922, 0x3, 0x93b, 0x3, 0x982, 0x3, 0x9b9, 
-    0x3, 0x9c0, 0x3, 0x9c1, 0x3, 0xa02, 0x3, 0xa02, 0x3, 0xa12, 0x3, 0xa15, 
-    0x3, 0xa17, 0x3, 0xa19, 0x3, 0xa1b, 0x3, 0xa35, 0x3, 0xa62, 0x3, 0xa7e, 
-    0x3, 0xa82, 0x3, 0xa9e, 0x3, 0xac2, 0x3, 0xac9, 0x3, 0xacb, 0x3, 0xae6, 
-    0x3, 0xb02, 0x3, 0xb37, 0x3, 0xb42, 0x3, 0xb57, 0x3, 0xb62, 0x3, 0xb74, 
-    0x3, 0xb82, 0x3, 0xb93, 0x3, 0xc02, 0x3, 0xc4a, 0x3, 0xc82, 0x3, 0xcb4, 
-    0x3, 0xcc2, 0x3, 0xcf4, 0x3, 0x1005, 0x3, 0x1039, 0x3, 0x1085, 0x3, 
-    0x10b1, 0x3, 0x10d2, 0x3, 0x10ea, 0x3, 0x1105, 0x3, 0x1128, 0x3, 0x1152, 
-    0x3, 0x1174, 0x3, 0x1178, 0x3, 0x1178, 0x3, 0x1185, 0x3, 0x11b4, 0x3, 
-    0x11c3, 0x3, 0x11c6, 0x3, 0x11dc, 0x3, 0x11dc, 0x3, 0x11de, 0x3, 0x11de, 
-    0x3, 0x1202, 0x3, 0x1213, 0x3, 0x1215, 0x3, 0x122d, 0x3, 0x1282, 0x3, 
-    0x1288, 0x3, 0x128a, 0x3, 0x128a, 0x3, 0x128c, 0x3, 0x128f, 0x3, 0x1291, 
-    0x3, 0x129f, 0x3, 0x12a1, 0x3, 0x12aa, 0x3, 0x12b2, 0x3, 0x12e0, 0x3, 
-    0x1307, 0x3, 0x130e, 0x3, 0x1311, 0x3, 0x1312, 0x3, 0x1315, 0x3, 0x132a, 
-    0x3, 0x132c, 0x3, 0x1332, 0x3, 0x1334, 0x3, 0x1335, 0x3, 0x1337, 0x3, 
-    0x133b, 0x3, 0x133f, 0x3, 0x133f, 0x3, 0x1352, 0x3, 0x1352, 0x3, 0x135f, 
-    0x3, 0x1363, 0x3, 0x1402, 0x3, 0x1436, 0x3, 0x1449, 0x3, 0x144c, 0x3, 
-    0x1482, 0x3, 0x14b1, 0x3, 0x14c6, 0x3, 0x14c7, 0x3, 0x14c9, 0x3, 0x14c9, 
-    0x3, 0x1582, 0x3, 0x15b0, 0x3, 0x15da, 0x3, 0x15dd, 0x3, 0x1602, 0x3, 
-    0x1631, 0x3, 0x1646, 0x3, 0x1646, 0x3, 0x1682, 0x3, 0x16ac, 0x3, 0x1702, 
-    0x3, 0x171b, 0x3, 0x18a2, 0x3, 0x18e1, 0x3, 0x1901, 0x3, 0x1901, 0x3, 
-    0x1a02, 0x3, 0x1a02, 0x3, 0x1a0d, 0x3, 0x1a34, 0x3, 0x1a3c, 0x3, 0x1a3c, 
-    0x3, 0x1a52, 0x3, 0x1a52, 0x3, 0x1a5e, 0x3, 0x1a85, 0x3, 0x1a88, 0x3, 
-    0x1a8b, 0x3, 0x1ac2, 0x3, 0x1afa, 0x3, 0x1c02, 0x3, 0x1c0a, 0x3, 0x1c0c, 
-    0x3, 0x1c30, 0x3, 0x1c42, 0x3, 0x1c42, 0x3, 0x1c74, 0x3, 0x1c91, 0x3, 
-    0x1d02, 0x3, 0x1d08, 0x3, 0x1d0a, 0x3, 0x1d0b, 0x3, 0x1d0d, 0x3, 0x1d32, 
-    0x3, 0x1d48, 0x3, 0x1d48, 0x3, 0x2002, 0x3, 0x239b, 0x3, 0x2402, 0x3, 
-    0x2470, 0x3, 0x2482, 0x3, 0x2545, 0x3, 0x3002, 0x3, 0x3430, 0x3, 0x4402, 
-    0x3, 0x4648, 0x3, 0x6802, 0x3, 0x6a3a, 0x3, 0x6a42, 0x3, 0x6a60, 0x3, 
-    0x6ad2, 0x3, 0x6aef, 0x3, 0x6b02, 0x3, 0x6b31, 0x3, 0x6b42, 0x3, 0x6b45, 
-    0x3, 0x6b65, 0x3, 0x6b79, 0x3, 0x6b7f, 0x3, 0x6b91, 0x3, 0x6f02, 0x3, 
-    0x6f46, 0x3, 0x6f52, 0x3, 0x6f52, 0x3, 0x6f95, 0x3, 0x6fa1, 0x3, 0x6fe2, 
-    0x3, 0x6fe3, 0x3, 0x7002, 0x3, 0x87ee, 0x3, 0x8802, 0x3, 0x8af4, 0x3, 
-    0xb002, 0x3, 0xb120, 0x3, 0xb172, 0x3, 0xb2fd, 0x3, 0xbc02, 0x3, 0xbc6c, 
-    0x3, 0xbc72, 0x3, 0xbc7e, 0x3, 0xbc82, 0x3, 0xbc8a, 0x3, 0xbc92, 0x3, 
-    0xbc9b, 0x3, 0xd402, 0x3, 0xd456, 0x3, 0xd458, 0x3, 0xd49e, 0x3, 0xd4a0, 
-    0x3, 0xd4a1, 0x3, 0xd4a4, 0x3, 0xd4a4, 0x3, 0xd4a7, 0x3, 0xd4a8, 0x3, 
-    0xd4ab, 0x3, 0xd4ae, 0x3, 0xd4b0, 0x3, 0xd4bb, 0x3, 0xd4bd, 0x3, 0xd4bd, 
-    0x3, 0xd4bf, 0x3, 0xd4c5, 0x3, 0xd4c7, 0x3, 0xd507, 0x3, 0xd509, 0x3, 
-    0xd50c, 0x3, 0xd50f, 0x3, 0xd516, 0x3, 0xd518, 0x3, 0xd51e, 0x3, 0xd520, 
-    0x3, 0xd53b, 0x3, 0xd53d, 0x3, 0xd540, 0x3, 0xd542, 0x3, 0xd546, 0x3, 
-    0xd548, 0x3, 0xd548, 0x3, 0xd54c, 0x3, 0xd552, 0x3, 0xd554, 0x3, 0xd6a7, 
-    0x3, 0xd6aa, 0x3, 0xd6c2, 0x3, 0xd6c4, 0x3, 0xd6dc, 0x3, 0xd6de, 0x3, 
-    0xd6fc, 0x3, 0xd6fe, 0x3, 0xd716, 0x3, 0xd718, 0x3, 0xd736, 0x3, 0xd738, 
-    0x3, 0xd750, 0x3, 0xd752, 0x3, 0xd770, 0x3, 0xd772, 0x3, 0xd78a, 0x3, 
-    0xd78c, 0x3, 0xd7aa, 0x3, 0xd7ac, 0x3, 0xd7c4, 0x3, 0xd7c6, 0x3, 0xd7cd, 
-    0x3, 0xe802, 0x3, 0xe8c6, 0x3, 0xe902, 0x3, 0xe945, 0x3, 0xee02, 0x3, 
-    0xee05, 0x3, 0xee07, 0x3, 0xee21, 0x3, 0xee23, 0x3, 0xee24, 0x3, 0xee26, 
-    0x3, 0xee26, 0x3, 0xee29, 0x3, 0xee29, 0x3, 0xee2b, 0x3, 0xee34, 0x3, 
-    0xee36, 0x3, 0xee39, 0x3, 0xee3b, 0x3, 0xee3b, 0x3, 0xee3d, 0x3, 0xee3d, 
-    0x3, 0xee44, 0x3, 0xee44, 0x3, 0xee49, 0x3, 0xee49, 0x3, 0xee4b, 0x3, 
-    0xee4b, 0x3, 0xee4d, 0x3, 0xee4d, 0x3, 0xee4f, 0x3, 0xee51, 0x3, 0xee53, 
-    0x3, 0xee54, 0x3, 0xee56, 0x3, 0xee56, 0x3, 0xee59, 0x3, 0xee59, 0x3, 
-    0xee5b, 0x3, 0xee5b, 0x3, 0xee5d, 0x3, 0xee5d, 0x3, 0xee5f, 0x3, 0xee5f, 
-    0x3, 0xee61, 0x3, 0xee61, 0x3, 0xee63, 0x3, 0xee64, 0x3, 0xee66, 0x3, 
-    0xee66, 0x3, 0xee69, 0x3, 0xee6c, 0x3, 0xee6e, 0x3, 0xee74, 0x3, 0xee76, 
-    0x3, 0xee79, 0x3, 0xee7b, 0x3, 0xee7e, 0x3, 0xee80, 0x3, 0xee80, 0x3, 
-    0xee82, 0x3, 0xee8b, 0x3, 0xee8d, 0x3, 0xee9d, 0x3, 0xeea3, 0x3, 0xeea5, 
-    0x3, 0xeea7, 0x3, 0xeeab, 0x3, 0xeead, 0x3, 0xeebd, 0x3, 0x2, 0x4, 0xa6d8, 
+    0x3, 0x52, 0x3, 0x5f, 0x3, 0x82, 0x3, 0xfc, 0x3, 0x142, 0x3, 0x176, 0x3, 
+    0x282, 0x3, 0x29e, 0x3, 0x2a2, 0x3, 0x2d2, 0x3, 0x302, 0x3, 0x321, 0x3, 
+    0x32f, 0x3, 0x34c, 0x3, 0x352, 0x3, 0x377, 0x3, 0x382, 0x3, 0x39f, 0x3, 
+    0x3a2, 0x3, 0x3c5, 0x3, 0x3ca, 0x3, 0x3d1, 0x3, 0x3d3, 0x3, 0x3d7, 0x3, 
+    0x402, 0x3, 0x49f, 0x3, 0x4b2, 0x3, 0x4d5, 0x3, 0x4da, 0x3, 0x4fd, 0x3, 
+    0x502, 0x3, 0x529, 0x3, 0x532, 0x3, 0x565, 0x3, 0x602, 0x3, 0x738, 0x3, 
+    0x742, 0x3, 0x757, 0x3, 0x762, 0x3, 0x769, 0x3, 0x802, 0x3, 0x807, 0x3, 
+    0x80a, 0x3, 0x80a, 0x3, 0x80c, 0x3, 0x837, 0x3, 0x839, 0x3, 0x83a, 0x3, 
+    0x83e, 0x3, 0x83e, 0x3, 0x841, 0x3, 0x857, 0x3, 0x862, 0x3, 0x878, 0x3, 
+    0x882, 0x3, 0x8a0, 0x3, 0x8e2, 0x3, 0x8f4, 0x3, 0x8f6, 0x3, 0x8f7, 0x3, 
+    0x902, 0x3, 0x917, 0x3, 0x922, 0x3, 0x93b, 0x3, 0x982, 0x3, 0x9b9, 0x3, 
+    0x9c0, 0x3, 0x9c1, 0x3, 0xa02, 0x3, 0xa02, 0x3, 0xa12, 0x3, 0xa15, 0x3, 
+    0xa17, 0x3, 0xa19, 0x3, 0xa1b, 0x3, 0xa35, 0x3, 0xa62, 0x3, 0xa7e, 0x3, 
+    0xa82, 0x3, 0xa9e, 0x3, 0xac2, 0x3, 0xac9, 0x3, 0xacb, 0x3, 0xae6, 0x3, 
+    0xb02, 0x3, 0xb37, 0x3, 0xb42, 0x3, 0xb57, 0x3, 0xb62, 0x3, 0xb74, 0x3, 
+    0xb82, 0x3, 0xb93, 0x3, 0xc02, 0x3, 0xc4a, 0x3, 0xc82, 0x3, 0xcb4, 0x3, 
+    0xcc2, 0x3, 0xcf4, 0x3, 0x1005, 0x3, 0x1039, 0x3, 0x1085, 0x3, 0x10b1, 
+    0x3, 0x10d2, 0x3, 0x10ea, 0x3, 0x1105, 0x3, 0x1128, 0x3, 0x1152, 0x3, 
+    0x1174, 0x3, 0x1178, 0x3, 0x1178, 0x3, 0x1185, 0x3, 0x11b4, 0x3, 0x11c3, 
+    0x3, 0x11c6, 0x3, 0x11dc, 0x3, 0x11dc, 0x3, 0x11de, 0x3, 0x11de, 0x3, 
+    0x1202, 0x3, 0x1213, 0x3, 0x1215, 0x3, 0x122d, 0x3, 0x1282, 0x3, 0x1288, 
+    0x3, 0x128a, 0x3, 0x128a, 0x3, 0x128c, 0x3, 0x128f, 0x3, 0x1291, 0x3, 
+    0x129f, 0x3, 0x12a1, 0x3, 0x12aa, 0x3, 0x12b2, 0x3, 0x12e0, 0x3, 0x1307, 
+    0x3, 0x130e, 0x3, 0x1311, 0x3, 0x1312, 0x3, 0x1315, 0x3, 0x132a, 0x3, 
+    0x132c, 0x3, 0x1332, 0x3, 0x1334, 0x3, 0x1335, 0x3, 0x1337, 0x3, 0x133b, 
+    0x3, 0x133f, 0x3, 0x133f, 0x3, 0x1352, 0x3, 0x1352, 0x3, 0x135f, 0x3, 
+    0x1363, 0x3, 0x1402, 0x3, 0x1436, 0x3, 0x1449, 0x3, 0x144c, 0x3, 0x1482, 
+    0x3, 0x14b1, 0x3, 0x14c6, 0x3, 0x14c7, 0x3, 0x14c9, 0x3, 0x14c9, 0x3, 
+    0x1582, 0x3, 0x15b0, 0x3, 0x15da, 0x3, 0x15dd, 0x3, 0x1602, 0x3, 0x1631, 
+    0x3, 0x1646, 0x3, 0x1646, 0x3, 0x1682, 0x3, 0x16ac, 0x3, 0x1702, 0x3, 
+    0x171b, 0x3, 0x18a2, 0x3, 0x18e1, 0x3, 0x1901, 0x3, 0x1901, 0x3, 0x1a02, 
+    0x3, 0x1a02, 0x3, 0x1a0d, 0x3, 0x1a34, 0x3, 0x1a3c, 0x3, 0x1a3c, 0x3, 
+    0x1a52, 0x3, 0x1a52, 0x3, 0x1a5e, 0x3, 0x1a85, 0x3, 0x1a88, 0x3, 0x1a8b, 
+    0x3, 0x1ac2, 0x3, 0x1afa, 0x3, 0x1c02, 0x3, 0x1c0a, 0x3, 0x1c0c, 0x3, 
+    0x1c30, 0x3, 0x1c42, 0x3, 0x1c42, 0x3, 0x1c74, 0x3, 0x1c91, 0x3, 0x1d02, 
+    0x3, 0x1d08, 0x3, 0x1d0a, 0x3, 0x1d0b, 0x3, 0x1d0d, 0x3, 0x1d32, 0x3, 
+    0x1d48, 0x3, 0x1d48, 0x3, 0x2002, 0x3, 0x239b, 0x3, 0x2402, 0x3, 0x2470, 
+    0x3, 0x2482, 0x3, 0x2545, 0x3, 0x3002, 0x3, 0x3430, 0x3, 0x4402, 0x3, 
+    0x4648, 0x3, 0x6802, 0x3, 0x6a3a, 0x3, 0x6a42, 0x3, 0x6a60, 0x3, 0x6ad2, 
+    0x3, 0x6aef, 0x3, 0x6b02, 0x3, 0x6b31, 0x3, 0x6b42, 0x3, 0x6b45, 0x3, 
+    0x6b65, 0x3, 0x6b79, 0x3, 0x6b7f, 0x3, 0x6b91, 0x3, 0x6f02, 0x3, 0x6f46, 
+    0x3, 0x6f52, 0x3, 0x6f52, 0x3, 0x6f95, 0x3, 0x6fa1, 0x3, 0x6fe2, 0x3, 
+    0x6fe3, 0x3, 0x7002, 0x3, 0x87ee, 0x3, 0x8802, 0x3, 0x8af4, 0x3, 0xb002, 
+    0x3, 0xb120, 0x3, 0xb172, 0x3, 0xb2fd, 0x3, 0xbc02, 0x3, 0xbc6c, 0x3, 
+    0xbc72, 0x3, 0xbc7e, 0x3, 0xbc82, 0x3, 0xbc8a, 0x3, 0xbc92, 0x3, 0xbc9b, 
+    0x3, 0xd402, 0x3, 0xd456, 0x3, 0xd458, 0x3, 0xd49e, 0x3, 0xd4a0, 0x3, 
+    0xd4a1, 0x3, 0xd4a4, 0x3, 0xd4a4, 0x3, 0xd4a7, 0x3, 0xd4a8, 0x3, 0xd4ab, 
+    0x3, 0xd4ae, 0x3, 0xd4b0, 0x3, 0xd4bb, 0x3, 0xd4bd, 0x3, 0xd4bd, 0x3, 
+    0xd4bf, 0x3, 0xd4c5, 0x3, 0xd4c7, 0x3, 0xd507, 0x3, 0xd509, 0x3, 0xd50c, 
+    0x3, 0xd50f, 0x3, 0xd516, 0x3, 0xd518, 0x3, 0xd51e, 0x3, 0xd520, 0x3, 
+    0xd53b, 0x3, 0xd53d, 0x3, 0xd540, 0x3, 0xd542, 0x3, 0xd546, 0x3, 0xd548, 
+    0x3, 0xd548, 0x3, 0xd54c, 0x3, 0xd552, 0x3, 0xd554, 0x3, 0xd6a7, 0x3, 
+    0xd6aa, 0x3, 0xd6c2, 0x3, 0xd6c4, 0x3, 0xd6dc, 0x3, 0xd6de, 0x3, 0xd6fc, 
+    0x3, 0xd6fe, 0x3, 0xd716, 0x3, 0xd718, 0x3, 0xd736, 0x3, 0xd738, 0x3, 
+    0xd750, 0x3, 0xd752, 0x3, 0xd770, 0x3, 0xd772, 0x3, 0xd78a, 0x3, 0xd78c, 
+    0x3, 0xd7aa, 0x3, 0xd7ac, 0x3, 0xd7c4, 0x3, 0xd7c6, 0x3, 0xd7cd, 0x3, 
+    0xe802, 0x3, 0xe8c6, 0x3, 0xe902, 0x3, 0xe945, 0x3, 0xee02, 0x3, 0xee05, 
+    0x3, 0xee07, 0x3, 0xee21, 0x3, 0xee23, 0x3, 0xee24, 0x3, 0xee26, 0x3, 
+    0xee26, 0x3, 0xee29, 0x3, 0xee29, 0x3, 0xee2b, 0x3, 0xee34, 0x3, 0xee36, 
+    0x3, 0xee39, 0x3, 0xee3b, 0x3, 0xee3b, 0x3, 0xee3d, 0x3, 0xee3d, 0x3, 
+    0xee44, 0x3, 0xee44, 0x3, 0xee49, 0x3, 0xee49, 0x3, 0xee4b, 0x3, 0xee4b, 
+    0x3, 0xee4d, 0x3, 0xee4d, 0x3, 0xee4f, 0x3, 0xee51, 0x3, 0xee53, 0x3, 
+    0xee54, 0x3, 0xee56, 0x3, 0xee56, 0x3, 0xee59, 0x3, 0xee59, 0x3, 0xee5b, 
+    0x3, 0xee5b, 0x3, 0xee5d, 0x3, 0xee5d, 0x3, 0xee5f, 0x3, 0xee5f, 0x3, 
+    0xee61, 0x3, 0xee61, 0x3, 0xee63, 0x3, 0xee64, 0x3, 0xee66, 0x3, 0xee66, 
+    0x3, 0xee69, 0x3, 0xee6c, 0x3, 0xee6e, 0x3, 0xee74, 0x3, 0xee76, 0x3, 
+    0xee79, 0x3, 0xee7b, 0x3, 0xee7e, 0x3, 0xee80, 0x3, 0xee80, 0x3, 0xee82, 
+    0x3, 0xee8b, 0x3, 0xee8d, 0x3, 0xee9d, 0x3, 0xeea3, 0x3, 0xeea5, 0x3, 
+    0xeea7, 0x3, 0xeeab, 0x3, 0xeead, 0x3, 0xeebd, 0x3, 0x2, 0x4, 0xa6d8, 
     0x4, 0xa702, 0x4, 0xb736, 0x4, 0xb742, 0x4, 0xb81f, 0x4, 0xb822, 0x4, 
-    0xcea3, 0x4, 0xceb2, 0x4, 0xebe2, 0x4, 0xf802, 0x4, 0xfa1f, 0x4, 0x396, 
+    0xcea3, 0x4, 0xceb2, 0x4, 0xebe2, 0x4, 0xf802, 0x4, 0xfa1f, 0x4, 0x3a3, 
     0x2, 0x3, 0x3, 0x2, 0x2, 0x2, 0x2, 0x5, 0x3, 0x2, 0x2, 0x2, 0x2, 0x7, 
     0x3, 0x2, 0x2, 0x2, 0x2, 0x9, 0x3, 0x2, 0x2, 0x2, 0x2, 0xb, 0x3, 0x2, 
     0x2, 0x2, 0x2, 0xd, 0x3, 0x2, 0x2, 0x2, 0x2, 0xf, 0x3, 0x2, 0x2, 0x2, 
@@ -824,182 +825,181 @@ CypherLexer::Initializer::Initializer() {
     0x2, 0x2, 0x2, 0xc3, 0x3, 0x2, 0x2, 0x2, 0x2, 0xc5, 0x3, 0x2, 0x2, 0x2, 
     0x2, 0xc7, 0x3, 0x2, 0x2, 0x2, 0x2, 0xc9, 0x3, 0x2, 0x2, 0x2, 0x2, 0xcb, 
     0x3, 0x2, 0x2, 0x2, 0x2, 0xcd, 0x3, 0x2, 0x2, 0x2, 0x2, 0xcf, 0x3, 0x2, 
-    0x2, 0x2, 0x2, 0xd1, 0x3, 0x2, 0x2, 0x2, 0x2, 0xd3, 0x3, 0x2, 0x2, 0x2, 
-    0x2, 0xd5, 0x3, 0x2, 0x2, 0x2, 0x2, 0xd7, 0x3, 0x2, 0x2, 0x2, 0x2, 0xd9, 
-    0x3, 0x2, 0x2, 0x2, 0x2, 0xdb, 0x3, 0x2, 0x2, 0x2, 0x2, 0xdd, 0x3, 0x2, 
-    0x2, 0x2, 0x2, 0xdf, 0x3, 0x2, 0x2, 0x2, 0x2, 0xe1, 0x3, 0x2, 0x2, 0x2, 
-    0x2, 0xe3, 0x3, 0x2, 0x2, 0x2, 0x2, 0xe5, 0x3, 0x2, 0x2, 0x2, 0x2, 0xe7, 
-    0x3, 0x2, 0x2, 0x2, 0x2, 0xe9, 0x3, 0x2, 0x2, 0x2, 0x2, 0xeb, 0x3, 0x2, 
-    0x2, 0x2, 0x2, 0xed, 0x3, 0x2, 0x2, 0x2, 0x2, 0xef, 0x3, 0x2, 0x2, 0x2, 
-    0x2, 0xf1, 0x3, 0x2, 0x2, 0x2, 0x2, 0xf3, 0x3, 0x2, 0x2, 0x2, 0x2, 0x11d, 
-    0x3, 0x2, 0x2, 0x2, 0x3, 0x11f, 0x3, 0x2, 0x2, 0x2, 0x5, 0x121, 0x3, 
-    0x2, 0x2, 0x2, 0x7, 0x123, 0x3, 0x2, 0x2, 0x2, 0x9, 0x125, 0x3, 0x2, 
-    0x2, 0x2, 0xb, 0x127, 0x3, 0x2, 0x2, 0x2, 0xd, 0x129, 0x3, 0x2, 0x2, 
-    0x2, 0xf, 0x12b, 0x3, 0x2, 0x2, 0x2, 0x11, 0x12d, 0x3, 0x2, 0x2, 0x2, 
-    0x13, 0x12f, 0x3, 0x2, 0x2, 0x2, 0x15, 0x131, 0x3, 0x2, 0x2, 0x2, 0x17, 
-    0x133, 0x3, 0x2, 0x2, 0x2, 0x19, 0x135, 0x3, 0x2, 0x2, 0x2, 0x1b, 0x138, 
-    0x3, 0x2, 0x2, 0x2, 0x1d, 0x13b, 0x3, 0x2, 0x2, 0x2, 0x1f, 0x13d, 0x3, 
-    0x2, 0x2, 0x2, 0x21, 0x140, 0x3, 0x2, 0x2, 0x2, 0x23, 0x142, 0x3, 0x2, 
-    0x2, 0x2, 0x25, 0x145, 0x3, 0x2, 0x2, 0x2, 0x27, 0x147, 0x3, 0x2, 0x2, 
-    0x2, 0x29, 0x14a, 0x3, 0x2, 0x2, 0x2, 0x2b, 0x14d, 0x3, 0x2, 0x2, 0x2, 
-    0x2d, 0x14f, 0x3, 0x2, 0x2, 0x2, 0x2f, 0x151, 0x3, 0x2, 0x2, 0x2, 0x31, 
-    0x153, 0x3, 0x2, 0x2, 0x2, 0x33, 0x155, 0x3, 0x2, 0x2, 0x2, 0x35, 0x158, 
-    0x3, 0x2, 0x2, 0x2, 0x37, 0x15a, 0x3, 0x2, 0x2, 0x2, 0x39, 0x15c, 0x3, 
-    0x2, 0x2, 0x2, 0x3b, 0x15e, 0x3, 0x2, 0x2, 0x2, 0x3d, 0x160, 0x3, 0x2, 
-    0x2, 0x2, 0x3f, 0x162, 0x3, 0x2, 0x2, 0x2, 0x41, 0x164, 0x3, 0x2, 0x2, 
-    0x2, 0x43, 0x166, 0x3, 0x2, 0x2, 0x2, 0x45, 0x168, 0x3, 0x2, 0x2, 0x2, 
-    0x47, 0x16a, 0x3, 0x2, 0x2, 0x2, 0x49, 0x16c, 0x3, 0x2, 0x2, 0x2, 0x4b, 
-    0x16e, 0x3, 0x2, 0x2, 0x2, 0x4d, 0x170, 0x3, 0x2, 0x2, 0x2, 0x4f, 0x172, 
-    0x3, 0x2, 0x2, 0x2, 0x51, 0x174, 0x3, 0x2, 0x2, 0x2, 0x53, 0x176, 0x3, 
-    0x2, 0x2, 0x2, 0x55, 0x178, 0x3, 0x2, 0x2, 0x2, 0x57, 0x17a, 0x3, 0x2, 
-    0x2, 0x2, 0x59, 0x17c, 0x3, 0x2, 0x2, 0x2, 0x5b, 0x17e, 0x3, 0x2, 0x2, 
-    0x2, 0x5d, 0x180, 0x3, 0x2, 0x2, 0x2, 0x5f, 0x182, 0x3, 0x2, 0x2, 0x2, 
-    0x61, 0x187, 0x3, 0x2, 0x2, 0x2, 0x63, 0x18c, 0x3, 0x2, 0x2, 0x2, 0x65, 
-    0x191, 0x3, 0x2, 0x2, 0x2, 0x67, 0x196, 0x3, 0x2, 0x2, 0x2, 0x69, 0x19c, 
-    0x3, 0x2, 0x2, 0x2, 0x6b, 0x1a1, 0x3, 0x2, 0x2, 0x2, 0x6d, 0x1a7, 0x3, 
-    0x2, 0x2, 0x2, 0x6f, 0x1af, 0x3, 0x2, 0x2, 0x2, 0x71, 0x1b6, 0x3, 0x2, 
-    0x2, 0x2, 0x73, 0x1ba, 0x3, 0x2, 0x2, 0x2, 0x75, 0x1c2, 0x3, 0x2, 0x2, 
-    0x2, 0x77, 0x1c6, 0x3, 0x2, 0x2, 0x2, 0x79, 0x1ca, 0x3, 0x2, 0x2, 0x2, 
-    0x7b, 0x1cd, 0x3, 0x2, 0x2, 0x2, 0x7d, 0x1d5, 0x3, 0x2, 0x2, 0x2, 0x7f, 
-    0x1dd, 0x3, 0x2, 0x2, 0x2, 0x81, 0x1e3, 0x3, 0x2, 0x2, 0x2, 0x83, 0x1e7, 
-    0x3, 0x2, 0x2, 0x2, 0x85, 0x1f0, 0x3, 0x2, 0x2, 0x2, 0x87, 0x1f6, 0x3, 
-    0x2, 0x2, 0x2, 0x89, 0x1fd, 0x3, 0x2, 0x2, 0x2, 0x8b, 0x204, 0x3, 0x2, 
-    0x2, 0x2, 0x8d, 0x208, 0x3, 0x2, 0x2, 0x2, 0x8f, 0x20f, 0x3, 0x2, 0x2, 
-    0x2, 0x91, 0x214, 0x3, 0x2, 0x2, 0x2, 0x93, 0x21b, 0x3, 0x2, 0x2, 0x2, 
-    0x95, 0x224, 0x3, 0x2, 0x2, 0x2, 0x97, 0x226, 0x3, 0x2, 0x2, 0x2, 0x99, 
-    0x229, 0x3, 0x2, 0x2, 0x2, 0x9b, 0x22f, 0x3, 0x2, 0x2, 0x2, 0x9d, 0x232, 
-    0x3, 0x2, 0x2, 0x2, 0x9f, 0x237, 0x3, 0x2, 0x2, 0x2, 0xa1, 0x23d, 0x3, 
-    0x2, 0x2, 0x2, 0xa3, 0x247, 0x3, 0x2, 0x2, 0x2, 0xa5, 0x24b, 0x3, 0x2, 
-    0x2, 0x2, 0xa7, 0x256, 0x3, 0x2, 0x2, 0x2, 0xa9, 0x25b, 0x3, 0x2, 0x2, 
-    0x2, 0xab, 0x261, 0x3, 0x2, 0x2, 0x2, 0xad, 0x264, 0x3, 0x2, 0x2, 0x2, 
-    0xaf, 0x268, 0x3, 0x2, 0x2, 0x2, 0xb1, 0x26c, 0x3, 0x2, 0x2, 0x2, 0xb3, 
-    0x270, 0x3, 0x2, 0x2, 0x2, 0xb5, 0x273, 0x3, 0x2, 0x2, 0x2, 0xb7, 0x275, 
-    0x3, 0x2, 0x2, 0x2, 0xb9, 0x277, 0x3, 0x2, 0x2, 0x2, 0xbb, 0x27e, 0x3, 
-    0x2, 0x2, 0x2, 0xbd, 0x283, 0x3, 0x2, 0x2, 0x2, 0xbf, 0x28c, 0x3, 0x2, 
-    0x2, 0x2, 0xc1, 0x28f, 0x3, 0x2, 0x2, 0x2, 0xc3, 0x294, 0x3, 0x2, 0x2, 
-    0x2, 0xc5, 0x299, 0x3, 0x2, 0x2, 0x2, 0xc7, 0x29f, 0x3, 0x2, 0x2, 0x2, 
-    0xc9, 0x2a6, 0x3, 0x2, 0x2, 0x2, 0xcb, 0x2ab, 0x3, 0x2, 0x2, 0x2, 0xcd, 
-    0x2b0, 0x3, 0x2, 0x2, 0x2, 0xcf, 0x2b4, 0x3, 0x2, 0x2, 0x2, 0xd1, 0x2b9, 
-    0x3, 0x2, 0x2, 0x2, 0xd3, 0x2d0, 0x3, 0x2, 0x2, 0x2, 0xd5, 0x2d2, 0x3, 
-    0x2, 0x2, 0x2, 0xd7, 0x2ee, 0x3, 0x2, 0x2, 0x2, 0xd9, 0x2f1, 0x3, 0x2, 
-    0x2, 0x2, 0xdb, 0x2f5, 0x3, 0x2, 0x2, 0x2, 0xdd, 0x2f9, 0x3, 0x2, 0x2, 
-    0x2, 0xdf, 0x2fd, 0x3, 0x2, 0x2, 0x2, 0xe1, 0x2ff, 0x3, 0x2, 0x2, 0x2, 
-    0xe3, 0x301, 0x3, 0x2, 0x2, 0x2, 0xe5, 0x306, 0x3, 0x2, 0x2, 0x2, 0xe7, 
-    0x30f, 0x3, 0x2, 0x2, 0x2, 0xe9, 0x318, 0x3, 0x2, 0x2, 0x2, 0xeb, 0x31c, 
-    0x3, 0x2, 0x2, 0x2, 0xed, 0x326, 0x3, 0x2, 0x2, 0x2, 0xef, 0x32b, 0x3, 
-    0x2, 0x2, 0x2, 0xf1, 0x33b, 0x3, 0x2, 0x2, 0x2, 0xf3, 0x35a, 0x3, 0x2, 
-    0x2, 0x2, 0xf5, 0x35c, 0x3, 0x2, 0x2, 0x2, 0xf7, 0x35e, 0x3, 0x2, 0x2, 
-    0x2, 0xf9, 0x360, 0x3, 0x2, 0x2, 0x2, 0xfb, 0x362, 0x3, 0x2, 0x2, 0x2, 
-    0xfd, 0x364, 0x3, 0x2, 0x2, 0x2, 0xff, 0x366, 0x3, 0x2, 0x2, 0x2, 0x101, 
-    0x368, 0x3, 0x2, 0x2, 0x2, 0x103, 0x36a, 0x3, 0x2, 0x2, 0x2, 0x105, 
-    0x36c, 0x3, 0x2, 0x2, 0x2, 0x107, 0x36e, 0x3, 0x2, 0x2, 0x2, 0x109, 
-    0x370, 0x3, 0x2, 0x2, 0x2, 0x10b, 0x372, 0x3, 0x2, 0x2, 0x2, 0x10d, 
-    0x374, 0x3, 0x2, 0x2, 0x2, 0x10f, 0x376, 0x3, 0x2, 0x2, 0x2, 0x111, 
-    0x378, 0x3, 0x2, 0x2, 0x2, 0x113, 0x37a, 0x3, 0x2, 0x2, 0x2, 0x115, 
-    0x37c, 0x3, 0x2, 0x2, 0x2, 0x117, 0x37e, 0x3, 0x2, 0x2, 0x2, 0x119, 
-    0x380, 0x3, 0x2, 0x2, 0x2, 0x11b, 0x382, 0x3, 0x2, 0x2, 0x2, 0x11d, 
-    0x384, 0x3, 0x2, 0x2, 0x2, 0x11f, 0x120, 0x7, 0x3d, 0x2, 0x2, 0x120, 
-    0x4, 0x3, 0x2, 0x2, 0x2, 0x121, 0x122, 0x7, 0x2a, 0x2, 0x2, 0x122, 0x6, 
-    0x3, 0x2, 0x2, 0x2, 0x123, 0x124, 0x7, 0x2b, 0x2, 0x2, 0x124, 0x8, 0x3, 
-    0x2, 0x2, 0x2, 0x125, 0x126, 0x7, 0x5d, 0x2, 0x2, 0x126, 0xa, 0x3, 0x2, 
-    0x2, 0x2, 0x127, 0x128, 0x7, 0x2e, 0x2, 0x2, 0x128, 0xc, 0x3, 0x2, 0x2, 
-    0x2, 0x129, 0x12a, 0x7, 0x5f, 0x2, 0x2, 0x12a, 0xe, 0x3, 0x2, 0x2, 0x2, 
-    0x12b, 0x12c, 0x7, 0x3f, 0x2, 0x2, 0x12c, 0x10, 0x3, 0x2, 0x2, 0x2, 
-    0x12d, 0x12e, 0x7, 0x7d, 0x2, 0x2, 0x12e, 0x12, 0x3, 0x2, 0x2, 0x2, 
-    0x12f, 0x130, 0x7, 0x3c, 0x2, 0x2, 0x130, 0x14, 0x3, 0x2, 0x2, 0x2, 
-    0x131, 0x132, 0x7, 0x7f, 0x2, 0x2, 0x132, 0x16, 0x3, 0x2, 0x2, 0x2, 
-    0x133, 0x134, 0x7, 0x7e, 0x2, 0x2, 0x134, 0x18, 0x3, 0x2, 0x2, 0x2, 
-    0x135, 0x136, 0x7, 0x30, 0x2, 0x2, 0x136, 0x137, 0x7, 0x30, 0x2, 0x2, 
-    0x137, 0x1a, 0x3, 0x2, 0x2, 0x2, 0x138, 0x139, 0x7, 0x3e, 0x2, 0x2, 
-    0x139, 0x13a, 0x7, 0x40, 0x2, 0x2, 0x13a, 0x1c, 0x3, 0x2, 0x2, 0x2, 
-    0x13b, 0x13c, 0x7, 0x3e, 0x2, 0x2, 0x13c, 0x1e, 0x3, 0x2, 0x2, 0x2, 
-    0x13d, 0x13e, 0x7, 0x3e, 0x2, 0x2, 0x13e, 0x13f, 0x7, 0x3f, 0x2, 0x2, 
-    0x13f, 0x20, 0x3, 0x2, 0x2, 0x2, 0x140, 0x141, 0x7, 0x40, 0x2, 0x2, 
-    0x141, 0x22, 0x3, 0x2, 0x2, 0x2, 0x142, 0x143, 0x7, 0x40, 0x2, 0x2, 
-    0x143, 0x144, 0x7, 0x3f, 0x2, 0x2, 0x144, 0x24, 0x3, 0x2, 0x2, 0x2, 
-    0x145, 0x146, 0x7, 0x28, 0x2, 0x2, 0x146, 0x26, 0x3, 0x2, 0x2, 0x2, 
-    0x147, 0x148, 0x7, 0x40, 0x2, 0x2, 0x148, 0x149, 0x7, 0x40, 0x2, 0x2, 
-    0x149, 0x28, 0x3, 0x2, 0x2, 0x2, 0x14a, 0x14b, 0x7, 0x3e, 0x2, 0x2, 
-    0x14b, 0x14c, 0x7, 0x3e, 0x2, 0x2, 0x14c, 0x2a, 0x3, 0x2, 0x2, 0x2, 
-    0x14d, 0x14e, 0x7, 0x2d, 0x2, 0x2, 0x14e, 0x2c, 0x3, 0x2, 0x2, 0x2, 
-    0x14f, 0x150, 0x7, 0x31, 0x2, 0x2, 0x150, 0x2e, 0x3, 0x2, 0x2, 0x2, 
-    0x151, 0x152, 0x7, 0x27, 0x2, 0x2, 0x152, 0x30, 0x3, 0x2, 0x2, 0x2, 
-    0x153, 0x154, 0x7, 0x60, 0x2, 0x2, 0x154, 0x32, 0x3, 0x2, 0x2, 0x2, 
-    0x155, 0x156, 0x7, 0x3f, 0x2, 0x2, 0x156, 0x157, 0x7, 0x80, 0x2, 0x2, 
-    0x157, 0x34, 0x3, 0x2, 0x2, 0x2, 0x158, 0x159, 0x7, 0x30, 0x2, 0x2, 
-    0x159, 0x36, 0x3, 0x2, 0x2, 0x2, 0x15a, 0x15b, 0x7, 0x26, 0x2, 0x2, 
-    0x15b, 0x38, 0x3, 0x2, 0x2, 0x2, 0x15c, 0x15d, 0x7, 0x27ea, 0x2, 0x2, 
-    0x15d, 0x3a, 0x3, 0x2, 0x2, 0x2, 0x15e, 0x15f, 0x7, 0x300a, 0x2, 0x2, 
-    0x15f, 0x3c, 0x3, 0x2, 0x2, 0x2, 0x160, 0x161, 0x7, 0xfe66, 0x2, 0x2, 
-    0x161, 0x3e, 0x3, 0x2, 0x2, 0x2, 0x162, 0x163, 0x7, 0xff1e, 0x2, 0x2, 
-    0x163, 0x40, 0x3, 0x2, 0x2, 0x2, 0x164, 0x165, 0x7, 0x27eb, 0x2, 0x2, 
-    0x165, 0x42, 0x3, 0x2, 0x2, 0x2, 0x166, 0x167, 0x7, 0x300b, 0x2, 0x2, 
-    0x167, 0x44, 0x3, 0x2, 0x2, 0x2, 0x168, 0x169, 0x7, 0xfe67, 0x2, 0x2, 
-    0x169, 0x46, 0x3, 0x2, 0x2, 0x2, 0x16a, 0x16b, 0x7, 0xff20, 0x2, 0x2, 
-    0x16b, 0x48, 0x3, 0x2, 0x2, 0x2, 0x16c, 0x16d, 0x7, 0xaf, 0x2, 0x2, 
-    0x16d, 0x4a, 0x3, 0x2, 0x2, 0x2, 0x16e, 0x16f, 0x7, 0x2012, 0x2, 0x2, 
-    0x16f, 0x4c, 0x3, 0x2, 0x2, 0x2, 0x170, 0x171, 0x7, 0x2013, 0x2, 0x2, 
-    0x171, 0x4e, 0x3, 0x2, 0x2, 0x2, 0x172, 0x173, 0x7, 0x2014, 0x2, 0x2, 
-    0x173, 0x50, 0x3, 0x2, 0x2, 0x2, 0x174, 0x175, 0x7, 0x2015, 0x2, 0x2, 
-    0x175, 0x52, 0x3, 0x2, 0x2, 0x2, 0x176, 0x177, 0x7, 0x2016, 0x2, 0x2, 
-    0x177, 0x54, 0x3, 0x2, 0x2, 0x2, 0x178, 0x179, 0x7, 0x2017, 0x2, 0x2, 
-    0x179, 0x56, 0x3, 0x2, 0x2, 0x2, 0x17a, 0x17b, 0x7, 0x2214, 0x2, 0x2, 
-    0x17b, 0x58, 0x3, 0x2, 0x2, 0x2, 0x17c, 0x17d, 0x7, 0xfe5a, 0x2, 0x2, 
-    0x17d, 0x5a, 0x3, 0x2, 0x2, 0x2, 0x17e, 0x17f, 0x7, 0xfe65, 0x2, 0x2, 
-    0x17f, 0x5c, 0x3, 0x2, 0x2, 0x2, 0x180, 0x181, 0x7, 0xff0f, 0x2, 0x2, 
-    0x181, 0x5e, 0x3, 0x2, 0x2, 0x2, 0x182, 0x183, 0x9, 0x2, 0x2, 0x2, 0x183, 
-    0x184, 0x9, 0x3, 0x2, 0x2, 0x184, 0x185, 0x9, 0x4, 0x2, 0x2, 0x185, 
-    0x186, 0x9, 0x5, 0x2, 0x2, 0x186, 0x60, 0x3, 0x2, 0x2, 0x2, 0x187, 0x188, 
-    0x9, 0x6, 0x2, 0x2, 0x188, 0x189, 0x9, 0x4, 0x2, 0x2, 0x189, 0x18a, 
-    0x9, 0x7, 0x2, 0x2, 0x18a, 0x18b, 0x9, 0x8, 0x2, 0x2, 0x18b, 0x62, 0x3, 
-    0x2, 0x2, 0x2, 0x18c, 0x18d, 0x9, 0x9, 0x2, 0x2, 0x18d, 0x18e, 0x9, 
-    0xa, 0x2, 0x2, 0x18e, 0x18f, 0x9, 0x4, 0x2, 0x2, 0x18f, 0x190, 0x9, 
-    0xb, 0x2, 0x2, 0x190, 0x64, 0x3, 0x2, 0x2, 0x2, 0x191, 0x192, 0x9, 0xc, 
-    0x2, 0x2, 0x192, 0x193, 0x9, 0x4, 0x2, 0x2, 0x193, 0x194, 0x9, 0xd, 
-    0x2, 0x2, 0x194, 0x195, 0x9, 0xe, 0x2, 0x2, 0x195, 0x66, 0x3, 0x2, 0x2, 
-    0x2, 0x196, 0x197, 0x9, 0xf, 0x2, 0x2, 0x197, 0x198, 0x9, 0x10, 0x2, 
-    0x2, 0x198, 0x199, 0x9, 0x5, 0x2, 0x2, 0x199, 0x19a, 0x9, 0x3, 0x2, 
-    0x2, 0x19a, 0x19b, 0x9, 0xe, 0x2, 0x2, 0x19b, 0x68, 0x3, 0x2, 0x2, 0x2, 
-    0x19c, 0x19d, 0x9, 0xd, 0x2, 0x2, 0x19d, 0x19e, 0x9, 0xa, 0x2, 0x2, 
-    0x19e, 0x19f, 0x9, 0x4, 0x2, 0x2, 0x19f, 0x1a0, 0x9, 0x7, 0x2, 0x2, 
-    0x1a0, 0x6a, 0x3, 0x2, 0x2, 0x2, 0x1a1, 0x1a2, 0x9, 0x10, 0x2, 0x2, 
-    0x1a2, 0x1a3, 0x9, 0x3, 0x2, 0x2, 0x1a3, 0x1a4, 0x9, 0xf, 0x2, 0x2, 
+    0x2, 0x2, 0x2, 0xd1, 0x3, 0x2, 0x2, 0x2, 0x2, 0x386, 0x3, 0x2, 0x2, 0x2, 
+    0x2, 0x38e, 0x3, 0x2, 0x2, 0x2, 0x2, 0xd3, 0x3, 0x2, 0x2, 0x2, 0x2, 0xd5, 
+    0x3, 0x2, 0x2, 0x2, 0x2, 0xd7, 0x3, 0x2, 0x2, 0x2, 0x2, 0xd9, 0x3, 0x2, 
+    0x2, 0x2, 0x2, 0xdb, 0x3, 0x2, 0x2, 0x2, 0x2, 0xdd, 0x3, 0x2, 0x2, 0x2, 
+    0x2, 0xdf, 0x3, 0x2, 0x2, 0x2, 0x2, 0xe1, 0x3, 0x2, 0x2, 0x2, 0x2, 0xe3, 
+    0x3, 0x2, 0x2, 0x2, 0x2, 0xe5, 0x3, 0x2, 0x2, 0x2, 0x2, 0xe7, 0x3, 0x2, 
+    0x2, 0x2, 0x2, 0xe9, 0x3, 0x2, 0x2, 0x2, 0x2, 0xeb, 0x3, 0x2, 0x2, 0x2, 
+    0x2, 0xed, 0x3, 0x2, 0x2, 0x2, 0x2, 0xef, 0x3, 0x2, 0x2, 0x2, 0x2, 0xf1, 
+    0x3, 0x2, 0x2, 0x2, 0x2, 0xf3, 0x3, 0x2, 0x2, 0x2, 0x2, 0x11d, 0x3, 0x2, 
+    0x2, 0x2, 0x3, 0x11f, 0x3, 0x2, 0x2, 0x2, 0x5, 0x121, 0x3, 0x2, 0x2, 0x2, 
+    0x7, 0x123, 0x3, 0x2, 0x2, 0x2, 0x9, 0x125, 0x3, 0x2, 0x2, 0x2, 0xb, 
+    0x127, 0x3, 0x2, 0x2, 0x2, 0xd, 0x129, 0x3, 0x2, 0x2, 0x2, 0xf, 0x12b, 
+    0x3, 0x2, 0x2, 0x2, 0x11, 0x12d, 0x3, 0x2, 0x2, 0x2, 0x13, 0x12f, 0x3, 
+    0x2, 0x2, 0x2, 0x15, 0x131, 0x3, 0x2, 0x2, 0x2, 0x17, 0x133, 0x3, 0x2, 
+    0x2, 0x2, 0x19, 0x135, 0x3, 0x2, 0x2, 0x2, 0x1b, 0x138, 0x3, 0x2, 0x2, 
+    0x2, 0x1d, 0x13b, 0x3, 0x2, 0x2, 0x2, 0x1f, 0x13d, 0x3, 0x2, 0x2, 0x2, 
+    0x21, 0x140, 0x3, 0x2, 0x2, 0x2, 0x23, 0x142, 0x3, 0x2, 0x2, 0x2, 0x25, 
+    0x145, 0x3, 0x2, 0x2, 0x2, 0x27, 0x147, 0x3, 0x2, 0x2, 0x2, 0x29, 0x14a, 
+    0x3, 0x2, 0x2, 0x2, 0x2b, 0x14d, 0x3, 0x2, 0x2, 0x2, 0x2d, 0x14f, 0x3, 
+    0x2, 0x2, 0x2, 0x2f, 0x151, 0x3, 0x2, 0x2, 0x2, 0x31, 0x153, 0x3, 0x2, 
+    0x2, 0x2, 0x33, 0x155, 0x3, 0x2, 0x2, 0x2, 0x35, 0x158, 0x3, 0x2, 0x2, 
+    0x2, 0x37, 0x15a, 0x3, 0x2, 0x2, 0x2, 0x39, 0x15c, 0x3, 0x2, 0x2, 0x2, 
+    0x3b, 0x15e, 0x3, 0x2, 0x2, 0x2, 0x3d, 0x160, 0x3, 0x2, 0x2, 0x2, 0x3f, 
+    0x162, 0x3, 0x2, 0x2, 0x2, 0x41, 0x164, 0x3, 0x2, 0x2, 0x2, 0x43, 0x166, 
+    0x3, 0x2, 0x2, 0x2, 0x45, 0x168, 0x3, 0x2, 0x2, 0x2, 0x47, 0x16a, 0x3, 
+    0x2, 0x2, 0x2, 0x49, 0x16c, 0x3, 0x2, 0x2, 0x2, 0x4b, 0x16e, 0x3, 0x2, 
+    0x2, 0x2, 0x4d, 0x170, 0x3, 0x2, 0x2, 0x2, 0x4f, 0x172, 0x3, 0x2, 0x2, 
+    0x2, 0x51, 0x174, 0x3, 0x2, 0x2, 0x2, 0x53, 0x176, 0x3, 0x2, 0x2, 0x2, 
+    0x55, 0x178, 0x3, 0x2, 0x2, 0x2, 0x57, 0x17a, 0x3, 0x2, 0x2, 0x2, 0x59, 
+    0x17c, 0x3, 0x2, 0x2, 0x2, 0x5b, 0x17e, 0x3, 0x2, 0x2, 0x2, 0x5d, 0x180, 
+    0x3, 0x2, 0x2, 0x2, 0x5f, 0x182, 0x3, 0x2, 0x2, 0x2, 0x61, 0x187, 0x3, 
+    0x2, 0x2, 0x2, 0x63, 0x18c, 0x3, 0x2, 0x2, 0x2, 0x65, 0x191, 0x3, 0x2, 
+    0x2, 0x2, 0x67, 0x196, 0x3, 0x2, 0x2, 0x2, 0x69, 0x19c, 0x3, 0x2, 0x2, 
+    0x2, 0x6b, 0x1a1, 0x3, 0x2, 0x2, 0x2, 0x6d, 0x1a7, 0x3, 0x2, 0x2, 0x2, 
+    0x6f, 0x1af, 0x3, 0x2, 0x2, 0x2, 0x71, 0x1b6, 0x3, 0x2, 0x2, 0x2, 0x73, 
+    0x1ba, 0x3, 0x2, 0x2, 0x2, 0x75, 0x1c2, 0x3, 0x2, 0x2, 0x2, 0x77, 0x1c6, 
+    0x3, 0x2, 0x2, 0x2, 0x79, 0x1ca, 0x3, 0x2, 0x2, 0x2, 0x7b, 0x1cd, 0x3, 
+    0x2, 0x2, 0x2, 0x7d, 0x1d5, 0x3, 0x2, 0x2, 0x2, 0x7f, 0x1dd, 0x3, 0x2, 
+    0x2, 0x2, 0x81, 0x1e3, 0x3, 0x2, 0x2, 0x2, 0x83, 0x1e7, 0x3, 0x2, 0x2, 
+    0x2, 0x85, 0x1f0, 0x3, 0x2, 0x2, 0x2, 0x87, 0x1f6, 0x3, 0x2, 0x2, 0x2, 
+    0x89, 0x1fd, 0x3, 0x2, 0x2, 0x2, 0x8b, 0x204, 0x3, 0x2, 0x2, 0x2, 0x8d, 
+    0x208, 0x3, 0x2, 0x2, 0x2, 0x8f, 0x20f, 0x3, 0x2, 0x2, 0x2, 0x91, 0x214, 
+    0x3, 0x2, 0x2, 0x2, 0x93, 0x21b, 0x3, 0x2, 0x2, 0x2, 0x95, 0x224, 0x3, 
+    0x2, 0x2, 0x2, 0x97, 0x226, 0x3, 0x2, 0x2, 0x2, 0x99, 0x229, 0x3, 0x2, 
+    0x2, 0x2, 0x9b, 0x22f, 0x3, 0x2, 0x2, 0x2, 0x9d, 0x232, 0x3, 0x2, 0x2, 
+    0x2, 0x9f, 0x237, 0x3, 0x2, 0x2, 0x2, 0xa1, 0x23d, 0x3, 0x2, 0x2, 0x2, 
+    0xa3, 0x247, 0x3, 0x2, 0x2, 0x2, 0xa5, 0x24b, 0x3, 0x2, 0x2, 0x2, 0xa7, 
+    0x256, 0x3, 0x2, 0x2, 0x2, 0xa9, 0x25b, 0x3, 0x2, 0x2, 0x2, 0xab, 0x261, 
+    0x3, 0x2, 0x2, 0x2, 0xad, 0x264, 0x3, 0x2, 0x2, 0x2, 0xaf, 0x268, 0x3, 
+    0x2, 0x2, 0x2, 0xb1, 0x26c, 0x3, 0x2, 0x2, 0x2, 0xb3, 0x270, 0x3, 0x2, 
+    0x2, 0x2, 0xb5, 0x273, 0x3, 0x2, 0x2, 0x2, 0xb7, 0x275, 0x3, 0x2, 0x2, 
+    0x2, 0xb9, 0x277, 0x3, 0x2, 0x2, 0x2, 0xbb, 0x27e, 0x3, 0x2, 0x2, 0x2, 
+    0xbd, 0x283, 0x3, 0x2, 0x2, 0x2, 0xbf, 0x28c, 0x3, 0x2, 0x2, 0x2, 0xc1, 
+    0x28f, 0x3, 0x2, 0x2, 0x2, 0xc3, 0x294, 0x3, 0x2, 0x2, 0x2, 0xc5, 0x299, 
+    0x3, 0x2, 0x2, 0x2, 0xc7, 0x29f, 0x3, 0x2, 0x2, 0x2, 0xc9, 0x2a6, 0x3, 
+    0x2, 0x2, 0x2, 0xcb, 0x2ab, 0x3, 0x2, 0x2, 0x2, 0xcd, 0x2b0, 0x3, 0x2, 
+    0x2, 0x2, 0xcf, 0x2b4, 0x3, 0x2, 0x2, 0x2, 0xd1, 0x2b9, 0x3, 0x2, 0x2, 
+    0x2, 0xd3, 0x2d0, 0x3, 0x2, 0x2, 0x2, 0xd5, 0x2d2, 0x3, 0x2, 0x2, 0x2, 
+    0xd7, 0x2ee, 0x3, 0x2, 0x2, 0x2, 0xd9, 0x2f1, 0x3, 0x2, 0x2, 0x2, 0xdb, 
+    0x2f5, 0x3, 0x2, 0x2, 0x2, 0xdd, 0x2f9, 0x3, 0x2, 0x2, 0x2, 0xdf, 0x2fd, 
+    0x3, 0x2, 0x2, 0x2, 0xe1, 0x2ff, 0x3, 0x2, 0x2, 0x2, 0xe3, 0x301, 0x3, 
+    0x2, 0x2, 0x2, 0xe5, 0x306, 0x3, 0x2, 0x2, 0x2, 0xe7, 0x30f, 0x3, 0x2, 
+    0x2, 0x2, 0xe9, 0x318, 0x3, 0x2, 0x2, 0x2, 0xeb, 0x31c, 0x3, 0x2, 0x2, 
+    0x2, 0xed, 0x326, 0x3, 0x2, 0x2, 0x2, 0xef, 0x32b, 0x3, 0x2, 0x2, 0x2, 
+    0xf1, 0x33b, 0x3, 0x2, 0x2, 0x2, 0xf3, 0x35a, 0x3, 0x2, 0x2, 0x2, 0xf5, 
+    0x35c, 0x3, 0x2, 0x2, 0x2, 0xf7, 0x35e, 0x3, 0x2, 0x2, 0x2, 0xf9, 0x360, 
+    0x3, 0x2, 0x2, 0x2, 0xfb, 0x362, 0x3, 0x2, 0x2, 0x2, 0xfd, 0x364, 0x3, 
+    0x2, 0x2, 0x2, 0xff, 0x366, 0x3, 0x2, 0x2, 0x2, 0x101, 0x368, 0x3, 0x2, 
+    0x2, 0x2, 0x103, 0x36a, 0x3, 0x2, 0x2, 0x2, 0x105, 0x36c, 0x3, 0x2, 0x2, 
+    0x2, 0x107, 0x36e, 0x3, 0x2, 0x2, 0x2, 0x109, 0x370, 0x3, 0x2, 0x2, 0x2, 
+    0x10b, 0x372, 0x3, 0x2, 0x2, 0x2, 0x10d, 0x374, 0x3, 0x2, 0x2, 0x2, 
+    0x10f, 0x376, 0x3, 0x2, 0x2, 0x2, 0x111, 0x378, 0x3, 0x2, 0x2, 0x2, 
+    0x113, 0x37a, 0x3, 0x2, 0x2, 0x2, 0x115, 0x37c, 0x3, 0x2, 0x2, 0x2, 
+    0x117, 0x37e, 0x3, 0x2, 0x2, 0x2, 0x119, 0x380, 0x3, 0x2, 0x2, 0x2, 
+    0x11b, 0x382, 0x3, 0x2, 0x2, 0x2, 0x11d, 0x384, 0x3, 0x2, 0x2, 0x2, 
+    0x11f, 0x120, 0x7, 0x3d, 0x2, 0x2, 0x120, 0x4, 0x3, 0x2, 0x2, 0x2, 0x121, 
+    0x122, 0x7, 0x2a, 0x2, 0x2, 0x122, 0x6, 0x3, 0x2, 0x2, 0x2, 0x123, 0x124, 
+    0x7, 0x2b, 0x2, 0x2, 0x124, 0x8, 0x3, 0x2, 0x2, 0x2, 0x125, 0x126, 0x7, 
+    0x5d, 0x2, 0x2, 0x126, 0xa, 0x3, 0x2, 0x2, 0x2, 0x127, 0x128, 0x7, 0x2e, 
+    0x2, 0x2, 0x128, 0xc, 0x3, 0x2, 0x2, 0x2, 0x129, 0x12a, 0x7, 0x5f, 0x2, 
+    0x2, 0x12a, 0xe, 0x3, 0x2, 0x2, 0x2, 0x12b, 0x12c, 0x7, 0x3f, 0x2, 0x2, 
+    0x12c, 0x10, 0x3, 0x2, 0x2, 0x2, 0x12d, 0x12e, 0x7, 0x7d, 0x2, 0x2, 
+    0x12e, 0x12, 0x3, 0x2, 0x2, 0x2, 0x12f, 0x130, 0x7, 0x3c, 0x2, 0x2, 
+    0x130, 0x14, 0x3, 0x2, 0x2, 0x2, 0x131, 0x132, 0x7, 0x7f, 0x2, 0x2, 
+    0x132, 0x16, 0x3, 0x2, 0x2, 0x2, 0x133, 0x134, 0x7, 0x7e, 0x2, 0x2, 
+    0x134, 0x18, 0x3, 0x2, 0x2, 0x2, 0x135, 0x136, 0x7, 0x30, 0x2, 0x2, 
+    0x136, 0x137, 0x7, 0x30, 0x2, 0x2, 0x137, 0x1a, 0x3, 0x2, 0x2, 0x2, 
+    0x138, 0x139, 0x7, 0x3e, 0x2, 0x2, 0x139, 0x13a, 0x7, 0x40, 0x2, 0x2, 
+    0x13a, 0x1c, 0x3, 0x2, 0x2, 0x2, 0x13b, 0x13c, 0x7, 0x3e, 0x2, 0x2, 
+    0x13c, 0x1e, 0x3, 0x2, 0x2, 0x2, 0x13d, 0x13e, 0x7, 0x3e, 0x2, 0x2, 
+    0x13e, 0x13f, 0x7, 0x3f, 0x2, 0x2, 0x13f, 0x20, 0x3, 0x2, 0x2, 0x2, 
+    0x140, 0x141, 0x7, 0x40, 0x2, 0x2, 0x141, 0x22, 0x3, 0x2, 0x2, 0x2, 
+    0x142, 0x143, 0x7, 0x40, 0x2, 0x2, 0x143, 0x144, 0x7, 0x3f, 0x2, 0x2, 
+    0x144, 0x24, 0x3, 0x2, 0x2, 0x2, 0x145, 0x146, 0x7, 0x28, 0x2, 0x2, 
+    0x146, 0x26, 0x3, 0x2, 0x2, 0x2, 0x147, 0x148, 0x7, 0x40, 0x2, 0x2, 
+    0x148, 0x149, 0x7, 0x40, 0x2, 0x2, 0x149, 0x28, 0x3, 0x2, 0x2, 0x2, 
+    0x14a, 0x14b, 0x7, 0x3e, 0x2, 0x2, 0x14b, 0x14c, 0x7, 0x3e, 0x2, 0x2, 
+    0x14c, 0x2a, 0x3, 0x2, 0x2, 0x2, 0x14d, 0x14e, 0x7, 0x2d, 0x2, 0x2, 
+    0x14e, 0x2c, 0x3, 0x2, 0x2, 0x2, 0x14f, 0x150, 0x7, 0x31, 0x2, 0x2, 
+    0x150, 0x2e, 0x3, 0x2, 0x2, 0x2, 0x151, 0x152, 0x7, 0x27, 0x2, 0x2, 
+    0x152, 0x30, 0x3, 0x2, 0x2, 0x2, 0x153, 0x154, 0x7, 0x60, 0x2, 0x2, 
+    0x154, 0x32, 0x3, 0x2, 0x2, 0x2, 0x155, 0x156, 0x7, 0x3f, 0x2, 0x2, 
+    0x156, 0x157, 0x7, 0x80, 0x2, 0x2, 0x157, 0x34, 0x3, 0x2, 0x2, 0x2, 
+    0x158, 0x159, 0x7, 0x30, 0x2, 0x2, 0x159, 0x36, 0x3, 0x2, 0x2, 0x2, 
+    0x15a, 0x15b, 0x7, 0x26, 0x2, 0x2, 0x15b, 0x38, 0x3, 0x2, 0x2, 0x2, 
+    0x15c, 0x15d, 0x7, 0x27ea, 0x2, 0x2, 0x15d, 0x3a, 0x3, 0x2, 0x2, 0x2, 
+    0x15e, 0x15f, 0x7, 0x300a, 0x2, 0x2, 0x15f, 0x3c, 0x3, 0x2, 0x2, 0x2, 
+    0x160, 0x161, 0x7, 0xfe66, 0x2, 0x2, 0x161, 0x3e, 0x3, 0x2, 0x2, 0x2, 
+    0x162, 0x163, 0x7, 0xff1e, 0x2, 0x2, 0x163, 0x40, 0x3, 0x2, 0x2, 0x2, 
+    0x164, 0x165, 0x7, 0x27eb, 0x2, 0x2, 0x165, 0x42, 0x3, 0x2, 0x2, 0x2, 
+    0x166, 0x167, 0x7, 0x300b, 0x2, 0x2, 0x167, 0x44, 0x3, 0x2, 0x2, 0x2, 
+    0x168, 0x169, 0x7, 0xfe67, 0x2, 0x2, 0x169, 0x46, 0x3, 0x2, 0x2, 0x2, 
+    0x16a, 0x16b, 0x7, 0xff20, 0x2, 0x2, 0x16b, 0x48, 0x3, 0x2, 0x2, 0x2, 
+    0x16c, 0x16d, 0x7, 0xaf, 0x2, 0x2, 0x16d, 0x4a, 0x3, 0x2, 0x2, 0x2, 
+    0x16e, 0x16f, 0x7, 0x2012, 0x2, 0x2, 0x16f, 0x4c, 0x3, 0x2, 0x2, 0x2, 
+    0x170, 0x171, 0x7, 0x2013, 0x2, 0x2, 0x171, 0x4e, 0x3, 0x2, 0x2, 0x2, 
+    0x172, 0x173, 0x7, 0x2014, 0x2, 0x2, 0x173, 0x50, 0x3, 0x2, 0x2, 0x2, 
+    0x174, 0x175, 0x7, 0x2015, 0x2, 0x2, 0x175, 0x52, 0x3, 0x2, 0x2, 0x2, 
+    0x176, 0x177, 0x7, 0x2016, 0x2, 0x2, 0x177, 0x54, 0x3, 0x2, 0x2, 0x2, 
+    0x178, 0x179, 0x7, 0x2017, 0x2, 0x2, 0x179, 0x56, 0x3, 0x2, 0x2, 0x2, 
+    0x17a, 0x17b, 0x7, 0x2214, 0x2, 0x2, 0x17b, 0x58, 0x3, 0x2, 0x2, 0x2, 
+    0x17c, 0x17d, 0x7, 0xfe5a, 0x2, 0x2, 0x17d, 0x5a, 0x3, 0x2, 0x2, 0x2, 
+    0x17e, 0x17f, 0x7, 0xfe65, 0x2, 0x2, 0x17f, 0x5c, 0x3, 0x2, 0x2, 0x2, 
+    0x180, 0x181, 0x7, 0xff0f, 0x2, 0x2, 0x181, 0x5e, 0x3, 0x2, 0x2, 0x2, 
+    0x182, 0x183, 0x9, 0x2, 0x2, 0x2, 0x183, 0x184, 0x9, 0x3, 0x2, 0x2, 
+    0x184, 0x185, 0x9, 0x4, 0x2, 0x2, 0x185, 0x186, 0x9, 0x5, 0x2, 0x2, 
+    0x186, 0x60, 0x3, 0x2, 0x2, 0x2, 0x187, 0x188, 0x9, 0x6, 0x2, 0x2, 0x188, 
+    0x189, 0x9, 0x4, 0x2, 0x2, 0x189, 0x18a, 0x9, 0x7, 0x2, 0x2, 0x18a, 
+    0x18b, 0x9, 0x8, 0x2, 0x2, 0x18b, 0x62, 0x3, 0x2, 0x2, 0x2, 0x18c, 0x18d, 
+    0x9, 0x9, 0x2, 0x2, 0x18d, 0x18e, 0x9, 0xa, 0x2, 0x2, 0x18e, 0x18f, 0x9, 
+    0x4, 0x2, 0x2, 0x18f, 0x190, 0x9, 0xb, 0x2, 0x2, 0x190, 0x64, 0x3, 0x2, 
+    0x2, 0x2, 0x191, 0x192, 0x9, 0xc, 0x2, 0x2, 0x192, 0x193, 0x9, 0x4, 0x2, 
+    0x2, 0x193, 0x194, 0x9, 0xd, 0x2, 0x2, 0x194, 0x195, 0x9, 0xe, 0x2, 0x2, 
+    0x195, 0x66, 0x3, 0x2, 0x2, 0x2, 0x196, 0x197, 0x9, 0xf, 0x2, 0x2, 0x197, 
+    0x198, 0x9, 0x10, 0x2, 0x2, 0x198, 0x199, 0x9, 0x5, 0x2, 0x2, 0x199, 
+    0x19a, 0x9, 0x3, 0x2, 0x2, 0x19a, 0x19b, 0x9, 0xe, 0x2, 0x2, 0x19b, 0x68, 
+    0x3, 0x2, 0x2, 0x2, 0x19c, 0x19d, 0x9, 0xd, 0x2, 0x2, 0x19d, 0x19e, 0x9, 
+    0xa, 0x2, 0x2, 0x19e, 0x19f, 0x9, 0x4, 0x2, 0x2, 0x19f, 0x1a0, 0x9, 0x7, 
+    0x2, 0x2, 0x1a0, 0x6a, 0x3, 0x2, 0x2, 0x2, 0x1a1, 0x1a2, 0x9, 0x10, 0x2, 
+    0x2, 0x1a2, 0x1a3, 0x9, 0x3, 0x2, 0x2, 0x1a3, 0x1a4, 0x9, 0xf, 0x2, 0x2, 
     0x1a4, 0x1a5, 0x9, 0xe, 0x2, 0x2, 0x1a5, 0x1a6, 0x9, 0xa, 0x2, 0x2, 
     0x1a6, 0x6c, 0x3, 0x2, 0x2, 0x2, 0x1a7, 0x1a8, 0x9, 0xd, 0x2, 0x2, 0x1a8, 
     0x1a9, 0x9, 0xe, 0x2, 0x2, 0x1a9, 0x1aa, 0x9, 0x9, 0x2, 0x2, 0x1aa, 
     0x1ab, 0x9, 0x10, 0x2, 0x2, 0x1ab, 0x1ac, 0x9, 0x11, 0x2, 0x2, 0x1ac, 
-    0x1ad, 0x9, 0x3, 0x2, 0x2, 0x1ad, 0x1ae, 0x9, 0xf, 0x2, 0x2, 0x1ae, 
-    0x6e, 0x3, 0x2, 0x2, 0x2, 0x1af, 0x1b0, 0x9, 0xa, 0x2, 0x2, 0x1b0, 0x1b1, 
-    0x9, 0xe, 0x2, 0x2, 0x1b1, 0x1b2, 0x9, 0xc, 0x2, 0x2, 0x1b2, 0x1b3, 
-    0x9, 0x10, 0x2, 0x2, 0x1b3, 0x1b4, 0x9, 0xb, 0x2, 0x2, 0x1b4, 0x1b5, 
-    0x9, 0xe, 0x2, 0x2, 0x1b5, 0x70, 0x3, 0x2, 0x2, 0x2, 0x1b6, 0x1b7, 0x9, 
-    0x10, 0x2, 0x2, 0x1b7, 0x1b8, 0x9, 0xd, 0x2, 0x2, 0x1b8, 0x1b9, 0x9, 
-    0xd, 0x2, 0x2, 0x1b9, 0x72, 0x3, 0x2, 0x2, 0x2, 0x1ba, 0x1bb, 0x9, 0x7, 
-    0x2, 0x2, 0x1bb, 0x1bc, 0x9, 0xa, 0x2, 0x2, 0x1bc, 0x1bd, 0x9, 0x12, 
-    0x2, 0x2, 0x1bd, 0x1be, 0x9, 0xb, 0x2, 0x2, 0x1be, 0x1bf, 0x9, 0x10, 
-    0x2, 0x2, 0x1bf, 0x1c0, 0x9, 0xa, 0x2, 0x2, 0x1c0, 0x1c1, 0x9, 0x8, 
-    0x2, 0x2, 0x1c1, 0x74, 0x3, 0x2, 0x2, 0x2, 0x1c2, 0x1c3, 0x9, 0x13, 
-    0x2, 0x2, 0x1c3, 0x1c4, 0x9, 0xe, 0x2, 0x2, 0x1c4, 0x1c5, 0x9, 0x8, 
-    0x2, 0x2, 0x1c5, 0x76, 0x3, 0x2, 0x2, 0x2, 0x1c6, 0x1c7, 0x9, 0xa, 0x2, 
-    0x2, 0x1c7, 0x1c8, 0x9, 0xe, 0x2, 0x2, 0x1c8, 0x1c9, 0x9, 0x3, 0x2, 
-    0x2, 0x1c9, 0x78, 0x3, 0x2, 0x2, 0x2, 0x1ca, 0x1cb, 0x9, 0xf, 0x2, 0x2, 
-    0x1cb, 0x1cc, 0x9, 0x4, 0x2, 0x2, 0x1cc, 0x7a, 0x3, 0x2, 0x2, 0x2, 0x1cd, 
-    0x1ce, 0x9, 0xe, 0x2, 0x2, 0x1ce, 0x1cf, 0x9, 0x14, 0x2, 0x2, 0x1cf, 
-    0x1d0, 0x9, 0x7, 0x2, 0x2, 0x1d0, 0x1d1, 0x9, 0x3, 0x2, 0x2, 0x1d1, 
-    0x1d2, 0x9, 0x10, 0x2, 0x2, 0x1d2, 0x1d3, 0x9, 0x12, 0x2, 0x2, 0x1d3, 
-    0x1d4, 0x9, 0xc, 0x2, 0x2, 0x1d4, 0x7c, 0x3, 0x2, 0x2, 0x2, 0x1d5, 0x1d6, 
-    0x9, 0x7, 0x2, 0x2, 0x1d6, 0x1d7, 0x9, 0xa, 0x2, 0x2, 0x1d7, 0x1d8, 
-    0x9, 0x4, 0x2, 0x2, 0x1d8, 0x1d9, 0x9, 0x9, 0x2, 0x2, 0x1d9, 0x1da, 
-    0x9, 0x12, 0x2, 0x2, 0x1da, 0x1db, 0x9, 0x3, 0x2, 0x2, 0x1db, 0x1dc, 
-    0x9, 0xe, 0x2, 0x2, 0x1dc, 0x7e, 0x3, 0x2, 0x2, 0x2, 0x1dd, 0x1de, 0x9, 
-    0x11, 0x2, 0x2, 0x1de, 0x1df, 0x9, 0xc, 0x2, 0x2, 0x1df, 0x1e0, 0x9, 
-    0x12, 0x2, 0x2, 0x1e0, 0x1e1, 0x9, 0x4, 0x2, 0x2, 0x1e1, 0x1e2, 0x9, 
-    0xc, 0x2, 0x2, 0x1e2, 0x80, 0x3, 0x2, 0x2, 0x2, 0x1e3, 0x1e4, 0x9, 0x10, 
-    0x2, 0x2, 0x1e4, 0x1e5, 0x9, 0x3, 0x2, 0x2, 0x1e5, 0x1e6, 0x9, 0x3, 
-    0x2, 0x2, 0x1e6, 0x82, 0x3, 0x2, 0x2, 0x2, 0x1e7, 0x1e8, 0x9, 0x4, 0x2, 
-    0x2, 0x1e8, 0x1e9, 0x9, 0x7, 0x2, 0x2, 0x1e9, 0x1ea, 0x9, 0xf, 0x2, 
-    0x2, 0x1ea, 0x1eb, 0x9, 0x12, 0x2, 0x2, 0x1eb, 0x1ec, 0x9, 0x4, 0x2, 
-    0x2, 0x1ec, 0x1ed, 0x9, 0xc, 0x2, 0x2, 0x1ed, 0x1ee, 0x9, 0x10, 0x2, 
+    0x1ad, 0x9, 0x3, 0x2, 0x2, 0x1ad, 0x1ae, 0x9, 0xf, 0x2, 0x2, 0x1ae, 0x6e, 
+    0x3, 0x2, 0x2, 0x2, 0x1af, 0x1b0, 0x9, 0xa, 0x2, 0x2, 0x1b0, 0x1b1, 0x9, 
+    0xe, 0x2, 0x2, 0x1b1, 0x1b2, 0x9, 0xc, 0x2, 0x2, 0x1b2, 0x1b3, 0x9, 0x10, 
+    0x2, 0x2, 0x1b3, 0x1b4, 0x9, 0xb, 0x2, 0x2, 0x1b4, 0x1b5, 0x9, 0xe, 0x2, 
+    0x2, 0x1b5, 0x70, 0x3, 0x2, 0x2, 0x2, 0x1b6, 0x1b7, 0x9, 0x10, 0x2, 0x2, 
+    0x1b7, 0x1b8, 0x9, 0xd, 0x2, 0x2, 0x1b8, 0x1b9, 0x9, 0xd, 0x2, 0x2, 
+    0x1b9, 0x72, 0x3, 0x2, 0x2, 0x2, 0x1ba, 0x1bb, 0x9, 0x7, 0x2, 0x2, 0x1bb, 
+    0x1bc, 0x9, 0xa, 0x2, 0x2, 0x1bc, 0x1bd, 0x9, 0x12, 0x2, 0x2, 0x1bd, 
+    0x1be, 0x9, 0xb, 0x2, 0x2, 0x1be, 0x1bf, 0x9, 0x10, 0x2, 0x2, 0x1bf, 
+    0x1c0, 0x9, 0xa, 0x2, 0x2, 0x1c0, 0x1c1, 0x9, 0x8, 0x2, 0x2, 0x1c1, 0x74, 
+    0x3, 0x2, 0x2, 0x2, 0x1c2, 0x1c3, 0x9, 0x13, 0x2, 0x2, 0x1c3, 0x1c4, 0x9, 
+    0xe, 0x2, 0x2, 0x1c4, 0x1c5, 0x9, 0x8, 0x2, 0x2, 0x1c5, 0x76, 0x3, 0x2, 
+    0x2, 0x2, 0x1c6, 0x1c7, 0x9, 0xa, 0x2, 0x2, 0x1c7, 0x1c8, 0x9, 0xe, 0x2, 
+    0x2, 0x1c8, 0x1c9, 0x9, 0x3, 0x2, 0x2, 0x1c9, 0x78, 0x3, 0x2, 0x2, 0x2, 
+    0x1ca, 0x1cb, 0x9, 0xf, 0x2, 0x2, 0x1cb, 0x1cc, 0x9, 0x4, 0x2, 0x2, 
+    0x1cc, 0x7a, 0x3, 0x2, 0x2, 0x2, 0x1cd, 0x1ce, 0x9, 0xe, 0x2, 0x2, 0x1ce, 
+    0x1cf, 0x9, 0x14, 0x2, 0x2, 0x1cf, 0x1d0, 0x9, 0x7, 0x2, 0x2, 0x1d0, 
+    0x1d1, 0x9, 0x3, 0x2, 0x2, 0x1d1, 0x1d2, 0x9, 0x10, 0x2, 0x2, 0x1d2, 
+    0x1d3, 0x9, 0x12, 0x2, 0x2, 0x1d3, 0x1d4, 0x9, 0xc, 0x2, 0x2, 0x1d4, 
+    0x7c, 0x3, 0x2, 0x2, 0x2, 0x1d5, 0x1d6, 0x9, 0x7, 0x2, 0x2, 0x1d6, 0x1d7, 
+    0x9, 0xa, 0x2, 0x2, 0x1d7, 0x1d8, 0x9, 0x4, 0x2, 0x2, 0x1d8, 0x1d9, 0x9, 
+    0x9, 0x2, 0x2, 0x1d9, 0x1da, 0x9, 0x12, 0x2, 0x2, 0x1da, 0x1db, 0x9, 0x3, 
+    0x2, 0x2, 0x1db, 0x1dc, 0x9, 0xe, 0x2, 0x2, 0x1dc, 0x7e, 0x3, 0x2, 0x2, 
+    0x2, 0x1dd, 0x1de, 0x9, 0x11, 0x2, 0x2, 0x1de, 0x1df, 0x9, 0xc, 0x2, 0x2, 
+    0x1df, 0x1e0, 0x9, 0x12, 0x2, 0x2, 0x1e0, 0x1e1, 0x9, 0x4, 0x2, 0x2, 
+    0x1e1, 0x1e2, 0x9, 0xc, 0x2, 0x2, 0x1e2, 0x80, 0x3, 0x2, 0x2, 0x2, 0x1e3, 
+    0x1e4, 0x9, 0x10, 0x2, 0x2, 0x1e4, 0x1e5, 0x9, 0x3, 0x2, 0x2, 0x1e5, 
+    0x1e6, 0x9, 0x3, 0x2, 0x2, 0x1e6, 0x82, 0x3, 0x2, 0x2, 0x2, 0x1e7, 0x1e8, 
+    0x9, 0x4, 0x2, 0x2, 0x1e8, 0x1e9, 0x9, 0x7, 0x2, 0x2, 0x1e9, 0x1ea, 0x9, 
+    0xf, 0x2, 0x2, 0x1ea, 0x1eb, 0x9, 0x12, 0x2, 0x2, 0x1eb, 0x1ec, 0x9, 0x4, 
+    0x2, 0x2, 0x1ec, 0x1ed, 0x9, 0xc, 0x2, 0x2, 0x1ed, 0x1ee, 0x9, 0x10, 0x2, 
     0x2, 0x1ee, 0x1ef, 0x9, 0x3, 0x2, 0x2, 0x1ef, 0x84, 0x3, 0x2, 0x2, 0x2, 
     0x1f0, 0x1f1, 0x9, 0xb, 0x2, 0x2, 0x1f1, 0x1f2, 0x9, 0x10, 0x2, 0x2, 
     0x1f2, 0x1f3, 0x9, 0xf, 0x2, 0x2, 0x1f3, 0x1f4, 0x9, 0x6, 0x2, 0x2, 
@@ -1011,218 +1011,220 @@ CypherLexer::Initializer::Initializer() {
     0x1ff, 0x9, 0xa, 0x2, 0x2, 0x1ff, 0x200, 0x9, 0xe, 0x2, 0x2, 0x200, 
     0x201, 0x9, 0x10, 0x2, 0x2, 0x201, 0x202, 0x9, 0xf, 0x2, 0x2, 0x202, 
     0x203, 0x9, 0xe, 0x2, 0x2, 0x203, 0x8a, 0x3, 0x2, 0x2, 0x2, 0x204, 0x205, 
-    0x9, 0x17, 0x2, 0x2, 0x205, 0x206, 0x9, 0xe, 0x2, 0x2, 0x206, 0x207, 
-    0x9, 0xf, 0x2, 0x2, 0x207, 0x8c, 0x3, 0x2, 0x2, 0x2, 0x208, 0x209, 0x9, 
-    0xd, 0x2, 0x2, 0x209, 0x20a, 0x9, 0xe, 0x2, 0x2, 0x20a, 0x20b, 0x9, 
-    0x3, 0x2, 0x2, 0x20b, 0x20c, 0x9, 0xe, 0x2, 0x2, 0x20c, 0x20d, 0x9, 
-    0xf, 0x2, 0x2, 0x20d, 0x20e, 0x9, 0xe, 0x2, 0x2, 0x20e, 0x8e, 0x3, 0x2, 
-    0x2, 0x2, 0x20f, 0x210, 0x9, 0x16, 0x2, 0x2, 0x210, 0x211, 0x9, 0x12, 
-    0x2, 0x2, 0x211, 0x212, 0x9, 0xf, 0x2, 0x2, 0x212, 0x213, 0x9, 0x15, 
-    0x2, 0x2, 0x213, 0x90, 0x3, 0x2, 0x2, 0x2, 0x214, 0x215, 0x9, 0xa, 0x2, 
-    0x2, 0x215, 0x216, 0x9, 0xe, 0x2, 0x2, 0x216, 0x217, 0x9, 0xf, 0x2, 
-    0x2, 0x217, 0x218, 0x9, 0x11, 0x2, 0x2, 0x218, 0x219, 0x9, 0xa, 0x2, 
-    0x2, 0x219, 0x21a, 0x9, 0xc, 0x2, 0x2, 0x21a, 0x92, 0x3, 0x2, 0x2, 0x2, 
-    0x21b, 0x21c, 0x9, 0xd, 0x2, 0x2, 0x21c, 0x21d, 0x9, 0x12, 0x2, 0x2, 
-    0x21d, 0x21e, 0x9, 0x17, 0x2, 0x2, 0x21e, 0x21f, 0x9, 0xf, 0x2, 0x2, 
-    0x21f, 0x220, 0x9, 0x12, 0x2, 0x2, 0x220, 0x221, 0x9, 0xc, 0x2, 0x2, 
-    0x221, 0x222, 0x9, 0x6, 0x2, 0x2, 0x222, 0x223, 0x9, 0xf, 0x2, 0x2, 
-    0x223, 0x94, 0x3, 0x2, 0x2, 0x2, 0x224, 0x225, 0x7, 0x2c, 0x2, 0x2, 
-    0x225, 0x96, 0x3, 0x2, 0x2, 0x2, 0x226, 0x227, 0x9, 0x10, 0x2, 0x2, 
-    0x227, 0x228, 0x9, 0x17, 0x2, 0x2, 0x228, 0x98, 0x3, 0x2, 0x2, 0x2, 
-    0x229, 0x22a, 0x9, 0x4, 0x2, 0x2, 0x22a, 0x22b, 0x9, 0xa, 0x2, 0x2, 
-    0x22b, 0x22c, 0x9, 0xd, 0x2, 0x2, 0x22c, 0x22d, 0x9, 0xe, 0x2, 0x2, 
-    0x22d, 0x22e, 0x9, 0xa, 0x2, 0x2, 0x22e, 0x9a, 0x3, 0x2, 0x2, 0x2, 0x22f, 
-    0x230, 0x9, 0x5, 0x2, 0x2, 0x230, 0x231, 0x9, 0x8, 0x2, 0x2, 0x231, 
-    0x9c, 0x3, 0x2, 0x2, 0x2, 0x232, 0x233, 0x9, 0x17, 0x2, 0x2, 0x233, 
-    0x234, 0x9, 0x13, 0x2, 0x2, 0x234, 0x235, 0x9, 0x12, 0x2, 0x2, 0x235, 
-    0x236, 0x9, 0x7, 0x2, 0x2, 0x236, 0x9e, 0x3, 0x2, 0x2, 0x2, 0x237, 0x238, 
-    0x9, 0x3, 0x2, 0x2, 0x238, 0x239, 0x9, 0x12, 0x2, 0x2, 0x239, 0x23a, 
-    0x9, 0xb, 0x2, 0x2, 0x23a, 0x23b, 0x9, 0x12, 0x2, 0x2, 0x23b, 0x23c, 
-    0x9, 0xf, 0x2, 0x2, 0x23c, 0xa0, 0x3, 0x2, 0x2, 0x2, 0x23d, 0x23e, 0x9, 
-    0x10, 0x2, 0x2, 0x23e, 0x23f, 0x9, 0x17, 0x2, 0x2, 0x23f, 0x240, 0x9, 
-    0x6, 0x2, 0x2, 0x240, 0x241, 0x9, 0xe, 0x2, 0x2, 0x241, 0x242, 0x9, 
-    0xc, 0x2, 0x2, 0x242, 0x243, 0x9, 0xd, 0x2, 0x2, 0x243, 0x244, 0x9, 
-    0x12, 0x2, 0x2, 0x244, 0x245, 0x9, 0xc, 0x2, 0x2, 0x245, 0x246, 0x9, 
-    0x2, 0x2, 0x2, 0x246, 0xa2, 0x3, 0x2, 0x2, 0x2, 0x247, 0x248, 0x9, 0x10, 
-    0x2, 0x2, 0x248, 0x249, 0x9, 0x17, 0x2, 0x2, 0x249, 0x24a, 0x9, 0x6, 
-    0x2, 0x2, 0x24a, 0xa4, 0x3, 0x2, 0x2, 0x2, 0x24b, 0x24c, 0x9, 0xd, 0x2, 
-    0x2, 0x24c, 0x24d, 0x9, 0xe, 0x2, 0x2, 0x24d, 0x24e, 0x9, 0x17, 0x2, 
-    0x2, 0x24e, 0x24f, 0x9, 0x6, 0x2, 0x2, 0x24f, 0x250, 0x9, 0xe, 0x2, 
-    0x2, 0x250, 0x251, 0x9, 0xc, 0x2, 0x2, 0x251, 0x252, 0x9, 0xd, 0x2, 
-    0x2, 0x252, 0x253, 0x9, 0x12, 0x2, 0x2, 0x253, 0x254, 0x9, 0xc, 0x2, 
-    0x2, 0x254, 0x255, 0x9, 0x2, 0x2, 0x2, 0x255, 0xa6, 0x3, 0x2, 0x2, 0x2, 
-    0x256, 0x257, 0x9, 0xd, 0x2, 0x2, 0x257, 0x258, 0x9, 0xe, 0x2, 0x2, 
-    0x258, 0x259, 0x9, 0x17, 0x2, 0x2, 0x259, 0x25a, 0x9, 0x6, 0x2, 0x2, 
-    0x25a, 0xa8, 0x3, 0x2, 0x2, 0x2, 0x25b, 0x25c, 0x9, 0x16, 0x2, 0x2, 
-    0x25c, 0x25d, 0x9, 0x15, 0x2, 0x2, 0x25d, 0x25e, 0x9, 0xe, 0x2, 0x2, 
-    0x25e, 0x25f, 0x9, 0xa, 0x2, 0x2, 0x25f, 0x260, 0x9, 0xe, 0x2, 0x2, 
-    0x260, 0xaa, 0x3, 0x2, 0x2, 0x2, 0x261, 0x262, 0x9, 0x4, 0x2, 0x2, 0x262, 
-    0x263, 0x9, 0xa, 0x2, 0x2, 0x263, 0xac, 0x3, 0x2, 0x2, 0x2, 0x264, 0x265, 
-    0x9, 0x14, 0x2, 0x2, 0x265, 0x266, 0x9, 0x4, 0x2, 0x2, 0x266, 0x267, 
-    0x9, 0xa, 0x2, 0x2, 0x267, 0xae, 0x3, 0x2, 0x2, 0x2, 0x268, 0x269, 0x9, 
-    0x10, 0x2, 0x2, 0x269, 0x26a, 0x9, 0xc, 0x2, 0x2, 0x26a, 0x26b, 0x9, 
-    0xd, 0x2, 0x2, 0x26b, 0xb0, 0x3, 0x2, 0x2, 0x2, 0x26c, 0x26d, 0x9, 0xc, 
-    0x2, 0x2, 0x26d, 0x26e, 0x9, 0x4, 0x2, 0x2, 0x26e, 0x26f, 0x9, 0xf, 
-    0x2, 0x2, 0x26f, 0xb2, 0x3, 0x2, 0x2, 0x2, 0x270, 0x271, 0x7, 0x23, 
-    0x2, 0x2, 0x271, 0x272, 0x7, 0x3f, 0x2, 0x2, 0x272, 0xb4, 0x3, 0x2, 
-    0x2, 0x2, 0x273, 0x274, 0x7, 0x2f, 0x2, 0x2, 0x274, 0xb6, 0x3, 0x2, 
-    0x2, 0x2, 0x275, 0x276, 0x7, 0x23, 0x2, 0x2, 0x276, 0xb8, 0x3, 0x2, 
-    0x2, 0x2, 0x277, 0x278, 0x9, 0x17, 0x2, 0x2, 0x278, 0x279, 0x9, 0xf, 
-    0x2, 0x2, 0x279, 0x27a, 0x9, 0x10, 0x2, 0x2, 0x27a, 0x27b, 0x9, 0xa, 
-    0x2, 0x2, 0x27b, 0x27c, 0x9, 0xf, 0x2, 0x2, 0x27c, 0x27d, 0x9, 0x17, 
-    0x2, 0x2, 0x27d, 0xba, 0x3, 0x2, 0x2, 0x2, 0x27e, 0x27f, 0x9, 0xe, 0x2, 
-    0x2, 0x27f, 0x280, 0x9, 0xc, 0x2, 0x2, 0x280, 0x281, 0x9, 0xd, 0x2, 
-    0x2, 0x281, 0x282, 0x9, 0x17, 0x2, 0x2, 0x282, 0xbc, 0x3, 0x2, 0x2, 
-    0x2, 0x283, 0x284, 0x9, 0x6, 0x2, 0x2, 0x284, 0x285, 0x9, 0x4, 0x2, 
-    0x2, 0x285, 0x286, 0x9, 0xc, 0x2, 0x2, 0x286, 0x287, 0x9, 0xf, 0x2, 
-    0x2, 0x287, 0x288, 0x9, 0x10, 0x2, 0x2, 0x288, 0x289, 0x9, 0x12, 0x2, 
-    0x2, 0x289, 0x28a, 0x9, 0xc, 0x2, 0x2, 0x28a, 0x28b, 0x9, 0x17, 0x2, 
-    0x2, 0x28b, 0xbe, 0x3, 0x2, 0x2, 0x2, 0x28c, 0x28d, 0x9, 0x12, 0x2, 
-    0x2, 0x28d, 0x28e, 0x9, 0x17, 0x2, 0x2, 0x28e, 0xc0, 0x3, 0x2, 0x2, 
-    0x2, 0x28f, 0x290, 0x9, 0xc, 0x2, 0x2, 0x290, 0x291, 0x9, 0x11, 0x2, 
-    0x2, 0x291, 0x292, 0x9, 0x3, 0x2, 0x2, 0x292, 0x293, 0x9, 0x3, 0x2, 
-    0x2, 0x293, 0xc2, 0x3, 0x2, 0x2, 0x2, 0x294, 0x295, 0x9, 0xf, 0x2, 0x2, 
-    0x295, 0x296, 0x9, 0xa, 0x2, 0x2, 0x296, 0x297, 0x9, 0x11, 0x2, 0x2, 
-    0x297, 0x298, 0x9, 0xe, 0x2, 0x2, 0x298, 0xc4, 0x3, 0x2, 0x2, 0x2, 0x299, 
-    0x29a, 0x9, 0x9, 0x2, 0x2, 0x29a, 0x29b, 0x9, 0x10, 0x2, 0x2, 0x29b, 
-    0x29c, 0x9, 0x3, 0x2, 0x2, 0x29c, 0x29d, 0x9, 0x17, 0x2, 0x2, 0x29d, 
-    0x29e, 0x9, 0xe, 0x2, 0x2, 0x29e, 0xc6, 0x3, 0x2, 0x2, 0x2, 0x29f, 0x2a0, 
-    0x9, 0xe, 0x2, 0x2, 0x2a0, 0x2a1, 0x9, 0x14, 0x2, 0x2, 0x2a1, 0x2a2, 
-    0x9, 0x12, 0x2, 0x2, 0x2a2, 0x2a3, 0x9, 0x17, 0x2, 0x2, 0x2a3, 0x2a4, 
-    0x9, 0xf, 0x2, 0x2, 0x2a4, 0x2a5, 0x9, 0x17, 0x2, 0x2, 0x2a5, 0xc8, 
-    0x3, 0x2, 0x2, 0x2, 0x2a6, 0x2a7, 0x9, 0x6, 0x2, 0x2, 0x2a7, 0x2a8, 
+    0x9, 0x17, 0x2, 0x2, 0x205, 0x206, 0x9, 0xe, 0x2, 0x2, 0x206, 0x207, 0x9, 
+    0xf, 0x2, 0x2, 0x207, 0x8c, 0x3, 0x2, 0x2, 0x2, 0x208, 0x209, 0x9, 0xd, 
+    0x2, 0x2, 0x209, 0x20a, 0x9, 0xe, 0x2, 0x2, 0x20a, 0x20b, 0x9, 0x3, 0x2, 
+    0x2, 0x20b, 0x20c, 0x9, 0xe, 0x2, 0x2, 0x20c, 0x20d, 0x9, 0xf, 0x2, 0x2, 
+    0x20d, 0x20e, 0x9, 0xe, 0x2, 0x2, 0x20e, 0x8e, 0x3, 0x2, 0x2, 0x2, 0x20f, 
+    0x210, 0x9, 0x16, 0x2, 0x2, 0x210, 0x211, 0x9, 0x12, 0x2, 0x2, 0x211, 
+    0x212, 0x9, 0xf, 0x2, 0x2, 0x212, 0x213, 0x9, 0x15, 0x2, 0x2, 0x213, 
+    0x90, 0x3, 0x2, 0x2, 0x2, 0x214, 0x215, 0x9, 0xa, 0x2, 0x2, 0x215, 0x216, 
+    0x9, 0xe, 0x2, 0x2, 0x216, 0x217, 0x9, 0xf, 0x2, 0x2, 0x217, 0x218, 0x9, 
+    0x11, 0x2, 0x2, 0x218, 0x219, 0x9, 0xa, 0x2, 0x2, 0x219, 0x21a, 0x9, 0xc, 
+    0x2, 0x2, 0x21a, 0x92, 0x3, 0x2, 0x2, 0x2, 0x21b, 0x21c, 0x9, 0xd, 0x2, 
+    0x2, 0x21c, 0x21d, 0x9, 0x12, 0x2, 0x2, 0x21d, 0x21e, 0x9, 0x17, 0x2, 
+    0x2, 0x21e, 0x21f, 0x9, 0xf, 0x2, 0x2, 0x21f, 0x220, 0x9, 0x12, 0x2, 0x2, 
+    0x220, 0x221, 0x9, 0xc, 0x2, 0x2, 0x221, 0x222, 0x9, 0x6, 0x2, 0x2, 
+    0x222, 0x223, 0x9, 0xf, 0x2, 0x2, 0x223, 0x94, 0x3, 0x2, 0x2, 0x2, 0x224, 
+    0x225, 0x7, 0x2c, 0x2, 0x2, 0x225, 0x96, 0x3, 0x2, 0x2, 0x2, 0x226, 
+    0x227, 0x9, 0x10, 0x2, 0x2, 0x227, 0x228, 0x9, 0x17, 0x2, 0x2, 0x228, 
+    0x98, 0x3, 0x2, 0x2, 0x2, 0x229, 0x22a, 0x9, 0x4, 0x2, 0x2, 0x22a, 0x22b, 
+    0x9, 0xa, 0x2, 0x2, 0x22b, 0x22c, 0x9, 0xd, 0x2, 0x2, 0x22c, 0x22d, 0x9, 
+    0xe, 0x2, 0x2, 0x22d, 0x22e, 0x9, 0xa, 0x2, 0x2, 0x22e, 0x9a, 0x3, 0x2, 
+    0x2, 0x2, 0x22f, 0x230, 0x9, 0x5, 0x2, 0x2, 0x230, 0x231, 0x9, 0x8, 0x2, 
+    0x2, 0x231, 0x9c, 0x3, 0x2, 0x2, 0x2, 0x232, 0x233, 0x9, 0x17, 0x2, 0x2, 
+    0x233, 0x234, 0x9, 0x13, 0x2, 0x2, 0x234, 0x235, 0x9, 0x12, 0x2, 0x2, 
+    0x235, 0x236, 0x9, 0x7, 0x2, 0x2, 0x236, 0x9e, 0x3, 0x2, 0x2, 0x2, 0x237, 
+    0x238, 0x9, 0x3, 0x2, 0x2, 0x238, 0x239, 0x9, 0x12, 0x2, 0x2, 0x239, 
+    0x23a, 0x9, 0xb, 0x2, 0x2, 0x23a, 0x23b, 0x9, 0x12, 0x2, 0x2, 0x23b, 
+    0x23c, 0x9, 0xf, 0x2, 0x2, 0x23c, 0xa0, 0x3, 0x2, 0x2, 0x2, 0x23d, 0x23e, 
+    0x9, 0x10, 0x2, 0x2, 0x23e, 0x23f, 0x9, 0x17, 0x2, 0x2, 0x23f, 0x240, 
+    0x9, 0x6, 0x2, 0x2, 0x240, 0x241, 0x9, 0xe, 0x2, 0x2, 0x241, 0x242, 0x9, 
+    0xc, 0x2, 0x2, 0x242, 0x243, 0x9, 0xd, 0x2, 0x2, 0x243, 0x244, 0x9, 0x12, 
+    0x2, 0x2, 0x244, 0x245, 0x9, 0xc, 0x2, 0x2, 0x245, 0x246, 0x9, 0x2, 0x2, 
+    0x2, 0x246, 0xa2, 0x3, 0x2, 0x2, 0x2, 0x247, 0x248, 0x9, 0x10, 0x2, 0x2, 
+    0x248, 0x249, 0x9, 0x17, 0x2, 0x2, 0x249, 0x24a, 0x9, 0x6, 0x2, 0x2, 
+    0x24a, 0xa4, 0x3, 0x2, 0x2, 0x2, 0x24b, 0x24c, 0x9, 0xd, 0x2, 0x2, 0x24c, 
+    0x24d, 0x9, 0xe, 0x2, 0x2, 0x24d, 0x24e, 0x9, 0x17, 0x2, 0x2, 0x24e, 
+    0x24f, 0x9, 0x6, 0x2, 0x2, 0x24f, 0x250, 0x9, 0xe, 0x2, 0x2, 0x250, 
+    0x251, 0x9, 0xc, 0x2, 0x2, 0x251, 0x252, 0x9, 0xd, 0x2, 0x2, 0x252, 
+    0x253, 0x9, 0x12, 0x2, 0x2, 0x253, 0x254, 0x9, 0xc, 0x2, 0x2, 0x254, 
+    0x255, 0x9, 0x2, 0x2, 0x2, 0x255, 0xa6, 0x3, 0x2, 0x2, 0x2, 0x256, 0x257, 
+    0x9, 0xd, 0x2, 0x2, 0x257, 0x258, 0x9, 0xe, 0x2, 0x2, 0x258, 0x259, 0x9, 
+    0x17, 0x2, 0x2, 0x259, 0x25a, 0x9, 0x6, 0x2, 0x2, 0x25a, 0xa8, 0x3, 0x2, 
+    0x2, 0x2, 0x25b, 0x25c, 0x9, 0x16, 0x2, 0x2, 0x25c, 0x25d, 0x9, 0x15, 
+    0x2, 0x2, 0x25d, 0x25e, 0x9, 0xe, 0x2, 0x2, 0x25e, 0x25f, 0x9, 0xa, 0x2, 
+    0x2, 0x25f, 0x260, 0x9, 0xe, 0x2, 0x2, 0x260, 0xaa, 0x3, 0x2, 0x2, 0x2, 
+    0x261, 0x262, 0x9, 0x4, 0x2, 0x2, 0x262, 0x263, 0x9, 0xa, 0x2, 0x2, 
+    0x263, 0xac, 0x3, 0x2, 0x2, 0x2, 0x264, 0x265, 0x9, 0x14, 0x2, 0x2, 
+    0x265, 0x266, 0x9, 0x4, 0x2, 0x2, 0x266, 0x267, 0x9, 0xa, 0x2, 0x2, 
+    0x267, 0xae, 0x3, 0x2, 0x2, 0x2, 0x268, 0x269, 0x9, 0x10, 0x2, 0x2, 
+    0x269, 0x26a, 0x9, 0xc, 0x2, 0x2, 0x26a, 0x26b, 0x9, 0xd, 0x2, 0x2, 
+    0x26b, 0xb0, 0x3, 0x2, 0x2, 0x2, 0x26c, 0x26d, 0x9, 0xc, 0x2, 0x2, 0x26d, 
+    0x26e, 0x9, 0x4, 0x2, 0x2, 0x26e, 0x26f, 0x9, 0xf, 0x2, 0x2, 0x26f, 0xb2, 
+    0x3, 0x2, 0x2, 0x2, 0x270, 0x271, 0x7, 0x23, 0x2, 0x2, 0x271, 0x272, 0x7, 
+    0x3f, 0x2, 0x2, 0x272, 0xb4, 0x3, 0x2, 0x2, 0x2, 0x273, 0x274, 0x7, 0x2f, 
+    0x2, 0x2, 0x274, 0xb6, 0x3, 0x2, 0x2, 0x2, 0x275, 0x276, 0x7, 0x23, 0x2, 
+    0x2, 0x276, 0xb8, 0x3, 0x2, 0x2, 0x2, 0x277, 0x278, 0x9, 0x17, 0x2, 0x2, 
+    0x278, 0x279, 0x9, 0xf, 0x2, 0x2, 0x279, 0x27a, 0x9, 0x10, 0x2, 0x2, 
+    0x27a, 0x27b, 0x9, 0xa, 0x2, 0x2, 0x27b, 0x27c, 0x9, 0xf, 0x2, 0x2, 
+    0x27c, 0x27d, 0x9, 0x17, 0x2, 0x2, 0x27d, 0xba, 0x3, 0x2, 0x2, 0x2, 
+    0x27e, 0x27f, 0x9, 0xe, 0x2, 0x2, 0x27f, 0x280, 0x9, 0xc, 0x2, 0x2, 
+    0x280, 0x281, 0x9, 0xd, 0x2, 0x2, 0x281, 0x282, 0x9, 0x17, 0x2, 0x2, 
+    0x282, 0xbc, 0x3, 0x2, 0x2, 0x2, 0x283, 0x284, 0x9, 0x6, 0x2, 0x2, 0x284, 
+    0x285, 0x9, 0x4, 0x2, 0x2, 0x285, 0x286, 0x9, 0xc, 0x2, 0x2, 0x286, 
+    0x287, 0x9, 0xf, 0x2, 0x2, 0x287, 0x288, 0x9, 0x10, 0x2, 0x2, 0x288, 
+    0x289, 0x9, 0x12, 0x2, 0x2, 0x289, 0x28a, 0x9, 0xc, 0x2, 0x2, 0x28a, 
+    0x28b, 0x9, 0x17, 0x2, 0x2, 0x28b, 0xbe, 0x3, 0x2, 0x2, 0x2, 0x28c, 
+    0x28d, 0x9, 0x12, 0x2, 0x2, 0x28d, 0x28e, 0x9, 0x17, 0x2, 0x2, 0x28e, 
+    0xc0, 0x3, 0x2, 0x2, 0x2, 0x28f, 0x290, 0x9, 0xc, 0x2, 0x2, 0x290, 0x291, 
+    0x9, 0x11, 0x2, 0x2, 0x291, 0x292, 0x9, 0x3, 0x2, 0x2, 0x292, 0x293, 0x9, 
+    0x3, 0x2, 0x2, 0x293, 0xc2, 0x3, 0x2, 0x2, 0x2, 0x294, 0x295, 0x9, 0xf, 
+    0x2, 0x2, 0x295, 0x296, 0x9, 0xa, 0x2, 0x2, 0x296, 0x297, 0x9, 0x11, 0x2, 
+    0x2, 0x297, 0x298, 0x9, 0xe, 0x2, 0x2, 0x298, 0xc4, 0x3, 0x2, 0x2, 0x2, 
+    0x299, 0x29a, 0x9, 0x9, 0x2, 0x2, 0x29a, 0x29b, 0x9, 0x10, 0x2, 0x2, 
+    0x29b, 0x29c, 0x9, 0x3, 0x2, 0x2, 0x29c, 0x29d, 0x9, 0x17, 0x2, 0x2, 
+    0x29d, 0x29e, 0x9, 0xe, 0x2, 0x2, 0x29e, 0xc6, 0x3, 0x2, 0x2, 0x2, 0x29f, 
+    0x2a0, 0x9, 0xe, 0x2, 0x2, 0x2a0, 0x2a1, 0x9, 0x14, 0x2, 0x2, 0x2a1, 
+    0x2a2, 0x9, 0x12, 0x2, 0x2, 0x2a2, 0x2a3, 0x9, 0x17, 0x2, 0x2, 0x2a3, 
+    0x2a4, 0x9, 0xf, 0x2, 0x2, 0x2a4, 0x2a5, 0x9, 0x17, 0x2, 0x2, 0x2a5, 
+    0xc8, 0x3, 0x2, 0x2, 0x2, 0x2a6, 0x2a7, 0x9, 0x6, 0x2, 0x2, 0x2a7, 0x2a8, 
     0x9, 0x10, 0x2, 0x2, 0x2a8, 0x2a9, 0x9, 0x17, 0x2, 0x2, 0x2a9, 0x2aa, 
     0x9, 0xe, 0x2, 0x2, 0x2aa, 0xca, 0x3, 0x2, 0x2, 0x2, 0x2ab, 0x2ac, 0x9, 
-    0xe, 0x2, 0x2, 0x2ac, 0x2ad, 0x9, 0x3, 0x2, 0x2, 0x2ad, 0x2ae, 0x9, 
-    0x17, 0x2, 0x2, 0x2ae, 0x2af, 0x9, 0xe, 0x2, 0x2, 0x2af, 0xcc, 0x3, 
-    0x2, 0x2, 0x2, 0x2b0, 0x2b1, 0x9, 0xe, 0x2, 0x2, 0x2b1, 0x2b2, 0x9, 
-    0xc, 0x2, 0x2, 0x2b2, 0x2b3, 0x9, 0xd, 0x2, 0x2, 0x2b3, 0xce, 0x3, 0x2, 
-    0x2, 0x2, 0x2b4, 0x2b5, 0x9, 0x16, 0x2, 0x2, 0x2b5, 0x2b6, 0x9, 0x15, 
-    0x2, 0x2, 0x2b6, 0x2b7, 0x9, 0xe, 0x2, 0x2, 0x2b7, 0x2b8, 0x9, 0xc, 
-    0x2, 0x2, 0x2b8, 0xd0, 0x3, 0x2, 0x2, 0x2, 0x2b9, 0x2ba, 0x9, 0xf, 0x2, 
-    0x2, 0x2ba, 0x2bb, 0x9, 0x15, 0x2, 0x2, 0x2bb, 0x2bc, 0x9, 0xe, 0x2, 
-    0x2, 0x2bc, 0x2bd, 0x9, 0xc, 0x2, 0x2, 0x2bd, 0xd2, 0x3, 0x2, 0x2, 0x2, 
-    0x2be, 0x2c3, 0x7, 0x24, 0x2, 0x2, 0x2bf, 0x2c2, 0x5, 0x113, 0x8a, 0x2, 
-    0x2c0, 0x2c2, 0x5, 0xd5, 0x6b, 0x2, 0x2c1, 0x2bf, 0x3, 0x2, 0x2, 0x2, 
-    0x2c1, 0x2c0, 0x3, 0x2, 0x2, 0x2, 0x2c2, 0x2c5, 0x3, 0x2, 0x2, 0x2, 
-    0x2c3, 0x2c1, 0x3, 0x2, 0x2, 0x2, 0x2c3, 0x2c4, 0x3, 0x2, 0x2, 0x2, 
-    0x2c4, 0x2c6, 0x3, 0x2, 0x2, 0x2, 0x2c5, 0x2c3, 0x3, 0x2, 0x2, 0x2, 
-    0x2c6, 0x2d1, 0x7, 0x24, 0x2, 0x2, 0x2c7, 0x2cc, 0x7, 0x29, 0x2, 0x2, 
-    0x2c8, 0x2cb, 0x5, 0xff, 0x80, 0x2, 0x2c9, 0x2cb, 0x5, 0xd5, 0x6b, 0x2, 
-    0x2ca, 0x2c8, 0x3, 0x2, 0x2, 0x2, 0x2ca, 0x2c9, 0x3, 0x2, 0x2, 0x2, 
-    0x2cb, 0x2ce, 0x3, 0x2, 0x2, 0x2, 0x2cc, 0x2ca, 0x3, 0x2, 0x2, 0x2, 
-    0x2cc, 0x2cd, 0x3, 0x2, 0x2, 0x2, 0x2cd, 0x2cf, 0x3, 0x2, 0x2, 0x2, 
-    0x2ce, 0x2cc, 0x3, 0x2, 0x2, 0x2, 0x2cf, 0x2d1, 0x7, 0x29, 0x2, 0x2, 
-    0x2d0, 0x2be, 0x3, 0x2, 0x2, 0x2, 0x2d0, 0x2c7, 0x3, 0x2, 0x2, 0x2, 
-    0x2d1, 0xd4, 0x3, 0x2, 0x2, 0x2, 0x2d2, 0x2e4, 0x7, 0x5e, 0x2, 0x2, 
-    0x2d3, 0x2e5, 0x9, 0x18, 0x2, 0x2, 0x2d4, 0x2d5, 0x9, 0x11, 0x2, 0x2, 
-    0x2d5, 0x2d6, 0x5, 0xdb, 0x6e, 0x2, 0x2d6, 0x2d7, 0x5, 0xdb, 0x6e, 0x2, 
-    0x2d7, 0x2d8, 0x5, 0xdb, 0x6e, 0x2, 0x2d8, 0x2d9, 0x5, 0xdb, 0x6e, 0x2, 
-    0x2d9, 0x2e5, 0x3, 0x2, 0x2, 0x2, 0x2da, 0x2db, 0x9, 0x11, 0x2, 0x2, 
-    0x2db, 0x2dc, 0x5, 0xdb, 0x6e, 0x2, 0x2dc, 0x2dd, 0x5, 0xdb, 0x6e, 0x2, 
-    0x2dd, 0x2de, 0x5, 0xdb, 0x6e, 0x2, 0x2de, 0x2df, 0x5, 0xdb, 0x6e, 0x2, 
-    0x2df, 0x2e0, 0x5, 0xdb, 0x6e, 0x2, 0x2e0, 0x2e1, 0x5, 0xdb, 0x6e, 0x2, 
-    0x2e1, 0x2e2, 0x5, 0xdb, 0x6e, 0x2, 0x2e2, 0x2e3, 0x5, 0xdb, 0x6e, 0x2, 
-    0x2e3, 0x2e5, 0x3, 0x2, 0x2, 0x2, 0x2e4, 0x2d3, 0x3, 0x2, 0x2, 0x2, 
-    0x2e4, 0x2d4, 0x3, 0x2, 0x2, 0x2, 0x2e4, 0x2da, 0x3, 0x2, 0x2, 0x2, 
-    0x2e5, 0xd6, 0x3, 0x2, 0x2, 0x2, 0x2e6, 0x2ef, 0x5, 0xe3, 0x72, 0x2, 
-    0x2e7, 0x2eb, 0x5, 0xdf, 0x70, 0x2, 0x2e8, 0x2ea, 0x5, 0xdd, 0x6f, 0x2, 
-    0x2e9, 0x2e8, 0x3, 0x2, 0x2, 0x2, 0x2ea, 0x2ed, 0x3, 0x2, 0x2, 0x2, 
-    0x2eb, 0x2e9, 0x3, 0x2, 0x2, 0x2, 0x2eb, 0x2ec, 0x3, 0x2, 0x2, 0x2, 
-    0x2ec, 0x2ef, 0x3, 0x2, 0x2, 0x2, 0x2ed, 0x2eb, 0x3, 0x2, 0x2, 0x2, 
-    0x2ee, 0x2e6, 0x3, 0x2, 0x2, 0x2, 0x2ee, 0x2e7, 0x3, 0x2, 0x2, 0x2, 
-    0x2ef, 0xd8, 0x3, 0x2, 0x2, 0x2, 0x2f0, 0x2f2, 0x9, 0x19, 0x2, 0x2, 
+    0xe, 0x2, 0x2, 0x2ac, 0x2ad, 0x9, 0x3, 0x2, 0x2, 0x2ad, 0x2ae, 0x9, 0x17, 
+    0x2, 0x2, 0x2ae, 0x2af, 0x9, 0xe, 0x2, 0x2, 0x2af, 0xcc, 0x3, 0x2, 0x2, 
+    0x2, 0x2b0, 0x2b1, 0x9, 0xe, 0x2, 0x2, 0x2b1, 0x2b2, 0x9, 0xc, 0x2, 0x2, 
+    0x2b2, 0x2b3, 0x9, 0xd, 0x2, 0x2, 0x2b3, 0xce, 0x3, 0x2, 0x2, 0x2, 0x2b4, 
+    0x2b5, 0x9, 0x16, 0x2, 0x2, 0x2b5, 0x2b6, 0x9, 0x15, 0x2, 0x2, 0x2b6, 
+    0x2b7, 0x9, 0xe, 0x2, 0x2, 0x2b7, 0x2b8, 0x9, 0xc, 0x2, 0x2, 0x2b8, 0xd0, 
+    0x3, 0x2, 0x2, 0x2, 0x2b9, 0x2ba, 0x9, 0xf, 0x2, 0x2, 0x2ba, 0x2bb, 0x9, 
+    0x15, 0x2, 0x2, 0x2bb, 0x2bc, 0x9, 0xe, 0x2, 0x2, 0x2bc, 0x2bd, 0x9, 0xc, 
+    0x2, 0x2, 0x2bd, 0xd2, 0x3, 0x2, 0x2, 0x2, 0x2be, 0x2c3, 0x7, 0x24, 0x2, 
+    0x2, 0x2bf, 0x2c2, 0x5, 0x113, 0x8a, 0x2, 0x2c0, 0x2c2, 0x5, 0xd5, 0x6b, 
+    0x2, 0x2c1, 0x2bf, 0x3, 0x2, 0x2, 0x2, 0x2c1, 0x2c0, 0x3, 0x2, 0x2, 0x2, 
+    0x2c2, 0x2c5, 0x3, 0x2, 0x2, 0x2, 0x2c3, 0x2c1, 0x3, 0x2, 0x2, 0x2, 
+    0x2c3, 0x2c4, 0x3, 0x2, 0x2, 0x2, 0x2c4, 0x2c6, 0x3, 0x2, 0x2, 0x2, 
+    0x2c5, 0x2c3, 0x3, 0x2, 0x2, 0x2, 0x2c6, 0x2d1, 0x7, 0x24, 0x2, 0x2, 
+    0x2c7, 0x2cc, 0x7, 0x29, 0x2, 0x2, 0x2c8, 0x2cb, 0x5, 0xff, 0x80, 0x2, 
+    0x2c9, 0x2cb, 0x5, 0xd5, 0x6b, 0x2, 0x2ca, 0x2c8, 0x3, 0x2, 0x2, 0x2, 
+    0x2ca, 0x2c9, 0x3, 0x2, 0x2, 0x2, 0x2cb, 0x2ce, 0x3, 0x2, 0x2, 0x2, 
+    0x2cc, 0x2ca, 0x3, 0x2, 0x2, 0x2, 0x2cc, 0x2cd, 0x3, 0x2, 0x2, 0x2, 
+    0x2cd, 0x2cf, 0x3, 0x2, 0x2, 0x2, 0x2ce, 0x2cc, 0x3, 0x2, 0x2, 0x2, 
+    0x2cf, 0x2d1, 0x7, 0x29, 0x2, 0x2, 0x2d0, 0x2be, 0x3, 0x2, 0x2, 0x2, 
+    0x2d0, 0x2c7, 0x3, 0x2, 0x2, 0x2, 0x2d1, 0xd4, 0x3, 0x2, 0x2, 0x2, 0x2d2, 
+    0x2e4, 0x7, 0x5e, 0x2, 0x2, 0x2d3, 0x2e5, 0x9, 0x18, 0x2, 0x2, 0x2d4, 
+    0x2d5, 0x9, 0x11, 0x2, 0x2, 0x2d5, 0x2d6, 0x5, 0xdb, 0x6e, 0x2, 0x2d6, 
+    0x2d7, 0x5, 0xdb, 0x6e, 0x2, 0x2d7, 0x2d8, 0x5, 0xdb, 0x6e, 0x2, 0x2d8, 
+    0x2d9, 0x5, 0xdb, 0x6e, 0x2, 0x2d9, 0x2e5, 0x3, 0x2, 0x2, 0x2, 0x2da, 
+    0x2db, 0x9, 0x11, 0x2, 0x2, 0x2db, 0x2dc, 0x5, 0xdb, 0x6e, 0x2, 0x2dc, 
+    0x2dd, 0x5, 0xdb, 0x6e, 0x2, 0x2dd, 0x2de, 0x5, 0xdb, 0x6e, 0x2, 0x2de, 
+    0x2df, 0x5, 0xdb, 0x6e, 0x2, 0x2df, 0x2e0, 0x5, 0xdb, 0x6e, 0x2, 0x2e0, 
+    0x2e1, 0x5, 0xdb, 0x6e, 0x2, 0x2e1, 0x2e2, 0x5, 0xdb, 0x6e, 0x2, 0x2e2, 
+    0x2e3, 0x5, 0xdb, 0x6e, 0x2, 0x2e3, 0x2e5, 0x3, 0x2, 0x2, 0x2, 0x2e4, 
+    0x2d3, 0x3, 0x2, 0x2, 0x2, 0x2e4, 0x2d4, 0x3, 0x2, 0x2, 0x2, 0x2e4, 
+    0x2da, 0x3, 0x2, 0x2, 0x2, 0x2e5, 0xd6, 0x3, 0x2, 0x2, 0x2, 0x2e6, 0x2ef, 
+    0x5, 0xe3, 0x72, 0x2, 0x2e7, 0x2eb, 0x5, 0xdf, 0x70, 0x2, 0x2e8, 0x2ea, 
+    0x5, 0xdd, 0x6f, 0x2, 0x2e9, 0x2e8, 0x3, 0x2, 0x2, 0x2, 0x2ea, 0x2ed, 
+    0x3, 0x2, 0x2, 0x2, 0x2eb, 0x2e9, 0x3, 0x2, 0x2, 0x2, 0x2eb, 0x2ec, 0x3, 
+    0x2, 0x2, 0x2, 0x2ec, 0x2ef, 0x3, 0x2, 0x2, 0x2, 0x2ed, 0x2eb, 0x3, 0x2, 
+    0x2, 0x2, 0x2ee, 0x2e6, 0x3, 0x2, 0x2, 0x2, 0x2ee, 0x2e7, 0x3, 0x2, 0x2, 
+    0x2, 0x2ef, 0xd8, 0x3, 0x2, 0x2, 0x2, 0x2f0, 0x2f2, 0x9, 0x19, 0x2, 0x2, 
     0x2f1, 0x2f0, 0x3, 0x2, 0x2, 0x2, 0x2f2, 0xda, 0x3, 0x2, 0x2, 0x2, 0x2f3, 
     0x2f6, 0x5, 0xdd, 0x6f, 0x2, 0x2f4, 0x2f6, 0x5, 0xd9, 0x6d, 0x2, 0x2f5, 
-    0x2f3, 0x3, 0x2, 0x2, 0x2, 0x2f5, 0x2f4, 0x3, 0x2, 0x2, 0x2, 0x2f6, 
-    0xdc, 0x3, 0x2, 0x2, 0x2, 0x2f7, 0x2fa, 0x5, 0xe3, 0x72, 0x2, 0x2f8, 
-    0x2fa, 0x5, 0xdf, 0x70, 0x2, 0x2f9, 0x2f7, 0x3, 0x2, 0x2, 0x2, 0x2f9, 
-    0x2f8, 0x3, 0x2, 0x2, 0x2, 0x2fa, 0xde, 0x3, 0x2, 0x2, 0x2, 0x2fb, 0x2fe, 
-    0x5, 0xe1, 0x71, 0x2, 0x2fc, 0x2fe, 0x4, 0x3a, 0x3b, 0x2, 0x2fd, 0x2fb, 
-    0x3, 0x2, 0x2, 0x2, 0x2fd, 0x2fc, 0x3, 0x2, 0x2, 0x2, 0x2fe, 0xe0, 0x3, 
-    0x2, 0x2, 0x2, 0x2ff, 0x300, 0x4, 0x33, 0x39, 0x2, 0x300, 0xe2, 0x3, 
-    0x2, 0x2, 0x2, 0x301, 0x302, 0x7, 0x32, 0x2, 0x2, 0x302, 0xe4, 0x3, 
-    0x2, 0x2, 0x2, 0x303, 0x305, 0x5, 0xdd, 0x6f, 0x2, 0x304, 0x303, 0x3, 
-    0x2, 0x2, 0x2, 0x305, 0x308, 0x3, 0x2, 0x2, 0x2, 0x306, 0x304, 0x3, 
-    0x2, 0x2, 0x2, 0x306, 0x307, 0x3, 0x2, 0x2, 0x2, 0x307, 0x309, 0x3, 
-    0x2, 0x2, 0x2, 0x308, 0x306, 0x3, 0x2, 0x2, 0x2, 0x309, 0x30b, 0x7, 
-    0x30, 0x2, 0x2, 0x30a, 0x30c, 0x5, 0xdd, 0x6f, 0x2, 0x30b, 0x30a, 0x3, 
-    0x2, 0x2, 0x2, 0x30c, 0x30d, 0x3, 0x2, 0x2, 0x2, 0x30d, 0x30b, 0x3, 
-    0x2, 0x2, 0x2, 0x30d, 0x30e, 0x3, 0x2, 0x2, 0x2, 0x30e, 0xe6, 0x3, 0x2, 
-    0x2, 0x2, 0x30f, 0x313, 0x5, 0xe9, 0x75, 0x2, 0x310, 0x312, 0x5, 0xeb, 
-    0x76, 0x2, 0x311, 0x310, 0x3, 0x2, 0x2, 0x2, 0x312, 0x315, 0x3, 0x2, 
-    0x2, 0x2, 0x313, 0x311, 0x3, 0x2, 0x2, 0x2, 0x313, 0x314, 0x3, 0x2, 
-    0x2, 0x2, 0x314, 0xe8, 0x3, 0x2, 0x2, 0x2, 0x315, 0x313, 0x3, 0x2, 0x2, 
-    0x2, 0x316, 0x319, 0x5, 0x11b, 0x8e, 0x2, 0x317, 0x319, 0x5, 0x10f, 
-    0x88, 0x2, 0x318, 0x316, 0x3, 0x2, 0x2, 0x2, 0x318, 0x317, 0x3, 0x2, 
-    0x2, 0x2, 0x319, 0xea, 0x3, 0x2, 0x2, 0x2, 0x31a, 0x31d, 0x5, 0xfb, 
-    0x7e, 0x2, 0x31b, 0x31d, 0x5, 0x10b, 0x86, 0x2, 0x31c, 0x31a, 0x3, 0x2, 
-    0x2, 0x2, 0x31c, 0x31b, 0x3, 0x2, 0x2, 0x2, 0x31d, 0xec, 0x3, 0x2, 0x2, 
-    0x2, 0x31e, 0x322, 0x7, 0x62, 0x2, 0x2, 0x31f, 0x321, 0x5, 0xf7, 0x7c, 
-    0x2, 0x320, 0x31f, 0x3, 0x2, 0x2, 0x2, 0x321, 0x324, 0x3, 0x2, 0x2, 
-    0x2, 0x322, 0x320, 0x3, 0x2, 0x2, 0x2, 0x322, 0x323, 0x3, 0x2, 0x2, 
-    0x2, 0x323, 0x325, 0x3, 0x2, 0x2, 0x2, 0x324, 0x322, 0x3, 0x2, 0x2, 
-    0x2, 0x325, 0x327, 0x7, 0x62, 0x2, 0x2, 0x326, 0x31e, 0x3, 0x2, 0x2, 
-    0x2, 0x327, 0x328, 0x3, 0x2, 0x2, 0x2, 0x328, 0x326, 0x3, 0x2, 0x2, 
-    0x2, 0x328, 0x329, 0x3, 0x2, 0x2, 0x2, 0x329, 0xee, 0x3, 0x2, 0x2, 0x2, 
-    0x32a, 0x32c, 0x5, 0xf1, 0x79, 0x2, 0x32b, 0x32a, 0x3, 0x2, 0x2, 0x2, 
-    0x32c, 0x32d, 0x3, 0x2, 0x2, 0x2, 0x32d, 0x32b, 0x3, 0x2, 0x2, 0x2, 
-    0x32d, 0x32e, 0x3, 0x2, 0x2, 0x2, 0x32e, 0xf0, 0x3, 0x2, 0x2, 0x2, 0x32f, 
-    0x33c, 0x5, 0x10d, 0x87, 0x2, 0x330, 0x33c, 0x5, 0x111, 0x89, 0x2, 0x331, 
-    0x33c, 0x5, 0x115, 0x8b, 0x2, 0x332, 0x33c, 0x5, 0x117, 0x8c, 0x2, 0x333, 
-    0x33c, 0x5, 0xf5, 0x7b, 0x2, 0x334, 0x33c, 0x5, 0x109, 0x85, 0x2, 0x335, 
-    0x33c, 0x5, 0x107, 0x84, 0x2, 0x336, 0x33c, 0x5, 0x105, 0x83, 0x2, 0x337, 
-    0x33c, 0x5, 0xf9, 0x7d, 0x2, 0x338, 0x33c, 0x5, 0x119, 0x8d, 0x2, 0x339, 
-    0x33c, 0x9, 0x1a, 0x2, 0x2, 0x33a, 0x33c, 0x5, 0xf3, 0x7a, 0x2, 0x33b, 
-    0x32f, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x330, 0x3, 0x2, 0x2, 0x2, 0x33b, 
-    0x331, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x332, 0x3, 0x2, 0x2, 0x2, 0x33b, 
-    0x333, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x334, 0x3, 0x2, 0x2, 0x2, 0x33b, 
-    0x335, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x336, 0x3, 0x2, 0x2, 0x2, 0x33b, 
-    0x337, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x338, 0x3, 0x2, 0x2, 0x2, 0x33b, 
-    0x339, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x33a, 0x3, 0x2, 0x2, 0x2, 0x33c, 
-    0xf2, 0x3, 0x2, 0x2, 0x2, 0x33d, 0x33e, 0x7, 0x31, 0x2, 0x2, 0x33e, 
-    0x33f, 0x7, 0x2c, 0x2, 0x2, 0x33f, 0x345, 0x3, 0x2, 0x2, 0x2, 0x340, 
-    0x344, 0x5, 0xfd, 0x7f, 0x2, 0x341, 0x342, 0x7, 0x2c, 0x2, 0x2, 0x342, 
-    0x344, 0x5, 0x103, 0x82, 0x2, 0x343, 0x340, 0x3, 0x2, 0x2, 0x2, 0x343, 
-    0x341, 0x3, 0x2, 0x2, 0x2, 0x344, 0x347, 0x3, 0x2, 0x2, 0x2, 0x345, 
-    0x343, 0x3, 0x2, 0x2, 0x2, 0x345, 0x346, 0x3, 0x2, 0x2, 0x2, 0x346, 
-    0x348, 0x3, 0x2, 0x2, 0x2, 0x347, 0x345, 0x3, 0x2, 0x2, 0x2, 0x348, 
-    0x349, 0x7, 0x2c, 0x2, 0x2, 0x349, 0x35b, 0x7, 0x31, 0x2, 0x2, 0x34a, 
-    0x34b, 0x7, 0x31, 0x2, 0x2, 0x34b, 0x34c, 0x7, 0x31, 0x2, 0x2, 0x34c, 
-    0x350, 0x3, 0x2, 0x2, 0x2, 0x34d, 0x34f, 0x5, 0x101, 0x81, 0x2, 0x34e, 
-    0x34d, 0x3, 0x2, 0x2, 0x2, 0x34f, 0x352, 0x3, 0x2, 0x2, 0x2, 0x350, 
-    0x34e, 0x3, 0x2, 0x2, 0x2, 0x350, 0x351, 0x3, 0x2, 0x2, 0x2, 0x351, 
-    0x354, 0x3, 0x2, 0x2, 0x2, 0x352, 0x350, 0x3, 0x2, 0x2, 0x2, 0x353, 
-    0x355, 0x5, 0x109, 0x85, 0x2, 0x354, 0x353, 0x3, 0x2, 0x2, 0x2, 0x354, 
-    0x355, 0x3, 0x2, 0x2, 0x2, 0x355, 0x358, 0x3, 0x2, 0x2, 0x2, 0x356, 
-    0x359, 0x5, 0x115, 0x8b, 0x2, 0x357, 0x359, 0x7, 0x2, 0x2, 0x3, 0x358, 
-    0x356, 0x3, 0x2, 0x2, 0x2, 0x358, 0x357, 0x3, 0x2, 0x2, 0x2, 0x359, 
-    0x35b, 0x3, 0x2, 0x2, 0x2, 0x35a, 0x33d, 0x3, 0x2, 0x2, 0x2, 0x35a, 
-    0x34a, 0x3, 0x2, 0x2, 0x2, 0x35b, 0xf4, 0x3, 0x2, 0x2, 0x2, 0x35c, 0x35d, 
-    0x9, 0x1b, 0x2, 0x2, 0x35d, 0xf6, 0x3, 0x2, 0x2, 0x2, 0x35e, 0x35f, 
-    0xa, 0x1c, 0x2, 0x2, 0x35f, 0xf8, 0x3, 0x2, 0x2, 0x2, 0x360, 0x361, 
-    0x9, 0x1d, 0x2, 0x2, 0x361, 0xfa, 0x3, 0x2, 0x2, 0x2, 0x362, 0x363, 
-    0x9, 0x2d, 0x2, 0x2, 0x363, 0xfc, 0x3, 0x2, 0x2, 0x2, 0x364, 0x365, 
-    0xa, 0x1e, 0x2, 0x2, 0x365, 0xfe, 0x3, 0x2, 0x2, 0x2, 0x366, 0x367, 
-    0xa, 0x1f, 0x2, 0x2, 0x367, 0x100, 0x3, 0x2, 0x2, 0x2, 0x368, 0x369, 
-    0xa, 0x20, 0x2, 0x2, 0x369, 0x102, 0x3, 0x2, 0x2, 0x2, 0x36a, 0x36b, 
-    0xa, 0x21, 0x2, 0x2, 0x36b, 0x104, 0x3, 0x2, 0x2, 0x2, 0x36c, 0x36d, 
-    0x9, 0x22, 0x2, 0x2, 0x36d, 0x106, 0x3, 0x2, 0x2, 0x2, 0x36e, 0x36f, 
-    0x9, 0x23, 0x2, 0x2, 0x36f, 0x108, 0x3, 0x2, 0x2, 0x2, 0x370, 0x371, 
-    0x9, 0x24, 0x2, 0x2, 0x371, 0x10a, 0x3, 0x2, 0x2, 0x2, 0x372, 0x373, 
-    0x9, 0x25, 0x2, 0x2, 0x373, 0x10c, 0x3, 0x2, 0x2, 0x2, 0x374, 0x375, 
-    0x9, 0x26, 0x2, 0x2, 0x375, 0x10e, 0x3, 0x2, 0x2, 0x2, 0x376, 0x377, 
-    0x9, 0x27, 0x2, 0x2, 0x377, 0x110, 0x3, 0x2, 0x2, 0x2, 0x378, 0x379, 
-    0x9, 0x28, 0x2, 0x2, 0x379, 0x112, 0x3, 0x2, 0x2, 0x2, 0x37a, 0x37b, 
-    0xa, 0x29, 0x2, 0x2, 0x37b, 0x114, 0x3, 0x2, 0x2, 0x2, 0x37c, 0x37d, 
-    0x9, 0x2a, 0x2, 0x2, 0x37d, 0x116, 0x3, 0x2, 0x2, 0x2, 0x37e, 0x37f, 
-    0x9, 0x2b, 0x2, 0x2, 0x37f, 0x118, 0x3, 0x2, 0x2, 0x2, 0x380, 0x381, 
-    0x9, 0x2c, 0x2, 0x2, 0x381, 0x11a, 0x3, 0x2, 0x2, 0x2, 0x382, 0x383, 
-    0x9, 0x2e, 0x2, 0x2, 0x383, 0x11c, 0x3, 0x2, 0x2, 0x2, 0x384, 0x385, 
-    0xb, 0x2, 0x2, 0x2, 0x385, 0x11e, 0x3, 0x2, 0x2, 0x2, 0x1e, 0x2, 0x2c1, 
-    0x2c3, 0x2ca, 0x2cc, 0x2d0, 0x2e4, 0x2eb, 0x2ee, 0x2f1, 0x2f5, 0x2f9, 
-    0x2fd, 0x306, 0x30d, 0x313, 0x318, 0x31c, 0x322, 0x328, 0x32d, 0x33b, 
-    0x343, 0x345, 0x350, 0x354, 0x358, 0x35a, 0x2, 
+    0x2f3, 0x3, 0x2, 0x2, 0x2, 0x2f5, 0x2f4, 0x3, 0x2, 0x2, 0x2, 0x2f6, 0xdc, 
+    0x3, 0x2, 0x2, 0x2, 0x2f7, 0x2fa, 0x5, 0xe3, 0x72, 0x2, 0x2f8, 0x2fa, 
+    0x5, 0xdf, 0x70, 0x2, 0x2f9, 0x2f7, 0x3, 0x2, 0x2, 0x2, 0x2f9, 0x2f8, 
+    0x3, 0x2, 0x2, 0x2, 0x2fa, 0xde, 0x3, 0x2, 0x2, 0x2, 0x2fb, 0x2fe, 0x5, 
+    0xe1, 0x71, 0x2, 0x2fc, 0x2fe, 0x4, 0x3a, 0x3b, 0x2, 0x2fd, 0x2fb, 0x3, 
+    0x2, 0x2, 0x2, 0x2fd, 0x2fc, 0x3, 0x2, 0x2, 0x2, 0x2fe, 0xe0, 0x3, 0x2, 
+    0x2, 0x2, 0x2ff, 0x300, 0x4, 0x33, 0x39, 0x2, 0x300, 0xe2, 0x3, 0x2, 0x2, 
+    0x2, 0x301, 0x302, 0x7, 0x32, 0x2, 0x2, 0x302, 0xe4, 0x3, 0x2, 0x2, 0x2, 
+    0x303, 0x305, 0x5, 0xdd, 0x6f, 0x2, 0x304, 0x303, 0x3, 0x2, 0x2, 0x2, 
+    0x305, 0x308, 0x3, 0x2, 0x2, 0x2, 0x306, 0x304, 0x3, 0x2, 0x2, 0x2, 
+    0x306, 0x307, 0x3, 0x2, 0x2, 0x2, 0x307, 0x309, 0x3, 0x2, 0x2, 0x2, 
+    0x308, 0x306, 0x3, 0x2, 0x2, 0x2, 0x309, 0x30b, 0x7, 0x30, 0x2, 0x2, 
+    0x30a, 0x30c, 0x5, 0xdd, 0x6f, 0x2, 0x30b, 0x30a, 0x3, 0x2, 0x2, 0x2, 
+    0x30c, 0x30d, 0x3, 0x2, 0x2, 0x2, 0x30d, 0x30b, 0x3, 0x2, 0x2, 0x2, 
+    0x30d, 0x30e, 0x3, 0x2, 0x2, 0x2, 0x30e, 0xe6, 0x3, 0x2, 0x2, 0x2, 0x30f, 
+    0x313, 0x5, 0xe9, 0x75, 0x2, 0x310, 0x312, 0x5, 0xeb, 0x76, 0x2, 0x311, 
+    0x310, 0x3, 0x2, 0x2, 0x2, 0x312, 0x315, 0x3, 0x2, 0x2, 0x2, 0x313, 
+    0x311, 0x3, 0x2, 0x2, 0x2, 0x313, 0x314, 0x3, 0x2, 0x2, 0x2, 0x314, 0xe8, 
+    0x3, 0x2, 0x2, 0x2, 0x315, 0x313, 0x3, 0x2, 0x2, 0x2, 0x316, 0x319, 0x5, 
+    0x11b, 0x8e, 0x2, 0x317, 0x319, 0x5, 0x10f, 0x88, 0x2, 0x318, 0x316, 0x3, 
+    0x2, 0x2, 0x2, 0x318, 0x317, 0x3, 0x2, 0x2, 0x2, 0x319, 0xea, 0x3, 0x2, 
+    0x2, 0x2, 0x31a, 0x31d, 0x5, 0xfb, 0x7e, 0x2, 0x31b, 0x31d, 0x5, 0x10b, 
+    0x86, 0x2, 0x31c, 0x31a, 0x3, 0x2, 0x2, 0x2, 0x31c, 0x31b, 0x3, 0x2, 0x2, 
+    0x2, 0x31d, 0xec, 0x3, 0x2, 0x2, 0x2, 0x31e, 0x322, 0x7, 0x62, 0x2, 0x2, 
+    0x31f, 0x321, 0x5, 0xf7, 0x7c, 0x2, 0x320, 0x31f, 0x3, 0x2, 0x2, 0x2, 
+    0x321, 0x324, 0x3, 0x2, 0x2, 0x2, 0x322, 0x320, 0x3, 0x2, 0x2, 0x2, 
+    0x322, 0x323, 0x3, 0x2, 0x2, 0x2, 0x323, 0x325, 0x3, 0x2, 0x2, 0x2, 
+    0x324, 0x322, 0x3, 0x2, 0x2, 0x2, 0x325, 0x327, 0x7, 0x62, 0x2, 0x2, 
+    0x326, 0x31e, 0x3, 0x2, 0x2, 0x2, 0x327, 0x328, 0x3, 0x2, 0x2, 0x2, 
+    0x328, 0x326, 0x3, 0x2, 0x2, 0x2, 0x328, 0x329, 0x3, 0x2, 0x2, 0x2, 
+    0x329, 0xee, 0x3, 0x2, 0x2, 0x2, 0x32a, 0x32c, 0x5, 0xf1, 0x79, 0x2, 
+    0x32b, 0x32a, 0x3, 0x2, 0x2, 0x2, 0x32c, 0x32d, 0x3, 0x2, 0x2, 0x2, 
+    0x32d, 0x32b, 0x3, 0x2, 0x2, 0x2, 0x32d, 0x32e, 0x3, 0x2, 0x2, 0x2, 
+    0x32e, 0xf0, 0x3, 0x2, 0x2, 0x2, 0x32f, 0x33c, 0x5, 0x10d, 0x87, 0x2, 
+    0x330, 0x33c, 0x5, 0x111, 0x89, 0x2, 0x331, 0x33c, 0x5, 0x115, 0x8b, 0x2, 
+    0x332, 0x33c, 0x5, 0x117, 0x8c, 0x2, 0x333, 0x33c, 0x5, 0xf5, 0x7b, 0x2, 
+    0x334, 0x33c, 0x5, 0x109, 0x85, 0x2, 0x335, 0x33c, 0x5, 0x107, 0x84, 0x2, 
+    0x336, 0x33c, 0x5, 0x105, 0x83, 0x2, 0x337, 0x33c, 0x5, 0xf9, 0x7d, 0x2, 
+    0x338, 0x33c, 0x5, 0x119, 0x8d, 0x2, 0x339, 0x33c, 0x9, 0x1a, 0x2, 0x2, 
+    0x33a, 0x33c, 0x5, 0xf3, 0x7a, 0x2, 0x33b, 0x32f, 0x3, 0x2, 0x2, 0x2, 
+    0x33b, 0x330, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x331, 0x3, 0x2, 0x2, 0x2, 
+    0x33b, 0x332, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x333, 0x3, 0x2, 0x2, 0x2, 
+    0x33b, 0x334, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x335, 0x3, 0x2, 0x2, 0x2, 
+    0x33b, 0x336, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x337, 0x3, 0x2, 0x2, 0x2, 
+    0x33b, 0x338, 0x3, 0x2, 0x2, 0x2, 0x33b, 0x339, 0x3, 0x2, 0x2, 0x2, 
+    0x33b, 0x33a, 0x3, 0x2, 0x2, 0x2, 0x33c, 0xf2, 0x3, 0x2, 0x2, 0x2, 0x33d, 
+    0x33e, 0x7, 0x31, 0x2, 0x2, 0x33e, 0x33f, 0x7, 0x2c, 0x2, 0x2, 0x33f, 
+    0x345, 0x3, 0x2, 0x2, 0x2, 0x340, 0x344, 0x5, 0xfd, 0x7f, 0x2, 0x341, 
+    0x342, 0x7, 0x2c, 0x2, 0x2, 0x342, 0x344, 0x5, 0x103, 0x82, 0x2, 0x343, 
+    0x340, 0x3, 0x2, 0x2, 0x2, 0x343, 0x341, 0x3, 0x2, 0x2, 0x2, 0x344, 
+    0x347, 0x3, 0x2, 0x2, 0x2, 0x345, 0x343, 0x3, 0x2, 0x2, 0x2, 0x345, 
+    0x346, 0x3, 0x2, 0x2, 0x2, 0x346, 0x348, 0x3, 0x2, 0x2, 0x2, 0x347, 
+    0x345, 0x3, 0x2, 0x2, 0x2, 0x348, 0x349, 0x7, 0x2c, 0x2, 0x2, 0x349, 
+    0x35b, 0x7, 0x31, 0x2, 0x2, 0x34a, 0x34b, 0x7, 0x31, 0x2, 0x2, 0x34b, 
+    0x34c, 0x7, 0x31, 0x2, 0x2, 0x34c, 0x350, 0x3, 0x2, 0x2, 0x2, 0x34d, 
+    0x34f, 0x5, 0x101, 0x81, 0x2, 0x34e, 0x34d, 0x3, 0x2, 0x2, 0x2, 0x34f, 
+    0x352, 0x3, 0x2, 0x2, 0x2, 0x350, 0x34e, 0x3, 0x2, 0x2, 0x2, 0x350, 
+    0x351, 0x3, 0x2, 0x2, 0x2, 0x351, 0x354, 0x3, 0x2, 0x2, 0x2, 0x352, 
+    0x350, 0x3, 0x2, 0x2, 0x2, 0x353, 0x355, 0x5, 0x109, 0x85, 0x2, 0x354, 
+    0x353, 0x3, 0x2, 0x2, 0x2, 0x354, 0x355, 0x3, 0x2, 0x2, 0x2, 0x355, 
+    0x358, 0x3, 0x2, 0x2, 0x2, 0x356, 0x359, 0x5, 0x115, 0x8b, 0x2, 0x357, 
+    0x359, 0x7, 0x2, 0x2, 0x3, 0x358, 0x356, 0x3, 0x2, 0x2, 0x2, 0x358, 
+    0x357, 0x3, 0x2, 0x2, 0x2, 0x359, 0x35b, 0x3, 0x2, 0x2, 0x2, 0x35a, 
+    0x33d, 0x3, 0x2, 0x2, 0x2, 0x35a, 0x34a, 0x3, 0x2, 0x2, 0x2, 0x35b, 0xf4, 
+    0x3, 0x2, 0x2, 0x2, 0x35c, 0x35d, 0x9, 0x1b, 0x2, 0x2, 0x35d, 0xf6, 0x3, 
+    0x2, 0x2, 0x2, 0x35e, 0x35f, 0xa, 0x1c, 0x2, 0x2, 0x35f, 0xf8, 0x3, 0x2, 
+    0x2, 0x2, 0x360, 0x361, 0x9, 0x1d, 0x2, 0x2, 0x361, 0xfa, 0x3, 0x2, 0x2, 
+    0x2, 0x362, 0x363, 0x9, 0x2d, 0x2, 0x2, 0x363, 0xfc, 0x3, 0x2, 0x2, 0x2, 
+    0x364, 0x365, 0xa, 0x1e, 0x2, 0x2, 0x365, 0xfe, 0x3, 0x2, 0x2, 0x2, 
+    0x366, 0x367, 0xa, 0x1f, 0x2, 0x2, 0x367, 0x100, 0x3, 0x2, 0x2, 0x2, 
+    0x368, 0x369, 0xa, 0x20, 0x2, 0x2, 0x369, 0x102, 0x3, 0x2, 0x2, 0x2, 
+    0x36a, 0x36b, 0xa, 0x21, 0x2, 0x2, 0x36b, 0x104, 0x3, 0x2, 0x2, 0x2, 
+    0x36c, 0x36d, 0x9, 0x22, 0x2, 0x2, 0x36d, 0x106, 0x3, 0x2, 0x2, 0x2, 
+    0x36e, 0x36f, 0x9, 0x23, 0x2, 0x2, 0x36f, 0x108, 0x3, 0x2, 0x2, 0x2, 
+    0x370, 0x371, 0x9, 0x24, 0x2, 0x2, 0x371, 0x10a, 0x3, 0x2, 0x2, 0x2, 
+    0x372, 0x373, 0x9, 0x25, 0x2, 0x2, 0x373, 0x10c, 0x3, 0x2, 0x2, 0x2, 
+    0x374, 0x375, 0x9, 0x26, 0x2, 0x2, 0x375, 0x10e, 0x3, 0x2, 0x2, 0x2, 
+    0x376, 0x377, 0x9, 0x27, 0x2, 0x2, 0x377, 0x110, 0x3, 0x2, 0x2, 0x2, 
+    0x378, 0x379, 0x9, 0x28, 0x2, 0x2, 0x379, 0x112, 0x3, 0x2, 0x2, 0x2, 
+    0x37a, 0x37b, 0xa, 0x29, 0x2, 0x2, 0x37b, 0x114, 0x3, 0x2, 0x2, 0x2, 
+    0x37c, 0x37d, 0x9, 0x2a, 0x2, 0x2, 0x37d, 0x116, 0x3, 0x2, 0x2, 0x2, 
+    0x37e, 0x37f, 0x9, 0x2b, 0x2, 0x2, 0x37f, 0x118, 0x3, 0x2, 0x2, 0x2, 
+    0x380, 0x381, 0x9, 0x2c, 0x2, 0x2, 0x381, 0x11a, 0x3, 0x2, 0x2, 0x2, 
+    0x382, 0x383, 0x9, 0x2e, 0x2, 0x2, 0x383, 0x11c, 0x3, 0x2, 0x2, 0x2, 
+    0x384, 0x385, 0xb, 0x2, 0x2, 0x2, 0x385, 0x11e, 0x3, 0x2, 0x2, 0x2, 
+    0x386, 0x388, 0x3, 0x2, 0x2, 0x2, 0x388, 0x389, 0x9, 0x12, 0x2, 0x2, 
+    0x389, 0x38a, 0x9, 0xc, 0x2, 0x2, 0x38a, 0x38b, 0x9, 0xd, 0x2, 0x2, 
+    0x38b, 0x38c, 0x9, 0xe, 0x2, 0x2, 0x38c, 0x38d, 0x9, 0x14, 0x2, 0x2, 
+    0x38d, 0x387, 0x3, 0x2, 0x2, 0x2, 0x38e, 0x390, 0x3, 0x2, 0x2, 0x2, 
+    0x390, 0x391, 0x9, 0x4, 0x2, 0x2, 0x391, 0x392, 0x9, 0xc, 0x2, 0x2, 
+    0x392, 0x38f, 0x3, 0x2, 0x2, 0x2, 0x1e, 0x2, 0x2c1, 0x2c3, 0x2ca, 0x2cc, 
+    0x2d0, 0x2e4, 0x2eb, 0x2ee, 0x2f1, 0x2f5, 0x2f9, 0x2fd, 0x306, 0x30d, 
+    0x313, 0x318, 0x31c, 0x322, 0x328, 0x32d, 0x33b, 0x343, 0x345, 0x350, 
+    0x354, 0x358, 0x35a, 0x2, 
   };
 
   atn::ATNDeserializer deserializer;
@@ -642,6 +642,10 @@ CypherParser::KU_AlterTableContext* CypherParser::KU_DDLContext::kU_AlterTable()
   return getRuleContext<CypherParser::KU_AlterTableContext>(0);
 }
 
+CypherParser::KU_CreateIndexContext* CypherParser::KU_DDLContext::kU_CreateIndex() {
+  return getRuleContext<CypherParser::KU_CreateIndexContext>(0);
+}
+
 
 size_t CypherParser::KU_DDLContext::getRuleIndex() const {
   return CypherParser::RuleKU_DDL;
@@ -691,6 +695,13 @@ CypherParser::KU_DDLContext* CypherParser::kU_DDL() {
       break;
     }
 
+    case 5: {
+      enterOuterAlt(_localctx, 5);
+      setState(1604);
+      kU_CreateIndex();
+      break;
+    }
+
     default:
       break;
     }
@@ -9784,6 +9795,115 @@ CypherParser::OC_DashContext* CypherParser::oC_Dash() {
   return _localctx;
 }
 
+//----------------- KU_CreateIndexContext ------------------------------------------------------------------
+
+CypherParser::KU_CreateIndexContext::KU_CreateIndexContext(ParserRuleContext *parent, size_t invokingState)
+  : ParserRuleContext(parent, invokingState) {
+}
+
+tree::TerminalNode* CypherParser::KU_CreateIndexContext::CREATE() {
+  return getToken(CypherParser::CREATE, 0);
+}
+
+std::vector<tree::TerminalNode *> CypherParser::KU_CreateIndexContext::SP() {
+  return getTokens(CypherParser::SP);
+}
+
+tree::TerminalNode* CypherParser::KU_CreateIndexContext::SP(size_t i) {
+  return getToken(CypherParser::SP, i);
+}
+
+tree::TerminalNode* CypherParser::KU_CreateIndexContext::INDEX() {
+  return getToken(CypherParser::INDEX, 0);
+}
+
+tree::TerminalNode* CypherParser::KU_CreateIndexContext::ON() {
+  return getToken(CypherParser::ON, 0);
+}
+
+CypherParser::OC_SchemaNameContext* CypherParser::KU_CreateIndexContext::oC_SchemaName() {
+  return getRuleContext<CypherParser::OC_SchemaNameContext>(0);
+}
+
+CypherParser::OC_PropertyKeyNameContext* CypherParser::KU_CreateIndexContext::oC_PropertyKeyName() {
+  return getRuleContext<CypherParser::OC_PropertyKeyNameContext>(0);
+}
+
+
+size_t CypherParser::KU_CreateIndexContext::getRuleIndex() const {
+  return CypherParser::RuleKU_CreateIndex;
+}
+
+
+CypherParser::KU_CreateIndexContext* CypherParser::kU_CreateIndex() {
+  KU_CreateIndexContext *_localctx = _tracker.createInstance<KU_CreateIndexContext>(_ctx, getState());
+  enterRule(_localctx, 1582, CypherParser::RuleKU_CreateIndex);
+  size_t _la = 0;
+
+#if __cplusplus > 201703L
+  auto onExit = finally([=, this] {
+#else
+  auto onExit = finally([=] {
+#endif
+    exitRule();
+  });
+  try {
+    enterOuterAlt(_localctx, 1);
+    setState(1584);
+    match(CypherParser::CREATE);
+    setState(1585);
+    match(CypherParser::SP);
+    setState(1586);
+    match(CypherParser::INDEX);
+    setState(1587);
+    match(CypherParser::SP);
+    setState(1588);
+    match(CypherParser::ON);
+    setState(1589);
+    match(CypherParser::SP);
+    setState(1590);
+    oC_SchemaName();
+    setState(1592);
+    _errHandler->sync(this);
+
+    _la = _input->LA(1);
+    if (_la == CypherParser::SP) {
+      setState(1591);
+      match(CypherParser::SP);
+    }
+    setState(1594);
+    match(CypherParser::T__1);
+    setState(1596);
+    _errHandler->sync(this);
+
+    _la = _input->LA(1);
+    if (_la == CypherParser::SP) {
+      setState(1595);
+      match(CypherParser::SP);
+    }
+    setState(1598);
+    oC_PropertyKeyName();
+    setState(1600);
+    _errHandler->sync(this);
+
+    _la = _input->LA(1);
+    if (_la == CypherParser::SP) {
+      setState(1599);
+      match(CypherParser::SP);
+    }
+    setState(1602);
+    match(CypherParser::T__2);
+   
+  }
+  catch (RecognitionException &e) {
+    _errHandler->reportError(this, e);
+    _localctx->exception = std::current_exception();
+    _errHandler->recover(this, _localctx->exception);
+  }
+
+  return _localctx;
+}
+
 // Static vars and initialization.
 std::vector<dfa::DFA> CypherParser::_decisionToDFA;
 atn::PredictionContextCache CypherParser::_sharedContextCache;
@@ -9821,7 +9941,7 @@ std::vector<std::string> CypherParser::_ruleNames = {
   "oC_PropertyLookup", "oC_CaseExpression", "oC_CaseAlternative", "oC_Variable", 
   "oC_NumberLiteral", "oC_Parameter", "oC_PropertyExpression", "oC_PropertyKeyName", 
   "oC_IntegerLiteral", "oC_DoubleLiteral", "oC_SchemaName", "oC_SymbolicName", 
-  "oC_LeftArrowHead", "oC_RightArrowHead", "oC_Dash"
+  "oC_LeftArrowHead", "oC_RightArrowHead", "oC_Dash", "kU_CreateIndex"
 };
 
 std::vector<std::string> CypherParser::_literalNames = {
@@ -9851,7 +9971,7 @@ std::vector<std::string> CypherParser::_symbolicNames = {
   "DecimalInteger", "HexLetter", "HexDigit", "Digit", "NonZeroDigit", "NonZeroOctDigit", 
   "ZeroDigit", "RegularDecimalReal", "UnescapedSymbolicName", "IdentifierStart", 
   "IdentifierPart", "EscapedSymbolicName", "SP", "WHITESPACE", "Comment", 
-  "Unknown"
+  "Unknown", "INDEX", "ON"
 };
 
 dfa::Vocabulary CypherParser::_vocabulary(_literalNames, _symbolicNames);
@@ -9874,603 +9994,602 @@ CypherParser::Initializer::Initializer() {
 
   _serializedATN = {
     0x3, 0x608b, 0xa72a, 0x8133, 0xb9ed, 0x417c, 0x3be7, 0x7786, 0x5964, 
-    0x3, 0x7c, 0x630, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 0x4, 
-    0x9, 0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 0x9, 0x7, 
-    0x4, 0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 0x4, 0xb, 
-    0x9, 0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 0x9, 0xe, 
-    0x4, 0xf, 0x9, 0xf, 0x4, 0x10, 0x9, 0x10, 0x4, 0x11, 0x9, 0x11, 0x4, 
-    0x12, 0x9, 0x12, 0x4, 0x13, 0x9, 0x13, 0x4, 0x14, 0x9, 0x14, 0x4, 0x15, 
-    0x9, 0x15, 0x4, 0x16, 0x9, 0x16, 0x4, 0x17, 0x9, 0x17, 0x4, 0x18, 0x9, 
-    0x18, 0x4, 0x19, 0x9, 0x19, 0x4, 0x1a, 0x9, 0x1a, 0x4, 0x1b, 0x9, 0x1b, 
-    0x4, 0x1c, 0x9, 0x1c, 0x4, 0x1d, 0x9, 0x1d, 0x4, 0x1e, 0x9, 0x1e, 0x4, 
-    0x1f, 0x9, 0x1f, 0x4, 0x20, 0x9, 0x20, 0x4, 0x21, 0x9, 0x21, 0x4, 0x22, 
-    0x9, 0x22, 0x4, 0x23, 0x9, 0x23, 0x4, 0x24, 0x9, 0x24, 0x4, 0x25, 0x9, 
-    0x25, 0x4, 0x26, 0x9, 0x26, 0x4, 0x27, 0x9, 0x27, 0x4, 0x28, 0x9, 0x28, 
-    0x4, 0x29, 0x9, 0x29, 0x4, 0x2a, 0x9, 0x2a, 0x4, 0x2b, 0x9, 0x2b, 0x4, 
-    0x2c, 0x9, 0x2c, 0x4, 0x2d, 0x9, 0x2d, 0x4, 0x2e, 0x9, 0x2e, 0x4, 0x2f, 
-    0x9, 0x2f, 0x4, 0x30, 0x9, 0x30, 0x4, 0x31, 0x9, 0x31, 0x4, 0x32, 0x9, 
-    0x32, 0x4, 0x33, 0x9, 0x33, 0x4, 0x34, 0x9, 0x34, 0x4, 0x35, 0x9, 0x35, 
-    0x4, 0x36, 0x9, 0x36, 0x4, 0x37, 0x9, 0x37, 0x4, 0x38, 0x9, 0x38, 0x4, 
-    0x39, 0x9, 0x39, 0x4, 0x3a, 0x9, 0x3a, 0x4, 0x3b, 0x9, 0x3b, 0x4, 0x3c, 
-    0x9, 0x3c, 0x4, 0x3d, 0x9, 0x3d, 0x4, 0x3e, 0x9, 0x3e, 0x4, 0x3f, 0x9, 
-    0x3f, 0x4, 0x40, 0x9, 0x40, 0x4, 0x41, 0x9, 0x41, 0x4, 0x42, 0x9, 0x42, 
-    0x4, 0x43, 0x9, 0x43, 0x4, 0x44, 0x9, 0x44, 0x4, 0x45, 0x9, 0x45, 0x4, 
-    0x46, 0x9, 0x46, 0x4, 0x47, 0x9, 0x47, 0x4, 0x48, 0x9, 0x48, 0x4, 0x49, 
-    0x9, 0x49, 0x4, 0x4a, 0x9, 0x4a, 0x4, 0x4b, 0x9, 0x4b, 0x4, 0x4c, 0x9, 
-    0x4c, 0x4, 0x4d, 0x9, 0x4d, 0x4, 0x4e, 0x9, 0x4e, 0x4, 0x4f, 0x9, 0x4f, 
-    0x4, 0x50, 0x9, 0x50, 0x4, 0x51, 0x9, 0x51, 0x4, 0x52, 0x9, 0x52, 0x4, 
-    0x53, 0x9, 0x53, 0x4, 0x54, 0x9, 0x54, 0x4, 0x55, 0x9, 0x55, 0x4, 0x56, 
-    0x9, 0x56, 0x4, 0x57, 0x9, 0x57, 0x4, 0x58, 0x9, 0x58, 0x4, 0x59, 0x9, 
-    0x59, 0x4, 0x5a, 0x9, 0x5a, 0x4, 0x5b, 0x9, 0x5b, 0x4, 0x5c, 0x9, 0x5c, 
-    0x4, 0x5d, 0x9, 0x5d, 0x4, 0x5e, 0x9, 0x5e, 0x4, 0x5f, 0x9, 0x5f, 0x4, 
-    0x60, 0x9, 0x60, 0x4, 0x61, 0x9, 0x61, 0x4, 0x62, 0x9, 0x62, 0x4, 0x63, 
-    0x9, 0x63, 0x4, 0x64, 0x9, 0x64, 0x4, 0x65, 0x9, 0x65, 0x4, 0x66, 0x9, 
-    0x66, 0x4, 0x67, 0x9, 0x67, 0x4, 0x68, 0x9, 0x68, 0x4, 0x69, 0x9, 0x69, 
-    0x4, 0x6a, 0x9, 0x6a, 0x4, 0x6b, 0x9, 0x6b, 0x4, 0x6c, 0x9, 0x6c, 0x4, 
-    0x6d, 0x9, 0x6d, 0x4, 0x6e, 0x9, 0x6e, 0x4, 0x6f, 0x9, 0x6f, 0x4, 0x70, 
-    0x9, 0x70, 0x4, 0x71, 0x9, 0x71, 0x4, 0x72, 0x9, 0x72, 0x3, 0x2, 0x5, 
-    0x2, 0xe6, 0xa, 0x2, 0x3, 0x2, 0x5, 0x2, 0xe9, 0xa, 0x2, 0x3, 0x2, 0x5, 
-    0x2, 0xec, 0xa, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, 0x2, 0x5, 0x2, 0xf1, 0xa, 
-    0x2, 0x3, 0x2, 0x5, 0x2, 0xf4, 0xa, 0x2, 0x3, 0x2, 0x5, 0x2, 0xf7, 0xa, 
-    0x2, 0x3, 0x2, 0x5, 0x2, 0xfa, 0xa, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, 0x3, 
-    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 
-    0x5, 0x3, 0x106, 0xa, 0x3, 0x3, 0x3, 0x3, 0x3, 0x5, 0x3, 0x10a, 0xa, 
-    0x3, 0x3, 0x3, 0x3, 0x3, 0x5, 0x3, 0x10e, 0xa, 0x3, 0x3, 0x3, 0x3, 0x3, 
-    0x5, 0x3, 0x112, 0xa, 0x3, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x116, 0xa, 
-    0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x11a, 0xa, 0x4, 0x3, 0x4, 0x3, 0x4, 
-    0x5, 0x4, 0x11e, 0xa, 0x4, 0x3, 0x4, 0x7, 0x4, 0x121, 0xa, 0x4, 0xc, 
-    0x4, 0xe, 0x4, 0x124, 0xb, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 
-    0x5, 0x4, 0x12a, 0xa, 0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x12e, 0xa, 
-    0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x132, 0xa, 0x4, 0x3, 0x4, 0x5, 0x4, 
-    0x135, 0xa, 0x4, 0x3, 0x5, 0x3, 0x5, 0x5, 0x5, 0x139, 0xa, 0x5, 0x3, 
-    0x5, 0x3, 0x5, 0x5, 0x5, 0x13d, 0xa, 0x5, 0x3, 0x5, 0x7, 0x5, 0x140, 
-    0xa, 0x5, 0xc, 0x5, 0xe, 0x5, 0x143, 0xb, 0x5, 0x3, 0x6, 0x3, 0x6, 0x5, 
-    0x6, 0x147, 0xa, 0x6, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x14b, 0xa, 0x6, 
-    0x3, 0x6, 0x3, 0x6, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x3, 0x7, 0x5, 0x7, 
-    0x153, 0xa, 0x7, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 
-    0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x15d, 0xa, 0x8, 0x3, 0x8, 0x3, 0x8, 
-    0x5, 0x8, 0x161, 0xa, 0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x165, 0xa, 
-    0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x169, 0xa, 0x8, 0x3, 0x8, 0x3, 0x8, 
-    0x3, 0x8, 0x5, 0x8, 0x16e, 0xa, 0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x9, 0x3, 
-    0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 
-    0x9, 0x17a, 0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x17e, 0xa, 0x9, 
-    0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 
-    0x3, 0x9, 0x5, 0x9, 0x188, 0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x18c, 
-    0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x190, 0xa, 0x9, 0x5, 0x9, 0x192, 
-    0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x196, 0xa, 0x9, 0x3, 0x9, 0x3, 
-    0x9, 0x5, 0x9, 0x19a, 0xa, 0x9, 0x5, 0x9, 0x19c, 0xa, 0x9, 0x3, 0x9, 
-    0x3, 0x9, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 
-    0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 
-    0x3, 0xb, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x5, 0xc, 0x1b2, 0xa, 
-    0xc, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 
-    0xd, 0x3, 0xd, 0x3, 0xd, 0x5, 0xd, 0x1bd, 0xa, 0xd, 0x3, 0xe, 0x3, 0xe, 
-    0x3, 0xe, 0x3, 0xe, 0x3, 0xf, 0x3, 0xf, 0x3, 0xf, 0x3, 0xf, 0x3, 0xf, 
-    0x3, 0xf, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 
-    0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x11, 0x3, 0x11, 0x5, 0x11, 0x1d3, 
-    0xa, 0x11, 0x3, 0x11, 0x3, 0x11, 0x5, 0x11, 0x1d7, 0xa, 0x11, 0x3, 0x11, 
-    0x7, 0x11, 0x1da, 0xa, 0x11, 0xc, 0x11, 0xe, 0x11, 0x1dd, 0xb, 0x11, 
-    0x3, 0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 0x13, 0x3, 0x13, 0x3, 
-    0x13, 0x3, 0x13, 0x5, 0x13, 0x1e7, 0xa, 0x13, 0x3, 0x13, 0x3, 0x13, 
-    0x5, 0x13, 0x1eb, 0xa, 0x13, 0x3, 0x13, 0x3, 0x13, 0x5, 0x13, 0x1ef, 
-    0xa, 0x13, 0x3, 0x13, 0x3, 0x13, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 
-    0x14, 0x5, 0x14, 0x1f7, 0xa, 0x14, 0x3, 0x15, 0x3, 0x15, 0x7, 0x15, 
-    0x1fb, 0xa, 0x15, 0xc, 0x15, 0xe, 0x15, 0x1fe, 0xb, 0x15, 0x3, 0x16, 
-    0x3, 0x16, 0x5, 0x16, 0x202, 0xa, 0x16, 0x3, 0x16, 0x3, 0x16, 0x3, 0x17, 
-    0x3, 0x17, 0x5, 0x17, 0x208, 0xa, 0x17, 0x3, 0x18, 0x3, 0x18, 0x3, 0x19, 
-    0x3, 0x19, 0x3, 0x1a, 0x3, 0x1a, 0x3, 0x1b, 0x3, 0x1b, 0x3, 0x1c, 0x3, 
-    0x1c, 0x5, 0x1c, 0x214, 0xa, 0x1c, 0x3, 0x1c, 0x7, 0x1c, 0x217, 0xa, 
-    0x1c, 0xc, 0x1c, 0xe, 0x1c, 0x21a, 0xb, 0x1c, 0x3, 0x1c, 0x3, 0x1c, 
-    0x5, 0x1c, 0x21e, 0xa, 0x1c, 0x6, 0x1c, 0x220, 0xa, 0x1c, 0xd, 0x1c, 
-    0xe, 0x1c, 0x221, 0x3, 0x1c, 0x3, 0x1c, 0x3, 0x1c, 0x5, 0x1c, 0x227, 
-    0xa, 0x1c, 0x3, 0x1d, 0x3, 0x1d, 0x3, 0x1d, 0x3, 0x1d, 0x5, 0x1d, 0x22d, 
-    0xa, 0x1d, 0x3, 0x1d, 0x3, 0x1d, 0x3, 0x1d, 0x5, 0x1d, 0x232, 0xa, 0x1d, 
-    0x3, 0x1d, 0x5, 0x1d, 0x235, 0xa, 0x1d, 0x3, 0x1e, 0x3, 0x1e, 0x5, 0x1e, 
-    0x239, 0xa, 0x1e, 0x3, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x23d, 0xa, 0x1f, 
-    0x7, 0x1f, 0x23f, 0xa, 0x1f, 0xc, 0x1f, 0xe, 0x1f, 0x242, 0xb, 0x1f, 
-    0x3, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x247, 0xa, 0x1f, 0x7, 0x1f, 
-    0x249, 0xa, 0x1f, 0xc, 0x1f, 0xe, 0x1f, 0x24c, 0xb, 0x1f, 0x3, 0x1f, 
-    0x3, 0x1f, 0x5, 0x1f, 0x250, 0xa, 0x1f, 0x3, 0x1f, 0x7, 0x1f, 0x253, 
-    0xa, 0x1f, 0xc, 0x1f, 0xe, 0x1f, 0x256, 0xb, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 
-    0x259, 0xa, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x25c, 0xa, 0x1f, 0x3, 0x1f, 
-    0x3, 0x1f, 0x5, 0x1f, 0x260, 0xa, 0x1f, 0x7, 0x1f, 0x262, 0xa, 0x1f, 
-    0xc, 0x1f, 0xe, 0x1f, 0x265, 0xb, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x268, 
-    0xa, 0x1f, 0x3, 0x20, 0x3, 0x20, 0x5, 0x20, 0x26c, 0xa, 0x20, 0x6, 0x20, 
-    0x26e, 0xa, 0x20, 0xd, 0x20, 0xe, 0x20, 0x26f, 0x3, 0x20, 0x3, 0x20, 
-    0x3, 0x21, 0x3, 0x21, 0x5, 0x21, 0x276, 0xa, 0x21, 0x7, 0x21, 0x278, 
-    0xa, 0x21, 0xc, 0x21, 0xe, 0x21, 0x27b, 0xb, 0x21, 0x3, 0x21, 0x3, 0x21, 
-    0x5, 0x21, 0x27f, 0xa, 0x21, 0x7, 0x21, 0x281, 0xa, 0x21, 0xc, 0x21, 
-    0xe, 0x21, 0x284, 0xb, 0x21, 0x3, 0x21, 0x3, 0x21, 0x3, 0x22, 0x3, 0x22, 
-    0x3, 0x22, 0x5, 0x22, 0x28b, 0xa, 0x22, 0x3, 0x23, 0x3, 0x23, 0x5, 0x23, 
-    0x28f, 0xa, 0x23, 0x3, 0x24, 0x3, 0x24, 0x5, 0x24, 0x293, 0xa, 0x24, 
-    0x3, 0x24, 0x3, 0x24, 0x5, 0x24, 0x297, 0xa, 0x24, 0x3, 0x24, 0x3, 0x24, 
-    0x5, 0x24, 0x29b, 0xa, 0x24, 0x3, 0x24, 0x5, 0x24, 0x29e, 0xa, 0x24, 
-    0x3, 0x25, 0x3, 0x25, 0x5, 0x25, 0x2a2, 0xa, 0x25, 0x3, 0x25, 0x3, 0x25, 
-    0x3, 0x25, 0x3, 0x25, 0x3, 0x25, 0x3, 0x25, 0x3, 0x26, 0x3, 0x26, 0x5, 
-    0x26, 0x2ac, 0xa, 0x26, 0x3, 0x26, 0x3, 0x26, 0x3, 0x27, 0x3, 0x27, 
-    0x5, 0x27, 0x2b2, 0xa, 0x27, 0x3, 0x27, 0x3, 0x27, 0x5, 0x27, 0x2b6, 
-    0xa, 0x27, 0x3, 0x27, 0x3, 0x27, 0x5, 0x27, 0x2ba, 0xa, 0x27, 0x3, 0x27, 
-    0x7, 0x27, 0x2bd, 0xa, 0x27, 0xc, 0x27, 0xe, 0x27, 0x2c0, 0xb, 0x27, 
-    0x3, 0x28, 0x3, 0x28, 0x5, 0x28, 0x2c4, 0xa, 0x28, 0x3, 0x28, 0x3, 0x28, 
-    0x5, 0x28, 0x2c8, 0xa, 0x28, 0x3, 0x28, 0x3, 0x28, 0x3, 0x29, 0x3, 0x29, 
-    0x5, 0x29, 0x2ce, 0xa, 0x29, 0x3, 0x29, 0x3, 0x29, 0x5, 0x29, 0x2d2, 
-    0xa, 0x29, 0x3, 0x29, 0x3, 0x29, 0x5, 0x29, 0x2d6, 0xa, 0x29, 0x3, 0x29, 
-    0x7, 0x29, 0x2d9, 0xa, 0x29, 0xc, 0x29, 0xe, 0x29, 0x2dc, 0xb, 0x29, 
-    0x3, 0x2a, 0x3, 0x2a, 0x3, 0x2a, 0x5, 0x2a, 0x2e1, 0xa, 0x2a, 0x3, 0x2a, 
-    0x5, 0x2a, 0x2e4, 0xa, 0x2a, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2c, 
-    0x5, 0x2c, 0x2ea, 0xa, 0x2c, 0x3, 0x2c, 0x5, 0x2c, 0x2ed, 0xa, 0x2c, 
-    0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x5, 0x2c, 0x2f3, 0xa, 0x2c, 
-    0x3, 0x2c, 0x3, 0x2c, 0x5, 0x2c, 0x2f7, 0xa, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 
-    0x5, 0x2c, 0x2fb, 0xa, 0x2c, 0x3, 0x2d, 0x3, 0x2d, 0x5, 0x2d, 0x2ff, 
-    0xa, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x5, 0x2d, 0x303, 0xa, 0x2d, 0x3, 0x2d, 
-    0x7, 0x2d, 0x306, 0xa, 0x2d, 0xc, 0x2d, 0xe, 0x2d, 0x309, 0xb, 0x2d, 
-    0x3, 0x2d, 0x3, 0x2d, 0x5, 0x2d, 0x30d, 0xa, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 
-    0x5, 0x2d, 0x311, 0xa, 0x2d, 0x3, 0x2d, 0x7, 0x2d, 0x314, 0xa, 0x2d, 
-    0xc, 0x2d, 0xe, 0x2d, 0x317, 0xb, 0x2d, 0x5, 0x2d, 0x319, 0xa, 0x2d, 
-    0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 
-    0x2e, 0x5, 0x2e, 0x322, 0xa, 0x2e, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 
-    0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x5, 0x2f, 0x32b, 0xa, 0x2f, 
-    0x3, 0x2f, 0x7, 0x2f, 0x32e, 0xa, 0x2f, 0xc, 0x2f, 0xe, 0x2f, 0x331, 
-    0xb, 0x2f, 0x3, 0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 0x31, 0x3, 
-    0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x32, 0x3, 0x32, 0x5, 0x32, 0x33d, 
-    0xa, 0x32, 0x3, 0x32, 0x5, 0x32, 0x340, 0xa, 0x32, 0x3, 0x33, 0x3, 0x33, 
-    0x3, 0x33, 0x3, 0x33, 0x3, 0x34, 0x3, 0x34, 0x5, 0x34, 0x348, 0xa, 0x34, 
-    0x3, 0x34, 0x3, 0x34, 0x5, 0x34, 0x34c, 0xa, 0x34, 0x3, 0x34, 0x7, 0x34, 
-    0x34f, 0xa, 0x34, 0xc, 0x34, 0xe, 0x34, 0x352, 0xb, 0x34, 0x3, 0x35, 
-    0x3, 0x35, 0x3, 0x36, 0x3, 0x36, 0x3, 0x37, 0x3, 0x37, 0x5, 0x37, 0x35a, 
-    0xa, 0x37, 0x3, 0x37, 0x7, 0x37, 0x35d, 0xa, 0x37, 0xc, 0x37, 0xe, 0x37, 
-    0x360, 0xb, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x5, 0x37, 
-    0x366, 0xa, 0x37, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x36a, 0xa, 0x38, 
-    0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x36e, 0xa, 0x38, 0x5, 0x38, 0x370, 
-    0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x374, 0xa, 0x38, 0x5, 0x38, 
-    0x376, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x37a, 0xa, 0x38, 
-    0x5, 0x38, 0x37c, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x380, 
-    0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x384, 0xa, 0x38, 0x5, 0x38, 
-    0x386, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x38a, 0xa, 0x38, 
-    0x5, 0x38, 0x38c, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x390, 
-    0xa, 0x38, 0x5, 0x38, 0x392, 0xa, 0x38, 0x3, 0x38, 0x5, 0x38, 0x395, 
-    0xa, 0x38, 0x3, 0x39, 0x3, 0x39, 0x5, 0x39, 0x399, 0xa, 0x39, 0x3, 0x39, 
-    0x3, 0x39, 0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x39f, 0xa, 0x3a, 0x3, 0x3a, 
-    0x3, 0x3a, 0x5, 0x3a, 0x3a3, 0xa, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3a6, 
-    0xa, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3a9, 0xa, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 
-    0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3af, 0xa, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 
-    0x3b2, 0xa, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3b5, 0xa, 0x3a, 0x3, 0x3a, 
-    0x3, 0x3a, 0x5, 0x3a, 0x3b9, 0xa, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 
-    0x3bd, 0xa, 0x3a, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3c1, 0xa, 0x3b, 
-    0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3c5, 0xa, 0x3b, 0x5, 0x3b, 0x3c7, 
-    0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3cb, 0xa, 0x3b, 0x5, 0x3b, 
-    0x3cd, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3d1, 0xa, 0x3b, 
-    0x5, 0x3b, 0x3d3, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3d7, 
-    0xa, 0x3b, 0x5, 0x3b, 0x3d9, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x3, 0x3c, 
-    0x3, 0x3c, 0x5, 0x3c, 0x3df, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 
-    0x3e3, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3e7, 0xa, 0x3c, 
-    0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3eb, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 
-    0x5, 0x3c, 0x3ef, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3f3, 
-    0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3f7, 0xa, 0x3c, 0x3, 0x3c, 
-    0x3, 0x3c, 0x5, 0x3c, 0x3fb, 0xa, 0x3c, 0x7, 0x3c, 0x3fd, 0xa, 0x3c, 
-    0xc, 0x3c, 0xe, 0x3c, 0x400, 0xb, 0x3c, 0x5, 0x3c, 0x402, 0xa, 0x3c, 
-    0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3d, 0x3, 0x3d, 0x5, 0x3d, 0x408, 0xa, 0x3d, 
-    0x3, 0x3d, 0x3, 0x3d, 0x5, 0x3d, 0x40c, 0xa, 0x3d, 0x3, 0x3d, 0x3, 0x3d, 
-    0x5, 0x3d, 0x410, 0xa, 0x3d, 0x3, 0x3d, 0x5, 0x3d, 0x413, 0xa, 0x3d, 
-    0x3, 0x3d, 0x7, 0x3d, 0x416, 0xa, 0x3d, 0xc, 0x3d, 0xe, 0x3d, 0x419, 
-    0xb, 0x3d, 0x3, 0x3e, 0x3, 0x3e, 0x5, 0x3e, 0x41d, 0xa, 0x3e, 0x3, 0x3e, 
-    0x7, 0x3e, 0x420, 0xa, 0x3e, 0xc, 0x3e, 0xe, 0x3e, 0x423, 0xb, 0x3e, 
-    0x3, 0x3f, 0x3, 0x3f, 0x5, 0x3f, 0x427, 0xa, 0x3f, 0x3, 0x3f, 0x3, 0x3f, 
-    0x3, 0x40, 0x3, 0x40, 0x5, 0x40, 0x42d, 0xa, 0x40, 0x3, 0x40, 0x3, 0x40, 
-    0x5, 0x40, 0x431, 0xa, 0x40, 0x3, 0x40, 0x3, 0x40, 0x5, 0x40, 0x435, 
-    0xa, 0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x41, 0x3, 0x41, 0x3, 0x42, 0x3, 
-    0x42, 0x3, 0x43, 0x3, 0x43, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 
-    0x3, 0x44, 0x7, 0x44, 0x444, 0xa, 0x44, 0xc, 0x44, 0xe, 0x44, 0x447, 
-    0xb, 0x44, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x7, 
-    0x45, 0x44e, 0xa, 0x45, 0xc, 0x45, 0xe, 0x45, 0x451, 0xb, 0x45, 0x3, 
-    0x46, 0x3, 0x46, 0x3, 0x46, 0x3, 0x46, 0x3, 0x46, 0x7, 0x46, 0x458, 
-    0xa, 0x46, 0xc, 0x46, 0xe, 0x46, 0x45b, 0xb, 0x46, 0x3, 0x47, 0x3, 0x47, 
-    0x5, 0x47, 0x45f, 0xa, 0x47, 0x5, 0x47, 0x461, 0xa, 0x47, 0x3, 0x47, 
-    0x3, 0x47, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x467, 0xa, 0x48, 0x3, 0x48, 
-    0x3, 0x48, 0x5, 0x48, 0x46b, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 
-    0x46f, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x473, 0xa, 0x48, 
-    0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x477, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 
-    0x3, 0x48, 0x3, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x47f, 0xa, 0x48, 
-    0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x483, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 
-    0x5, 0x48, 0x487, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x48b, 
-    0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x6, 0x48, 0x48f, 0xa, 0x48, 0xd, 0x48, 
-    0xe, 0x48, 0x490, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x495, 0xa, 0x48, 
-    0x3, 0x49, 0x3, 0x49, 0x3, 0x4a, 0x3, 0x4a, 0x5, 0x4a, 0x49b, 0xa, 0x4a, 
-    0x3, 0x4a, 0x3, 0x4a, 0x5, 0x4a, 0x49f, 0xa, 0x4a, 0x3, 0x4a, 0x7, 0x4a, 
-    0x4a2, 0xa, 0x4a, 0xc, 0x4a, 0xe, 0x4a, 0x4a5, 0xb, 0x4a, 0x3, 0x4b, 
-    0x3, 0x4b, 0x5, 0x4b, 0x4a9, 0xa, 0x4b, 0x3, 0x4b, 0x3, 0x4b, 0x5, 0x4b, 
-    0x4ad, 0xa, 0x4b, 0x3, 0x4b, 0x7, 0x4b, 0x4b0, 0xa, 0x4b, 0xc, 0x4b, 
-    0xe, 0x4b, 0x4b3, 0xb, 0x4b, 0x3, 0x4c, 0x3, 0x4c, 0x5, 0x4c, 0x4b7, 
-    0xa, 0x4c, 0x3, 0x4c, 0x3, 0x4c, 0x5, 0x4c, 0x4bb, 0xa, 0x4c, 0x3, 0x4c, 
-    0x3, 0x4c, 0x7, 0x4c, 0x4bf, 0xa, 0x4c, 0xc, 0x4c, 0xe, 0x4c, 0x4c2, 
-    0xb, 0x4c, 0x3, 0x4d, 0x3, 0x4d, 0x3, 0x4e, 0x3, 0x4e, 0x5, 0x4e, 0x4c8, 
-    0xa, 0x4e, 0x3, 0x4e, 0x3, 0x4e, 0x5, 0x4e, 0x4cc, 0xa, 0x4e, 0x3, 0x4e, 
-    0x3, 0x4e, 0x7, 0x4e, 0x4d0, 0xa, 0x4e, 0xc, 0x4e, 0xe, 0x4e, 0x4d3, 
-    0xb, 0x4e, 0x3, 0x4f, 0x3, 0x4f, 0x3, 0x50, 0x3, 0x50, 0x5, 0x50, 0x4d9, 
-    0xa, 0x50, 0x3, 0x50, 0x3, 0x50, 0x5, 0x50, 0x4dd, 0xa, 0x50, 0x3, 0x50, 
-    0x3, 0x50, 0x7, 0x50, 0x4e1, 0xa, 0x50, 0xc, 0x50, 0xe, 0x50, 0x4e4, 
-    0xb, 0x50, 0x3, 0x51, 0x3, 0x51, 0x3, 0x52, 0x3, 0x52, 0x5, 0x52, 0x4ea, 
-    0xa, 0x52, 0x3, 0x52, 0x3, 0x52, 0x5, 0x52, 0x4ee, 0xa, 0x52, 0x3, 0x52, 
-    0x7, 0x52, 0x4f1, 0xa, 0x52, 0xc, 0x52, 0xe, 0x52, 0x4f4, 0xb, 0x52, 
-    0x3, 0x53, 0x3, 0x53, 0x5, 0x53, 0x4f8, 0xa, 0x53, 0x5, 0x53, 0x4fa, 
-    0xa, 0x53, 0x3, 0x53, 0x3, 0x53, 0x5, 0x53, 0x4fe, 0xa, 0x53, 0x3, 0x53, 
-    0x5, 0x53, 0x501, 0xa, 0x53, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 
-    0x5, 0x54, 0x507, 0xa, 0x54, 0x3, 0x55, 0x3, 0x55, 0x5, 0x55, 0x50b, 
-    0xa, 0x55, 0x3, 0x55, 0x5, 0x55, 0x50e, 0xa, 0x55, 0x3, 0x56, 0x5, 0x56, 
+    0x3, 0x7e, 0x647, 0x4, 0x2, 0x9, 0x2, 0x4, 0x3, 0x9, 0x3, 0x4, 0x4, 0x9, 
+    0x4, 0x4, 0x5, 0x9, 0x5, 0x4, 0x6, 0x9, 0x6, 0x4, 0x7, 0x9, 0x7, 0x4, 
+    0x8, 0x9, 0x8, 0x4, 0x9, 0x9, 0x9, 0x4, 0xa, 0x9, 0xa, 0x4, 0xb, 0x9, 
+    0xb, 0x4, 0xc, 0x9, 0xc, 0x4, 0xd, 0x9, 0xd, 0x4, 0xe, 0x9, 0xe, 0x4, 
+    0xf, 0x9, 0xf, 0x4, 0x10, 0x9, 0x10, 0x4, 0x11, 0x9, 0x11, 0x4, 0x12, 
+    0x9, 0x12, 0x4, 0x13, 0x9, 0x13, 0x4, 0x14, 0x9, 0x14, 0x4, 0x15, 0x9, 
+    0x15, 0x4, 0x16, 0x9, 0x16, 0x4, 0x17, 0x9, 0x17, 0x4, 0x18, 0x9, 0x18, 
+    0x4, 0x19, 0x9, 0x19, 0x4, 0x1a, 0x9, 0x1a, 0x4, 0x1b, 0x9, 0x1b, 0x4, 
+    0x1c, 0x9, 0x1c, 0x4, 0x1d, 0x9, 0x1d, 0x4, 0x1e, 0x9, 0x1e, 0x4, 0x1f, 
+    0x9, 0x1f, 0x4, 0x20, 0x9, 0x20, 0x4, 0x21, 0x9, 0x21, 0x4, 0x22, 0x9, 
+    0x22, 0x4, 0x23, 0x9, 0x23, 0x4, 0x24, 0x9, 0x24, 0x4, 0x25, 0x9, 0x25, 
+    0x4, 0x26, 0x9, 0x26, 0x4, 0x27, 0x9, 0x27, 0x4, 0x28, 0x9, 0x28, 0x4, 
+    0x29, 0x9, 0x29, 0x4, 0x2a, 0x9, 0x2a, 0x4, 0x2b, 0x9, 0x2b, 0x4, 0x2c, 
+    0x9, 0x2c, 0x4, 0x2d, 0x9, 0x2d, 0x4, 0x2e, 0x9, 0x2e, 0x4, 0x2f, 0x9, 
+    0x2f, 0x4, 0x30, 0x9, 0x30, 0x4, 0x31, 0x9, 0x31, 0x4, 0x32, 0x9, 0x32, 
+    0x4, 0x33, 0x9, 0x33, 0x4, 0x34, 0x9, 0x34, 0x4, 0x35, 0x9, 0x35, 0x4, 
+    0x36, 0x9, 0x36, 0x4, 0x37, 0x9, 0x37, 0x4, 0x38, 0x9, 0x38, 0x4, 0x39, 
+    0x9, 0x39, 0x4, 0x3a, 0x9, 0x3a, 0x4, 0x3b, 0x9, 0x3b, 0x4, 0x3c, 0x9, 
+    0x3c, 0x4, 0x3d, 0x9, 0x3d, 0x4, 0x3e, 0x9, 0x3e, 0x4, 0x3f, 0x9, 0x3f, 
+    0x4, 0x40, 0x9, 0x40, 0x4, 0x41, 0x9, 0x41, 0x4, 0x42, 0x9, 0x42, 0x4, 
+    0x43, 0x9, 0x43, 0x4, 0x44, 0x9, 0x44, 0x4, 0x45, 0x9, 0x45, 0x4, 0x46, 
+    0x9, 0x46, 0x4, 0x47, 0x9, 0x47, 0x4, 0x48, 0x9, 0x48, 0x4, 0x49, 0x9, 
+    0x49, 0x4, 0x4a, 0x9, 0x4a, 0x4, 0x4b, 0x9, 0x4b, 0x4, 0x4c, 0x9, 0x4c, 
+    0x4, 0x4d, 0x9, 0x4d, 0x4, 0x4e, 0x9, 0x4e, 0x4, 0x4f, 0x9, 0x4f, 0x4, 
+    0x50, 0x9, 0x50, 0x4, 0x51, 0x9, 0x51, 0x4, 0x52, 0x9, 0x52, 0x4, 0x53, 
+    0x9, 0x53, 0x4, 0x54, 0x9, 0x54, 0x4, 0x55, 0x9, 0x55, 0x4, 0x56, 0x9, 
+    0x56, 0x4, 0x57, 0x9, 0x57, 0x4, 0x58, 0x9, 0x58, 0x4, 0x59, 0x9, 0x59, 
+    0x4, 0x5a, 0x9, 0x5a, 0x4, 0x5b, 0x9, 0x5b, 0x4, 0x5c, 0x9, 0x5c, 0x4, 
+    0x5d, 0x9, 0x5d, 0x4, 0x5e, 0x9, 0x5e, 0x4, 0x5f, 0x9, 0x5f, 0x4, 0x60, 
+    0x9, 0x60, 0x4, 0x61, 0x9, 0x61, 0x4, 0x62, 0x9, 0x62, 0x4, 0x63, 0x9, 
+    0x63, 0x4, 0x64, 0x9, 0x64, 0x4, 0x65, 0x9, 0x65, 0x4, 0x66, 0x9, 0x66, 
+    0x4, 0x67, 0x9, 0x67, 0x4, 0x68, 0x9, 0x68, 0x4, 0x69, 0x9, 0x69, 0x4, 
+    0x6a, 0x9, 0x6a, 0x4, 0x6b, 0x9, 0x6b, 0x4, 0x6c, 0x9, 0x6c, 0x4, 0x6d, 
+    0x9, 0x6d, 0x4, 0x6e, 0x9, 0x6e, 0x4, 0x6f, 0x9, 0x6f, 0x4, 0x70, 0x9, 
+    0x70, 0x4, 0x71, 0x9, 0x71, 0x4, 0x72, 0x9, 0x72, 0x3, 0x2, 0x5, 0x2, 
+    0xe6, 0xa, 0x2, 0x3, 0x2, 0x5, 0x2, 0xe9, 0xa, 0x2, 0x3, 0x2, 0x5, 0x2, 
+    0xec, 0xa, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, 0x2, 0x5, 0x2, 0xf1, 0xa, 0x2, 
+    0x3, 0x2, 0x5, 0x2, 0xf4, 0xa, 0x2, 0x3, 0x2, 0x5, 0x2, 0xf7, 0xa, 0x2, 
+    0x3, 0x2, 0x5, 0x2, 0xfa, 0xa, 0x2, 0x3, 0x2, 0x3, 0x2, 0x3, 0x3, 0x3, 
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x5, 
+    0x3, 0x106, 0xa, 0x3, 0x3, 0x3, 0x3, 0x3, 0x5, 0x3, 0x10a, 0xa, 0x3, 0x3, 
+    0x3, 0x3, 0x3, 0x5, 0x3, 0x10e, 0xa, 0x3, 0x3, 0x3, 0x3, 0x3, 0x5, 0x3, 
+    0x112, 0xa, 0x3, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x116, 0xa, 0x4, 0x3, 0x4, 
+    0x3, 0x4, 0x5, 0x4, 0x11a, 0xa, 0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x11e, 
+    0xa, 0x4, 0x3, 0x4, 0x7, 0x4, 0x121, 0xa, 0x4, 0xc, 0x4, 0xe, 0x4, 0x124, 
+    0xb, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x12a, 0xa, 
+    0x4, 0x3, 0x4, 0x3, 0x4, 0x5, 0x4, 0x12e, 0xa, 0x4, 0x3, 0x4, 0x3, 0x4, 
+    0x5, 0x4, 0x132, 0xa, 0x4, 0x3, 0x4, 0x5, 0x4, 0x135, 0xa, 0x4, 0x3, 0x5, 
+    0x3, 0x5, 0x5, 0x5, 0x139, 0xa, 0x5, 0x3, 0x5, 0x3, 0x5, 0x5, 0x5, 0x13d, 
+    0xa, 0x5, 0x3, 0x5, 0x7, 0x5, 0x140, 0xa, 0x5, 0xc, 0x5, 0xe, 0x5, 0x143, 
+    0xb, 0x5, 0x3, 0x6, 0x3, 0x6, 0x5, 0x6, 0x147, 0xa, 0x6, 0x3, 0x6, 0x3, 
+    0x6, 0x5, 0x6, 0x14b, 0xa, 0x6, 0x3, 0x6, 0x3, 0x6, 0x3, 0x7, 0x3, 0x7, 
+    0x3, 0x7, 0x3, 0x7, 0x5, 0x7, 0x153, 0xa, 0x7, 0x3, 0x8, 0x3, 0x8, 0x3, 
+    0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x15d, 
+    0xa, 0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x161, 0xa, 0x8, 0x3, 0x8, 0x3, 
+    0x8, 0x5, 0x8, 0x165, 0xa, 0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x169, 0xa, 
+    0x8, 0x3, 0x8, 0x3, 0x8, 0x3, 0x8, 0x5, 0x8, 0x16e, 0xa, 0x8, 0x3, 0x8, 
+    0x3, 0x8, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 
+    0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x17a, 0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 
+    0x9, 0x17e, 0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 
+    0x3, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x188, 0xa, 0x9, 0x3, 0x9, 0x3, 
+    0x9, 0x5, 0x9, 0x18c, 0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x190, 0xa, 
+    0x9, 0x5, 0x9, 0x192, 0xa, 0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x196, 0xa, 
+    0x9, 0x3, 0x9, 0x3, 0x9, 0x5, 0x9, 0x19a, 0xa, 0x9, 0x5, 0x9, 0x19c, 0xa, 
+    0x9, 0x3, 0x9, 0x3, 0x9, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 0xa, 0x3, 
+    0xa, 0x3, 0xa, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 
+    0xb, 0x3, 0xb, 0x3, 0xb, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x3, 0xc, 0x5, 
+    0xc, 0x1b2, 0xa, 0xc, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 
+    0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x3, 0xd, 0x5, 0xd, 0x1bd, 0xa, 0xd, 0x3, 
+    0xe, 0x3, 0xe, 0x3, 0xe, 0x3, 0xe, 0x3, 0xf, 0x3, 0xf, 0x3, 0xf, 0x3, 
+    0xf, 0x3, 0xf, 0x3, 0xf, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 
+    0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x10, 0x3, 0x11, 0x3, 0x11, 0x5, 0x11, 
+    0x1d3, 0xa, 0x11, 0x3, 0x11, 0x3, 0x11, 0x5, 0x11, 0x1d7, 0xa, 0x11, 0x3, 
+    0x11, 0x7, 0x11, 0x1da, 0xa, 0x11, 0xc, 0x11, 0xe, 0x11, 0x1dd, 0xb, 
+    0x11, 0x3, 0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 0x12, 0x3, 0x13, 0x3, 0x13, 
+    0x3, 0x13, 0x3, 0x13, 0x5, 0x13, 0x1e7, 0xa, 0x13, 0x3, 0x13, 0x3, 0x13, 
+    0x5, 0x13, 0x1eb, 0xa, 0x13, 0x3, 0x13, 0x3, 0x13, 0x5, 0x13, 0x1ef, 0xa, 
+    0x13, 0x3, 0x13, 0x3, 0x13, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 0x3, 0x14, 
+    0x5, 0x14, 0x1f7, 0xa, 0x14, 0x3, 0x15, 0x3, 0x15, 0x7, 0x15, 0x1fb, 0xa, 
+    0x15, 0xc, 0x15, 0xe, 0x15, 0x1fe, 0xb, 0x15, 0x3, 0x16, 0x3, 0x16, 0x5, 
+    0x16, 0x202, 0xa, 0x16, 0x3, 0x16, 0x3, 0x16, 0x3, 0x17, 0x3, 0x17, 0x5, 
+    0x17, 0x208, 0xa, 0x17, 0x3, 0x18, 0x3, 0x18, 0x3, 0x19, 0x3, 0x19, 0x3, 
+    0x1a, 0x3, 0x1a, 0x3, 0x1b, 0x3, 0x1b, 0x3, 0x1c, 0x3, 0x1c, 0x5, 0x1c, 
+    0x214, 0xa, 0x1c, 0x3, 0x1c, 0x7, 0x1c, 0x217, 0xa, 0x1c, 0xc, 0x1c, 0xe, 
+    0x1c, 0x21a, 0xb, 0x1c, 0x3, 0x1c, 0x3, 0x1c, 0x5, 0x1c, 0x21e, 0xa, 
+    0x1c, 0x6, 0x1c, 0x220, 0xa, 0x1c, 0xd, 0x1c, 0xe, 0x1c, 0x221, 0x3, 
+    0x1c, 0x3, 0x1c, 0x3, 0x1c, 0x5, 0x1c, 0x227, 0xa, 0x1c, 0x3, 0x1d, 0x3, 
+    0x1d, 0x3, 0x1d, 0x3, 0x1d, 0x5, 0x1d, 0x22d, 0xa, 0x1d, 0x3, 0x1d, 0x3, 
+    0x1d, 0x3, 0x1d, 0x5, 0x1d, 0x232, 0xa, 0x1d, 0x3, 0x1d, 0x5, 0x1d, 
+    0x235, 0xa, 0x1d, 0x3, 0x1e, 0x3, 0x1e, 0x5, 0x1e, 0x239, 0xa, 0x1e, 0x3, 
+    0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x23d, 0xa, 0x1f, 0x7, 0x1f, 0x23f, 0xa, 
+    0x1f, 0xc, 0x1f, 0xe, 0x1f, 0x242, 0xb, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x3, 
+    0x1f, 0x5, 0x1f, 0x247, 0xa, 0x1f, 0x7, 0x1f, 0x249, 0xa, 0x1f, 0xc, 
+    0x1f, 0xe, 0x1f, 0x24c, 0xb, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 
+    0x250, 0xa, 0x1f, 0x3, 0x1f, 0x7, 0x1f, 0x253, 0xa, 0x1f, 0xc, 0x1f, 0xe, 
+    0x1f, 0x256, 0xb, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x259, 0xa, 0x1f, 0x3, 
+    0x1f, 0x5, 0x1f, 0x25c, 0xa, 0x1f, 0x3, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 
+    0x260, 0xa, 0x1f, 0x7, 0x1f, 0x262, 0xa, 0x1f, 0xc, 0x1f, 0xe, 0x1f, 
+    0x265, 0xb, 0x1f, 0x3, 0x1f, 0x5, 0x1f, 0x268, 0xa, 0x1f, 0x3, 0x20, 0x3, 
+    0x20, 0x5, 0x20, 0x26c, 0xa, 0x20, 0x6, 0x20, 0x26e, 0xa, 0x20, 0xd, 
+    0x20, 0xe, 0x20, 0x26f, 0x3, 0x20, 0x3, 0x20, 0x3, 0x21, 0x3, 0x21, 0x5, 
+    0x21, 0x276, 0xa, 0x21, 0x7, 0x21, 0x278, 0xa, 0x21, 0xc, 0x21, 0xe, 
+    0x21, 0x27b, 0xb, 0x21, 0x3, 0x21, 0x3, 0x21, 0x5, 0x21, 0x27f, 0xa, 
+    0x21, 0x7, 0x21, 0x281, 0xa, 0x21, 0xc, 0x21, 0xe, 0x21, 0x284, 0xb, 
+    0x21, 0x3, 0x21, 0x3, 0x21, 0x3, 0x22, 0x3, 0x22, 0x3, 0x22, 0x5, 0x22, 
+    0x28b, 0xa, 0x22, 0x3, 0x23, 0x3, 0x23, 0x5, 0x23, 0x28f, 0xa, 0x23, 0x3, 
+    0x24, 0x3, 0x24, 0x5, 0x24, 0x293, 0xa, 0x24, 0x3, 0x24, 0x3, 0x24, 0x5, 
+    0x24, 0x297, 0xa, 0x24, 0x3, 0x24, 0x3, 0x24, 0x5, 0x24, 0x29b, 0xa, 
+    0x24, 0x3, 0x24, 0x5, 0x24, 0x29e, 0xa, 0x24, 0x3, 0x25, 0x3, 0x25, 0x5, 
+    0x25, 0x2a2, 0xa, 0x25, 0x3, 0x25, 0x3, 0x25, 0x3, 0x25, 0x3, 0x25, 0x3, 
+    0x25, 0x3, 0x25, 0x3, 0x26, 0x3, 0x26, 0x5, 0x26, 0x2ac, 0xa, 0x26, 0x3, 
+    0x26, 0x3, 0x26, 0x3, 0x27, 0x3, 0x27, 0x5, 0x27, 0x2b2, 0xa, 0x27, 0x3, 
+    0x27, 0x3, 0x27, 0x5, 0x27, 0x2b6, 0xa, 0x27, 0x3, 0x27, 0x3, 0x27, 0x5, 
+    0x27, 0x2ba, 0xa, 0x27, 0x3, 0x27, 0x7, 0x27, 0x2bd, 0xa, 0x27, 0xc, 
+    0x27, 0xe, 0x27, 0x2c0, 0xb, 0x27, 0x3, 0x28, 0x3, 0x28, 0x5, 0x28, 
+    0x2c4, 0xa, 0x28, 0x3, 0x28, 0x3, 0x28, 0x5, 0x28, 0x2c8, 0xa, 0x28, 0x3, 
+    0x28, 0x3, 0x28, 0x3, 0x29, 0x3, 0x29, 0x5, 0x29, 0x2ce, 0xa, 0x29, 0x3, 
+    0x29, 0x3, 0x29, 0x5, 0x29, 0x2d2, 0xa, 0x29, 0x3, 0x29, 0x3, 0x29, 0x5, 
+    0x29, 0x2d6, 0xa, 0x29, 0x3, 0x29, 0x7, 0x29, 0x2d9, 0xa, 0x29, 0xc, 
+    0x29, 0xe, 0x29, 0x2dc, 0xb, 0x29, 0x3, 0x2a, 0x3, 0x2a, 0x3, 0x2a, 0x5, 
+    0x2a, 0x2e1, 0xa, 0x2a, 0x3, 0x2a, 0x5, 0x2a, 0x2e4, 0xa, 0x2a, 0x3, 
+    0x2b, 0x3, 0x2b, 0x3, 0x2b, 0x3, 0x2c, 0x5, 0x2c, 0x2ea, 0xa, 0x2c, 0x3, 
+    0x2c, 0x5, 0x2c, 0x2ed, 0xa, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x3, 
+    0x2c, 0x5, 0x2c, 0x2f3, 0xa, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x5, 0x2c, 
+    0x2f7, 0xa, 0x2c, 0x3, 0x2c, 0x3, 0x2c, 0x5, 0x2c, 0x2fb, 0xa, 0x2c, 0x3, 
+    0x2d, 0x3, 0x2d, 0x5, 0x2d, 0x2ff, 0xa, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x5, 
+    0x2d, 0x303, 0xa, 0x2d, 0x3, 0x2d, 0x7, 0x2d, 0x306, 0xa, 0x2d, 0xc, 
+    0x2d, 0xe, 0x2d, 0x309, 0xb, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x5, 0x2d, 
+    0x30d, 0xa, 0x2d, 0x3, 0x2d, 0x3, 0x2d, 0x5, 0x2d, 0x311, 0xa, 0x2d, 0x3, 
+    0x2d, 0x7, 0x2d, 0x314, 0xa, 0x2d, 0xc, 0x2d, 0xe, 0x2d, 0x317, 0xb, 
+    0x2d, 0x5, 0x2d, 0x319, 0xa, 0x2d, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 
+    0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x3, 0x2e, 0x5, 0x2e, 0x322, 0xa, 0x2e, 0x3, 
+    0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 0x3, 0x2f, 
+    0x5, 0x2f, 0x32b, 0xa, 0x2f, 0x3, 0x2f, 0x7, 0x2f, 0x32e, 0xa, 0x2f, 0xc, 
+    0x2f, 0xe, 0x2f, 0x331, 0xb, 0x2f, 0x3, 0x30, 0x3, 0x30, 0x3, 0x30, 0x3, 
+    0x30, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x31, 0x3, 0x32, 0x3, 0x32, 
+    0x5, 0x32, 0x33d, 0xa, 0x32, 0x3, 0x32, 0x5, 0x32, 0x340, 0xa, 0x32, 0x3, 
+    0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x33, 0x3, 0x34, 0x3, 0x34, 0x5, 0x34, 
+    0x348, 0xa, 0x34, 0x3, 0x34, 0x3, 0x34, 0x5, 0x34, 0x34c, 0xa, 0x34, 0x3, 
+    0x34, 0x7, 0x34, 0x34f, 0xa, 0x34, 0xc, 0x34, 0xe, 0x34, 0x352, 0xb, 
+    0x34, 0x3, 0x35, 0x3, 0x35, 0x3, 0x36, 0x3, 0x36, 0x3, 0x37, 0x3, 0x37, 
+    0x5, 0x37, 0x35a, 0xa, 0x37, 0x3, 0x37, 0x7, 0x37, 0x35d, 0xa, 0x37, 0xc, 
+    0x37, 0xe, 0x37, 0x360, 0xb, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 0x37, 0x3, 
+    0x37, 0x5, 0x37, 0x366, 0xa, 0x37, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 
+    0x36a, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x36e, 0xa, 0x38, 0x5, 
+    0x38, 0x370, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x374, 0xa, 
+    0x38, 0x5, 0x38, 0x376, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 
+    0x37a, 0xa, 0x38, 0x5, 0x38, 0x37c, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 
+    0x38, 0x380, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 0x384, 0xa, 
+    0x38, 0x5, 0x38, 0x386, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 0x38, 
+    0x38a, 0xa, 0x38, 0x5, 0x38, 0x38c, 0xa, 0x38, 0x3, 0x38, 0x3, 0x38, 0x5, 
+    0x38, 0x390, 0xa, 0x38, 0x5, 0x38, 0x392, 0xa, 0x38, 0x3, 0x38, 0x5, 
+    0x38, 0x395, 0xa, 0x38, 0x3, 0x39, 0x3, 0x39, 0x5, 0x39, 0x399, 0xa, 
+    0x39, 0x3, 0x39, 0x3, 0x39, 0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x39f, 0xa, 
+    0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3a3, 0xa, 0x3a, 0x3, 0x3a, 0x5, 
+    0x3a, 0x3a6, 0xa, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3a9, 0xa, 0x3a, 0x3, 
+    0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3af, 0xa, 0x3a, 0x3, 
+    0x3a, 0x5, 0x3a, 0x3b2, 0xa, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3b5, 0xa, 
+    0x3a, 0x3, 0x3a, 0x3, 0x3a, 0x5, 0x3a, 0x3b9, 0xa, 0x3a, 0x3, 0x3a, 0x3, 
+    0x3a, 0x5, 0x3a, 0x3bd, 0xa, 0x3a, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 
+    0x3c1, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3c5, 0xa, 0x3b, 0x5, 
+    0x3b, 0x3c7, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 0x3cb, 0xa, 
+    0x3b, 0x5, 0x3b, 0x3cd, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 0x3b, 
+    0x3d1, 0xa, 0x3b, 0x5, 0x3b, 0x3d3, 0xa, 0x3b, 0x3, 0x3b, 0x3, 0x3b, 0x5, 
+    0x3b, 0x3d7, 0xa, 0x3b, 0x5, 0x3b, 0x3d9, 0xa, 0x3b, 0x3, 0x3b, 0x3, 
+    0x3b, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3df, 0xa, 0x3c, 0x3, 0x3c, 0x3, 
+    0x3c, 0x5, 0x3c, 0x3e3, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 
+    0x3e7, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3eb, 0xa, 0x3c, 0x3, 
+    0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3ef, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 
+    0x3c, 0x3f3, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3f7, 0xa, 
+    0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x5, 0x3c, 0x3fb, 0xa, 0x3c, 0x7, 0x3c, 
+    0x3fd, 0xa, 0x3c, 0xc, 0x3c, 0xe, 0x3c, 0x400, 0xb, 0x3c, 0x5, 0x3c, 
+    0x402, 0xa, 0x3c, 0x3, 0x3c, 0x3, 0x3c, 0x3, 0x3d, 0x3, 0x3d, 0x5, 0x3d, 
+    0x408, 0xa, 0x3d, 0x3, 0x3d, 0x3, 0x3d, 0x5, 0x3d, 0x40c, 0xa, 0x3d, 0x3, 
+    0x3d, 0x3, 0x3d, 0x5, 0x3d, 0x410, 0xa, 0x3d, 0x3, 0x3d, 0x5, 0x3d, 
+    0x413, 0xa, 0x3d, 0x3, 0x3d, 0x7, 0x3d, 0x416, 0xa, 0x3d, 0xc, 0x3d, 0xe, 
+    0x3d, 0x419, 0xb, 0x3d, 0x3, 0x3e, 0x3, 0x3e, 0x5, 0x3e, 0x41d, 0xa, 
+    0x3e, 0x3, 0x3e, 0x7, 0x3e, 0x420, 0xa, 0x3e, 0xc, 0x3e, 0xe, 0x3e, 
+    0x423, 0xb, 0x3e, 0x3, 0x3f, 0x3, 0x3f, 0x5, 0x3f, 0x427, 0xa, 0x3f, 0x3, 
+    0x3f, 0x3, 0x3f, 0x3, 0x40, 0x3, 0x40, 0x5, 0x40, 0x42d, 0xa, 0x40, 0x3, 
+    0x40, 0x3, 0x40, 0x5, 0x40, 0x431, 0xa, 0x40, 0x3, 0x40, 0x3, 0x40, 0x5, 
+    0x40, 0x435, 0xa, 0x40, 0x3, 0x40, 0x3, 0x40, 0x3, 0x41, 0x3, 0x41, 0x3, 
+    0x42, 0x3, 0x42, 0x3, 0x43, 0x3, 0x43, 0x3, 0x44, 0x3, 0x44, 0x3, 0x44, 
+    0x3, 0x44, 0x3, 0x44, 0x7, 0x44, 0x444, 0xa, 0x44, 0xc, 0x44, 0xe, 0x44, 
+    0x447, 0xb, 0x44, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 0x3, 0x45, 
+    0x7, 0x45, 0x44e, 0xa, 0x45, 0xc, 0x45, 0xe, 0x45, 0x451, 0xb, 0x45, 0x3, 
+    0x46, 0x3, 0x46, 0x3, 0x46, 0x3, 0x46, 0x3, 0x46, 0x7, 0x46, 0x458, 0xa, 
+    0x46, 0xc, 0x46, 0xe, 0x46, 0x45b, 0xb, 0x46, 0x3, 0x47, 0x3, 0x47, 0x5, 
+    0x47, 0x45f, 0xa, 0x47, 0x5, 0x47, 0x461, 0xa, 0x47, 0x3, 0x47, 0x3, 
+    0x47, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x467, 0xa, 0x48, 0x3, 0x48, 0x3, 
+    0x48, 0x5, 0x48, 0x46b, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 
+    0x46f, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x473, 0xa, 0x48, 0x3, 
+    0x48, 0x3, 0x48, 0x5, 0x48, 0x477, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x3, 
+    0x48, 0x3, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x47f, 0xa, 0x48, 0x3, 
+    0x48, 0x3, 0x48, 0x5, 0x48, 0x483, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 
+    0x48, 0x487, 0xa, 0x48, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x48b, 0xa, 
+    0x48, 0x3, 0x48, 0x3, 0x48, 0x6, 0x48, 0x48f, 0xa, 0x48, 0xd, 0x48, 0xe, 
+    0x48, 0x490, 0x3, 0x48, 0x3, 0x48, 0x5, 0x48, 0x495, 0xa, 0x48, 0x3, 
+    0x49, 0x3, 0x49, 0x3, 0x4a, 0x3, 0x4a, 0x5, 0x4a, 0x49b, 0xa, 0x4a, 0x3, 
+    0x4a, 0x3, 0x4a, 0x5, 0x4a, 0x49f, 0xa, 0x4a, 0x3, 0x4a, 0x7, 0x4a, 
+    0x4a2, 0xa, 0x4a, 0xc, 0x4a, 0xe, 0x4a, 0x4a5, 0xb, 0x4a, 0x3, 0x4b, 0x3, 
+    0x4b, 0x5, 0x4b, 0x4a9, 0xa, 0x4b, 0x3, 0x4b, 0x3, 0x4b, 0x5, 0x4b, 
+    0x4ad, 0xa, 0x4b, 0x3, 0x4b, 0x7, 0x4b, 0x4b0, 0xa, 0x4b, 0xc, 0x4b, 0xe, 
+    0x4b, 0x4b3, 0xb, 0x4b, 0x3, 0x4c, 0x3, 0x4c, 0x5, 0x4c, 0x4b7, 0xa, 
+    0x4c, 0x3, 0x4c, 0x3, 0x4c, 0x5, 0x4c, 0x4bb, 0xa, 0x4c, 0x3, 0x4c, 0x3, 
+    0x4c, 0x7, 0x4c, 0x4bf, 0xa, 0x4c, 0xc, 0x4c, 0xe, 0x4c, 0x4c2, 0xb, 
+    0x4c, 0x3, 0x4d, 0x3, 0x4d, 0x3, 0x4e, 0x3, 0x4e, 0x5, 0x4e, 0x4c8, 0xa, 
+    0x4e, 0x3, 0x4e, 0x3, 0x4e, 0x5, 0x4e, 0x4cc, 0xa, 0x4e, 0x3, 0x4e, 0x3, 
+    0x4e, 0x7, 0x4e, 0x4d0, 0xa, 0x4e, 0xc, 0x4e, 0xe, 0x4e, 0x4d3, 0xb, 
+    0x4e, 0x3, 0x4f, 0x3, 0x4f, 0x3, 0x50, 0x3, 0x50, 0x5, 0x50, 0x4d9, 0xa, 
+    0x50, 0x3, 0x50, 0x3, 0x50, 0x5, 0x50, 0x4dd, 0xa, 0x50, 0x3, 0x50, 0x3, 
+    0x50, 0x7, 0x50, 0x4e1, 0xa, 0x50, 0xc, 0x50, 0xe, 0x50, 0x4e4, 0xb, 
+    0x50, 0x3, 0x51, 0x3, 0x51, 0x3, 0x52, 0x3, 0x52, 0x5, 0x52, 0x4ea, 0xa, 
+    0x52, 0x3, 0x52, 0x3, 0x52, 0x5, 0x52, 0x4ee, 0xa, 0x52, 0x3, 0x52, 0x7, 
+    0x52, 0x4f1, 0xa, 0x52, 0xc, 0x52, 0xe, 0x52, 0x4f4, 0xb, 0x52, 0x3, 
+    0x53, 0x3, 0x53, 0x5, 0x53, 0x4f8, 0xa, 0x53, 0x5, 0x53, 0x4fa, 0xa, 
+    0x53, 0x3, 0x53, 0x3, 0x53, 0x5, 0x53, 0x4fe, 0xa, 0x53, 0x3, 0x53, 0x5, 
+    0x53, 0x501, 0xa, 0x53, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 0x3, 0x54, 0x5, 
+    0x54, 0x507, 0xa, 0x54, 0x3, 0x55, 0x3, 0x55, 0x5, 0x55, 0x50b, 0xa, 
+    0x55, 0x3, 0x55, 0x5, 0x55, 0x50e, 0xa, 0x55, 0x3, 0x56, 0x5, 0x56, 
     0x511, 0xa, 0x56, 0x3, 0x56, 0x3, 0x56, 0x3, 0x56, 0x3, 0x56, 0x3, 0x57, 
-    0x5, 0x57, 0x518, 0xa, 0x57, 0x3, 0x57, 0x3, 0x57, 0x5, 0x57, 0x51c, 
-    0xa, 0x57, 0x3, 0x57, 0x3, 0x57, 0x5, 0x57, 0x520, 0xa, 0x57, 0x3, 0x57, 
-    0x3, 0x57, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 
-    0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x5, 0x58, 
-    0x52f, 0xa, 0x58, 0x3, 0x58, 0x5, 0x58, 0x532, 0xa, 0x58, 0x3, 0x58, 
-    0x3, 0x58, 0x3, 0x59, 0x5, 0x59, 0x537, 0xa, 0x59, 0x3, 0x59, 0x3, 0x59, 
+    0x5, 0x57, 0x518, 0xa, 0x57, 0x3, 0x57, 0x3, 0x57, 0x5, 0x57, 0x51c, 0xa, 
+    0x57, 0x3, 0x57, 0x3, 0x57, 0x5, 0x57, 0x520, 0xa, 0x57, 0x3, 0x57, 0x3, 
+    0x57, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 
+    0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x3, 0x58, 0x5, 0x58, 0x52f, 
+    0xa, 0x58, 0x3, 0x58, 0x5, 0x58, 0x532, 0xa, 0x58, 0x3, 0x58, 0x3, 0x58, 
+    0x3, 0x59, 0x5, 0x59, 0x537, 0xa, 0x59, 0x3, 0x59, 0x3, 0x59, 0x3, 0x5a, 
     0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 
-    0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x5, 0x5a, 0x545, 0xa, 0x5a, 
-    0x3, 0x5b, 0x3, 0x5b, 0x5, 0x5b, 0x549, 0xa, 0x5b, 0x3, 0x5b, 0x5, 0x5b, 
-    0x54c, 0xa, 0x5b, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 
-    0x3, 0x5c, 0x3, 0x5c, 0x5, 0x5c, 0x555, 0xa, 0x5c, 0x3, 0x5d, 0x3, 0x5d, 
-    0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5d, 0x5, 0x5d, 0x55c, 0xa, 0x5d, 0x3, 0x5e, 
-    0x3, 0x5e, 0x3, 0x5f, 0x3, 0x5f, 0x5, 0x5f, 0x562, 0xa, 0x5f, 0x3, 0x5f, 
-    0x3, 0x5f, 0x5, 0x5f, 0x566, 0xa, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x5, 0x5f, 
-    0x56a, 0xa, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x5, 0x5f, 0x56e, 0xa, 0x5f, 
-    0x7, 0x5f, 0x570, 0xa, 0x5f, 0xc, 0x5f, 0xe, 0x5f, 0x573, 0xb, 0x5f, 
-    0x5, 0x5f, 0x575, 0xa, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x60, 0x3, 0x60, 
-    0x5, 0x60, 0x57b, 0xa, 0x60, 0x3, 0x60, 0x3, 0x60, 0x5, 0x60, 0x57f, 
-    0xa, 0x60, 0x3, 0x60, 0x3, 0x60, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x585, 
-    0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x589, 0xa, 0x61, 0x3, 0x61, 
-    0x3, 0x61, 0x5, 0x61, 0x58d, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 
-    0x3, 0x61, 0x5, 0x61, 0x593, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 
-    0x597, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x59b, 0xa, 0x61, 
-    0x5, 0x61, 0x59d, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x5a1, 
-    0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x5a5, 0xa, 0x61, 0x3, 0x61, 
-    0x3, 0x61, 0x5, 0x61, 0x5a9, 0xa, 0x61, 0x7, 0x61, 0x5ab, 0xa, 0x61, 
-    0xc, 0x61, 0xe, 0x61, 0x5ae, 0xb, 0x61, 0x5, 0x61, 0x5b0, 0xa, 0x61, 
-    0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x5b4, 0xa, 0x61, 0x3, 0x62, 0x3, 0x62, 
-    0x3, 0x63, 0x3, 0x63, 0x5, 0x63, 0x5ba, 0xa, 0x63, 0x3, 0x63, 0x3, 0x63, 
-    0x5, 0x63, 0x5be, 0xa, 0x63, 0x3, 0x63, 0x3, 0x63, 0x5, 0x63, 0x5c2, 
-    0xa, 0x63, 0x3, 0x63, 0x3, 0x63, 0x5, 0x63, 0x5c6, 0xa, 0x63, 0x3, 0x63, 
-    0x5, 0x63, 0x5c9, 0xa, 0x63, 0x3, 0x63, 0x5, 0x63, 0x5cc, 0xa, 0x63, 
-    0x3, 0x63, 0x3, 0x63, 0x3, 0x64, 0x3, 0x64, 0x5, 0x64, 0x5d2, 0xa, 0x64, 
-    0x3, 0x64, 0x3, 0x64, 0x3, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5d8, 0xa, 0x65, 
-    0x3, 0x65, 0x6, 0x65, 0x5db, 0xa, 0x65, 0xd, 0x65, 0xe, 0x65, 0x5dc, 
-    0x3, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5e1, 0xa, 0x65, 0x3, 0x65, 0x3, 0x65, 
-    0x5, 0x65, 0x5e5, 0xa, 0x65, 0x3, 0x65, 0x6, 0x65, 0x5e8, 0xa, 0x65, 
-    0xd, 0x65, 0xe, 0x65, 0x5e9, 0x5, 0x65, 0x5ec, 0xa, 0x65, 0x3, 0x65, 
-    0x5, 0x65, 0x5ef, 0xa, 0x65, 0x3, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5f3, 
-    0xa, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5f6, 0xa, 0x65, 0x3, 0x65, 0x5, 0x65, 
-    0x5f9, 0xa, 0x65, 0x3, 0x65, 0x3, 0x65, 0x3, 0x66, 0x3, 0x66, 0x5, 0x66, 
-    0x5ff, 0xa, 0x66, 0x3, 0x66, 0x3, 0x66, 0x5, 0x66, 0x603, 0xa, 0x66, 
-    0x3, 0x66, 0x3, 0x66, 0x5, 0x66, 0x607, 0xa, 0x66, 0x3, 0x66, 0x3, 0x66, 
-    0x3, 0x67, 0x3, 0x67, 0x3, 0x68, 0x3, 0x68, 0x5, 0x68, 0x60f, 0xa, 0x68, 
-    0x3, 0x69, 0x3, 0x69, 0x3, 0x69, 0x5, 0x69, 0x614, 0xa, 0x69, 0x3, 0x6a, 
-    0x3, 0x6a, 0x5, 0x6a, 0x618, 0xa, 0x6a, 0x3, 0x6a, 0x3, 0x6a, 0x3, 0x6b, 
-    0x3, 0x6b, 0x3, 0x6c, 0x3, 0x6c, 0x3, 0x6d, 0x3, 0x6d, 0x3, 0x6e, 0x3, 
-    0x6e, 0x3, 0x6f, 0x3, 0x6f, 0x3, 0x6f, 0x3, 0x6f, 0x5, 0x6f, 0x628, 
-    0xa, 0x6f, 0x3, 0x70, 0x3, 0x70, 0x3, 0x71, 0x3, 0x71, 0x3, 0x72, 0x3, 
-    0x72, 0x3, 0x72, 0x2, 0x2, 0x73, 0x2, 0x4, 0x6, 0x8, 0xa, 0xc, 0xe, 
-    0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 
-    0x28, 0x2a, 0x2c, 0x2e, 0x30, 0x32, 0x34, 0x36, 0x38, 0x3a, 0x3c, 0x3e, 
-    0x40, 0x42, 0x44, 0x46, 0x48, 0x4a, 0x4c, 0x4e, 0x50, 0x52, 0x54, 0x56, 
-    0x58, 0x5a, 0x5c, 0x5e, 0x60, 0x62, 0x64, 0x66, 0x68, 0x6a, 0x6c, 0x6e, 
-    0x70, 0x72, 0x74, 0x76, 0x78, 0x7a, 0x7c, 0x7e, 0x80, 0x82, 0x84, 0x86, 
-    0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x94, 0x96, 0x98, 0x9a, 0x9c, 0x9e, 
-    0xa0, 0xa2, 0xa4, 0xa6, 0xa8, 0xaa, 0xac, 0xae, 0xb0, 0xb2, 0xb4, 0xb6, 
-    0xb8, 0xba, 0xbc, 0xbe, 0xc0, 0xc2, 0xc4, 0xc6, 0xc8, 0xca, 0xcc, 0xce, 
-    0xd0, 0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xde, 0xe0, 0xe2, 0x2, 0xb, 
-    0x3, 0x2, 0x52, 0x55, 0x4, 0x2, 0x9, 0x9, 0xf, 0x13, 0x3, 0x2, 0x15, 
-    0x16, 0x4, 0x2, 0x17, 0x17, 0x5c, 0x5c, 0x4, 0x2, 0x18, 0x19, 0x4c, 
-    0x4c, 0x3, 0x2, 0x63, 0x64, 0x4, 0x2, 0x10, 0x10, 0x1e, 0x21, 0x4, 0x2, 
-    0x12, 0x12, 0x22, 0x25, 0x4, 0x2, 0x26, 0x30, 0x5c, 0x5c, 0x2, 0x6e5, 
-    0x2, 0xe5, 0x3, 0x2, 0x2, 0x2, 0x4, 0xfd, 0x3, 0x2, 0x2, 0x2, 0x6, 0x134, 
-    0x3, 0x2, 0x2, 0x2, 0x8, 0x136, 0x3, 0x2, 0x2, 0x2, 0xa, 0x144, 0x3, 
-    0x2, 0x2, 0x2, 0xc, 0x152, 0x3, 0x2, 0x2, 0x2, 0xe, 0x154, 0x3, 0x2, 
-    0x2, 0x2, 0x10, 0x171, 0x3, 0x2, 0x2, 0x2, 0x12, 0x19f, 0x3, 0x2, 0x2, 
-    0x2, 0x14, 0x1a5, 0x3, 0x2, 0x2, 0x2, 0x16, 0x1b1, 0x3, 0x2, 0x2, 0x2, 
-    0x18, 0x1b3, 0x3, 0x2, 0x2, 0x2, 0x1a, 0x1be, 0x3, 0x2, 0x2, 0x2, 0x1c, 
-    0x1c2, 0x3, 0x2, 0x2, 0x2, 0x1e, 0x1c8, 0x3, 0x2, 0x2, 0x2, 0x20, 0x1d0, 
-    0x3, 0x2, 0x2, 0x2, 0x22, 0x1de, 0x3, 0x2, 0x2, 0x2, 0x24, 0x1e2, 0x3, 
-    0x2, 0x2, 0x2, 0x26, 0x1f6, 0x3, 0x2, 0x2, 0x2, 0x28, 0x1f8, 0x3, 0x2, 
-    0x2, 0x2, 0x2a, 0x1ff, 0x3, 0x2, 0x2, 0x2, 0x2c, 0x207, 0x3, 0x2, 0x2, 
-    0x2, 0x2e, 0x209, 0x3, 0x2, 0x2, 0x2, 0x30, 0x20b, 0x3, 0x2, 0x2, 0x2, 
-    0x32, 0x20d, 0x3, 0x2, 0x2, 0x2, 0x34, 0x20f, 0x3, 0x2, 0x2, 0x2, 0x36, 
-    0x226, 0x3, 0x2, 0x2, 0x2, 0x38, 0x234, 0x3, 0x2, 0x2, 0x2, 0x3a, 0x238, 
-    0x3, 0x2, 0x2, 0x2, 0x3c, 0x267, 0x3, 0x2, 0x2, 0x2, 0x3e, 0x26d, 0x3, 
-    0x2, 0x2, 0x2, 0x40, 0x279, 0x3, 0x2, 0x2, 0x2, 0x42, 0x28a, 0x3, 0x2, 
-    0x2, 0x2, 0x44, 0x28e, 0x3, 0x2, 0x2, 0x2, 0x46, 0x292, 0x3, 0x2, 0x2, 
-    0x2, 0x48, 0x29f, 0x3, 0x2, 0x2, 0x2, 0x4a, 0x2a9, 0x3, 0x2, 0x2, 0x2, 
-    0x4c, 0x2af, 0x3, 0x2, 0x2, 0x2, 0x4e, 0x2c1, 0x3, 0x2, 0x2, 0x2, 0x50, 
-    0x2cb, 0x3, 0x2, 0x2, 0x2, 0x52, 0x2dd, 0x3, 0x2, 0x2, 0x2, 0x54, 0x2e5, 
-    0x3, 0x2, 0x2, 0x2, 0x56, 0x2ec, 0x3, 0x2, 0x2, 0x2, 0x58, 0x318, 0x3, 
-    0x2, 0x2, 0x2, 0x5a, 0x321, 0x3, 0x2, 0x2, 0x2, 0x5c, 0x323, 0x3, 0x2, 
-    0x2, 0x2, 0x5e, 0x332, 0x3, 0x2, 0x2, 0x2, 0x60, 0x336, 0x3, 0x2, 0x2, 
-    0x2, 0x62, 0x33a, 0x3, 0x2, 0x2, 0x2, 0x64, 0x341, 0x3, 0x2, 0x2, 0x2, 
-    0x66, 0x345, 0x3, 0x2, 0x2, 0x2, 0x68, 0x353, 0x3, 0x2, 0x2, 0x2, 0x6a, 
-    0x355, 0x3, 0x2, 0x2, 0x2, 0x6c, 0x365, 0x3, 0x2, 0x2, 0x2, 0x6e, 0x394, 
-    0x3, 0x2, 0x2, 0x2, 0x70, 0x396, 0x3, 0x2, 0x2, 0x2, 0x72, 0x3bc, 0x3, 
-    0x2, 0x2, 0x2, 0x74, 0x3be, 0x3, 0x2, 0x2, 0x2, 0x76, 0x3dc, 0x3, 0x2, 
-    0x2, 0x2, 0x78, 0x405, 0x3, 0x2, 0x2, 0x2, 0x7a, 0x41a, 0x3, 0x2, 0x2, 
-    0x2, 0x7c, 0x424, 0x3, 0x2, 0x2, 0x2, 0x7e, 0x42a, 0x3, 0x2, 0x2, 0x2, 
-    0x80, 0x438, 0x3, 0x2, 0x2, 0x2, 0x82, 0x43a, 0x3, 0x2, 0x2, 0x2, 0x84, 
-    0x43c, 0x3, 0x2, 0x2, 0x2, 0x86, 0x43e, 0x3, 0x2, 0x2, 0x2, 0x88, 0x448, 
-    0x3, 0x2, 0x2, 0x2, 0x8a, 0x452, 0x3, 0x2, 0x2, 0x2, 0x8c, 0x460, 0x3, 
-    0x2, 0x2, 0x2, 0x8e, 0x494, 0x3, 0x2, 0x2, 0x2, 0x90, 0x496, 0x3, 0x2, 
-    0x2, 0x2, 0x92, 0x498, 0x3, 0x2, 0x2, 0x2, 0x94, 0x4a6, 0x3, 0x2, 0x2, 
-    0x2, 0x96, 0x4b4, 0x3, 0x2, 0x2, 0x2, 0x98, 0x4c3, 0x3, 0x2, 0x2, 0x2, 
-    0x9a, 0x4c5, 0x3, 0x2, 0x2, 0x2, 0x9c, 0x4d4, 0x3, 0x2, 0x2, 0x2, 0x9e, 
-    0x4d6, 0x3, 0x2, 0x2, 0x2, 0xa0, 0x4e5, 0x3, 0x2, 0x2, 0x2, 0xa2, 0x4e7, 
-    0x3, 0x2, 0x2, 0x2, 0xa4, 0x4f9, 0x3, 0x2, 0x2, 0x2, 0xa6, 0x502, 0x3, 
-    0x2, 0x2, 0x2, 0xa8, 0x50a, 0x3, 0x2, 0x2, 0x2, 0xaa, 0x510, 0x3, 0x2, 
-    0x2, 0x2, 0xac, 0x517, 0x3, 0x2, 0x2, 0x2, 0xae, 0x52e, 0x3, 0x2, 0x2, 
-    0x2, 0xb0, 0x536, 0x3, 0x2, 0x2, 0x2, 0xb2, 0x544, 0x3, 0x2, 0x2, 0x2, 
-    0xb4, 0x546, 0x3, 0x2, 0x2, 0x2, 0xb6, 0x554, 0x3, 0x2, 0x2, 0x2, 0xb8, 
-    0x55b, 0x3, 0x2, 0x2, 0x2, 0xba, 0x55d, 0x3, 0x2, 0x2, 0x2, 0xbc, 0x55f, 
-    0x3, 0x2, 0x2, 0x2, 0xbe, 0x578, 0x3, 0x2, 0x2, 0x2, 0xc0, 0x5b3, 0x3, 
-    0x2, 0x2, 0x2, 0xc2, 0x5b5, 0x3, 0x2, 0x2, 0x2, 0xc4, 0x5b7, 0x3, 0x2, 
-    0x2, 0x2, 0xc6, 0x5cf, 0x3, 0x2, 0x2, 0x2, 0xc8, 0x5eb, 0x3, 0x2, 0x2, 
-    0x2, 0xca, 0x5fc, 0x3, 0x2, 0x2, 0x2, 0xcc, 0x60a, 0x3, 0x2, 0x2, 0x2, 
-    0xce, 0x60e, 0x3, 0x2, 0x2, 0x2, 0xd0, 0x610, 0x3, 0x2, 0x2, 0x2, 0xd2, 
-    0x615, 0x3, 0x2, 0x2, 0x2, 0xd4, 0x61b, 0x3, 0x2, 0x2, 0x2, 0xd6, 0x61d, 
-    0x3, 0x2, 0x2, 0x2, 0xd8, 0x61f, 0x3, 0x2, 0x2, 0x2, 0xda, 0x621, 0x3, 
-    0x2, 0x2, 0x2, 0xdc, 0x627, 0x3, 0x2, 0x2, 0x2, 0xde, 0x629, 0x3, 0x2, 
-    0x2, 0x2, 0xe0, 0x62b, 0x3, 0x2, 0x2, 0x2, 0xe2, 0x62d, 0x3, 0x2, 0x2, 
-    0x2, 0xe4, 0xe6, 0x7, 0x79, 0x2, 0x2, 0xe5, 0xe4, 0x3, 0x2, 0x2, 0x2, 
-    0xe5, 0xe6, 0x3, 0x2, 0x2, 0x2, 0xe6, 0xe8, 0x3, 0x2, 0x2, 0x2, 0xe7, 
-    0xe9, 0x5, 0x2c, 0x17, 0x2, 0xe8, 0xe7, 0x3, 0x2, 0x2, 0x2, 0xe8, 0xe9, 
-    0x3, 0x2, 0x2, 0x2, 0xe9, 0xeb, 0x3, 0x2, 0x2, 0x2, 0xea, 0xec, 0x7, 
-    0x79, 0x2, 0x2, 0xeb, 0xea, 0x3, 0x2, 0x2, 0x2, 0xeb, 0xec, 0x3, 0x2, 
-    0x2, 0x2, 0xec, 0xf0, 0x3, 0x2, 0x2, 0x2, 0xed, 0xf1, 0x5, 0x32, 0x1a, 
-    0x2, 0xee, 0xf1, 0x5, 0xc, 0x7, 0x2, 0xef, 0xf1, 0x5, 0x4, 0x3, 0x2, 
-    0xf0, 0xed, 0x3, 0x2, 0x2, 0x2, 0xf0, 0xee, 0x3, 0x2, 0x2, 0x2, 0xf0, 
-    0xef, 0x3, 0x2, 0x2, 0x2, 0xf1, 0xf6, 0x3, 0x2, 0x2, 0x2, 0xf2, 0xf4, 
-    0x7, 0x79, 0x2, 0x2, 0xf3, 0xf2, 0x3, 0x2, 0x2, 0x2, 0xf3, 0xf4, 0x3, 
-    0x2, 0x2, 0x2, 0xf4, 0xf5, 0x3, 0x2, 0x2, 0x2, 0xf5, 0xf7, 0x7, 0x3, 
-    0x2, 0x2, 0xf6, 0xf3, 0x3, 0x2, 0x2, 0x2, 0xf6, 0xf7, 0x3, 0x2, 0x2, 
-    0x2, 0xf7, 0xf9, 0x3, 0x2, 0x2, 0x2, 0xf8, 0xfa, 0x7, 0x79, 0x2, 0x2, 
-    0xf9, 0xf8, 0x3, 0x2, 0x2, 0x2, 0xf9, 0xfa, 0x3, 0x2, 0x2, 0x2, 0xfa, 
-    0xfb, 0x3, 0x2, 0x2, 0x2, 0xfb, 0xfc, 0x7, 0x2, 0x2, 0x3, 0xfc, 0x3, 
-    0x3, 0x2, 0x2, 0x2, 0xfd, 0xfe, 0x7, 0x32, 0x2, 0x2, 0xfe, 0xff, 0x7, 
-    0x79, 0x2, 0x2, 0xff, 0x100, 0x5, 0xda, 0x6e, 0x2, 0x100, 0x101, 0x7, 
-    0x79, 0x2, 0x2, 0x101, 0x102, 0x7, 0x33, 0x2, 0x2, 0x102, 0x103, 0x7, 
-    0x79, 0x2, 0x2, 0x103, 0x111, 0x5, 0x6, 0x4, 0x2, 0x104, 0x106, 0x7, 
-    0x79, 0x2, 0x2, 0x105, 0x104, 0x3, 0x2, 0x2, 0x2, 0x105, 0x106, 0x3, 
-    0x2, 0x2, 0x2, 0x106, 0x107, 0x3, 0x2, 0x2, 0x2, 0x107, 0x109, 0x7, 
-    0x4, 0x2, 0x2, 0x108, 0x10a, 0x7, 0x79, 0x2, 0x2, 0x109, 0x108, 0x3, 
-    0x2, 0x2, 0x2, 0x109, 0x10a, 0x3, 0x2, 0x2, 0x2, 0x10a, 0x10b, 0x3, 
-    0x2, 0x2, 0x2, 0x10b, 0x10d, 0x5, 0x8, 0x5, 0x2, 0x10c, 0x10e, 0x7, 
-    0x79, 0x2, 0x2, 0x10d, 0x10c, 0x3, 0x2, 0x2, 0x2, 0x10d, 0x10e, 0x3, 
-    0x2, 0x2, 0x2, 0x10e, 0x10f, 0x3, 0x2, 0x2, 0x2, 0x10f, 0x110, 0x7, 
-    0x5, 0x2, 0x2, 0x110, 0x112, 0x3, 0x2, 0x2, 0x2, 0x111, 0x105, 0x3, 
-    0x2, 0x2, 0x2, 0x111, 0x112, 0x3, 0x2, 0x2, 0x2, 0x112, 0x5, 0x3, 0x2, 
-    0x2, 0x2, 0x113, 0x115, 0x7, 0x6, 0x2, 0x2, 0x114, 0x116, 0x7, 0x79, 
-    0x2, 0x2, 0x115, 0x114, 0x3, 0x2, 0x2, 0x2, 0x115, 0x116, 0x3, 0x2, 
-    0x2, 0x2, 0x116, 0x117, 0x3, 0x2, 0x2, 0x2, 0x117, 0x122, 0x7, 0x6b, 
-    0x2, 0x2, 0x118, 0x11a, 0x7, 0x79, 0x2, 0x2, 0x119, 0x118, 0x3, 0x2, 
-    0x2, 0x2, 0x119, 0x11a, 0x3, 0x2, 0x2, 0x2, 0x11a, 0x11b, 0x3, 0x2, 
-    0x2, 0x2, 0x11b, 0x11d, 0x7, 0x7, 0x2, 0x2, 0x11c, 0x11e, 0x7, 0x79, 
-    0x2, 0x2, 0x11d, 0x11c, 0x3, 0x2, 0x2, 0x2, 0x11d, 0x11e, 0x3, 0x2, 
-    0x2, 0x2, 0x11e, 0x11f, 0x3, 0x2, 0x2, 0x2, 0x11f, 0x121, 0x7, 0x6b, 
-    0x2, 0x2, 0x120, 0x119, 0x3, 0x2, 0x2, 0x2, 0x121, 0x124, 0x3, 0x2, 
-    0x2, 0x2, 0x122, 0x120, 0x3, 0x2, 0x2, 0x2, 0x122, 0x123, 0x3, 0x2, 
-    0x2, 0x2, 0x123, 0x125, 0x3, 0x2, 0x2, 0x2, 0x124, 0x122, 0x3, 0x2, 
-    0x2, 0x2, 0x125, 0x135, 0x7, 0x8, 0x2, 0x2, 0x126, 0x135, 0x7, 0x6b, 
-    0x2, 0x2, 0x127, 0x129, 0x7, 0x31, 0x2, 0x2, 0x128, 0x12a, 0x7, 0x79, 
-    0x2, 0x2, 0x129, 0x128, 0x3, 0x2, 0x2, 0x2, 0x129, 0x12a, 0x3, 0x2, 
-    0x2, 0x2, 0x12a, 0x12b, 0x3, 0x2, 0x2, 0x2, 0x12b, 0x12d, 0x7, 0x4, 
-    0x2, 0x2, 0x12c, 0x12e, 0x7, 0x79, 0x2, 0x2, 0x12d, 0x12c, 0x3, 0x2, 
-    0x2, 0x2, 0x12d, 0x12e, 0x3, 0x2, 0x2, 0x2, 0x12e, 0x12f, 0x3, 0x2, 
-    0x2, 0x2, 0x12f, 0x131, 0x7, 0x6b, 0x2, 0x2, 0x130, 0x132, 0x7, 0x79, 
-    0x2, 0x2, 0x131, 0x130, 0x3, 0x2, 0x2, 0x2, 0x131, 0x132, 0x3, 0x2, 
-    0x2, 0x2, 0x132, 0x133, 0x3, 0x2, 0x2, 0x2, 0x133, 0x135, 0x7, 0x5, 
-    0x2, 0x2, 0x134, 0x113, 0x3, 0x2, 0x2, 0x2, 0x134, 0x126, 0x3, 0x2, 
-    0x2, 0x2, 0x134, 0x127, 0x3, 0x2, 0x2, 0x2, 0x135, 0x7, 0x3, 0x2, 0x2, 
-    0x2, 0x136, 0x141, 0x5, 0xa, 0x6, 0x2, 0x137, 0x139, 0x7, 0x79, 0x2, 
-    0x2, 0x138, 0x137, 0x3, 0x2, 0x2, 0x2, 0x138, 0x139, 0x3, 0x2, 0x2, 
-    0x2, 0x139, 0x13a, 0x3, 0x2, 0x2, 0x2, 0x13a, 0x13c, 0x7, 0x7, 0x2, 
-    0x2, 0x13b, 0x13d, 0x7, 0x79, 0x2, 0x2, 0x13c, 0x13b, 0x3, 0x2, 0x2, 
-    0x2, 0x13c, 0x13d, 0x3, 0x2, 0x2, 0x2, 0x13d, 0x13e, 0x3, 0x2, 0x2, 
-    0x2, 0x13e, 0x140, 0x5, 0xa, 0x6, 0x2, 0x13f, 0x138, 0x3, 0x2, 0x2, 
-    0x2, 0x140, 0x143, 0x3, 0x2, 0x2, 0x2, 0x141, 0x13f, 0x3, 0x2, 0x2, 
-    0x2, 0x141, 0x142, 0x3, 0x2, 0x2, 0x2, 0x142, 0x9, 0x3, 0x2, 0x2, 0x2, 
-    0x143, 0x141, 0x3, 0x2, 0x2, 0x2, 0x144, 0x146, 0x5, 0xdc, 0x6f, 0x2, 
-    0x145, 0x147, 0x7, 0x79, 0x2, 0x2, 0x146, 0x145, 0x3, 0x2, 0x2, 0x2, 
-    0x146, 0x147, 0x3, 0x2, 0x2, 0x2, 0x147, 0x148, 0x3, 0x2, 0x2, 0x2, 
-    0x148, 0x14a, 0x7, 0x9, 0x2, 0x2, 0x149, 0x14b, 0x7, 0x79, 0x2, 0x2, 
-    0x14a, 0x149, 0x3, 0x2, 0x2, 0x2, 0x14a, 0x14b, 0x3, 0x2, 0x2, 0x2, 
-    0x14b, 0x14c, 0x3, 0x2, 0x2, 0x2, 0x14c, 0x14d, 0x5, 0xb8, 0x5d, 0x2, 
-    0x14d, 0xb, 0x3, 0x2, 0x2, 0x2, 0x14e, 0x153, 0x5, 0xe, 0x8, 0x2, 0x14f, 
-    0x153, 0x5, 0x10, 0x9, 0x2, 0x150, 0x153, 0x5, 0x12, 0xa, 0x2, 0x151, 
-    0x153, 0x5, 0x14, 0xb, 0x2, 0x152, 0x14e, 0x3, 0x2, 0x2, 0x2, 0x152, 
-    0x14f, 0x3, 0x2, 0x2, 0x2, 0x152, 0x150, 0x3, 0x2, 0x2, 0x2, 0x152, 
-    0x151, 0x3, 0x2, 0x2, 0x2, 0x153, 0xd, 0x3, 0x2, 0x2, 0x2, 0x154, 0x155, 
+    0x5a, 0x3, 0x5a, 0x3, 0x5a, 0x5, 0x5a, 0x545, 0xa, 0x5a, 0x3, 0x5b, 0x3, 
+    0x5b, 0x5, 0x5b, 0x549, 0xa, 0x5b, 0x3, 0x5b, 0x5, 0x5b, 0x54c, 0xa, 
+    0x5b, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 0x3, 0x5c, 
+    0x3, 0x5c, 0x5, 0x5c, 0x555, 0xa, 0x5c, 0x3, 0x5d, 0x3, 0x5d, 0x3, 0x5d, 
+    0x3, 0x5d, 0x3, 0x5d, 0x5, 0x5d, 0x55c, 0xa, 0x5d, 0x3, 0x5e, 0x3, 0x5e, 
+    0x3, 0x5f, 0x3, 0x5f, 0x5, 0x5f, 0x562, 0xa, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 
+    0x5, 0x5f, 0x566, 0xa, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x5, 0x5f, 0x56a, 0xa, 
+    0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x5, 0x5f, 0x56e, 0xa, 0x5f, 0x7, 0x5f, 
+    0x570, 0xa, 0x5f, 0xc, 0x5f, 0xe, 0x5f, 0x573, 0xb, 0x5f, 0x5, 0x5f, 
+    0x575, 0xa, 0x5f, 0x3, 0x5f, 0x3, 0x5f, 0x3, 0x60, 0x3, 0x60, 0x5, 0x60, 
+    0x57b, 0xa, 0x60, 0x3, 0x60, 0x3, 0x60, 0x5, 0x60, 0x57f, 0xa, 0x60, 0x3, 
+    0x60, 0x3, 0x60, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x585, 0xa, 0x61, 0x3, 
+    0x61, 0x3, 0x61, 0x5, 0x61, 0x589, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 
+    0x61, 0x58d, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 
+    0x61, 0x593, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x597, 0xa, 
+    0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x59b, 0xa, 0x61, 0x5, 0x61, 
+    0x59d, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 0x61, 0x5a1, 0xa, 0x61, 0x3, 
+    0x61, 0x3, 0x61, 0x5, 0x61, 0x5a5, 0xa, 0x61, 0x3, 0x61, 0x3, 0x61, 0x5, 
+    0x61, 0x5a9, 0xa, 0x61, 0x7, 0x61, 0x5ab, 0xa, 0x61, 0xc, 0x61, 0xe, 
+    0x61, 0x5ae, 0xb, 0x61, 0x5, 0x61, 0x5b0, 0xa, 0x61, 0x3, 0x61, 0x3, 
+    0x61, 0x5, 0x61, 0x5b4, 0xa, 0x61, 0x3, 0x62, 0x3, 0x62, 0x3, 0x63, 0x3, 
+    0x63, 0x5, 0x63, 0x5ba, 0xa, 0x63, 0x3, 0x63, 0x3, 0x63, 0x5, 0x63, 
+    0x5be, 0xa, 0x63, 0x3, 0x63, 0x3, 0x63, 0x5, 0x63, 0x5c2, 0xa, 0x63, 0x3, 
+    0x63, 0x3, 0x63, 0x5, 0x63, 0x5c6, 0xa, 0x63, 0x3, 0x63, 0x5, 0x63, 
+    0x5c9, 0xa, 0x63, 0x3, 0x63, 0x5, 0x63, 0x5cc, 0xa, 0x63, 0x3, 0x63, 0x3, 
+    0x63, 0x3, 0x64, 0x3, 0x64, 0x5, 0x64, 0x5d2, 0xa, 0x64, 0x3, 0x64, 0x3, 
+    0x64, 0x3, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5d8, 0xa, 0x65, 0x3, 0x65, 0x6, 
+    0x65, 0x5db, 0xa, 0x65, 0xd, 0x65, 0xe, 0x65, 0x5dc, 0x3, 0x65, 0x3, 
+    0x65, 0x5, 0x65, 0x5e1, 0xa, 0x65, 0x3, 0x65, 0x3, 0x65, 0x5, 0x65, 
+    0x5e5, 0xa, 0x65, 0x3, 0x65, 0x6, 0x65, 0x5e8, 0xa, 0x65, 0xd, 0x65, 0xe, 
+    0x65, 0x5e9, 0x5, 0x65, 0x5ec, 0xa, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5ef, 
+    0xa, 0x65, 0x3, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5f3, 0xa, 0x65, 0x3, 0x65, 
+    0x5, 0x65, 0x5f6, 0xa, 0x65, 0x3, 0x65, 0x5, 0x65, 0x5f9, 0xa, 0x65, 0x3, 
+    0x65, 0x3, 0x65, 0x3, 0x66, 0x3, 0x66, 0x5, 0x66, 0x5ff, 0xa, 0x66, 0x3, 
+    0x66, 0x3, 0x66, 0x5, 0x66, 0x603, 0xa, 0x66, 0x3, 0x66, 0x3, 0x66, 0x5, 
+    0x66, 0x607, 0xa, 0x66, 0x3, 0x66, 0x3, 0x66, 0x3, 0x67, 0x3, 0x67, 0x3, 
+    0x68, 0x3, 0x68, 0x5, 0x68, 0x60f, 0xa, 0x68, 0x3, 0x69, 0x3, 0x69, 0x3, 
+    0x69, 0x5, 0x69, 0x614, 0xa, 0x69, 0x3, 0x6a, 0x3, 0x6a, 0x5, 0x6a, 
+    0x618, 0xa, 0x6a, 0x3, 0x6a, 0x3, 0x6a, 0x3, 0x6b, 0x3, 0x6b, 0x3, 0x6c, 
+    0x3, 0x6c, 0x3, 0x6d, 0x3, 0x6d, 0x3, 0x6e, 0x3, 0x6e, 0x3, 0x6f, 0x3, 
+    0x6f, 0x3, 0x6f, 0x3, 0x6f, 0x5, 0x6f, 0x628, 0xa, 0x6f, 0x3, 0x70, 0x3, 
+    0x70, 0x3, 0x71, 0x3, 0x71, 0x3, 0x72, 0x3, 0x72, 0x3, 0x72, 0x4, 0x73, 
+    0x9, 0x73, 0x3, 0x73, 0x3, 0x73, 0x3, 0x73, 0x3, 0x73, 0x3, 0x73, 0x3, 
+    0x73, 0x3, 0x73, 0x3, 0x73, 0x5, 0x73, 0x63b, 0xa, 0x73, 0x3, 0x73, 0x3, 
+    0x73, 0x5, 0x73, 0x63f, 0xa, 0x73, 0x3, 0x73, 0x3, 0x73, 0x5, 0x73, 
+    0x643, 0xa, 0x73, 0x3, 0x73, 0x3, 0x73, 0x3, 0x7, 0x2, 0x2, 0x74, 0x2, 
+    0x4, 0x6, 0x8, 0xa, 0xc, 0xe, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 
+    0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30, 0x32, 0x34, 
+    0x36, 0x38, 0x3a, 0x3c, 0x3e, 0x40, 0x42, 0x44, 0x46, 0x48, 0x4a, 0x4c, 
+    0x4e, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5a, 0x5c, 0x5e, 0x60, 0x62, 0x64, 
+    0x66, 0x68, 0x6a, 0x6c, 0x6e, 0x70, 0x72, 0x74, 0x76, 0x78, 0x7a, 0x7c, 
+    0x7e, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x94, 
+    0x96, 0x98, 0x9a, 0x9c, 0x9e, 0xa0, 0xa2, 0xa4, 0xa6, 0xa8, 0xaa, 0xac, 
+    0xae, 0xb0, 0xb2, 0xb4, 0xb6, 0xb8, 0xba, 0xbc, 0xbe, 0xc0, 0xc2, 0xc4, 
+    0xc6, 0xc8, 0xca, 0xcc, 0xce, 0xd0, 0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 
+    0xde, 0xe0, 0xe2, 0x630, 0x2, 0xb, 0x3, 0x2, 0x52, 0x55, 0x4, 0x2, 0x9, 
+    0x9, 0xf, 0x13, 0x3, 0x2, 0x15, 0x16, 0x4, 0x2, 0x17, 0x17, 0x5c, 0x5c, 
+    0x4, 0x2, 0x18, 0x19, 0x4c, 0x4c, 0x3, 0x2, 0x63, 0x64, 0x4, 0x2, 0x10, 
+    0x10, 0x1e, 0x21, 0x4, 0x2, 0x12, 0x12, 0x22, 0x25, 0x4, 0x2, 0x26, 0x30, 
+    0x5c, 0x5c, 0x2, 0x6ff, 0x2, 0xe5, 0x3, 0x2, 0x2, 0x2, 0x4, 0xfd, 0x3, 
+    0x2, 0x2, 0x2, 0x6, 0x134, 0x3, 0x2, 0x2, 0x2, 0x8, 0x136, 0x3, 0x2, 0x2, 
+    0x2, 0xa, 0x144, 0x3, 0x2, 0x2, 0x2, 0xc, 0x152, 0x3, 0x2, 0x2, 0x2, 0xe, 
+    0x154, 0x3, 0x2, 0x2, 0x2, 0x10, 0x171, 0x3, 0x2, 0x2, 0x2, 0x12, 0x19f, 
+    0x3, 0x2, 0x2, 0x2, 0x14, 0x1a5, 0x3, 0x2, 0x2, 0x2, 0x16, 0x1b1, 0x3, 
+    0x2, 0x2, 0x2, 0x18, 0x1b3, 0x3, 0x2, 0x2, 0x2, 0x1a, 0x1be, 0x3, 0x2, 
+    0x2, 0x2, 0x1c, 0x1c2, 0x3, 0x2, 0x2, 0x2, 0x1e, 0x1c8, 0x3, 0x2, 0x2, 
+    0x2, 0x20, 0x1d0, 0x3, 0x2, 0x2, 0x2, 0x22, 0x1de, 0x3, 0x2, 0x2, 0x2, 
+    0x24, 0x1e2, 0x3, 0x2, 0x2, 0x2, 0x26, 0x1f6, 0x3, 0x2, 0x2, 0x2, 0x28, 
+    0x1f8, 0x3, 0x2, 0x2, 0x2, 0x2a, 0x1ff, 0x3, 0x2, 0x2, 0x2, 0x2c, 0x207, 
+    0x3, 0x2, 0x2, 0x2, 0x2e, 0x209, 0x3, 0x2, 0x2, 0x2, 0x30, 0x20b, 0x3, 
+    0x2, 0x2, 0x2, 0x32, 0x20d, 0x3, 0x2, 0x2, 0x2, 0x34, 0x20f, 0x3, 0x2, 
+    0x2, 0x2, 0x36, 0x226, 0x3, 0x2, 0x2, 0x2, 0x38, 0x234, 0x3, 0x2, 0x2, 
+    0x2, 0x3a, 0x238, 0x3, 0x2, 0x2, 0x2, 0x3c, 0x267, 0x3, 0x2, 0x2, 0x2, 
+    0x3e, 0x26d, 0x3, 0x2, 0x2, 0x2, 0x40, 0x279, 0x3, 0x2, 0x2, 0x2, 0x42, 
+    0x28a, 0x3, 0x2, 0x2, 0x2, 0x44, 0x28e, 0x3, 0x2, 0x2, 0x2, 0x46, 0x292, 
+    0x3, 0x2, 0x2, 0x2, 0x48, 0x29f, 0x3, 0x2, 0x2, 0x2, 0x4a, 0x2a9, 0x3, 
+    0x2, 0x2, 0x2, 0x4c, 0x2af, 0x3, 0x2, 0x2, 0x2, 0x4e, 0x2c1, 0x3, 0x2, 
+    0x2, 0x2, 0x50, 0x2cb, 0x3, 0x2, 0x2, 0x2, 0x52, 0x2dd, 0x3, 0x2, 0x2, 
+    0x2, 0x54, 0x2e5, 0x3, 0x2, 0x2, 0x2, 0x56, 0x2ec, 0x3, 0x2, 0x2, 0x2, 
+    0x58, 0x318, 0x3, 0x2, 0x2, 0x2, 0x5a, 0x321, 0x3, 0x2, 0x2, 0x2, 0x5c, 
+    0x323, 0x3, 0x2, 0x2, 0x2, 0x5e, 0x332, 0x3, 0x2, 0x2, 0x2, 0x60, 0x336, 
+    0x3, 0x2, 0x2, 0x2, 0x62, 0x33a, 0x3, 0x2, 0x2, 0x2, 0x64, 0x341, 0x3, 
+    0x2, 0x2, 0x2, 0x66, 0x345, 0x3, 0x2, 0x2, 0x2, 0x68, 0x353, 0x3, 0x2, 
+    0x2, 0x2, 0x6a, 0x355, 0x3, 0x2, 0x2, 0x2, 0x6c, 0x365, 0x3, 0x2, 0x2, 
+    0x2, 0x6e, 0x394, 0x3, 0x2, 0x2, 0x2, 0x70, 0x396, 0x3, 0x2, 0x2, 0x2, 
+    0x72, 0x3bc, 0x3, 0x2, 0x2, 0x2, 0x74, 0x3be, 0x3, 0x2, 0x2, 0x2, 0x76, 
+    0x3dc, 0x3, 0x2, 0x2, 0x2, 0x78, 0x405, 0x3, 0x2, 0x2, 0x2, 0x7a, 0x41a, 
+    0x3, 0x2, 0x2, 0x2, 0x7c, 0x424, 0x3, 0x2, 0x2, 0x2, 0x7e, 0x42a, 0x3, 
+    0x2, 0x2, 0x2, 0x80, 0x438, 0x3, 0x2, 0x2, 0x2, 0x82, 0x43a, 0x3, 0x2, 
+    0x2, 0x2, 0x84, 0x43c, 0x3, 0x2, 0x2, 0x2, 0x86, 0x43e, 0x3, 0x2, 0x2, 
+    0x2, 0x88, 0x448, 0x3, 0x2, 0x2, 0x2, 0x8a, 0x452, 0x3, 0x2, 0x2, 0x2, 
+    0x8c, 0x460, 0x3, 0x2, 0x2, 0x2, 0x8e, 0x494, 0x3, 0x2, 0x2, 0x2, 0x90, 
+    0x496, 0x3, 0x2, 0x2, 0x2, 0x92, 0x498, 0x3, 0x2, 0x2, 0x2, 0x94, 0x4a6, 
+    0x3, 0x2, 0x2, 0x2, 0x96, 0x4b4, 0x3, 0x2, 0x2, 0x2, 0x98, 0x4c3, 0x3, 
+    0x2, 0x2, 0x2, 0x9a, 0x4c5, 0x3, 0x2, 0x2, 0x2, 0x9c, 0x4d4, 0x3, 0x2, 
+    0x2, 0x2, 0x9e, 0x4d6, 0x3, 0x2, 0x2, 0x2, 0xa0, 0x4e5, 0x3, 0x2, 0x2, 
+    0x2, 0xa2, 0x4e7, 0x3, 0x2, 0x2, 0x2, 0xa4, 0x4f9, 0x3, 0x2, 0x2, 0x2, 
+    0xa6, 0x502, 0x3, 0x2, 0x2, 0x2, 0xa8, 0x50a, 0x3, 0x2, 0x2, 0x2, 0xaa, 
+    0x510, 0x3, 0x2, 0x2, 0x2, 0xac, 0x517, 0x3, 0x2, 0x2, 0x2, 0xae, 0x52e, 
+    0x3, 0x2, 0x2, 0x2, 0xb0, 0x536, 0x3, 0x2, 0x2, 0x2, 0xb2, 0x544, 0x3, 
+    0x2, 0x2, 0x2, 0xb4, 0x546, 0x3, 0x2, 0x2, 0x2, 0xb6, 0x554, 0x3, 0x2, 
+    0x2, 0x2, 0xb8, 0x55b, 0x3, 0x2, 0x2, 0x2, 0xba, 0x55d, 0x3, 0x2, 0x2, 
+    0x2, 0xbc, 0x55f, 0x3, 0x2, 0x2, 0x2, 0xbe, 0x578, 0x3, 0x2, 0x2, 0x2, 
+    0xc0, 0x5b3, 0x3, 0x2, 0x2, 0x2, 0xc2, 0x5b5, 0x3, 0x2, 0x2, 0x2, 0xc4, 
+    0x5b7, 0x3, 0x2, 0x2, 0x2, 0xc6, 0x5cf, 0x3, 0x2, 0x2, 0x2, 0xc8, 0x5eb, 
+    0x3, 0x2, 0x2, 0x2, 0xca, 0x5fc, 0x3, 0x2, 0x2, 0x2, 0xcc, 0x60a, 0x3, 
+    0x2, 0x2, 0x2, 0xce, 0x60e, 0x3, 0x2, 0x2, 0x2, 0xd0, 0x610, 0x3, 0x2, 
+    0x2, 0x2, 0xd2, 0x615, 0x3, 0x2, 0x2, 0x2, 0xd4, 0x61b, 0x3, 0x2, 0x2, 
+    0x2, 0xd6, 0x61d, 0x3, 0x2, 0x2, 0x2, 0xd8, 0x61f, 0x3, 0x2, 0x2, 0x2, 
+    0xda, 0x621, 0x3, 0x2, 0x2, 0x2, 0xdc, 0x627, 0x3, 0x2, 0x2, 0x2, 0xde, 
+    0x629, 0x3, 0x2, 0x2, 0x2, 0xe0, 0x62b, 0x3, 0x2, 0x2, 0x2, 0xe2, 0x62d, 
+    0x3, 0x2, 0x2, 0x2, 0xe4, 0xe6, 0x7, 0x79, 0x2, 0x2, 0xe5, 0xe4, 0x3, 
+    0x2, 0x2, 0x2, 0xe5, 0xe6, 0x3, 0x2, 0x2, 0x2, 0xe6, 0xe8, 0x3, 0x2, 0x2, 
+    0x2, 0xe7, 0xe9, 0x5, 0x2c, 0x17, 0x2, 0xe8, 0xe7, 0x3, 0x2, 0x2, 0x2, 
+    0xe8, 0xe9, 0x3, 0x2, 0x2, 0x2, 0xe9, 0xeb, 0x3, 0x2, 0x2, 0x2, 0xea, 
+    0xec, 0x7, 0x79, 0x2, 0x2, 0xeb, 0xea, 0x3, 0x2, 0x2, 0x2, 0xeb, 0xec, 
+    0x3, 0x2, 0x2, 0x2, 0xec, 0xf0, 0x3, 0x2, 0x2, 0x2, 0xed, 0xf1, 0x5, 
+    0x32, 0x1a, 0x2, 0xee, 0xf1, 0x5, 0xc, 0x7, 0x2, 0xef, 0xf1, 0x5, 0x4, 
+    0x3, 0x2, 0xf0, 0xed, 0x3, 0x2, 0x2, 0x2, 0xf0, 0xee, 0x3, 0x2, 0x2, 0x2, 
+    0xf0, 0xef, 0x3, 0x2, 0x2, 0x2, 0xf1, 0xf6, 0x3, 0x2, 0x2, 0x2, 0xf2, 
+    0xf4, 0x7, 0x79, 0x2, 0x2, 0xf3, 0xf2, 0x3, 0x2, 0x2, 0x2, 0xf3, 0xf4, 
+    0x3, 0x2, 0x2, 0x2, 0xf4, 0xf5, 0x3, 0x2, 0x2, 0x2, 0xf5, 0xf7, 0x7, 0x3, 
+    0x2, 0x2, 0xf6, 0xf3, 0x3, 0x2, 0x2, 0x2, 0xf6, 0xf7, 0x3, 0x2, 0x2, 0x2, 
+    0xf7, 0xf9, 0x3, 0x2, 0x2, 0x2, 0xf8, 0xfa, 0x7, 0x79, 0x2, 0x2, 0xf9, 
+    0xf8, 0x3, 0x2, 0x2, 0x2, 0xf9, 0xfa, 0x3, 0x2, 0x2, 0x2, 0xfa, 0xfb, 
+    0x3, 0x2, 0x2, 0x2, 0xfb, 0xfc, 0x7, 0x2, 0x2, 0x3, 0xfc, 0x3, 0x3, 0x2, 
+    0x2, 0x2, 0xfd, 0xfe, 0x7, 0x32, 0x2, 0x2, 0xfe, 0xff, 0x7, 0x79, 0x2, 
+    0x2, 0xff, 0x100, 0x5, 0xda, 0x6e, 0x2, 0x100, 0x101, 0x7, 0x79, 0x2, 
+    0x2, 0x101, 0x102, 0x7, 0x33, 0x2, 0x2, 0x102, 0x103, 0x7, 0x79, 0x2, 
+    0x2, 0x103, 0x111, 0x5, 0x6, 0x4, 0x2, 0x104, 0x106, 0x7, 0x79, 0x2, 0x2, 
+    0x105, 0x104, 0x3, 0x2, 0x2, 0x2, 0x105, 0x106, 0x3, 0x2, 0x2, 0x2, 
+    0x106, 0x107, 0x3, 0x2, 0x2, 0x2, 0x107, 0x109, 0x7, 0x4, 0x2, 0x2, 
+    0x108, 0x10a, 0x7, 0x79, 0x2, 0x2, 0x109, 0x108, 0x3, 0x2, 0x2, 0x2, 
+    0x109, 0x10a, 0x3, 0x2, 0x2, 0x2, 0x10a, 0x10b, 0x3, 0x2, 0x2, 0x2, 
+    0x10b, 0x10d, 0x5, 0x8, 0x5, 0x2, 0x10c, 0x10e, 0x7, 0x79, 0x2, 0x2, 
+    0x10d, 0x10c, 0x3, 0x2, 0x2, 0x2, 0x10d, 0x10e, 0x3, 0x2, 0x2, 0x2, 
+    0x10e, 0x10f, 0x3, 0x2, 0x2, 0x2, 0x10f, 0x110, 0x7, 0x5, 0x2, 0x2, 
+    0x110, 0x112, 0x3, 0x2, 0x2, 0x2, 0x111, 0x105, 0x3, 0x2, 0x2, 0x2, 
+    0x111, 0x112, 0x3, 0x2, 0x2, 0x2, 0x112, 0x5, 0x3, 0x2, 0x2, 0x2, 0x113, 
+    0x115, 0x7, 0x6, 0x2, 0x2, 0x114, 0x116, 0x7, 0x79, 0x2, 0x2, 0x115, 
+    0x114, 0x3, 0x2, 0x2, 0x2, 0x115, 0x116, 0x3, 0x2, 0x2, 0x2, 0x116, 
+    0x117, 0x3, 0x2, 0x2, 0x2, 0x117, 0x122, 0x7, 0x6b, 0x2, 0x2, 0x118, 
+    0x11a, 0x7, 0x79, 0x2, 0x2, 0x119, 0x118, 0x3, 0x2, 0x2, 0x2, 0x119, 
+    0x11a, 0x3, 0x2, 0x2, 0x2, 0x11a, 0x11b, 0x3, 0x2, 0x2, 0x2, 0x11b, 
+    0x11d, 0x7, 0x7, 0x2, 0x2, 0x11c, 0x11e, 0x7, 0x79, 0x2, 0x2, 0x11d, 
+    0x11c, 0x3, 0x2, 0x2, 0x2, 0x11d, 0x11e, 0x3, 0x2, 0x2, 0x2, 0x11e, 
+    0x11f, 0x3, 0x2, 0x2, 0x2, 0x11f, 0x121, 0x7, 0x6b, 0x2, 0x2, 0x120, 
+    0x119, 0x3, 0x2, 0x2, 0x2, 0x121, 0x124, 0x3, 0x2, 0x2, 0x2, 0x122, 
+    0x120, 0x3, 0x2, 0x2, 0x2, 0x122, 0x123, 0x3, 0x2, 0x2, 0x2, 0x123, 
+    0x125, 0x3, 0x2, 0x2, 0x2, 0x124, 0x122, 0x3, 0x2, 0x2, 0x2, 0x125, 
+    0x135, 0x7, 0x8, 0x2, 0x2, 0x126, 0x135, 0x7, 0x6b, 0x2, 0x2, 0x127, 
+    0x129, 0x7, 0x31, 0x2, 0x2, 0x128, 0x12a, 0x7, 0x79, 0x2, 0x2, 0x129, 
+    0x128, 0x3, 0x2, 0x2, 0x2, 0x129, 0x12a, 0x3, 0x2, 0x2, 0x2, 0x12a, 
+    0x12b, 0x3, 0x2, 0x2, 0x2, 0x12b, 0x12d, 0x7, 0x4, 0x2, 0x2, 0x12c, 
+    0x12e, 0x7, 0x79, 0x2, 0x2, 0x12d, 0x12c, 0x3, 0x2, 0x2, 0x2, 0x12d, 
+    0x12e, 0x3, 0x2, 0x2, 0x2, 0x12e, 0x12f, 0x3, 0x2, 0x2, 0x2, 0x12f, 
+    0x131, 0x7, 0x6b, 0x2, 0x2, 0x130, 0x132, 0x7, 0x79, 0x2, 0x2, 0x131, 
+    0x130, 0x3, 0x2, 0x2, 0x2, 0x131, 0x132, 0x3, 0x2, 0x2, 0x2, 0x132, 
+    0x133, 0x3, 0x2, 0x2, 0x2, 0x133, 0x135, 0x7, 0x5, 0x2, 0x2, 0x134, 
+    0x113, 0x3, 0x2, 0x2, 0x2, 0x134, 0x126, 0x3, 0x2, 0x2, 0x2, 0x134, 
+    0x127, 0x3, 0x2, 0x2, 0x2, 0x135, 0x7, 0x3, 0x2, 0x2, 0x2, 0x136, 0x141, 
+    0x5, 0xa, 0x6, 0x2, 0x137, 0x139, 0x7, 0x79, 0x2, 0x2, 0x138, 0x137, 0x3, 
+    0x2, 0x2, 0x2, 0x138, 0x139, 0x3, 0x2, 0x2, 0x2, 0x139, 0x13a, 0x3, 0x2, 
+    0x2, 0x2, 0x13a, 0x13c, 0x7, 0x7, 0x2, 0x2, 0x13b, 0x13d, 0x7, 0x79, 0x2, 
+    0x2, 0x13c, 0x13b, 0x3, 0x2, 0x2, 0x2, 0x13c, 0x13d, 0x3, 0x2, 0x2, 0x2, 
+    0x13d, 0x13e, 0x3, 0x2, 0x2, 0x2, 0x13e, 0x140, 0x5, 0xa, 0x6, 0x2, 
+    0x13f, 0x138, 0x3, 0x2, 0x2, 0x2, 0x140, 0x143, 0x3, 0x2, 0x2, 0x2, 
+    0x141, 0x13f, 0x3, 0x2, 0x2, 0x2, 0x141, 0x142, 0x3, 0x2, 0x2, 0x2, 
+    0x142, 0x9, 0x3, 0x2, 0x2, 0x2, 0x143, 0x141, 0x3, 0x2, 0x2, 0x2, 0x144, 
+    0x146, 0x5, 0xdc, 0x6f, 0x2, 0x145, 0x147, 0x7, 0x79, 0x2, 0x2, 0x146, 
+    0x145, 0x3, 0x2, 0x2, 0x2, 0x146, 0x147, 0x3, 0x2, 0x2, 0x2, 0x147, 
+    0x148, 0x3, 0x2, 0x2, 0x2, 0x148, 0x14a, 0x7, 0x9, 0x2, 0x2, 0x149, 
+    0x14b, 0x7, 0x79, 0x2, 0x2, 0x14a, 0x149, 0x3, 0x2, 0x2, 0x2, 0x14a, 
+    0x14b, 0x3, 0x2, 0x2, 0x2, 0x14b, 0x14c, 0x3, 0x2, 0x2, 0x2, 0x14c, 
+    0x14d, 0x5, 0xb8, 0x5d, 0x2, 0x14d, 0xb, 0x3, 0x2, 0x2, 0x2, 0x14e, 
+    0x153, 0x5, 0xe, 0x8, 0x2, 0x14f, 0x153, 0x5, 0x10, 0x9, 0x2, 0x150, 
+    0x153, 0x5, 0x12, 0xa, 0x2, 0x151, 0x153, 0x5, 0x14, 0xb, 0x2, 0x152, 
+    0x14e, 0x3, 0x2, 0x2, 0x2, 0x152, 0x14f, 0x3, 0x2, 0x2, 0x2, 0x152, 
+    0x150, 0x3, 0x2, 0x2, 0x2, 0x152, 0x151, 0x3, 0x2, 0x2, 0x2, 0x152, 
+    0x646, 0x3, 0x2, 0x2, 0x2, 0x153, 0xd, 0x3, 0x2, 0x2, 0x2, 0x154, 0x155, 
     0x7, 0x46, 0x2, 0x2, 0x155, 0x156, 0x7, 0x79, 0x2, 0x2, 0x156, 0x157, 
     0x7, 0x34, 0x2, 0x2, 0x157, 0x158, 0x7, 0x79, 0x2, 0x2, 0x158, 0x159, 
     0x7, 0x35, 0x2, 0x2, 0x159, 0x15a, 0x7, 0x79, 0x2, 0x2, 0x15a, 0x15c, 
     0x5, 0xda, 0x6e, 0x2, 0x15b, 0x15d, 0x7, 0x79, 0x2, 0x2, 0x15c, 0x15b, 
-    0x3, 0x2, 0x2, 0x2, 0x15c, 0x15d, 0x3, 0x2, 0x2, 0x2, 0x15d, 0x15e, 
-    0x3, 0x2, 0x2, 0x2, 0x15e, 0x160, 0x7, 0x4, 0x2, 0x2, 0x15f, 0x161, 
-    0x7, 0x79, 0x2, 0x2, 0x160, 0x15f, 0x3, 0x2, 0x2, 0x2, 0x160, 0x161, 
-    0x3, 0x2, 0x2, 0x2, 0x161, 0x162, 0x3, 0x2, 0x2, 0x2, 0x162, 0x164, 
-    0x5, 0x20, 0x11, 0x2, 0x163, 0x165, 0x7, 0x79, 0x2, 0x2, 0x164, 0x163, 
-    0x3, 0x2, 0x2, 0x2, 0x164, 0x165, 0x3, 0x2, 0x2, 0x2, 0x165, 0x166, 
-    0x3, 0x2, 0x2, 0x2, 0x166, 0x168, 0x7, 0x7, 0x2, 0x2, 0x167, 0x169, 
-    0x7, 0x79, 0x2, 0x2, 0x168, 0x167, 0x3, 0x2, 0x2, 0x2, 0x168, 0x169, 
-    0x3, 0x2, 0x2, 0x2, 0x169, 0x16a, 0x3, 0x2, 0x2, 0x2, 0x16a, 0x16b, 
-    0x5, 0x24, 0x13, 0x2, 0x16b, 0x16d, 0x3, 0x2, 0x2, 0x2, 0x16c, 0x16e, 
-    0x7, 0x79, 0x2, 0x2, 0x16d, 0x16c, 0x3, 0x2, 0x2, 0x2, 0x16d, 0x16e, 
-    0x3, 0x2, 0x2, 0x2, 0x16e, 0x16f, 0x3, 0x2, 0x2, 0x2, 0x16f, 0x170, 
-    0x7, 0x5, 0x2, 0x2, 0x170, 0xf, 0x3, 0x2, 0x2, 0x2, 0x171, 0x172, 0x7, 
-    0x46, 0x2, 0x2, 0x172, 0x173, 0x7, 0x79, 0x2, 0x2, 0x173, 0x174, 0x7, 
-    0x3d, 0x2, 0x2, 0x174, 0x175, 0x7, 0x79, 0x2, 0x2, 0x175, 0x176, 0x7, 
-    0x35, 0x2, 0x2, 0x176, 0x177, 0x7, 0x79, 0x2, 0x2, 0x177, 0x179, 0x5, 
-    0xda, 0x6e, 0x2, 0x178, 0x17a, 0x7, 0x79, 0x2, 0x2, 0x179, 0x178, 0x3, 
-    0x2, 0x2, 0x2, 0x179, 0x17a, 0x3, 0x2, 0x2, 0x2, 0x17a, 0x17b, 0x3, 
-    0x2, 0x2, 0x2, 0x17b, 0x17d, 0x7, 0x4, 0x2, 0x2, 0x17c, 0x17e, 0x7, 
-    0x79, 0x2, 0x2, 0x17d, 0x17c, 0x3, 0x2, 0x2, 0x2, 0x17d, 0x17e, 0x3, 
-    0x2, 0x2, 0x2, 0x17e, 0x17f, 0x3, 0x2, 0x2, 0x2, 0x17f, 0x180, 0x7, 
-    0x33, 0x2, 0x2, 0x180, 0x181, 0x7, 0x79, 0x2, 0x2, 0x181, 0x182, 0x5, 
-    0xda, 0x6e, 0x2, 0x182, 0x183, 0x7, 0x79, 0x2, 0x2, 0x183, 0x184, 0x7, 
-    0x3e, 0x2, 0x2, 0x184, 0x185, 0x7, 0x79, 0x2, 0x2, 0x185, 0x187, 0x5, 
-    0xda, 0x6e, 0x2, 0x186, 0x188, 0x7, 0x79, 0x2, 0x2, 0x187, 0x186, 0x3, 
-    0x2, 0x2, 0x2, 0x187, 0x188, 0x3, 0x2, 0x2, 0x2, 0x188, 0x191, 0x3, 
-    0x2, 0x2, 0x2, 0x189, 0x18b, 0x7, 0x7, 0x2, 0x2, 0x18a, 0x18c, 0x7, 
-    0x79, 0x2, 0x2, 0x18b, 0x18a, 0x3, 0x2, 0x2, 0x2, 0x18b, 0x18c, 0x3, 
-    0x2, 0x2, 0x2, 0x18c, 0x18d, 0x3, 0x2, 0x2, 0x2, 0x18d, 0x18f, 0x5, 
-    0x20, 0x11, 0x2, 0x18e, 0x190, 0x7, 0x79, 0x2, 0x2, 0x18f, 0x18e, 0x3, 
-    0x2, 0x2, 0x2, 0x18f, 0x190, 0x3, 0x2, 0x2, 0x2, 0x190, 0x192, 0x3, 
-    0x2, 0x2, 0x2, 0x191, 0x189, 0x3, 0x2, 0x2, 0x2, 0x191, 0x192, 0x3, 
-    0x2, 0x2, 0x2, 0x192, 0x19b, 0x3, 0x2, 0x2, 0x2, 0x193, 0x195, 0x7, 
-    0x7, 0x2, 0x2, 0x194, 0x196, 0x7, 0x79, 0x2, 0x2, 0x195, 0x194, 0x3, 
-    0x2, 0x2, 0x2, 0x195, 0x196, 0x3, 0x2, 0x2, 0x2, 0x196, 0x197, 0x3, 
-    0x2, 0x2, 0x2, 0x197, 0x199, 0x5, 0xdc, 0x6f, 0x2, 0x198, 0x19a, 0x7, 
-    0x79, 0x2, 0x2, 0x199, 0x198, 0x3, 0x2, 0x2, 0x2, 0x199, 0x19a, 0x3, 
-    0x2, 0x2, 0x2, 0x19a, 0x19c, 0x3, 0x2, 0x2, 0x2, 0x19b, 0x193, 0x3, 
-    0x2, 0x2, 0x2, 0x19b, 0x19c, 0x3, 0x2, 0x2, 0x2, 0x19c, 0x19d, 0x3, 
-    0x2, 0x2, 0x2, 0x19d, 0x19e, 0x7, 0x5, 0x2, 0x2, 0x19e, 0x11, 0x3, 0x2, 
-    0x2, 0x2, 0x19f, 0x1a0, 0x7, 0x36, 0x2, 0x2, 0x1a0, 0x1a1, 0x7, 0x79, 
-    0x2, 0x2, 0x1a1, 0x1a2, 0x7, 0x35, 0x2, 0x2, 0x1a2, 0x1a3, 0x7, 0x79, 
-    0x2, 0x2, 0x1a3, 0x1a4, 0x5, 0xda, 0x6e, 0x2, 0x1a4, 0x13, 0x3, 0x2, 
-    0x2, 0x2, 0x1a5, 0x1a6, 0x7, 0x37, 0x2, 0x2, 0x1a6, 0x1a7, 0x7, 0x79, 
-    0x2, 0x2, 0x1a7, 0x1a8, 0x7, 0x35, 0x2, 0x2, 0x1a8, 0x1a9, 0x7, 0x79, 
-    0x2, 0x2, 0x1a9, 0x1aa, 0x5, 0xda, 0x6e, 0x2, 0x1aa, 0x1ab, 0x7, 0x79, 
-    0x2, 0x2, 0x1ab, 0x1ac, 0x5, 0x16, 0xc, 0x2, 0x1ac, 0x15, 0x3, 0x2, 
-    0x2, 0x2, 0x1ad, 0x1b2, 0x5, 0x18, 0xd, 0x2, 0x1ae, 0x1b2, 0x5, 0x1a, 
-    0xe, 0x2, 0x1af, 0x1b2, 0x5, 0x1c, 0xf, 0x2, 0x1b0, 0x1b2, 0x5, 0x1e, 
-    0x10, 0x2, 0x1b1, 0x1ad, 0x3, 0x2, 0x2, 0x2, 0x1b1, 0x1ae, 0x3, 0x2, 
-    0x2, 0x2, 0x1b1, 0x1af, 0x3, 0x2, 0x2, 0x2, 0x1b1, 0x1b0, 0x3, 0x2, 
-    0x2, 0x2, 0x1b2, 0x17, 0x3, 0x2, 0x2, 0x2, 0x1b3, 0x1b4, 0x7, 0x3a, 
-    0x2, 0x2, 0x1b4, 0x1b5, 0x7, 0x79, 0x2, 0x2, 0x1b5, 0x1b6, 0x5, 0xd4, 
-    0x6b, 0x2, 0x1b6, 0x1b7, 0x7, 0x79, 0x2, 0x2, 0x1b7, 0x1bc, 0x5, 0x26, 
-    0x14, 0x2, 0x1b8, 0x1b9, 0x7, 0x79, 0x2, 0x2, 0x1b9, 0x1ba, 0x7, 0x38, 
-    0x2, 0x2, 0x1ba, 0x1bb, 0x7, 0x79, 0x2, 0x2, 0x1bb, 0x1bd, 0x5, 0x84, 
-    0x43, 0x2, 0x1bc, 0x1b8, 0x3, 0x2, 0x2, 0x2, 0x1bc, 0x1bd, 0x3, 0x2, 
-    0x2, 0x2, 0x1bd, 0x19, 0x3, 0x2, 0x2, 0x2, 0x1be, 0x1bf, 0x7, 0x36, 
-    0x2, 0x2, 0x1bf, 0x1c0, 0x7, 0x79, 0x2, 0x2, 0x1c0, 0x1c1, 0x5, 0xd4, 
-    0x6b, 0x2, 0x1c1, 0x1b, 0x3, 0x2, 0x2, 0x2, 0x1c2, 0x1c3, 0x7, 0x39, 
-    0x2, 0x2, 0x1c3, 0x1c4, 0x7, 0x79, 0x2, 0x2, 0x1c4, 0x1c5, 0x7, 0x3e, 
-    0x2, 0x2, 0x1c5, 0x1c6, 0x7, 0x79, 0x2, 0x2, 0x1c6, 0x1c7, 0x5, 0xda, 
-    0x6e, 0x2, 0x1c7, 0x1d, 0x3, 0x2, 0x2, 0x2, 0x1c8, 0x1c9, 0x7, 0x39, 
-    0x2, 0x2, 0x1c9, 0x1ca, 0x7, 0x79, 0x2, 0x2, 0x1ca, 0x1cb, 0x5, 0xd4, 
-    0x6b, 0x2, 0x1cb, 0x1cc, 0x7, 0x79, 0x2, 0x2, 0x1cc, 0x1cd, 0x7, 0x3e, 
-    0x2, 0x2, 0x1cd, 0x1ce, 0x7, 0x79, 0x2, 0x2, 0x1ce, 0x1cf, 0x5, 0xd4, 
-    0x6b, 0x2, 0x1cf, 0x1f, 0x3, 0x2, 0x2, 0x2, 0x1d0, 0x1db, 0x5, 0x22, 
-    0x12, 0x2, 0x1d1, 0x1d3, 0x7, 0x79, 0x2, 0x2, 0x1d2, 0x1d1, 0x3, 0x2, 
-    0x2, 0x2, 0x1d2, 0x1d3, 0x3, 0x2, 0x2, 0x2, 0x1d3, 0x1d4, 0x3, 0x2, 
-    0x2, 0x2, 0x1d4, 0x1d6, 0x7, 0x7, 0x2, 0x2, 0x1d5, 0x1d7, 0x7, 0x79, 
-    0x2, 0x2, 0x1d6, 0x1d5, 0x3, 0x2, 0x2, 0x2, 0x1d6, 0x1d7, 0x3, 0x2, 
-    0x2, 0x2, 0x1d7, 0x1d8, 0x3, 0x2, 0x2, 0x2, 0x1d8, 0x1da, 0x5, 0x22, 
-    0x12, 0x2, 0x1d9, 0x1d2, 0x3, 0x2, 0x2, 0x2, 0x1da, 0x1dd, 0x3, 0x2, 
-    0x2, 0x2, 0x1db, 0x1d9, 0x3, 0x2, 0x2, 0x2, 0x1db, 0x1dc, 0x3, 0x2, 
-    0x2, 0x2, 0x1dc, 0x21, 0x3, 0x2, 0x2, 0x2, 0x1dd, 0x1db, 0x3, 0x2, 0x2, 
-    0x2, 0x1de, 0x1df, 0x5, 0xd4, 0x6b, 0x2, 0x1df, 0x1e0, 0x7, 0x79, 0x2, 
-    0x2, 0x1e0, 0x1e1, 0x5, 0x26, 0x14, 0x2, 0x1e1, 0x23, 0x3, 0x2, 0x2, 
-    0x2, 0x1e2, 0x1e3, 0x7, 0x3b, 0x2, 0x2, 0x1e3, 0x1e4, 0x7, 0x79, 0x2, 
-    0x2, 0x1e4, 0x1e6, 0x7, 0x3c, 0x2, 0x2, 0x1e5, 0x1e7, 0x7, 0x79, 0x2, 
-    0x2, 0x1e6, 0x1e5, 0x3, 0x2, 0x2, 0x2, 0x1e6, 0x1e7, 0x3, 0x2, 0x2, 
-    0x2, 0x1e7, 0x1e8, 0x3, 0x2, 0x2, 0x2, 0x1e8, 0x1ea, 0x7, 0x4, 0x2, 
-    0x2, 0x1e9, 0x1eb, 0x7, 0x79, 0x2, 0x2, 0x1ea, 0x1e9, 0x3, 0x2, 0x2, 
-    0x2, 0x1ea, 0x1eb, 0x3, 0x2, 0x2, 0x2, 0x1eb, 0x1ec, 0x3, 0x2, 0x2, 
-    0x2, 0x1ec, 0x1ee, 0x5, 0xd4, 0x6b, 0x2, 0x1ed, 0x1ef, 0x7, 0x79, 0x2, 
-    0x2, 0x1ee, 0x1ed, 0x3, 0x2, 0x2, 0x2, 0x1ee, 0x1ef, 0x3, 0x2, 0x2, 
-    0x2, 0x1ef, 0x1f0, 0x3, 0x2, 0x2, 0x2, 0x1f0, 0x1f1, 0x7, 0x5, 0x2, 
-    0x2, 0x1f1, 0x25, 0x3, 0x2, 0x2, 0x2, 0x1f2, 0x1f7, 0x5, 0xdc, 0x6f, 
-    0x2, 0x1f3, 0x1f4, 0x5, 0xdc, 0x6f, 0x2, 0x1f4, 0x1f5, 0x5, 0x28, 0x15, 
-    0x2, 0x1f5, 0x1f7, 0x3, 0x2, 0x2, 0x2, 0x1f6, 0x1f2, 0x3, 0x2, 0x2, 
-    0x2, 0x1f6, 0x1f3, 0x3, 0x2, 0x2, 0x2, 0x1f7, 0x27, 0x3, 0x2, 0x2, 0x2, 
-    0x1f8, 0x1fc, 0x5, 0x2a, 0x16, 0x2, 0x1f9, 0x1fb, 0x5, 0x2a, 0x16, 0x2, 
-    0x1fa, 0x1f9, 0x3, 0x2, 0x2, 0x2, 0x1fb, 0x1fe, 0x3, 0x2, 0x2, 0x2, 
-    0x1fc, 0x1fa, 0x3, 0x2, 0x2, 0x2, 0x1fc, 0x1fd, 0x3, 0x2, 0x2, 0x2, 
-    0x1fd, 0x29, 0x3, 0x2, 0x2, 0x2, 0x1fe, 0x1fc, 0x3, 0x2, 0x2, 0x2, 0x1ff, 
-    0x201, 0x7, 0x6, 0x2, 0x2, 0x200, 0x202, 0x5, 0xd6, 0x6c, 0x2, 0x201, 
-    0x200, 0x3, 0x2, 0x2, 0x2, 0x201, 0x202, 0x3, 0x2, 0x2, 0x2, 0x202, 
-    0x203, 0x3, 0x2, 0x2, 0x2, 0x203, 0x204, 0x7, 0x8, 0x2, 0x2, 0x204, 
-    0x2b, 0x3, 0x2, 0x2, 0x2, 0x205, 0x208, 0x5, 0x2e, 0x18, 0x2, 0x206, 
-    0x208, 0x5, 0x30, 0x19, 0x2, 0x207, 0x205, 0x3, 0x2, 0x2, 0x2, 0x207, 
-    0x206, 0x3, 0x2, 0x2, 0x2, 0x208, 0x2d, 0x3, 0x2, 0x2, 0x2, 0x209, 0x20a, 
-    0x7, 0x3f, 0x2, 0x2, 0x20a, 0x2f, 0x3, 0x2, 0x2, 0x2, 0x20b, 0x20c, 
-    0x7, 0x40, 0x2, 0x2, 0x20c, 0x31, 0x3, 0x2, 0x2, 0x2, 0x20d, 0x20e, 
-    0x5, 0x34, 0x1b, 0x2, 0x20e, 0x33, 0x3, 0x2, 0x2, 0x2, 0x20f, 0x210, 
-    0x5, 0x36, 0x1c, 0x2, 0x210, 0x35, 0x3, 0x2, 0x2, 0x2, 0x211, 0x218, 
-    0x5, 0x3a, 0x1e, 0x2, 0x212, 0x214, 0x7, 0x79, 0x2, 0x2, 0x213, 0x212, 
-    0x3, 0x2, 0x2, 0x2, 0x213, 0x214, 0x3, 0x2, 0x2, 0x2, 0x214, 0x215, 
-    0x3, 0x2, 0x2, 0x2, 0x215, 0x217, 0x5, 0x38, 0x1d, 0x2, 0x216, 0x213, 
-    0x3, 0x2, 0x2, 0x2, 0x217, 0x21a, 0x3, 0x2, 0x2, 0x2, 0x218, 0x216, 
-    0x3, 0x2, 0x2, 0x2, 0x218, 0x219, 0x3, 0x2, 0x2, 0x2, 0x219, 0x227, 
-    0x3, 0x2, 0x2, 0x2, 0x21a, 0x218, 0x3, 0x2, 0x2, 0x2, 0x21b, 0x21d, 
-    0x5, 0x54, 0x2b, 0x2, 0x21c, 0x21e, 0x7, 0x79, 0x2, 0x2, 0x21d, 0x21c, 
-    0x3, 0x2, 0x2, 0x2, 0x21d, 0x21e, 0x3, 0x2, 0x2, 0x2, 0x21e, 0x220, 
-    0x3, 0x2, 0x2, 0x2, 0x21f, 0x21b, 0x3, 0x2, 0x2, 0x2, 0x220, 0x221, 
-    0x3, 0x2, 0x2, 0x2, 0x221, 0x21f, 0x3, 0x2, 0x2, 0x2, 0x221, 0x222, 
-    0x3, 0x2, 0x2, 0x2, 0x222, 0x223, 0x3, 0x2, 0x2, 0x2, 0x223, 0x224, 
-    0x5, 0x3a, 0x1e, 0x2, 0x224, 0x225, 0x8, 0x1c, 0x1, 0x2, 0x225, 0x227, 
-    0x3, 0x2, 0x2, 0x2, 0x226, 0x211, 0x3, 0x2, 0x2, 0x2, 0x226, 0x21f, 
-    0x3, 0x2, 0x2, 0x2, 0x227, 0x37, 0x3, 0x2, 0x2, 0x2, 0x228, 0x229, 0x7, 
-    0x41, 0x2, 0x2, 0x229, 0x22a, 0x7, 0x79, 0x2, 0x2, 0x22a, 0x22c, 0x7, 
-    0x42, 0x2, 0x2, 0x22b, 0x22d, 0x7, 0x79, 0x2, 0x2, 0x22c, 0x22b, 0x3, 
-    0x2, 0x2, 0x2, 0x22c, 0x22d, 0x3, 0x2, 0x2, 0x2, 0x22d, 0x22e, 0x3, 
-    0x2, 0x2, 0x2, 0x22e, 0x235, 0x5, 0x3a, 0x1e, 0x2, 0x22f, 0x231, 0x7, 
-    0x41, 0x2, 0x2, 0x230, 0x232, 0x7, 0x79, 0x2, 0x2, 0x231, 0x230, 0x3, 
-    0x2, 0x2, 0x2, 0x231, 0x232, 0x3, 0x2, 0x2, 0x2, 0x232, 0x233, 0x3, 
-    0x2, 0x2, 0x2, 0x233, 0x235, 0x5, 0x3a, 0x1e, 0x2, 0x234, 0x228, 0x3, 
-    0x2, 0x2, 0x2, 0x234, 0x22f, 0x3, 0x2, 0x2, 0x2, 0x235, 0x39, 0x3, 0x2, 
-    0x2, 0x2, 0x236, 0x239, 0x5, 0x3c, 0x1f, 0x2, 0x237, 0x239, 0x5, 0x3e, 
-    0x20, 0x2, 0x238, 0x236, 0x3, 0x2, 0x2, 0x2, 0x238, 0x237, 0x3, 0x2, 
-    0x2, 0x2, 0x239, 0x3b, 0x3, 0x2, 0x2, 0x2, 0x23a, 0x23c, 0x5, 0x44, 
-    0x23, 0x2, 0x23b, 0x23d, 0x7, 0x79, 0x2, 0x2, 0x23c, 0x23b, 0x3, 0x2, 
-    0x2, 0x2, 0x23c, 0x23d, 0x3, 0x2, 0x2, 0x2, 0x23d, 0x23f, 0x3, 0x2, 
-    0x2, 0x2, 0x23e, 0x23a, 0x3, 0x2, 0x2, 0x2, 0x23f, 0x242, 0x3, 0x2, 
-    0x2, 0x2, 0x240, 0x23e, 0x3, 0x2, 0x2, 0x2, 0x240, 0x241, 0x3, 0x2, 
-    0x2, 0x2, 0x241, 0x243, 0x3, 0x2, 0x2, 0x2, 0x242, 0x240, 0x3, 0x2, 
-    0x2, 0x2, 0x243, 0x268, 0x5, 0x54, 0x2b, 0x2, 0x244, 0x246, 0x5, 0x44, 
-    0x23, 0x2, 0x245, 0x247, 0x7, 0x79, 0x2, 0x2, 0x246, 0x245, 0x3, 0x2, 
-    0x2, 0x2, 0x246, 0x247, 0x3, 0x2, 0x2, 0x2, 0x247, 0x249, 0x3, 0x2, 
-    0x2, 0x2, 0x248, 0x244, 0x3, 0x2, 0x2, 0x2, 0x249, 0x24c, 0x3, 0x2, 
-    0x2, 0x2, 0x24a, 0x248, 0x3, 0x2, 0x2, 0x2, 0x24a, 0x24b, 0x3, 0x2, 
-    0x2, 0x2, 0x24b, 0x24d, 0x3, 0x2, 0x2, 0x2, 0x24c, 0x24a, 0x3, 0x2, 
-    0x2, 0x2, 0x24d, 0x254, 0x5, 0x42, 0x22, 0x2, 0x24e, 0x250, 0x7, 0x79, 
-    0x2, 0x2, 0x24f, 0x24e, 0x3, 0x2, 0x2, 0x2, 0x24f, 0x250, 0x3, 0x2, 
-    0x2, 0x2, 0x250, 0x251, 0x3, 0x2, 0x2, 0x2, 0x251, 0x253, 0x5, 0x42, 
-    0x22, 0x2, 0x252, 0x24f, 0x3, 0x2, 0x2, 0x2, 0x253, 0x256, 0x3, 0x2, 
-    0x2, 0x2, 0x254, 0x252, 0x3, 0x2, 0x2, 0x2, 0x254, 0x255, 0x3, 0x2, 
-    0x2, 0x2, 0x255, 0x25b, 0x3, 0x2, 0x2, 0x2, 0x256, 0x254, 0x3, 0x2, 
-    0x2, 0x2, 0x257, 0x259, 0x7, 0x79, 0x2, 0x2, 0x258, 0x257, 0x3, 0x2, 
-    0x2, 0x2, 0x258, 0x259, 0x3, 0x2, 0x2, 0x2, 0x259, 0x25a, 0x3, 0x2, 
-    0x2, 0x2, 0x25a, 0x25c, 0x5, 0x54, 0x2b, 0x2, 0x25b, 0x258, 0x3, 0x2, 
-    0x2, 0x2, 0x25b, 0x25c, 0x3, 0x2, 0x2, 0x2, 0x25c, 0x268, 0x3, 0x2, 
-    0x2, 0x2, 0x25d, 0x25f, 0x5, 0x44, 0x23, 0x2, 0x25e, 0x260, 0x7, 0x79, 
-    0x2, 0x2, 0x25f, 0x25e, 0x3, 0x2, 0x2, 0x2, 0x25f, 0x260, 0x3, 0x2, 
-    0x2, 0x2, 0x260, 0x262, 0x3, 0x2, 0x2, 0x2, 0x261, 0x25d, 0x3, 0x2, 
-    0x2, 0x2, 0x262, 0x265, 0x3, 0x2, 0x2, 0x2, 0x263, 0x261, 0x3, 0x2, 
-    0x2, 0x2, 0x263, 0x264, 0x3, 0x2, 0x2, 0x2, 0x264, 0x266, 0x3, 0x2, 
-    0x2, 0x2, 0x265, 0x263, 0x3, 0x2, 0x2, 0x2, 0x266, 0x268, 0x8, 0x1f, 
-    0x1, 0x2, 0x267, 0x240, 0x3, 0x2, 0x2, 0x2, 0x267, 0x24a, 0x3, 0x2, 
-    0x2, 0x2, 0x267, 0x263, 0x3, 0x2, 0x2, 0x2, 0x268, 0x3d, 0x3, 0x2, 0x2, 
-    0x2, 0x269, 0x26b, 0x5, 0x40, 0x21, 0x2, 0x26a, 0x26c, 0x7, 0x79, 0x2, 
-    0x2, 0x26b, 0x26a, 0x3, 0x2, 0x2, 0x2, 0x26b, 0x26c, 0x3, 0x2, 0x2, 
-    0x2, 0x26c, 0x26e, 0x3, 0x2, 0x2, 0x2, 0x26d, 0x269, 0x3, 0x2, 0x2, 
-    0x2, 0x26e, 0x26f, 0x3, 0x2, 0x2, 0x2, 0x26f, 0x26d, 0x3, 0x2, 0x2, 
-    0x2, 0x26f, 0x270, 0x3, 0x2, 0x2, 0x2, 0x270, 0x271, 0x3, 0x2, 0x2, 
-    0x2, 0x271, 0x272, 0x5, 0x3c, 0x1f, 0x2, 0x272, 0x3f, 0x3, 0x2, 0x2, 
-    0x2, 0x273, 0x275, 0x5, 0x44, 0x23, 0x2, 0x274, 0x276, 0x7, 0x79, 0x2, 
-    0x2, 0x275, 0x274, 0x3, 0x2, 0x2, 0x2, 0x275, 0x276, 0x3, 0x2, 0x2, 
-    0x2, 0x276, 0x278, 0x3, 0x2, 0x2, 0x2, 0x277, 0x273, 0x3, 0x2, 0x2, 
-    0x2, 0x278, 0x27b, 0x3, 0x2, 0x2, 0x2, 0x279, 0x277, 0x3, 0x2, 0x2, 
-    0x2, 0x279, 0x27a, 0x3, 0x2, 0x2, 0x2, 0x27a, 0x282, 0x3, 0x2, 0x2, 
-    0x2, 0x27b, 0x279, 0x3, 0x2, 0x2, 0x2, 0x27c, 0x27e, 0x5, 0x42, 0x22, 
-    0x2, 0x27d, 0x27f, 0x7, 0x79, 0x2, 0x2, 0x27e, 0x27d, 0x3, 0x2, 0x2, 
-    0x2, 0x27e, 0x27f, 0x3, 0x2, 0x2, 0x2, 0x27f, 0x281, 0x3, 0x2, 0x2, 
-    0x2, 0x280, 0x27c, 0x3, 0x2, 0x2, 0x2, 0x281, 0x284, 0x3, 0x2, 0x2, 
-    0x2, 0x282, 0x280, 0x3, 0x2, 0x2, 0x2, 0x282, 0x283, 0x3, 0x2, 0x2, 
-    0x2, 0x283, 0x285, 0x3, 0x2, 0x2, 0x2, 0x284, 0x282, 0x3, 0x2, 0x2, 
-    0x2, 0x285, 0x286, 0x5, 0x52, 0x2a, 0x2, 0x286, 0x41, 0x3, 0x2, 0x2, 
-    0x2, 0x287, 0x28b, 0x5, 0x4a, 0x26, 0x2, 0x288, 0x28b, 0x5, 0x4c, 0x27, 
-    0x2, 0x289, 0x28b, 0x5, 0x50, 0x29, 0x2, 0x28a, 0x287, 0x3, 0x2, 0x2, 
-    0x2, 0x28a, 0x288, 0x3, 0x2, 0x2, 0x2, 0x28a, 0x289, 0x3, 0x2, 0x2, 
-    0x2, 0x28b, 0x43, 0x3, 0x2, 0x2, 0x2, 0x28c, 0x28f, 0x5, 0x46, 0x24, 
-    0x2, 0x28d, 0x28f, 0x5, 0x48, 0x25, 0x2, 0x28e, 0x28c, 0x3, 0x2, 0x2, 
-    0x2, 0x28e, 0x28d, 0x3, 0x2, 0x2, 0x2, 0x28f, 0x45, 0x3, 0x2, 0x2, 0x2, 
-    0x290, 0x291, 0x7, 0x43, 0x2, 0x2, 0x291, 0x293, 0x7, 0x79, 0x2, 0x2, 
-    0x292, 0x290, 0x3, 0x2, 0x2, 0x2, 0x292, 0x293, 0x3, 0x2, 0x2, 0x2, 
-    0x293, 0x294, 0x3, 0x2, 0x2, 0x2, 0x294, 0x296, 0x7, 0x44, 0x2, 0x2, 
-    0x295, 0x297, 0x7, 0x79, 0x2, 0x2, 0x296, 0x295, 0x3, 0x2, 0x2, 0x2, 
+    0x3, 0x2, 0x2, 0x2, 0x15c, 0x15d, 0x3, 0x2, 0x2, 0x2, 0x15d, 0x15e, 0x3, 
+    0x2, 0x2, 0x2, 0x15e, 0x160, 0x7, 0x4, 0x2, 0x2, 0x15f, 0x161, 0x7, 0x79, 
+    0x2, 0x2, 0x160, 0x15f, 0x3, 0x2, 0x2, 0x2, 0x160, 0x161, 0x3, 0x2, 0x2, 
+    0x2, 0x161, 0x162, 0x3, 0x2, 0x2, 0x2, 0x162, 0x164, 0x5, 0x20, 0x11, 
+    0x2, 0x163, 0x165, 0x7, 0x79, 0x2, 0x2, 0x164, 0x163, 0x3, 0x2, 0x2, 0x2, 
+    0x164, 0x165, 0x3, 0x2, 0x2, 0x2, 0x165, 0x166, 0x3, 0x2, 0x2, 0x2, 
+    0x166, 0x168, 0x7, 0x7, 0x2, 0x2, 0x167, 0x169, 0x7, 0x79, 0x2, 0x2, 
+    0x168, 0x167, 0x3, 0x2, 0x2, 0x2, 0x168, 0x169, 0x3, 0x2, 0x2, 0x2, 
+    0x169, 0x16a, 0x3, 0x2, 0x2, 0x2, 0x16a, 0x16b, 0x5, 0x24, 0x13, 0x2, 
+    0x16b, 0x16d, 0x3, 0x2, 0x2, 0x2, 0x16c, 0x16e, 0x7, 0x79, 0x2, 0x2, 
+    0x16d, 0x16c, 0x3, 0x2, 0x2, 0x2, 0x16d, 0x16e, 0x3, 0x2, 0x2, 0x2, 
+    0x16e, 0x16f, 0x3, 0x2, 0x2, 0x2, 0x16f, 0x170, 0x7, 0x5, 0x2, 0x2, 
+    0x170, 0xf, 0x3, 0x2, 0x2, 0x2, 0x171, 0x172, 0x7, 0x46, 0x2, 0x2, 0x172, 
+    0x173, 0x7, 0x79, 0x2, 0x2, 0x173, 0x174, 0x7, 0x3d, 0x2, 0x2, 0x174, 
+    0x175, 0x7, 0x79, 0x2, 0x2, 0x175, 0x176, 0x7, 0x35, 0x2, 0x2, 0x176, 
+    0x177, 0x7, 0x79, 0x2, 0x2, 0x177, 0x179, 0x5, 0xda, 0x6e, 0x2, 0x178, 
+    0x17a, 0x7, 0x79, 0x2, 0x2, 0x179, 0x178, 0x3, 0x2, 0x2, 0x2, 0x179, 
+    0x17a, 0x3, 0x2, 0x2, 0x2, 0x17a, 0x17b, 0x3, 0x2, 0x2, 0x2, 0x17b, 
+    0x17d, 0x7, 0x4, 0x2, 0x2, 0x17c, 0x17e, 0x7, 0x79, 0x2, 0x2, 0x17d, 
+    0x17c, 0x3, 0x2, 0x2, 0x2, 0x17d, 0x17e, 0x3, 0x2, 0x2, 0x2, 0x17e, 
+    0x17f, 0x3, 0x2, 0x2, 0x2, 0x17f, 0x180, 0x7, 0x33, 0x2, 0x2, 0x180, 
+    0x181, 0x7, 0x79, 0x2, 0x2, 0x181, 0x182, 0x5, 0xda, 0x6e, 0x2, 0x182, 
+    0x183, 0x7, 0x79, 0x2, 0x2, 0x183, 0x184, 0x7, 0x3e, 0x2, 0x2, 0x184, 
+    0x185, 0x7, 0x79, 0x2, 0x2, 0x185, 0x187, 0x5, 0xda, 0x6e, 0x2, 0x186, 
+    0x188, 0x7, 0x79, 0x2, 0x2, 0x187, 0x186, 0x3, 0x2, 0x2, 0x2, 0x187, 
+    0x188, 0x3, 0x2, 0x2, 0x2, 0x188, 0x191, 0x3, 0x2, 0x2, 0x2, 0x189, 
+    0x18b, 0x7, 0x7, 0x2, 0x2, 0x18a, 0x18c, 0x7, 0x79, 0x2, 0x2, 0x18b, 
+    0x18a, 0x3, 0x2, 0x2, 0x2, 0x18b, 0x18c, 0x3, 0x2, 0x2, 0x2, 0x18c, 
+    0x18d, 0x3, 0x2, 0x2, 0x2, 0x18d, 0x18f, 0x5, 0x20, 0x11, 0x2, 0x18e, 
+    0x190, 0x7, 0x79, 0x2, 0x2, 0x18f, 0x18e, 0x3, 0x2, 0x2, 0x2, 0x18f, 
+    0x190, 0x3, 0x2, 0x2, 0x2, 0x190, 0x192, 0x3, 0x2, 0x2, 0x2, 0x191, 
+    0x189, 0x3, 0x2, 0x2, 0x2, 0x191, 0x192, 0x3, 0x2, 0x2, 0x2, 0x192, 
+    0x19b, 0x3, 0x2, 0x2, 0x2, 0x193, 0x195, 0x7, 0x7, 0x2, 0x2, 0x194, 
+    0x196, 0x7, 0x79, 0x2, 0x2, 0x195, 0x194, 0x3, 0x2, 0x2, 0x2, 0x195, 
+    0x196, 0x3, 0x2, 0x2, 0x2, 0x196, 0x197, 0x3, 0x2, 0x2, 0x2, 0x197, 
+    0x199, 0x5, 0xdc, 0x6f, 0x2, 0x198, 0x19a, 0x7, 0x79, 0x2, 0x2, 0x199, 
+    0x198, 0x3, 0x2, 0x2, 0x2, 0x199, 0x19a, 0x3, 0x2, 0x2, 0x2, 0x19a, 
+    0x19c, 0x3, 0x2, 0x2, 0x2, 0x19b, 0x193, 0x3, 0x2, 0x2, 0x2, 0x19b, 
+    0x19c, 0x3, 0x2, 0x2, 0x2, 0x19c, 0x19d, 0x3, 0x2, 0x2, 0x2, 0x19d, 
+    0x19e, 0x7, 0x5, 0x2, 0x2, 0x19e, 0x11, 0x3, 0x2, 0x2, 0x2, 0x19f, 0x1a0, 
+    0x7, 0x36, 0x2, 0x2, 0x1a0, 0x1a1, 0x7, 0x79, 0x2, 0x2, 0x1a1, 0x1a2, 
+    0x7, 0x35, 0x2, 0x2, 0x1a2, 0x1a3, 0x7, 0x79, 0x2, 0x2, 0x1a3, 0x1a4, 
+    0x5, 0xda, 0x6e, 0x2, 0x1a4, 0x13, 0x3, 0x2, 0x2, 0x2, 0x1a5, 0x1a6, 0x7, 
+    0x37, 0x2, 0x2, 0x1a6, 0x1a7, 0x7, 0x79, 0x2, 0x2, 0x1a7, 0x1a8, 0x7, 
+    0x35, 0x2, 0x2, 0x1a8, 0x1a9, 0x7, 0x79, 0x2, 0x2, 0x1a9, 0x1aa, 0x5, 
+    0xda, 0x6e, 0x2, 0x1aa, 0x1ab, 0x7, 0x79, 0x2, 0x2, 0x1ab, 0x1ac, 0x5, 
+    0x16, 0xc, 0x2, 0x1ac, 0x15, 0x3, 0x2, 0x2, 0x2, 0x1ad, 0x1b2, 0x5, 0x18, 
+    0xd, 0x2, 0x1ae, 0x1b2, 0x5, 0x1a, 0xe, 0x2, 0x1af, 0x1b2, 0x5, 0x1c, 
+    0xf, 0x2, 0x1b0, 0x1b2, 0x5, 0x1e, 0x10, 0x2, 0x1b1, 0x1ad, 0x3, 0x2, 
+    0x2, 0x2, 0x1b1, 0x1ae, 0x3, 0x2, 0x2, 0x2, 0x1b1, 0x1af, 0x3, 0x2, 0x2, 
+    0x2, 0x1b1, 0x1b0, 0x3, 0x2, 0x2, 0x2, 0x1b2, 0x17, 0x3, 0x2, 0x2, 0x2, 
+    0x1b3, 0x1b4, 0x7, 0x3a, 0x2, 0x2, 0x1b4, 0x1b5, 0x7, 0x79, 0x2, 0x2, 
+    0x1b5, 0x1b6, 0x5, 0xd4, 0x6b, 0x2, 0x1b6, 0x1b7, 0x7, 0x79, 0x2, 0x2, 
+    0x1b7, 0x1bc, 0x5, 0x26, 0x14, 0x2, 0x1b8, 0x1b9, 0x7, 0x79, 0x2, 0x2, 
+    0x1b9, 0x1ba, 0x7, 0x38, 0x2, 0x2, 0x1ba, 0x1bb, 0x7, 0x79, 0x2, 0x2, 
+    0x1bb, 0x1bd, 0x5, 0x84, 0x43, 0x2, 0x1bc, 0x1b8, 0x3, 0x2, 0x2, 0x2, 
+    0x1bc, 0x1bd, 0x3, 0x2, 0x2, 0x2, 0x1bd, 0x19, 0x3, 0x2, 0x2, 0x2, 0x1be, 
+    0x1bf, 0x7, 0x36, 0x2, 0x2, 0x1bf, 0x1c0, 0x7, 0x79, 0x2, 0x2, 0x1c0, 
+    0x1c1, 0x5, 0xd4, 0x6b, 0x2, 0x1c1, 0x1b, 0x3, 0x2, 0x2, 0x2, 0x1c2, 
+    0x1c3, 0x7, 0x39, 0x2, 0x2, 0x1c3, 0x1c4, 0x7, 0x79, 0x2, 0x2, 0x1c4, 
+    0x1c5, 0x7, 0x3e, 0x2, 0x2, 0x1c5, 0x1c6, 0x7, 0x79, 0x2, 0x2, 0x1c6, 
+    0x1c7, 0x5, 0xda, 0x6e, 0x2, 0x1c7, 0x1d, 0x3, 0x2, 0x2, 0x2, 0x1c8, 
+    0x1c9, 0x7, 0x39, 0x2, 0x2, 0x1c9, 0x1ca, 0x7, 0x79, 0x2, 0x2, 0x1ca, 
+    0x1cb, 0x5, 0xd4, 0x6b, 0x2, 0x1cb, 0x1cc, 0x7, 0x79, 0x2, 0x2, 0x1cc, 
+    0x1cd, 0x7, 0x3e, 0x2, 0x2, 0x1cd, 0x1ce, 0x7, 0x79, 0x2, 0x2, 0x1ce, 
+    0x1cf, 0x5, 0xd4, 0x6b, 0x2, 0x1cf, 0x1f, 0x3, 0x2, 0x2, 0x2, 0x1d0, 
+    0x1db, 0x5, 0x22, 0x12, 0x2, 0x1d1, 0x1d3, 0x7, 0x79, 0x2, 0x2, 0x1d2, 
+    0x1d1, 0x3, 0x2, 0x2, 0x2, 0x1d2, 0x1d3, 0x3, 0x2, 0x2, 0x2, 0x1d3, 
+    0x1d4, 0x3, 0x2, 0x2, 0x2, 0x1d4, 0x1d6, 0x7, 0x7, 0x2, 0x2, 0x1d5, 
+    0x1d7, 0x7, 0x79, 0x2, 0x2, 0x1d6, 0x1d5, 0x3, 0x2, 0x2, 0x2, 0x1d6, 
+    0x1d7, 0x3, 0x2, 0x2, 0x2, 0x1d7, 0x1d8, 0x3, 0x2, 0x2, 0x2, 0x1d8, 
+    0x1da, 0x5, 0x22, 0x12, 0x2, 0x1d9, 0x1d2, 0x3, 0x2, 0x2, 0x2, 0x1da, 
+    0x1dd, 0x3, 0x2, 0x2, 0x2, 0x1db, 0x1d9, 0x3, 0x2, 0x2, 0x2, 0x1db, 
+    0x1dc, 0x3, 0x2, 0x2, 0x2, 0x1dc, 0x21, 0x3, 0x2, 0x2, 0x2, 0x1dd, 0x1db, 
+    0x3, 0x2, 0x2, 0x2, 0x1de, 0x1df, 0x5, 0xd4, 0x6b, 0x2, 0x1df, 0x1e0, 
+    0x7, 0x79, 0x2, 0x2, 0x1e0, 0x1e1, 0x5, 0x26, 0x14, 0x2, 0x1e1, 0x23, 
+    0x3, 0x2, 0x2, 0x2, 0x1e2, 0x1e3, 0x7, 0x3b, 0x2, 0x2, 0x1e3, 0x1e4, 0x7, 
+    0x79, 0x2, 0x2, 0x1e4, 0x1e6, 0x7, 0x3c, 0x2, 0x2, 0x1e5, 0x1e7, 0x7, 
+    0x79, 0x2, 0x2, 0x1e6, 0x1e5, 0x3, 0x2, 0x2, 0x2, 0x1e6, 0x1e7, 0x3, 0x2, 
+    0x2, 0x2, 0x1e7, 0x1e8, 0x3, 0x2, 0x2, 0x2, 0x1e8, 0x1ea, 0x7, 0x4, 0x2, 
+    0x2, 0x1e9, 0x1eb, 0x7, 0x79, 0x2, 0x2, 0x1ea, 0x1e9, 0x3, 0x2, 0x2, 0x2, 
+    0x1ea, 0x1eb, 0x3, 0x2, 0x2, 0x2, 0x1eb, 0x1ec, 0x3, 0x2, 0x2, 0x2, 
+    0x1ec, 0x1ee, 0x5, 0xd4, 0x6b, 0x2, 0x1ed, 0x1ef, 0x7, 0x79, 0x2, 0x2, 
+    0x1ee, 0x1ed, 0x3, 0x2, 0x2, 0x2, 0x1ee, 0x1ef, 0x3, 0x2, 0x2, 0x2, 
+    0x1ef, 0x1f0, 0x3, 0x2, 0x2, 0x2, 0x1f0, 0x1f1, 0x7, 0x5, 0x2, 0x2, 
+    0x1f1, 0x25, 0x3, 0x2, 0x2, 0x2, 0x1f2, 0x1f7, 0x5, 0xdc, 0x6f, 0x2, 
+    0x1f3, 0x1f4, 0x5, 0xdc, 0x6f, 0x2, 0x1f4, 0x1f5, 0x5, 0x28, 0x15, 0x2, 
+    0x1f5, 0x1f7, 0x3, 0x2, 0x2, 0x2, 0x1f6, 0x1f2, 0x3, 0x2, 0x2, 0x2, 
+    0x1f6, 0x1f3, 0x3, 0x2, 0x2, 0x2, 0x1f7, 0x27, 0x3, 0x2, 0x2, 0x2, 0x1f8, 
+    0x1fc, 0x5, 0x2a, 0x16, 0x2, 0x1f9, 0x1fb, 0x5, 0x2a, 0x16, 0x2, 0x1fa, 
+    0x1f9, 0x3, 0x2, 0x2, 0x2, 0x1fb, 0x1fe, 0x3, 0x2, 0x2, 0x2, 0x1fc, 
+    0x1fa, 0x3, 0x2, 0x2, 0x2, 0x1fc, 0x1fd, 0x3, 0x2, 0x2, 0x2, 0x1fd, 0x29, 
+    0x3, 0x2, 0x2, 0x2, 0x1fe, 0x1fc, 0x3, 0x2, 0x2, 0x2, 0x1ff, 0x201, 0x7, 
+    0x6, 0x2, 0x2, 0x200, 0x202, 0x5, 0xd6, 0x6c, 0x2, 0x201, 0x200, 0x3, 
+    0x2, 0x2, 0x2, 0x201, 0x202, 0x3, 0x2, 0x2, 0x2, 0x202, 0x203, 0x3, 0x2, 
+    0x2, 0x2, 0x203, 0x204, 0x7, 0x8, 0x2, 0x2, 0x204, 0x2b, 0x3, 0x2, 0x2, 
+    0x2, 0x205, 0x208, 0x5, 0x2e, 0x18, 0x2, 0x206, 0x208, 0x5, 0x30, 0x19, 
+    0x2, 0x207, 0x205, 0x3, 0x2, 0x2, 0x2, 0x207, 0x206, 0x3, 0x2, 0x2, 0x2, 
+    0x208, 0x2d, 0x3, 0x2, 0x2, 0x2, 0x209, 0x20a, 0x7, 0x3f, 0x2, 0x2, 
+    0x20a, 0x2f, 0x3, 0x2, 0x2, 0x2, 0x20b, 0x20c, 0x7, 0x40, 0x2, 0x2, 
+    0x20c, 0x31, 0x3, 0x2, 0x2, 0x2, 0x20d, 0x20e, 0x5, 0x34, 0x1b, 0x2, 
+    0x20e, 0x33, 0x3, 0x2, 0x2, 0x2, 0x20f, 0x210, 0x5, 0x36, 0x1c, 0x2, 
+    0x210, 0x35, 0x3, 0x2, 0x2, 0x2, 0x211, 0x218, 0x5, 0x3a, 0x1e, 0x2, 
+    0x212, 0x214, 0x7, 0x79, 0x2, 0x2, 0x213, 0x212, 0x3, 0x2, 0x2, 0x2, 
+    0x213, 0x214, 0x3, 0x2, 0x2, 0x2, 0x214, 0x215, 0x3, 0x2, 0x2, 0x2, 
+    0x215, 0x217, 0x5, 0x38, 0x1d, 0x2, 0x216, 0x213, 0x3, 0x2, 0x2, 0x2, 
+    0x217, 0x21a, 0x3, 0x2, 0x2, 0x2, 0x218, 0x216, 0x3, 0x2, 0x2, 0x2, 
+    0x218, 0x219, 0x3, 0x2, 0x2, 0x2, 0x219, 0x227, 0x3, 0x2, 0x2, 0x2, 
+    0x21a, 0x218, 0x3, 0x2, 0x2, 0x2, 0x21b, 0x21d, 0x5, 0x54, 0x2b, 0x2, 
+    0x21c, 0x21e, 0x7, 0x79, 0x2, 0x2, 0x21d, 0x21c, 0x3, 0x2, 0x2, 0x2, 
+    0x21d, 0x21e, 0x3, 0x2, 0x2, 0x2, 0x21e, 0x220, 0x3, 0x2, 0x2, 0x2, 
+    0x21f, 0x21b, 0x3, 0x2, 0x2, 0x2, 0x220, 0x221, 0x3, 0x2, 0x2, 0x2, 
+    0x221, 0x21f, 0x3, 0x2, 0x2, 0x2, 0x221, 0x222, 0x3, 0x2, 0x2, 0x2, 
+    0x222, 0x223, 0x3, 0x2, 0x2, 0x2, 0x223, 0x224, 0x5, 0x3a, 0x1e, 0x2, 
+    0x224, 0x225, 0x8, 0x1c, 0x1, 0x2, 0x225, 0x227, 0x3, 0x2, 0x2, 0x2, 
+    0x226, 0x211, 0x3, 0x2, 0x2, 0x2, 0x226, 0x21f, 0x3, 0x2, 0x2, 0x2, 
+    0x227, 0x37, 0x3, 0x2, 0x2, 0x2, 0x228, 0x229, 0x7, 0x41, 0x2, 0x2, 
+    0x229, 0x22a, 0x7, 0x79, 0x2, 0x2, 0x22a, 0x22c, 0x7, 0x42, 0x2, 0x2, 
+    0x22b, 0x22d, 0x7, 0x79, 0x2, 0x2, 0x22c, 0x22b, 0x3, 0x2, 0x2, 0x2, 
+    0x22c, 0x22d, 0x3, 0x2, 0x2, 0x2, 0x22d, 0x22e, 0x3, 0x2, 0x2, 0x2, 
+    0x22e, 0x235, 0x5, 0x3a, 0x1e, 0x2, 0x22f, 0x231, 0x7, 0x41, 0x2, 0x2, 
+    0x230, 0x232, 0x7, 0x79, 0x2, 0x2, 0x231, 0x230, 0x3, 0x2, 0x2, 0x2, 
+    0x231, 0x232, 0x3, 0x2, 0x2, 0x2, 0x232, 0x233, 0x3, 0x2, 0x2, 0x2, 
+    0x233, 0x235, 0x5, 0x3a, 0x1e, 0x2, 0x234, 0x228, 0x3, 0x2, 0x2, 0x2, 
+    0x234, 0x22f, 0x3, 0x2, 0x2, 0x2, 0x235, 0x39, 0x3, 0x2, 0x2, 0x2, 0x236, 
+    0x239, 0x5, 0x3c, 0x1f, 0x2, 0x237, 0x239, 0x5, 0x3e, 0x20, 0x2, 0x238, 
+    0x236, 0x3, 0x2, 0x2, 0x2, 0x238, 0x237, 0x3, 0x2, 0x2, 0x2, 0x239, 0x3b, 
+    0x3, 0x2, 0x2, 0x2, 0x23a, 0x23c, 0x5, 0x44, 0x23, 0x2, 0x23b, 0x23d, 
+    0x7, 0x79, 0x2, 0x2, 0x23c, 0x23b, 0x3, 0x2, 0x2, 0x2, 0x23c, 0x23d, 0x3, 
+    0x2, 0x2, 0x2, 0x23d, 0x23f, 0x3, 0x2, 0x2, 0x2, 0x23e, 0x23a, 0x3, 0x2, 
+    0x2, 0x2, 0x23f, 0x242, 0x3, 0x2, 0x2, 0x2, 0x240, 0x23e, 0x3, 0x2, 0x2, 
+    0x2, 0x240, 0x241, 0x3, 0x2, 0x2, 0x2, 0x241, 0x243, 0x3, 0x2, 0x2, 0x2, 
+    0x242, 0x240, 0x3, 0x2, 0x2, 0x2, 0x243, 0x268, 0x5, 0x54, 0x2b, 0x2, 
+    0x244, 0x246, 0x5, 0x44, 0x23, 0x2, 0x245, 0x247, 0x7, 0x79, 0x2, 0x2, 
+    0x246, 0x245, 0x3, 0x2, 0x2, 0x2, 0x246, 0x247, 0x3, 0x2, 0x2, 0x2, 
+    0x247, 0x249, 0x3, 0x2, 0x2, 0x2, 0x248, 0x244, 0x3, 0x2, 0x2, 0x2, 
+    0x249, 0x24c, 0x3, 0x2, 0x2, 0x2, 0x24a, 0x248, 0x3, 0x2, 0x2, 0x2, 
+    0x24a, 0x24b, 0x3, 0x2, 0x2, 0x2, 0x24b, 0x24d, 0x3, 0x2, 0x2, 0x2, 
+    0x24c, 0x24a, 0x3, 0x2, 0x2, 0x2, 0x24d, 0x254, 0x5, 0x42, 0x22, 0x2, 
+    0x24e, 0x250, 0x7, 0x79, 0x2, 0x2, 0x24f, 0x24e, 0x3, 0x2, 0x2, 0x2, 
+    0x24f, 0x250, 0x3, 0x2, 0x2, 0x2, 0x250, 0x251, 0x3, 0x2, 0x2, 0x2, 
+    0x251, 0x253, 0x5, 0x42, 0x22, 0x2, 0x252, 0x24f, 0x3, 0x2, 0x2, 0x2, 
+    0x253, 0x256, 0x3, 0x2, 0x2, 0x2, 0x254, 0x252, 0x3, 0x2, 0x2, 0x2, 
+    0x254, 0x255, 0x3, 0x2, 0x2, 0x2, 0x255, 0x25b, 0x3, 0x2, 0x2, 0x2, 
+    0x256, 0x254, 0x3, 0x2, 0x2, 0x2, 0x257, 0x259, 0x7, 0x79, 0x2, 0x2, 
+    0x258, 0x257, 0x3, 0x2, 0x2, 0x2, 0x258, 0x259, 0x3, 0x2, 0x2, 0x2, 
+    0x259, 0x25a, 0x3, 0x2, 0x2, 0x2, 0x25a, 0x25c, 0x5, 0x54, 0x2b, 0x2, 
+    0x25b, 0x258, 0x3, 0x2, 0x2, 0x2, 0x25b, 0x25c, 0x3, 0x2, 0x2, 0x2, 
+    0x25c, 0x268, 0x3, 0x2, 0x2, 0x2, 0x25d, 0x25f, 0x5, 0x44, 0x23, 0x2, 
+    0x25e, 0x260, 0x7, 0x79, 0x2, 0x2, 0x25f, 0x25e, 0x3, 0x2, 0x2, 0x2, 
+    0x25f, 0x260, 0x3, 0x2, 0x2, 0x2, 0x260, 0x262, 0x3, 0x2, 0x2, 0x2, 
+    0x261, 0x25d, 0x3, 0x2, 0x2, 0x2, 0x262, 0x265, 0x3, 0x2, 0x2, 0x2, 
+    0x263, 0x261, 0x3, 0x2, 0x2, 0x2, 0x263, 0x264, 0x3, 0x2, 0x2, 0x2, 
+    0x264, 0x266, 0x3, 0x2, 0x2, 0x2, 0x265, 0x263, 0x3, 0x2, 0x2, 0x2, 
+    0x266, 0x268, 0x8, 0x1f, 0x1, 0x2, 0x267, 0x240, 0x3, 0x2, 0x2, 0x2, 
+    0x267, 0x24a, 0x3, 0x2, 0x2, 0x2, 0x267, 0x263, 0x3, 0x2, 0x2, 0x2, 
+    0x268, 0x3d, 0x3, 0x2, 0x2, 0x2, 0x269, 0x26b, 0x5, 0x40, 0x21, 0x2, 
+    0x26a, 0x26c, 0x7, 0x79, 0x2, 0x2, 0x26b, 0x26a, 0x3, 0x2, 0x2, 0x2, 
+    0x26b, 0x26c, 0x3, 0x2, 0x2, 0x2, 0x26c, 0x26e, 0x3, 0x2, 0x2, 0x2, 
+    0x26d, 0x269, 0x3, 0x2, 0x2, 0x2, 0x26e, 0x26f, 0x3, 0x2, 0x2, 0x2, 
+    0x26f, 0x26d, 0x3, 0x2, 0x2, 0x2, 0x26f, 0x270, 0x3, 0x2, 0x2, 0x2, 
+    0x270, 0x271, 0x3, 0x2, 0x2, 0x2, 0x271, 0x272, 0x5, 0x3c, 0x1f, 0x2, 
+    0x272, 0x3f, 0x3, 0x2, 0x2, 0x2, 0x273, 0x275, 0x5, 0x44, 0x23, 0x2, 
+    0x274, 0x276, 0x7, 0x79, 0x2, 0x2, 0x275, 0x274, 0x3, 0x2, 0x2, 0x2, 
+    0x275, 0x276, 0x3, 0x2, 0x2, 0x2, 0x276, 0x278, 0x3, 0x2, 0x2, 0x2, 
+    0x277, 0x273, 0x3, 0x2, 0x2, 0x2, 0x278, 0x27b, 0x3, 0x2, 0x2, 0x2, 
+    0x279, 0x277, 0x3, 0x2, 0x2, 0x2, 0x279, 0x27a, 0x3, 0x2, 0x2, 0x2, 
+    0x27a, 0x282, 0x3, 0x2, 0x2, 0x2, 0x27b, 0x279, 0x3, 0x2, 0x2, 0x2, 
+    0x27c, 0x27e, 0x5, 0x42, 0x22, 0x2, 0x27d, 0x27f, 0x7, 0x79, 0x2, 0x2, 
+    0x27e, 0x27d, 0x3, 0x2, 0x2, 0x2, 0x27e, 0x27f, 0x3, 0x2, 0x2, 0x2, 
+    0x27f, 0x281, 0x3, 0x2, 0x2, 0x2, 0x280, 0x27c, 0x3, 0x2, 0x2, 0x2, 
+    0x281, 0x284, 0x3, 0x2, 0x2, 0x2, 0x282, 0x280, 0x3, 0x2, 0x2, 0x2, 
+    0x282, 0x283, 0x3, 0x2, 0x2, 0x2, 0x283, 0x285, 0x3, 0x2, 0x2, 0x2, 
+    0x284, 0x282, 0x3, 0x2, 0x2, 0x2, 0x285, 0x286, 0x5, 0x52, 0x2a, 0x2, 
+    0x286, 0x41, 0x3, 0x2, 0x2, 0x2, 0x287, 0x28b, 0x5, 0x4a, 0x26, 0x2, 
+    0x288, 0x28b, 0x5, 0x4c, 0x27, 0x2, 0x289, 0x28b, 0x5, 0x50, 0x29, 0x2, 
+    0x28a, 0x287, 0x3, 0x2, 0x2, 0x2, 0x28a, 0x288, 0x3, 0x2, 0x2, 0x2, 
+    0x28a, 0x289, 0x3, 0x2, 0x2, 0x2, 0x28b, 0x43, 0x3, 0x2, 0x2, 0x2, 0x28c, 
+    0x28f, 0x5, 0x46, 0x24, 0x2, 0x28d, 0x28f, 0x5, 0x48, 0x25, 0x2, 0x28e, 
+    0x28c, 0x3, 0x2, 0x2, 0x2, 0x28e, 0x28d, 0x3, 0x2, 0x2, 0x2, 0x28f, 0x45, 
+    0x3, 0x2, 0x2, 0x2, 0x290, 0x291, 0x7, 0x43, 0x2, 0x2, 0x291, 0x293, 0x7, 
+    0x79, 0x2, 0x2, 0x292, 0x290, 0x3, 0x2, 0x2, 0x2, 0x292, 0x293, 0x3, 0x2, 
+    0x2, 0x2, 0x293, 0x294, 0x3, 0x2, 0x2, 0x2, 0x294, 0x296, 0x7, 0x44, 0x2, 
+    0x2, 0x295, 0x297, 0x7, 0x79, 0x2, 0x2, 0x296, 0x295, 0x3, 0x2, 0x2, 0x2, 
     0x296, 0x297, 0x3, 0x2, 0x2, 0x2, 0x297, 0x298, 0x3, 0x2, 0x2, 0x2, 
     0x298, 0x29d, 0x5, 0x66, 0x34, 0x2, 0x299, 0x29b, 0x7, 0x79, 0x2, 0x2, 
     0x29a, 0x299, 0x3, 0x2, 0x2, 0x2, 0x29a, 0x29b, 0x3, 0x2, 0x2, 0x2, 
@@ -10513,290 +10632,287 @@ CypherParser::Initializer::Initializer() {
     0x2d9, 0x5, 0x84, 0x43, 0x2, 0x2d8, 0x2d1, 0x3, 0x2, 0x2, 0x2, 0x2d9, 
     0x2dc, 0x3, 0x2, 0x2, 0x2, 0x2da, 0x2d8, 0x3, 0x2, 0x2, 0x2, 0x2da, 
     0x2db, 0x3, 0x2, 0x2, 0x2, 0x2db, 0x51, 0x3, 0x2, 0x2, 0x2, 0x2dc, 0x2da, 
-    0x3, 0x2, 0x2, 0x2, 0x2dd, 0x2de, 0x7, 0x49, 0x2, 0x2, 0x2de, 0x2e3, 
-    0x5, 0x56, 0x2c, 0x2, 0x2df, 0x2e1, 0x7, 0x79, 0x2, 0x2, 0x2e0, 0x2df, 
-    0x3, 0x2, 0x2, 0x2, 0x2e0, 0x2e1, 0x3, 0x2, 0x2, 0x2, 0x2e1, 0x2e2, 
-    0x3, 0x2, 0x2, 0x2, 0x2e2, 0x2e4, 0x5, 0x64, 0x33, 0x2, 0x2e3, 0x2e0, 
-    0x3, 0x2, 0x2, 0x2, 0x2e3, 0x2e4, 0x3, 0x2, 0x2, 0x2, 0x2e4, 0x53, 0x3, 
-    0x2, 0x2, 0x2, 0x2e5, 0x2e6, 0x7, 0x4a, 0x2, 0x2, 0x2e6, 0x2e7, 0x5, 
-    0x56, 0x2c, 0x2, 0x2e7, 0x55, 0x3, 0x2, 0x2, 0x2, 0x2e8, 0x2ea, 0x7, 
-    0x79, 0x2, 0x2, 0x2e9, 0x2e8, 0x3, 0x2, 0x2, 0x2, 0x2e9, 0x2ea, 0x3, 
-    0x2, 0x2, 0x2, 0x2ea, 0x2eb, 0x3, 0x2, 0x2, 0x2, 0x2eb, 0x2ed, 0x7, 
-    0x4b, 0x2, 0x2, 0x2ec, 0x2e9, 0x3, 0x2, 0x2, 0x2, 0x2ec, 0x2ed, 0x3, 
-    0x2, 0x2, 0x2, 0x2ed, 0x2ee, 0x3, 0x2, 0x2, 0x2, 0x2ee, 0x2ef, 0x7, 
-    0x79, 0x2, 0x2, 0x2ef, 0x2f2, 0x5, 0x58, 0x2d, 0x2, 0x2f0, 0x2f1, 0x7, 
-    0x79, 0x2, 0x2, 0x2f1, 0x2f3, 0x5, 0x5c, 0x2f, 0x2, 0x2f2, 0x2f0, 0x3, 
-    0x2, 0x2, 0x2, 0x2f2, 0x2f3, 0x3, 0x2, 0x2, 0x2, 0x2f3, 0x2f6, 0x3, 
-    0x2, 0x2, 0x2, 0x2f4, 0x2f5, 0x7, 0x79, 0x2, 0x2, 0x2f5, 0x2f7, 0x5, 
-    0x5e, 0x30, 0x2, 0x2f6, 0x2f4, 0x3, 0x2, 0x2, 0x2, 0x2f6, 0x2f7, 0x3, 
-    0x2, 0x2, 0x2, 0x2f7, 0x2fa, 0x3, 0x2, 0x2, 0x2, 0x2f8, 0x2f9, 0x7, 
-    0x79, 0x2, 0x2, 0x2f9, 0x2fb, 0x5, 0x60, 0x31, 0x2, 0x2fa, 0x2f8, 0x3, 
-    0x2, 0x2, 0x2, 0x2fa, 0x2fb, 0x3, 0x2, 0x2, 0x2, 0x2fb, 0x57, 0x3, 0x2, 
-    0x2, 0x2, 0x2fc, 0x307, 0x7, 0x4c, 0x2, 0x2, 0x2fd, 0x2ff, 0x7, 0x79, 
-    0x2, 0x2, 0x2fe, 0x2fd, 0x3, 0x2, 0x2, 0x2, 0x2fe, 0x2ff, 0x3, 0x2, 
-    0x2, 0x2, 0x2ff, 0x300, 0x3, 0x2, 0x2, 0x2, 0x300, 0x302, 0x7, 0x7, 
-    0x2, 0x2, 0x301, 0x303, 0x7, 0x79, 0x2, 0x2, 0x302, 0x301, 0x3, 0x2, 
-    0x2, 0x2, 0x302, 0x303, 0x3, 0x2, 0x2, 0x2, 0x303, 0x304, 0x3, 0x2, 
-    0x2, 0x2, 0x304, 0x306, 0x5, 0x5a, 0x2e, 0x2, 0x305, 0x2fe, 0x3, 0x2, 
-    0x2, 0x2, 0x306, 0x309, 0x3, 0x2, 0x2, 0x2, 0x307, 0x305, 0x3, 0x2, 
-    0x2, 0x2, 0x307, 0x308, 0x3, 0x2, 0x2, 0x2, 0x308, 0x319, 0x3, 0x2, 
-    0x2, 0x2, 0x309, 0x307, 0x3, 0x2, 0x2, 0x2, 0x30a, 0x315, 0x5, 0x5a, 
-    0x2e, 0x2, 0x30b, 0x30d, 0x7, 0x79, 0x2, 0x2, 0x30c, 0x30b, 0x3, 0x2, 
-    0x2, 0x2, 0x30c, 0x30d, 0x3, 0x2, 0x2, 0x2, 0x30d, 0x30e, 0x3, 0x2, 
-    0x2, 0x2, 0x30e, 0x310, 0x7, 0x7, 0x2, 0x2, 0x30f, 0x311, 0x7, 0x79, 
-    0x2, 0x2, 0x310, 0x30f, 0x3, 0x2, 0x2, 0x2, 0x310, 0x311, 0x3, 0x2, 
-    0x2, 0x2, 0x311, 0x312, 0x3, 0x2, 0x2, 0x2, 0x312, 0x314, 0x5, 0x5a, 
-    0x2e, 0x2, 0x313, 0x30c, 0x3, 0x2, 0x2, 0x2, 0x314, 0x317, 0x3, 0x2, 
-    0x2, 0x2, 0x315, 0x313, 0x3, 0x2, 0x2, 0x2, 0x315, 0x316, 0x3, 0x2, 
-    0x2, 0x2, 0x316, 0x319, 0x3, 0x2, 0x2, 0x2, 0x317, 0x315, 0x3, 0x2, 
-    0x2, 0x2, 0x318, 0x2fc, 0x3, 0x2, 0x2, 0x2, 0x318, 0x30a, 0x3, 0x2, 
-    0x2, 0x2, 0x319, 0x59, 0x3, 0x2, 0x2, 0x2, 0x31a, 0x31b, 0x5, 0x84, 
-    0x43, 0x2, 0x31b, 0x31c, 0x7, 0x79, 0x2, 0x2, 0x31c, 0x31d, 0x7, 0x4d, 
-    0x2, 0x2, 0x31d, 0x31e, 0x7, 0x79, 0x2, 0x2, 0x31e, 0x31f, 0x5, 0xcc, 
-    0x67, 0x2, 0x31f, 0x322, 0x3, 0x2, 0x2, 0x2, 0x320, 0x322, 0x5, 0x84, 
-    0x43, 0x2, 0x321, 0x31a, 0x3, 0x2, 0x2, 0x2, 0x321, 0x320, 0x3, 0x2, 
-    0x2, 0x2, 0x322, 0x5b, 0x3, 0x2, 0x2, 0x2, 0x323, 0x324, 0x7, 0x4e, 
-    0x2, 0x2, 0x324, 0x325, 0x7, 0x79, 0x2, 0x2, 0x325, 0x326, 0x7, 0x4f, 
-    0x2, 0x2, 0x326, 0x327, 0x7, 0x79, 0x2, 0x2, 0x327, 0x32f, 0x5, 0x62, 
-    0x32, 0x2, 0x328, 0x32a, 0x7, 0x7, 0x2, 0x2, 0x329, 0x32b, 0x7, 0x79, 
-    0x2, 0x2, 0x32a, 0x329, 0x3, 0x2, 0x2, 0x2, 0x32a, 0x32b, 0x3, 0x2, 
-    0x2, 0x2, 0x32b, 0x32c, 0x3, 0x2, 0x2, 0x2, 0x32c, 0x32e, 0x5, 0x62, 
-    0x32, 0x2, 0x32d, 0x328, 0x3, 0x2, 0x2, 0x2, 0x32e, 0x331, 0x3, 0x2, 
-    0x2, 0x2, 0x32f, 0x32d, 0x3, 0x2, 0x2, 0x2, 0x32f, 0x330, 0x3, 0x2, 
-    0x2, 0x2, 0x330, 0x5d, 0x3, 0x2, 0x2, 0x2, 0x331, 0x32f, 0x3, 0x2, 0x2, 
-    0x2, 0x332, 0x333, 0x7, 0x50, 0x2, 0x2, 0x333, 0x334, 0x7, 0x79, 0x2, 
-    0x2, 0x334, 0x335, 0x5, 0x84, 0x43, 0x2, 0x335, 0x5f, 0x3, 0x2, 0x2, 
-    0x2, 0x336, 0x337, 0x7, 0x51, 0x2, 0x2, 0x337, 0x338, 0x7, 0x79, 0x2, 
-    0x2, 0x338, 0x339, 0x5, 0x84, 0x43, 0x2, 0x339, 0x61, 0x3, 0x2, 0x2, 
-    0x2, 0x33a, 0x33f, 0x5, 0x84, 0x43, 0x2, 0x33b, 0x33d, 0x7, 0x79, 0x2, 
-    0x2, 0x33c, 0x33b, 0x3, 0x2, 0x2, 0x2, 0x33c, 0x33d, 0x3, 0x2, 0x2, 
-    0x2, 0x33d, 0x33e, 0x3, 0x2, 0x2, 0x2, 0x33e, 0x340, 0x9, 0x2, 0x2, 
-    0x2, 0x33f, 0x33c, 0x3, 0x2, 0x2, 0x2, 0x33f, 0x340, 0x3, 0x2, 0x2, 
-    0x2, 0x340, 0x63, 0x3, 0x2, 0x2, 0x2, 0x341, 0x342, 0x7, 0x56, 0x2, 
-    0x2, 0x342, 0x343, 0x7, 0x79, 0x2, 0x2, 0x343, 0x344, 0x5, 0x84, 0x43, 
-    0x2, 0x344, 0x65, 0x3, 0x2, 0x2, 0x2, 0x345, 0x350, 0x5, 0x68, 0x35, 
-    0x2, 0x346, 0x348, 0x7, 0x79, 0x2, 0x2, 0x347, 0x346, 0x3, 0x2, 0x2, 
-    0x2, 0x347, 0x348, 0x3, 0x2, 0x2, 0x2, 0x348, 0x349, 0x3, 0x2, 0x2, 
-    0x2, 0x349, 0x34b, 0x7, 0x7, 0x2, 0x2, 0x34a, 0x34c, 0x7, 0x79, 0x2, 
-    0x2, 0x34b, 0x34a, 0x3, 0x2, 0x2, 0x2, 0x34b, 0x34c, 0x3, 0x2, 0x2, 
-    0x2, 0x34c, 0x34d, 0x3, 0x2, 0x2, 0x2, 0x34d, 0x34f, 0x5, 0x68, 0x35, 
-    0x2, 0x34e, 0x347, 0x3, 0x2, 0x2, 0x2, 0x34f, 0x352, 0x3, 0x2, 0x2, 
-    0x2, 0x350, 0x34e, 0x3, 0x2, 0x2, 0x2, 0x350, 0x351, 0x3, 0x2, 0x2, 
-    0x2, 0x351, 0x67, 0x3, 0x2, 0x2, 0x2, 0x352, 0x350, 0x3, 0x2, 0x2, 0x2, 
-    0x353, 0x354, 0x5, 0x6a, 0x36, 0x2, 0x354, 0x69, 0x3, 0x2, 0x2, 0x2, 
-    0x355, 0x356, 0x5, 0x6c, 0x37, 0x2, 0x356, 0x6b, 0x3, 0x2, 0x2, 0x2, 
-    0x357, 0x35e, 0x5, 0x6e, 0x38, 0x2, 0x358, 0x35a, 0x7, 0x79, 0x2, 0x2, 
-    0x359, 0x358, 0x3, 0x2, 0x2, 0x2, 0x359, 0x35a, 0x3, 0x2, 0x2, 0x2, 
-    0x35a, 0x35b, 0x3, 0x2, 0x2, 0x2, 0x35b, 0x35d, 0x5, 0x70, 0x39, 0x2, 
-    0x35c, 0x359, 0x3, 0x2, 0x2, 0x2, 0x35d, 0x360, 0x3, 0x2, 0x2, 0x2, 
-    0x35e, 0x35c, 0x3, 0x2, 0x2, 0x2, 0x35e, 0x35f, 0x3, 0x2, 0x2, 0x2, 
-    0x35f, 0x366, 0x3, 0x2, 0x2, 0x2, 0x360, 0x35e, 0x3, 0x2, 0x2, 0x2, 
-    0x361, 0x362, 0x7, 0x4, 0x2, 0x2, 0x362, 0x363, 0x5, 0x6c, 0x37, 0x2, 
-    0x363, 0x364, 0x7, 0x5, 0x2, 0x2, 0x364, 0x366, 0x3, 0x2, 0x2, 0x2, 
-    0x365, 0x357, 0x3, 0x2, 0x2, 0x2, 0x365, 0x361, 0x3, 0x2, 0x2, 0x2, 
-    0x366, 0x6d, 0x3, 0x2, 0x2, 0x2, 0x367, 0x369, 0x7, 0x4, 0x2, 0x2, 0x368, 
-    0x36a, 0x7, 0x79, 0x2, 0x2, 0x369, 0x368, 0x3, 0x2, 0x2, 0x2, 0x369, 
-    0x36a, 0x3, 0x2, 0x2, 0x2, 0x36a, 0x36f, 0x3, 0x2, 0x2, 0x2, 0x36b, 
-    0x36d, 0x5, 0xcc, 0x67, 0x2, 0x36c, 0x36e, 0x7, 0x79, 0x2, 0x2, 0x36d, 
-    0x36c, 0x3, 0x2, 0x2, 0x2, 0x36d, 0x36e, 0x3, 0x2, 0x2, 0x2, 0x36e, 
-    0x370, 0x3, 0x2, 0x2, 0x2, 0x36f, 0x36b, 0x3, 0x2, 0x2, 0x2, 0x36f, 
-    0x370, 0x3, 0x2, 0x2, 0x2, 0x370, 0x375, 0x3, 0x2, 0x2, 0x2, 0x371, 
-    0x373, 0x5, 0x7a, 0x3e, 0x2, 0x372, 0x374, 0x7, 0x79, 0x2, 0x2, 0x373, 
-    0x372, 0x3, 0x2, 0x2, 0x2, 0x373, 0x374, 0x3, 0x2, 0x2, 0x2, 0x374, 
-    0x376, 0x3, 0x2, 0x2, 0x2, 0x375, 0x371, 0x3, 0x2, 0x2, 0x2, 0x375, 
-    0x376, 0x3, 0x2, 0x2, 0x2, 0x376, 0x37b, 0x3, 0x2, 0x2, 0x2, 0x377, 
-    0x379, 0x5, 0x76, 0x3c, 0x2, 0x378, 0x37a, 0x7, 0x79, 0x2, 0x2, 0x379, 
-    0x378, 0x3, 0x2, 0x2, 0x2, 0x379, 0x37a, 0x3, 0x2, 0x2, 0x2, 0x37a, 
-    0x37c, 0x3, 0x2, 0x2, 0x2, 0x37b, 0x377, 0x3, 0x2, 0x2, 0x2, 0x37b, 
-    0x37c, 0x3, 0x2, 0x2, 0x2, 0x37c, 0x37d, 0x3, 0x2, 0x2, 0x2, 0x37d, 
-    0x395, 0x7, 0x5, 0x2, 0x2, 0x37e, 0x380, 0x7, 0x79, 0x2, 0x2, 0x37f, 
-    0x37e, 0x3, 0x2, 0x2, 0x2, 0x37f, 0x380, 0x3, 0x2, 0x2, 0x2, 0x380, 
-    0x385, 0x3, 0x2, 0x2, 0x2, 0x381, 0x383, 0x5, 0xcc, 0x67, 0x2, 0x382, 
-    0x384, 0x7, 0x79, 0x2, 0x2, 0x383, 0x382, 0x3, 0x2, 0x2, 0x2, 0x383, 
-    0x384, 0x3, 0x2, 0x2, 0x2, 0x384, 0x386, 0x3, 0x2, 0x2, 0x2, 0x385, 
-    0x381, 0x3, 0x2, 0x2, 0x2, 0x385, 0x386, 0x3, 0x2, 0x2, 0x2, 0x386, 
-    0x38b, 0x3, 0x2, 0x2, 0x2, 0x387, 0x389, 0x5, 0x7a, 0x3e, 0x2, 0x388, 
-    0x38a, 0x7, 0x79, 0x2, 0x2, 0x389, 0x388, 0x3, 0x2, 0x2, 0x2, 0x389, 
-    0x38a, 0x3, 0x2, 0x2, 0x2, 0x38a, 0x38c, 0x3, 0x2, 0x2, 0x2, 0x38b, 
-    0x387, 0x3, 0x2, 0x2, 0x2, 0x38b, 0x38c, 0x3, 0x2, 0x2, 0x2, 0x38c, 
-    0x391, 0x3, 0x2, 0x2, 0x2, 0x38d, 0x38f, 0x5, 0x76, 0x3c, 0x2, 0x38e, 
-    0x390, 0x7, 0x79, 0x2, 0x2, 0x38f, 0x38e, 0x3, 0x2, 0x2, 0x2, 0x38f, 
-    0x390, 0x3, 0x2, 0x2, 0x2, 0x390, 0x392, 0x3, 0x2, 0x2, 0x2, 0x391, 
-    0x38d, 0x3, 0x2, 0x2, 0x2, 0x391, 0x392, 0x3, 0x2, 0x2, 0x2, 0x392, 
-    0x393, 0x3, 0x2, 0x2, 0x2, 0x393, 0x395, 0x8, 0x38, 0x1, 0x2, 0x394, 
-    0x367, 0x3, 0x2, 0x2, 0x2, 0x394, 0x37f, 0x3, 0x2, 0x2, 0x2, 0x395, 
-    0x6f, 0x3, 0x2, 0x2, 0x2, 0x396, 0x398, 0x5, 0x72, 0x3a, 0x2, 0x397, 
-    0x399, 0x7, 0x79, 0x2, 0x2, 0x398, 0x397, 0x3, 0x2, 0x2, 0x2, 0x398, 
-    0x399, 0x3, 0x2, 0x2, 0x2, 0x399, 0x39a, 0x3, 0x2, 0x2, 0x2, 0x39a, 
-    0x39b, 0x5, 0x6e, 0x38, 0x2, 0x39b, 0x71, 0x3, 0x2, 0x2, 0x2, 0x39c, 
-    0x39e, 0x5, 0xde, 0x70, 0x2, 0x39d, 0x39f, 0x7, 0x79, 0x2, 0x2, 0x39e, 
-    0x39d, 0x3, 0x2, 0x2, 0x2, 0x39e, 0x39f, 0x3, 0x2, 0x2, 0x2, 0x39f, 
-    0x3a0, 0x3, 0x2, 0x2, 0x2, 0x3a0, 0x3a2, 0x5, 0xe2, 0x72, 0x2, 0x3a1, 
-    0x3a3, 0x7, 0x79, 0x2, 0x2, 0x3a2, 0x3a1, 0x3, 0x2, 0x2, 0x2, 0x3a2, 
-    0x3a3, 0x3, 0x2, 0x2, 0x2, 0x3a3, 0x3a5, 0x3, 0x2, 0x2, 0x2, 0x3a4, 
-    0x3a6, 0x5, 0x74, 0x3b, 0x2, 0x3a5, 0x3a4, 0x3, 0x2, 0x2, 0x2, 0x3a5, 
-    0x3a6, 0x3, 0x2, 0x2, 0x2, 0x3a6, 0x3a8, 0x3, 0x2, 0x2, 0x2, 0x3a7, 
-    0x3a9, 0x7, 0x79, 0x2, 0x2, 0x3a8, 0x3a7, 0x3, 0x2, 0x2, 0x2, 0x3a8, 
-    0x3a9, 0x3, 0x2, 0x2, 0x2, 0x3a9, 0x3aa, 0x3, 0x2, 0x2, 0x2, 0x3aa, 
-    0x3ab, 0x5, 0xe2, 0x72, 0x2, 0x3ab, 0x3bd, 0x3, 0x2, 0x2, 0x2, 0x3ac, 
-    0x3ae, 0x5, 0xe2, 0x72, 0x2, 0x3ad, 0x3af, 0x7, 0x79, 0x2, 0x2, 0x3ae, 
-    0x3ad, 0x3, 0x2, 0x2, 0x2, 0x3ae, 0x3af, 0x3, 0x2, 0x2, 0x2, 0x3af, 
-    0x3b1, 0x3, 0x2, 0x2, 0x2, 0x3b0, 0x3b2, 0x5, 0x74, 0x3b, 0x2, 0x3b1, 
-    0x3b0, 0x3, 0x2, 0x2, 0x2, 0x3b1, 0x3b2, 0x3, 0x2, 0x2, 0x2, 0x3b2, 
-    0x3b4, 0x3, 0x2, 0x2, 0x2, 0x3b3, 0x3b5, 0x7, 0x79, 0x2, 0x2, 0x3b4, 
-    0x3b3, 0x3, 0x2, 0x2, 0x2, 0x3b4, 0x3b5, 0x3, 0x2, 0x2, 0x2, 0x3b5, 
-    0x3b6, 0x3, 0x2, 0x2, 0x2, 0x3b6, 0x3b8, 0x5, 0xe2, 0x72, 0x2, 0x3b7, 
-    0x3b9, 0x7, 0x79, 0x2, 0x2, 0x3b8, 0x3b7, 0x3, 0x2, 0x2, 0x2, 0x3b8, 
-    0x3b9, 0x3, 0x2, 0x2, 0x2, 0x3b9, 0x3ba, 0x3, 0x2, 0x2, 0x2, 0x3ba, 
-    0x3bb, 0x5, 0xe0, 0x71, 0x2, 0x3bb, 0x3bd, 0x3, 0x2, 0x2, 0x2, 0x3bc, 
-    0x39c, 0x3, 0x2, 0x2, 0x2, 0x3bc, 0x3ac, 0x3, 0x2, 0x2, 0x2, 0x3bd, 
-    0x73, 0x3, 0x2, 0x2, 0x2, 0x3be, 0x3c0, 0x7, 0x6, 0x2, 0x2, 0x3bf, 0x3c1, 
-    0x7, 0x79, 0x2, 0x2, 0x3c0, 0x3bf, 0x3, 0x2, 0x2, 0x2, 0x3c0, 0x3c1, 
-    0x3, 0x2, 0x2, 0x2, 0x3c1, 0x3c6, 0x3, 0x2, 0x2, 0x2, 0x3c2, 0x3c4, 
-    0x5, 0xcc, 0x67, 0x2, 0x3c3, 0x3c5, 0x7, 0x79, 0x2, 0x2, 0x3c4, 0x3c3, 
-    0x3, 0x2, 0x2, 0x2, 0x3c4, 0x3c5, 0x3, 0x2, 0x2, 0x2, 0x3c5, 0x3c7, 
-    0x3, 0x2, 0x2, 0x2, 0x3c6, 0x3c2, 0x3, 0x2, 0x2, 0x2, 0x3c6, 0x3c7, 
-    0x3, 0x2, 0x2, 0x2, 0x3c7, 0x3cc, 0x3, 0x2, 0x2, 0x2, 0x3c8, 0x3ca, 
-    0x5, 0x78, 0x3d, 0x2, 0x3c9, 0x3cb, 0x7, 0x79, 0x2, 0x2, 0x3ca, 0x3c9, 
-    0x3, 0x2, 0x2, 0x2, 0x3ca, 0x3cb, 0x3, 0x2, 0x2, 0x2, 0x3cb, 0x3cd, 
-    0x3, 0x2, 0x2, 0x2, 0x3cc, 0x3c8, 0x3, 0x2, 0x2, 0x2, 0x3cc, 0x3cd, 
-    0x3, 0x2, 0x2, 0x2, 0x3cd, 0x3d2, 0x3, 0x2, 0x2, 0x2, 0x3ce, 0x3d0, 
-    0x5, 0x7e, 0x40, 0x2, 0x3cf, 0x3d1, 0x7, 0x79, 0x2, 0x2, 0x3d0, 0x3cf, 
-    0x3, 0x2, 0x2, 0x2, 0x3d0, 0x3d1, 0x3, 0x2, 0x2, 0x2, 0x3d1, 0x3d3, 
-    0x3, 0x2, 0x2, 0x2, 0x3d2, 0x3ce, 0x3, 0x2, 0x2, 0x2, 0x3d2, 0x3d3, 
-    0x3, 0x2, 0x2, 0x2, 0x3d3, 0x3d8, 0x3, 0x2, 0x2, 0x2, 0x3d4, 0x3d6, 
-    0x5, 0x76, 0x3c, 0x2, 0x3d5, 0x3d7, 0x7, 0x79, 0x2, 0x2, 0x3d6, 0x3d5, 
-    0x3, 0x2, 0x2, 0x2, 0x3d6, 0x3d7, 0x3, 0x2, 0x2, 0x2, 0x3d7, 0x3d9, 
-    0x3, 0x2, 0x2, 0x2, 0x3d8, 0x3d4, 0x3, 0x2, 0x2, 0x2, 0x3d8, 0x3d9, 
-    0x3, 0x2, 0x2, 0x2, 0x3d9, 0x3da, 0x3, 0x2, 0x2, 0x2, 0x3da, 0x3db, 
-    0x7, 0x8, 0x2, 0x2, 0x3db, 0x75, 0x3, 0x2, 0x2, 0x2, 0x3dc, 0x3de, 0x7, 
-    0xa, 0x2, 0x2, 0x3dd, 0x3df, 0x7, 0x79, 0x2, 0x2, 0x3de, 0x3dd, 0x3, 
-    0x2, 0x2, 0x2, 0x3de, 0x3df, 0x3, 0x2, 0x2, 0x2, 0x3df, 0x401, 0x3, 
-    0x2, 0x2, 0x2, 0x3e0, 0x3e2, 0x5, 0xd4, 0x6b, 0x2, 0x3e1, 0x3e3, 0x7, 
-    0x79, 0x2, 0x2, 0x3e2, 0x3e1, 0x3, 0x2, 0x2, 0x2, 0x3e2, 0x3e3, 0x3, 
-    0x2, 0x2, 0x2, 0x3e3, 0x3e4, 0x3, 0x2, 0x2, 0x2, 0x3e4, 0x3e6, 0x7, 
-    0xb, 0x2, 0x2, 0x3e5, 0x3e7, 0x7, 0x79, 0x2, 0x2, 0x3e6, 0x3e5, 0x3, 
-    0x2, 0x2, 0x2, 0x3e6, 0x3e7, 0x3, 0x2, 0x2, 0x2, 0x3e7, 0x3e8, 0x3, 
-    0x2, 0x2, 0x2, 0x3e8, 0x3ea, 0x5, 0x84, 0x43, 0x2, 0x3e9, 0x3eb, 0x7, 
-    0x79, 0x2, 0x2, 0x3ea, 0x3e9, 0x3, 0x2, 0x2, 0x2, 0x3ea, 0x3eb, 0x3, 
-    0x2, 0x2, 0x2, 0x3eb, 0x3fe, 0x3, 0x2, 0x2, 0x2, 0x3ec, 0x3ee, 0x7, 
-    0x7, 0x2, 0x2, 0x3ed, 0x3ef, 0x7, 0x79, 0x2, 0x2, 0x3ee, 0x3ed, 0x3, 
-    0x2, 0x2, 0x2, 0x3ee, 0x3ef, 0x3, 0x2, 0x2, 0x2, 0x3ef, 0x3f0, 0x3, 
-    0x2, 0x2, 0x2, 0x3f0, 0x3f2, 0x5, 0xd4, 0x6b, 0x2, 0x3f1, 0x3f3, 0x7, 
-    0x79, 0x2, 0x2, 0x3f2, 0x3f1, 0x3, 0x2, 0x2, 0x2, 0x3f2, 0x3f3, 0x3, 
-    0x2, 0x2, 0x2, 0x3f3, 0x3f4, 0x3, 0x2, 0x2, 0x2, 0x3f4, 0x3f6, 0x7, 
-    0xb, 0x2, 0x2, 0x3f5, 0x3f7, 0x7, 0x79, 0x2, 0x2, 0x3f6, 0x3f5, 0x3, 
-    0x2, 0x2, 0x2, 0x3f6, 0x3f7, 0x3, 0x2, 0x2, 0x2, 0x3f7, 0x3f8, 0x3, 
-    0x2, 0x2, 0x2, 0x3f8, 0x3fa, 0x5, 0x84, 0x43, 0x2, 0x3f9, 0x3fb, 0x7, 
-    0x79, 0x2, 0x2, 0x3fa, 0x3f9, 0x3, 0x2, 0x2, 0x2, 0x3fa, 0x3fb, 0x3, 
-    0x2, 0x2, 0x2, 0x3fb, 0x3fd, 0x3, 0x2, 0x2, 0x2, 0x3fc, 0x3ec, 0x3, 
-    0x2, 0x2, 0x2, 0x3fd, 0x400, 0x3, 0x2, 0x2, 0x2, 0x3fe, 0x3fc, 0x3, 
-    0x2, 0x2, 0x2, 0x3fe, 0x3ff, 0x3, 0x2, 0x2, 0x2, 0x3ff, 0x402, 0x3, 
-    0x2, 0x2, 0x2, 0x400, 0x3fe, 0x3, 0x2, 0x2, 0x2, 0x401, 0x3e0, 0x3, 
-    0x2, 0x2, 0x2, 0x401, 0x402, 0x3, 0x2, 0x2, 0x2, 0x402, 0x403, 0x3, 
-    0x2, 0x2, 0x2, 0x403, 0x404, 0x7, 0xc, 0x2, 0x2, 0x404, 0x77, 0x3, 0x2, 
-    0x2, 0x2, 0x405, 0x407, 0x7, 0xb, 0x2, 0x2, 0x406, 0x408, 0x7, 0x79, 
-    0x2, 0x2, 0x407, 0x406, 0x3, 0x2, 0x2, 0x2, 0x407, 0x408, 0x3, 0x2, 
+    0x3, 0x2, 0x2, 0x2, 0x2dd, 0x2de, 0x7, 0x49, 0x2, 0x2, 0x2de, 0x2e3, 0x5, 
+    0x56, 0x2c, 0x2, 0x2df, 0x2e1, 0x7, 0x79, 0x2, 0x2, 0x2e0, 0x2df, 0x3, 
+    0x2, 0x2, 0x2, 0x2e0, 0x2e1, 0x3, 0x2, 0x2, 0x2, 0x2e1, 0x2e2, 0x3, 0x2, 
+    0x2, 0x2, 0x2e2, 0x2e4, 0x5, 0x64, 0x33, 0x2, 0x2e3, 0x2e0, 0x3, 0x2, 
+    0x2, 0x2, 0x2e3, 0x2e4, 0x3, 0x2, 0x2, 0x2, 0x2e4, 0x53, 0x3, 0x2, 0x2, 
+    0x2, 0x2e5, 0x2e6, 0x7, 0x4a, 0x2, 0x2, 0x2e6, 0x2e7, 0x5, 0x56, 0x2c, 
+    0x2, 0x2e7, 0x55, 0x3, 0x2, 0x2, 0x2, 0x2e8, 0x2ea, 0x7, 0x79, 0x2, 0x2, 
+    0x2e9, 0x2e8, 0x3, 0x2, 0x2, 0x2, 0x2e9, 0x2ea, 0x3, 0x2, 0x2, 0x2, 
+    0x2ea, 0x2eb, 0x3, 0x2, 0x2, 0x2, 0x2eb, 0x2ed, 0x7, 0x4b, 0x2, 0x2, 
+    0x2ec, 0x2e9, 0x3, 0x2, 0x2, 0x2, 0x2ec, 0x2ed, 0x3, 0x2, 0x2, 0x2, 
+    0x2ed, 0x2ee, 0x3, 0x2, 0x2, 0x2, 0x2ee, 0x2ef, 0x7, 0x79, 0x2, 0x2, 
+    0x2ef, 0x2f2, 0x5, 0x58, 0x2d, 0x2, 0x2f0, 0x2f1, 0x7, 0x79, 0x2, 0x2, 
+    0x2f1, 0x2f3, 0x5, 0x5c, 0x2f, 0x2, 0x2f2, 0x2f0, 0x3, 0x2, 0x2, 0x2, 
+    0x2f2, 0x2f3, 0x3, 0x2, 0x2, 0x2, 0x2f3, 0x2f6, 0x3, 0x2, 0x2, 0x2, 
+    0x2f4, 0x2f5, 0x7, 0x79, 0x2, 0x2, 0x2f5, 0x2f7, 0x5, 0x5e, 0x30, 0x2, 
+    0x2f6, 0x2f4, 0x3, 0x2, 0x2, 0x2, 0x2f6, 0x2f7, 0x3, 0x2, 0x2, 0x2, 
+    0x2f7, 0x2fa, 0x3, 0x2, 0x2, 0x2, 0x2f8, 0x2f9, 0x7, 0x79, 0x2, 0x2, 
+    0x2f9, 0x2fb, 0x5, 0x60, 0x31, 0x2, 0x2fa, 0x2f8, 0x3, 0x2, 0x2, 0x2, 
+    0x2fa, 0x2fb, 0x3, 0x2, 0x2, 0x2, 0x2fb, 0x57, 0x3, 0x2, 0x2, 0x2, 0x2fc, 
+    0x307, 0x7, 0x4c, 0x2, 0x2, 0x2fd, 0x2ff, 0x7, 0x79, 0x2, 0x2, 0x2fe, 
+    0x2fd, 0x3, 0x2, 0x2, 0x2, 0x2fe, 0x2ff, 0x3, 0x2, 0x2, 0x2, 0x2ff, 
+    0x300, 0x3, 0x2, 0x2, 0x2, 0x300, 0x302, 0x7, 0x7, 0x2, 0x2, 0x301, 
+    0x303, 0x7, 0x79, 0x2, 0x2, 0x302, 0x301, 0x3, 0x2, 0x2, 0x2, 0x302, 
+    0x303, 0x3, 0x2, 0x2, 0x2, 0x303, 0x304, 0x3, 0x2, 0x2, 0x2, 0x304, 
+    0x306, 0x5, 0x5a, 0x2e, 0x2, 0x305, 0x2fe, 0x3, 0x2, 0x2, 0x2, 0x306, 
+    0x309, 0x3, 0x2, 0x2, 0x2, 0x307, 0x305, 0x3, 0x2, 0x2, 0x2, 0x307, 
+    0x308, 0x3, 0x2, 0x2, 0x2, 0x308, 0x319, 0x3, 0x2, 0x2, 0x2, 0x309, 
+    0x307, 0x3, 0x2, 0x2, 0x2, 0x30a, 0x315, 0x5, 0x5a, 0x2e, 0x2, 0x30b, 
+    0x30d, 0x7, 0x79, 0x2, 0x2, 0x30c, 0x30b, 0x3, 0x2, 0x2, 0x2, 0x30c, 
+    0x30d, 0x3, 0x2, 0x2, 0x2, 0x30d, 0x30e, 0x3, 0x2, 0x2, 0x2, 0x30e, 
+    0x310, 0x7, 0x7, 0x2, 0x2, 0x30f, 0x311, 0x7, 0x79, 0x2, 0x2, 0x310, 
+    0x30f, 0x3, 0x2, 0x2, 0x2, 0x310, 0x311, 0x3, 0x2, 0x2, 0x2, 0x311, 
+    0x312, 0x3, 0x2, 0x2, 0x2, 0x312, 0x314, 0x5, 0x5a, 0x2e, 0x2, 0x313, 
+    0x30c, 0x3, 0x2, 0x2, 0x2, 0x314, 0x317, 0x3, 0x2, 0x2, 0x2, 0x315, 
+    0x313, 0x3, 0x2, 0x2, 0x2, 0x315, 0x316, 0x3, 0x2, 0x2, 0x2, 0x316, 
+    0x319, 0x3, 0x2, 0x2, 0x2, 0x317, 0x315, 0x3, 0x2, 0x2, 0x2, 0x318, 
+    0x2fc, 0x3, 0x2, 0x2, 0x2, 0x318, 0x30a, 0x3, 0x2, 0x2, 0x2, 0x319, 0x59, 
+    0x3, 0x2, 0x2, 0x2, 0x31a, 0x31b, 0x5, 0x84, 0x43, 0x2, 0x31b, 0x31c, 
+    0x7, 0x79, 0x2, 0x2, 0x31c, 0x31d, 0x7, 0x4d, 0x2, 0x2, 0x31d, 0x31e, 
+    0x7, 0x79, 0x2, 0x2, 0x31e, 0x31f, 0x5, 0xcc, 0x67, 0x2, 0x31f, 0x322, 
+    0x3, 0x2, 0x2, 0x2, 0x320, 0x322, 0x5, 0x84, 0x43, 0x2, 0x321, 0x31a, 
+    0x3, 0x2, 0x2, 0x2, 0x321, 0x320, 0x3, 0x2, 0x2, 0x2, 0x322, 0x5b, 0x3, 
+    0x2, 0x2, 0x2, 0x323, 0x324, 0x7, 0x4e, 0x2, 0x2, 0x324, 0x325, 0x7, 
+    0x79, 0x2, 0x2, 0x325, 0x326, 0x7, 0x4f, 0x2, 0x2, 0x326, 0x327, 0x7, 
+    0x79, 0x2, 0x2, 0x327, 0x32f, 0x5, 0x62, 0x32, 0x2, 0x328, 0x32a, 0x7, 
+    0x7, 0x2, 0x2, 0x329, 0x32b, 0x7, 0x79, 0x2, 0x2, 0x32a, 0x329, 0x3, 0x2, 
+    0x2, 0x2, 0x32a, 0x32b, 0x3, 0x2, 0x2, 0x2, 0x32b, 0x32c, 0x3, 0x2, 0x2, 
+    0x2, 0x32c, 0x32e, 0x5, 0x62, 0x32, 0x2, 0x32d, 0x328, 0x3, 0x2, 0x2, 
+    0x2, 0x32e, 0x331, 0x3, 0x2, 0x2, 0x2, 0x32f, 0x32d, 0x3, 0x2, 0x2, 0x2, 
+    0x32f, 0x330, 0x3, 0x2, 0x2, 0x2, 0x330, 0x5d, 0x3, 0x2, 0x2, 0x2, 0x331, 
+    0x32f, 0x3, 0x2, 0x2, 0x2, 0x332, 0x333, 0x7, 0x50, 0x2, 0x2, 0x333, 
+    0x334, 0x7, 0x79, 0x2, 0x2, 0x334, 0x335, 0x5, 0x84, 0x43, 0x2, 0x335, 
+    0x5f, 0x3, 0x2, 0x2, 0x2, 0x336, 0x337, 0x7, 0x51, 0x2, 0x2, 0x337, 
+    0x338, 0x7, 0x79, 0x2, 0x2, 0x338, 0x339, 0x5, 0x84, 0x43, 0x2, 0x339, 
+    0x61, 0x3, 0x2, 0x2, 0x2, 0x33a, 0x33f, 0x5, 0x84, 0x43, 0x2, 0x33b, 
+    0x33d, 0x7, 0x79, 0x2, 0x2, 0x33c, 0x33b, 0x3, 0x2, 0x2, 0x2, 0x33c, 
+    0x33d, 0x3, 0x2, 0x2, 0x2, 0x33d, 0x33e, 0x3, 0x2, 0x2, 0x2, 0x33e, 
+    0x340, 0x9, 0x2, 0x2, 0x2, 0x33f, 0x33c, 0x3, 0x2, 0x2, 0x2, 0x33f, 
+    0x340, 0x3, 0x2, 0x2, 0x2, 0x340, 0x63, 0x3, 0x2, 0x2, 0x2, 0x341, 0x342, 
+    0x7, 0x56, 0x2, 0x2, 0x342, 0x343, 0x7, 0x79, 0x2, 0x2, 0x343, 0x344, 
+    0x5, 0x84, 0x43, 0x2, 0x344, 0x65, 0x3, 0x2, 0x2, 0x2, 0x345, 0x350, 0x5, 
+    0x68, 0x35, 0x2, 0x346, 0x348, 0x7, 0x79, 0x2, 0x2, 0x347, 0x346, 0x3, 
+    0x2, 0x2, 0x2, 0x347, 0x348, 0x3, 0x2, 0x2, 0x2, 0x348, 0x349, 0x3, 0x2, 
+    0x2, 0x2, 0x349, 0x34b, 0x7, 0x7, 0x2, 0x2, 0x34a, 0x34c, 0x7, 0x79, 0x2, 
+    0x2, 0x34b, 0x34a, 0x3, 0x2, 0x2, 0x2, 0x34b, 0x34c, 0x3, 0x2, 0x2, 0x2, 
+    0x34c, 0x34d, 0x3, 0x2, 0x2, 0x2, 0x34d, 0x34f, 0x5, 0x68, 0x35, 0x2, 
+    0x34e, 0x347, 0x3, 0x2, 0x2, 0x2, 0x34f, 0x352, 0x3, 0x2, 0x2, 0x2, 
+    0x350, 0x34e, 0x3, 0x2, 0x2, 0x2, 0x350, 0x351, 0x3, 0x2, 0x2, 0x2, 
+    0x351, 0x67, 0x3, 0x2, 0x2, 0x2, 0x352, 0x350, 0x3, 0x2, 0x2, 0x2, 0x353, 
+    0x354, 0x5, 0x6a, 0x36, 0x2, 0x354, 0x69, 0x3, 0x2, 0x2, 0x2, 0x355, 
+    0x356, 0x5, 0x6c, 0x37, 0x2, 0x356, 0x6b, 0x3, 0x2, 0x2, 0x2, 0x357, 
+    0x35e, 0x5, 0x6e, 0x38, 0x2, 0x358, 0x35a, 0x7, 0x79, 0x2, 0x2, 0x359, 
+    0x358, 0x3, 0x2, 0x2, 0x2, 0x359, 0x35a, 0x3, 0x2, 0x2, 0x2, 0x35a, 
+    0x35b, 0x3, 0x2, 0x2, 0x2, 0x35b, 0x35d, 0x5, 0x70, 0x39, 0x2, 0x35c, 
+    0x359, 0x3, 0x2, 0x2, 0x2, 0x35d, 0x360, 0x3, 0x2, 0x2, 0x2, 0x35e, 
+    0x35c, 0x3, 0x2, 0x2, 0x2, 0x35e, 0x35f, 0x3, 0x2, 0x2, 0x2, 0x35f, 
+    0x366, 0x3, 0x2, 0x2, 0x2, 0x360, 0x35e, 0x3, 0x2, 0x2, 0x2, 0x361, 
+    0x362, 0x7, 0x4, 0x2, 0x2, 0x362, 0x363, 0x5, 0x6c, 0x37, 0x2, 0x363, 
+    0x364, 0x7, 0x5, 0x2, 0x2, 0x364, 0x366, 0x3, 0x2, 0x2, 0x2, 0x365, 
+    0x357, 0x3, 0x2, 0x2, 0x2, 0x365, 0x361, 0x3, 0x2, 0x2, 0x2, 0x366, 0x6d, 
+    0x3, 0x2, 0x2, 0x2, 0x367, 0x369, 0x7, 0x4, 0x2, 0x2, 0x368, 0x36a, 0x7, 
+    0x79, 0x2, 0x2, 0x369, 0x368, 0x3, 0x2, 0x2, 0x2, 0x369, 0x36a, 0x3, 0x2, 
+    0x2, 0x2, 0x36a, 0x36f, 0x3, 0x2, 0x2, 0x2, 0x36b, 0x36d, 0x5, 0xcc, 
+    0x67, 0x2, 0x36c, 0x36e, 0x7, 0x79, 0x2, 0x2, 0x36d, 0x36c, 0x3, 0x2, 
+    0x2, 0x2, 0x36d, 0x36e, 0x3, 0x2, 0x2, 0x2, 0x36e, 0x370, 0x3, 0x2, 0x2, 
+    0x2, 0x36f, 0x36b, 0x3, 0x2, 0x2, 0x2, 0x36f, 0x370, 0x3, 0x2, 0x2, 0x2, 
+    0x370, 0x375, 0x3, 0x2, 0x2, 0x2, 0x371, 0x373, 0x5, 0x7a, 0x3e, 0x2, 
+    0x372, 0x374, 0x7, 0x79, 0x2, 0x2, 0x373, 0x372, 0x3, 0x2, 0x2, 0x2, 
+    0x373, 0x374, 0x3, 0x2, 0x2, 0x2, 0x374, 0x376, 0x3, 0x2, 0x2, 0x2, 
+    0x375, 0x371, 0x3, 0x2, 0x2, 0x2, 0x375, 0x376, 0x3, 0x2, 0x2, 0x2, 
+    0x376, 0x37b, 0x3, 0x2, 0x2, 0x2, 0x377, 0x379, 0x5, 0x76, 0x3c, 0x2, 
+    0x378, 0x37a, 0x7, 0x79, 0x2, 0x2, 0x379, 0x378, 0x3, 0x2, 0x2, 0x2, 
+    0x379, 0x37a, 0x3, 0x2, 0x2, 0x2, 0x37a, 0x37c, 0x3, 0x2, 0x2, 0x2, 
+    0x37b, 0x377, 0x3, 0x2, 0x2, 0x2, 0x37b, 0x37c, 0x3, 0x2, 0x2, 0x2, 
+    0x37c, 0x37d, 0x3, 0x2, 0x2, 0x2, 0x37d, 0x395, 0x7, 0x5, 0x2, 0x2, 
+    0x37e, 0x380, 0x7, 0x79, 0x2, 0x2, 0x37f, 0x37e, 0x3, 0x2, 0x2, 0x2, 
+    0x37f, 0x380, 0x3, 0x2, 0x2, 0x2, 0x380, 0x385, 0x3, 0x2, 0x2, 0x2, 
+    0x381, 0x383, 0x5, 0xcc, 0x67, 0x2, 0x382, 0x384, 0x7, 0x79, 0x2, 0x2, 
+    0x383, 0x382, 0x3, 0x2, 0x2, 0x2, 0x383, 0x384, 0x3, 0x2, 0x2, 0x2, 
+    0x384, 0x386, 0x3, 0x2, 0x2, 0x2, 0x385, 0x381, 0x3, 0x2, 0x2, 0x2, 
+    0x385, 0x386, 0x3, 0x2, 0x2, 0x2, 0x386, 0x38b, 0x3, 0x2, 0x2, 0x2, 
+    0x387, 0x389, 0x5, 0x7a, 0x3e, 0x2, 0x388, 0x38a, 0x7, 0x79, 0x2, 0x2, 
+    0x389, 0x388, 0x3, 0x2, 0x2, 0x2, 0x389, 0x38a, 0x3, 0x2, 0x2, 0x2, 
+    0x38a, 0x38c, 0x3, 0x2, 0x2, 0x2, 0x38b, 0x387, 0x3, 0x2, 0x2, 0x2, 
+    0x38b, 0x38c, 0x3, 0x2, 0x2, 0x2, 0x38c, 0x391, 0x3, 0x2, 0x2, 0x2, 
+    0x38d, 0x38f, 0x5, 0x76, 0x3c, 0x2, 0x38e, 0x390, 0x7, 0x79, 0x2, 0x2, 
+    0x38f, 0x38e, 0x3, 0x2, 0x2, 0x2, 0x38f, 0x390, 0x3, 0x2, 0x2, 0x2, 
+    0x390, 0x392, 0x3, 0x2, 0x2, 0x2, 0x391, 0x38d, 0x3, 0x2, 0x2, 0x2, 
+    0x391, 0x392, 0x3, 0x2, 0x2, 0x2, 0x392, 0x393, 0x3, 0x2, 0x2, 0x2, 
+    0x393, 0x395, 0x8, 0x38, 0x1, 0x2, 0x394, 0x367, 0x3, 0x2, 0x2, 0x2, 
+    0x394, 0x37f, 0x3, 0x2, 0x2, 0x2, 0x395, 0x6f, 0x3, 0x2, 0x2, 0x2, 0x396, 
+    0x398, 0x5, 0x72, 0x3a, 0x2, 0x397, 0x399, 0x7, 0x79, 0x2, 0x2, 0x398, 
+    0x397, 0x3, 0x2, 0x2, 0x2, 0x398, 0x399, 0x3, 0x2, 0x2, 0x2, 0x399, 
+    0x39a, 0x3, 0x2, 0x2, 0x2, 0x39a, 0x39b, 0x5, 0x6e, 0x38, 0x2, 0x39b, 
+    0x71, 0x3, 0x2, 0x2, 0x2, 0x39c, 0x39e, 0x5, 0xde, 0x70, 0x2, 0x39d, 
+    0x39f, 0x7, 0x79, 0x2, 0x2, 0x39e, 0x39d, 0x3, 0x2, 0x2, 0x2, 0x39e, 
+    0x39f, 0x3, 0x2, 0x2, 0x2, 0x39f, 0x3a0, 0x3, 0x2, 0x2, 0x2, 0x3a0, 
+    0x3a2, 0x5, 0xe2, 0x72, 0x2, 0x3a1, 0x3a3, 0x7, 0x79, 0x2, 0x2, 0x3a2, 
+    0x3a1, 0x3, 0x2, 0x2, 0x2, 0x3a2, 0x3a3, 0x3, 0x2, 0x2, 0x2, 0x3a3, 
+    0x3a5, 0x3, 0x2, 0x2, 0x2, 0x3a4, 0x3a6, 0x5, 0x74, 0x3b, 0x2, 0x3a5, 
+    0x3a4, 0x3, 0x2, 0x2, 0x2, 0x3a5, 0x3a6, 0x3, 0x2, 0x2, 0x2, 0x3a6, 
+    0x3a8, 0x3, 0x2, 0x2, 0x2, 0x3a7, 0x3a9, 0x7, 0x79, 0x2, 0x2, 0x3a8, 
+    0x3a7, 0x3, 0x2, 0x2, 0x2, 0x3a8, 0x3a9, 0x3, 0x2, 0x2, 0x2, 0x3a9, 
+    0x3aa, 0x3, 0x2, 0x2, 0x2, 0x3aa, 0x3ab, 0x5, 0xe2, 0x72, 0x2, 0x3ab, 
+    0x3bd, 0x3, 0x2, 0x2, 0x2, 0x3ac, 0x3ae, 0x5, 0xe2, 0x72, 0x2, 0x3ad, 
+    0x3af, 0x7, 0x79, 0x2, 0x2, 0x3ae, 0x3ad, 0x3, 0x2, 0x2, 0x2, 0x3ae, 
+    0x3af, 0x3, 0x2, 0x2, 0x2, 0x3af, 0x3b1, 0x3, 0x2, 0x2, 0x2, 0x3b0, 
+    0x3b2, 0x5, 0x74, 0x3b, 0x2, 0x3b1, 0x3b0, 0x3, 0x2, 0x2, 0x2, 0x3b1, 
+    0x3b2, 0x3, 0x2, 0x2, 0x2, 0x3b2, 0x3b4, 0x3, 0x2, 0x2, 0x2, 0x3b3, 
+    0x3b5, 0x7, 0x79, 0x2, 0x2, 0x3b4, 0x3b3, 0x3, 0x2, 0x2, 0x2, 0x3b4, 
+    0x3b5, 0x3, 0x2, 0x2, 0x2, 0x3b5, 0x3b6, 0x3, 0x2, 0x2, 0x2, 0x3b6, 
+    0x3b8, 0x5, 0xe2, 0x72, 0x2, 0x3b7, 0x3b9, 0x7, 0x79, 0x2, 0x2, 0x3b8, 
+    0x3b7, 0x3, 0x2, 0x2, 0x2, 0x3b8, 0x3b9, 0x3, 0x2, 0x2, 0x2, 0x3b9, 
+    0x3ba, 0x3, 0x2, 0x2, 0x2, 0x3ba, 0x3bb, 0x5, 0xe0, 0x71, 0x2, 0x3bb, 
+    0x3bd, 0x3, 0x2, 0x2, 0x2, 0x3bc, 0x39c, 0x3, 0x2, 0x2, 0x2, 0x3bc, 
+    0x3ac, 0x3, 0x2, 0x2, 0x2, 0x3bd, 0x73, 0x3, 0x2, 0x2, 0x2, 0x3be, 0x3c0, 
+    0x7, 0x6, 0x2, 0x2, 0x3bf, 0x3c1, 0x7, 0x79, 0x2, 0x2, 0x3c0, 0x3bf, 0x3, 
+    0x2, 0x2, 0x2, 0x3c0, 0x3c1, 0x3, 0x2, 0x2, 0x2, 0x3c1, 0x3c6, 0x3, 0x2, 
+    0x2, 0x2, 0x3c2, 0x3c4, 0x5, 0xcc, 0x67, 0x2, 0x3c3, 0x3c5, 0x7, 0x79, 
+    0x2, 0x2, 0x3c4, 0x3c3, 0x3, 0x2, 0x2, 0x2, 0x3c4, 0x3c5, 0x3, 0x2, 0x2, 
+    0x2, 0x3c5, 0x3c7, 0x3, 0x2, 0x2, 0x2, 0x3c6, 0x3c2, 0x3, 0x2, 0x2, 0x2, 
+    0x3c6, 0x3c7, 0x3, 0x2, 0x2, 0x2, 0x3c7, 0x3cc, 0x3, 0x2, 0x2, 0x2, 
+    0x3c8, 0x3ca, 0x5, 0x78, 0x3d, 0x2, 0x3c9, 0x3cb, 0x7, 0x79, 0x2, 0x2, 
+    0x3ca, 0x3c9, 0x3, 0x2, 0x2, 0x2, 0x3ca, 0x3cb, 0x3, 0x2, 0x2, 0x2, 
+    0x3cb, 0x3cd, 0x3, 0x2, 0x2, 0x2, 0x3cc, 0x3c8, 0x3, 0x2, 0x2, 0x2, 
+    0x3cc, 0x3cd, 0x3, 0x2, 0x2, 0x2, 0x3cd, 0x3d2, 0x3, 0x2, 0x2, 0x2, 
+    0x3ce, 0x3d0, 0x5, 0x7e, 0x40, 0x2, 0x3cf, 0x3d1, 0x7, 0x79, 0x2, 0x2, 
+    0x3d0, 0x3cf, 0x3, 0x2, 0x2, 0x2, 0x3d0, 0x3d1, 0x3, 0x2, 0x2, 0x2, 
+    0x3d1, 0x3d3, 0x3, 0x2, 0x2, 0x2, 0x3d2, 0x3ce, 0x3, 0x2, 0x2, 0x2, 
+    0x3d2, 0x3d3, 0x3, 0x2, 0x2, 0x2, 0x3d3, 0x3d8, 0x3, 0x2, 0x2, 0x2, 
+    0x3d4, 0x3d6, 0x5, 0x76, 0x3c, 0x2, 0x3d5, 0x3d7, 0x7, 0x79, 0x2, 0x2, 
+    0x3d6, 0x3d5, 0x3, 0x2, 0x2, 0x2, 0x3d6, 0x3d7, 0x3, 0x2, 0x2, 0x2, 
+    0x3d7, 0x3d9, 0x3, 0x2, 0x2, 0x2, 0x3d8, 0x3d4, 0x3, 0x2, 0x2, 0x2, 
+    0x3d8, 0x3d9, 0x3, 0x2, 0x2, 0x2, 0x3d9, 0x3da, 0x3, 0x2, 0x2, 0x2, 
+    0x3da, 0x3db, 0x7, 0x8, 0x2, 0x2, 0x3db, 0x75, 0x3, 0x2, 0x2, 0x2, 0x3dc, 
+    0x3de, 0x7, 0xa, 0x2, 0x2, 0x3dd, 0x3df, 0x7, 0x79, 0x2, 0x2, 0x3de, 
+    0x3dd, 0x3, 0x2, 0x2, 0x2, 0x3de, 0x3df, 0x3, 0x2, 0x2, 0x2, 0x3df, 
+    0x401, 0x3, 0x2, 0x2, 0x2, 0x3e0, 0x3e2, 0x5, 0xd4, 0x6b, 0x2, 0x3e1, 
+    0x3e3, 0x7, 0x79, 0x2, 0x2, 0x3e2, 0x3e1, 0x3, 0x2, 0x2, 0x2, 0x3e2, 
+    0x3e3, 0x3, 0x2, 0x2, 0x2, 0x3e3, 0x3e4, 0x3, 0x2, 0x2, 0x2, 0x3e4, 
+    0x3e6, 0x7, 0xb, 0x2, 0x2, 0x3e5, 0x3e7, 0x7, 0x79, 0x2, 0x2, 0x3e6, 
+    0x3e5, 0x3, 0x2, 0x2, 0x2, 0x3e6, 0x3e7, 0x3, 0x2, 0x2, 0x2, 0x3e7, 
+    0x3e8, 0x3, 0x2, 0x2, 0x2, 0x3e8, 0x3ea, 0x5, 0x84, 0x43, 0x2, 0x3e9, 
+    0x3eb, 0x7, 0x79, 0x2, 0x2, 0x3ea, 0x3e9, 0x3, 0x2, 0x2, 0x2, 0x3ea, 
+    0x3eb, 0x3, 0x2, 0x2, 0x2, 0x3eb, 0x3fe, 0x3, 0x2, 0x2, 0x2, 0x3ec, 
+    0x3ee, 0x7, 0x7, 0x2, 0x2, 0x3ed, 0x3ef, 0x7, 0x79, 0x2, 0x2, 0x3ee, 
+    0x3ed, 0x3, 0x2, 0x2, 0x2, 0x3ee, 0x3ef, 0x3, 0x2, 0x2, 0x2, 0x3ef, 
+    0x3f0, 0x3, 0x2, 0x2, 0x2, 0x3f0, 0x3f2, 0x5, 0xd4, 0x6b, 0x2, 0x3f1, 
+    0x3f3, 0x7, 0x79, 0x2, 0x2, 0x3f2, 0x3f1, 0x3, 0x2, 0x2, 0x2, 0x3f2, 
+    0x3f3, 0x3, 0x2, 0x2, 0x2, 0x3f3, 0x3f4, 0x3, 0x2, 0x2, 0x2, 0x3f4, 
+    0x3f6, 0x7, 0xb, 0x2, 0x2, 0x3f5, 0x3f7, 0x7, 0x79, 0x2, 0x2, 0x3f6, 
+    0x3f5, 0x3, 0x2, 0x2, 0x2, 0x3f6, 0x3f7, 0x3, 0x2, 0x2, 0x2, 0x3f7, 
+    0x3f8, 0x3, 0x2, 0x2, 0x2, 0x3f8, 0x3fa, 0x5, 0x84, 0x43, 0x2, 0x3f9, 
+    0x3fb, 0x7, 0x79, 0x2, 0x2, 0x3fa, 0x3f9, 0x3, 0x2, 0x2, 0x2, 0x3fa, 
+    0x3fb, 0x3, 0x2, 0x2, 0x2, 0x3fb, 0x3fd, 0x3, 0x2, 0x2, 0x2, 0x3fc, 
+    0x3ec, 0x3, 0x2, 0x2, 0x2, 0x3fd, 0x400, 0x3, 0x2, 0x2, 0x2, 0x3fe, 
+    0x3fc, 0x3, 0x2, 0x2, 0x2, 0x3fe, 0x3ff, 0x3, 0x2, 0x2, 0x2, 0x3ff, 
+    0x402, 0x3, 0x2, 0x2, 0x2, 0x400, 0x3fe, 0x3, 0x2, 0x2, 0x2, 0x401, 
+    0x3e0, 0x3, 0x2, 0x2, 0x2, 0x401, 0x402, 0x3, 0x2, 0x2, 0x2, 0x402, 
+    0x403, 0x3, 0x2, 0x2, 0x2, 0x403, 0x404, 0x7, 0xc, 0x2, 0x2, 0x404, 0x77, 
+    0x3, 0x2, 0x2, 0x2, 0x405, 0x407, 0x7, 0xb, 0x2, 0x2, 0x406, 0x408, 0x7, 
+    0x79, 0x2, 0x2, 0x407, 0x406, 0x3, 0x2, 0x2, 0x2, 0x407, 0x408, 0x3, 0x2, 
     0x2, 0x2, 0x408, 0x409, 0x3, 0x2, 0x2, 0x2, 0x409, 0x417, 0x5, 0x82, 
     0x42, 0x2, 0x40a, 0x40c, 0x7, 0x79, 0x2, 0x2, 0x40b, 0x40a, 0x3, 0x2, 
-    0x2, 0x2, 0x40b, 0x40c, 0x3, 0x2, 0x2, 0x2, 0x40c, 0x40d, 0x3, 0x2, 
-    0x2, 0x2, 0x40d, 0x40f, 0x7, 0xd, 0x2, 0x2, 0x40e, 0x410, 0x7, 0xb, 
-    0x2, 0x2, 0x40f, 0x40e, 0x3, 0x2, 0x2, 0x2, 0x40f, 0x410, 0x3, 0x2, 
-    0x2, 0x2, 0x410, 0x412, 0x3, 0x2, 0x2, 0x2, 0x411, 0x413, 0x7, 0x79, 
-    0x2, 0x2, 0x412, 0x411, 0x3, 0x2, 0x2, 0x2, 0x412, 0x413, 0x3, 0x2, 
-    0x2, 0x2, 0x413, 0x414, 0x3, 0x2, 0x2, 0x2, 0x414, 0x416, 0x5, 0x82, 
-    0x42, 0x2, 0x415, 0x40b, 0x3, 0x2, 0x2, 0x2, 0x416, 0x419, 0x3, 0x2, 
-    0x2, 0x2, 0x417, 0x415, 0x3, 0x2, 0x2, 0x2, 0x417, 0x418, 0x3, 0x2, 
-    0x2, 0x2, 0x418, 0x79, 0x3, 0x2, 0x2, 0x2, 0x419, 0x417, 0x3, 0x2, 0x2, 
-    0x2, 0x41a, 0x421, 0x5, 0x7c, 0x3f, 0x2, 0x41b, 0x41d, 0x7, 0x79, 0x2, 
-    0x2, 0x41c, 0x41b, 0x3, 0x2, 0x2, 0x2, 0x41c, 0x41d, 0x3, 0x2, 0x2, 
-    0x2, 0x41d, 0x41e, 0x3, 0x2, 0x2, 0x2, 0x41e, 0x420, 0x5, 0x7c, 0x3f, 
-    0x2, 0x41f, 0x41c, 0x3, 0x2, 0x2, 0x2, 0x420, 0x423, 0x3, 0x2, 0x2, 
-    0x2, 0x421, 0x41f, 0x3, 0x2, 0x2, 0x2, 0x421, 0x422, 0x3, 0x2, 0x2, 
-    0x2, 0x422, 0x7b, 0x3, 0x2, 0x2, 0x2, 0x423, 0x421, 0x3, 0x2, 0x2, 0x2, 
-    0x424, 0x426, 0x7, 0xb, 0x2, 0x2, 0x425, 0x427, 0x7, 0x79, 0x2, 0x2, 
-    0x426, 0x425, 0x3, 0x2, 0x2, 0x2, 0x426, 0x427, 0x3, 0x2, 0x2, 0x2, 
-    0x427, 0x428, 0x3, 0x2, 0x2, 0x2, 0x428, 0x429, 0x5, 0x80, 0x41, 0x2, 
-    0x429, 0x7d, 0x3, 0x2, 0x2, 0x2, 0x42a, 0x42c, 0x7, 0x4c, 0x2, 0x2, 
-    0x42b, 0x42d, 0x7, 0x79, 0x2, 0x2, 0x42c, 0x42b, 0x3, 0x2, 0x2, 0x2, 
-    0x42c, 0x42d, 0x3, 0x2, 0x2, 0x2, 0x42d, 0x42e, 0x3, 0x2, 0x2, 0x2, 
-    0x42e, 0x430, 0x5, 0xd6, 0x6c, 0x2, 0x42f, 0x431, 0x7, 0x79, 0x2, 0x2, 
-    0x430, 0x42f, 0x3, 0x2, 0x2, 0x2, 0x430, 0x431, 0x3, 0x2, 0x2, 0x2, 
-    0x431, 0x432, 0x3, 0x2, 0x2, 0x2, 0x432, 0x434, 0x7, 0xe, 0x2, 0x2, 
-    0x433, 0x435, 0x7, 0x79, 0x2, 0x2, 0x434, 0x433, 0x3, 0x2, 0x2, 0x2, 
-    0x434, 0x435, 0x3, 0x2, 0x2, 0x2, 0x435, 0x436, 0x3, 0x2, 0x2, 0x2, 
-    0x436, 0x437, 0x5, 0xd6, 0x6c, 0x2, 0x437, 0x7f, 0x3, 0x2, 0x2, 0x2, 
-    0x438, 0x439, 0x5, 0xda, 0x6e, 0x2, 0x439, 0x81, 0x3, 0x2, 0x2, 0x2, 
-    0x43a, 0x43b, 0x5, 0xda, 0x6e, 0x2, 0x43b, 0x83, 0x3, 0x2, 0x2, 0x2, 
-    0x43c, 0x43d, 0x5, 0x86, 0x44, 0x2, 0x43d, 0x85, 0x3, 0x2, 0x2, 0x2, 
-    0x43e, 0x445, 0x5, 0x88, 0x45, 0x2, 0x43f, 0x440, 0x7, 0x79, 0x2, 0x2, 
-    0x440, 0x441, 0x7, 0x57, 0x2, 0x2, 0x441, 0x442, 0x7, 0x79, 0x2, 0x2, 
-    0x442, 0x444, 0x5, 0x88, 0x45, 0x2, 0x443, 0x43f, 0x3, 0x2, 0x2, 0x2, 
-    0x444, 0x447, 0x3, 0x2, 0x2, 0x2, 0x445, 0x443, 0x3, 0x2, 0x2, 0x2, 
-    0x445, 0x446, 0x3, 0x2, 0x2, 0x2, 0x446, 0x87, 0x3, 0x2, 0x2, 0x2, 0x447, 
-    0x445, 0x3, 0x2, 0x2, 0x2, 0x448, 0x44f, 0x5, 0x8a, 0x46, 0x2, 0x449, 
-    0x44a, 0x7, 0x79, 0x2, 0x2, 0x44a, 0x44b, 0x7, 0x58, 0x2, 0x2, 0x44b, 
-    0x44c, 0x7, 0x79, 0x2, 0x2, 0x44c, 0x44e, 0x5, 0x8a, 0x46, 0x2, 0x44d, 
-    0x449, 0x3, 0x2, 0x2, 0x2, 0x44e, 0x451, 0x3, 0x2, 0x2, 0x2, 0x44f, 
-    0x44d, 0x3, 0x2, 0x2, 0x2, 0x44f, 0x450, 0x3, 0x2, 0x2, 0x2, 0x450, 
-    0x89, 0x3, 0x2, 0x2, 0x2, 0x451, 0x44f, 0x3, 0x2, 0x2, 0x2, 0x452, 0x459, 
-    0x5, 0x8c, 0x47, 0x2, 0x453, 0x454, 0x7, 0x79, 0x2, 0x2, 0x454, 0x455, 
-    0x7, 0x59, 0x2, 0x2, 0x455, 0x456, 0x7, 0x79, 0x2, 0x2, 0x456, 0x458, 
-    0x5, 0x8c, 0x47, 0x2, 0x457, 0x453, 0x3, 0x2, 0x2, 0x2, 0x458, 0x45b, 
-    0x3, 0x2, 0x2, 0x2, 0x459, 0x457, 0x3, 0x2, 0x2, 0x2, 0x459, 0x45a, 
-    0x3, 0x2, 0x2, 0x2, 0x45a, 0x8b, 0x3, 0x2, 0x2, 0x2, 0x45b, 0x459, 0x3, 
-    0x2, 0x2, 0x2, 0x45c, 0x45e, 0x7, 0x5a, 0x2, 0x2, 0x45d, 0x45f, 0x7, 
-    0x79, 0x2, 0x2, 0x45e, 0x45d, 0x3, 0x2, 0x2, 0x2, 0x45e, 0x45f, 0x3, 
-    0x2, 0x2, 0x2, 0x45f, 0x461, 0x3, 0x2, 0x2, 0x2, 0x460, 0x45c, 0x3, 
-    0x2, 0x2, 0x2, 0x460, 0x461, 0x3, 0x2, 0x2, 0x2, 0x461, 0x462, 0x3, 
-    0x2, 0x2, 0x2, 0x462, 0x463, 0x5, 0x8e, 0x48, 0x2, 0x463, 0x8d, 0x3, 
-    0x2, 0x2, 0x2, 0x464, 0x46e, 0x5, 0x92, 0x4a, 0x2, 0x465, 0x467, 0x7, 
-    0x79, 0x2, 0x2, 0x466, 0x465, 0x3, 0x2, 0x2, 0x2, 0x466, 0x467, 0x3, 
-    0x2, 0x2, 0x2, 0x467, 0x468, 0x3, 0x2, 0x2, 0x2, 0x468, 0x46a, 0x5, 
-    0x90, 0x49, 0x2, 0x469, 0x46b, 0x7, 0x79, 0x2, 0x2, 0x46a, 0x469, 0x3, 
-    0x2, 0x2, 0x2, 0x46a, 0x46b, 0x3, 0x2, 0x2, 0x2, 0x46b, 0x46c, 0x3, 
-    0x2, 0x2, 0x2, 0x46c, 0x46d, 0x5, 0x92, 0x4a, 0x2, 0x46d, 0x46f, 0x3, 
-    0x2, 0x2, 0x2, 0x46e, 0x466, 0x3, 0x2, 0x2, 0x2, 0x46e, 0x46f, 0x3, 
-    0x2, 0x2, 0x2, 0x46f, 0x495, 0x3, 0x2, 0x2, 0x2, 0x470, 0x472, 0x5, 
-    0x92, 0x4a, 0x2, 0x471, 0x473, 0x7, 0x79, 0x2, 0x2, 0x472, 0x471, 0x3, 
-    0x2, 0x2, 0x2, 0x472, 0x473, 0x3, 0x2, 0x2, 0x2, 0x473, 0x474, 0x3, 
-    0x2, 0x2, 0x2, 0x474, 0x476, 0x7, 0x5b, 0x2, 0x2, 0x475, 0x477, 0x7, 
-    0x79, 0x2, 0x2, 0x476, 0x475, 0x3, 0x2, 0x2, 0x2, 0x476, 0x477, 0x3, 
-    0x2, 0x2, 0x2, 0x477, 0x478, 0x3, 0x2, 0x2, 0x2, 0x478, 0x479, 0x5, 
-    0x92, 0x4a, 0x2, 0x479, 0x47a, 0x3, 0x2, 0x2, 0x2, 0x47a, 0x47b, 0x8, 
-    0x48, 0x1, 0x2, 0x47b, 0x495, 0x3, 0x2, 0x2, 0x2, 0x47c, 0x47e, 0x5, 
-    0x92, 0x4a, 0x2, 0x47d, 0x47f, 0x7, 0x79, 0x2, 0x2, 0x47e, 0x47d, 0x3, 
-    0x2, 0x2, 0x2, 0x47e, 0x47f, 0x3, 0x2, 0x2, 0x2, 0x47f, 0x480, 0x3, 
-    0x2, 0x2, 0x2, 0x480, 0x482, 0x5, 0x90, 0x49, 0x2, 0x481, 0x483, 0x7, 
-    0x79, 0x2, 0x2, 0x482, 0x481, 0x3, 0x2, 0x2, 0x2, 0x482, 0x483, 0x3, 
-    0x2, 0x2, 0x2, 0x483, 0x484, 0x3, 0x2, 0x2, 0x2, 0x484, 0x48e, 0x5, 
-    0x92, 0x4a, 0x2, 0x485, 0x487, 0x7, 0x79, 0x2, 0x2, 0x486, 0x485, 0x3, 
-    0x2, 0x2, 0x2, 0x486, 0x487, 0x3, 0x2, 0x2, 0x2, 0x487, 0x488, 0x3, 
-    0x2, 0x2, 0x2, 0x488, 0x48a, 0x5, 0x90, 0x49, 0x2, 0x489, 0x48b, 0x7, 
-    0x79, 0x2, 0x2, 0x48a, 0x489, 0x3, 0x2, 0x2, 0x2, 0x48a, 0x48b, 0x3, 
-    0x2, 0x2, 0x2, 0x48b, 0x48c, 0x3, 0x2, 0x2, 0x2, 0x48c, 0x48d, 0x5, 
-    0x92, 0x4a, 0x2, 0x48d, 0x48f, 0x3, 0x2, 0x2, 0x2, 0x48e, 0x486, 0x3, 
-    0x2, 0x2, 0x2, 0x48f, 0x490, 0x3, 0x2, 0x2, 0x2, 0x490, 0x48e, 0x3, 
-    0x2, 0x2, 0x2, 0x490, 0x491, 0x3, 0x2, 0x2, 0x2, 0x491, 0x492, 0x3, 
-    0x2, 0x2, 0x2, 0x492, 0x493, 0x8, 0x48, 0x1, 0x2, 0x493, 0x495, 0x3, 
-    0x2, 0x2, 0x2, 0x494, 0x464, 0x3, 0x2, 0x2, 0x2, 0x494, 0x470, 0x3, 
-    0x2, 0x2, 0x2, 0x494, 0x47c, 0x3, 0x2, 0x2, 0x2, 0x495, 0x8f, 0x3, 0x2, 
-    0x2, 0x2, 0x496, 0x497, 0x9, 0x3, 0x2, 0x2, 0x497, 0x91, 0x3, 0x2, 0x2, 
-    0x2, 0x498, 0x4a3, 0x5, 0x94, 0x4b, 0x2, 0x499, 0x49b, 0x7, 0x79, 0x2, 
-    0x2, 0x49a, 0x499, 0x3, 0x2, 0x2, 0x2, 0x49a, 0x49b, 0x3, 0x2, 0x2, 
-    0x2, 0x49b, 0x49c, 0x3, 0x2, 0x2, 0x2, 0x49c, 0x49e, 0x7, 0xd, 0x2, 
-    0x2, 0x49d, 0x49f, 0x7, 0x79, 0x2, 0x2, 0x49e, 0x49d, 0x3, 0x2, 0x2, 
-    0x2, 0x49e, 0x49f, 0x3, 0x2, 0x2, 0x2, 0x49f, 0x4a0, 0x3, 0x2, 0x2, 
-    0x2, 0x4a0, 0x4a2, 0x5, 0x94, 0x4b, 0x2, 0x4a1, 0x49a, 0x3, 0x2, 0x2, 
-    0x2, 0x4a2, 0x4a5, 0x3, 0x2, 0x2, 0x2, 0x4a3, 0x4a1, 0x3, 0x2, 0x2, 
-    0x2, 0x4a3, 0x4a4, 0x3, 0x2, 0x2, 0x2, 0x4a4, 0x93, 0x3, 0x2, 0x2, 0x2, 
-    0x4a5, 0x4a3, 0x3, 0x2, 0x2, 0x2, 0x4a6, 0x4b1, 0x5, 0x96, 0x4c, 0x2, 
-    0x4a7, 0x4a9, 0x7, 0x79, 0x2, 0x2, 0x4a8, 0x4a7, 0x3, 0x2, 0x2, 0x2, 
-    0x4a8, 0x4a9, 0x3, 0x2, 0x2, 0x2, 0x4a9, 0x4aa, 0x3, 0x2, 0x2, 0x2, 
-    0x4aa, 0x4ac, 0x7, 0x14, 0x2, 0x2, 0x4ab, 0x4ad, 0x7, 0x79, 0x2, 0x2, 
-    0x4ac, 0x4ab, 0x3, 0x2, 0x2, 0x2, 0x4ac, 0x4ad, 0x3, 0x2, 0x2, 0x2, 
-    0x4ad, 0x4ae, 0x3, 0x2, 0x2, 0x2, 0x4ae, 0x4b0, 0x5, 0x96, 0x4c, 0x2, 
-    0x4af, 0x4a8, 0x3, 0x2, 0x2, 0x2, 0x4b0, 0x4b3, 0x3, 0x2, 0x2, 0x2, 
+    0x2, 0x2, 0x40b, 0x40c, 0x3, 0x2, 0x2, 0x2, 0x40c, 0x40d, 0x3, 0x2, 0x2, 
+    0x2, 0x40d, 0x40f, 0x7, 0xd, 0x2, 0x2, 0x40e, 0x410, 0x7, 0xb, 0x2, 0x2, 
+    0x40f, 0x40e, 0x3, 0x2, 0x2, 0x2, 0x40f, 0x410, 0x3, 0x2, 0x2, 0x2, 
+    0x410, 0x412, 0x3, 0x2, 0x2, 0x2, 0x411, 0x413, 0x7, 0x79, 0x2, 0x2, 
+    0x412, 0x411, 0x3, 0x2, 0x2, 0x2, 0x412, 0x413, 0x3, 0x2, 0x2, 0x2, 
+    0x413, 0x414, 0x3, 0x2, 0x2, 0x2, 0x414, 0x416, 0x5, 0x82, 0x42, 0x2, 
+    0x415, 0x40b, 0x3, 0x2, 0x2, 0x2, 0x416, 0x419, 0x3, 0x2, 0x2, 0x2, 
+    0x417, 0x415, 0x3, 0x2, 0x2, 0x2, 0x417, 0x418, 0x3, 0x2, 0x2, 0x2, 
+    0x418, 0x79, 0x3, 0x2, 0x2, 0x2, 0x419, 0x417, 0x3, 0x2, 0x2, 0x2, 0x41a, 
+    0x421, 0x5, 0x7c, 0x3f, 0x2, 0x41b, 0x41d, 0x7, 0x79, 0x2, 0x2, 0x41c, 
+    0x41b, 0x3, 0x2, 0x2, 0x2, 0x41c, 0x41d, 0x3, 0x2, 0x2, 0x2, 0x41d, 
+    0x41e, 0x3, 0x2, 0x2, 0x2, 0x41e, 0x420, 0x5, 0x7c, 0x3f, 0x2, 0x41f, 
+    0x41c, 0x3, 0x2, 0x2, 0x2, 0x420, 0x423, 0x3, 0x2, 0x2, 0x2, 0x421, 
+    0x41f, 0x3, 0x2, 0x2, 0x2, 0x421, 0x422, 0x3, 0x2, 0x2, 0x2, 0x422, 0x7b, 
+    0x3, 0x2, 0x2, 0x2, 0x423, 0x421, 0x3, 0x2, 0x2, 0x2, 0x424, 0x426, 0x7, 
+    0xb, 0x2, 0x2, 0x425, 0x427, 0x7, 0x79, 0x2, 0x2, 0x426, 0x425, 0x3, 0x2, 
+    0x2, 0x2, 0x426, 0x427, 0x3, 0x2, 0x2, 0x2, 0x427, 0x428, 0x3, 0x2, 0x2, 
+    0x2, 0x428, 0x429, 0x5, 0x80, 0x41, 0x2, 0x429, 0x7d, 0x3, 0x2, 0x2, 0x2, 
+    0x42a, 0x42c, 0x7, 0x4c, 0x2, 0x2, 0x42b, 0x42d, 0x7, 0x79, 0x2, 0x2, 
+    0x42c, 0x42b, 0x3, 0x2, 0x2, 0x2, 0x42c, 0x42d, 0x3, 0x2, 0x2, 0x2, 
+    0x42d, 0x42e, 0x3, 0x2, 0x2, 0x2, 0x42e, 0x430, 0x5, 0xd6, 0x6c, 0x2, 
+    0x42f, 0x431, 0x7, 0x79, 0x2, 0x2, 0x430, 0x42f, 0x3, 0x2, 0x2, 0x2, 
+    0x430, 0x431, 0x3, 0x2, 0x2, 0x2, 0x431, 0x432, 0x3, 0x2, 0x2, 0x2, 
+    0x432, 0x434, 0x7, 0xe, 0x2, 0x2, 0x433, 0x435, 0x7, 0x79, 0x2, 0x2, 
+    0x434, 0x433, 0x3, 0x2, 0x2, 0x2, 0x434, 0x435, 0x3, 0x2, 0x2, 0x2, 
+    0x435, 0x436, 0x3, 0x2, 0x2, 0x2, 0x436, 0x437, 0x5, 0xd6, 0x6c, 0x2, 
+    0x437, 0x7f, 0x3, 0x2, 0x2, 0x2, 0x438, 0x439, 0x5, 0xda, 0x6e, 0x2, 
+    0x439, 0x81, 0x3, 0x2, 0x2, 0x2, 0x43a, 0x43b, 0x5, 0xda, 0x6e, 0x2, 
+    0x43b, 0x83, 0x3, 0x2, 0x2, 0x2, 0x43c, 0x43d, 0x5, 0x86, 0x44, 0x2, 
+    0x43d, 0x85, 0x3, 0x2, 0x2, 0x2, 0x43e, 0x445, 0x5, 0x88, 0x45, 0x2, 
+    0x43f, 0x440, 0x7, 0x79, 0x2, 0x2, 0x440, 0x441, 0x7, 0x57, 0x2, 0x2, 
+    0x441, 0x442, 0x7, 0x79, 0x2, 0x2, 0x442, 0x444, 0x5, 0x88, 0x45, 0x2, 
+    0x443, 0x43f, 0x3, 0x2, 0x2, 0x2, 0x444, 0x447, 0x3, 0x2, 0x2, 0x2, 
+    0x445, 0x443, 0x3, 0x2, 0x2, 0x2, 0x445, 0x446, 0x3, 0x2, 0x2, 0x2, 
+    0x446, 0x87, 0x3, 0x2, 0x2, 0x2, 0x447, 0x445, 0x3, 0x2, 0x2, 0x2, 0x448, 
+    0x44f, 0x5, 0x8a, 0x46, 0x2, 0x449, 0x44a, 0x7, 0x79, 0x2, 0x2, 0x44a, 
+    0x44b, 0x7, 0x58, 0x2, 0x2, 0x44b, 0x44c, 0x7, 0x79, 0x2, 0x2, 0x44c, 
+    0x44e, 0x5, 0x8a, 0x46, 0x2, 0x44d, 0x449, 0x3, 0x2, 0x2, 0x2, 0x44e, 
+    0x451, 0x3, 0x2, 0x2, 0x2, 0x44f, 0x44d, 0x3, 0x2, 0x2, 0x2, 0x44f, 
+    0x450, 0x3, 0x2, 0x2, 0x2, 0x450, 0x89, 0x3, 0x2, 0x2, 0x2, 0x451, 0x44f, 
+    0x3, 0x2, 0x2, 0x2, 0x452, 0x459, 0x5, 0x8c, 0x47, 0x2, 0x453, 0x454, 
+    0x7, 0x79, 0x2, 0x2, 0x454, 0x455, 0x7, 0x59, 0x2, 0x2, 0x455, 0x456, 
+    0x7, 0x79, 0x2, 0x2, 0x456, 0x458, 0x5, 0x8c, 0x47, 0x2, 0x457, 0x453, 
+    0x3, 0x2, 0x2, 0x2, 0x458, 0x45b, 0x3, 0x2, 0x2, 0x2, 0x459, 0x457, 0x3, 
+    0x2, 0x2, 0x2, 0x459, 0x45a, 0x3, 0x2, 0x2, 0x2, 0x45a, 0x8b, 0x3, 0x2, 
+    0x2, 0x2, 0x45b, 0x459, 0x3, 0x2, 0x2, 0x2, 0x45c, 0x45e, 0x7, 0x5a, 0x2, 
+    0x2, 0x45d, 0x45f, 0x7, 0x79, 0x2, 0x2, 0x45e, 0x45d, 0x3, 0x2, 0x2, 0x2, 
+    0x45e, 0x45f, 0x3, 0x2, 0x2, 0x2, 0x45f, 0x461, 0x3, 0x2, 0x2, 0x2, 
+    0x460, 0x45c, 0x3, 0x2, 0x2, 0x2, 0x460, 0x461, 0x3, 0x2, 0x2, 0x2, 
+    0x461, 0x462, 0x3, 0x2, 0x2, 0x2, 0x462, 0x463, 0x5, 0x8e, 0x48, 0x2, 
+    0x463, 0x8d, 0x3, 0x2, 0x2, 0x2, 0x464, 0x46e, 0x5, 0x92, 0x4a, 0x2, 
+    0x465, 0x467, 0x7, 0x79, 0x2, 0x2, 0x466, 0x465, 0x3, 0x2, 0x2, 0x2, 
+    0x466, 0x467, 0x3, 0x2, 0x2, 0x2, 0x467, 0x468, 0x3, 0x2, 0x2, 0x2, 
+    0x468, 0x46a, 0x5, 0x90, 0x49, 0x2, 0x469, 0x46b, 0x7, 0x79, 0x2, 0x2, 
+    0x46a, 0x469, 0x3, 0x2, 0x2, 0x2, 0x46a, 0x46b, 0x3, 0x2, 0x2, 0x2, 
+    0x46b, 0x46c, 0x3, 0x2, 0x2, 0x2, 0x46c, 0x46d, 0x5, 0x92, 0x4a, 0x2, 
+    0x46d, 0x46f, 0x3, 0x2, 0x2, 0x2, 0x46e, 0x466, 0x3, 0x2, 0x2, 0x2, 
+    0x46e, 0x46f, 0x3, 0x2, 0x2, 0x2, 0x46f, 0x495, 0x3, 0x2, 0x2, 0x2, 
+    0x470, 0x472, 0x5, 0x92, 0x4a, 0x2, 0x471, 0x473, 0x7, 0x79, 0x2, 0x2, 
+    0x472, 0x471, 0x3, 0x2, 0x2, 0x2, 0x472, 0x473, 0x3, 0x2, 0x2, 0x2, 
+    0x473, 0x474, 0x3, 0x2, 0x2, 0x2, 0x474, 0x476, 0x7, 0x5b, 0x2, 0x2, 
+    0x475, 0x477, 0x7, 0x79, 0x2, 0x2, 0x476, 0x475, 0x3, 0x2, 0x2, 0x2, 
+    0x476, 0x477, 0x3, 0x2, 0x2, 0x2, 0x477, 0x478, 0x3, 0x2, 0x2, 0x2, 
+    0x478, 0x479, 0x5, 0x92, 0x4a, 0x2, 0x479, 0x47a, 0x3, 0x2, 0x2, 0x2, 
+    0x47a, 0x47b, 0x8, 0x48, 0x1, 0x2, 0x47b, 0x495, 0x3, 0x2, 0x2, 0x2, 
+    0x47c, 0x47e, 0x5, 0x92, 0x4a, 0x2, 0x47d, 0x47f, 0x7, 0x79, 0x2, 0x2, 
+    0x47e, 0x47d, 0x3, 0x2, 0x2, 0x2, 0x47e, 0x47f, 0x3, 0x2, 0x2, 0x2, 
+    0x47f, 0x480, 0x3, 0x2, 0x2, 0x2, 0x480, 0x482, 0x5, 0x90, 0x49, 0x2, 
+    0x481, 0x483, 0x7, 0x79, 0x2, 0x2, 0x482, 0x481, 0x3, 0x2, 0x2, 0x2, 
+    0x482, 0x483, 0x3, 0x2, 0x2, 0x2, 0x483, 0x484, 0x3, 0x2, 0x2, 0x2, 
+    0x484, 0x48e, 0x5, 0x92, 0x4a, 0x2, 0x485, 0x487, 0x7, 0x79, 0x2, 0x2, 
+    0x486, 0x485, 0x3, 0x2, 0x2, 0x2, 0x486, 0x487, 0x3, 0x2, 0x2, 0x2, 
+    0x487, 0x488, 0x3, 0x2, 0x2, 0x2, 0x488, 0x48a, 0x5, 0x90, 0x49, 0x2, 
+    0x489, 0x48b, 0x7, 0x79, 0x2, 0x2, 0x48a, 0x489, 0x3, 0x2, 0x2, 0x2, 
+    0x48a, 0x48b, 0x3, 0x2, 0x2, 0x2, 0x48b, 0x48c, 0x3, 0x2, 0x2, 0x2, 
+    0x48c, 0x48d, 0x5, 0x92, 0x4a, 0x2, 0x48d, 0x48f, 0x3, 0x2, 0x2, 0x2, 
+    0x48e, 0x486, 0x3, 0x2, 0x2, 0x2, 0x48f, 0x490, 0x3, 0x2, 0x2, 0x2, 
+    0x490, 0x48e, 0x3, 0x2, 0x2, 0x2, 0x490, 0x491, 0x3, 0x2, 0x2, 0x2, 
+    0x491, 0x492, 0x3, 0x2, 0x2, 0x2, 0x492, 0x493, 0x8, 0x48, 0x1, 0x2, 
+    0x493, 0x495, 0x3, 0x2, 0x2, 0x2, 0x494, 0x464, 0x3, 0x2, 0x2, 0x2, 
+    0x494, 0x470, 0x3, 0x2, 0x2, 0x2, 0x494, 0x47c, 0x3, 0x2, 0x2, 0x2, 
+    0x495, 0x8f, 0x3, 0x2, 0x2, 0x2, 0x496, 0x497, 0x9, 0x3, 0x2, 0x2, 0x497, 
+    0x91, 0x3, 0x2, 0x2, 0x2, 0x498, 0x4a3, 0x5, 0x94, 0x4b, 0x2, 0x499, 
+    0x49b, 0x7, 0x79, 0x2, 0x2, 0x49a, 0x499, 0x3, 0x2, 0x2, 0x2, 0x49a, 
+    0x49b, 0x3, 0x2, 0x2, 0x2, 0x49b, 0x49c, 0x3, 0x2, 0x2, 0x2, 0x49c, 
+    0x49e, 0x7, 0xd, 0x2, 0x2, 0x49d, 0x49f, 0x7, 0x79, 0x2, 0x2, 0x49e, 
+    0x49d, 0x3, 0x2, 0x2, 0x2, 0x49e, 0x49f, 0x3, 0x2, 0x2, 0x2, 0x49f, 
+    0x4a0, 0x3, 0x2, 0x2, 0x2, 0x4a0, 0x4a2, 0x5, 0x94, 0x4b, 0x2, 0x4a1, 
+    0x49a, 0x3, 0x2, 0x2, 0x2, 0x4a2, 0x4a5, 0x3, 0x2, 0x2, 0x2, 0x4a3, 
+    0x4a1, 0x3, 0x2, 0x2, 0x2, 0x4a3, 0x4a4, 0x3, 0x2, 0x2, 0x2, 0x4a4, 0x93, 
+    0x3, 0x2, 0x2, 0x2, 0x4a5, 0x4a3, 0x3, 0x2, 0x2, 0x2, 0x4a6, 0x4b1, 0x5, 
+    0x96, 0x4c, 0x2, 0x4a7, 0x4a9, 0x7, 0x79, 0x2, 0x2, 0x4a8, 0x4a7, 0x3, 
+    0x2, 0x2, 0x2, 0x4a8, 0x4a9, 0x3, 0x2, 0x2, 0x2, 0x4a9, 0x4aa, 0x3, 0x2, 
+    0x2, 0x2, 0x4aa, 0x4ac, 0x7, 0x14, 0x2, 0x2, 0x4ab, 0x4ad, 0x7, 0x79, 
+    0x2, 0x2, 0x4ac, 0x4ab, 0x3, 0x2, 0x2, 0x2, 0x4ac, 0x4ad, 0x3, 0x2, 0x2, 
+    0x2, 0x4ad, 0x4ae, 0x3, 0x2, 0x2, 0x2, 0x4ae, 0x4b0, 0x5, 0x96, 0x4c, 
+    0x2, 0x4af, 0x4a8, 0x3, 0x2, 0x2, 0x2, 0x4b0, 0x4b3, 0x3, 0x2, 0x2, 0x2, 
     0x4b1, 0x4af, 0x3, 0x2, 0x2, 0x2, 0x4b1, 0x4b2, 0x3, 0x2, 0x2, 0x2, 
     0x4b2, 0x95, 0x3, 0x2, 0x2, 0x2, 0x4b3, 0x4b1, 0x3, 0x2, 0x2, 0x2, 0x4b4, 
     0x4c0, 0x5, 0x9a, 0x4e, 0x2, 0x4b5, 0x4b7, 0x7, 0x79, 0x2, 0x2, 0x4b6, 
@@ -10806,259 +10922,269 @@ CypherParser::Initializer::Initializer() {
     0x4bb, 0x3, 0x2, 0x2, 0x2, 0x4bb, 0x4bc, 0x3, 0x2, 0x2, 0x2, 0x4bc, 
     0x4bd, 0x5, 0x9a, 0x4e, 0x2, 0x4bd, 0x4bf, 0x3, 0x2, 0x2, 0x2, 0x4be, 
     0x4b6, 0x3, 0x2, 0x2, 0x2, 0x4bf, 0x4c2, 0x3, 0x2, 0x2, 0x2, 0x4c0, 
-    0x4be, 0x3, 0x2, 0x2, 0x2, 0x4c0, 0x4c1, 0x3, 0x2, 0x2, 0x2, 0x4c1, 
-    0x97, 0x3, 0x2, 0x2, 0x2, 0x4c2, 0x4c0, 0x3, 0x2, 0x2, 0x2, 0x4c3, 0x4c4, 
-    0x9, 0x4, 0x2, 0x2, 0x4c4, 0x99, 0x3, 0x2, 0x2, 0x2, 0x4c5, 0x4d1, 0x5, 
-    0x9e, 0x50, 0x2, 0x4c6, 0x4c8, 0x7, 0x79, 0x2, 0x2, 0x4c7, 0x4c6, 0x3, 
-    0x2, 0x2, 0x2, 0x4c7, 0x4c8, 0x3, 0x2, 0x2, 0x2, 0x4c8, 0x4c9, 0x3, 
-    0x2, 0x2, 0x2, 0x4c9, 0x4cb, 0x5, 0x9c, 0x4f, 0x2, 0x4ca, 0x4cc, 0x7, 
-    0x79, 0x2, 0x2, 0x4cb, 0x4ca, 0x3, 0x2, 0x2, 0x2, 0x4cb, 0x4cc, 0x3, 
-    0x2, 0x2, 0x2, 0x4cc, 0x4cd, 0x3, 0x2, 0x2, 0x2, 0x4cd, 0x4ce, 0x5, 
-    0x9e, 0x50, 0x2, 0x4ce, 0x4d0, 0x3, 0x2, 0x2, 0x2, 0x4cf, 0x4c7, 0x3, 
-    0x2, 0x2, 0x2, 0x4d0, 0x4d3, 0x3, 0x2, 0x2, 0x2, 0x4d1, 0x4cf, 0x3, 
-    0x2, 0x2, 0x2, 0x4d1, 0x4d2, 0x3, 0x2, 0x2, 0x2, 0x4d2, 0x9b, 0x3, 0x2, 
-    0x2, 0x2, 0x4d3, 0x4d1, 0x3, 0x2, 0x2, 0x2, 0x4d4, 0x4d5, 0x9, 0x5, 
-    0x2, 0x2, 0x4d5, 0x9d, 0x3, 0x2, 0x2, 0x2, 0x4d6, 0x4e2, 0x5, 0xa2, 
-    0x52, 0x2, 0x4d7, 0x4d9, 0x7, 0x79, 0x2, 0x2, 0x4d8, 0x4d7, 0x3, 0x2, 
-    0x2, 0x2, 0x4d8, 0x4d9, 0x3, 0x2, 0x2, 0x2, 0x4d9, 0x4da, 0x3, 0x2, 
-    0x2, 0x2, 0x4da, 0x4dc, 0x5, 0xa0, 0x51, 0x2, 0x4db, 0x4dd, 0x7, 0x79, 
-    0x2, 0x2, 0x4dc, 0x4db, 0x3, 0x2, 0x2, 0x2, 0x4dc, 0x4dd, 0x3, 0x2, 
-    0x2, 0x2, 0x4dd, 0x4de, 0x3, 0x2, 0x2, 0x2, 0x4de, 0x4df, 0x5, 0xa2, 
-    0x52, 0x2, 0x4df, 0x4e1, 0x3, 0x2, 0x2, 0x2, 0x4e0, 0x4d8, 0x3, 0x2, 
-    0x2, 0x2, 0x4e1, 0x4e4, 0x3, 0x2, 0x2, 0x2, 0x4e2, 0x4e0, 0x3, 0x2, 
-    0x2, 0x2, 0x4e2, 0x4e3, 0x3, 0x2, 0x2, 0x2, 0x4e3, 0x9f, 0x3, 0x2, 0x2, 
-    0x2, 0x4e4, 0x4e2, 0x3, 0x2, 0x2, 0x2, 0x4e5, 0x4e6, 0x9, 0x6, 0x2, 
-    0x2, 0x4e6, 0xa1, 0x3, 0x2, 0x2, 0x2, 0x4e7, 0x4f2, 0x5, 0xa4, 0x53, 
-    0x2, 0x4e8, 0x4ea, 0x7, 0x79, 0x2, 0x2, 0x4e9, 0x4e8, 0x3, 0x2, 0x2, 
-    0x2, 0x4e9, 0x4ea, 0x3, 0x2, 0x2, 0x2, 0x4ea, 0x4eb, 0x3, 0x2, 0x2, 
-    0x2, 0x4eb, 0x4ed, 0x7, 0x1a, 0x2, 0x2, 0x4ec, 0x4ee, 0x7, 0x79, 0x2, 
-    0x2, 0x4ed, 0x4ec, 0x3, 0x2, 0x2, 0x2, 0x4ed, 0x4ee, 0x3, 0x2, 0x2, 
-    0x2, 0x4ee, 0x4ef, 0x3, 0x2, 0x2, 0x2, 0x4ef, 0x4f1, 0x5, 0xa4, 0x53, 
-    0x2, 0x4f0, 0x4e9, 0x3, 0x2, 0x2, 0x2, 0x4f1, 0x4f4, 0x3, 0x2, 0x2, 
-    0x2, 0x4f2, 0x4f0, 0x3, 0x2, 0x2, 0x2, 0x4f2, 0x4f3, 0x3, 0x2, 0x2, 
-    0x2, 0x4f3, 0xa3, 0x3, 0x2, 0x2, 0x2, 0x4f4, 0x4f2, 0x3, 0x2, 0x2, 0x2, 
-    0x4f5, 0x4f7, 0x7, 0x5c, 0x2, 0x2, 0x4f6, 0x4f8, 0x7, 0x79, 0x2, 0x2, 
-    0x4f7, 0x4f6, 0x3, 0x2, 0x2, 0x2, 0x4f7, 0x4f8, 0x3, 0x2, 0x2, 0x2, 
-    0x4f8, 0x4fa, 0x3, 0x2, 0x2, 0x2, 0x4f9, 0x4f5, 0x3, 0x2, 0x2, 0x2, 
-    0x4f9, 0x4fa, 0x3, 0x2, 0x2, 0x2, 0x4fa, 0x4fb, 0x3, 0x2, 0x2, 0x2, 
-    0x4fb, 0x500, 0x5, 0xa6, 0x54, 0x2, 0x4fc, 0x4fe, 0x7, 0x79, 0x2, 0x2, 
-    0x4fd, 0x4fc, 0x3, 0x2, 0x2, 0x2, 0x4fd, 0x4fe, 0x3, 0x2, 0x2, 0x2, 
-    0x4fe, 0x4ff, 0x3, 0x2, 0x2, 0x2, 0x4ff, 0x501, 0x7, 0x5d, 0x2, 0x2, 
-    0x500, 0x4fd, 0x3, 0x2, 0x2, 0x2, 0x500, 0x501, 0x3, 0x2, 0x2, 0x2, 
-    0x501, 0xa5, 0x3, 0x2, 0x2, 0x2, 0x502, 0x506, 0x5, 0xb4, 0x5b, 0x2, 
-    0x503, 0x507, 0x5, 0xae, 0x58, 0x2, 0x504, 0x507, 0x5, 0xa8, 0x55, 0x2, 
-    0x505, 0x507, 0x5, 0xb2, 0x5a, 0x2, 0x506, 0x503, 0x3, 0x2, 0x2, 0x2, 
-    0x506, 0x504, 0x3, 0x2, 0x2, 0x2, 0x506, 0x505, 0x3, 0x2, 0x2, 0x2, 
-    0x506, 0x507, 0x3, 0x2, 0x2, 0x2, 0x507, 0xa7, 0x3, 0x2, 0x2, 0x2, 0x508, 
-    0x50b, 0x5, 0xaa, 0x56, 0x2, 0x509, 0x50b, 0x5, 0xac, 0x57, 0x2, 0x50a, 
-    0x508, 0x3, 0x2, 0x2, 0x2, 0x50a, 0x509, 0x3, 0x2, 0x2, 0x2, 0x50b, 
-    0x50d, 0x3, 0x2, 0x2, 0x2, 0x50c, 0x50e, 0x5, 0xa8, 0x55, 0x2, 0x50d, 
-    0x50c, 0x3, 0x2, 0x2, 0x2, 0x50d, 0x50e, 0x3, 0x2, 0x2, 0x2, 0x50e, 
-    0xa9, 0x3, 0x2, 0x2, 0x2, 0x50f, 0x511, 0x7, 0x79, 0x2, 0x2, 0x510, 
-    0x50f, 0x3, 0x2, 0x2, 0x2, 0x510, 0x511, 0x3, 0x2, 0x2, 0x2, 0x511, 
-    0x512, 0x3, 0x2, 0x2, 0x2, 0x512, 0x513, 0x7, 0x6, 0x2, 0x2, 0x513, 
-    0x514, 0x5, 0x84, 0x43, 0x2, 0x514, 0x515, 0x7, 0x8, 0x2, 0x2, 0x515, 
-    0xab, 0x3, 0x2, 0x2, 0x2, 0x516, 0x518, 0x7, 0x79, 0x2, 0x2, 0x517, 
-    0x516, 0x3, 0x2, 0x2, 0x2, 0x517, 0x518, 0x3, 0x2, 0x2, 0x2, 0x518, 
-    0x519, 0x3, 0x2, 0x2, 0x2, 0x519, 0x51b, 0x7, 0x6, 0x2, 0x2, 0x51a, 
-    0x51c, 0x5, 0x84, 0x43, 0x2, 0x51b, 0x51a, 0x3, 0x2, 0x2, 0x2, 0x51b, 
-    0x51c, 0x3, 0x2, 0x2, 0x2, 0x51c, 0x51d, 0x3, 0x2, 0x2, 0x2, 0x51d, 
-    0x51f, 0x7, 0xb, 0x2, 0x2, 0x51e, 0x520, 0x5, 0x84, 0x43, 0x2, 0x51f, 
-    0x51e, 0x3, 0x2, 0x2, 0x2, 0x51f, 0x520, 0x3, 0x2, 0x2, 0x2, 0x520, 
-    0x521, 0x3, 0x2, 0x2, 0x2, 0x521, 0x522, 0x7, 0x8, 0x2, 0x2, 0x522, 
-    0xad, 0x3, 0x2, 0x2, 0x2, 0x523, 0x52f, 0x5, 0xb0, 0x59, 0x2, 0x524, 
-    0x525, 0x7, 0x79, 0x2, 0x2, 0x525, 0x526, 0x7, 0x5e, 0x2, 0x2, 0x526, 
-    0x527, 0x7, 0x79, 0x2, 0x2, 0x527, 0x52f, 0x7, 0x49, 0x2, 0x2, 0x528, 
-    0x529, 0x7, 0x79, 0x2, 0x2, 0x529, 0x52a, 0x7, 0x5f, 0x2, 0x2, 0x52a, 
-    0x52b, 0x7, 0x79, 0x2, 0x2, 0x52b, 0x52f, 0x7, 0x49, 0x2, 0x2, 0x52c, 
-    0x52d, 0x7, 0x79, 0x2, 0x2, 0x52d, 0x52f, 0x7, 0x60, 0x2, 0x2, 0x52e, 
-    0x523, 0x3, 0x2, 0x2, 0x2, 0x52e, 0x524, 0x3, 0x2, 0x2, 0x2, 0x52e, 
-    0x528, 0x3, 0x2, 0x2, 0x2, 0x52e, 0x52c, 0x3, 0x2, 0x2, 0x2, 0x52f, 
-    0x531, 0x3, 0x2, 0x2, 0x2, 0x530, 0x532, 0x7, 0x79, 0x2, 0x2, 0x531, 
-    0x530, 0x3, 0x2, 0x2, 0x2, 0x531, 0x532, 0x3, 0x2, 0x2, 0x2, 0x532, 
-    0x533, 0x3, 0x2, 0x2, 0x2, 0x533, 0x534, 0x5, 0xb4, 0x5b, 0x2, 0x534, 
-    0xaf, 0x3, 0x2, 0x2, 0x2, 0x535, 0x537, 0x7, 0x79, 0x2, 0x2, 0x536, 
-    0x535, 0x3, 0x2, 0x2, 0x2, 0x536, 0x537, 0x3, 0x2, 0x2, 0x2, 0x537, 
-    0x538, 0x3, 0x2, 0x2, 0x2, 0x538, 0x539, 0x7, 0x1b, 0x2, 0x2, 0x539, 
-    0xb1, 0x3, 0x2, 0x2, 0x2, 0x53a, 0x53b, 0x7, 0x79, 0x2, 0x2, 0x53b, 
-    0x53c, 0x7, 0x61, 0x2, 0x2, 0x53c, 0x53d, 0x7, 0x79, 0x2, 0x2, 0x53d, 
-    0x545, 0x7, 0x62, 0x2, 0x2, 0x53e, 0x53f, 0x7, 0x79, 0x2, 0x2, 0x53f, 
-    0x540, 0x7, 0x61, 0x2, 0x2, 0x540, 0x541, 0x7, 0x79, 0x2, 0x2, 0x541, 
-    0x542, 0x7, 0x5a, 0x2, 0x2, 0x542, 0x543, 0x7, 0x79, 0x2, 0x2, 0x543, 
-    0x545, 0x7, 0x62, 0x2, 0x2, 0x544, 0x53a, 0x3, 0x2, 0x2, 0x2, 0x544, 
-    0x53e, 0x3, 0x2, 0x2, 0x2, 0x545, 0xb3, 0x3, 0x2, 0x2, 0x2, 0x546, 0x54b, 
-    0x5, 0xb6, 0x5c, 0x2, 0x547, 0x549, 0x7, 0x79, 0x2, 0x2, 0x548, 0x547, 
-    0x3, 0x2, 0x2, 0x2, 0x548, 0x549, 0x3, 0x2, 0x2, 0x2, 0x549, 0x54a, 
-    0x3, 0x2, 0x2, 0x2, 0x54a, 0x54c, 0x5, 0xc6, 0x64, 0x2, 0x54b, 0x548, 
-    0x3, 0x2, 0x2, 0x2, 0x54b, 0x54c, 0x3, 0x2, 0x2, 0x2, 0x54c, 0xb5, 0x3, 
-    0x2, 0x2, 0x2, 0x54d, 0x555, 0x5, 0xb8, 0x5d, 0x2, 0x54e, 0x555, 0x5, 
-    0xd0, 0x69, 0x2, 0x54f, 0x555, 0x5, 0xc8, 0x65, 0x2, 0x550, 0x555, 0x5, 
-    0xbe, 0x60, 0x2, 0x551, 0x555, 0x5, 0xc0, 0x61, 0x2, 0x552, 0x555, 0x5, 
-    0xc4, 0x63, 0x2, 0x553, 0x555, 0x5, 0xcc, 0x67, 0x2, 0x554, 0x54d, 0x3, 
-    0x2, 0x2, 0x2, 0x554, 0x54e, 0x3, 0x2, 0x2, 0x2, 0x554, 0x54f, 0x3, 
-    0x2, 0x2, 0x2, 0x554, 0x550, 0x3, 0x2, 0x2, 0x2, 0x554, 0x551, 0x3, 
-    0x2, 0x2, 0x2, 0x554, 0x552, 0x3, 0x2, 0x2, 0x2, 0x554, 0x553, 0x3, 
-    0x2, 0x2, 0x2, 0x555, 0xb7, 0x3, 0x2, 0x2, 0x2, 0x556, 0x55c, 0x5, 0xce, 
-    0x68, 0x2, 0x557, 0x55c, 0x7, 0x6b, 0x2, 0x2, 0x558, 0x55c, 0x5, 0xba, 
-    0x5e, 0x2, 0x559, 0x55c, 0x7, 0x62, 0x2, 0x2, 0x55a, 0x55c, 0x5, 0xbc, 
-    0x5f, 0x2, 0x55b, 0x556, 0x3, 0x2, 0x2, 0x2, 0x55b, 0x557, 0x3, 0x2, 
-    0x2, 0x2, 0x55b, 0x558, 0x3, 0x2, 0x2, 0x2, 0x55b, 0x559, 0x3, 0x2, 
-    0x2, 0x2, 0x55b, 0x55a, 0x3, 0x2, 0x2, 0x2, 0x55c, 0xb9, 0x3, 0x2, 0x2, 
-    0x2, 0x55d, 0x55e, 0x9, 0x7, 0x2, 0x2, 0x55e, 0xbb, 0x3, 0x2, 0x2, 0x2, 
-    0x55f, 0x561, 0x7, 0x6, 0x2, 0x2, 0x560, 0x562, 0x7, 0x79, 0x2, 0x2, 
-    0x561, 0x560, 0x3, 0x2, 0x2, 0x2, 0x561, 0x562, 0x3, 0x2, 0x2, 0x2, 
-    0x562, 0x574, 0x3, 0x2, 0x2, 0x2, 0x563, 0x565, 0x5, 0x84, 0x43, 0x2, 
-    0x564, 0x566, 0x7, 0x79, 0x2, 0x2, 0x565, 0x564, 0x3, 0x2, 0x2, 0x2, 
-    0x565, 0x566, 0x3, 0x2, 0x2, 0x2, 0x566, 0x571, 0x3, 0x2, 0x2, 0x2, 
-    0x567, 0x569, 0x7, 0x7, 0x2, 0x2, 0x568, 0x56a, 0x7, 0x79, 0x2, 0x2, 
-    0x569, 0x568, 0x3, 0x2, 0x2, 0x2, 0x569, 0x56a, 0x3, 0x2, 0x2, 0x2, 
-    0x56a, 0x56b, 0x3, 0x2, 0x2, 0x2, 0x56b, 0x56d, 0x5, 0x84, 0x43, 0x2, 
-    0x56c, 0x56e, 0x7, 0x79, 0x2, 0x2, 0x56d, 0x56c, 0x3, 0x2, 0x2, 0x2, 
-    0x56d, 0x56e, 0x3, 0x2, 0x2, 0x2, 0x56e, 0x570, 0x3, 0x2, 0x2, 0x2, 
-    0x56f, 0x567, 0x3, 0x2, 0x2, 0x2, 0x570, 0x573, 0x3, 0x2, 0x2, 0x2, 
-    0x571, 0x56f, 0x3, 0x2, 0x2, 0x2, 0x571, 0x572, 0x3, 0x2, 0x2, 0x2, 
-    0x572, 0x575, 0x3, 0x2, 0x2, 0x2, 0x573, 0x571, 0x3, 0x2, 0x2, 0x2, 
-    0x574, 0x563, 0x3, 0x2, 0x2, 0x2, 0x574, 0x575, 0x3, 0x2, 0x2, 0x2, 
-    0x575, 0x576, 0x3, 0x2, 0x2, 0x2, 0x576, 0x577, 0x7, 0x8, 0x2, 0x2, 
-    0x577, 0xbd, 0x3, 0x2, 0x2, 0x2, 0x578, 0x57a, 0x7, 0x4, 0x2, 0x2, 0x579, 
-    0x57b, 0x7, 0x79, 0x2, 0x2, 0x57a, 0x579, 0x3, 0x2, 0x2, 0x2, 0x57a, 
-    0x57b, 0x3, 0x2, 0x2, 0x2, 0x57b, 0x57c, 0x3, 0x2, 0x2, 0x2, 0x57c, 
-    0x57e, 0x5, 0x84, 0x43, 0x2, 0x57d, 0x57f, 0x7, 0x79, 0x2, 0x2, 0x57e, 
-    0x57d, 0x3, 0x2, 0x2, 0x2, 0x57e, 0x57f, 0x3, 0x2, 0x2, 0x2, 0x57f, 
-    0x580, 0x3, 0x2, 0x2, 0x2, 0x580, 0x581, 0x7, 0x5, 0x2, 0x2, 0x581, 
-    0xbf, 0x3, 0x2, 0x2, 0x2, 0x582, 0x584, 0x5, 0xc2, 0x62, 0x2, 0x583, 
-    0x585, 0x7, 0x79, 0x2, 0x2, 0x584, 0x583, 0x3, 0x2, 0x2, 0x2, 0x584, 
-    0x585, 0x3, 0x2, 0x2, 0x2, 0x585, 0x586, 0x3, 0x2, 0x2, 0x2, 0x586, 
-    0x588, 0x7, 0x4, 0x2, 0x2, 0x587, 0x589, 0x7, 0x79, 0x2, 0x2, 0x588, 
-    0x587, 0x3, 0x2, 0x2, 0x2, 0x588, 0x589, 0x3, 0x2, 0x2, 0x2, 0x589, 
-    0x58a, 0x3, 0x2, 0x2, 0x2, 0x58a, 0x58c, 0x7, 0x4c, 0x2, 0x2, 0x58b, 
-    0x58d, 0x7, 0x79, 0x2, 0x2, 0x58c, 0x58b, 0x3, 0x2, 0x2, 0x2, 0x58c, 
-    0x58d, 0x3, 0x2, 0x2, 0x2, 0x58d, 0x58e, 0x3, 0x2, 0x2, 0x2, 0x58e, 
-    0x58f, 0x7, 0x5, 0x2, 0x2, 0x58f, 0x5b4, 0x3, 0x2, 0x2, 0x2, 0x590, 
-    0x592, 0x5, 0xc2, 0x62, 0x2, 0x591, 0x593, 0x7, 0x79, 0x2, 0x2, 0x592, 
-    0x591, 0x3, 0x2, 0x2, 0x2, 0x592, 0x593, 0x3, 0x2, 0x2, 0x2, 0x593, 
-    0x594, 0x3, 0x2, 0x2, 0x2, 0x594, 0x596, 0x7, 0x4, 0x2, 0x2, 0x595, 
-    0x597, 0x7, 0x79, 0x2, 0x2, 0x596, 0x595, 0x3, 0x2, 0x2, 0x2, 0x596, 
-    0x597, 0x3, 0x2, 0x2, 0x2, 0x597, 0x59c, 0x3, 0x2, 0x2, 0x2, 0x598, 
-    0x59a, 0x7, 0x4b, 0x2, 0x2, 0x599, 0x59b, 0x7, 0x79, 0x2, 0x2, 0x59a, 
-    0x599, 0x3, 0x2, 0x2, 0x2, 0x59a, 0x59b, 0x3, 0x2, 0x2, 0x2, 0x59b, 
-    0x59d, 0x3, 0x2, 0x2, 0x2, 0x59c, 0x598, 0x3, 0x2, 0x2, 0x2, 0x59c, 
-    0x59d, 0x3, 0x2, 0x2, 0x2, 0x59d, 0x5af, 0x3, 0x2, 0x2, 0x2, 0x59e, 
-    0x5a0, 0x5, 0x84, 0x43, 0x2, 0x59f, 0x5a1, 0x7, 0x79, 0x2, 0x2, 0x5a0, 
-    0x59f, 0x3, 0x2, 0x2, 0x2, 0x5a0, 0x5a1, 0x3, 0x2, 0x2, 0x2, 0x5a1, 
-    0x5ac, 0x3, 0x2, 0x2, 0x2, 0x5a2, 0x5a4, 0x7, 0x7, 0x2, 0x2, 0x5a3, 
-    0x5a5, 0x7, 0x79, 0x2, 0x2, 0x5a4, 0x5a3, 0x3, 0x2, 0x2, 0x2, 0x5a4, 
-    0x5a5, 0x3, 0x2, 0x2, 0x2, 0x5a5, 0x5a6, 0x3, 0x2, 0x2, 0x2, 0x5a6, 
-    0x5a8, 0x5, 0x84, 0x43, 0x2, 0x5a7, 0x5a9, 0x7, 0x79, 0x2, 0x2, 0x5a8, 
-    0x5a7, 0x3, 0x2, 0x2, 0x2, 0x5a8, 0x5a9, 0x3, 0x2, 0x2, 0x2, 0x5a9, 
-    0x5ab, 0x3, 0x2, 0x2, 0x2, 0x5aa, 0x5a2, 0x3, 0x2, 0x2, 0x2, 0x5ab, 
-    0x5ae, 0x3, 0x2, 0x2, 0x2, 0x5ac, 0x5aa, 0x3, 0x2, 0x2, 0x2, 0x5ac, 
-    0x5ad, 0x3, 0x2, 0x2, 0x2, 0x5ad, 0x5b0, 0x3, 0x2, 0x2, 0x2, 0x5ae, 
-    0x5ac, 0x3, 0x2, 0x2, 0x2, 0x5af, 0x59e, 0x3, 0x2, 0x2, 0x2, 0x5af, 
-    0x5b0, 0x3, 0x2, 0x2, 0x2, 0x5b0, 0x5b1, 0x3, 0x2, 0x2, 0x2, 0x5b1, 
-    0x5b2, 0x7, 0x5, 0x2, 0x2, 0x5b2, 0x5b4, 0x3, 0x2, 0x2, 0x2, 0x5b3, 
-    0x582, 0x3, 0x2, 0x2, 0x2, 0x5b3, 0x590, 0x3, 0x2, 0x2, 0x2, 0x5b4, 
-    0xc1, 0x3, 0x2, 0x2, 0x2, 0x5b5, 0x5b6, 0x5, 0xdc, 0x6f, 0x2, 0x5b6, 
-    0xc3, 0x3, 0x2, 0x2, 0x2, 0x5b7, 0x5b9, 0x7, 0x65, 0x2, 0x2, 0x5b8, 
-    0x5ba, 0x7, 0x79, 0x2, 0x2, 0x5b9, 0x5b8, 0x3, 0x2, 0x2, 0x2, 0x5b9, 
-    0x5ba, 0x3, 0x2, 0x2, 0x2, 0x5ba, 0x5bb, 0x3, 0x2, 0x2, 0x2, 0x5bb, 
-    0x5bd, 0x7, 0xa, 0x2, 0x2, 0x5bc, 0x5be, 0x7, 0x79, 0x2, 0x2, 0x5bd, 
-    0x5bc, 0x3, 0x2, 0x2, 0x2, 0x5bd, 0x5be, 0x3, 0x2, 0x2, 0x2, 0x5be, 
-    0x5bf, 0x3, 0x2, 0x2, 0x2, 0x5bf, 0x5c1, 0x7, 0x44, 0x2, 0x2, 0x5c0, 
-    0x5c2, 0x7, 0x79, 0x2, 0x2, 0x5c1, 0x5c0, 0x3, 0x2, 0x2, 0x2, 0x5c1, 
-    0x5c2, 0x3, 0x2, 0x2, 0x2, 0x5c2, 0x5c3, 0x3, 0x2, 0x2, 0x2, 0x5c3, 
-    0x5c8, 0x5, 0x66, 0x34, 0x2, 0x5c4, 0x5c6, 0x7, 0x79, 0x2, 0x2, 0x5c5, 
-    0x5c4, 0x3, 0x2, 0x2, 0x2, 0x5c5, 0x5c6, 0x3, 0x2, 0x2, 0x2, 0x5c6, 
-    0x5c7, 0x3, 0x2, 0x2, 0x2, 0x5c7, 0x5c9, 0x5, 0x64, 0x33, 0x2, 0x5c8, 
-    0x5c5, 0x3, 0x2, 0x2, 0x2, 0x5c8, 0x5c9, 0x3, 0x2, 0x2, 0x2, 0x5c9, 
-    0x5cb, 0x3, 0x2, 0x2, 0x2, 0x5ca, 0x5cc, 0x7, 0x79, 0x2, 0x2, 0x5cb, 
-    0x5ca, 0x3, 0x2, 0x2, 0x2, 0x5cb, 0x5cc, 0x3, 0x2, 0x2, 0x2, 0x5cc, 
-    0x5cd, 0x3, 0x2, 0x2, 0x2, 0x5cd, 0x5ce, 0x7, 0xc, 0x2, 0x2, 0x5ce, 
-    0xc5, 0x3, 0x2, 0x2, 0x2, 0x5cf, 0x5d1, 0x7, 0x1c, 0x2, 0x2, 0x5d0, 
-    0x5d2, 0x7, 0x79, 0x2, 0x2, 0x5d1, 0x5d0, 0x3, 0x2, 0x2, 0x2, 0x5d1, 
-    0x5d2, 0x3, 0x2, 0x2, 0x2, 0x5d2, 0x5d3, 0x3, 0x2, 0x2, 0x2, 0x5d3, 
-    0x5d4, 0x5, 0xd4, 0x6b, 0x2, 0x5d4, 0xc7, 0x3, 0x2, 0x2, 0x2, 0x5d5, 
-    0x5da, 0x7, 0x66, 0x2, 0x2, 0x5d6, 0x5d8, 0x7, 0x79, 0x2, 0x2, 0x5d7, 
-    0x5d6, 0x3, 0x2, 0x2, 0x2, 0x5d7, 0x5d8, 0x3, 0x2, 0x2, 0x2, 0x5d8, 
-    0x5d9, 0x3, 0x2, 0x2, 0x2, 0x5d9, 0x5db, 0x5, 0xca, 0x66, 0x2, 0x5da, 
-    0x5d7, 0x3, 0x2, 0x2, 0x2, 0x5db, 0x5dc, 0x3, 0x2, 0x2, 0x2, 0x5dc, 
-    0x5da, 0x3, 0x2, 0x2, 0x2, 0x5dc, 0x5dd, 0x3, 0x2, 0x2, 0x2, 0x5dd, 
-    0x5ec, 0x3, 0x2, 0x2, 0x2, 0x5de, 0x5e0, 0x7, 0x66, 0x2, 0x2, 0x5df, 
-    0x5e1, 0x7, 0x79, 0x2, 0x2, 0x5e0, 0x5df, 0x3, 0x2, 0x2, 0x2, 0x5e0, 
-    0x5e1, 0x3, 0x2, 0x2, 0x2, 0x5e1, 0x5e2, 0x3, 0x2, 0x2, 0x2, 0x5e2, 
-    0x5e7, 0x5, 0x84, 0x43, 0x2, 0x5e3, 0x5e5, 0x7, 0x79, 0x2, 0x2, 0x5e4, 
-    0x5e3, 0x3, 0x2, 0x2, 0x2, 0x5e4, 0x5e5, 0x3, 0x2, 0x2, 0x2, 0x5e5, 
-    0x5e6, 0x3, 0x2, 0x2, 0x2, 0x5e6, 0x5e8, 0x5, 0xca, 0x66, 0x2, 0x5e7, 
-    0x5e4, 0x3, 0x2, 0x2, 0x2, 0x5e8, 0x5e9, 0x3, 0x2, 0x2, 0x2, 0x5e9, 
-    0x5e7, 0x3, 0x2, 0x2, 0x2, 0x5e9, 0x5ea, 0x3, 0x2, 0x2, 0x2, 0x5ea, 
-    0x5ec, 0x3, 0x2, 0x2, 0x2, 0x5eb, 0x5d5, 0x3, 0x2, 0x2, 0x2, 0x5eb, 
-    0x5de, 0x3, 0x2, 0x2, 0x2, 0x5ec, 0x5f5, 0x3, 0x2, 0x2, 0x2, 0x5ed, 
-    0x5ef, 0x7, 0x79, 0x2, 0x2, 0x5ee, 0x5ed, 0x3, 0x2, 0x2, 0x2, 0x5ee, 
-    0x5ef, 0x3, 0x2, 0x2, 0x2, 0x5ef, 0x5f0, 0x3, 0x2, 0x2, 0x2, 0x5f0, 
-    0x5f2, 0x7, 0x67, 0x2, 0x2, 0x5f1, 0x5f3, 0x7, 0x79, 0x2, 0x2, 0x5f2, 
-    0x5f1, 0x3, 0x2, 0x2, 0x2, 0x5f2, 0x5f3, 0x3, 0x2, 0x2, 0x2, 0x5f3, 
-    0x5f4, 0x3, 0x2, 0x2, 0x2, 0x5f4, 0x5f6, 0x5, 0x84, 0x43, 0x2, 0x5f5, 
-    0x5ee, 0x3, 0x2, 0x2, 0x2, 0x5f5, 0x5f6, 0x3, 0x2, 0x2, 0x2, 0x5f6, 
-    0x5f8, 0x3, 0x2, 0x2, 0x2, 0x5f7, 0x5f9, 0x7, 0x79, 0x2, 0x2, 0x5f8, 
-    0x5f7, 0x3, 0x2, 0x2, 0x2, 0x5f8, 0x5f9, 0x3, 0x2, 0x2, 0x2, 0x5f9, 
-    0x5fa, 0x3, 0x2, 0x2, 0x2, 0x5fa, 0x5fb, 0x7, 0x68, 0x2, 0x2, 0x5fb, 
-    0xc9, 0x3, 0x2, 0x2, 0x2, 0x5fc, 0x5fe, 0x7, 0x69, 0x2, 0x2, 0x5fd, 
-    0x5ff, 0x7, 0x79, 0x2, 0x2, 0x5fe, 0x5fd, 0x3, 0x2, 0x2, 0x2, 0x5fe, 
-    0x5ff, 0x3, 0x2, 0x2, 0x2, 0x5ff, 0x600, 0x3, 0x2, 0x2, 0x2, 0x600, 
-    0x602, 0x5, 0x84, 0x43, 0x2, 0x601, 0x603, 0x7, 0x79, 0x2, 0x2, 0x602, 
-    0x601, 0x3, 0x2, 0x2, 0x2, 0x602, 0x603, 0x3, 0x2, 0x2, 0x2, 0x603, 
-    0x604, 0x3, 0x2, 0x2, 0x2, 0x604, 0x606, 0x7, 0x6a, 0x2, 0x2, 0x605, 
-    0x607, 0x7, 0x79, 0x2, 0x2, 0x606, 0x605, 0x3, 0x2, 0x2, 0x2, 0x606, 
-    0x607, 0x3, 0x2, 0x2, 0x2, 0x607, 0x608, 0x3, 0x2, 0x2, 0x2, 0x608, 
-    0x609, 0x5, 0x84, 0x43, 0x2, 0x609, 0xcb, 0x3, 0x2, 0x2, 0x2, 0x60a, 
-    0x60b, 0x5, 0xdc, 0x6f, 0x2, 0x60b, 0xcd, 0x3, 0x2, 0x2, 0x2, 0x60c, 
-    0x60f, 0x5, 0xd8, 0x6d, 0x2, 0x60d, 0x60f, 0x5, 0xd6, 0x6c, 0x2, 0x60e, 
-    0x60c, 0x3, 0x2, 0x2, 0x2, 0x60e, 0x60d, 0x3, 0x2, 0x2, 0x2, 0x60f, 
-    0xcf, 0x3, 0x2, 0x2, 0x2, 0x610, 0x613, 0x7, 0x1d, 0x2, 0x2, 0x611, 
-    0x614, 0x5, 0xdc, 0x6f, 0x2, 0x612, 0x614, 0x7, 0x6d, 0x2, 0x2, 0x613, 
-    0x611, 0x3, 0x2, 0x2, 0x2, 0x613, 0x612, 0x3, 0x2, 0x2, 0x2, 0x614, 
-    0xd1, 0x3, 0x2, 0x2, 0x2, 0x615, 0x617, 0x5, 0xb6, 0x5c, 0x2, 0x616, 
-    0x618, 0x7, 0x79, 0x2, 0x2, 0x617, 0x616, 0x3, 0x2, 0x2, 0x2, 0x617, 
-    0x618, 0x3, 0x2, 0x2, 0x2, 0x618, 0x619, 0x3, 0x2, 0x2, 0x2, 0x619, 
-    0x61a, 0x5, 0xc6, 0x64, 0x2, 0x61a, 0xd3, 0x3, 0x2, 0x2, 0x2, 0x61b, 
-    0x61c, 0x5, 0xda, 0x6e, 0x2, 0x61c, 0xd5, 0x3, 0x2, 0x2, 0x2, 0x61d, 
-    0x61e, 0x7, 0x6d, 0x2, 0x2, 0x61e, 0xd7, 0x3, 0x2, 0x2, 0x2, 0x61f, 
-    0x620, 0x7, 0x74, 0x2, 0x2, 0x620, 0xd9, 0x3, 0x2, 0x2, 0x2, 0x621, 
-    0x622, 0x5, 0xdc, 0x6f, 0x2, 0x622, 0xdb, 0x3, 0x2, 0x2, 0x2, 0x623, 
-    0x628, 0x7, 0x75, 0x2, 0x2, 0x624, 0x625, 0x7, 0x78, 0x2, 0x2, 0x625, 
-    0x628, 0x8, 0x6f, 0x1, 0x2, 0x626, 0x628, 0x7, 0x6e, 0x2, 0x2, 0x627, 
-    0x623, 0x3, 0x2, 0x2, 0x2, 0x627, 0x624, 0x3, 0x2, 0x2, 0x2, 0x627, 
-    0x626, 0x3, 0x2, 0x2, 0x2, 0x628, 0xdd, 0x3, 0x2, 0x2, 0x2, 0x629, 0x62a, 
-    0x9, 0x8, 0x2, 0x2, 0x62a, 0xdf, 0x3, 0x2, 0x2, 0x2, 0x62b, 0x62c, 0x9, 
-    0x9, 0x2, 0x2, 0x62c, 0xe1, 0x3, 0x2, 0x2, 0x2, 0x62d, 0x62e, 0x9, 0xa, 
-    0x2, 0x2, 0x62e, 0xe3, 0x3, 0x2, 0x2, 0x2, 0x113, 0xe5, 0xe8, 0xeb, 
-    0xf0, 0xf3, 0xf6, 0xf9, 0x105, 0x109, 0x10d, 0x111, 0x115, 0x119, 0x11d, 
-    0x122, 0x129, 0x12d, 0x131, 0x134, 0x138, 0x13c, 0x141, 0x146, 0x14a, 
-    0x152, 0x15c, 0x160, 0x164, 0x168, 0x16d, 0x179, 0x17d, 0x187, 0x18b, 
-    0x18f, 0x191, 0x195, 0x199, 0x19b, 0x1b1, 0x1bc, 0x1d2, 0x1d6, 0x1db, 
-    0x1e6, 0x1ea, 0x1ee, 0x1f6, 0x1fc, 0x201, 0x207, 0x213, 0x218, 0x21d, 
-    0x221, 0x226, 0x22c, 0x231, 0x234, 0x238, 0x23c, 0x240, 0x246, 0x24a, 
-    0x24f, 0x254, 0x258, 0x25b, 0x25f, 0x263, 0x267, 0x26b, 0x26f, 0x275, 
-    0x279, 0x27e, 0x282, 0x28a, 0x28e, 0x292, 0x296, 0x29a, 0x29d, 0x2a1, 
-    0x2ab, 0x2b1, 0x2b5, 0x2b9, 0x2be, 0x2c3, 0x2c7, 0x2cd, 0x2d1, 0x2d5, 
-    0x2da, 0x2e0, 0x2e3, 0x2e9, 0x2ec, 0x2f2, 0x2f6, 0x2fa, 0x2fe, 0x302, 
-    0x307, 0x30c, 0x310, 0x315, 0x318, 0x321, 0x32a, 0x32f, 0x33c, 0x33f, 
-    0x347, 0x34b, 0x350, 0x359, 0x35e, 0x365, 0x369, 0x36d, 0x36f, 0x373, 
-    0x375, 0x379, 0x37b, 0x37f, 0x383, 0x385, 0x389, 0x38b, 0x38f, 0x391, 
-    0x394, 0x398, 0x39e, 0x3a2, 0x3a5, 0x3a8, 0x3ae, 0x3b1, 0x3b4, 0x3b8, 
-    0x3bc, 0x3c0, 0x3c4, 0x3c6, 0x3ca, 0x3cc, 0x3d0, 0x3d2, 0x3d6, 0x3d8, 
-    0x3de, 0x3e2, 0x3e6, 0x3ea, 0x3ee, 0x3f2, 0x3f6, 0x3fa, 0x3fe, 0x401, 
-    0x407, 0x40b, 0x40f, 0x412, 0x417, 0x41c, 0x421, 0x426, 0x42c, 0x430, 
-    0x434, 0x445, 0x44f, 0x459, 0x45e, 0x460, 0x466, 0x46a, 0x46e, 0x472, 
-    0x476, 0x47e, 0x482, 0x486, 0x48a, 0x490, 0x494, 0x49a, 0x49e, 0x4a3, 
-    0x4a8, 0x4ac, 0x4b1, 0x4b6, 0x4ba, 0x4c0, 0x4c7, 0x4cb, 0x4d1, 0x4d8, 
-    0x4dc, 0x4e2, 0x4e9, 0x4ed, 0x4f2, 0x4f7, 0x4f9, 0x4fd, 0x500, 0x506, 
-    0x50a, 0x50d, 0x510, 0x517, 0x51b, 0x51f, 0x52e, 0x531, 0x536, 0x544, 
-    0x548, 0x54b, 0x554, 0x55b, 0x561, 0x565, 0x569, 0x56d, 0x571, 0x574, 
-    0x57a, 0x57e, 0x584, 0x588, 0x58c, 0x592, 0x596, 0x59a, 0x59c, 0x5a0, 
-    0x5a4, 0x5a8, 0x5ac, 0x5af, 0x5b3, 0x5b9, 0x5bd, 0x5c1, 0x5c5, 0x5c8, 
-    0x5cb, 0x5d1, 0x5d7, 0x5dc, 0x5e0, 0x5e4, 0x5e9, 0x5eb, 0x5ee, 0x5f2, 
-    0x5f5, 0x5f8, 0x5fe, 0x602, 0x606, 0x60e, 0x613, 0x617, 0x627, 
+    0x4be, 0x3, 0x2, 0x2, 0x2, 0x4c0, 0x4c1, 0x3, 0x2, 0x2, 0x2, 0x4c1, 0x97, 
+    0x3, 0x2, 0x2, 0x2, 0x4c2, 0x4c0, 0x3, 0x2, 0x2, 0x2, 0x4c3, 0x4c4, 0x9, 
+    0x4, 0x2, 0x2, 0x4c4, 0x99, 0x3, 0x2, 0x2, 0x2, 0x4c5, 0x4d1, 0x5, 0x9e, 
+    0x50, 0x2, 0x4c6, 0x4c8, 0x7, 0x79, 0x2, 0x2, 0x4c7, 0x4c6, 0x3, 0x2, 
+    0x2, 0x2, 0x4c7, 0x4c8, 0x3, 0x2, 0x2, 0x2, 0x4c8, 0x4c9, 0x3, 0x2, 0x2, 
+    0x2, 0x4c9, 0x4cb, 0x5, 0x9c, 0x4f, 0x2, 0x4ca, 0x4cc, 0x7, 0x79, 0x2, 
+    0x2, 0x4cb, 0x4ca, 0x3, 0x2, 0x2, 0x2, 0x4cb, 0x4cc, 0x3, 0x2, 0x2, 0x2, 
+    0x4cc, 0x4cd, 0x3, 0x2, 0x2, 0x2, 0x4cd, 0x4ce, 0x5, 0x9e, 0x50, 0x2, 
+    0x4ce, 0x4d0, 0x3, 0x2, 0x2, 0x2, 0x4cf, 0x4c7, 0x3, 0x2, 0x2, 0x2, 
+    0x4d0, 0x4d3, 0x3, 0x2, 0x2, 0x2, 0x4d1, 0x4cf, 0x3, 0x2, 0x2, 0x2, 
+    0x4d1, 0x4d2, 0x3, 0x2, 0x2, 0x2, 0x4d2, 0x9b, 0x3, 0x2, 0x2, 0x2, 0x4d3, 
+    0x4d1, 0x3, 0x2, 0x2, 0x2, 0x4d4, 0x4d5, 0x9, 0x5, 0x2, 0x2, 0x4d5, 0x9d, 
+    0x3, 0x2, 0x2, 0x2, 0x4d6, 0x4e2, 0x5, 0xa2, 0x52, 0x2, 0x4d7, 0x4d9, 
+    0x7, 0x79, 0x2, 0x2, 0x4d8, 0x4d7, 0x3, 0x2, 0x2, 0x2, 0x4d8, 0x4d9, 0x3, 
+    0x2, 0x2, 0x2, 0x4d9, 0x4da, 0x3, 0x2, 0x2, 0x2, 0x4da, 0x4dc, 0x5, 0xa0, 
+    0x51, 0x2, 0x4db, 0x4dd, 0x7, 0x79, 0x2, 0x2, 0x4dc, 0x4db, 0x3, 0x2, 
+    0x2, 0x2, 0x4dc, 0x4dd, 0x3, 0x2, 0x2, 0x2, 0x4dd, 0x4de, 0x3, 0x2, 0x2, 
+    0x2, 0x4de, 0x4df, 0x5, 0xa2, 0x52, 0x2, 0x4df, 0x4e1, 0x3, 0x2, 0x2, 
+    0x2, 0x4e0, 0x4d8, 0x3, 0x2, 0x2, 0x2, 0x4e1, 0x4e4, 0x3, 0x2, 0x2, 0x2, 
+    0x4e2, 0x4e0, 0x3, 0x2, 0x2, 0x2, 0x4e2, 0x4e3, 0x3, 0x2, 0x2, 0x2, 
+    0x4e3, 0x9f, 0x3, 0x2, 0x2, 0x2, 0x4e4, 0x4e2, 0x3, 0x2, 0x2, 0x2, 0x4e5, 
+    0x4e6, 0x9, 0x6, 0x2, 0x2, 0x4e6, 0xa1, 0x3, 0x2, 0x2, 0x2, 0x4e7, 0x4f2, 
+    0x5, 0xa4, 0x53, 0x2, 0x4e8, 0x4ea, 0x7, 0x79, 0x2, 0x2, 0x4e9, 0x4e8, 
+    0x3, 0x2, 0x2, 0x2, 0x4e9, 0x4ea, 0x3, 0x2, 0x2, 0x2, 0x4ea, 0x4eb, 0x3, 
+    0x2, 0x2, 0x2, 0x4eb, 0x4ed, 0x7, 0x1a, 0x2, 0x2, 0x4ec, 0x4ee, 0x7, 
+    0x79, 0x2, 0x2, 0x4ed, 0x4ec, 0x3, 0x2, 0x2, 0x2, 0x4ed, 0x4ee, 0x3, 0x2, 
+    0x2, 0x2, 0x4ee, 0x4ef, 0x3, 0x2, 0x2, 0x2, 0x4ef, 0x4f1, 0x5, 0xa4, 
+    0x53, 0x2, 0x4f0, 0x4e9, 0x3, 0x2, 0x2, 0x2, 0x4f1, 0x4f4, 0x3, 0x2, 0x2, 
+    0x2, 0x4f2, 0x4f0, 0x3, 0x2, 0x2, 0x2, 0x4f2, 0x4f3, 0x3, 0x2, 0x2, 0x2, 
+    0x4f3, 0xa3, 0x3, 0x2, 0x2, 0x2, 0x4f4, 0x4f2, 0x3, 0x2, 0x2, 0x2, 0x4f5, 
+    0x4f7, 0x7, 0x5c, 0x2, 0x2, 0x4f6, 0x4f8, 0x7, 0x79, 0x2, 0x2, 0x4f7, 
+    0x4f6, 0x3, 0x2, 0x2, 0x2, 0x4f7, 0x4f8, 0x3, 0x2, 0x2, 0x2, 0x4f8, 
+    0x4fa, 0x3, 0x2, 0x2, 0x2, 0x4f9, 0x4f5, 0x3, 0x2, 0x2, 0x2, 0x4f9, 
+    0x4fa, 0x3, 0x2, 0x2, 0x2, 0x4fa, 0x4fb, 0x3, 0x2, 0x2, 0x2, 0x4fb, 
+    0x500, 0x5, 0xa6, 0x54, 0x2, 0x4fc, 0x4fe, 0x7, 0x79, 0x2, 0x2, 0x4fd, 
+    0x4fc, 0x3, 0x2, 0x2, 0x2, 0x4fd, 0x4fe, 0x3, 0x2, 0x2, 0x2, 0x4fe, 
+    0x4ff, 0x3, 0x2, 0x2, 0x2, 0x4ff, 0x501, 0x7, 0x5d, 0x2, 0x2, 0x500, 
+    0x4fd, 0x3, 0x2, 0x2, 0x2, 0x500, 0x501, 0x3, 0x2, 0x2, 0x2, 0x501, 0xa5, 
+    0x3, 0x2, 0x2, 0x2, 0x502, 0x506, 0x5, 0xb4, 0x5b, 0x2, 0x503, 0x507, 
+    0x5, 0xae, 0x58, 0x2, 0x504, 0x507, 0x5, 0xa8, 0x55, 0x2, 0x505, 0x507, 
+    0x5, 0xb2, 0x5a, 0x2, 0x506, 0x503, 0x3, 0x2, 0x2, 0x2, 0x506, 0x504, 
+    0x3, 0x2, 0x2, 0x2, 0x506, 0x505, 0x3, 0x2, 0x2, 0x2, 0x506, 0x507, 0x3, 
+    0x2, 0x2, 0x2, 0x507, 0xa7, 0x3, 0x2, 0x2, 0x2, 0x508, 0x50b, 0x5, 0xaa, 
+    0x56, 0x2, 0x509, 0x50b, 0x5, 0xac, 0x57, 0x2, 0x50a, 0x508, 0x3, 0x2, 
+    0x2, 0x2, 0x50a, 0x509, 0x3, 0x2, 0x2, 0x2, 0x50b, 0x50d, 0x3, 0x2, 0x2, 
+    0x2, 0x50c, 0x50e, 0x5, 0xa8, 0x55, 0x2, 0x50d, 0x50c, 0x3, 0x2, 0x2, 
+    0x2, 0x50d, 0x50e, 0x3, 0x2, 0x2, 0x2, 0x50e, 0xa9, 0x3, 0x2, 0x2, 0x2, 
+    0x50f, 0x511, 0x7, 0x79, 0x2, 0x2, 0x510, 0x50f, 0x3, 0x2, 0x2, 0x2, 
+    0x510, 0x511, 0x3, 0x2, 0x2, 0x2, 0x511, 0x512, 0x3, 0x2, 0x2, 0x2, 
+    0x512, 0x513, 0x7, 0x6, 0x2, 0x2, 0x513, 0x514, 0x5, 0x84, 0x43, 0x2, 
+    0x514, 0x515, 0x7, 0x8, 0x2, 0x2, 0x515, 0xab, 0x3, 0x2, 0x2, 0x2, 0x516, 
+    0x518, 0x7, 0x79, 0x2, 0x2, 0x517, 0x516, 0x3, 0x2, 0x2, 0x2, 0x517, 
+    0x518, 0x3, 0x2, 0x2, 0x2, 0x518, 0x519, 0x3, 0x2, 0x2, 0x2, 0x519, 
+    0x51b, 0x7, 0x6, 0x2, 0x2, 0x51a, 0x51c, 0x5, 0x84, 0x43, 0x2, 0x51b, 
+    0x51a, 0x3, 0x2, 0x2, 0x2, 0x51b, 0x51c, 0x3, 0x2, 0x2, 0x2, 0x51c, 
+    0x51d, 0x3, 0x2, 0x2, 0x2, 0x51d, 0x51f, 0x7, 0xb, 0x2, 0x2, 0x51e, 
+    0x520, 0x5, 0x84, 0x43, 0x2, 0x51f, 0x51e, 0x3, 0x2, 0x2, 0x2, 0x51f, 
+    0x520, 0x3, 0x2, 0x2, 0x2, 0x520, 0x521, 0x3, 0x2, 0x2, 0x2, 0x521, 
+    0x522, 0x7, 0x8, 0x2, 0x2, 0x522, 0xad, 0x3, 0x2, 0x2, 0x2, 0x523, 0x52f, 
+    0x5, 0xb0, 0x59, 0x2, 0x524, 0x525, 0x7, 0x79, 0x2, 0x2, 0x525, 0x526, 
+    0x7, 0x5e, 0x2, 0x2, 0x526, 0x527, 0x7, 0x79, 0x2, 0x2, 0x527, 0x52f, 
+    0x7, 0x49, 0x2, 0x2, 0x528, 0x529, 0x7, 0x79, 0x2, 0x2, 0x529, 0x52a, 
+    0x7, 0x5f, 0x2, 0x2, 0x52a, 0x52b, 0x7, 0x79, 0x2, 0x2, 0x52b, 0x52f, 
+    0x7, 0x49, 0x2, 0x2, 0x52c, 0x52d, 0x7, 0x79, 0x2, 0x2, 0x52d, 0x52f, 
+    0x7, 0x60, 0x2, 0x2, 0x52e, 0x523, 0x3, 0x2, 0x2, 0x2, 0x52e, 0x524, 0x3, 
+    0x2, 0x2, 0x2, 0x52e, 0x528, 0x3, 0x2, 0x2, 0x2, 0x52e, 0x52c, 0x3, 0x2, 
+    0x2, 0x2, 0x52f, 0x531, 0x3, 0x2, 0x2, 0x2, 0x530, 0x532, 0x7, 0x79, 0x2, 
+    0x2, 0x531, 0x530, 0x3, 0x2, 0x2, 0x2, 0x531, 0x532, 0x3, 0x2, 0x2, 0x2, 
+    0x532, 0x533, 0x3, 0x2, 0x2, 0x2, 0x533, 0x534, 0x5, 0xb4, 0x5b, 0x2, 
+    0x534, 0xaf, 0x3, 0x2, 0x2, 0x2, 0x535, 0x537, 0x7, 0x79, 0x2, 0x2, 
+    0x536, 0x535, 0x3, 0x2, 0x2, 0x2, 0x536, 0x537, 0x3, 0x2, 0x2, 0x2, 
+    0x537, 0x538, 0x3, 0x2, 0x2, 0x2, 0x538, 0x539, 0x7, 0x1b, 0x2, 0x2, 
+    0x539, 0xb1, 0x3, 0x2, 0x2, 0x2, 0x53a, 0x53b, 0x7, 0x79, 0x2, 0x2, 
+    0x53b, 0x53c, 0x7, 0x61, 0x2, 0x2, 0x53c, 0x53d, 0x7, 0x79, 0x2, 0x2, 
+    0x53d, 0x545, 0x7, 0x62, 0x2, 0x2, 0x53e, 0x53f, 0x7, 0x79, 0x2, 0x2, 
+    0x53f, 0x540, 0x7, 0x61, 0x2, 0x2, 0x540, 0x541, 0x7, 0x79, 0x2, 0x2, 
+    0x541, 0x542, 0x7, 0x5a, 0x2, 0x2, 0x542, 0x543, 0x7, 0x79, 0x2, 0x2, 
+    0x543, 0x545, 0x7, 0x62, 0x2, 0x2, 0x544, 0x53a, 0x3, 0x2, 0x2, 0x2, 
+    0x544, 0x53e, 0x3, 0x2, 0x2, 0x2, 0x545, 0xb3, 0x3, 0x2, 0x2, 0x2, 0x546, 
+    0x54b, 0x5, 0xb6, 0x5c, 0x2, 0x547, 0x549, 0x7, 0x79, 0x2, 0x2, 0x548, 
+    0x547, 0x3, 0x2, 0x2, 0x2, 0x548, 0x549, 0x3, 0x2, 0x2, 0x2, 0x549, 
+    0x54a, 0x3, 0x2, 0x2, 0x2, 0x54a, 0x54c, 0x5, 0xc6, 0x64, 0x2, 0x54b, 
+    0x548, 0x3, 0x2, 0x2, 0x2, 0x54b, 0x54c, 0x3, 0x2, 0x2, 0x2, 0x54c, 0xb5, 
+    0x3, 0x2, 0x2, 0x2, 0x54d, 0x555, 0x5, 0xb8, 0x5d, 0x2, 0x54e, 0x555, 
+    0x5, 0xd0, 0x69, 0x2, 0x54f, 0x555, 0x5, 0xc8, 0x65, 0x2, 0x550, 0x555, 
+    0x5, 0xbe, 0x60, 0x2, 0x551, 0x555, 0x5, 0xc0, 0x61, 0x2, 0x552, 0x555, 
+    0x5, 0xc4, 0x63, 0x2, 0x553, 0x555, 0x5, 0xcc, 0x67, 0x2, 0x554, 0x54d, 
+    0x3, 0x2, 0x2, 0x2, 0x554, 0x54e, 0x3, 0x2, 0x2, 0x2, 0x554, 0x54f, 0x3, 
+    0x2, 0x2, 0x2, 0x554, 0x550, 0x3, 0x2, 0x2, 0x2, 0x554, 0x551, 0x3, 0x2, 
+    0x2, 0x2, 0x554, 0x552, 0x3, 0x2, 0x2, 0x2, 0x554, 0x553, 0x3, 0x2, 0x2, 
+    0x2, 0x555, 0xb7, 0x3, 0x2, 0x2, 0x2, 0x556, 0x55c, 0x5, 0xce, 0x68, 0x2, 
+    0x557, 0x55c, 0x7, 0x6b, 0x2, 0x2, 0x558, 0x55c, 0x5, 0xba, 0x5e, 0x2, 
+    0x559, 0x55c, 0x7, 0x62, 0x2, 0x2, 0x55a, 0x55c, 0x5, 0xbc, 0x5f, 0x2, 
+    0x55b, 0x556, 0x3, 0x2, 0x2, 0x2, 0x55b, 0x557, 0x3, 0x2, 0x2, 0x2, 
+    0x55b, 0x558, 0x3, 0x2, 0x2, 0x2, 0x55b, 0x559, 0x3, 0x2, 0x2, 0x2, 
+    0x55b, 0x55a, 0x3, 0x2, 0x2, 0x2, 0x55c, 0xb9, 0x3, 0x2, 0x2, 0x2, 0x55d, 
+    0x55e, 0x9, 0x7, 0x2, 0x2, 0x55e, 0xbb, 0x3, 0x2, 0x2, 0x2, 0x55f, 0x561, 
+    0x7, 0x6, 0x2, 0x2, 0x560, 0x562, 0x7, 0x79, 0x2, 0x2, 0x561, 0x560, 0x3, 
+    0x2, 0x2, 0x2, 0x561, 0x562, 0x3, 0x2, 0x2, 0x2, 0x562, 0x574, 0x3, 0x2, 
+    0x2, 0x2, 0x563, 0x565, 0x5, 0x84, 0x43, 0x2, 0x564, 0x566, 0x7, 0x79, 
+    0x2, 0x2, 0x565, 0x564, 0x3, 0x2, 0x2, 0x2, 0x565, 0x566, 0x3, 0x2, 0x2, 
+    0x2, 0x566, 0x571, 0x3, 0x2, 0x2, 0x2, 0x567, 0x569, 0x7, 0x7, 0x2, 0x2, 
+    0x568, 0x56a, 0x7, 0x79, 0x2, 0x2, 0x569, 0x568, 0x3, 0x2, 0x2, 0x2, 
+    0x569, 0x56a, 0x3, 0x2, 0x2, 0x2, 0x56a, 0x56b, 0x3, 0x2, 0x2, 0x2, 
+    0x56b, 0x56d, 0x5, 0x84, 0x43, 0x2, 0x56c, 0x56e, 0x7, 0x79, 0x2, 0x2, 
+    0x56d, 0x56c, 0x3, 0x2, 0x2, 0x2, 0x56d, 0x56e, 0x3, 0x2, 0x2, 0x2, 
+    0x56e, 0x570, 0x3, 0x2, 0x2, 0x2, 0x56f, 0x567, 0x3, 0x2, 0x2, 0x2, 
+    0x570, 0x573, 0x3, 0x2, 0x2, 0x2, 0x571, 0x56f, 0x3, 0x2, 0x2, 0x2, 
+    0x571, 0x572, 0x3, 0x2, 0x2, 0x2, 0x572, 0x575, 0x3, 0x2, 0x2, 0x2, 
+    0x573, 0x571, 0x3, 0x2, 0x2, 0x2, 0x574, 0x563, 0x3, 0x2, 0x2, 0x2, 
+    0x574, 0x575, 0x3, 0x2, 0x2, 0x2, 0x575, 0x576, 0x3, 0x2, 0x2, 0x2, 
+    0x576, 0x577, 0x7, 0x8, 0x2, 0x2, 0x577, 0xbd, 0x3, 0x2, 0x2, 0x2, 0x578, 
+    0x57a, 0x7, 0x4, 0x2, 0x2, 0x579, 0x57b, 0x7, 0x79, 0x2, 0x2, 0x57a, 
+    0x579, 0x3, 0x2, 0x2, 0x2, 0x57a, 0x57b, 0x3, 0x2, 0x2, 0x2, 0x57b, 
+    0x57c, 0x3, 0x2, 0x2, 0x2, 0x57c, 0x57e, 0x5, 0x84, 0x43, 0x2, 0x57d, 
+    0x57f, 0x7, 0x79, 0x2, 0x2, 0x57e, 0x57d, 0x3, 0x2, 0x2, 0x2, 0x57e, 
+    0x57f, 0x3, 0x2, 0x2, 0x2, 0x57f, 0x580, 0x3, 0x2, 0x2, 0x2, 0x580, 
+    0x581, 0x7, 0x5, 0x2, 0x2, 0x581, 0xbf, 0x3, 0x2, 0x2, 0x2, 0x582, 0x584, 
+    0x5, 0xc2, 0x62, 0x2, 0x583, 0x585, 0x7, 0x79, 0x2, 0x2, 0x584, 0x583, 
+    0x3, 0x2, 0x2, 0x2, 0x584, 0x585, 0x3, 0x2, 0x2, 0x2, 0x585, 0x586, 0x3, 
+    0x2, 0x2, 0x2, 0x586, 0x588, 0x7, 0x4, 0x2, 0x2, 0x587, 0x589, 0x7, 0x79, 
+    0x2, 0x2, 0x588, 0x587, 0x3, 0x2, 0x2, 0x2, 0x588, 0x589, 0x3, 0x2, 0x2, 
+    0x2, 0x589, 0x58a, 0x3, 0x2, 0x2, 0x2, 0x58a, 0x58c, 0x7, 0x4c, 0x2, 0x2, 
+    0x58b, 0x58d, 0x7, 0x79, 0x2, 0x2, 0x58c, 0x58b, 0x3, 0x2, 0x2, 0x2, 
+    0x58c, 0x58d, 0x3, 0x2, 0x2, 0x2, 0x58d, 0x58e, 0x3, 0x2, 0x2, 0x2, 
+    0x58e, 0x58f, 0x7, 0x5, 0x2, 0x2, 0x58f, 0x5b4, 0x3, 0x2, 0x2, 0x2, 
+    0x590, 0x592, 0x5, 0xc2, 0x62, 0x2, 0x591, 0x593, 0x7, 0x79, 0x2, 0x2, 
+    0x592, 0x591, 0x3, 0x2, 0x2, 0x2, 0x592, 0x593, 0x3, 0x2, 0x2, 0x2, 
+    0x593, 0x594, 0x3, 0x2, 0x2, 0x2, 0x594, 0x596, 0x7, 0x4, 0x2, 0x2, 
+    0x595, 0x597, 0x7, 0x79, 0x2, 0x2, 0x596, 0x595, 0x3, 0x2, 0x2, 0x2, 
+    0x596, 0x597, 0x3, 0x2, 0x2, 0x2, 0x597, 0x59c, 0x3, 0x2, 0x2, 0x2, 
+    0x598, 0x59a, 0x7, 0x4b, 0x2, 0x2, 0x599, 0x59b, 0x7, 0x79, 0x2, 0x2, 
+    0x59a, 0x599, 0x3, 0x2, 0x2, 0x2, 0x59a, 0x59b, 0x3, 0x2, 0x2, 0x2, 
+    0x59b, 0x59d, 0x3, 0x2, 0x2, 0x2, 0x59c, 0x598, 0x3, 0x2, 0x2, 0x2, 
+    0x59c, 0x59d, 0x3, 0x2, 0x2, 0x2, 0x59d, 0x5af, 0x3, 0x2, 0x2, 0x2, 
+    0x59e, 0x5a0, 0x5, 0x84, 0x43, 0x2, 0x59f, 0x5a1, 0x7, 0x79, 0x2, 0x2, 
+    0x5a0, 0x59f, 0x3, 0x2, 0x2, 0x2, 0x5a0, 0x5a1, 0x3, 0x2, 0x2, 0x2, 
+    0x5a1, 0x5ac, 0x3, 0x2, 0x2, 0x2, 0x5a2, 0x5a4, 0x7, 0x7, 0x2, 0x2, 
+    0x5a3, 0x5a5, 0x7, 0x79, 0x2, 0x2, 0x5a4, 0x5a3, 0x3, 0x2, 0x2, 0x2, 
+    0x5a4, 0x5a5, 0x3, 0x2, 0x2, 0x2, 0x5a5, 0x5a6, 0x3, 0x2, 0x2, 0x2, 
+    0x5a6, 0x5a8, 0x5, 0x84, 0x43, 0x2, 0x5a7, 0x5a9, 0x7, 0x79, 0x2, 0x2, 
+    0x5a8, 0x5a7, 0x3, 0x2, 0x2, 0x2, 0x5a8, 0x5a9, 0x3, 0x2, 0x2, 0x2, 
+    0x5a9, 0x5ab, 0x3, 0x2, 0x2, 0x2, 0x5aa, 0x5a2, 0x3, 0x2, 0x2, 0x2, 
+    0x5ab, 0x5ae, 0x3, 0x2, 0x2, 0x2, 0x5ac, 0x5aa, 0x3, 0x2, 0x2, 0x2, 
+    0x5ac, 0x5ad, 0x3, 0x2, 0x2, 0x2, 0x5ad, 0x5b0, 0x3, 0x2, 0x2, 0x2, 
+    0x5ae, 0x5ac, 0x3, 0x2, 0x2, 0x2, 0x5af, 0x59e, 0x3, 0x2, 0x2, 0x2, 
+    0x5af, 0x5b0, 0x3, 0x2, 0x2, 0x2, 0x5b0, 0x5b1, 0x3, 0x2, 0x2, 0x2, 
+    0x5b1, 0x5b2, 0x7, 0x5, 0x2, 0x2, 0x5b2, 0x5b4, 0x3, 0x2, 0x2, 0x2, 
+    0x5b3, 0x582, 0x3, 0x2, 0x2, 0x2, 0x5b3, 0x590, 0x3, 0x2, 0x2, 0x2, 
+    0x5b4, 0xc1, 0x3, 0x2, 0x2, 0x2, 0x5b5, 0x5b6, 0x5, 0xdc, 0x6f, 0x2, 
+    0x5b6, 0xc3, 0x3, 0x2, 0x2, 0x2, 0x5b7, 0x5b9, 0x7, 0x65, 0x2, 0x2, 
+    0x5b8, 0x5ba, 0x7, 0x79, 0x2, 0x2, 0x5b9, 0x5b8, 0x3, 0x2, 0x2, 0x2, 
+    0x5b9, 0x5ba, 0x3, 0x2, 0x2, 0x2, 0x5ba, 0x5bb, 0x3, 0x2, 0x2, 0x2, 
+    0x5bb, 0x5bd, 0x7, 0xa, 0x2, 0x2, 0x5bc, 0x5be, 0x7, 0x79, 0x2, 0x2, 
+    0x5bd, 0x5bc, 0x3, 0x2, 0x2, 0x2, 0x5bd, 0x5be, 0x3, 0x2, 0x2, 0x2, 
+    0x5be, 0x5bf, 0x3, 0x2, 0x2, 0x2, 0x5bf, 0x5c1, 0x7, 0x44, 0x2, 0x2, 
+    0x5c0, 0x5c2, 0x7, 0x79, 0x2, 0x2, 0x5c1, 0x5c0, 0x3, 0x2, 0x2, 0x2, 
+    0x5c1, 0x5c2, 0x3, 0x2, 0x2, 0x2, 0x5c2, 0x5c3, 0x3, 0x2, 0x2, 0x2, 
+    0x5c3, 0x5c8, 0x5, 0x66, 0x34, 0x2, 0x5c4, 0x5c6, 0x7, 0x79, 0x2, 0x2, 
+    0x5c5, 0x5c4, 0x3, 0x2, 0x2, 0x2, 0x5c5, 0x5c6, 0x3, 0x2, 0x2, 0x2, 
+    0x5c6, 0x5c7, 0x3, 0x2, 0x2, 0x2, 0x5c7, 0x5c9, 0x5, 0x64, 0x33, 0x2, 
+    0x5c8, 0x5c5, 0x3, 0x2, 0x2, 0x2, 0x5c8, 0x5c9, 0x3, 0x2, 0x2, 0x2, 
+    0x5c9, 0x5cb, 0x3, 0x2, 0x2, 0x2, 0x5ca, 0x5cc, 0x7, 0x79, 0x2, 0x2, 
+    0x5cb, 0x5ca, 0x3, 0x2, 0x2, 0x2, 0x5cb, 0x5cc, 0x3, 0x2, 0x2, 0x2, 
+    0x5cc, 0x5cd, 0x3, 0x2, 0x2, 0x2, 0x5cd, 0x5ce, 0x7, 0xc, 0x2, 0x2, 
+    0x5ce, 0xc5, 0x3, 0x2, 0x2, 0x2, 0x5cf, 0x5d1, 0x7, 0x1c, 0x2, 0x2, 
+    0x5d0, 0x5d2, 0x7, 0x79, 0x2, 0x2, 0x5d1, 0x5d0, 0x3, 0x2, 0x2, 0x2, 
+    0x5d1, 0x5d2, 0x3, 0x2, 0x2, 0x2, 0x5d2, 0x5d3, 0x3, 0x2, 0x2, 0x2, 
+    0x5d3, 0x5d4, 0x5, 0xd4, 0x6b, 0x2, 0x5d4, 0xc7, 0x3, 0x2, 0x2, 0x2, 
+    0x5d5, 0x5da, 0x7, 0x66, 0x2, 0x2, 0x5d6, 0x5d8, 0x7, 0x79, 0x2, 0x2, 
+    0x5d7, 0x5d6, 0x3, 0x2, 0x2, 0x2, 0x5d7, 0x5d8, 0x3, 0x2, 0x2, 0x2, 
+    0x5d8, 0x5d9, 0x3, 0x2, 0x2, 0x2, 0x5d9, 0x5db, 0x5, 0xca, 0x66, 0x2, 
+    0x5da, 0x5d7, 0x3, 0x2, 0x2, 0x2, 0x5db, 0x5dc, 0x3, 0x2, 0x2, 0x2, 
+    0x5dc, 0x5da, 0x3, 0x2, 0x2, 0x2, 0x5dc, 0x5dd, 0x3, 0x2, 0x2, 0x2, 
+    0x5dd, 0x5ec, 0x3, 0x2, 0x2, 0x2, 0x5de, 0x5e0, 0x7, 0x66, 0x2, 0x2, 
+    0x5df, 0x5e1, 0x7, 0x79, 0x2, 0x2, 0x5e0, 0x5df, 0x3, 0x2, 0x2, 0x2, 
+    0x5e0, 0x5e1, 0x3, 0x2, 0x2, 0x2, 0x5e1, 0x5e2, 0x3, 0x2, 0x2, 0x2, 
+    0x5e2, 0x5e7, 0x5, 0x84, 0x43, 0x2, 0x5e3, 0x5e5, 0x7, 0x79, 0x2, 0x2, 
+    0x5e4, 0x5e3, 0x3, 0x2, 0x2, 0x2, 0x5e4, 0x5e5, 0x3, 0x2, 0x2, 0x2, 
+    0x5e5, 0x5e6, 0x3, 0x2, 0x2, 0x2, 0x5e6, 0x5e8, 0x5, 0xca, 0x66, 0x2, 
+    0x5e7, 0x5e4, 0x3, 0x2, 0x2, 0x2, 0x5e8, 0x5e9, 0x3, 0x2, 0x2, 0x2, 
+    0x5e9, 0x5e7, 0x3, 0x2, 0x2, 0x2, 0x5e9, 0x5ea, 0x3, 0x2, 0x2, 0x2, 
+    0x5ea, 0x5ec, 0x3, 0x2, 0x2, 0x2, 0x5eb, 0x5d5, 0x3, 0x2, 0x2, 0x2, 
+    0x5eb, 0x5de, 0x3, 0x2, 0x2, 0x2, 0x5ec, 0x5f5, 0x3, 0x2, 0x2, 0x2, 
+    0x5ed, 0x5ef, 0x7, 0x79, 0x2, 0x2, 0x5ee, 0x5ed, 0x3, 0x2, 0x2, 0x2, 
+    0x5ee, 0x5ef, 0x3, 0x2, 0x2, 0x2, 0x5ef, 0x5f0, 0x3, 0x2, 0x2, 0x2, 
+    0x5f0, 0x5f2, 0x7, 0x67, 0x2, 0x2, 0x5f1, 0x5f3, 0x7, 0x79, 0x2, 0x2, 
+    0x5f2, 0x5f1, 0x3, 0x2, 0x2, 0x2, 0x5f2, 0x5f3, 0x3, 0x2, 0x2, 0x2, 
+    0x5f3, 0x5f4, 0x3, 0x2, 0x2, 0x2, 0x5f4, 0x5f6, 0x5, 0x84, 0x43, 0x2, 
+    0x5f5, 0x5ee, 0x3, 0x2, 0x2, 0x2, 0x5f5, 0x5f6, 0x3, 0x2, 0x2, 0x2, 
+    0x5f6, 0x5f8, 0x3, 0x2, 0x2, 0x2, 0x5f7, 0x5f9, 0x7, 0x79, 0x2, 0x2, 
+    0x5f8, 0x5f7, 0x3, 0x2, 0x2, 0x2, 0x5f8, 0x5f9, 0x3, 0x2, 0x2, 0x2, 
+    0x5f9, 0x5fa, 0x3, 0x2, 0x2, 0x2, 0x5fa, 0x5fb, 0x7, 0x68, 0x2, 0x2, 
+    0x5fb, 0xc9, 0x3, 0x2, 0x2, 0x2, 0x5fc, 0x5fe, 0x7, 0x69, 0x2, 0x2, 
+    0x5fd, 0x5ff, 0x7, 0x79, 0x2, 0x2, 0x5fe, 0x5fd, 0x3, 0x2, 0x2, 0x2, 
+    0x5fe, 0x5ff, 0x3, 0x2, 0x2, 0x2, 0x5ff, 0x600, 0x3, 0x2, 0x2, 0x2, 
+    0x600, 0x602, 0x5, 0x84, 0x43, 0x2, 0x601, 0x603, 0x7, 0x79, 0x2, 0x2, 
+    0x602, 0x601, 0x3, 0x2, 0x2, 0x2, 0x602, 0x603, 0x3, 0x2, 0x2, 0x2, 
+    0x603, 0x604, 0x3, 0x2, 0x2, 0x2, 0x604, 0x606, 0x7, 0x6a, 0x2, 0x2, 
+    0x605, 0x607, 0x7, 0x79, 0x2, 0x2, 0x606, 0x605, 0x3, 0x2, 0x2, 0x2, 
+    0x606, 0x607, 0x3, 0x2, 0x2, 0x2, 0x607, 0x608, 0x3, 0x2, 0x2, 0x2, 
+    0x608, 0x609, 0x5, 0x84, 0x43, 0x2, 0x609, 0xcb, 0x3, 0x2, 0x2, 0x2, 
+    0x60a, 0x60b, 0x5, 0xdc, 0x6f, 0x2, 0x60b, 0xcd, 0x3, 0x2, 0x2, 0x2, 
+    0x60c, 0x60f, 0x5, 0xd8, 0x6d, 0x2, 0x60d, 0x60f, 0x5, 0xd6, 0x6c, 0x2, 
+    0x60e, 0x60c, 0x3, 0x2, 0x2, 0x2, 0x60e, 0x60d, 0x3, 0x2, 0x2, 0x2, 
+    0x60f, 0xcf, 0x3, 0x2, 0x2, 0x2, 0x610, 0x613, 0x7, 0x1d, 0x2, 0x2, 
+    0x611, 0x614, 0x5, 0xdc, 0x6f, 0x2, 0x612, 0x614, 0x7, 0x6d, 0x2, 0x2, 
+    0x613, 0x611, 0x3, 0x2, 0x2, 0x2, 0x613, 0x612, 0x3, 0x2, 0x2, 0x2, 
+    0x614, 0xd1, 0x3, 0x2, 0x2, 0x2, 0x615, 0x617, 0x5, 0xb6, 0x5c, 0x2, 
+    0x616, 0x618, 0x7, 0x79, 0x2, 0x2, 0x617, 0x616, 0x3, 0x2, 0x2, 0x2, 
+    0x617, 0x618, 0x3, 0x2, 0x2, 0x2, 0x618, 0x619, 0x3, 0x2, 0x2, 0x2, 
+    0x619, 0x61a, 0x5, 0xc6, 0x64, 0x2, 0x61a, 0xd3, 0x3, 0x2, 0x2, 0x2, 
+    0x61b, 0x61c, 0x5, 0xda, 0x6e, 0x2, 0x61c, 0xd5, 0x3, 0x2, 0x2, 0x2, 
+    0x61d, 0x61e, 0x7, 0x6d, 0x2, 0x2, 0x61e, 0xd7, 0x3, 0x2, 0x2, 0x2, 
+    0x61f, 0x620, 0x7, 0x74, 0x2, 0x2, 0x620, 0xd9, 0x3, 0x2, 0x2, 0x2, 
+    0x621, 0x622, 0x5, 0xdc, 0x6f, 0x2, 0x622, 0xdb, 0x3, 0x2, 0x2, 0x2, 
+    0x623, 0x628, 0x7, 0x75, 0x2, 0x2, 0x624, 0x625, 0x7, 0x78, 0x2, 0x2, 
+    0x625, 0x628, 0x8, 0x6f, 0x1, 0x2, 0x626, 0x628, 0x7, 0x6e, 0x2, 0x2, 
+    0x627, 0x623, 0x3, 0x2, 0x2, 0x2, 0x627, 0x624, 0x3, 0x2, 0x2, 0x2, 
+    0x627, 0x626, 0x3, 0x2, 0x2, 0x2, 0x628, 0xdd, 0x3, 0x2, 0x2, 0x2, 0x629, 
+    0x62a, 0x9, 0x8, 0x2, 0x2, 0x62a, 0xdf, 0x3, 0x2, 0x2, 0x2, 0x62b, 0x62c, 
+    0x9, 0x9, 0x2, 0x2, 0x62c, 0xe1, 0x3, 0x2, 0x2, 0x2, 0x62d, 0x62e, 0x9, 
+    0xa, 0x2, 0x2, 0x62e, 0xe3, 0x3, 0x2, 0x2, 0x2, 0x630, 0x632, 0x3, 0x2, 
+    0x2, 0x2, 0x632, 0x633, 0x7, 0x46, 0x2, 0x2, 0x633, 0x634, 0x7, 0x79, 
+    0x2, 0x2, 0x634, 0x635, 0x7, 0x7d, 0x2, 0x2, 0x635, 0x636, 0x7, 0x79, 
+    0x2, 0x2, 0x636, 0x637, 0x7, 0x7e, 0x2, 0x2, 0x637, 0x638, 0x7, 0x79, 
+    0x2, 0x2, 0x638, 0x63a, 0x5, 0xda, 0x6e, 0x2, 0x639, 0x63b, 0x7, 0x79, 
+    0x2, 0x2, 0x63a, 0x639, 0x3, 0x2, 0x2, 0x2, 0x63a, 0x63b, 0x3, 0x2, 0x2, 
+    0x2, 0x63b, 0x63c, 0x3, 0x2, 0x2, 0x2, 0x63c, 0x63e, 0x7, 0x4, 0x2, 0x2, 
+    0x63d, 0x63f, 0x7, 0x79, 0x2, 0x2, 0x63e, 0x63d, 0x3, 0x2, 0x2, 0x2, 
+    0x63e, 0x63f, 0x3, 0x2, 0x2, 0x2, 0x63f, 0x640, 0x3, 0x2, 0x2, 0x2, 
+    0x640, 0x642, 0x5, 0xd4, 0x6b, 0x2, 0x641, 0x643, 0x7, 0x79, 0x2, 0x2, 
+    0x642, 0x641, 0x3, 0x2, 0x2, 0x2, 0x642, 0x643, 0x3, 0x2, 0x2, 0x2, 
+    0x643, 0x644, 0x3, 0x2, 0x2, 0x2, 0x644, 0x645, 0x7, 0x5, 0x2, 0x2, 
+    0x645, 0x631, 0x3, 0x2, 0x2, 0x2, 0x646, 0x153, 0x5, 0x630, 0x73, 0x2, 
+    0x116, 0xe5, 0xe8, 0xeb, 0xf0, 0xf3, 0xf6, 0xf9, 0x105, 0x109, 0x10d, 
+    0x111, 0x115, 0x119, 0x11d, 0x122, 0x129, 0x12d, 0x131, 0x134, 0x138, 
+    0x13c, 0x141, 0x146, 0x14a, 0x152, 0x15c, 0x160, 0x164, 0x168, 0x16d, 
+    0x179, 0x17d, 0x187, 0x18b, 0x18f, 0x191, 0x195, 0x199, 0x19b, 0x1b1, 
+    0x1bc, 0x1d2, 0x1d6, 0x1db, 0x1e6, 0x1ea, 0x1ee, 0x1f6, 0x1fc, 0x201, 
+    0x207, 0x213, 0x218, 0x21d, 0x221, 0x226, 0x22c, 0x231, 0x234, 0x238, 
+    0x23c, 0x240, 0x246, 0x24a, 0x24f, 0x254, 0x258, 0x25b, 0x25f, 0x263, 
+    0x267, 0x26b, 0x26f, 0x275, 0x279, 0x27e, 0x282, 0x28a, 0x28e, 0x292, 
+    0x296, 0x29a, 0x29d, 0x2a1, 0x2ab, 0x2b1, 0x2b5, 0x2b9, 0x2be, 0x2c3, 
+    0x2c7, 0x2cd, 0x2d1, 0x2d5, 0x2da, 0x2e0, 0x2e3, 0x2e9, 0x2ec, 0x2f2, 
+    0x2f6, 0x2fa, 0x2fe, 0x302, 0x307, 0x30c, 0x310, 0x315, 0x318, 0x321, 
+    0x32a, 0x32f, 0x33c, 0x33f, 0x347, 0x34b, 0x350, 0x359, 0x35e, 0x365, 
+    0x369, 0x36d, 0x36f, 0x373, 0x375, 0x379, 0x37b, 0x37f, 0x383, 0x385, 
+    0x389, 0x38b, 0x38f, 0x391, 0x394, 0x398, 0x39e, 0x3a2, 0x3a5, 0x3a8, 
+    0x3ae, 0x3b1, 0x3b4, 0x3b8, 0x3bc, 0x3c0, 0x3c4, 0x3c6, 0x3ca, 0x3cc, 
+    0x3d0, 0x3d2, 0x3d6, 0x3d8, 0x3de, 0x3e2, 0x3e6, 0x3ea, 0x3ee, 0x3f2, 
+    0x3f6, 0x3fa, 0x3fe, 0x401, 0x407, 0x40b, 0x40f, 0x412, 0x417, 0x41c, 
+    0x421, 0x426, 0x42c, 0x430, 0x434, 0x445, 0x44f, 0x459, 0x45e, 0x460, 
+    0x466, 0x46a, 0x46e, 0x472, 0x476, 0x47e, 0x482, 0x486, 0x48a, 0x490, 
+    0x494, 0x49a, 0x49e, 0x4a3, 0x4a8, 0x4ac, 0x4b1, 0x4b6, 0x4ba, 0x4c0, 
+    0x4c7, 0x4cb, 0x4d1, 0x4d8, 0x4dc, 0x4e2, 0x4e9, 0x4ed, 0x4f2, 0x4f7, 
+    0x4f9, 0x4fd, 0x500, 0x506, 0x50a, 0x50d, 0x510, 0x517, 0x51b, 0x51f, 
+    0x52e, 0x531, 0x536, 0x544, 0x548, 0x54b, 0x554, 0x55b, 0x561, 0x565, 
+    0x569, 0x56d, 0x571, 0x574, 0x57a, 0x57e, 0x584, 0x588, 0x58c, 0x592, 
+    0x596, 0x59a, 0x59c, 0x5a0, 0x5a4, 0x5a8, 0x5ac, 0x5af, 0x5b3, 0x5b9, 
+    0x5bd, 0x5c1, 0x5c5, 0x5c8, 0x5cb, 0x5d1, 0x5d7, 0x5dc, 0x5e0, 0x5e4, 
+    0x5e9, 0x5eb, 0x5ee, 0x5f2, 0x5f5, 0x5f8, 0x5fe, 0x602, 0x606, 0x60e, 
+    0x613, 0x617, 0x627, 0x63a, 0x63e, 0x642, 
   };
 
   atn::ATNDeserializer deserializer;
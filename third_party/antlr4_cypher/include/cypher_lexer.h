@@ -33,7 +33,8 @@ public:
     HexLetter = 108, HexDigit = 109, Digit = 110, NonZeroDigit = 111, NonZeroOctDigit = 112, 
     ZeroDigit = 113, RegularDecimalReal = 114, UnescapedSymbolicName = 115, 
     IdentifierStart = 116, IdentifierPart = 117, EscapedSymbolicName = 118, 
-    SP = 119, WHITESPACE = 120, Comment = 121, Unknown = 122
+    SP = 119, WHITESPACE = 120, Comment = 121, Unknown = 122, INDEX = 123, 
+    ON = 124
   };
 
   explicit CypherLexer(antlr4::CharStream *input);
@@ -33,7 +33,8 @@ public:
     HexLetter = 108, HexDigit = 109, Digit = 110, NonZeroDigit = 111, NonZeroOctDigit = 112, 
     ZeroDigit = 113, RegularDecimalReal = 114, UnescapedSymbolicName = 115, 
     IdentifierStart = 116, IdentifierPart = 117, EscapedSymbolicName = 118, 
-    SP = 119, WHITESPACE = 120, Comment = 121, Unknown = 122
+    SP = 119, WHITESPACE = 120, Comment = 121, Unknown = 122, INDEX = 123, 
+    ON = 124
   };
 
   enum {
@@ -74,7 +75,7 @@ public:
     RuleOC_NumberLiteral = 102, RuleOC_Parameter = 103, RuleOC_PropertyExpression = 104, 
     RuleOC_PropertyKeyName = 105, RuleOC_IntegerLiteral = 106, RuleOC_DoubleLiteral = 107, 
     RuleOC_SchemaName = 108, RuleOC_SymbolicName = 109, RuleOC_LeftArrowHead = 110, 
-    RuleOC_RightArrowHead = 111, RuleOC_Dash = 112
+    RuleOC_RightArrowHead = 111, RuleOC_Dash = 112, RuleKU_CreateIndex = 113
   };
 
   explicit CypherParser(antlr4::TokenStream *input);
@@ -199,7 +200,8 @@ public:
   class OC_SymbolicNameContext;
   class OC_LeftArrowHeadContext;
   class OC_RightArrowHeadContext;
-  class OC_DashContext; 
+  class OC_DashContext;
+  class KU_CreateIndexContext; 
 
   class  OC_CypherContext : public antlr4::ParserRuleContext {
   public:
@@ -286,6 +288,7 @@ public:
     KU_CreateRelContext *kU_CreateRel();
     KU_DropTableContext *kU_DropTable();
     KU_AlterTableContext *kU_AlterTable();
+    KU_CreateIndexContext *kU_CreateIndex();
 
    
   };
@@ -1773,6 +1776,23 @@ public:
 
   OC_DashContext* oC_Dash();
 
+  class  KU_CreateIndexContext : public antlr4::ParserRuleContext {
+  public:
+    KU_CreateIndexContext(antlr4::ParserRuleContext *parent, size_t invokingState);
+    virtual size_t getRuleIndex() const override;
+    antlr4::tree::TerminalNode *CREATE();
+    std::vector<antlr4::tree::TerminalNode *> SP();
+    antlr4::tree::TerminalNode* SP(size_t i);
+    antlr4::tree::TerminalNode *INDEX();
+    antlr4::tree::TerminalNode *ON();
+    OC_SchemaNameContext *oC_SchemaName();
+    OC_PropertyKeyNameContext *oC_PropertyKeyName();
+
+   
+  };
+
+  KU_CreateIndexContext* kU_CreateIndex();
+
 
 private:
   static std::vector<antlr4::dfa::DFA> _decisionToDFA;